@@ -0,0 +1,81 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "logging\logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <chrono>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	/**
+	 Times the given function.
+
+	 The function is invoked once to warm up the caches, after which the
+	 best and average time of the given number of invocations are logged.
+
+	 @tparam		FunctionT
+					The function type.
+	 @param[in]		name
+					The name of the function.
+	 @param[in]		nb_iterations
+					The number of timed iterations.
+	 @param[in]		function
+					The function.
+	 @return		The result of the last invocation of the given
+					function.
+	 */
+	template< typename FunctionT >
+	auto Time(std::string_view name, std::size_t nb_iterations,
+			  FunctionT&& function) {
+
+		using Clock        = std::chrono::steady_clock;
+		using Milliseconds = std::chrono::duration< F64, std::milli >;
+
+		// Warm up the caches.
+		auto result = function();
+
+		auto total = Milliseconds::zero();
+		auto best  = Milliseconds::max();
+		for (std::size_t i = 0u; i < nb_iterations; ++i) {
+			const auto start = Clock::now();
+			result = function();
+			const auto time = Milliseconds(Clock::now() - start);
+
+			total += time;
+			best   = std::min(best, time);
+		}
+
+		Info("{:<28} {:>10.4f} ms (best) {:>10.4f} ms (average)",
+			 name, best.count(), total.count() / nb_iterations);
+
+		return result;
+	}
+
+	/**
+	 Checks and benchmarks the rasterization and visibility tests of
+	 occlusion buffers.
+
+	 @param[in]		nb_iterations
+					The number of timed iterations.
+	 @return		@c true if all checks succeeded. @c false otherwise.
+	 */
+	[[nodiscard]]
+	bool BenchmarkOcclusionBuffer(std::size_t nb_iterations);
+}
@@ -0,0 +1,252 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "geometry\culling.hpp"
+#include "parallel\parallel.hpp"
+#include "sampling\rng.hpp"
+#include "string\string_utils.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+namespace {
+
+	using namespace mage;
+	using namespace mage::benchmark;
+
+	constexpr const_zstring g_usage =
+		"Usage: Benchmark [options]\n"
+		"  --objects <n>     The number of bounding volumes (default: 100000).\n"
+		"  --iterations <n>  The number of timed iterations (default: 100).";
+
+	/**
+	 A class of benchmark scenes containing randomly distributed bounding
+	 volumes, both as an array of structures and as a structure of arrays.
+	 */
+	struct Scene {
+
+	public:
+
+		std::vector< AABB > m_aabbs;
+
+		std::vector< BoundingSphere > m_spheres;
+
+		AABBArray m_aabb_array;
+
+		BoundingSphereArray m_sphere_array;
+	};
+
+	/**
+	 Generates a benchmark scene.
+
+	 The bounding volumes are distributed uniformly in a cube centered at
+	 the camera, so roughly a quarter of the bounding volumes is visible.
+
+	 @param[in]		nb_objects
+					The number of bounding volumes.
+	 @return		The benchmark scene.
+	 */
+	[[nodiscard]]
+	const Scene GenerateScene(std::size_t nb_objects) {
+		Scene scene;
+		scene.m_aabbs.reserve(nb_objects);
+		scene.m_spheres.reserve(nb_objects);
+		scene.m_aabb_array.reserve(nb_objects);
+		scene.m_sphere_array.reserve(nb_objects);
+
+		RNG rng;
+		for (std::size_t i = 0u; i < nb_objects; ++i) {
+			const auto c = XMVectorSet(rng.Uniform(-100.0f, 100.0f),
+									   rng.Uniform(-100.0f, 100.0f),
+									   rng.Uniform(-100.0f, 100.0f),
+									   0.0f);
+			const auto r = XMVectorSet(rng.Uniform(0.25f, 2.0f),
+									   rng.Uniform(0.25f, 2.0f),
+									   rng.Uniform(0.25f, 2.0f),
+									   0.0f);
+
+			const AABB aabb(c - r, c + r);
+			const BoundingSphere sphere(aabb);
+
+			scene.m_aabbs.push_back(aabb);
+			scene.m_spheres.push_back(sphere);
+			scene.m_aabb_array.push_back(aabb);
+			scene.m_sphere_array.push_back(sphere);
+		}
+
+		return scene;
+	}
+
+	/**
+	 Benchmarks the per-object culling loop against the given culling
+	 kernels for the given bounding volumes.
+
+	 @tparam		BoundingVolumeT
+					The bounding volume type.
+	 @tparam		BoundingVolumeArrayT
+					The bounding volume array type.
+	 @param[in]		name
+					The name of the bounding volume type.
+	 @param[in]		frustum
+					A reference to the bounding frustum.
+	 @param[in]		volumes
+					A reference to the vector containing the bounding
+					volumes.
+	 @param[in]		volume_array
+					A reference to the array containing the same bounding
+					volumes.
+	 @param[in]		kernels
+					The culling kernels.
+	 @param[in]		nb_iterations
+					The number of timed iterations.
+	 @return		@c true if all culling kernels agree with the
+					per-object culling loop. @c false otherwise.
+	 */
+	template< typename BoundingVolumeT, typename BoundingVolumeArrayT >
+	bool BenchmarkCulling(const char* name,
+						  const BoundingFrustum& frustum,
+						  const std::vector< BoundingVolumeT >& volumes,
+						  const BoundingVolumeArrayT& volume_array,
+						  gsl::span< const CullingKernel > kernels,
+						  std::size_t nb_iterations) {
+
+		std::vector< U32 > expected(volumes.size());
+		std::vector< U32 > visible(volumes.size());
+
+		const auto nb_expected = Time(
+			Format("{} (Overlaps)", name), nb_iterations,
+			[&frustum, &volumes, &expected]() noexcept {
+				std::size_t count = 0u;
+				for (std::size_t i = 0u; i < volumes.size(); ++i) {
+					if (frustum.Overlaps(volumes[i])) {
+						expected[count++] = static_cast< U32 >(i);
+					}
+				}
+				return count;
+			});
+
+		constexpr const_zstring kernel_names[] = { "scalar", "SSE2", "AVX2" };
+
+		Info("{}: {} of {} visible.", name, nb_expected, volumes.size());
+
+		auto valid = true;
+		for (const auto kernel : kernels) {
+			const auto kernel_name = kernel_names[static_cast< std::size_t >(kernel)];
+			const auto nb_visible = Time(
+				Format("{} ({})", name, kernel_name), nb_iterations,
+				[&frustum, &volume_array, &visible, kernel]() noexcept {
+					return Cull(frustum, volume_array, visible.data(), kernel);
+				});
+
+			if (nb_expected != nb_visible
+				|| !std::equal(expected.cbegin(), expected.cbegin() + nb_expected,
+							   visible.cbegin())) {
+				Error("{} ({}): the visible indices differ from Overlaps.",
+					  name, kernel_name);
+				valid = false;
+			}
+		}
+
+		return valid;
+	}
+
+	/**
+	 Parses the given count argument.
+
+	 @param[in]		arg
+					The argument.
+	 @return		The count.
+	 @return		@c std::nullopt if the given argument is not a positive
+					count.
+	 */
+	[[nodiscard]]
+	std::optional< std::size_t > ParseCount(const char* arg) {
+		if (nullptr == arg) {
+			return {};
+		}
+
+		const auto count = StringTo< std::size_t >(arg);
+		return (count && 0u != *count) ? count : std::nullopt;
+	}
+}
+
+/**
+ The entry point of the benchmark.
+
+ @param[in]		argc
+				The number of command line arguments.
+ @param[in]		argv
+				A pointer to the command line arguments.
+ @return		@c 0, if all culling kernels agree with the per-object
+				culling loop and all occlusion buffer checks succeed.
+ @return		@c 1, otherwise.
+ */
+int main(int argc, char* argv[]) {
+	using namespace mage;
+	using namespace mage::benchmark;
+
+	std::size_t nb_objects    = 100000u;
+	std::size_t nb_iterations = 100u;
+
+	for (int i = 1; i < argc; ++i) {
+		const std::string_view arg(argv[i]);
+		const auto next = (i + 1 < argc) ? argv[i + 1] : nullptr;
+
+		if ("--objects" == arg && ParseCount(next)) {
+			nb_objects = *ParseCount(next);
+			++i;
+		}
+		else if ("--iterations" == arg && ParseCount(next)) {
+			nb_iterations = *ParseCount(next);
+			++i;
+		}
+		else {
+			Error("Invalid argument: {}\n{}", arg, g_usage);
+			return 1;
+		}
+	}
+
+	const auto scene = GenerateScene(nb_objects);
+
+	// The camera is located at the origin and looks along the z axis (i.e.
+	// world space and view space coincide).
+	const BoundingFrustum frustum(
+		XMMatrixPerspectiveFovLH(XM_PIDIV2, 16.0f / 9.0f, 0.1f, 100.0f));
+
+	std::vector< CullingKernel > kernels = {
+		CullingKernel::Scalar, CullingKernel::SSE2
+	};
+	if (SupportsAVX2()) {
+		kernels.push_back(CullingKernel::AVX2);
+	}
+	else {
+		Warning("The processor does not support AVX2: skipped the AVX2 kernel.");
+	}
+
+	Info("Culling {} bounding volumes ({} iterations):",
+		 nb_objects, nb_iterations);
+
+	auto valid = BenchmarkCulling("AABB", frustum,
+								  scene.m_aabbs, scene.m_aabb_array,
+								  gsl::make_span(kernels), nb_iterations);
+	valid &= BenchmarkCulling("BoundingSphere", frustum,
+							  scene.m_spheres, scene.m_sphere_array,
+							  gsl::make_span(kernels), nb_iterations);
+
+	Info("Occlusion buffer ({} iterations):", nb_iterations);
+
+	valid &= BenchmarkOcclusionBuffer(nb_iterations);
+
+	return valid ? 0 : 1;
+}
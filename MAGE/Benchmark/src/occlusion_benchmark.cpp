@@ -0,0 +1,307 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "benchmark.hpp"
+#include "geometry\occlusion_buffer.hpp"
+#include "sampling\rng.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::benchmark {
+
+	namespace {
+
+		/**
+		 The width (in pixels) of the occlusion buffers.
+		 */
+		constexpr U32 g_width = 256u;
+
+		/**
+		 The height (in pixels) of the occlusion buffers.
+		 */
+		constexpr U32 g_height = 144u;
+
+		/**
+		 The number of random occluder triangles.
+		 */
+		constexpr std::size_t g_nb_triangles = 8192u;
+
+		/**
+		 The number of random occludees.
+		 */
+		constexpr std::size_t g_nb_occludees = 16384u;
+
+		/**
+		 Returns the view-to-projection transformation matrix (with an
+		 inverted depth) of the camera. The camera is located at the origin
+		 and looks along the z axis.
+
+		 @return		The view-to-projection transformation matrix of the
+						camera.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV GetViewToProjectionMatrix() noexcept {
+			// Swapping the near and far plane inverts the depth.
+			return XMMatrixPerspectiveFovLH(XM_PIDIV2,
+											static_cast< F32 >(g_width)
+											/ static_cast< F32 >(g_height),
+											1000.0f, 0.1f);
+		}
+
+		/**
+		 Constructs an occluder mesh of an axis-aligned rectangle facing the
+		 camera.
+
+		 @param[in]		min_x
+						The minimum x coordinate of the rectangle.
+		 @param[in]		max_x
+						The maximum x coordinate of the rectangle.
+		 @param[in]		min_y
+						The minimum y coordinate of the rectangle.
+		 @param[in]		max_y
+						The maximum y coordinate of the rectangle.
+		 @param[in]		z
+						The z coordinate of the rectangle.
+		 @return		The occluder mesh.
+		 */
+		[[nodiscard]]
+		const OccluderMesh CreateRectangle(F32 min_x, F32 max_x,
+										   F32 min_y, F32 max_y,
+										   F32 z) {
+			std::vector< F32x3 > positions = {
+				F32x3(min_x, min_y, z),
+				F32x3(max_x, min_y, z),
+				F32x3(max_x, max_y, z),
+				F32x3(min_x, max_y, z)
+			};
+			std::vector< U32 > indices = { 0u, 1u, 2u, 0u, 2u, 3u };
+
+			return OccluderMesh(std::move(positions), std::move(indices));
+		}
+
+		/**
+		 Constructs an AABB.
+
+		 @param[in]		x
+						The x coordinates of the minimum and maximum extents.
+		 @param[in]		y
+						The y coordinates of the minimum and maximum extents.
+		 @param[in]		z
+						The z coordinates of the minimum and maximum extents.
+		 @return		The AABB.
+		 */
+		[[nodiscard]]
+		const AABB CreateAABB(const F32x2& x, const F32x2& y, const F32x2& z) noexcept {
+			return AABB(XMVectorSet(x[0], y[0], z[0], 0.0f),
+						XMVectorSet(x[1], y[1], z[1], 0.0f));
+		}
+
+		/**
+		 Checks the given condition.
+
+		 @param[in]		condition
+						The condition.
+		 @param[in]		description
+						The description of the condition.
+		 @return		@a condition.
+		 */
+		bool Check(bool condition, std::string_view description) {
+			if (!condition) {
+				Error("Occlusion buffer: {}.", description);
+			}
+
+			return condition;
+		}
+
+		/**
+		 Checks the depths and visibility tests of an occlusion buffer with a
+		 single (partial) occluder.
+
+		 @return		@c true if all checks succeeded. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool CheckVisibility() {
+			const auto view_to_projection = GetViewToProjectionMatrix();
+
+			OcclusionBuffer buffer(g_width, g_height);
+			buffer.Rasterize();
+
+			auto valid = true;
+			valid &= Check(buffer.IsVisible(view_to_projection,
+											CreateAABB({ -1.0f, 1.0f },
+													   { -1.0f, 1.0f },
+													   { 50.0f, 51.0f })),
+						   "an AABB is occluded by an empty buffer");
+
+			// The occluder covers the left half of the view frustum at z = 10.
+			buffer.AddOccluder(view_to_projection,
+							   CreateRectangle(-100.0f, 0.0f, -100.0f, 100.0f, 10.0f));
+			buffer.Rasterize();
+
+			const auto expected_depth = XMVectorGetZ(XMVector3TransformCoord(
+				XMVectorSet(0.0f, 0.0f, 10.0f, 1.0f), view_to_projection));
+
+			auto nb_covered_errors   = 0u;
+			auto nb_uncovered_errors = 0u;
+			for (U32 y = 0u; y < buffer.GetHeight(); ++y) {
+				for (U32 x = 0u; x < buffer.GetWidth(); ++x) {
+					const auto depth = buffer.GetDepth(x, y);
+					if (x < buffer.GetWidth() / 2u) {
+						nb_covered_errors
+							+= (1e-4f < std::abs(depth - expected_depth)) ? 1u : 0u;
+					}
+					else {
+						nb_uncovered_errors += (0.0f != depth) ? 1u : 0u;
+					}
+				}
+			}
+			valid &= Check(0u == nb_covered_errors,
+						   "the depths of the occluder are wrong");
+			valid &= Check(0u == nb_uncovered_errors,
+						   "pixels outside the occluder are covered");
+
+			valid &= Check(!buffer.IsVisible(view_to_projection,
+											 CreateAABB({ -6.0f, -4.0f },
+														{ -1.0f,  1.0f },
+														{ 20.0f, 22.0f })),
+						   "an AABB behind the occluder is visible");
+			valid &= Check(buffer.IsVisible(view_to_projection,
+											CreateAABB({ 4.0f, 6.0f },
+													   { -1.0f, 1.0f },
+													   { 20.0f, 22.0f })),
+						   "an AABB beside the occluder is occluded");
+			valid &= Check(buffer.IsVisible(view_to_projection,
+											CreateAABB({ -2.0f, 2.0f },
+													   { -1.0f, 1.0f },
+													   { 20.0f, 22.0f })),
+						   "an AABB partially behind the occluder is occluded");
+			valid &= Check(buffer.IsVisible(view_to_projection,
+											CreateAABB({ -6.0f, -4.0f },
+													   { -1.0f,  1.0f },
+													   {  5.0f,  6.0f })),
+						   "an AABB in front of the occluder is occluded");
+			valid &= Check(buffer.IsVisible(view_to_projection,
+											CreateAABB({ -6.0f, -4.0f },
+													   { -1.0f,  1.0f },
+													   { -1.0f,  1.0f })),
+						   "an AABB crossing the near plane is occluded");
+			valid &= Check(!buffer.IsVisible(view_to_projection,
+											 CreateAABB({ 100.0f, 101.0f },
+														{  -1.0f,   1.0f },
+														{  20.0f,  22.0f })),
+						   "an AABB outside the view frustum is visible");
+
+			return valid;
+		}
+
+		/**
+		 Constructs an occluder mesh of random triangles inside the view
+		 frustum.
+
+		 @param[in]		rng
+						A reference to the random number generator.
+		 @return		The occluder mesh.
+		 */
+		[[nodiscard]]
+		const OccluderMesh CreateRandomTriangles(RNG& rng) {
+			std::vector< F32x3 > positions;
+			std::vector< U32 > indices;
+			positions.reserve(3u * g_nb_triangles);
+			indices.reserve(3u * g_nb_triangles);
+
+			for (std::size_t i = 0u; i < 3u * g_nb_triangles; i += 3u) {
+				const auto z = rng.Uniform(5.0f, 500.0f);
+				const auto x = rng.Uniform(-1.5f, 1.5f) * z;
+				const auto y = rng.Uniform(-1.0f, 1.0f) * z;
+				const auto r = rng.Uniform(0.01f, 0.1f) * z;
+
+				positions.emplace_back(x - r, y - r, z + rng.Uniform(-r, r));
+				positions.emplace_back(x + r, y - r, z + rng.Uniform(-r, r));
+				positions.emplace_back(x,     y + r, z + rng.Uniform(-r, r));
+				indices.push_back(static_cast< U32 >(i));
+				indices.push_back(static_cast< U32 >(i + 1u));
+				indices.push_back(static_cast< U32 >(i + 2u));
+			}
+
+			return OccluderMesh(std::move(positions), std::move(indices));
+		}
+	}
+
+	bool BenchmarkOcclusionBuffer(std::size_t nb_iterations) {
+		auto valid = CheckVisibility();
+
+		const auto view_to_projection = GetViewToProjectionMatrix();
+
+		RNG rng;
+		const auto mesh = CreateRandomTriangles(rng);
+
+		std::vector< AABB > occludees;
+		occludees.reserve(g_nb_occludees);
+		for (std::size_t i = 0u; i < g_nb_occludees; ++i) {
+			const auto z = rng.Uniform(5.0f, 500.0f);
+			const auto x = rng.Uniform(-1.5f, 1.5f) * z;
+			const auto y = rng.Uniform(-1.0f, 1.0f) * z;
+			const auto r = rng.Uniform(0.005f, 0.05f) * z;
+			occludees.push_back(CreateAABB({ x - r, x + r },
+										   { y - r, y + r },
+										   { z - r, z + r }));
+		}
+
+		OcclusionBuffer buffer(g_width, g_height);
+		buffer.AddOccluder(view_to_projection, mesh);
+
+		// Rasterizing the bands of tile rows separately (i.e. as the worker
+		// threads of the occlusion culler do) results in the same depths.
+		auto banded_buffer = buffer;
+		buffer.Rasterize();
+		for (auto tile_row = banded_buffer.GetNumberOfTileRows(); 0u < tile_row;
+			 --tile_row) {
+			banded_buffer.Rasterize(tile_row - 1u, tile_row);
+		}
+
+		auto nb_mismatches = 0u;
+		for (U32 y = 0u; y < buffer.GetHeight(); ++y) {
+			for (U32 x = 0u; x < buffer.GetWidth(); ++x) {
+				nb_mismatches += (buffer.GetDepth(x, y)
+								  != banded_buffer.GetDepth(x, y)) ? 1u : 0u;
+			}
+		}
+		valid &= Check(0u == nb_mismatches,
+					   "the depths of banded rasterization differ");
+
+		Time(Format("Rasterize ({} triangles)", buffer.GetNumberOfTriangles()),
+			 nb_iterations,
+			 [&buffer]() noexcept {
+				 buffer.Rasterize();
+				 return buffer.GetNumberOfTriangles();
+			 });
+
+		const auto nb_visible = Time(
+			Format("IsVisible ({} AABBs)", occludees.size()), nb_iterations,
+			[&buffer, &occludees, &view_to_projection]() noexcept {
+				std::size_t count = 0u;
+				for (const auto& aabb : occludees) {
+					count += buffer.IsVisible(view_to_projection, aabb) ? 1u : 0u;
+				}
+				return count;
+			});
+
+		Info("IsVisible: {} of {} visible.", nb_visible, occludees.size());
+
+		return valid;
+	}
+}
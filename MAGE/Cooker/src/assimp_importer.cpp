@@ -0,0 +1,325 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "assimp_importer.hpp"
+#include "exception/exception.hpp"
+#include "logging/logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "assimp/DefaultIOSystem.h"
+#include "assimp/Importer.hpp"
+#include "assimp/pbrmaterial.h"
+#include "assimp/postprocess.h"
+#include "assimp/scene.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <limits>
+#include <set>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::cooker {
+
+	namespace {
+
+		/**
+		 The Assimp post-processing steps applied to all imported models.
+		 */
+		constexpr unsigned int g_assimp_flags = aiProcess_ConvertToLeftHanded
+			                                  | aiProcess_Triangulate
+			                                  | aiProcess_JoinIdenticalVertices
+			                                  | aiProcess_GenSmoothNormals
+			                                  | aiProcess_PreTransformVertices
+			                                  | aiProcess_RemoveRedundantMaterials
+			                                  | aiProcess_SortByPType
+			                                  | aiProcess_FindDegenerates
+			                                  | aiProcess_FindInvalidData
+			                                  | aiProcess_ValidateDataStructure;
+
+		/**
+		 A class of Assimp IO systems recording the paths of all opened
+		 files.
+		 */
+		class RecordingIOSystem : public Assimp::DefaultIOSystem {
+
+		public:
+
+			explicit RecordingIOSystem(
+				std::vector< std::filesystem::path >& paths)
+				: DefaultIOSystem(),
+				m_paths(paths) {}
+
+			Assimp::IOStream* Open(const char* file,
+								   const char* mode = "rb") override {
+
+				const auto stream = DefaultIOSystem::Open(file, mode);
+				if (nullptr != stream) {
+					auto path = std::filesystem::absolute(
+						std::filesystem::u8path(file)).lexically_normal();
+					if (std::find(m_paths.cbegin(), m_paths.cend(), path)
+						== m_paths.cend()) {
+						m_paths.push_back(std::move(path));
+					}
+				}
+
+				return stream;
+			}
+
+		private:
+
+			std::vector< std::filesystem::path >& m_paths;
+		};
+
+		/**
+		 Returns a unique name which can be stored as a single token of a
+		 MDL or MTL file.
+
+		 @param[in]		name
+						The preferred name.
+		 @param[in]		prefix
+						The prefix of the fallback name.
+		 @param[in]		index
+						The index of the fallback name.
+		 @param[in,out]	names
+						A reference to the set of names already in use.
+		 @return		The unique name.
+		 */
+		[[nodiscard]]
+		std::string MakeUniqueName(std::string_view name,
+								   std::string_view prefix,
+								   std::size_t index,
+								   std::set< std::string >& names) {
+
+			std::string result(name);
+			std::replace_if(result.begin(), result.end(), [](char c) noexcept {
+				return 0 != std::isspace(static_cast< unsigned char >(c));
+			}, '_');
+
+			if (result.empty() || 0u != names.count(result)) {
+				result = std::string(prefix) + '_' + std::to_string(index);
+			}
+
+			names.insert(result);
+			return result;
+		}
+
+		/**
+		 Returns the path of the given texture of the given Assimp material.
+
+		 @param[in]		material
+						A reference to the Assimp material.
+		 @param[in]		type
+						The texture type.
+		 @param[in]		path
+						A reference to the path of the imported file.
+		 @return		The (absolute) path of the given texture.
+		 @return		An empty path if the given texture is missing or
+						embedded.
+		 */
+		[[nodiscard]]
+		std::filesystem::path GetTexturePath(const aiMaterial& material,
+											 aiTextureType type,
+											 const std::filesystem::path& path) {
+
+			aiString texture;
+			if (AI_SUCCESS != material.GetTexture(type, 0u, &texture)) {
+				return {};
+			}
+
+			// Embedded textures are referenced as "*<index>".
+			if ('*' == texture.C_Str()[0]) {
+				Warning("{}: embedded textures are not supported: {}.",
+						path, texture.C_Str());
+				return {};
+			}
+
+			const auto texture_path = std::filesystem::u8path(texture.C_Str());
+			return std::filesystem::absolute(path.parent_path() / texture_path)
+				.lexically_normal();
+		}
+
+		/**
+		 Imports the given Assimp material.
+
+		 @param[in]		material
+						A reference to the Assimp material.
+		 @param[in]		name
+						The name of the material.
+		 @param[in]		path
+						A reference to the path of the imported file.
+		 @return		The cooked material.
+		 */
+		[[nodiscard]]
+		CookedMaterial ImportMaterial(const aiMaterial& material,
+									  std::string name,
+									  const std::filesystem::path& path) {
+
+			CookedMaterial result;
+			result.m_name = std::move(name);
+
+			// Metallic-roughness materials (glTF) map one-to-one. The
+			// (Blinn-)Phong materials of the other formats are approximated.
+			aiColor4D base_color;
+			if (AI_SUCCESS == material.Get(
+				AI_MATKEY_GLTF_PBRMETALLICROUGHNESS_BASE_COLOR_FACTOR, base_color)) {
+
+				result.m_base_color = { base_color.r, base_color.g,
+										base_color.b, base_color.a };
+
+				F32 roughness = 1.0f;
+				material.Get(AI_MATKEY_GLTF_PBRMETALLICROUGHNESS_ROUGHNESS_FACTOR,
+							 roughness);
+				F32 metalness = 1.0f;
+				material.Get(AI_MATKEY_GLTF_PBRMETALLICROUGHNESS_METALLIC_FACTOR,
+							 metalness);
+				result.m_roughness = roughness;
+				result.m_metalness = metalness;
+
+				aiString alpha_mode;
+				if (AI_SUCCESS == material.Get(AI_MATKEY_GLTF_ALPHAMODE, alpha_mode)) {
+					result.m_transparent
+						= (std::string_view("BLEND") == alpha_mode.C_Str());
+				}
+			}
+			else {
+				aiColor3D diffuse(1.0f, 1.0f, 1.0f);
+				material.Get(AI_MATKEY_COLOR_DIFFUSE, diffuse);
+				F32 opacity = 1.0f;
+				material.Get(AI_MATKEY_OPACITY, opacity);
+				result.m_base_color = { diffuse.r, diffuse.g, diffuse.b, opacity };
+
+				// Maps the Blinn-Phong exponent to the GGX roughness.
+				if (F32 shininess = 0.0f;
+					AI_SUCCESS == material.Get(AI_MATKEY_SHININESS, shininess)
+					&& 0.0f < shininess) {
+
+					result.m_roughness = std::sqrt(2.0f / (shininess + 2.0f));
+				}
+
+				result.m_transparent = (opacity < 1.0f);
+			}
+
+			result.m_base_color_texture
+				= GetTexturePath(material, aiTextureType_DIFFUSE, path);
+			result.m_normal_texture
+				= GetTexturePath(material, aiTextureType_NORMALS, path);
+
+			return result;
+		}
+	}
+
+	[[nodiscard]]
+	bool IsAssimpModel(const std::filesystem::path& path) {
+		static const Assimp::Importer s_importer;
+
+		return path.has_extension()
+			&& s_importer.IsExtensionSupported(path.extension().u8string());
+	}
+
+	void ImportAssimpModel(const std::filesystem::path& path,
+						   CookedModelOutput& model_output,
+						   std::vector< CookedMaterial >& materials,
+						   std::vector< std::filesystem::path >& dependencies) {
+
+		using namespace rendering;
+
+		Assimp::Importer importer;
+		// The importer takes ownership of the IO system.
+		importer.SetIOHandler(new RecordingIOSystem(dependencies));
+		importer.SetPropertyInteger(AI_CONFIG_PP_SBP_REMOVE,
+									aiPrimitiveType_POINT | aiPrimitiveType_LINE);
+		importer.SetPropertyBool(AI_CONFIG_PP_FD_REMOVE, true);
+
+		const auto scene = importer.ReadFile(path.u8string(), g_assimp_flags);
+		ThrowIfFailed((nullptr != scene)
+					  && !(scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE),
+					  "{}: {}", path, importer.GetErrorString());
+
+		// Import the materials.
+		std::set< std::string > material_names;
+		const auto first_material = materials.size();
+		materials.reserve(materials.size() + scene->mNumMaterials);
+		for (unsigned int i = 0u; i < scene->mNumMaterials; ++i) {
+			const auto& material = *scene->mMaterials[i];
+
+			aiString name;
+			material.Get(AI_MATKEY_NAME, name);
+
+			materials.push_back(ImportMaterial(
+				material,
+				MakeUniqueName(name.C_Str(), "material", i, material_names),
+				path));
+		}
+
+		// Import the meshes.
+		std::set< std::string > part_names;
+		for (unsigned int i = 0u; i < scene->mNumMeshes; ++i) {
+			const auto& mesh = *scene->mMeshes[i];
+			if (!(mesh.mPrimitiveTypes & aiPrimitiveType_TRIANGLE)) {
+				continue;
+			}
+
+			const auto base_vertex = model_output.m_vertex_buffer.size();
+			ThrowIfFailed(base_vertex + mesh.mNumVertices
+						  <= std::numeric_limits< U32 >::max(),
+						  "{}: too many vertices.", path);
+
+			model_output.m_vertex_buffer.reserve(base_vertex + mesh.mNumVertices);
+			for (unsigned int j = 0u; j < mesh.mNumVertices; ++j) {
+				const auto& p = mesh.mVertices[j];
+				const auto  n = mesh.HasNormals()
+					          ? mesh.mNormals[j] : aiVector3D();
+				const auto  t = mesh.HasTextureCoords(0u)
+					          ? mesh.mTextureCoords[0u][j] : aiVector3D();
+
+				model_output.m_vertex_buffer.emplace_back(
+					Point3(p.x, p.y, p.z), Normal3(n.x, n.y, n.z), UV(t.x, t.y));
+			}
+
+			ModelPart model_part;
+			model_part.m_child = MakeUniqueName(mesh.mName.C_Str(), "part", i,
+												part_names);
+			if (mesh.mMaterialIndex < scene->mNumMaterials) {
+				model_part.m_material
+					= materials[first_material + mesh.mMaterialIndex].m_name;
+			}
+			model_part.m_start_index
+				= static_cast< U32 >(model_output.m_index_buffer.size());
+
+			model_output.m_index_buffer.reserve(
+				model_output.m_index_buffer.size() + 3u * mesh.mNumFaces);
+			for (unsigned int j = 0u; j < mesh.mNumFaces; ++j) {
+				const auto& face = mesh.mFaces[j];
+				if (3u != face.mNumIndices) {
+					continue;
+				}
+
+				for (unsigned int k = 0u; k < 3u; ++k) {
+					model_output.m_index_buffer.push_back(
+						static_cast< U32 >(base_vertex + face.mIndices[k]));
+				}
+			}
+
+			model_part.m_nb_indices = static_cast< U32 >(
+				model_output.m_index_buffer.size() - model_part.m_start_index);
+
+			model_output.AddModelPart(std::move(model_part));
+		}
+
+		ThrowIfFailed(!model_output.m_model_parts.empty(),
+					  "{}: no triangle meshes found.", path);
+	}
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "cooked_material.hpp"
+#include "resource/model/model_output.hpp"
+#include "resource/mesh/vertex.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::cooker {
+
+	/**
+	 The model output type of cooked models.
+	 */
+	using CookedModelOutput
+		= rendering::ModelOutput< rendering::VertexPositionNormalTexture, U32 >;
+
+	/**
+	 Checks whether the given file can be imported with Assimp.
+
+	 @param[in]		path
+					A reference to the path.
+	 @return		@c true if the file extension of the given path is
+					supported by Assimp. @c false otherwise.
+	 */
+	[[nodiscard]]
+	bool IsAssimpModel(const std::filesystem::path& path);
+
+	/**
+	 Imports the model from the given file with Assimp.
+
+	 The scene hierarchy is flattened: each (triangle) mesh becomes one
+	 model part with its vertices pre-transformed to world space and
+	 converted to a left-handed coordinate system with clockwise triangles.
+	 The model parts are not normalized nor optimized.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[out]	model_output
+					A reference to the model output.
+	 @param[out]	materials
+					A reference to a vector containing the materials.
+	 @param[out]	dependencies
+					A reference to a vector containing the paths of all files
+					read while importing (the given file first).
+	 @throws		Exception
+					Failed to import the model from the given file.
+	 */
+	void ImportAssimpModel(const std::filesystem::path& path,
+						   CookedModelOutput& model_output,
+						   std::vector< CookedMaterial >& materials,
+						   std::vector< std::filesystem::path >& dependencies);
+}
@@ -0,0 +1,189 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "cook_cache.hpp"
+#include "io/checksum.hpp"
+#include "io/line_reader.hpp"
+#include "io/mapped_file.hpp"
+#include "io/writer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cctype>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::cooker {
+
+	namespace {
+
+		/**
+		 Checks whether the given string can be stored as a single token of a
+		 cook cache file.
+
+		 @param[in]		str
+						The string.
+		 @return		@c true if the given string can be stored as a single
+						token. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsToken(std::string_view str) noexcept {
+			return !str.empty()
+				&& std::none_of(str.cbegin(), str.cend(), [](char c) noexcept {
+					   return 0 != std::isspace(static_cast< unsigned char >(c));
+				   });
+		}
+
+		/**
+		 A class of cook cache file readers.
+
+		 Each line of a cook cache file contains the name of a cooked model,
+		 its key and the paths of its dependencies.
+		 */
+		class CookCacheReader : private LineReader {
+
+		public:
+
+			explicit CookCacheReader(
+				std::map< std::string, CookCacheEntry >& entries)
+				: LineReader(),
+				m_entries(entries) {}
+
+			using LineReader::ReadFromFile;
+
+		private:
+
+			virtual void ReadLine() override {
+				auto name = Read< std::string >();
+
+				CookCacheEntry entry;
+				entry.m_key = Read< U64 >();
+				while (ContainsTokens()) {
+					entry.m_dependencies.push_back(
+						std::filesystem::u8path(Read< std::string_view >()));
+				}
+
+				m_entries.insert_or_assign(std::move(name), std::move(entry));
+			}
+
+			std::map< std::string, CookCacheEntry >& m_entries;
+		};
+
+		/**
+		 A class of cook cache file writers.
+		 */
+		class CookCacheWriter : private Writer {
+
+		public:
+
+			explicit CookCacheWriter(
+				const std::map< std::string, CookCacheEntry >& entries)
+				: Writer(),
+				m_entries(entries) {}
+
+			using Writer::WriteToFile;
+
+		private:
+
+			virtual void Write() override {
+				for (const auto& [name, entry] : m_entries) {
+					auto line = name + ' ' + std::to_string(entry.m_key);
+					for (const auto& dependency : entry.m_dependencies) {
+						line += ' ';
+						line += dependency.u8string();
+					}
+
+					WriteStringLine(NotNull< const_zstring >(line.c_str()));
+				}
+			}
+
+			const std::map< std::string, CookCacheEntry >& m_entries;
+		};
+	}
+
+	[[nodiscard]]
+	std::optional< U64 > ComputeCookKey(
+		const std::vector< std::filesystem::path >& dependencies, U64 seed) {
+
+		auto key = seed;
+		for (const auto& dependency : dependencies) {
+			if (!std::filesystem::is_regular_file(dependency)) {
+				return {};
+			}
+
+			// Empty files cannot be mapped.
+			if (0u == std::filesystem::file_size(dependency)) {
+				key = ComputeChecksum({}, key);
+				continue;
+			}
+
+			const MappedFile file(dependency);
+			key = ComputeChecksum(file.GetData(), key);
+		}
+
+		return key;
+	}
+
+	CookCache::CookCache(std::filesystem::path path)
+		: m_path(std::move(path)),
+		m_entries(),
+		m_mutex() {
+
+		if (std::filesystem::exists(m_path)) {
+			CookCacheReader reader(m_entries);
+			reader.ReadFromFile(m_path);
+		}
+	}
+
+	CookCache::~CookCache() = default;
+
+	[[nodiscard]]
+	std::optional< CookCacheEntry > CookCache
+		::Find(const std::string& name) const {
+
+		const std::lock_guard< std::mutex > lock(m_mutex);
+
+		if (const auto it = m_entries.find(name); m_entries.cend() != it) {
+			return it->second;
+		}
+
+		return {};
+	}
+
+	void CookCache::Update(std::string name, CookCacheEntry entry) {
+		// Entries which cannot be written as tokens are never cached.
+		const auto cacheable = IsToken(name)
+			&& std::all_of(entry.m_dependencies.cbegin(),
+						   entry.m_dependencies.cend(),
+						   [](const std::filesystem::path& dependency) {
+							   return IsToken(dependency.u8string());
+						   });
+
+		const std::lock_guard< std::mutex > lock(m_mutex);
+
+		if (cacheable) {
+			m_entries.insert_or_assign(std::move(name), std::move(entry));
+		}
+		else {
+			m_entries.erase(name);
+		}
+	}
+
+	void CookCache::Save() const {
+		const std::lock_guard< std::mutex > lock(m_mutex);
+
+		CookCacheWriter writer(m_entries);
+		writer.WriteToFile(m_path);
+	}
+}
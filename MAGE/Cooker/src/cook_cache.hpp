@@ -0,0 +1,195 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type/types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::cooker {
+
+	/**
+	 A struct of cook cache entries.
+	 */
+	struct CookCacheEntry {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The key of this cook cache entry (i.e. the checksum of the cooker
+		 settings and the bytes of all dependencies).
+		 */
+		U64 m_key = 0u;
+
+		/**
+		 The paths of the files read while cooking (the source file first).
+		 */
+		std::vector< std::filesystem::path > m_dependencies;
+	};
+
+	/**
+	 Computes the key of the given dependencies.
+
+	 @param[in]		dependencies
+					A reference to a vector containing the paths of the
+					dependencies.
+	 @param[in]		seed
+					The seed (i.e. the key of the cooker settings).
+	 @return		The key of the given dependencies.
+	 @return		@c std::nullopt if a dependency does not exist.
+	 @throws		Exception
+					Failed to map a dependency.
+	 */
+	[[nodiscard]]
+	std::optional< U64 > ComputeCookKey(
+		const std::vector< std::filesystem::path >& dependencies, U64 seed);
+
+	/**
+	 A class of cook caches.
+
+	 A cook cache maps the names of cooked models to the key of the inputs
+	 they were cooked from. All member methods are thread-safe.
+	 */
+	class CookCache {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a cook cache.
+
+		 @param[in]		path
+						The path of the cook cache file. The cook cache file
+						is read if it exists.
+		 @throws		Exception
+						Failed to read the cook cache file.
+		 */
+		explicit CookCache(std::filesystem::path path);
+
+		/**
+		 Constructs a cook cache from the given cook cache.
+
+		 @param[in]		cache
+						A reference to the cook cache to copy.
+		 */
+		CookCache(const CookCache& cache) = delete;
+
+		/**
+		 Constructs a cook cache by moving the given cook cache.
+
+		 @param[in]		cache
+						A reference to the cook cache to move.
+		 */
+		CookCache(CookCache&& cache) = delete;
+
+		/**
+		 Destructs this cook cache.
+		 */
+		~CookCache();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given cook cache to this cook cache.
+
+		 @param[in]		cache
+						A reference to the cook cache to copy.
+		 @return		A reference to the copy of the given cook cache (i.e.
+						this cook cache).
+		 */
+		CookCache& operator=(const CookCache& cache) = delete;
+
+		/**
+		 Moves the given cook cache to this cook cache.
+
+		 @param[in]		cache
+						A reference to the cook cache to move.
+		 @return		A reference to the moved cook cache (i.e. this cook
+						cache).
+		 */
+		CookCache& operator=(CookCache&& cache) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the entry of the given cooked model.
+
+		 @param[in]		name
+						The name of the cooked model.
+		 @return		The entry of the given cooked model.
+		 @return		@c std::nullopt if this cook cache contains no entry
+						for the given cooked model.
+		 */
+		[[nodiscard]]
+		std::optional< CookCacheEntry > Find(const std::string& name) const;
+
+		/**
+		 Sets the entry of the given cooked model.
+
+		 @param[in]		name
+						The name of the cooked model.
+		 @param[in]		entry
+						The entry.
+		 */
+		void Update(std::string name, CookCacheEntry entry);
+
+		/**
+		 Writes this cook cache to its cook cache file.
+
+		 @throws		Exception
+						Failed to write the cook cache file.
+		 */
+		void Save() const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The path of the cook cache file of this cook cache.
+		 */
+		std::filesystem::path m_path;
+
+		/**
+		 The entries of this cook cache.
+		 */
+		std::map< std::string, CookCacheEntry > m_entries;
+
+		/**
+		 The mutex for accessing the entries of this cook cache.
+		 */
+		mutable std::mutex m_mutex;
+	};
+}
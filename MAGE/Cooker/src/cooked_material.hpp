@@ -0,0 +1,74 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type/vector_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <string>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::cooker {
+
+	/**
+	 A struct of cooked materials (i.e. the content of a material in a MTL
+	 file). The defaults match the defaults of rendering::Material.
+	 */
+	struct CookedMaterial {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The name of this cooked material.
+		 */
+		std::string m_name;
+
+		/**
+		 The (sRGB) base color of this cooked material.
+		 */
+		F32x4 m_base_color = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+		/**
+		 The roughness of this cooked material.
+		 */
+		F32 m_roughness = 1.0f;
+
+		/**
+		 The metalness of this cooked material.
+		 */
+		F32 m_metalness = 0.0f;
+
+		/**
+		 The path of the base color texture of this cooked material.
+		 */
+		std::filesystem::path m_base_color_texture;
+
+		/**
+		 The path of the normal texture of this cooked material.
+		 */
+		std::filesystem::path m_normal_texture;
+
+		/**
+		 A flag indicating whether this cooked material is transparent.
+		 */
+		bool m_transparent = false;
+	};
+}
@@ -0,0 +1,345 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "cooker.hpp"
+#include "assimp_importer.hpp"
+#include "mtl_writer.hpp"
+#include "geometry/dynamic_aabb_tree.hpp"
+#include "io/checksum.hpp"
+#include "loaders/model_loader.hpp"
+#include "loaders/mdl/mdl_loader.hpp"
+#include "loaders/pvs/pvs_loader.hpp"
+#include "logging/logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::cooker {
+
+	namespace {
+
+		/**
+		 Cooks the model of the given file.
+
+		 @param[in]		path
+						A reference to the path of the model file.
+		 @param[in]		mdl_path
+						A reference to the path of the MDL file.
+		 @param[in]		settings
+						A reference to the cooker settings.
+		 @return		The paths of all files read while cooking (the given
+						model file first).
+		 @throws		Exception
+						Failed to cook the model of the given file.
+		 */
+		std::vector< std::filesystem::path >
+			Cook(const std::filesystem::path& path,
+				 const std::filesystem::path& mdl_path,
+				 const CookSettings& settings) {
+
+			CookedModelOutput model_output;
+			std::vector< CookedMaterial > materials;
+			std::vector< std::filesystem::path > dependencies;
+			ImportAssimpModel(path, model_output, materials, dependencies);
+
+			// Run the same mesh processing stages as the runtime (OBJ) model
+			// loading path.
+			model_output.NormalizeModelParts();
+			model_output.OptimizeModelParts(settings.m_optimize_overdraw);
+			model_output.GenerateLODs(settings.m_nb_lods);
+			model_output.ClusterModelParts(settings.m_cluster_size);
+			model_output.SeparateModelParts();
+
+			// Cook the triangle bounding volume hierarchies and occluder
+			// meshes, so that the runtime never builds them.
+			model_output.BuildModelPartBVHs();
+			model_output.BuildModelPartOccluders();
+
+			// The MTL file must exist before the MDL file is written.
+			auto mtl_path = mdl_path;
+			mtl_path.replace_extension(L".mtl");
+			MTLWriter writer(materials);
+			writer.WriteToFile(mtl_path);
+
+			rendering::loader::ExportModelToFile(mdl_path, model_output);
+
+			// The model file itself is always the first dependency.
+			const auto source = std::filesystem::absolute(path).lexically_normal();
+			dependencies.erase(std::remove(dependencies.begin(),
+										   dependencies.end(), source),
+							   dependencies.end());
+			dependencies.insert(dependencies.begin(), source);
+
+			return dependencies;
+		}
+
+		/**
+		 Computes the object-to-model transformation matrices of the given
+		 model parts.
+
+		 The model space is the object space of the root node created for
+		 the model parts (see @c Scene::Import): a single root model part is
+		 the root node itself, while multiple root model parts are children
+		 of an additional root node.
+
+		 @param[in]		model_parts
+						The model parts.
+		 @return		The object-to-model transformation matrices of the
+						given model parts.
+		 @throws		Exception
+						The parent of a model part does not exist.
+		 */
+		[[nodiscard]]
+		AlignedVector< XMMATRIX > ComputeObjectToModelMatrices(
+			gsl::span< const rendering::ModelPart > model_parts) {
+
+			const auto nb_model_parts = static_cast< std::size_t >(model_parts.size());
+			const auto nb_roots = std::count_if(model_parts.begin(),
+												model_parts.end(),
+				[](const rendering::ModelPart& model_part) noexcept {
+					return model_part.HasDefaultParent();
+				});
+
+			// Actual parent nodes must have a unique name.
+			std::map< std::string_view, std::size_t > mapping;
+			for (std::size_t i = 0u; i < nb_model_parts; ++i) {
+				mapping.emplace(model_parts[static_cast< std::ptrdiff_t >(i)].m_child, i);
+			}
+
+			AlignedVector< XMMATRIX > object_to_model;
+			object_to_model.reserve(nb_model_parts);
+			for (std::size_t i = 0u; i < nb_model_parts; ++i) {
+				auto matrix = XMMatrixIdentity();
+
+				// Concatenate the local transforms up to the root node.
+				auto index = i;
+				for (std::size_t depth = 0u; true; ++depth) {
+					ThrowIfFailed((depth < nb_model_parts),
+								  "Cyclic model part hierarchy.");
+
+					const auto& model_part
+						= model_parts[static_cast< std::ptrdiff_t >(index)];
+					if (model_part.HasDefaultParent() && 1 == nb_roots) {
+						break;
+					}
+
+					matrix = matrix * model_part.m_transform.GetObjectToParentMatrix();
+					if (model_part.HasDefaultParent()) {
+						break;
+					}
+
+					const auto it = mapping.find(model_part.m_parent);
+					ThrowIfFailed((mapping.end() != it),
+								  "No parent model part: {}.", model_part.m_parent);
+					index = it->second;
+				}
+
+				object_to_model.push_back(matrix);
+			}
+
+			return object_to_model;
+		}
+	}
+
+	[[nodiscard]]
+	U64 CookSettings::ComputeKey() const noexcept {
+		const U64 settings[] = {
+			g_cooker_version,
+			m_nb_lods,
+			m_cluster_size,
+			m_optimize_overdraw ? 1u : 0u
+		};
+
+		return ComputeChecksum(gsl::make_span(
+			reinterpret_cast< const U8* >(settings), sizeof(settings)));
+	}
+
+	CookResult CookModel(const std::filesystem::path& path,
+						 const CookSettings& settings,
+						 CookCache& cache) noexcept {
+
+		try {
+			const auto name     = rendering::loader::GetCookedModelName(path);
+			const auto mdl_path = settings.m_output_directory
+				                / std::filesystem::u8path(name + ".mdl");
+			auto msh_path = mdl_path;
+			msh_path.replace_extension(L".msh");
+
+			const auto base = std::filesystem::absolute(path).parent_path();
+			const auto seed = settings.ComputeKey();
+
+			// Skip the model if neither the cooker settings nor the bytes of
+			// any dependency changed since the last cook.
+			if (!settings.m_force
+				&& std::filesystem::is_regular_file(mdl_path)
+				&& std::filesystem::is_regular_file(msh_path)) {
+
+				if (auto entry = cache.Find(name)) {
+					for (auto& dependency : entry->m_dependencies) {
+						dependency = base / dependency;
+					}
+
+					if (ComputeCookKey(entry->m_dependencies, seed)
+						== entry->m_key) {
+						return CookResult::UpToDate;
+					}
+				}
+			}
+
+			auto dependencies = Cook(path, mdl_path, settings);
+
+			CookCacheEntry entry;
+			if (const auto key = ComputeCookKey(dependencies, seed)) {
+				entry.m_key = *key;
+
+				// The dependencies are stored relative to the model file.
+				for (auto& dependency : dependencies) {
+					dependency = dependency.lexically_relative(base);
+				}
+				entry.m_dependencies = std::move(dependencies);
+
+				cache.Update(name, std::move(entry));
+			}
+
+			Info("{}: cooked to {}.", path, mdl_path);
+			return CookResult::Cooked;
+		}
+		catch (const std::exception& e) {
+			Error("Failed to cook {}: {}", path, e.what());
+			return CookResult::Failed;
+		}
+	}
+
+	CookResult CookPVS(const std::filesystem::path& path,
+					   F32 cell_size,
+					   std::size_t nb_rays_per_cell) noexcept {
+
+		try {
+			CookedModelOutput model_output;
+			rendering::loader::ImportMDLModelFromFile(path, model_output);
+
+			// Build the triangle bounding volume hierarchies unless the model
+			// is cooked with them.
+			const auto has_bvhs = std::all_of(model_output.m_model_parts.begin(),
+											  model_output.m_model_parts.end(),
+				[](const rendering::ModelPart& model_part) noexcept {
+					return nullptr != model_part.m_bvh;
+				});
+			if (!has_bvhs) {
+				model_output.UnmapMesh();
+				model_output.BuildModelPartBVHs();
+			}
+
+			const auto model_parts
+				= gsl::make_span(std::as_const(model_output.m_model_parts));
+			const auto object_to_model = ComputeObjectToModelMatrices(model_parts);
+
+			// The model-space AABB of a model part is the overlap of the
+			// model-space AABBs of its AABB and its OBB (see
+			// World::UpdateModelTree).
+			AlignedVector< XMMATRIX > model_to_object;
+			model_to_object.reserve(object_to_model.size());
+			DynamicAABBTree tree;
+			AABB bounds;
+			for (std::size_t i = 0u; i < object_to_model.size(); ++i) {
+				const auto& model_part
+					= model_parts[static_cast< std::ptrdiff_t >(i)];
+				const auto matrix = object_to_model[i];
+				model_to_object.push_back(XMMatrixInverse(nullptr, matrix));
+
+				const auto aabb = AABB::Overlap(
+					AABB::Transform(model_part.m_aabb, matrix),
+					AABB(OBB::Transform(model_part.m_obb, matrix)));
+				if (!XMVector3LessOrEqual(aabb.MinPoint(), aabb.MaxPoint())) {
+					continue;
+				}
+
+				tree.Insert(aabb, static_cast< U32 >(i));
+				bounds = AABB::Union(bounds, aabb);
+			}
+			tree.Build();
+
+			const auto query = [&tree](const AABB& cell, const auto& mark) {
+				tree.Query(cell, [&mark](U32 index) {
+					mark(index);
+				});
+			};
+
+			// See Model::Intersect.
+			const auto intersect = [&tree, &model_parts, &model_to_object](
+				FXMVECTOR origin, FXMVECTOR direction, RayHit& hit) {
+
+				auto found = false;
+				tree.RayCast(origin, direction,
+							 std::numeric_limits< F32 >::infinity(),
+					[&](U32 index, F32 distance) {
+						const auto& model_part
+							= model_parts[static_cast< std::ptrdiff_t >(index)];
+
+						// Distances along the object-space ray (with an
+						// unnormalized direction) are equal to distances along
+						// the model-space ray.
+						const auto o = XMVector3TransformCoord(origin,
+															   model_to_object[index]);
+						const auto d = XMVector3TransformNormal(direction,
+																model_to_object[index]);
+
+						if (model_part.m_bvh && !model_part.m_bvh->empty()) {
+							if (!model_part.m_bvh->Intersect(o, d, distance, hit)) {
+								return distance;
+							}
+						}
+						else {
+							const auto [is_hit, t] = IntersectRay(
+								model_part.m_aabb, o, XMVectorReciprocal(d), distance);
+							if (!is_hit) {
+								return distance;
+							}
+
+							hit.m_distance = t;
+						}
+
+						hit.m_data = index;
+						found = true;
+						return hit.m_distance;
+					});
+
+				return found;
+			};
+
+			auto pvs = ComputePotentiallyVisibleSet(
+				bounds, cell_size, object_to_model.size(), nb_rays_per_cell,
+				query, intersect);
+			pvs.SetKey(rendering::loader::ComputePVSKey(model_parts));
+
+			auto pvs_path = path;
+			pvs_path.replace_extension(L".pvs");
+			rendering::loader::ExportPVSToFile(pvs_path, pvs);
+
+			Info("{}: computed the potentially visible set ({} cells) to {}.",
+				 path, pvs.GetNumberOfCells(), pvs_path);
+			return CookResult::Cooked;
+		}
+		catch (const std::exception& e) {
+			Error("Failed to compute the potentially visible set of {}: {}",
+				  path, e.what());
+			return CookResult::Failed;
+		}
+	}
+}
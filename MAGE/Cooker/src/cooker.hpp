@@ -0,0 +1,127 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "cook_cache.hpp"
+#include "loaders/model_loader.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::cooker {
+
+	/**
+	 The version of the cooker. Bumping the version invalidates all cook
+	 caches.
+	 */
+	constexpr U32 g_cooker_version = 2u;
+
+	/**
+	 A struct of cooker settings.
+	 */
+	struct CookSettings {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Computes the key of these cooker settings (including the version of
+		 the cooker).
+
+		 @return		The key of these cooker settings.
+		 */
+		[[nodiscard]]
+		U64 ComputeKey() const noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The output directory.
+		 */
+		std::filesystem::path m_output_directory
+			= rendering::loader::g_cooked_model_directory;
+
+		/**
+		 The number of levels of detail (including the full detail) per model
+		 part.
+		 */
+		std::size_t m_nb_lods = 4u;
+
+		/**
+		 The maximum number of triangles per mesh cluster.
+		 */
+		std::size_t m_cluster_size = rendering::g_cluster_max_nb_triangles;
+
+		/**
+		 A flag indicating whether the triangles need to be reordered to
+		 reduce overdraw.
+		 */
+		bool m_optimize_overdraw = true;
+
+		/**
+		 A flag indicating whether up-to-date models need to be cooked again.
+		 */
+		bool m_force = false;
+	};
+
+	/**
+	 An enumeration of cook results.
+
+	 This contains:
+	 @c Cooked,
+	 @c UpToDate and
+	 @c Failed.
+	 */
+	enum class [[nodiscard]] CookResult : U8 {
+		Cooked,
+		UpToDate,
+		Failed
+	};
+
+	/**
+	 Cooks the model of the given file to a MDL, MSH and MTL file in the
+	 output directory, unless the cook cache is up-to-date.
+
+	 @param[in]		path
+					A reference to the path of the model file.
+	 @param[in]		settings
+					A reference to the cooker settings.
+	 @param[in,out]	cache
+					A reference to the cook cache.
+	 @return		The cook result.
+	 */
+	CookResult CookModel(const std::filesystem::path& path,
+						 const CookSettings& settings,
+						 CookCache& cache) noexcept;
+
+	/**
+	 Computes the potentially visible set of the (static) model of the given
+	 MDL file to a PVS file next to the MDL file.
+
+	 The potentially visible set is computed in the object space of the root
+	 node created for the model (see @c Scene::Import) and is keyed by the
+	 model parts of the model (see @c loader::ComputePVSKey).
+
+	 @pre			@a cell_size is positive.
+	 @param[in]		path
+					A reference to the path of the MDL file.
+	 @param[in]		cell_size
+					The (maximum) size of each cell (in object space).
+	 @param[in]		nb_rays_per_cell
+					The number of rays to cast from each cell.
+	 @return		The cook result.
+	 */
+	CookResult CookPVS(const std::filesystem::path& path,
+					   F32 cell_size,
+					   std::size_t nb_rays_per_cell) noexcept;
+}
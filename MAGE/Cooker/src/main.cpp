@@ -0,0 +1,346 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "cooker.hpp"
+#include "assimp_importer.hpp"
+#include "io/archive.hpp"
+#include "logging/logging.hpp"
+#include "parallel/parallel.hpp"
+#include "string/string_utils.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <atomic>
+#include <set>
+#include <thread>
+
+#pragma endregion
+
+namespace {
+
+	using namespace mage;
+	using namespace mage::cooker;
+
+	constexpr const_zstring g_usage =
+		"Usage: Cooker [options] <file|directory>...\n"
+		"  --output <directory>  The output directory (default: assets/cooked).\n"
+		"  --lods <n>            The number of levels of detail (default: 4).\n"
+		"  --cluster-size <n>    The maximum number of triangles per mesh cluster.\n"
+		"  --jobs <n>            The number of models cooked in parallel.\n"
+		"  --no-overdraw         Do not reorder triangles to reduce overdraw.\n"
+		"  --force               Cook up-to-date models as well.\n"
+		"  --pack <archive>      Pack the output directory into an archive\n"
+		"                        (rooted at the working directory).\n"
+		"  --pvs <cell-size>     Compute the potentially visible sets of the given\n"
+		"                        MDL files instead (cell size in object space).\n"
+		"  --pvs-rays <n>        The number of rays per PVS cell (default: 1024).";
+
+	/**
+	 Collects the model files of the given path.
+
+	 @param[in]		path
+					A reference to the path of a model file or a directory
+					(searched recursively).
+	 @param[in]		settings
+					A reference to the cooker settings.
+	 @param[out]	inputs
+					A reference to a vector containing the model files.
+	 */
+	void CollectInputs(const std::filesystem::path& path,
+					   const CookSettings& settings,
+					   std::vector< std::filesystem::path >& inputs) {
+
+		const auto output_directory
+			= std::filesystem::absolute(settings.m_output_directory).lexically_normal();
+
+		const auto collect = [&](const std::filesystem::path& file) {
+			// MDL files are never cooked: the extension is shared by the
+			// engine's own (cooked) format and Quake models.
+			std::wstring extension = file.extension().wstring();
+			TransformToLowerCase(extension);
+			if (L".mdl" == extension || !IsAssimpModel(file)) {
+				return;
+			}
+
+			// Files in the output directory are never cooked.
+			const auto directory
+				= std::filesystem::absolute(file).parent_path().lexically_normal();
+			const auto [it, last] = std::mismatch(output_directory.begin(),
+												  output_directory.end(),
+												  directory.begin(),
+												  directory.end());
+			if (output_directory.end() == it) {
+				return;
+			}
+
+			inputs.push_back(file);
+		};
+
+		if (std::filesystem::is_directory(path)) {
+			for (const auto& entry
+				 : std::filesystem::recursive_directory_iterator(path)) {
+				if (entry.is_regular_file()) {
+					collect(entry.path());
+				}
+			}
+		}
+		else if (std::filesystem::is_regular_file(path)) {
+			collect(path);
+		}
+		else {
+			Error("No such file or directory: {}", path);
+		}
+	}
+
+	/**
+	 Parses the given count argument.
+
+	 @param[in]		arg
+					The argument.
+	 @return		The count.
+	 @return		@c std::nullopt if the given argument is not a positive
+					count.
+	 */
+	[[nodiscard]]
+	std::optional< std::size_t > ParseCount(const char* arg) {
+		if (nullptr == arg) {
+			return {};
+		}
+
+		const auto count = StringTo< std::size_t >(arg);
+		return (count && 0u != *count) ? count : std::nullopt;
+	}
+
+	/**
+	 Parses the given size argument.
+
+	 @param[in]		arg
+					The argument.
+	 @return		The size.
+	 @return		@c std::nullopt if the given argument is not a positive
+					size.
+	 */
+	[[nodiscard]]
+	std::optional< F32 > ParseSize(const char* arg) {
+		if (nullptr == arg) {
+			return {};
+		}
+
+		const auto size = StringTo< F32 >(arg);
+		return (size && 0.0f < *size) ? size : std::nullopt;
+	}
+
+	/**
+	 Packs the files of the output directory into the given archive.
+
+	 @param[in]		path
+					A reference to the path of the archive file.
+	 @param[in]		settings
+					A reference to the cooker settings.
+	 @throws		Exception
+					Failed to pack the archive.
+	 */
+	void Pack(const std::filesystem::path& path, const CookSettings& settings) {
+		const auto archive = std::filesystem::absolute(path).lexically_normal();
+
+		std::vector< std::filesystem::path > files;
+		for (const auto& entry : std::filesystem::recursive_directory_iterator(
+			 settings.m_output_directory)) {
+
+			if (!entry.is_regular_file()
+				|| L"cook_cache.txt" == entry.path().filename()
+				|| archive == std::filesystem::absolute(entry.path()).lexically_normal()) {
+				continue;
+			}
+
+			files.push_back(entry.path());
+		}
+
+		// The engine mounts archives at its working directory.
+		WriteArchive(path, std::filesystem::current_path(), files);
+
+		Info("{}: packed {} files.", path, files.size());
+	}
+}
+
+/**
+ The entry point of the cooker.
+
+ @param[in]		argc
+				The number of command line arguments.
+ @param[in]		argv
+				A pointer to the command line arguments.
+ @return		@c 0, if all models are cooked or up-to-date (or if all
+				potentially visible sets are computed).
+ @return		@c 1, otherwise.
+ */
+int main(int argc, char* argv[]) {
+	using namespace mage;
+	using namespace mage::cooker;
+
+	CookSettings settings;
+	std::size_t nb_jobs = NumberOfSystemCores();
+	std::filesystem::path pack_path;
+	std::optional< F32 > pvs_cell_size;
+	std::size_t nb_pvs_rays = 1024u;
+	std::vector< std::filesystem::path > paths;
+
+	for (int i = 1; i < argc; ++i) {
+		const std::string_view arg(argv[i]);
+		const auto next = (i + 1 < argc) ? argv[i + 1] : nullptr;
+
+		if ("--output" == arg && nullptr != next) {
+			settings.m_output_directory = next;
+			++i;
+		}
+		else if ("--lods" == arg && ParseCount(next)) {
+			settings.m_nb_lods = *ParseCount(next);
+			++i;
+		}
+		else if ("--cluster-size" == arg && ParseCount(next)) {
+			settings.m_cluster_size = *ParseCount(next);
+			++i;
+		}
+		else if ("--jobs" == arg && ParseCount(next)) {
+			nb_jobs = *ParseCount(next);
+			++i;
+		}
+		else if ("--no-overdraw" == arg) {
+			settings.m_optimize_overdraw = false;
+		}
+		else if ("--force" == arg) {
+			settings.m_force = true;
+		}
+		else if ("--pack" == arg && nullptr != next) {
+			pack_path = next;
+			++i;
+		}
+		else if ("--pvs" == arg && ParseSize(next)) {
+			pvs_cell_size = ParseSize(next);
+			++i;
+		}
+		else if ("--pvs-rays" == arg && ParseCount(next)) {
+			nb_pvs_rays = *ParseCount(next);
+			++i;
+		}
+		else if (!arg.empty() && '-' == arg.front()) {
+			Error("Invalid argument: {}\n{}", arg, g_usage);
+			return 1;
+		}
+		else {
+			paths.emplace_back(arg);
+		}
+	}
+
+	if (paths.empty()) {
+		Error("{}", g_usage);
+		return 1;
+	}
+
+	// The potentially visible sets are computed one model at a time, since
+	// the cells of each model are already distributed over the cores.
+	if (pvs_cell_size) {
+		std::size_t nb_failed = 0u;
+		for (const auto& path : paths) {
+			if (CookResult::Failed == CookPVS(path, *pvs_cell_size, nb_pvs_rays)) {
+				++nb_failed;
+			}
+		}
+
+		return (0u == nb_failed) ? 0 : 1;
+	}
+
+	std::vector< std::filesystem::path > inputs;
+	for (const auto& path : paths) {
+		CollectInputs(path, settings, inputs);
+	}
+
+	// Cooked models are named after their model file.
+	{
+		std::set< std::string > names;
+		const auto duplicate = [&names](const std::filesystem::path& input) {
+			if (names.insert(rendering::loader::GetCookedModelName(input)).second) {
+				return false;
+			}
+
+			Warning("{}: skipped (a model with the same name is cooked).",
+					input);
+			return true;
+		};
+		inputs.erase(std::remove_if(inputs.begin(), inputs.end(), duplicate),
+					 inputs.end());
+	}
+
+	// Cook the largest files first to balance the work over the worker
+	// threads.
+	std::stable_sort(inputs.begin(), inputs.end(),
+		[](const std::filesystem::path& lhs, const std::filesystem::path& rhs) {
+			return std::filesystem::file_size(lhs)
+				 > std::filesystem::file_size(rhs);
+		});
+
+	std::filesystem::create_directories(settings.m_output_directory);
+	CookCache cache(settings.m_output_directory / L"cook_cache.txt");
+
+	std::atomic< std::size_t > next_index(0u);
+	std::atomic< std::size_t > nb_cooked(0u);
+	std::atomic< std::size_t > nb_up_to_date(0u);
+	std::atomic< std::size_t > nb_failed(0u);
+
+	const auto cook = [&]() {
+		for (auto index = next_index++; index < inputs.size();
+			 index = next_index++) {
+
+			switch (CookModel(inputs[index], settings, cache)) {
+			case CookResult::Cooked:
+				++nb_cooked;
+				break;
+			case CookResult::UpToDate:
+				++nb_up_to_date;
+				break;
+			case CookResult::Failed:
+				++nb_failed;
+				break;
+			}
+		}
+	};
+
+	const auto nb_threads = std::min(nb_jobs, inputs.size());
+
+	std::vector< std::thread > workers;
+	workers.reserve(nb_threads);
+	for (std::size_t i = 1u; i < nb_threads; ++i) {
+		workers.emplace_back(cook);
+	}
+	// The calling thread participates as well.
+	cook();
+
+	for (auto& worker : workers) {
+		worker.join();
+	}
+
+	cache.Save();
+
+	Info("{} cooked, {} up-to-date, {} failed.",
+		 nb_cooked.load(), nb_up_to_date.load(), nb_failed.load());
+
+	if (!pack_path.empty()) {
+		try {
+			Pack(pack_path, settings);
+		}
+		catch (const std::exception& e) {
+			Error("Failed to pack {}: {}", pack_path, e.what());
+			return 1;
+		}
+	}
+
+	return (0u == nb_failed) ? 0 : 1;
+}
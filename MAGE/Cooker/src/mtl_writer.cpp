@@ -0,0 +1,97 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "mtl_writer.hpp"
+#include "loaders/mtl/mtl_tokens.hpp"
+#include "logging/logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cctype>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::cooker {
+
+	MTLWriter::MTLWriter(const std::vector< CookedMaterial >& materials)
+		: Writer(),
+		m_materials(materials) {}
+
+	MTLWriter::MTLWriter(MTLWriter&& writer) noexcept = default;
+
+	MTLWriter::~MTLWriter() = default;
+
+	void MTLWriter::Write() {
+		using namespace rendering::loader;
+
+		char buffer[2u * MAX_PATH];
+		const auto not_null_buffer = NotNull< const_zstring >(buffer);
+
+		for (const auto& material : m_materials) {
+			WriteTo(buffer, "{} {}",
+					g_mtl_token_material_declaration, material.m_name);
+			WriteStringLine(not_null_buffer);
+
+			WriteTo(buffer, "{} {} {} {} {}",
+					g_mtl_token_base_color,
+					material.m_base_color[0], material.m_base_color[1],
+					material.m_base_color[2], material.m_base_color[3]);
+			WriteStringLine(not_null_buffer);
+
+			WriteTo(buffer, "{} {}",
+					g_mtl_token_roughness, material.m_roughness);
+			WriteStringLine(not_null_buffer);
+
+			WriteTo(buffer, "{} {}",
+					g_mtl_token_metalness, material.m_metalness);
+			WriteStringLine(not_null_buffer);
+
+			WriteMTLTexture(g_mtl_token_base_color_texture,
+							material.m_base_color_texture);
+			WriteMTLTexture(g_mtl_token_normal_texture,
+							material.m_normal_texture);
+
+			WriteStringLine(NotNull< const_zstring >(material.m_transparent
+				                                     ? g_mtl_token_transparent
+				                                     : g_mtl_token_opaque));
+		}
+	}
+
+	void MTLWriter::WriteMTLTexture(const_zstring token,
+									const std::filesystem::path& path) {
+		if (path.empty()) {
+			return;
+		}
+
+		// Texture paths are relative to the MTL file.
+		auto texture_path = path.lexically_relative(GetPath().parent_path());
+		if (texture_path.empty()) {
+			texture_path = path;
+		}
+		const auto texture_name = texture_path.generic_u8string();
+
+		// MTL tokens cannot contain whitespace.
+		if (std::any_of(texture_name.cbegin(), texture_name.cend(),
+						[](char c) noexcept {
+							return 0 != std::isspace(static_cast< unsigned char >(c));
+						})) {
+			Warning("{}: unsupported texture path: {}.", GetPath(), path);
+			return;
+		}
+
+		char buffer[2u * MAX_PATH];
+		WriteTo(buffer, "{} {}", token, texture_name);
+		WriteStringLine(NotNull< const_zstring >(buffer));
+	}
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "cooked_material.hpp"
+#include "io/writer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::cooker {
+
+	/**
+	 A class of MTL file writers for writing cooked materials.
+	 */
+	class MTLWriter : private Writer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a MTL writer.
+
+		 @param[in]		materials
+						A reference to a vector containing the cooked
+						materials to write to file.
+		 */
+		explicit MTLWriter(const std::vector< CookedMaterial >& materials);
+
+		/**
+		 Constructs a MTL writer from the given MTL writer.
+
+		 @param[in]		writer
+						A reference to the MTL writer to copy.
+		 */
+		MTLWriter(const MTLWriter& writer) = delete;
+
+		/**
+		 Constructs a MTL writer by moving the given MTL writer.
+
+		 @param[in]		writer
+						A reference to the MTL writer to move.
+		 */
+		MTLWriter(MTLWriter&& writer) noexcept;
+
+		/**
+		 Destructs this MTL writer.
+		 */
+		~MTLWriter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given MTL writer to this MTL writer.
+
+		 @param[in]		writer
+						A reference to a MTL writer to copy.
+		 @return		A reference to the copy of the given MTL writer (i.e.
+						this MTL writer).
+		 */
+		MTLWriter& operator=(const MTLWriter& writer) = delete;
+
+		/**
+		 Moves the given MTL writer to this MTL writer.
+
+		 @param[in]		writer
+						A reference to a MTL writer to move.
+		 @return		A reference to the moved MTL writer (i.e. this MTL
+						writer).
+		 */
+		MTLWriter& operator=(MTLWriter&& writer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using Writer::WriteToFile;
+		using Writer::GetPath;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts writing.
+
+		 @throws		Exception
+						Failed to write.
+		 */
+		virtual void Write() override;
+
+		/**
+		 Writes the given texture path.
+
+		 @param[in]		token
+						The MTL token of the texture.
+		 @param[in]		path
+						A reference to the path of the texture. Nothing is
+						written for an empty path.
+		 @throws		Exception
+						Failed to write.
+		 */
+		void WriteMTLTexture(const_zstring token,
+							 const std::filesystem::path& path);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to a vector containing the cooked materials to write by
+		 this MTL writer.
+		 */
+		const std::vector< CookedMaterial >& m_materials;
+	};
+}
@@ -15,6 +15,7 @@ namespace mage {
 	void Transform::SetDirty() const noexcept {
 		m_dirty_object_to_world = true;
 		m_dirty_world_to_object = true;
+		m_version               = GetNextGuid();
 
 		if (HasOwner()) {
 			m_owner->ForEachChild([](const Node& node) noexcept {
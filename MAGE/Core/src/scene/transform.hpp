@@ -6,6 +6,7 @@
 #pragma region
 
 #include "transform\transform.hpp"
+#include "parallel\id_generator.hpp"
 
 #pragma endregion
 
@@ -42,6 +43,7 @@ namespace mage {
 			m_world_to_object(),
 			m_dirty_object_to_world(true),
 			m_dirty_world_to_object(true),
+			m_version(GetNextGuid()),
 			m_owner() {}
 
 		/**
@@ -56,6 +58,7 @@ namespace mage {
 			m_world_to_object(),
 			m_dirty_object_to_world(true),
 			m_dirty_world_to_object(true),
+			m_version(GetNextGuid()),
 			m_owner() {}
 
 		/**
@@ -1445,6 +1448,19 @@ namespace mage {
 		 */
 		void SetDirty() const noexcept;
 
+		/**
+		 Returns the version of this transform.
+
+		 The version changes whenever this transform or one of its ancestors
+		 is set to dirty. Two transforms never have the same version.
+
+		 @return		The version of this transform.
+		 */
+		[[nodiscard]]
+		U64 GetVersion() const noexcept {
+			return m_version;
+		}
+
 		#pragma endregion
 
 	private:
@@ -1518,6 +1534,11 @@ namespace mage {
 		 */
 		mutable bool m_dirty_world_to_object;
 
+		/**
+		 The version of this transform.
+		 */
+		mutable U64 m_version;
+
 		/**
 		 A pointer to the node owning this transform.
 		 */
@@ -48,7 +48,7 @@ namespace mage {
 		//---------------------------------------------------------------------
 		// Resources
 		//---------------------------------------------------------------------
-		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
+		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true, 4u);
 
 		const auto plane_model_desc
 			= rendering_factory.GetOrCreate< ModelDescriptor >(
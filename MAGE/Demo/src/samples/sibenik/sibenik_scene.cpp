@@ -14,6 +14,7 @@
 #pragma region
 
 #include "resource\texture\texture_factory.hpp"
+#include "loaders\pvs\pvs_loader.hpp"
 
 #include "character_motor_script.hpp"
 #include "mouse_look_script.hpp"
@@ -79,6 +80,51 @@ namespace mage {
 		sibenik_node->GetTransform().SetScale(30.0f);
 		sibenik_node->GetTransform().SetTranslationY(12.1f);
 
+		//---------------------------------------------------------------------
+		// Potentially Visible Set
+		//---------------------------------------------------------------------
+		// The potentially visible set covers the (static) models of the
+		// cathedral, which are the first models of the world. The models
+		// created afterwards are always potentially visible.
+		//
+		// The potentially visible set is precomputed by the Cooker in the
+		// object space of the root node of the cathedral:
+		//   Cooker --pvs 0.125 assets/models/sibenik/sibenik.mdl
+		{
+			const std::filesystem::path pvs_path
+				= L"assets/models/sibenik/sibenik.pvs";
+
+			SharedPtr< PotentiallyVisibleSet > pvs;
+			try {
+				auto imported = MakeShared< PotentiallyVisibleSet >();
+				loader::ImportPVSFromFile(pvs_path, *imported);
+
+				const auto key = loader::ComputePVSKey(
+					sibenik_model_desc->GetModelParts());
+				if (key == imported->GetKey()) {
+					pvs = std::move(imported);
+				}
+				else {
+					Warning("{}: stale potentially visible set.", pvs_path);
+				}
+			}
+			catch (const std::exception& e) {
+				Warning("{}", e.what());
+			}
+
+			if (pvs) {
+				const auto& transform = sibenik_node->GetTransform();
+				rendering_world.SetPotentiallyVisibleSet(
+					std::move(pvs), transform.GetWorldToObjectMatrix());
+			}
+			else {
+				// Recompute the potentially visible set in world space.
+				rendering_world.UpdateModelTree();
+				rendering_world.SetPotentiallyVisibleSet(
+					rendering_world.ComputePotentiallyVisibleSet(AABB(), 4.0f, 1024u));
+			}
+		}
+
 		const auto tree_node = Import(engine, *tree_model_desc_tree);
 		tree_node->GetTransform().SetScale(5.0f);
 		tree_node->GetTransform().AddTranslationY(2.5f);
@@ -0,0 +1,35 @@
+//-----------------------------------------------------------------------------
+// sal.h -- source annotation language shim for non-MSVC compilers
+//
+// DirectXMath annotates its interface with SAL. MSVC ships sal.h; GCC and
+// Clang do not, so the annotations used by DirectXMath are defined away.
+//-----------------------------------------------------------------------------
+#pragma once
+
+#ifndef _MSC_VER
+
+#define _In_
+#define _In_opt_
+#define _In_z_
+#define _In_reads_(size)
+#define _In_reads_opt_(size)
+#define _In_reads_bytes_(size)
+#define _In_reads_bytes_opt_(size)
+#define _Inout_
+#define _Inout_opt_
+#define _Inout_updates_(size)
+#define _Inout_updates_bytes_(size)
+#define _Out_
+#define _Out_opt_
+#define _Out_writes_(size)
+#define _Out_writes_opt_(size)
+#define _Out_writes_bytes_(size)
+#define _Out_writes_bytes_opt_(size)
+#define _Outptr_
+#define _Outptr_opt_
+#define _Ret_maybenull_
+#define _Success_(expr)
+#define _Analysis_assume_(expr)
+#define _Use_decl_annotations_
+
+#endif
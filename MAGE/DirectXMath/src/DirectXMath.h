@@ -0,0 +1,1177 @@
+//-----------------------------------------------------------------------------
+// DirectXMath.h -- portable subset of the DirectXMath API
+//
+// MAGE builds its asset pipeline (Utilities, Math, the loaders and the
+// Cooker) with GCC and Clang on Linux. This header provides the part of the
+// DirectXMath API those projects use, with the same names, signatures,
+// memory layouts and (row-vector) conventions as the Windows SDK header, so
+// the engine sources compile unchanged against either one.
+//
+// XMVECTOR is an SSE register. GCC and Clang provide the arithmetic
+// operators on it natively, so (as in DirectXMath itself when compiled with
+// GCC or Clang) no XMVECTOR operator overloads are declared.
+//
+// Only x86-64 (SSE2) targets are supported.
+//-----------------------------------------------------------------------------
+#pragma once
+
+#if !defined(__SSE2__) && !defined(_M_X64)
+#error "The portable DirectXMath subset requires an x86-64 (SSE2) target."
+#endif
+
+#include <sal.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <emmintrin.h>
+#include <xmmintrin.h>
+
+#define XM_CALLCONV
+#define XM_ALIGNED_STRUCT(x) struct alignas(x)
+
+namespace DirectX {
+
+	//-------------------------------------------------------------------------
+	// Constants
+	//-------------------------------------------------------------------------
+
+	constexpr float XM_PI       = 3.141592654f;
+	constexpr float XM_2PI      = 6.283185307f;
+	constexpr float XM_1DIVPI   = 0.318309886f;
+	constexpr float XM_1DIV2PI  = 0.159154943f;
+	constexpr float XM_PIDIV2   = 1.570796327f;
+	constexpr float XM_PIDIV4   = 0.785398163f;
+
+	constexpr uint32_t XM_SELECT_0 = 0x00000000u;
+	constexpr uint32_t XM_SELECT_1 = 0xFFFFFFFFu;
+
+	constexpr uint32_t XM_PERMUTE_0X = 0u;
+	constexpr uint32_t XM_PERMUTE_0Y = 1u;
+	constexpr uint32_t XM_PERMUTE_0Z = 2u;
+	constexpr uint32_t XM_PERMUTE_0W = 3u;
+	constexpr uint32_t XM_PERMUTE_1X = 4u;
+	constexpr uint32_t XM_PERMUTE_1Y = 5u;
+	constexpr uint32_t XM_PERMUTE_1Z = 6u;
+	constexpr uint32_t XM_PERMUTE_1W = 7u;
+
+	constexpr uint32_t XM_SWIZZLE_X = 0u;
+	constexpr uint32_t XM_SWIZZLE_Y = 1u;
+	constexpr uint32_t XM_SWIZZLE_Z = 2u;
+	constexpr uint32_t XM_SWIZZLE_W = 3u;
+
+	//-------------------------------------------------------------------------
+	// Vector and Matrix Types
+	//-------------------------------------------------------------------------
+
+	using XMVECTOR = __m128;
+
+	using FXMVECTOR = const XMVECTOR;
+	using GXMVECTOR = const XMVECTOR;
+	using HXMVECTOR = const XMVECTOR;
+	using CXMVECTOR = const XMVECTOR&;
+
+	XM_ALIGNED_STRUCT(16) XMVECTORF32 {
+		union {
+			float f[4];
+			XMVECTOR v;
+		};
+
+		operator XMVECTOR() const noexcept { return v; }
+		operator const float*() const noexcept { return f; }
+		operator __m128i() const noexcept { return _mm_castps_si128(v); }
+	};
+
+	XM_ALIGNED_STRUCT(16) XMVECTORI32 {
+		union {
+			int32_t i[4];
+			XMVECTOR v;
+		};
+
+		operator XMVECTOR() const noexcept { return v; }
+		operator __m128i() const noexcept { return _mm_castps_si128(v); }
+	};
+
+	XM_ALIGNED_STRUCT(16) XMVECTORU32 {
+		union {
+			uint32_t u[4];
+			XMVECTOR v;
+		};
+
+		operator XMVECTOR() const noexcept { return v; }
+		operator __m128i() const noexcept { return _mm_castps_si128(v); }
+	};
+
+	struct XMMATRIX;
+	using FXMMATRIX = const XMMATRIX&;
+	using CXMMATRIX = const XMMATRIX&;
+
+	XM_ALIGNED_STRUCT(16) XMMATRIX {
+		XMVECTOR r[4];
+
+		XMMATRIX() = default;
+
+		constexpr XMMATRIX(FXMVECTOR r0, FXMVECTOR r1,
+						   FXMVECTOR r2, CXMVECTOR r3) noexcept
+			: r{ r0, r1, r2, r3 } {}
+
+		XMMATRIX(float m00, float m01, float m02, float m03,
+				 float m10, float m11, float m12, float m13,
+				 float m20, float m21, float m22, float m23,
+				 float m30, float m31, float m32, float m33) noexcept
+			: r{ _mm_setr_ps(m00, m01, m02, m03),
+				 _mm_setr_ps(m10, m11, m12, m13),
+				 _mm_setr_ps(m20, m21, m22, m23),
+				 _mm_setr_ps(m30, m31, m32, m33) } {}
+
+		explicit XMMATRIX(_In_reads_(16) const float* pArray) noexcept
+			: r{ _mm_loadu_ps(pArray),      _mm_loadu_ps(pArray + 4u),
+				 _mm_loadu_ps(pArray + 8u), _mm_loadu_ps(pArray + 12u) } {}
+
+		XMMATRIX operator*(FXMMATRIX M) const noexcept;
+		XMMATRIX& operator*=(FXMMATRIX M) noexcept;
+	};
+
+	//-------------------------------------------------------------------------
+	// Storage Types
+	//-------------------------------------------------------------------------
+
+	struct XMFLOAT2 {
+		float x, y;
+
+		XMFLOAT2() = default;
+		constexpr XMFLOAT2(float _x, float _y) noexcept
+			: x(_x), y(_y) {}
+		explicit XMFLOAT2(_In_reads_(2) const float* pArray) noexcept
+			: x(pArray[0]), y(pArray[1]) {}
+	};
+
+	XM_ALIGNED_STRUCT(16) XMFLOAT2A : public XMFLOAT2 {
+		using XMFLOAT2::XMFLOAT2;
+		XMFLOAT2A() = default;
+	};
+
+	struct XMFLOAT3 {
+		float x, y, z;
+
+		XMFLOAT3() = default;
+		constexpr XMFLOAT3(float _x, float _y, float _z) noexcept
+			: x(_x), y(_y), z(_z) {}
+		explicit XMFLOAT3(_In_reads_(3) const float* pArray) noexcept
+			: x(pArray[0]), y(pArray[1]), z(pArray[2]) {}
+	};
+
+	XM_ALIGNED_STRUCT(16) XMFLOAT3A : public XMFLOAT3 {
+		using XMFLOAT3::XMFLOAT3;
+		XMFLOAT3A() = default;
+	};
+
+	struct XMFLOAT4 {
+		float x, y, z, w;
+
+		XMFLOAT4() = default;
+		constexpr XMFLOAT4(float _x, float _y, float _z, float _w) noexcept
+			: x(_x), y(_y), z(_z), w(_w) {}
+		explicit XMFLOAT4(_In_reads_(4) const float* pArray) noexcept
+			: x(pArray[0]), y(pArray[1]), z(pArray[2]), w(pArray[3]) {}
+	};
+
+	XM_ALIGNED_STRUCT(16) XMFLOAT4A : public XMFLOAT4 {
+		using XMFLOAT4::XMFLOAT4;
+		XMFLOAT4A() = default;
+	};
+
+	struct XMINT2 {
+		int32_t x, y;
+
+		XMINT2() = default;
+		constexpr XMINT2(int32_t _x, int32_t _y) noexcept
+			: x(_x), y(_y) {}
+	};
+
+	struct XMINT3 {
+		int32_t x, y, z;
+
+		XMINT3() = default;
+		constexpr XMINT3(int32_t _x, int32_t _y, int32_t _z) noexcept
+			: x(_x), y(_y), z(_z) {}
+	};
+
+	struct XMINT4 {
+		int32_t x, y, z, w;
+
+		XMINT4() = default;
+		constexpr XMINT4(int32_t _x, int32_t _y,
+						 int32_t _z, int32_t _w) noexcept
+			: x(_x), y(_y), z(_z), w(_w) {}
+	};
+
+	struct XMUINT2 {
+		uint32_t x, y;
+
+		XMUINT2() = default;
+		constexpr XMUINT2(uint32_t _x, uint32_t _y) noexcept
+			: x(_x), y(_y) {}
+	};
+
+	struct XMUINT3 {
+		uint32_t x, y, z;
+
+		XMUINT3() = default;
+		constexpr XMUINT3(uint32_t _x, uint32_t _y, uint32_t _z) noexcept
+			: x(_x), y(_y), z(_z) {}
+	};
+
+	struct XMUINT4 {
+		uint32_t x, y, z, w;
+
+		XMUINT4() = default;
+		constexpr XMUINT4(uint32_t _x, uint32_t _y,
+						  uint32_t _z, uint32_t _w) noexcept
+			: x(_x), y(_y), z(_z), w(_w) {}
+	};
+
+	//-------------------------------------------------------------------------
+	// Global Constants
+	//-------------------------------------------------------------------------
+
+	inline const XMVECTORF32 g_XMZero      = { { {  0.0f, 0.0f, 0.0f, 0.0f } } };
+	inline const XMVECTORF32 g_XMOne       = { { {  1.0f, 1.0f, 1.0f, 1.0f } } };
+	inline const XMVECTORF32 g_XMIdentityR0 = { { { 1.0f, 0.0f, 0.0f, 0.0f } } };
+	inline const XMVECTORF32 g_XMIdentityR1 = { { { 0.0f, 1.0f, 0.0f, 0.0f } } };
+	inline const XMVECTORF32 g_XMIdentityR2 = { { { 0.0f, 0.0f, 1.0f, 0.0f } } };
+	inline const XMVECTORF32 g_XMIdentityR3 = { { { 0.0f, 0.0f, 0.0f, 1.0f } } };
+	inline const XMVECTORI32 g_XMInfinity  = { { { 0x7F800000, 0x7F800000,
+												   0x7F800000, 0x7F800000 } } };
+	inline const XMVECTORU32 g_XMMaskX     = { { { 0xFFFFFFFFu, 0u, 0u, 0u } } };
+	inline const XMVECTORU32 g_XMMaskY     = { { { 0u, 0xFFFFFFFFu, 0u, 0u } } };
+	inline const XMVECTORU32 g_XMMaskZ     = { { { 0u, 0u, 0xFFFFFFFFu, 0u } } };
+	inline const XMVECTORU32 g_XMMaskW     = { { { 0u, 0u, 0u, 0xFFFFFFFFu } } };
+	inline const XMVECTORU32 g_XMMask3     = { { { 0xFFFFFFFFu, 0xFFFFFFFFu,
+												   0xFFFFFFFFu, 0u } } };
+	inline const XMVECTORU32 g_XMAbsMask   = { { { 0x7FFFFFFFu, 0x7FFFFFFFu,
+												   0x7FFFFFFFu, 0x7FFFFFFFu } } };
+
+	//-------------------------------------------------------------------------
+	// Vector Initialization and Access
+	//-------------------------------------------------------------------------
+
+	inline XMVECTOR XM_CALLCONV XMVectorZero() noexcept {
+		return _mm_setzero_ps();
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSet(float x, float y,
+											float z, float w) noexcept {
+		return _mm_setr_ps(x, y, z, w);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorReplicate(float value) noexcept {
+		return _mm_set1_ps(value);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSplatOne() noexcept {
+		return g_XMOne;
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSplatX(FXMVECTOR V) noexcept {
+		return _mm_shuffle_ps(V, V, _MM_SHUFFLE(0, 0, 0, 0));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSplatY(FXMVECTOR V) noexcept {
+		return _mm_shuffle_ps(V, V, _MM_SHUFFLE(1, 1, 1, 1));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSplatZ(FXMVECTOR V) noexcept {
+		return _mm_shuffle_ps(V, V, _MM_SHUFFLE(2, 2, 2, 2));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSplatW(FXMVECTOR V) noexcept {
+		return _mm_shuffle_ps(V, V, _MM_SHUFFLE(3, 3, 3, 3));
+	}
+
+	inline float XM_CALLCONV XMVectorGetByIndex(FXMVECTOR V,
+												size_t i) noexcept {
+		XMVECTORF32 U;
+		U.v = V;
+		return U.f[i];
+	}
+
+	inline float XM_CALLCONV XMVectorGetX(FXMVECTOR V) noexcept {
+		return _mm_cvtss_f32(V);
+	}
+
+	inline float XM_CALLCONV XMVectorGetY(FXMVECTOR V) noexcept {
+		return _mm_cvtss_f32(XMVectorSplatY(V));
+	}
+
+	inline float XM_CALLCONV XMVectorGetZ(FXMVECTOR V) noexcept {
+		return _mm_cvtss_f32(XMVectorSplatZ(V));
+	}
+
+	inline float XM_CALLCONV XMVectorGetW(FXMVECTOR V) noexcept {
+		return _mm_cvtss_f32(XMVectorSplatW(V));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSetByIndex(FXMVECTOR V, float f,
+												   size_t i) noexcept {
+		XMVECTORF32 U;
+		U.v = V;
+		U.f[i] = f;
+		return U.v;
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSetX(FXMVECTOR V, float x) noexcept {
+		return XMVectorSetByIndex(V, x, 0u);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSetY(FXMVECTOR V, float y) noexcept {
+		return XMVectorSetByIndex(V, y, 1u);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSetZ(FXMVECTOR V, float z) noexcept {
+		return XMVectorSetByIndex(V, z, 2u);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSetW(FXMVECTOR V, float w) noexcept {
+		return XMVectorSetByIndex(V, w, 3u);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorPermute(FXMVECTOR V1, FXMVECTOR V2,
+												uint32_t PermuteX,
+												uint32_t PermuteY,
+												uint32_t PermuteZ,
+												uint32_t PermuteW) noexcept {
+		alignas(16) float elements[8];
+		_mm_store_ps(elements,      V1);
+		_mm_store_ps(elements + 4u, V2);
+		return _mm_setr_ps(elements[PermuteX & 7u], elements[PermuteY & 7u],
+						   elements[PermuteZ & 7u], elements[PermuteW & 7u]);
+	}
+
+	template< uint32_t PermuteX, uint32_t PermuteY,
+			  uint32_t PermuteZ, uint32_t PermuteW >
+	inline XMVECTOR XM_CALLCONV XMVectorPermute(FXMVECTOR V1,
+												FXMVECTOR V2) noexcept {
+		static_assert(PermuteX <= 7u && PermuteY <= 7u
+					  && PermuteZ <= 7u && PermuteW <= 7u,
+					  "Permute index out of range");
+		return XMVectorPermute(V1, V2, PermuteX, PermuteY, PermuteZ, PermuteW);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSwizzle(FXMVECTOR V,
+												uint32_t E0, uint32_t E1,
+												uint32_t E2, uint32_t E3) noexcept {
+		return XMVectorPermute(V, V, E0 & 3u, E1 & 3u, E2 & 3u, E3 & 3u);
+	}
+
+	template< uint32_t SwizzleX, uint32_t SwizzleY,
+			  uint32_t SwizzleZ, uint32_t SwizzleW >
+	inline XMVECTOR XM_CALLCONV XMVectorSwizzle(FXMVECTOR V) noexcept {
+		static_assert(SwizzleX <= 3u && SwizzleY <= 3u
+					  && SwizzleZ <= 3u && SwizzleW <= 3u,
+					  "Swizzle index out of range");
+		return _mm_shuffle_ps(V, V, _MM_SHUFFLE(SwizzleW, SwizzleZ,
+												SwizzleY, SwizzleX));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSelectControl(uint32_t VectorIndex0,
+													  uint32_t VectorIndex1,
+													  uint32_t VectorIndex2,
+													  uint32_t VectorIndex3) noexcept {
+		const __m128i control = _mm_setr_epi32(
+			VectorIndex0 ? -1 : 0, VectorIndex1 ? -1 : 0,
+			VectorIndex2 ? -1 : 0, VectorIndex3 ? -1 : 0);
+		return _mm_castsi128_ps(control);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSelect(FXMVECTOR V1, FXMVECTOR V2,
+											   FXMVECTOR Control) noexcept {
+		return _mm_or_ps(_mm_andnot_ps(Control, V1), _mm_and_ps(Control, V2));
+	}
+
+	//-------------------------------------------------------------------------
+	// Vector Comparison
+	//-------------------------------------------------------------------------
+
+	inline XMVECTOR XM_CALLCONV XMVectorEqual(FXMVECTOR V1,
+											  FXMVECTOR V2) noexcept {
+		return _mm_cmpeq_ps(V1, V2);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorNotEqual(FXMVECTOR V1,
+												 FXMVECTOR V2) noexcept {
+		return _mm_cmpneq_ps(V1, V2);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorGreater(FXMVECTOR V1,
+												FXMVECTOR V2) noexcept {
+		return _mm_cmpgt_ps(V1, V2);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorGreaterOrEqual(FXMVECTOR V1,
+													   FXMVECTOR V2) noexcept {
+		return _mm_cmpge_ps(V1, V2);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorLess(FXMVECTOR V1,
+											 FXMVECTOR V2) noexcept {
+		return _mm_cmplt_ps(V1, V2);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorLessOrEqual(FXMVECTOR V1,
+													FXMVECTOR V2) noexcept {
+		return _mm_cmple_ps(V1, V2);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorAndInt(FXMVECTOR V1,
+											   FXMVECTOR V2) noexcept {
+		return _mm_and_ps(V1, V2);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorOrInt(FXMVECTOR V1,
+											  FXMVECTOR V2) noexcept {
+		return _mm_or_ps(V1, V2);
+	}
+
+	//-------------------------------------------------------------------------
+	// Vector Arithmetic
+	//-------------------------------------------------------------------------
+
+	inline XMVECTOR XM_CALLCONV XMVectorNegate(FXMVECTOR V) noexcept {
+		return _mm_sub_ps(_mm_setzero_ps(), V);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorAdd(FXMVECTOR V1,
+											FXMVECTOR V2) noexcept {
+		return _mm_add_ps(V1, V2);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSubtract(FXMVECTOR V1,
+												 FXMVECTOR V2) noexcept {
+		return _mm_sub_ps(V1, V2);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorMultiply(FXMVECTOR V1,
+												 FXMVECTOR V2) noexcept {
+		return _mm_mul_ps(V1, V2);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorMultiplyAdd(FXMVECTOR V1,
+													FXMVECTOR V2,
+													FXMVECTOR V3) noexcept {
+		return _mm_add_ps(_mm_mul_ps(V1, V2), V3);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorDivide(FXMVECTOR V1,
+											   FXMVECTOR V2) noexcept {
+		return _mm_div_ps(V1, V2);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorScale(FXMVECTOR V,
+											  float ScaleFactor) noexcept {
+		return _mm_mul_ps(V, _mm_set1_ps(ScaleFactor));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorReciprocal(FXMVECTOR V) noexcept {
+		return _mm_div_ps(g_XMOne, V);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSqrt(FXMVECTOR V) noexcept {
+		return _mm_sqrt_ps(V);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorAbs(FXMVECTOR V) noexcept {
+		return _mm_and_ps(V, g_XMAbsMask);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorMin(FXMVECTOR V1,
+											FXMVECTOR V2) noexcept {
+		return _mm_min_ps(V1, V2);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorMax(FXMVECTOR V1,
+											FXMVECTOR V2) noexcept {
+		return _mm_max_ps(V1, V2);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorClamp(FXMVECTOR V, FXMVECTOR Min,
+											  FXMVECTOR Max) noexcept {
+		return _mm_min_ps(_mm_max_ps(V, Min), Max);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorSaturate(FXMVECTOR V) noexcept {
+		return XMVectorClamp(V, g_XMZero, g_XMOne);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorLerp(FXMVECTOR V0, FXMVECTOR V1,
+											 float t) noexcept {
+		return XMVectorMultiplyAdd(_mm_sub_ps(V1, V0), _mm_set1_ps(t), V0);
+	}
+
+	namespace Internal {
+
+		template< typename FunctionT >
+		inline XMVECTOR XM_CALLCONV Map(FXMVECTOR V,
+										FunctionT function) noexcept {
+			alignas(16) float f[4];
+			_mm_store_ps(f, V);
+			return _mm_setr_ps(function(f[0]), function(f[1]),
+							   function(f[2]), function(f[3]));
+		}
+
+		template< typename FunctionT >
+		inline XMVECTOR XM_CALLCONV Map(FXMVECTOR V1, FXMVECTOR V2,
+										FunctionT function) noexcept {
+			alignas(16) float f1[4];
+			alignas(16) float f2[4];
+			_mm_store_ps(f1, V1);
+			_mm_store_ps(f2, V2);
+			return _mm_setr_ps(function(f1[0], f2[0]), function(f1[1], f2[1]),
+							   function(f1[2], f2[2]), function(f1[3], f2[3]));
+		}
+
+		inline int XM_CALLCONV Mask(FXMVECTOR V) noexcept {
+			return _mm_movemask_ps(V);
+		}
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorFloor(FXMVECTOR V) noexcept {
+		return Internal::Map(V, [](float f) noexcept { return std::floor(f); });
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorRound(FXMVECTOR V) noexcept {
+		return Internal::Map(V, [](float f) noexcept {
+			return std::nearbyint(f);
+		});
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorPow(FXMVECTOR V1,
+											FXMVECTOR V2) noexcept {
+		return Internal::Map(V1, V2, [](float f1, float f2) noexcept {
+			return std::pow(f1, f2);
+		});
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVectorModAngles(FXMVECTOR Angles) noexcept {
+		const auto turns = XMVectorRound(
+			_mm_mul_ps(Angles, _mm_set1_ps(XM_1DIV2PI)));
+		return _mm_sub_ps(Angles, _mm_mul_ps(turns, _mm_set1_ps(XM_2PI)));
+	}
+
+	inline void XM_CALLCONV XMVectorSinCos(_Out_ XMVECTOR* pSin,
+										   _Out_ XMVECTOR* pCos,
+										   _In_ FXMVECTOR V) noexcept {
+		*pSin = Internal::Map(V, [](float f) noexcept { return std::sin(f); });
+		*pCos = Internal::Map(V, [](float f) noexcept { return std::cos(f); });
+	}
+
+	inline XMVECTOR XM_CALLCONV XMConvertVectorIntToFloat(FXMVECTOR VInt,
+														  uint32_t DivExponent) noexcept {
+		const auto v = _mm_cvtepi32_ps(_mm_castps_si128(VInt));
+		const auto scale = 1.0f / static_cast< float >(1u << DivExponent);
+		return _mm_mul_ps(v, _mm_set1_ps(scale));
+	}
+
+	//-------------------------------------------------------------------------
+	// 3D and 4D Vector Operations
+	//-------------------------------------------------------------------------
+
+	inline bool XM_CALLCONV XMVector3Equal(FXMVECTOR V1,
+										   FXMVECTOR V2) noexcept {
+		return (Internal::Mask(_mm_cmpeq_ps(V1, V2)) & 7) == 7;
+	}
+
+	inline bool XM_CALLCONV XMVector3NotEqual(FXMVECTOR V1,
+											  FXMVECTOR V2) noexcept {
+		return (Internal::Mask(_mm_cmpeq_ps(V1, V2)) & 7) != 7;
+	}
+
+	inline bool XM_CALLCONV XMVector3Greater(FXMVECTOR V1,
+											 FXMVECTOR V2) noexcept {
+		return (Internal::Mask(_mm_cmpgt_ps(V1, V2)) & 7) == 7;
+	}
+
+	inline bool XM_CALLCONV XMVector3GreaterOrEqual(FXMVECTOR V1,
+													FXMVECTOR V2) noexcept {
+		return (Internal::Mask(_mm_cmpge_ps(V1, V2)) & 7) == 7;
+	}
+
+	inline bool XM_CALLCONV XMVector3Less(FXMVECTOR V1,
+										  FXMVECTOR V2) noexcept {
+		return (Internal::Mask(_mm_cmplt_ps(V1, V2)) & 7) == 7;
+	}
+
+	inline bool XM_CALLCONV XMVector3LessOrEqual(FXMVECTOR V1,
+												 FXMVECTOR V2) noexcept {
+		return (Internal::Mask(_mm_cmple_ps(V1, V2)) & 7) == 7;
+	}
+
+	inline bool XM_CALLCONV XMVector4Equal(FXMVECTOR V1,
+										   FXMVECTOR V2) noexcept {
+		return Internal::Mask(_mm_cmpeq_ps(V1, V2)) == 15;
+	}
+
+	inline bool XM_CALLCONV XMVector4NotEqual(FXMVECTOR V1,
+											  FXMVECTOR V2) noexcept {
+		return Internal::Mask(_mm_cmpneq_ps(V1, V2)) != 0;
+	}
+
+	inline bool XM_CALLCONV XMVector4Greater(FXMVECTOR V1,
+											 FXMVECTOR V2) noexcept {
+		return Internal::Mask(_mm_cmpgt_ps(V1, V2)) == 15;
+	}
+
+	inline bool XM_CALLCONV XMVector4GreaterOrEqual(FXMVECTOR V1,
+													FXMVECTOR V2) noexcept {
+		return Internal::Mask(_mm_cmpge_ps(V1, V2)) == 15;
+	}
+
+	inline bool XM_CALLCONV XMVector4Less(FXMVECTOR V1,
+										  FXMVECTOR V2) noexcept {
+		return Internal::Mask(_mm_cmplt_ps(V1, V2)) == 15;
+	}
+
+	inline bool XM_CALLCONV XMVector4LessOrEqual(FXMVECTOR V1,
+												 FXMVECTOR V2) noexcept {
+		return Internal::Mask(_mm_cmple_ps(V1, V2)) == 15;
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVector3Dot(FXMVECTOR V1,
+											 FXMVECTOR V2) noexcept {
+		const auto p = _mm_mul_ps(V1, V2);
+		const auto d = _mm_add_ss(_mm_add_ss(p, XMVectorSplatY(p)),
+								  XMVectorSplatZ(p));
+		return XMVectorSplatX(d);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVector4Dot(FXMVECTOR V1,
+											 FXMVECTOR V2) noexcept {
+		const auto p = _mm_mul_ps(V1, V2);
+		const auto s = _mm_add_ps(p, _mm_shuffle_ps(p, p,
+													_MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_add_ps(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVector3Cross(FXMVECTOR V1,
+											   FXMVECTOR V2) noexcept {
+		const auto a = _mm_mul_ps(XMVectorSwizzle< 1, 2, 0, 3 >(V1),
+								  XMVectorSwizzle< 2, 0, 1, 3 >(V2));
+		const auto b = _mm_mul_ps(XMVectorSwizzle< 2, 0, 1, 3 >(V1),
+								  XMVectorSwizzle< 1, 2, 0, 3 >(V2));
+		return _mm_and_ps(_mm_sub_ps(a, b), g_XMMask3);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVector3LengthSq(FXMVECTOR V) noexcept {
+		return XMVector3Dot(V, V);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVector3Length(FXMVECTOR V) noexcept {
+		return _mm_sqrt_ps(XMVector3Dot(V, V));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVector4LengthSq(FXMVECTOR V) noexcept {
+		return XMVector4Dot(V, V);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVector4Length(FXMVECTOR V) noexcept {
+		return _mm_sqrt_ps(XMVector4Dot(V, V));
+	}
+
+	namespace Internal {
+
+		// Divides V by the given (splatted) length; a zero length yields the
+		// zero vector.
+		inline XMVECTOR XM_CALLCONV DivideByLength(FXMVECTOR V,
+												   FXMVECTOR length) noexcept {
+			const auto result  = _mm_div_ps(V, length);
+			const auto nonzero = _mm_cmpneq_ps(length, _mm_setzero_ps());
+			return _mm_and_ps(result, nonzero);
+		}
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVector3Normalize(FXMVECTOR V) noexcept {
+		return Internal::DivideByLength(V, XMVector3Length(V));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVector4Normalize(FXMVECTOR V) noexcept {
+		return Internal::DivideByLength(V, XMVector4Length(V));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVector4Transform(FXMVECTOR V,
+												   FXMMATRIX M) noexcept {
+		auto result = _mm_mul_ps(XMVectorSplatX(V), M.r[0]);
+		result = XMVectorMultiplyAdd(XMVectorSplatY(V), M.r[1], result);
+		result = XMVectorMultiplyAdd(XMVectorSplatZ(V), M.r[2], result);
+		return   XMVectorMultiplyAdd(XMVectorSplatW(V), M.r[3], result);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVector3Transform(FXMVECTOR V,
+												   FXMMATRIX M) noexcept {
+		auto result = XMVectorMultiplyAdd(XMVectorSplatX(V), M.r[0], M.r[3]);
+		result = XMVectorMultiplyAdd(XMVectorSplatY(V), M.r[1], result);
+		return   XMVectorMultiplyAdd(XMVectorSplatZ(V), M.r[2], result);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVector3TransformCoord(FXMVECTOR V,
+														FXMMATRIX M) noexcept {
+		const auto result = XMVector3Transform(V, M);
+		return _mm_div_ps(result, XMVectorSplatW(result));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMVector3TransformNormal(FXMVECTOR V,
+														 FXMMATRIX M) noexcept {
+		auto result = _mm_mul_ps(XMVectorSplatX(V), M.r[0]);
+		result = XMVectorMultiplyAdd(XMVectorSplatY(V), M.r[1], result);
+		return   XMVectorMultiplyAdd(XMVectorSplatZ(V), M.r[2], result);
+	}
+
+	//-------------------------------------------------------------------------
+	// Plane Operations
+	//-------------------------------------------------------------------------
+
+	inline XMVECTOR XM_CALLCONV XMPlaneDotCoord(FXMVECTOR P,
+												FXMVECTOR V) noexcept {
+		const auto v = XMVectorSelect(g_XMOne, V, g_XMMask3);
+		return XMVector4Dot(P, v);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMPlaneNormalize(FXMVECTOR P) noexcept {
+		return Internal::DivideByLength(P, XMVector3Length(P));
+	}
+
+	//-------------------------------------------------------------------------
+	// Quaternion Operations
+	//-------------------------------------------------------------------------
+
+	inline XMVECTOR XM_CALLCONV XMQuaternionNormalize(FXMVECTOR Q) noexcept {
+		return XMVector4Normalize(Q);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMQuaternionConjugate(FXMVECTOR Q) noexcept {
+		return _mm_mul_ps(Q, _mm_setr_ps(-1.0f, -1.0f, -1.0f, 1.0f));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMQuaternionInverse(FXMVECTOR Q) noexcept {
+		const auto length_sq = XMVector4LengthSq(Q);
+		const auto result = _mm_div_ps(XMQuaternionConjugate(Q), length_sq);
+		const auto valid  = _mm_cmpgt_ps(length_sq, _mm_set1_ps(1.192092896e-7f));
+		return _mm_and_ps(result, valid);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMQuaternionRotationNormal(FXMVECTOR NormalAxis,
+														   float Angle) noexcept {
+		const auto s = std::sin(0.5f * Angle);
+		const auto c = std::cos(0.5f * Angle);
+		const auto n = XMVectorSelect(g_XMOne, NormalAxis, g_XMMask3);
+		return _mm_mul_ps(n, _mm_setr_ps(s, s, s, c));
+	}
+
+	inline XMVECTOR XM_CALLCONV
+		XMQuaternionRotationRollPitchYawFromVector(FXMVECTOR Angles) noexcept {
+
+		alignas(16) float a[4];
+		_mm_store_ps(a, _mm_mul_ps(Angles, _mm_set1_ps(0.5f)));
+
+		const auto sp = std::sin(a[0]), cp = std::cos(a[0]);
+		const auto sy = std::sin(a[1]), cy = std::cos(a[1]);
+		const auto sr = std::sin(a[2]), cr = std::cos(a[2]);
+
+		return _mm_setr_ps(sp * cy * cr + cp * sy * sr,
+						   cp * sy * cr - sp * cy * sr,
+						   cp * cy * sr - sp * sy * cr,
+						   cp * cy * cr + sp * sy * sr);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMQuaternionRotationRollPitchYaw(float Pitch,
+																 float Yaw,
+																 float Roll) noexcept {
+		return XMQuaternionRotationRollPitchYawFromVector(
+			XMVectorSet(Pitch, Yaw, Roll, 0.0f));
+	}
+
+	//-------------------------------------------------------------------------
+	// Matrix Operations
+	//-------------------------------------------------------------------------
+
+	inline XMMATRIX XM_CALLCONV XMMatrixIdentity() noexcept {
+		return { g_XMIdentityR0, g_XMIdentityR1,
+				 g_XMIdentityR2, g_XMIdentityR3 };
+	}
+
+	inline XMMATRIX XM_CALLCONV XMMatrixMultiply(FXMMATRIX M1,
+												 CXMMATRIX M2) noexcept {
+		return { XMVector4Transform(M1.r[0], M2),
+				 XMVector4Transform(M1.r[1], M2),
+				 XMVector4Transform(M1.r[2], M2),
+				 XMVector4Transform(M1.r[3], M2) };
+	}
+
+	inline XMMATRIX XMMATRIX::operator*(FXMMATRIX M) const noexcept {
+		return XMMatrixMultiply(*this, M);
+	}
+
+	inline XMMATRIX& XMMATRIX::operator*=(FXMMATRIX M) noexcept {
+		*this = XMMatrixMultiply(*this, M);
+		return *this;
+	}
+
+	inline XMMATRIX XM_CALLCONV XMMatrixTranspose(FXMMATRIX M) noexcept {
+		auto r0 = M.r[0], r1 = M.r[1], r2 = M.r[2], r3 = M.r[3];
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		return { r0, r1, r2, r3 };
+	}
+
+	inline XMMATRIX XM_CALLCONV XMMatrixInverse(_Out_opt_ XMVECTOR* pDeterminant,
+												_In_ FXMMATRIX M) noexcept {
+		alignas(16) float m[16];
+		_mm_store_ps(m,       M.r[0]);
+		_mm_store_ps(m + 4u,  M.r[1]);
+		_mm_store_ps(m + 8u,  M.r[2]);
+		_mm_store_ps(m + 12u, M.r[3]);
+
+		float inv[16];
+		inv[0]  =  m[5] * m[10] * m[15] - m[5] * m[11] * m[14] - m[9] * m[6] * m[15]
+				 + m[9] * m[7] * m[14] + m[13] * m[6] * m[11] - m[13] * m[7] * m[10];
+		inv[4]  = -m[4] * m[10] * m[15] + m[4] * m[11] * m[14] + m[8] * m[6] * m[15]
+				 - m[8] * m[7] * m[14] - m[12] * m[6] * m[11] + m[12] * m[7] * m[10];
+		inv[8]  =  m[4] * m[9]  * m[15] - m[4] * m[11] * m[13] - m[8] * m[5] * m[15]
+				 + m[8] * m[7] * m[13] + m[12] * m[5] * m[11] - m[12] * m[7] * m[9];
+		inv[12] = -m[4] * m[9]  * m[14] + m[4] * m[10] * m[13] + m[8] * m[5] * m[14]
+				 - m[8] * m[6] * m[13] - m[12] * m[5] * m[10] + m[12] * m[6] * m[9];
+		inv[1]  = -m[1] * m[10] * m[15] + m[1] * m[11] * m[14] + m[9] * m[2] * m[15]
+				 - m[9] * m[3] * m[14] - m[13] * m[2] * m[11] + m[13] * m[3] * m[10];
+		inv[5]  =  m[0] * m[10] * m[15] - m[0] * m[11] * m[14] - m[8] * m[2] * m[15]
+				 + m[8] * m[3] * m[14] + m[12] * m[2] * m[11] - m[12] * m[3] * m[10];
+		inv[9]  = -m[0] * m[9]  * m[15] + m[0] * m[11] * m[13] + m[8] * m[1] * m[15]
+				 - m[8] * m[3] * m[13] - m[12] * m[1] * m[11] + m[12] * m[3] * m[9];
+		inv[13] =  m[0] * m[9]  * m[14] - m[0] * m[10] * m[13] - m[8] * m[1] * m[14]
+				 + m[8] * m[2] * m[13] + m[12] * m[1] * m[10] - m[12] * m[2] * m[9];
+		inv[2]  =  m[1] * m[6]  * m[15] - m[1] * m[7]  * m[14] - m[5] * m[2] * m[15]
+				 + m[5] * m[3] * m[14] + m[13] * m[2] * m[7]  - m[13] * m[3] * m[6];
+		inv[6]  = -m[0] * m[6]  * m[15] + m[0] * m[7]  * m[14] + m[4] * m[2] * m[15]
+				 - m[4] * m[3] * m[14] - m[12] * m[2] * m[7]  + m[12] * m[3] * m[6];
+		inv[10] =  m[0] * m[5]  * m[15] - m[0] * m[7]  * m[13] - m[4] * m[1] * m[15]
+				 + m[4] * m[3] * m[13] + m[12] * m[1] * m[7]  - m[12] * m[3] * m[5];
+		inv[14] = -m[0] * m[5]  * m[14] + m[0] * m[6]  * m[13] + m[4] * m[1] * m[14]
+				 - m[4] * m[2] * m[13] - m[12] * m[1] * m[6]  + m[12] * m[2] * m[5];
+		inv[3]  = -m[1] * m[6]  * m[11] + m[1] * m[7]  * m[10] + m[5] * m[2] * m[11]
+				 - m[5] * m[3] * m[10] - m[9]  * m[2] * m[7]  + m[9]  * m[3] * m[6];
+		inv[7]  =  m[0] * m[6]  * m[11] - m[0] * m[7]  * m[10] - m[4] * m[2] * m[11]
+				 + m[4] * m[3] * m[10] + m[8]  * m[2] * m[7]  - m[8]  * m[3] * m[6];
+		inv[11] = -m[0] * m[5]  * m[11] + m[0] * m[7]  * m[9]  + m[4] * m[1] * m[11]
+				 - m[4] * m[3] * m[9]  - m[8]  * m[1] * m[7]  + m[8]  * m[3] * m[5];
+		inv[15] =  m[0] * m[5]  * m[10] - m[0] * m[6]  * m[9]  - m[4] * m[1] * m[10]
+				 + m[4] * m[2] * m[9]  + m[8]  * m[1] * m[6]  - m[8]  * m[2] * m[5];
+
+		const auto det = m[0] * inv[0] + m[1] * inv[4]
+					   + m[2] * inv[8] + m[3] * inv[12];
+		if (pDeterminant) {
+			*pDeterminant = _mm_set1_ps(det);
+		}
+
+		// As with DirectXMath, a singular matrix yields infinities/NaNs.
+		const auto rcp_det = _mm_set1_ps(1.0f / det);
+		return { _mm_mul_ps(_mm_loadu_ps(inv),       rcp_det),
+				 _mm_mul_ps(_mm_loadu_ps(inv + 4u),  rcp_det),
+				 _mm_mul_ps(_mm_loadu_ps(inv + 8u),  rcp_det),
+				 _mm_mul_ps(_mm_loadu_ps(inv + 12u), rcp_det) };
+	}
+
+	inline XMMATRIX XM_CALLCONV XMMatrixTranslation(float OffsetX,
+													float OffsetY,
+													float OffsetZ) noexcept {
+		return { g_XMIdentityR0, g_XMIdentityR1, g_XMIdentityR2,
+				 XMVectorSet(OffsetX, OffsetY, OffsetZ, 1.0f) };
+	}
+
+	inline XMMATRIX XM_CALLCONV XMMatrixTranslationFromVector(FXMVECTOR Offset) noexcept {
+		return { g_XMIdentityR0, g_XMIdentityR1, g_XMIdentityR2,
+				 XMVectorSelect(g_XMIdentityR3, Offset, g_XMMask3) };
+	}
+
+	inline XMMATRIX XM_CALLCONV XMMatrixScaling(float ScaleX,
+												float ScaleY,
+												float ScaleZ) noexcept {
+		return { XMVectorSet(ScaleX, 0.0f, 0.0f, 0.0f),
+				 XMVectorSet(0.0f, ScaleY, 0.0f, 0.0f),
+				 XMVectorSet(0.0f, 0.0f, ScaleZ, 0.0f),
+				 g_XMIdentityR3 };
+	}
+
+	inline XMMATRIX XM_CALLCONV XMMatrixScalingFromVector(FXMVECTOR Scale) noexcept {
+		return { _mm_and_ps(Scale, g_XMMaskX),
+				 _mm_and_ps(Scale, g_XMMaskY),
+				 _mm_and_ps(Scale, g_XMMaskZ),
+				 g_XMIdentityR3 };
+	}
+
+	inline XMMATRIX XM_CALLCONV XMMatrixRotationX(float Angle) noexcept {
+		const auto s = std::sin(Angle);
+		const auto c = std::cos(Angle);
+		return { g_XMIdentityR0,
+				 XMVectorSet(0.0f,    c,    s, 0.0f),
+				 XMVectorSet(0.0f,   -s,    c, 0.0f),
+				 g_XMIdentityR3 };
+	}
+
+	inline XMMATRIX XM_CALLCONV XMMatrixRotationY(float Angle) noexcept {
+		const auto s = std::sin(Angle);
+		const auto c = std::cos(Angle);
+		return { XMVectorSet(   c, 0.0f,   -s, 0.0f),
+				 g_XMIdentityR1,
+				 XMVectorSet(   s, 0.0f,    c, 0.0f),
+				 g_XMIdentityR3 };
+	}
+
+	inline XMMATRIX XM_CALLCONV XMMatrixRotationZ(float Angle) noexcept {
+		const auto s = std::sin(Angle);
+		const auto c = std::cos(Angle);
+		return { XMVectorSet(   c,    s, 0.0f, 0.0f),
+				 XMVectorSet(  -s,    c, 0.0f, 0.0f),
+				 g_XMIdentityR2,
+				 g_XMIdentityR3 };
+	}
+
+	inline XMMATRIX XM_CALLCONV XMMatrixRotationQuaternion(FXMVECTOR Quaternion) noexcept {
+		alignas(16) float q[4];
+		_mm_store_ps(q, Quaternion);
+		const auto x = q[0], y = q[1], z = q[2], w = q[3];
+
+		return { XMVectorSet(1.0f - 2.0f * (y * y + z * z),
+							 2.0f * (x * y + z * w),
+							 2.0f * (x * z - y * w), 0.0f),
+				 XMVectorSet(2.0f * (x * y - z * w),
+							 1.0f - 2.0f * (x * x + z * z),
+							 2.0f * (y * z + x * w), 0.0f),
+				 XMVectorSet(2.0f * (x * z + y * w),
+							 2.0f * (y * z - x * w),
+							 1.0f - 2.0f * (x * x + y * y), 0.0f),
+				 g_XMIdentityR3 };
+	}
+
+	inline XMMATRIX XM_CALLCONV XMMatrixRotationNormal(FXMVECTOR NormalAxis,
+													   float Angle) noexcept {
+		return XMMatrixRotationQuaternion(
+			XMQuaternionRotationNormal(NormalAxis, Angle));
+	}
+
+	inline XMMATRIX XM_CALLCONV
+		XMMatrixRotationRollPitchYawFromVector(FXMVECTOR Angles) noexcept {
+
+		return XMMatrixRotationQuaternion(
+			XMQuaternionRotationRollPitchYawFromVector(Angles));
+	}
+
+	inline XMMATRIX XM_CALLCONV XMMatrixRotationRollPitchYaw(float Pitch,
+															 float Yaw,
+															 float Roll) noexcept {
+		return XMMatrixRotationRollPitchYawFromVector(
+			XMVectorSet(Pitch, Yaw, Roll, 0.0f));
+	}
+
+	inline XMMATRIX XM_CALLCONV XMMatrixAffineTransformation2D(FXMVECTOR Scaling,
+															   FXMVECTOR RotationOrigin,
+															   float Rotation,
+															   GXMVECTOR Translation) noexcept {
+		const auto select_xy = XMVectorSelectControl(1u, 1u, 0u, 0u);
+		const auto scaling   = XMVectorSelect(g_XMOne,  Scaling,        select_xy);
+		const auto origin    = XMVectorSelect(g_XMZero, RotationOrigin, select_xy);
+		const auto offset    = XMVectorSelect(g_XMZero, Translation,    select_xy);
+
+		auto M = XMMatrixScalingFromVector(scaling);
+		M.r[3] = _mm_sub_ps(M.r[3], origin);
+		M = XMMatrixMultiply(M, XMMatrixRotationZ(Rotation));
+		M.r[3] = _mm_add_ps(_mm_add_ps(M.r[3], origin), offset);
+		return M;
+	}
+
+	//-------------------------------------------------------------------------
+	// Load Operations
+	//-------------------------------------------------------------------------
+
+	inline XMVECTOR XM_CALLCONV XMLoadInt(_In_ const uint32_t* pSource) noexcept {
+		return _mm_castsi128_ps(_mm_cvtsi32_si128(static_cast< int >(*pSource)));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMLoadInt4(_In_reads_(4) const uint32_t* pSource) noexcept {
+		return _mm_castsi128_ps(
+			_mm_loadu_si128(reinterpret_cast< const __m128i* >(pSource)));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMLoadFloat(_In_ const float* pSource) noexcept {
+		return _mm_load_ss(pSource);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMLoadFloat2(_In_ const XMFLOAT2* pSource) noexcept {
+		return _mm_setr_ps(pSource->x, pSource->y, 0.0f, 0.0f);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMLoadFloat2A(_In_ const XMFLOAT2A* pSource) noexcept {
+		return XMLoadFloat2(pSource);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMLoadFloat3(_In_ const XMFLOAT3* pSource) noexcept {
+		return _mm_setr_ps(pSource->x, pSource->y, pSource->z, 0.0f);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMLoadFloat3A(_In_ const XMFLOAT3A* pSource) noexcept {
+		return _mm_and_ps(_mm_load_ps(&pSource->x), g_XMMask3);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMLoadFloat4(_In_ const XMFLOAT4* pSource) noexcept {
+		return _mm_loadu_ps(&pSource->x);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMLoadFloat4A(_In_ const XMFLOAT4A* pSource) noexcept {
+		return _mm_load_ps(&pSource->x);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMLoadSInt2(_In_ const XMINT2* pSource) noexcept {
+		return _mm_cvtepi32_ps(_mm_setr_epi32(pSource->x, pSource->y, 0, 0));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMLoadSInt3(_In_ const XMINT3* pSource) noexcept {
+		return _mm_cvtepi32_ps(
+			_mm_setr_epi32(pSource->x, pSource->y, pSource->z, 0));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMLoadSInt4(_In_ const XMINT4* pSource) noexcept {
+		return _mm_cvtepi32_ps(
+			_mm_loadu_si128(reinterpret_cast< const __m128i* >(pSource)));
+	}
+
+	inline XMVECTOR XM_CALLCONV XMLoadUInt2(_In_ const XMUINT2* pSource) noexcept {
+		return _mm_setr_ps(static_cast< float >(pSource->x),
+						   static_cast< float >(pSource->y), 0.0f, 0.0f);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMLoadUInt3(_In_ const XMUINT3* pSource) noexcept {
+		return _mm_setr_ps(static_cast< float >(pSource->x),
+						   static_cast< float >(pSource->y),
+						   static_cast< float >(pSource->z), 0.0f);
+	}
+
+	inline XMVECTOR XM_CALLCONV XMLoadUInt4(_In_ const XMUINT4* pSource) noexcept {
+		return _mm_setr_ps(static_cast< float >(pSource->x),
+						   static_cast< float >(pSource->y),
+						   static_cast< float >(pSource->z),
+						   static_cast< float >(pSource->w));
+	}
+
+	//-------------------------------------------------------------------------
+	// Store Operations
+	//-------------------------------------------------------------------------
+
+	inline void XM_CALLCONV XMStoreInt(_Out_ uint32_t* pDestination,
+									   _In_ FXMVECTOR V) noexcept {
+		*pDestination = static_cast< uint32_t >(
+			_mm_cvtsi128_si32(_mm_castps_si128(V)));
+	}
+
+	inline void XM_CALLCONV XMStoreInt4(_Out_writes_(4) uint32_t* pDestination,
+										_In_ FXMVECTOR V) noexcept {
+		_mm_storeu_si128(reinterpret_cast< __m128i* >(pDestination),
+						 _mm_castps_si128(V));
+	}
+
+	inline void XM_CALLCONV XMStoreFloat(_Out_ float* pDestination,
+										 _In_ FXMVECTOR V) noexcept {
+		_mm_store_ss(pDestination, V);
+	}
+
+	inline void XM_CALLCONV XMStoreFloat2(_Out_ XMFLOAT2* pDestination,
+										  _In_ FXMVECTOR V) noexcept {
+		pDestination->x = XMVectorGetX(V);
+		pDestination->y = XMVectorGetY(V);
+	}
+
+	inline void XM_CALLCONV XMStoreFloat2A(_Out_ XMFLOAT2A* pDestination,
+										   _In_ FXMVECTOR V) noexcept {
+		XMStoreFloat2(pDestination, V);
+	}
+
+	inline void XM_CALLCONV XMStoreFloat3(_Out_ XMFLOAT3* pDestination,
+										  _In_ FXMVECTOR V) noexcept {
+		pDestination->x = XMVectorGetX(V);
+		pDestination->y = XMVectorGetY(V);
+		pDestination->z = XMVectorGetZ(V);
+	}
+
+	inline void XM_CALLCONV XMStoreFloat3A(_Out_ XMFLOAT3A* pDestination,
+										   _In_ FXMVECTOR V) noexcept {
+		XMStoreFloat3(pDestination, V);
+	}
+
+	inline void XM_CALLCONV XMStoreFloat4(_Out_ XMFLOAT4* pDestination,
+										  _In_ FXMVECTOR V) noexcept {
+		_mm_storeu_ps(&pDestination->x, V);
+	}
+
+	inline void XM_CALLCONV XMStoreFloat4A(_Out_ XMFLOAT4A* pDestination,
+										   _In_ FXMVECTOR V) noexcept {
+		_mm_store_ps(&pDestination->x, V);
+	}
+
+	namespace Internal {
+
+		// Converts with truncation, saturating at the range of the target
+		// type (NaN maps to zero), like the DirectXMath SSE paths.
+		template< typename T >
+		inline T Saturate(float f) noexcept {
+			if (!(f == f)) {
+				return T(0);
+			}
+
+			constexpr auto min_value = static_cast< float >(std::numeric_limits< T >::lowest());
+			constexpr auto max_value = static_cast< float >(std::numeric_limits< T >::max());
+			if (f <= min_value) {
+				return std::numeric_limits< T >::lowest();
+			}
+			if (f >= max_value) {
+				return std::numeric_limits< T >::max();
+			}
+			return static_cast< T >(f);
+		}
+
+		template< typename T, size_t N >
+		inline void XM_CALLCONV Store(T* pDestination, FXMVECTOR V) noexcept {
+			alignas(16) float f[4];
+			_mm_store_ps(f, V);
+			for (size_t i = 0u; i < N; ++i) {
+				pDestination[i] = Saturate< T >(f[i]);
+			}
+		}
+	}
+
+	inline void XM_CALLCONV XMStoreSInt2(_Out_ XMINT2* pDestination,
+										 _In_ FXMVECTOR V) noexcept {
+		Internal::Store< int32_t, 2u >(&pDestination->x, V);
+	}
+
+	inline void XM_CALLCONV XMStoreSInt3(_Out_ XMINT3* pDestination,
+										 _In_ FXMVECTOR V) noexcept {
+		Internal::Store< int32_t, 3u >(&pDestination->x, V);
+	}
+
+	inline void XM_CALLCONV XMStoreSInt4(_Out_ XMINT4* pDestination,
+										 _In_ FXMVECTOR V) noexcept {
+		Internal::Store< int32_t, 4u >(&pDestination->x, V);
+	}
+
+	inline void XM_CALLCONV XMStoreUInt2(_Out_ XMUINT2* pDestination,
+										 _In_ FXMVECTOR V) noexcept {
+		Internal::Store< uint32_t, 2u >(&pDestination->x, V);
+	}
+
+	inline void XM_CALLCONV XMStoreUInt3(_Out_ XMUINT3* pDestination,
+										 _In_ FXMVECTOR V) noexcept {
+		Internal::Store< uint32_t, 3u >(&pDestination->x, V);
+	}
+
+	inline void XM_CALLCONV XMStoreUInt4(_Out_ XMUINT4* pDestination,
+										 _In_ FXMVECTOR V) noexcept {
+		Internal::Store< uint32_t, 4u >(&pDestination->x, V);
+	}
+}
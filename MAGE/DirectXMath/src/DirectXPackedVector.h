@@ -0,0 +1,80 @@
+//-----------------------------------------------------------------------------
+// DirectXPackedVector.h -- portable subset of the DirectXMath API
+//
+// See DirectXMath.h. Only the half-precision conversions used by the vertex
+// packing are provided.
+//-----------------------------------------------------------------------------
+#pragma once
+
+#include "DirectXMath.h"
+
+namespace DirectX::PackedVector {
+
+	using HALF = uint16_t;
+
+	inline float XMConvertHalfToFloat(HALF Value) noexcept {
+		auto mantissa = static_cast< uint32_t >(Value & 0x03FFu);
+		uint32_t exponent = Value & 0x7C00u;
+
+		if (0x7C00u == exponent) {
+			// Infinity or NaN.
+			exponent = 0x8Fu;
+		}
+		else if (0u != exponent) {
+			// Normalized value.
+			exponent = static_cast< uint32_t >((Value >> 10u) & 0x1Fu);
+		}
+		else if (0u != mantissa) {
+			// Denormalized value: normalize it in the result.
+			exponent = 1u;
+			do {
+				--exponent;
+				mantissa <<= 1u;
+			} while (0u == (mantissa & 0x0400u));
+			mantissa &= 0x03FFu;
+		}
+		else {
+			// Zero.
+			exponent = static_cast< uint32_t >(-112);
+		}
+
+		const uint32_t result = ((Value & 0x8000u) << 16u)
+			                  | ((exponent + 112u) << 23u)
+			                  | (mantissa << 13u);
+
+		float f;
+		std::memcpy(&f, &result, sizeof(f));
+		return f;
+	}
+
+	inline HALF XMConvertFloatToHalf(float Value) noexcept {
+		uint32_t bits;
+		std::memcpy(&bits, &Value, sizeof(bits));
+
+		const uint32_t sign = (bits & 0x80000000u) >> 16u;
+		bits &= 0x7FFFFFFFu;
+
+		uint32_t result;
+		if (bits > 0x7F800000u) {
+			// NaN.
+			result = 0x7FFFu;
+		}
+		else if (bits >= 0x477FF000u) {
+			// Too large to represent (or infinity).
+			result = 0x7C00u;
+		}
+		else if (bits < 0x38800000u) {
+			// Too small to be a normalized half: denormalize it.
+			const uint32_t shift = 113u - (bits >> 23u);
+			bits = (shift < 24u) ? (0x800000u | (bits & 0x7FFFFFu)) >> shift : 0u;
+			result = (bits + 0x0FFFu + ((bits >> 13u) & 1u)) >> 13u;
+		}
+		else {
+			// Rebias the exponent and round to nearest even.
+			bits += 0xC8000000u;
+			result = (bits + 0x0FFFu + ((bits >> 13u) & 1u)) >> 13u;
+		}
+
+		return static_cast< HALF >((result & 0x7FFFu) | sign);
+	}
+}
@@ -6,6 +6,7 @@
 #include "display\display_configurator.hpp"
 #include "exception\exception.hpp"
 #include "imgui_window_message_listener.hpp"
+#include "io\archive.hpp"
 #include "logging\dump.hpp"
 #include "meta\targetver.hpp"
 #include "meta\version.hpp"
@@ -148,6 +149,9 @@ namespace mage {
 	void Engine::InitializeSystems(const EngineSetup& setup,
 								   rendering::DisplayConfiguration display_config) {
 
+		// Mount the asset archives of the working directory.
+		MountArchives(std::filesystem::current_path());
+
 		// Initialize the window.
 		{
 			auto window_desc
@@ -215,6 +219,8 @@ namespace mage {
 		m_input_manager.reset();
 		// Uninitialize the window system.
 		m_window.reset();
+		// Unmount the asset archives.
+		UnmountArchives();
 	}
 
 	void Engine::RequestScene(UniquePtr< Scene >&& scene) noexcept {
@@ -4,7 +4,18 @@
 #pragma region
 
 #include "scene\scene.hpp"
+#include "loaders\manifest_loader.hpp"
 #include "resource\model\material_factory.hpp"
+#include "string\string_utils.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
 
 #pragma endregion
 
@@ -29,6 +40,29 @@ namespace mage {
 	//-------------------------------------------------------------------------
 
 	void Scene::Initialize(Engine& engine) {
+		auto& resource_manager
+			= engine.GetRenderingManager().GetResourceManager();
+
+		const auto manifest_path = std::filesystem::path(L"assets/manifests")
+			/ (UTF8toUTF16(m_name).str() + L".rsm");
+
+		// Imports the resource manifest of a previous run of this scene.
+		rendering::ResourceManifest manifest;
+		if (std::filesystem::exists(manifest_path)) {
+			rendering::loader::ImportManifestFromFile(manifest_path, manifest);
+		}
+
+		// Prefetches the file resources of this scene in parallel. The
+		// prefetched resources are kept alive until this scene and its
+		// behavior scripts are loaded.
+		const auto prefetched_resources = resource_manager.Prefetch(manifest);
+
+		// (Re-)records the resource manifest if missing or stale.
+		const auto record = manifest.empty() || !manifest.IsUpToDate();
+		if (record) {
+			resource_manager.StartRecording();
+		}
+
 		// Loads this scene.
 		Load(engine);
 
@@ -36,6 +70,15 @@ namespace mage {
 		ForEach< BehaviorScript >([&engine](BehaviorScript& script) {
 			script.Load(engine);
 		});
+
+		if (record) {
+			const auto recorded_manifest = resource_manager.StopRecording();
+			if (!recorded_manifest.empty()) {
+				std::filesystem::create_directories(manifest_path.parent_path());
+				rendering::loader::ExportManifestToFile(manifest_path,
+														recorded_manifest);
+			}
+		}
 	}
 
 	void Scene::Uninitialize(Engine& engine) {
@@ -103,7 +146,14 @@ namespace mage {
 						   model_part.m_start_index,
 						   model_part.m_nb_indices,
 						   model_part.m_aabb,
-						   model_part.m_sphere);
+						   model_part.m_sphere,
+						   model_part.m_obb,
+						   model_part.m_base_vertex,
+						   model_part.m_quantization,
+						   model_part.m_lods,
+						   model_part.m_clusters,
+						   model_part.m_bvh,
+						   model_part.m_occluder);
 
 			// Set the material of the model component.
 			const auto material = desc.GetMaterial(model_part.m_material);
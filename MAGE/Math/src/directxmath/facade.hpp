@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -14,7 +14,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include <directxmath.h>
+#include <DirectXMath.h>
 namespace mage {
 	using namespace DirectX;
 }
@@ -144,12 +144,16 @@ namespace mage {
 		return XMLoadUInt4(reinterpret_cast< const XMUINT4* >(&src));
 	}
 
+	#ifdef _WIN32
+
 	[[nodiscard]]
 	inline const XMVECTOR XM_CALLCONV XMLoad(const RECT& src) noexcept {
 		const auto v = XMLoadInt4(reinterpret_cast< const U32* >(&src));
 		return XMConvertVectorIntToFloat(v, 0);
 	}
 
+	#endif // _WIN32
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -3,7 +3,17 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "geometry\bounding_volume.hpp"
+#include "geometry/bounding_volume.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+#include <utility>
 
 #pragma endregion
 
@@ -12,10 +22,304 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	namespace {
+
+		/**
+		 Computes the minimum and maximum coordinates of the given points
+		 along the given axes.
+
+		 @param[in]		points
+						A reference to the points.
+		 @param[in]		axes
+						The (orthonormal) axes (one axis per row).
+		 @return		A pair containing the minimum and maximum coordinates
+						of @a points along @a axes.
+		 */
+		[[nodiscard]]
+		const std::pair< XMVECTOR, XMVECTOR > XM_CALLCONV
+			ComputeExtents(gsl::span< const Point3 > points,
+						   FXMMATRIX axes) noexcept {
+
+			const auto world_to_local = XMMatrixTranspose(axes);
+
+			auto p_min = XMVECTOR(g_XMInfinity);
+			auto p_max = -p_min;
+			for (const auto& point : points) {
+				const auto p = XMVector3TransformNormal(XMLoad(point),
+														world_to_local);
+				p_min = XMVectorMin(p_min, p);
+				p_max = XMVectorMax(p_max, p);
+			}
+
+			return { p_min, p_max };
+		}
+
+		/**
+		 Computes the (half) surface area of the box of the given points
+		 along the given axes.
+
+		 @param[in]		points
+						A reference to the points.
+		 @param[in]		axes
+						The (orthonormal) axes (one axis per row).
+		 @return		The (half) surface area of the box of @a points along
+						@a axes.
+		 */
+		[[nodiscard]]
+		F32 XM_CALLCONV ComputeSurfaceArea(gsl::span< const Point3 > points,
+										   FXMMATRIX axes) noexcept {
+
+			const auto [p_min, p_max] = ComputeExtents(points, axes);
+			const auto d = p_max - p_min;
+			const auto x = XMVectorGetX(d);
+			const auto y = XMVectorGetY(d);
+			const auto z = XMVectorGetZ(d);
+			return x * y + y * z + z * x;
+		}
+
+		/**
+		 Computes the principal axes of the given points (i.e. the
+		 eigenvectors of their covariance matrix).
+
+		 @pre			@a points is not empty.
+		 @param[in]		points
+						A reference to the points.
+		 @return		The (orthonormal, right-handed) principal axes of
+						@a points (one axis per row).
+		 */
+		[[nodiscard]]
+		const XMMATRIX ComputePrincipalAxes(
+			gsl::span< const Point3 > points) noexcept {
+
+			// Compute the covariance matrix.
+			F64 mean[3] = {};
+			for (const auto& point : points) {
+				for (std::size_t i = 0u; i < 3u; ++i) {
+					mean[i] += point[i];
+				}
+			}
+			const auto inv_n = 1.0 / static_cast< F64 >(points.size());
+			for (std::size_t i = 0u; i < 3u; ++i) {
+				mean[i] *= inv_n;
+			}
+
+			F64 c[3][3] = {};
+			for (const auto& point : points) {
+				const F64 d[3] = {
+					point[0] - mean[0], point[1] - mean[1], point[2] - mean[2]
+				};
+				for (std::size_t i = 0u; i < 3u; ++i) {
+					for (std::size_t j = i; j < 3u; ++j) {
+						c[i][j] += d[i] * d[j];
+					}
+				}
+			}
+			c[1][0] = c[0][1];
+			c[2][0] = c[0][2];
+			c[2][1] = c[1][2];
+
+			// Diagonalize the covariance matrix with cyclic Jacobi rotations.
+			F64 v[3][3] = { { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 } };
+			for (std::size_t sweep = 0u; sweep < 32u; ++sweep) {
+				const auto off = std::abs(c[0][1]) + std::abs(c[0][2])
+							   + std::abs(c[1][2]);
+				const auto diag = std::abs(c[0][0]) + std::abs(c[1][1])
+								+ std::abs(c[2][2]);
+				if (off <= 1e-12 * diag) {
+					break;
+				}
+
+				for (std::size_t p = 0u; p < 2u; ++p) {
+					for (std::size_t q = p + 1u; q < 3u; ++q) {
+						if (0.0 == c[p][q]) {
+							continue;
+						}
+
+						const auto theta = 0.5 * (c[q][q] - c[p][p]) / c[p][q];
+						const auto t = std::copysign(1.0, theta)
+									 / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+						const auto cs = 1.0 / std::sqrt(t * t + 1.0);
+						const auto sn = t * cs;
+
+						for (std::size_t k = 0u; k < 3u; ++k) {
+							const auto ckp = c[k][p];
+							const auto ckq = c[k][q];
+							c[k][p] = cs * ckp - sn * ckq;
+							c[k][q] = sn * ckp + cs * ckq;
+						}
+						for (std::size_t k = 0u; k < 3u; ++k) {
+							const auto cpk = c[p][k];
+							const auto cqk = c[q][k];
+							c[p][k] = cs * cpk - sn * cqk;
+							c[q][k] = sn * cpk + cs * cqk;
+						}
+						for (std::size_t k = 0u; k < 3u; ++k) {
+							const auto vkp = v[k][p];
+							const auto vkq = v[k][q];
+							v[k][p] = cs * vkp - sn * vkq;
+							v[k][q] = sn * vkp + cs * vkq;
+						}
+					}
+				}
+			}
+
+			// The eigenvectors are the columns of v.
+			const auto axis_x = XMVector3Normalize(XMVectorSet(
+				static_cast< F32 >(v[0][0]), static_cast< F32 >(v[1][0]),
+				static_cast< F32 >(v[2][0]), 0.0f));
+			const auto axis_y = XMVector3Normalize(XMVectorSet(
+				static_cast< F32 >(v[0][1]), static_cast< F32 >(v[1][1]),
+				static_cast< F32 >(v[2][1]), 0.0f));
+			const auto axis_z = XMVector3Normalize(XMVector3Cross(axis_x, axis_y));
+			return XMMATRIX(axis_x, XMVector3Cross(axis_z, axis_x), axis_z,
+							XMVectorZero());
+		}
+
+		/**
+		 Computes the signed distances of the centroid of the given OBB to the
+		 given four planes, and the radii of the given OBB along the normals
+		 of the given four planes.
+
+		 @param[in]		planes
+						The four (normalized) planes as structure of arrays
+						(i.e. one row per plane coefficient).
+		 @param[in]		obb
+						A reference to the OBB.
+		 @return		A pair containing the signed distances and the radii
+						(one plane per lane).
+		 */
+		[[nodiscard]]
+		inline const std::pair< XMVECTOR, XMVECTOR > XM_CALLCONV
+			ComputeDistancesAndRadii(FXMMATRIX planes,
+									 const OBB& obb) noexcept {
+
+			const auto dot = [&planes](FXMVECTOR v) noexcept {
+				auto result = planes.r[0] * XMVectorSplatX(v);
+				result = XMVectorMultiplyAdd(planes.r[1], XMVectorSplatY(v), result);
+				result = XMVectorMultiplyAdd(planes.r[2], XMVectorSplatZ(v), result);
+				return result;
+			};
+
+			const auto distances = dot(obb.Centroid()) + planes.r[3];
+			const auto radii     = XMVectorAbs(dot(obb.Axis(0)))
+								 + XMVectorAbs(dot(obb.Axis(1)))
+								 + XMVectorAbs(dot(obb.Axis(2)));
+			return { distances, radii };
+		}
+
+		/**
+		 The number of times a bounding sphere is shrunk and regrown.
+		 */
+		constexpr std::size_t g_sphere_nb_refinements = 4u;
+
+		/**
+		 The factor by which the radius of a bounding sphere is shrunk before
+		 it is regrown.
+		 */
+		constexpr F32 g_sphere_shrink_factor = 0.95f;
+
+		/**
+		 Grows the given bounding sphere to enclose the given points (Ritter).
+
+		 Each point outside the bounding sphere moves the bounding sphere
+		 towards that point just enough to enclose both the point and the
+		 original bounding sphere.
+
+		 @param[in]		points
+						A reference to the points.
+		 @param[in]		first
+						The index of the first point to visit.
+		 @param[in,out]	centroid
+						A reference to the centroid of the bounding sphere.
+		 @param[in,out]	radius
+						A reference to the radius of the bounding sphere.
+		 */
+		void GrowSphere(gsl::span< const Point3 > points,
+						std::size_t first,
+						XMVECTOR& centroid,
+						F32& radius) noexcept {
+
+			const auto nb_points = static_cast< std::size_t >(points.size());
+			auto radius_sq = radius * radius;
+			for (std::size_t i = 0u; i < nb_points; ++i) {
+				auto j = first + i;
+				j = (nb_points <= j) ? j - nb_points : j;
+
+				const auto d = XMLoad(points[static_cast< std::ptrdiff_t >(j)])
+					         - centroid;
+				const auto distance_sq = XMVectorGetX(XMVector3LengthSq(d));
+				if (distance_sq <= radius_sq) {
+					continue;
+				}
+
+				const auto distance   = std::sqrt(distance_sq);
+				const auto new_radius = 0.5f * (radius + distance);
+				centroid  += d * ((new_radius - radius) / distance);
+				radius     = new_radius;
+				radius_sq  = radius * radius;
+			}
+		}
+	}
+
 	//-------------------------------------------------------------------------
 	// Axis-Aligned Bounding Box
 	//-------------------------------------------------------------------------
 
+	[[nodiscard]]
+	const AABB AABB::Fit(gsl::span< const Point3 > points) noexcept {
+		static_assert(3u * sizeof(F32) == sizeof(Point3));
+
+		const auto nb_points = static_cast< std::size_t >(points.size());
+		const auto data      = reinterpret_cast< const F32* >(points.data());
+
+		auto p_min = XMVECTOR(g_XMInfinity);
+		auto p_max = -p_min;
+
+		// Four consecutive points span three vectors (xyzx, yzxy, zxyz) whose
+		// lanes always contain the same coordinates.
+		const auto nb_groups = nb_points / 4u;
+		if (0u != nb_groups) {
+			auto min0 = p_min, min1 = p_min, min2 = p_min;
+			auto max0 = p_max, max1 = p_max, max2 = p_max;
+
+			for (std::size_t i = 0u; i < nb_groups; ++i) {
+				const auto v  = data + 12u * i;
+				const auto v0 = XMLoadFloat4(reinterpret_cast< const XMFLOAT4* >(v));
+				const auto v1 = XMLoadFloat4(reinterpret_cast< const XMFLOAT4* >(v + 4u));
+				const auto v2 = XMLoadFloat4(reinterpret_cast< const XMFLOAT4* >(v + 8u));
+				min0 = XMVectorMin(min0, v0);
+				min1 = XMVectorMin(min1, v1);
+				min2 = XMVectorMin(min2, v2);
+				max0 = XMVectorMax(max0, v0);
+				max1 = XMVectorMax(max1, v1);
+				max2 = XMVectorMax(max2, v2);
+			}
+
+			// Gather the coordinates of the four points (in the xyz lanes).
+			const auto reduce = [](FXMVECTOR v0, FXMVECTOR v1, FXMVECTOR v2,
+								   auto op) noexcept {
+				auto result = op(v0, XMVectorPermute< 3, 4, 5, 7 >(v0, v1));
+				result = op(result, XMVectorPermute< 2, 3, 4, 7 >(v1, v2));
+				return op(result, XMVectorSwizzle< 1, 2, 3, 3 >(v2));
+			};
+
+			p_min = reduce(min0, min1, min2, [](FXMVECTOR a, FXMVECTOR b) noexcept {
+				return XMVectorMin(a, b);
+			});
+			p_max = reduce(max0, max1, max2, [](FXMVECTOR a, FXMVECTOR b) noexcept {
+				return XMVectorMax(a, b);
+			});
+		}
+
+		for (auto i = 4u * nb_groups; i < nb_points; ++i) {
+			const auto p = XMLoad(points[static_cast< std::ptrdiff_t >(i)]);
+			p_min = XMVectorMin(p_min, p);
+			p_max = XMVectorMax(p_max, p);
+		}
+
+		return AABB(p_min, p_max);
+	}
+
 	AABB::AABB(const BoundingSphere& sphere) noexcept {
 		const auto centroid   = sphere.Centroid();
 		const auto r          = sphere.Radius();
@@ -24,6 +328,15 @@ namespace mage {
 		m_max = centroid + radius;
 	}
 
+	AABB::AABB(const OBB& obb) noexcept {
+		const auto centroid = obb.Centroid();
+		const auto radius   = XMVectorAbs(obb.Axis(0))
+							+ XMVectorAbs(obb.Axis(1))
+							+ XMVectorAbs(obb.Axis(2));
+		m_min = centroid - radius;
+		m_max = centroid + radius;
+	}
+
 	//-------------------------------------------------------------------------
 	// Axis-Aligned Bounding Box: Enclosing = Full Coverage
 	//-------------------------------------------------------------------------
@@ -34,10 +347,10 @@ namespace mage {
 		const auto r          = sphere.Radius();
 		const XMVECTOR radius = { r, r, r, 0.0f };
 
-		if (XMVector3Less(m_max - centroid, radius)) {
+		if (!XMVector3GreaterOrEqual(m_max - centroid, radius)) {
 			return false;
 		}
-		if (XMVector3Less(centroid - m_min, radius)) {
+		if (!XMVector3GreaterOrEqual(centroid - m_min, radius)) {
 			return false;
 		}
 
@@ -50,10 +363,10 @@ namespace mage {
 		const auto r          = sphere.Radius();
 		const XMVECTOR radius = { r, r, r, 0.0f };
 
-		if (XMVector3LessOrEqual(m_max - centroid, radius)) {
+		if (!XMVector3Greater(m_max - centroid, radius)) {
 			return false;
 		}
-		if (XMVector3LessOrEqual(centroid - m_min, radius)) {
+		if (!XMVector3Greater(centroid - m_min, radius)) {
 			return false;
 		}
 
@@ -71,10 +384,10 @@ namespace mage {
 		const XMVECTOR radius = { r, r, r, 0.0f };
 
 		// Test for no coverage.
-		if (XMVector3Less(m_max - centroid, radius)) {
+		if (!XMVector3GreaterOrEqual(m_max - centroid, radius)) {
 			return false;
 		}
-		if (XMVector3Less(centroid - m_min, radius)) {
+		if (!XMVector3GreaterOrEqual(centroid - m_min, radius)) {
 			return false;
 		}
 
@@ -88,16 +401,91 @@ namespace mage {
 		const XMVECTOR radius = { r, r, r, 0.0f };
 
 		// Test for no coverage.
-		if (XMVector3LessOrEqual(m_max - centroid, radius)) {
+		if (!XMVector3Greater(m_max - centroid, radius)) {
 			return false;
 		}
-		if (XMVector3LessOrEqual(centroid - m_min, radius)) {
+		if (!XMVector3Greater(centroid - m_min, radius)) {
 			return false;
 		}
 
 		return true;
 	}
 
+	//-------------------------------------------------------------------------
+	// Oriented Bounding Box
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	const OBB OBB::Fit(gsl::span< const Point3 > points) noexcept {
+		if (points.empty()) {
+			return OBB();
+		}
+
+		// Start from the best of the principal axes and the coordinate axes.
+		auto axes = ComputePrincipalAxes(points);
+		auto area = ComputeSurfaceArea(points, axes);
+		if (const auto aabb_area = ComputeSurfaceArea(points, XMMatrixIdentity());
+			aabb_area <= area) {
+
+			axes = XMMatrixIdentity();
+			area = aabb_area;
+		}
+
+		// Refine the axes by rotating them around each axis: a coarse scan
+		// of the angles in [-pi/4, pi/4], followed by a bisection search.
+		for (std::size_t pass = 0u; pass < 2u; ++pass) {
+			for (std::size_t i = 0u; i < 3u; ++i) {
+				const auto axis   = axes.r[i];
+				const auto rotate = [&axes, axis](F32 angle) noexcept {
+					return axes * XMMatrixRotationNormal(axis, angle);
+				};
+
+				auto best_angle = 0.0f;
+				auto best_area  = area;
+				const auto try_angle = [&](F32 angle) noexcept {
+					const auto candidate = ComputeSurfaceArea(points, rotate(angle));
+					if (candidate < best_area) {
+						best_angle = angle;
+						best_area  = candidate;
+					}
+				};
+
+				auto step = XM_PIDIV4 / 4.0f;
+				for (auto angle = -XM_PIDIV4; angle <= XM_PIDIV4; angle += step) {
+					try_angle(angle);
+				}
+				for (std::size_t j = 0u; j < 8u; ++j) {
+					step *= 0.5f;
+					const auto angle = best_angle;
+					try_angle(angle - step);
+					try_angle(angle + step);
+				}
+
+				if (best_area < area) {
+					axes = rotate(best_angle);
+					area = best_area;
+				}
+			}
+		}
+
+		const auto [p_min, p_max] = ComputeExtents(points, axes);
+		const auto centroid = XMVector3TransformNormal(0.5f * (p_min + p_max),
+													   axes);
+		const auto radius   = 0.5f * (p_max - p_min);
+		return OBB(centroid,
+				   axes.r[0] * XMVectorSplatX(radius),
+				   axes.r[1] * XMVectorSplatY(radius),
+				   axes.r[2] * XMVectorSplatZ(radius));
+	}
+
+	OBB::OBB(const AABB& aabb) noexcept {
+		const auto radius = aabb.Radius();
+		m_centroid = XMVectorSetW(aabb.Centroid(), 1.0f);
+		m_axes[0]  = XMVectorAndInt(radius, g_XMMaskX);
+		m_axes[1]  = XMVectorAndInt(radius, g_XMMaskY);
+		m_axes[2]  = XMVectorAndInt(radius, g_XMMaskZ);
+	}
+
 	//-------------------------------------------------------------------------
 	// Bounding Sphere
 	//-------------------------------------------------------------------------
@@ -111,6 +499,97 @@ namespace mage {
 		m_pr = XMVectorSetW(centroid, r);
 	}
 
+	[[nodiscard]]
+	const BoundingSphere BoundingSphere::Fit(gsl::span< const Point3 > points) noexcept {
+		if (points.empty()) {
+			return BoundingSphere();
+		}
+
+		// Find the extremal points along the 7 directions of EPOS-14 (i.e.
+		// the coordinate axes and the diagonals of the unit cube).
+		constexpr std::size_t nb_directions = 7u;
+		F32 min_distance[nb_directions];
+		F32 max_distance[nb_directions];
+		std::size_t min_index[nb_directions] = {};
+		std::size_t max_index[nb_directions] = {};
+		for (std::size_t k = 0u; k < nb_directions; ++k) {
+			min_distance[k] =  std::numeric_limits< F32 >::infinity();
+			max_distance[k] = -std::numeric_limits< F32 >::infinity();
+		}
+
+		const auto nb_points = static_cast< std::size_t >(points.size());
+		for (std::size_t i = 0u; i < nb_points; ++i) {
+			const auto& p = points[static_cast< std::ptrdiff_t >(i)];
+			const F32 distance[nb_directions] = {
+				p[0], p[1], p[2],
+				p[0] + p[1] + p[2],
+				p[0] + p[1] - p[2],
+				p[0] - p[1] + p[2],
+				p[0] - p[1] - p[2]
+			};
+
+			for (std::size_t k = 0u; k < nb_directions; ++k) {
+				if (distance[k] < min_distance[k]) {
+					min_distance[k] = distance[k];
+					min_index[k]    = i;
+				}
+				if (max_distance[k] < distance[k]) {
+					max_distance[k] = distance[k];
+					max_index[k]    = i;
+				}
+			}
+		}
+
+		// Span the initial bounding sphere by the most distant pair of
+		// extremal points.
+		auto p1 = XMLoad(points[static_cast< std::ptrdiff_t >(min_index[0])]);
+		auto p2 = XMLoad(points[static_cast< std::ptrdiff_t >(max_index[0])]);
+		auto diameter_sq = XMVectorGetX(XMVector3LengthSq(p2 - p1));
+		for (std::size_t k = 1u; k < nb_directions; ++k) {
+			const auto q1 = XMLoad(points[static_cast< std::ptrdiff_t >(min_index[k])]);
+			const auto q2 = XMLoad(points[static_cast< std::ptrdiff_t >(max_index[k])]);
+			const auto candidate_sq = XMVectorGetX(XMVector3LengthSq(q2 - q1));
+			if (diameter_sq < candidate_sq) {
+				p1 = q1;
+				p2 = q2;
+				diameter_sq = candidate_sq;
+			}
+		}
+
+		auto centroid = 0.5f * (p1 + p2);
+		auto radius   = 0.5f * std::sqrt(diameter_sq);
+		GrowSphere(points, 0u, centroid, radius);
+
+		// Refine the bounding sphere by shrinking and regrowing it, visiting
+		// the points in a different order each time.
+		for (std::size_t i = 1u; i <= g_sphere_nb_refinements; ++i) {
+			auto candidate_centroid = centroid;
+			auto candidate_radius   = g_sphere_shrink_factor * radius;
+			GrowSphere(points, (i * nb_points) / (g_sphere_nb_refinements + 1u),
+					   candidate_centroid, candidate_radius);
+
+			if (candidate_radius < radius) {
+				centroid = candidate_centroid;
+				radius   = candidate_radius;
+			}
+		}
+
+		// Fall back to the bounding sphere centered at the centroid of the
+		// AABB of the points.
+		const auto aabb_centroid = AABB::Fit(points).Centroid();
+		auto aabb_radius_sq = 0.0f;
+		for (const auto& point : points) {
+			const auto d = XMLoad(point) - aabb_centroid;
+			aabb_radius_sq = std::max(aabb_radius_sq,
+									  XMVectorGetX(XMVector3LengthSq(d)));
+		}
+		if (aabb_radius_sq < radius * radius) {
+			return BoundingSphere(aabb_centroid, std::sqrt(aabb_radius_sq));
+		}
+
+		return BoundingSphere(centroid, radius);
+	}
+
 	//-------------------------------------------------------------------------
 	// Bounding Sphere: Enclosing = Full Coverage
 	//-------------------------------------------------------------------------
@@ -371,6 +850,38 @@ namespace mage {
 		return true;
 	}
 
+	[[nodiscard]]
+	bool BoundingFrustum::Encloses(const OBB& obb) const noexcept {
+		// Test four planes at once.
+		const auto planes0 = XMMatrixTranspose(XMMATRIX(
+			m_left_plane, m_right_plane, m_bottom_plane, m_top_plane));
+		const auto [d0, r0] = ComputeDistancesAndRadii(planes0, obb);
+		if (!XMVector4GreaterOrEqual(d0, r0)) {
+			return false;
+		}
+
+		const auto planes1 = XMMatrixTranspose(XMMATRIX(
+			m_near_plane, m_far_plane, m_near_plane, m_far_plane));
+		const auto [d1, r1] = ComputeDistancesAndRadii(planes1, obb);
+		return XMVector4GreaterOrEqual(d1, r1);
+	}
+
+	[[nodiscard]]
+	bool BoundingFrustum::EnclosesStrict(const OBB& obb) const noexcept {
+		// Test four planes at once.
+		const auto planes0 = XMMatrixTranspose(XMMATRIX(
+			m_left_plane, m_right_plane, m_bottom_plane, m_top_plane));
+		const auto [d0, r0] = ComputeDistancesAndRadii(planes0, obb);
+		if (!XMVector4Greater(d0, r0)) {
+			return false;
+		}
+
+		const auto planes1 = XMMatrixTranspose(XMMATRIX(
+			m_near_plane, m_far_plane, m_near_plane, m_far_plane));
+		const auto [d1, r1] = ComputeDistancesAndRadii(planes1, obb);
+		return XMVector4Greater(d1, r1);
+	}
+
 	//-------------------------------------------------------------------------
 	// BoundingFrustum: Overlapping = Partial | Full Coverage
 	//-------------------------------------------------------------------------
@@ -435,6 +946,38 @@ namespace mage {
 		return true;
 	}
 
+	[[nodiscard]]
+	bool BoundingFrustum::Overlaps(const OBB& obb) const noexcept {
+		// Test for no coverage, four planes at once.
+		const auto planes0 = XMMatrixTranspose(XMMATRIX(
+			m_left_plane, m_right_plane, m_bottom_plane, m_top_plane));
+		const auto [d0, r0] = ComputeDistancesAndRadii(planes0, obb);
+		if (!XMVector4GreaterOrEqual(d0 + r0, XMVectorZero())) {
+			return false;
+		}
+
+		const auto planes1 = XMMatrixTranspose(XMMATRIX(
+			m_near_plane, m_far_plane, m_near_plane, m_far_plane));
+		const auto [d1, r1] = ComputeDistancesAndRadii(planes1, obb);
+		return XMVector4GreaterOrEqual(d1 + r1, XMVectorZero());
+	}
+
+	[[nodiscard]]
+	bool BoundingFrustum::OverlapsStrict(const OBB& obb) const noexcept {
+		// Test for no coverage, four planes at once.
+		const auto planes0 = XMMatrixTranspose(XMMATRIX(
+			m_left_plane, m_right_plane, m_bottom_plane, m_top_plane));
+		const auto [d0, r0] = ComputeDistancesAndRadii(planes0, obb);
+		if (!XMVector4Greater(d0 + r0, XMVectorZero())) {
+			return false;
+		}
+
+		const auto planes1 = XMMatrixTranspose(XMMATRIX(
+			m_near_plane, m_far_plane, m_near_plane, m_far_plane));
+		const auto [d1, r1] = ComputeDistancesAndRadii(planes1, obb);
+		return XMVector4Greater(d1 + r1, XMVectorZero());
+	}
+
 	//-------------------------------------------------------------------------
 	// BoundingFrustum: Operators
 	//-------------------------------------------------------------------------
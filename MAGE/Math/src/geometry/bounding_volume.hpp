@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "geometry\geometry.hpp"
+#include "geometry/geometry.hpp"
 
 #pragma endregion
 
@@ -28,8 +28,9 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	#pragma region
 
-	// Forward declaration.
+	// Forward declarations.
 	class AABB;
+	class OBB;
 
 	/**
 	 A class of Bounding Spheres.
@@ -108,6 +109,22 @@ namespace mage {
 				                  std::numeric_limits< float >::infinity());
 		}
 
+		/**
+		 Returns a (tight) bounding sphere enclosing the given points.
+
+		 The initial sphere is spanned by the most distant pair of extremal
+		 points along 7 directions (EPOS). This sphere is grown to enclose
+		 all points (Ritter) and refined by repeatedly shrinking and
+		 regrowing it. The bounding sphere is never larger than the bounding
+		 sphere centered at the centroid of the AABB of the points.
+
+		 @param[in]		points
+						A reference to the points.
+		 @return		The bounding sphere enclosing @a points.
+		 */
+		[[nodiscard]]
+		static const BoundingSphere Fit(gsl::span< const Point3 > points) noexcept;
+
 		//---------------------------------------------------------------------
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
@@ -594,7 +611,51 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		static const AABB XM_CALLCONV Maximum() noexcept {
-			return AABB(-g_XMInfinity, g_XMInfinity);
+			return AABB(XMVectorNegate(g_XMInfinity), g_XMInfinity);
+		}
+
+		/**
+		 Returns the AABB enclosing the given points.
+
+		 The points are reduced four at a time, without transposing them.
+
+		 @param[in]		points
+						A reference to the points.
+		 @return		The minimum AABB if @a points is empty.
+		 @return		The AABB enclosing @a points.
+		 */
+		[[nodiscard]]
+		static const AABB Fit(gsl::span< const Point3 > points) noexcept;
+
+		/**
+		 Returns the AABB enclosing the given AABB transformed by the given
+		 affine transformation matrix.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @param[in]		transform
+						The affine transformation matrix.
+		 @return		The minimum AABB if @a aabb is empty.
+		 @return		The AABB enclosing @a aabb transformed by
+						@a transform.
+		 */
+		[[nodiscard]]
+		static const AABB XM_CALLCONV Transform(const AABB& aabb,
+												FXMMATRIX transform) noexcept {
+
+			if (!XMVector3LessOrEqual(aabb.m_min, aabb.m_max)) {
+				return AABB();
+			}
+
+			// The radius of the transformed AABB is the radius of the AABB
+			// projected on the absolute rows of the transformation matrix.
+			const auto centroid = XMVector3TransformCoord(aabb.Centroid(),
+														  transform);
+			const auto r        = aabb.Radius();
+			auto radius         = XMVectorAbs(transform.r[0]) * XMVectorSplatX(r);
+			radius             += XMVectorAbs(transform.r[1]) * XMVectorSplatY(r);
+			radius             += XMVectorAbs(transform.r[2]) * XMVectorSplatZ(r);
+			return AABB(centroid - radius, centroid + radius);
 		}
 
 		//---------------------------------------------------------------------
@@ -605,7 +666,7 @@ namespace mage {
 		 Constructs an AABB.
 		 */
 		AABB() noexcept
-			: AABB(g_XMInfinity, -g_XMInfinity) {}
+			: AABB(g_XMInfinity, XMVectorNegate(g_XMInfinity)) {}
 
 		/**
 		 Constructs an AABB of the given point.
@@ -672,6 +733,14 @@ namespace mage {
 		 */
 		explicit AABB(const BoundingSphere& sphere) noexcept;
 
+		/**
+		 Constructs an AABB of the given OBB.
+
+		 @param[in]		obb
+						A reference to the OBB.
+		 */
+		explicit AABB(const OBB& obb) noexcept;
+
 		/**
 		 Destructs this AABB.
 		 */
@@ -846,10 +915,10 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		bool XM_CALLCONV Encloses(FXMVECTOR point) const noexcept {
-			if (XMVector3Less(point, m_min)) {
+			if (!XMVector3GreaterOrEqual(point, m_min)) {
 				return false;
 			}
-			if (XMVector3Greater(point, m_max)) {
+			if (!XMVector3LessOrEqual(point, m_max)) {
 				return false;
 			}
 
@@ -868,10 +937,10 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		bool XM_CALLCONV EnclosesStrict(FXMVECTOR point) const noexcept {
-			if (XMVector3LessOrEqual(point, m_min)) {
+			if (!XMVector3Greater(point, m_min)) {
 				return false;
 			}
-			if (XMVector3GreaterOrEqual(point, m_max)) {
+			if (!XMVector3Less(point, m_max)) {
 				return false;
 			}
 
@@ -967,10 +1036,10 @@ namespace mage {
 		[[nodiscard]]
 		bool Overlaps(const AABB& aabb) const noexcept {
 			// Test for no coverage.
-			if (XMVector3Greater(aabb.m_min, m_max)) {
+			if (!XMVector3LessOrEqual(aabb.m_min, m_max)) {
 				return false;
 			}
-			if (XMVector3Less(aabb.m_max, m_min)) {
+			if (!XMVector3GreaterOrEqual(aabb.m_max, m_min)) {
 				return false;
 			}
 
@@ -990,10 +1059,10 @@ namespace mage {
 		[[nodiscard]]
 		bool OverlapsStrict(const AABB& aabb) const noexcept {
 			// Test for no coverage.
-			if (XMVector3GreaterOrEqual(aabb.m_min, m_max)) {
+			if (!XMVector3Less(aabb.m_min, m_max)) {
 				return false;
 			}
-			if (XMVector3LessOrEqual(aabb.m_max, m_min)) {
+			if (!XMVector3Greater(aabb.m_max, m_min)) {
 				return false;
 			}
 
@@ -1083,6 +1152,250 @@ namespace mage {
 
 	#pragma endregion
 
+	//-------------------------------------------------------------------------
+	// Oriented Bounding Box
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of Oriented Bounding Boxes (OBBs).
+
+	 An OBB is represented by its centroid and its three half axes (i.e. its
+	 three (orthogonal) axes scaled by the corresponding half extents).
+	 */
+	class alignas(16) OBB {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the OBB enclosing the given points.
+
+		 The axes are the principal axes of the covariance matrix of the
+		 points. These axes are refined by rotating the OBB around each of its
+		 axes to minimize its surface area. The OBB is never larger (in terms
+		 of surface area) than the AABB of the points.
+
+		 @param[in]		points
+						A reference to the points.
+		 @return		The OBB enclosing @a points.
+		 */
+		[[nodiscard]]
+		static const OBB Fit(gsl::span< const Point3 > points) noexcept;
+
+		/**
+		 Returns the OBB enclosing the given OBB transformed by the given
+		 affine transformation matrix.
+
+		 @param[in]		obb
+						A reference to the OBB.
+		 @param[in]		transform
+						The affine transformation matrix.
+		 @return		The OBB enclosing @a obb transformed by
+						@a transform. The axes of the returned OBB are not
+						orthogonal if @a transform contains shear or a
+						non-uniform scale after a rotation.
+		 */
+		[[nodiscard]]
+		static const OBB XM_CALLCONV Transform(const OBB& obb,
+											   FXMMATRIX transform) noexcept {
+
+			return OBB(XMVector3TransformCoord(obb.m_centroid,  transform),
+					   XMVector3TransformNormal(obb.m_axes[0], transform),
+					   XMVector3TransformNormal(obb.m_axes[1], transform),
+					   XMVector3TransformNormal(obb.m_axes[2], transform));
+		}
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an OBB (of the origin).
+		 */
+		OBB() noexcept
+			: OBB(XMVectorZero(), XMVectorZero(), XMVectorZero(),
+				  XMVectorZero()) {}
+
+		/**
+		 Constructs an OBB of the given centroid and half axes.
+
+		 @param[in]		centroid
+						The centroid.
+		 @param[in]		axis_x
+						The first half axis.
+		 @param[in]		axis_y
+						The second half axis.
+		 @param[in]		axis_z
+						The third half axis.
+		 */
+		OBB(FXMVECTOR centroid,
+			FXMVECTOR axis_x,
+			FXMVECTOR axis_y,
+			GXMVECTOR axis_z) noexcept
+			: m_centroid(XMVectorSetW(centroid, 1.0f)),
+			  m_axes{ XMVectorSetW(axis_x, 0.0f),
+					  XMVectorSetW(axis_y, 0.0f),
+					  XMVectorSetW(axis_z, 0.0f) } {}
+
+		/**
+		 Constructs an OBB of the given AABB.
+
+		 @pre			@a aabb is not empty.
+		 @param[in]		aabb
+						A reference to the AABB.
+		 */
+		explicit OBB(const AABB& aabb) noexcept;
+
+		/**
+		 Constructs an OBB from the given OBB.
+
+		 @param[in]		obb
+						A reference to the OBB to copy.
+		 */
+		OBB(const OBB& obb) noexcept = default;
+
+		/**
+		 Constructs an OBB by moving the given OBB.
+
+		 @param[in]		obb
+						A reference to the OBB to move.
+		 */
+		OBB(OBB&& obb) noexcept = default;
+
+		/**
+		 Destructs this OBB.
+		 */
+		~OBB() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given OBB to this OBB.
+
+		 @param[in]		obb
+						A reference to the OBB to copy.
+		 @return		A reference to the copy of the given OBB (i.e. this
+						OBB).
+		 */
+		OBB& operator=(const OBB& obb) noexcept = default;
+
+		/**
+		 Moves the given OBB to this OBB.
+
+		 @param[in]		obb
+						A reference to the OBB to move.
+		 @return		A reference to the moved OBB (i.e. this OBB).
+		 */
+		OBB& operator=(OBB&& obb) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the centroid of this OBB.
+
+		 @return		The centroid of this OBB.
+		 */
+		[[nodiscard]]
+		const XMVECTOR XM_CALLCONV Centroid() const noexcept {
+			return m_centroid;
+		}
+
+		/**
+		 Returns the half axis of this OBB at the given index.
+
+		 @pre			@a index is smaller than 3.
+		 @param[in]		index
+						The index.
+		 @return		The half axis of this OBB at the given index.
+		 */
+		[[nodiscard]]
+		const XMVECTOR XM_CALLCONV Axis(std::size_t index) const noexcept {
+			return m_axes[index];
+		}
+
+		/**
+		 Returns the radius of this OBB along the given normal.
+
+		 @param[in]		n
+						The normal.
+		 @return		The radius of this OBB along @a n (i.e. half the
+						length of the projection of this OBB on @a n).
+		 */
+		[[nodiscard]]
+		F32 XM_CALLCONV RadiusAlongNormal(FXMVECTOR n) const noexcept {
+			const auto r = XMVectorAbs(XMVector3Dot(n, m_axes[0]))
+						 + XMVectorAbs(XMVector3Dot(n, m_axes[1]))
+						 + XMVectorAbs(XMVector3Dot(n, m_axes[2]));
+			return XMVectorGetX(r);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether the given OBB is equal to this OBB.
+
+		 @param[in]		obb
+						A reference to the OBB.
+		 @return		@c true if the given OBB is equal to this OBB.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool operator==(const OBB& obb) const noexcept {
+			return XMVector4Equal(m_centroid, obb.m_centroid)
+				&& XMVector4Equal(m_axes[0], obb.m_axes[0])
+				&& XMVector4Equal(m_axes[1], obb.m_axes[1])
+				&& XMVector4Equal(m_axes[2], obb.m_axes[2]);
+		}
+
+		/**
+		 Checks whether the given OBB is not equal to this OBB.
+
+		 @param[in]		obb
+						A reference to the OBB.
+		 @return		@c true if the given OBB is equal to this OBB.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool operator!=(const OBB& obb) const noexcept {
+			return !(*this == obb);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The centroid of this OBB.
+		 */
+		XMVECTOR m_centroid;
+
+		/**
+		 The half axes of this OBB.
+		 */
+		XMVECTOR m_axes[3];
+	};
+
+	static_assert(64 == sizeof(OBB));
+
+	/**
+	 A class of Oriented Bounding Boxes (OBBs).
+	 */
+	using OrientedBoundingBox = OBB;
+
+	#pragma endregion
+
 	//-------------------------------------------------------------------------
 	// Bounding Frustum
 	//-------------------------------------------------------------------------
@@ -1193,6 +1506,26 @@ namespace mage {
 		BoundingFrustum& operator=(BoundingFrustum&&
 								   frustum) noexcept = default;
 
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the plane of this bounding frustum at the given index.
+
+		 The planes are ordered as left, right, bottom, top, near and far. All
+		 planes are normalized and inward facing.
+
+		 @pre			@a index is smaller than 6.
+		 @param[in]		index
+						The index.
+		 @return		The plane of this bounding frustum at the given index.
+		 */
+		[[nodiscard]]
+		const XMVECTOR XM_CALLCONV GetPlane(std::size_t index) const noexcept {
+			return m_planes[index];
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Enclosing = Full Coverage
 		//---------------------------------------------------------------------
@@ -1313,6 +1646,33 @@ namespace mage {
 		[[nodiscard]]
 		bool EnclosesStrict(const BoundingSphere& sphere) const noexcept;
 
+		/**
+		 Checks whether this bounding frustum completely encloses the given OBB.
+
+		 @param[in]		obb
+						A reference to the OBB.
+		 @return		@c true if this bounding frustum completely encloses
+						@a obb. @c false otherwise.
+		 @note			This is a full coverage test of an OBB with regard to
+						a bounding frustum.
+		 */
+		[[nodiscard]]
+		bool Encloses(const OBB& obb) const noexcept;
+
+		/**
+		 Checks whether this bounding frustum completely, strictly encloses the
+		 given OBB.
+
+		 @param[in]		obb
+						A reference to the OBB.
+		 @return		@c true if this bounding frustum completely, strictly
+						encloses @a obb. @c false otherwise.
+		 @note			This is a full coverage test of an OBB with regard to
+						a bounding frustum.
+		 */
+		[[nodiscard]]
+		bool EnclosesStrict(const OBB& obb) const noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Methods: Overlapping = Partial | Full Coverage
 		//---------------------------------------------------------------------
@@ -1373,6 +1733,35 @@ namespace mage {
 		[[nodiscard]]
 		bool OverlapsStrict(const BoundingSphere& sphere) const noexcept;
 
+		/**
+		 Checks whether this bounding frustum overlaps the given OBB.
+
+		 The six planes of this bounding frustum are tested as separating
+		 axes, four planes at once.
+
+		 @param[in]		obb
+						A reference to the OBB.
+		 @return		@c true if this bounding frustum overlaps @a obb.
+						@c false otherwise.
+		 @note			This is a (partial or full) coverage test of an OBB
+						with regard to a bounding frustum.
+		 */
+		[[nodiscard]]
+		bool Overlaps(const OBB& obb) const noexcept;
+
+		/**
+		 Checks whether this bounding frustum strictly overlaps the given OBB.
+
+		 @param[in]		obb
+						A reference to the OBB.
+		 @return		@c true if this bounding frustum strictly overlaps
+						@a obb. @c false otherwise.
+		 @note			This is a (partial or full) coverage test of an OBB
+						with regard to a bounding frustum.
+		 */
+		[[nodiscard]]
+		bool OverlapsStrict(const OBB& obb) const noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Methods: Operators
 		//---------------------------------------------------------------------
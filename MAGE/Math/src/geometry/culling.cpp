@@ -0,0 +1,414 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/culling.hpp"
+#include "parallel/parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <immintrin.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 A struct of bounding frustum planes stored as structure of arrays.
+		 */
+		struct FrustumPlanes {
+
+		public:
+
+			F32 m_x[6];
+
+			F32 m_y[6];
+
+			F32 m_z[6];
+
+			F32 m_d[6];
+		};
+
+		/**
+		 A struct of references to bounding volume coordinates.
+
+		 For bounding spheres, the three radii pointers refer to the same
+		 array.
+		 */
+		struct BoundingVolumes {
+
+		public:
+
+			const F32* m_centroids[3];
+
+			const F32* m_radii[3];
+
+			std::size_t m_size;
+		};
+
+		[[nodiscard]]
+		const FrustumPlanes ExtractPlanes(const BoundingFrustum& frustum) noexcept {
+			FrustumPlanes planes;
+			for (std::size_t i = 0u; i < 6u; ++i) {
+				const auto plane = frustum.GetPlane(i);
+				planes.m_x[i] = XMVectorGetX(plane);
+				planes.m_y[i] = XMVectorGetY(plane);
+				planes.m_z[i] = XMVectorGetZ(plane);
+				planes.m_d[i] = XMVectorGetW(plane);
+			}
+
+			return planes;
+		}
+
+		/**
+		 Culls the bounding volumes in the given range one at a time.
+
+		 A bounding volume is culled if its signed distance to a plane,
+		 increased with its radius projected on the plane normal, is
+		 negative for at least one plane. For AABBs, this distance is
+		 measured from the vertex furthest along the plane normal (i.e. the
+		 same test as BoundingFrustum::Overlaps).
+		 */
+		template< bool IsAABB >
+		[[nodiscard]]
+		std::size_t CullScalar(const FrustumPlanes& planes,
+							   const BoundingVolumes& volumes,
+							   std::size_t begin,
+							   U32* visible,
+							   std::size_t count) noexcept {
+
+			for (auto i = begin; i < volumes.m_size; ++i) {
+				const auto cx = volumes.m_centroids[0][i];
+				const auto cy = volumes.m_centroids[1][i];
+				const auto cz = volumes.m_centroids[2][i];
+				const auto rx = volumes.m_radii[0][i];
+				const auto ry = volumes.m_radii[1][i];
+				const auto rz = volumes.m_radii[2][i];
+
+				auto min_distance = std::numeric_limits< F32 >::max();
+				for (std::size_t j = 0u; j < 6u; ++j) {
+					const auto radius = IsAABB
+						? std::abs(planes.m_x[j]) * rx
+						+ std::abs(planes.m_y[j]) * ry
+						+ std::abs(planes.m_z[j]) * rz
+						: rx;
+					const auto distance = planes.m_x[j] * cx
+						                + planes.m_y[j] * cy
+						                + planes.m_z[j] * cz
+						                + planes.m_d[j] + radius;
+					min_distance = std::min(min_distance, distance);
+				}
+
+				visible[count] = static_cast< U32 >(i);
+				count += (0.0f <= min_distance) ? 1u : 0u;
+			}
+
+			return count;
+		}
+
+		/**
+		 Culls the bounding volumes four at a time using SSE2 instructions.
+		 The remaining bounding volumes are culled one at a time.
+		 */
+		template< bool IsAABB >
+		[[nodiscard]]
+		std::size_t CullSSE2(const FrustumPlanes& planes,
+							 const BoundingVolumes& volumes,
+							 U32* visible) noexcept {
+
+			const auto sign_mask = _mm_set1_ps(-0.0f);
+
+			__m128 nx[6], ny[6], nz[6], nd[6], ax[6], ay[6], az[6];
+			for (std::size_t j = 0u; j < 6u; ++j) {
+				nx[j] = _mm_set1_ps(planes.m_x[j]);
+				ny[j] = _mm_set1_ps(planes.m_y[j]);
+				nz[j] = _mm_set1_ps(planes.m_z[j]);
+				nd[j] = _mm_set1_ps(planes.m_d[j]);
+				ax[j] = _mm_andnot_ps(sign_mask, nx[j]);
+				ay[j] = _mm_andnot_ps(sign_mask, ny[j]);
+				az[j] = _mm_andnot_ps(sign_mask, nz[j]);
+			}
+
+			const auto zero = _mm_setzero_ps();
+			const auto end  = volumes.m_size & ~std::size_t(3u);
+
+			std::size_t count = 0u;
+			std::size_t i     = 0u;
+			for (; i < end; i += 4u) {
+				const auto cx = _mm_loadu_ps(volumes.m_centroids[0] + i);
+				const auto cy = _mm_loadu_ps(volumes.m_centroids[1] + i);
+				const auto cz = _mm_loadu_ps(volumes.m_centroids[2] + i);
+				const auto rx = _mm_loadu_ps(volumes.m_radii[0] + i);
+				const auto ry = IsAABB ? _mm_loadu_ps(volumes.m_radii[1] + i) : rx;
+				const auto rz = IsAABB ? _mm_loadu_ps(volumes.m_radii[2] + i) : rx;
+
+				auto min_distance = _mm_set1_ps(std::numeric_limits< F32 >::max());
+				for (std::size_t j = 0u; j < 6u; ++j) {
+					auto distance = _mm_add_ps(_mm_mul_ps(nx[j], cx), nd[j]);
+					distance = _mm_add_ps(_mm_mul_ps(ny[j], cy), distance);
+					distance = _mm_add_ps(_mm_mul_ps(nz[j], cz), distance);
+					if constexpr (IsAABB) {
+						distance = _mm_add_ps(_mm_mul_ps(ax[j], rx), distance);
+						distance = _mm_add_ps(_mm_mul_ps(ay[j], ry), distance);
+						distance = _mm_add_ps(_mm_mul_ps(az[j], rz), distance);
+					}
+					else {
+						distance = _mm_add_ps(rx, distance);
+					}
+					min_distance = _mm_min_ps(min_distance, distance);
+				}
+
+				// Compact the indices of the visible bounding volumes without
+				// branches.
+				const auto mask = static_cast< U32 >(
+					_mm_movemask_ps(_mm_cmpge_ps(min_distance, zero)));
+				for (U32 lane = 0u; lane < 4u; ++lane) {
+					visible[count] = static_cast< U32 >(i) + lane;
+					count += (mask >> lane) & 1u;
+				}
+			}
+
+			return CullScalar< IsAABB >(planes, volumes, i, visible, count);
+		}
+
+		/**
+		 Culls the bounding volumes eight at a time using AVX2 and FMA3
+		 instructions. The remaining bounding volumes are culled one at a
+		 time.
+
+		 @pre			The processor supports AVX2 instructions.
+		 */
+		template< bool IsAABB >
+		[[nodiscard]]
+		MAGE_TARGET_AVX2
+		std::size_t CullAVX2(const FrustumPlanes& planes,
+							 const BoundingVolumes& volumes,
+							 U32* visible) noexcept {
+
+			const auto sign_mask = _mm256_set1_ps(-0.0f);
+
+			__m256 nx[6], ny[6], nz[6], nd[6], ax[6], ay[6], az[6];
+			for (std::size_t j = 0u; j < 6u; ++j) {
+				nx[j] = _mm256_set1_ps(planes.m_x[j]);
+				ny[j] = _mm256_set1_ps(planes.m_y[j]);
+				nz[j] = _mm256_set1_ps(planes.m_z[j]);
+				nd[j] = _mm256_set1_ps(planes.m_d[j]);
+				ax[j] = _mm256_andnot_ps(sign_mask, nx[j]);
+				ay[j] = _mm256_andnot_ps(sign_mask, ny[j]);
+				az[j] = _mm256_andnot_ps(sign_mask, nz[j]);
+			}
+
+			const auto zero = _mm256_setzero_ps();
+			const auto end  = volumes.m_size & ~std::size_t(7u);
+
+			std::size_t count = 0u;
+			std::size_t i     = 0u;
+			for (; i < end; i += 8u) {
+				const auto cx = _mm256_loadu_ps(volumes.m_centroids[0] + i);
+				const auto cy = _mm256_loadu_ps(volumes.m_centroids[1] + i);
+				const auto cz = _mm256_loadu_ps(volumes.m_centroids[2] + i);
+				const auto rx = _mm256_loadu_ps(volumes.m_radii[0] + i);
+				const auto ry = IsAABB ? _mm256_loadu_ps(volumes.m_radii[1] + i) : rx;
+				const auto rz = IsAABB ? _mm256_loadu_ps(volumes.m_radii[2] + i) : rx;
+
+				auto min_distance = _mm256_set1_ps(std::numeric_limits< F32 >::max());
+				for (std::size_t j = 0u; j < 6u; ++j) {
+					auto distance = _mm256_fmadd_ps(nx[j], cx, nd[j]);
+					distance = _mm256_fmadd_ps(ny[j], cy, distance);
+					distance = _mm256_fmadd_ps(nz[j], cz, distance);
+					if constexpr (IsAABB) {
+						distance = _mm256_fmadd_ps(ax[j], rx, distance);
+						distance = _mm256_fmadd_ps(ay[j], ry, distance);
+						distance = _mm256_fmadd_ps(az[j], rz, distance);
+					}
+					else {
+						distance = _mm256_add_ps(rx, distance);
+					}
+					min_distance = _mm256_min_ps(min_distance, distance);
+				}
+
+				// Compact the indices of the visible bounding volumes without
+				// branches.
+				const auto mask = static_cast< U32 >(_mm256_movemask_ps(
+					_mm256_cmp_ps(min_distance, zero, _CMP_GE_OQ)));
+				for (U32 lane = 0u; lane < 8u; ++lane) {
+					visible[count] = static_cast< U32 >(i) + lane;
+					count += (mask >> lane) & 1u;
+				}
+			}
+
+			return CullScalar< IsAABB >(planes, volumes, i, visible, count);
+		}
+
+		template< bool IsAABB >
+		[[nodiscard]]
+		std::size_t CullBoundingVolumes(const BoundingFrustum& frustum,
+										const BoundingVolumes& volumes,
+										U32* visible,
+										CullingKernel kernel) noexcept {
+
+			const auto planes = ExtractPlanes(frustum);
+
+			switch (kernel) {
+
+			case CullingKernel::AVX2:
+				return CullAVX2< IsAABB >(planes, volumes, visible);
+			case CullingKernel::SSE2:
+				return CullSSE2< IsAABB >(planes, volumes, visible);
+			default:
+				return CullScalar< IsAABB >(planes, volumes, 0u, visible, 0u);
+			}
+		}
+
+		[[nodiscard]]
+		CullingKernel GetDefaultCullingKernel() noexcept {
+			#ifdef __AVX2__
+			return CullingKernel::AVX2;
+			#else  // __AVX2__
+			return SupportsAVX2() ? CullingKernel::AVX2 : CullingKernel::SSE2;
+			#endif // __AVX2__
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// AABBArray
+	//-------------------------------------------------------------------------
+
+	void AABBArray::reserve(std::size_t size) {
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_centroids[axis].reserve(size);
+			m_radii[axis].reserve(size);
+		}
+	}
+
+	void AABBArray::resize(std::size_t size) {
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_centroids[axis].resize(size);
+			m_radii[axis].resize(size);
+		}
+	}
+
+	void AABBArray::clear() noexcept {
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_centroids[axis].clear();
+			m_radii[axis].clear();
+		}
+	}
+
+	void AABBArray::push_back(const AABB& aabb) {
+		resize(size() + 1u);
+		Set(size() - 1u, aabb);
+	}
+
+	void AABBArray::Set(std::size_t index, const AABB& aabb) noexcept {
+		const auto centroid = XMStore< F32x3 >(aabb.Centroid());
+		const auto radius   = XMStore< F32x3 >(aabb.Radius());
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_centroids[axis][index] = centroid[axis];
+			m_radii[axis][index]     = radius[axis];
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// BoundingSphereArray
+	//-------------------------------------------------------------------------
+
+	void BoundingSphereArray::reserve(std::size_t size) {
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_centroids[axis].reserve(size);
+		}
+		m_radii.reserve(size);
+	}
+
+	void BoundingSphereArray::resize(std::size_t size) {
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_centroids[axis].resize(size);
+		}
+		m_radii.resize(size);
+	}
+
+	void BoundingSphereArray::clear() noexcept {
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_centroids[axis].clear();
+		}
+		m_radii.clear();
+	}
+
+	void BoundingSphereArray::push_back(const BoundingSphere& sphere) {
+		resize(size() + 1u);
+		Set(size() - 1u, sphere);
+	}
+
+	void BoundingSphereArray::Set(std::size_t index,
+								  const BoundingSphere& sphere) noexcept {
+
+		const auto centroid = XMStore< F32x3 >(sphere.Centroid());
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_centroids[axis][index] = centroid[axis];
+		}
+		m_radii[index] = sphere.Radius();
+	}
+
+	//-------------------------------------------------------------------------
+	// Culling
+	//-------------------------------------------------------------------------
+
+	[[nodiscard]]
+	std::size_t Cull(const BoundingFrustum& frustum,
+					 const AABBArray& aabbs,
+					 U32* visible) noexcept {
+
+		return Cull(frustum, aabbs, visible, GetDefaultCullingKernel());
+	}
+
+	[[nodiscard]]
+	std::size_t Cull(const BoundingFrustum& frustum,
+					 const AABBArray& aabbs,
+					 U32* visible,
+					 CullingKernel kernel) noexcept {
+
+		const BoundingVolumes volumes = {
+			{ aabbs.GetCentroids(0u), aabbs.GetCentroids(1u), aabbs.GetCentroids(2u) },
+			{ aabbs.GetRadii(0u),     aabbs.GetRadii(1u),     aabbs.GetRadii(2u) },
+			aabbs.size()
+		};
+
+		return CullBoundingVolumes< true >(frustum, volumes, visible, kernel);
+	}
+
+	[[nodiscard]]
+	std::size_t Cull(const BoundingFrustum& frustum,
+					 const BoundingSphereArray& spheres,
+					 U32* visible) noexcept {
+
+		return Cull(frustum, spheres, visible, GetDefaultCullingKernel());
+	}
+
+	[[nodiscard]]
+	std::size_t Cull(const BoundingFrustum& frustum,
+					 const BoundingSphereArray& spheres,
+					 U32* visible,
+					 CullingKernel kernel) noexcept {
+
+		const BoundingVolumes volumes = {
+			{ spheres.GetCentroids(0u), spheres.GetCentroids(1u), spheres.GetCentroids(2u) },
+			{ spheres.GetRadii(),       spheres.GetRadii(),       spheres.GetRadii() },
+			spheres.size()
+		};
+
+		return CullBoundingVolumes< false >(frustum, volumes, visible, kernel);
+	}
+}
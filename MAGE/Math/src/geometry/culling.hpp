@@ -0,0 +1,563 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/bounding_volume.hpp"
+#include "memory/allocation.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A type definition for the (32 byte aligned) coordinate arrays of bounding
+	 volume arrays.
+	 */
+	using BoundingVolumeCoordinates
+		= std::vector< F32, AlignedAllocator< F32, 32u > >;
+
+	//-------------------------------------------------------------------------
+	// AABBArray
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of AABB arrays.
+
+	 The AABBs are stored as structure of arrays (i.e. one array per
+	 coordinate of the centroids and per coordinate of the radii) to cull
+	 multiple AABBs at once.
+	 */
+	class AABBArray {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an AABB array.
+		 */
+		AABBArray() = default;
+
+		/**
+		 Constructs an AABB array from the given AABB array.
+
+		 @param[in]		aabbs
+						A reference to the AABB array to copy.
+		 */
+		AABBArray(const AABBArray& aabbs) = default;
+
+		/**
+		 Constructs an AABB array by moving the given AABB array.
+
+		 @param[in]		aabbs
+						A reference to the AABB array to move.
+		 */
+		AABBArray(AABBArray&& aabbs) noexcept = default;
+
+		/**
+		 Destructs this AABB array.
+		 */
+		~AABBArray() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given AABB array to this AABB array.
+
+		 @param[in]		aabbs
+						A reference to the AABB array to copy.
+		 @return		A reference to the copy of the given AABB array (i.e.
+						this AABB array).
+		 */
+		AABBArray& operator=(const AABBArray& aabbs) = default;
+
+		/**
+		 Moves the given AABB array to this AABB array.
+
+		 @param[in]		aabbs
+						A reference to the AABB array to move.
+		 @return		A reference to the moved AABB array (i.e. this AABB
+						array).
+		 */
+		AABBArray& operator=(AABBArray&& aabbs) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this AABB array is empty.
+
+		 @return		@c true if this AABB array is empty. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_centroids[0].empty();
+		}
+
+		/**
+		 Returns the number of AABBs of this AABB array.
+
+		 @return		The number of AABBs of this AABB array.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_centroids[0].size();
+		}
+
+		/**
+		 Reserves memory for the given number of AABBs.
+
+		 @param[in]		size
+						The number of AABBs.
+		 */
+		void reserve(std::size_t size);
+
+		/**
+		 Resizes this AABB array to the given number of AABBs. Added AABBs
+		 are degenerate AABBs at the origin.
+
+		 @param[in]		size
+						The number of AABBs.
+		 */
+		void resize(std::size_t size);
+
+		/**
+		 Removes all AABBs of this AABB array. The capacity is retained.
+		 */
+		void clear() noexcept;
+
+		/**
+		 Appends the given AABB to this AABB array.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 */
+		void push_back(const AABB& aabb);
+
+		/**
+		 Sets the AABB at the given index of this AABB array to the given
+		 AABB.
+
+		 @pre			@a index is smaller than the size of this AABB array.
+		 @param[in]		index
+						The index.
+		 @param[in]		aabb
+						A reference to the AABB.
+		 */
+		void Set(std::size_t index, const AABB& aabb) noexcept;
+
+		/**
+		 Returns the given coordinate of the centroids of this AABB array.
+
+		 @pre			@a axis is smaller than 3.
+		 @param[in]		axis
+						The index of the coordinate.
+		 @return		A pointer to the given coordinate of the centroids of
+						this AABB array.
+		 */
+		[[nodiscard]]
+		F32* GetCentroids(std::size_t axis) noexcept {
+			return m_centroids[axis].data();
+		}
+
+		/**
+		 Returns the given coordinate of the centroids of this AABB array.
+
+		 @pre			@a axis is smaller than 3.
+		 @param[in]		axis
+						The index of the coordinate.
+		 @return		A pointer to the given coordinate of the centroids of
+						this AABB array.
+		 */
+		[[nodiscard]]
+		const F32* GetCentroids(std::size_t axis) const noexcept {
+			return m_centroids[axis].data();
+		}
+
+		/**
+		 Returns the given coordinate of the radii of this AABB array.
+
+		 @pre			@a axis is smaller than 3.
+		 @param[in]		axis
+						The index of the coordinate.
+		 @return		A pointer to the given coordinate of the radii of this
+						AABB array.
+		 */
+		[[nodiscard]]
+		F32* GetRadii(std::size_t axis) noexcept {
+			return m_radii[axis].data();
+		}
+
+		/**
+		 Returns the given coordinate of the radii of this AABB array.
+
+		 @pre			@a axis is smaller than 3.
+		 @param[in]		axis
+						The index of the coordinate.
+		 @return		A pointer to the given coordinate of the radii of this
+						AABB array.
+		 */
+		[[nodiscard]]
+		const F32* GetRadii(std::size_t axis) const noexcept {
+			return m_radii[axis].data();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The x, y and z coordinates of the centroids of this AABB array.
+		 */
+		BoundingVolumeCoordinates m_centroids[3];
+
+		/**
+		 The x, y and z coordinates of the radii (i.e. half diagonals) of this
+		 AABB array.
+		 */
+		BoundingVolumeCoordinates m_radii[3];
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// BoundingSphereArray
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of bounding sphere arrays.
+
+	 The bounding spheres are stored as structure of arrays (i.e. one array
+	 per coordinate of the centroids and one array for the radii) to cull
+	 multiple bounding spheres at once.
+	 */
+	class BoundingSphereArray {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a bounding sphere array.
+		 */
+		BoundingSphereArray() = default;
+
+		/**
+		 Constructs a bounding sphere array from the given bounding sphere
+		 array.
+
+		 @param[in]		spheres
+						A reference to the bounding sphere array to copy.
+		 */
+		BoundingSphereArray(const BoundingSphereArray& spheres) = default;
+
+		/**
+		 Constructs a bounding sphere array by moving the given bounding
+		 sphere array.
+
+		 @param[in]		spheres
+						A reference to the bounding sphere array to move.
+		 */
+		BoundingSphereArray(BoundingSphereArray&& spheres) noexcept = default;
+
+		/**
+		 Destructs this bounding sphere array.
+		 */
+		~BoundingSphereArray() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given bounding sphere array to this bounding sphere array.
+
+		 @param[in]		spheres
+						A reference to the bounding sphere array to copy.
+		 @return		A reference to the copy of the given bounding sphere
+						array (i.e. this bounding sphere array).
+		 */
+		BoundingSphereArray& operator=(const BoundingSphereArray&
+									   spheres) = default;
+
+		/**
+		 Moves the given bounding sphere array to this bounding sphere array.
+
+		 @param[in]		spheres
+						A reference to the bounding sphere array to move.
+		 @return		A reference to the moved bounding sphere array (i.e.
+						this bounding sphere array).
+		 */
+		BoundingSphereArray& operator=(BoundingSphereArray&&
+									   spheres) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this bounding sphere array is empty.
+
+		 @return		@c true if this bounding sphere array is empty.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_radii.empty();
+		}
+
+		/**
+		 Returns the number of bounding spheres of this bounding sphere array.
+
+		 @return		The number of bounding spheres of this bounding sphere
+						array.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_radii.size();
+		}
+
+		/**
+		 Reserves memory for the given number of bounding spheres.
+
+		 @param[in]		size
+						The number of bounding spheres.
+		 */
+		void reserve(std::size_t size);
+
+		/**
+		 Resizes this bounding sphere array to the given number of bounding
+		 spheres. Added bounding spheres are degenerate bounding spheres at
+		 the origin.
+
+		 @param[in]		size
+						The number of bounding spheres.
+		 */
+		void resize(std::size_t size);
+
+		/**
+		 Removes all bounding spheres of this bounding sphere array. The
+		 capacity is retained.
+		 */
+		void clear() noexcept;
+
+		/**
+		 Appends the given bounding sphere to this bounding sphere array.
+
+		 @param[in]		sphere
+						A reference to the bounding sphere.
+		 */
+		void push_back(const BoundingSphere& sphere);
+
+		/**
+		 Sets the bounding sphere at the given index of this bounding sphere
+		 array to the given bounding sphere.
+
+		 @pre			@a index is smaller than the size of this bounding
+						sphere array.
+		 @param[in]		index
+						The index.
+		 @param[in]		sphere
+						A reference to the bounding sphere.
+		 */
+		void Set(std::size_t index, const BoundingSphere& sphere) noexcept;
+
+		/**
+		 Returns the given coordinate of the centroids of this bounding sphere
+		 array.
+
+		 @pre			@a axis is smaller than 3.
+		 @param[in]		axis
+						The index of the coordinate.
+		 @return		A pointer to the given coordinate of the centroids of
+						this bounding sphere array.
+		 */
+		[[nodiscard]]
+		const F32* GetCentroids(std::size_t axis) const noexcept {
+			return m_centroids[axis].data();
+		}
+
+		/**
+		 Returns the radii of this bounding sphere array.
+
+		 @return		A pointer to the radii of this bounding sphere array.
+		 */
+		[[nodiscard]]
+		const F32* GetRadii() const noexcept {
+			return m_radii.data();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The x, y and z coordinates of the centroids of this bounding sphere
+		 array.
+		 */
+		BoundingVolumeCoordinates m_centroids[3];
+
+		/**
+		 The radii of this bounding sphere array.
+		 */
+		BoundingVolumeCoordinates m_radii;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Culling
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 An enumeration of the different culling kernels.
+
+	 This contains:
+	 @c Scalar,
+	 @c SSE2 and
+	 @c AVX2.
+	 */
+	enum class CullingKernel : U8 {
+		Scalar = 0, // One bounding volume per iteration.
+		SSE2,       // Four bounding volumes per iteration.
+		AVX2        // Eight bounding volumes per iteration.
+	};
+
+	/**
+	 Culls the given AABBs against the given bounding frustum.
+
+	 The planes of the bounding frustum are broadcasted once, after which 8
+	 (AVX2) or 4 (SSE2) AABBs are tested per iteration. The AVX2 kernel is
+	 used if supported by the processor.
+
+	 @pre			The size of @a visible is at least equal to the size of
+					@a aabbs.
+	 @param[in]		frustum
+					A reference to the bounding frustum.
+	 @param[in]		aabbs
+					A reference to the AABB array (expressed in the same
+					coordinate system as the planes of @a frustum).
+	 @param[out]	visible
+					A pointer to the first element of the array to store
+					the (increasing) indices of the AABBs which are not
+					culled.
+	 @return		The number of AABBs which are not culled.
+	 */
+	[[nodiscard]]
+	std::size_t Cull(const BoundingFrustum& frustum,
+					 const AABBArray& aabbs,
+					 U32* visible) noexcept;
+
+	/**
+	 Culls the given AABBs against the given bounding frustum using the
+	 given culling kernel.
+
+	 @pre			The size of @a visible is at least equal to the size of
+					@a aabbs.
+	 @pre			The processor supports AVX2 and FMA3 instructions if
+					@a kernel is equal to @c CullingKernel::AVX2.
+	 @param[in]		frustum
+					A reference to the bounding frustum.
+	 @param[in]		aabbs
+					A reference to the AABB array (expressed in the same
+					coordinate system as the planes of @a frustum).
+	 @param[out]	visible
+					A pointer to the first element of the array to store
+					the (increasing) indices of the AABBs which are not
+					culled.
+	 @param[in]		kernel
+					The culling kernel.
+	 @return		The number of AABBs which are not culled.
+	 */
+	[[nodiscard]]
+	std::size_t Cull(const BoundingFrustum& frustum,
+					 const AABBArray& aabbs,
+					 U32* visible,
+					 CullingKernel kernel) noexcept;
+
+	/**
+	 Culls the given bounding spheres against the given bounding frustum.
+
+	 The planes of the bounding frustum are broadcasted once, after which 8
+	 (AVX2) or 4 (SSE2) bounding spheres are tested per iteration. The AVX2
+	 kernel is used if supported by the processor.
+
+	 @pre			The size of @a visible is at least equal to the size of
+					@a spheres.
+	 @param[in]		frustum
+					A reference to the bounding frustum.
+	 @param[in]		spheres
+					A reference to the bounding sphere array (expressed in
+					the same coordinate system as the planes of
+					@a frustum).
+	 @param[out]	visible
+					A pointer to the first element of the array to store
+					the (increasing) indices of the bounding spheres which
+					are not culled.
+	 @return		The number of bounding spheres which are not culled.
+	 */
+	[[nodiscard]]
+	std::size_t Cull(const BoundingFrustum& frustum,
+					 const BoundingSphereArray& spheres,
+					 U32* visible) noexcept;
+
+	/**
+	 Culls the given bounding spheres against the given bounding frustum
+	 using the given culling kernel.
+
+	 @pre			The size of @a visible is at least equal to the size of
+					@a spheres.
+	 @pre			The processor supports AVX2 and FMA3 instructions if
+					@a kernel is equal to @c CullingKernel::AVX2.
+	 @param[in]		frustum
+					A reference to the bounding frustum.
+	 @param[in]		spheres
+					A reference to the bounding sphere array (expressed in
+					the same coordinate system as the planes of
+					@a frustum).
+	 @param[out]	visible
+					A pointer to the first element of the array to store
+					the (increasing) indices of the bounding spheres which
+					are not culled.
+	 @param[in]		kernel
+					The culling kernel.
+	 @return		The number of bounding spheres which are not culled.
+	 */
+	[[nodiscard]]
+	std::size_t Cull(const BoundingFrustum& frustum,
+					 const BoundingSphereArray& spheres,
+					 U32* visible,
+					 CullingKernel kernel) noexcept;
+
+	#pragma endregion
+}
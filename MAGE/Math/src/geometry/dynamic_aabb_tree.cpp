@@ -0,0 +1,401 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/dynamic_aabb_tree.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The number of bins per axis used by the surface area heuristic.
+		 */
+		constexpr std::size_t g_nb_sah_bins = 16u;
+
+		[[nodiscard]]
+		F32 SurfaceArea(const AABB& aabb) noexcept {
+			const auto d = aabb.Diagonal();
+			const auto x = XMVectorGetX(d);
+			const auto y = XMVectorGetY(d);
+			const auto z = XMVectorGetZ(d);
+			return 2.0f * (x * y + y * z + z * x);
+		}
+
+		[[nodiscard]]
+		const AABB Fatten(const AABB& aabb, F32 margin) noexcept {
+			const XMVECTOR offset = { margin, margin, margin, 0.0f };
+			return AABB(aabb.MinPoint() - offset, aabb.MaxPoint() + offset);
+		}
+	}
+
+	DynamicAABBTree::DynamicAABBTree(F32 margin)
+		: m_nodes(),
+		m_root(s_null_node),
+		m_free_list(s_null_node),
+		m_nb_proxies(0u),
+		m_margin(std::max(margin, 0.0f)) {}
+
+	DynamicAABBTree::DynamicAABBTree(const DynamicAABBTree& tree) = default;
+
+	DynamicAABBTree::DynamicAABBTree(DynamicAABBTree&& tree) noexcept = default;
+
+	DynamicAABBTree::~DynamicAABBTree() = default;
+
+	DynamicAABBTree& DynamicAABBTree
+		::operator=(const DynamicAABBTree& tree) = default;
+
+	DynamicAABBTree& DynamicAABBTree
+		::operator=(DynamicAABBTree&& tree) noexcept = default;
+
+	U32 DynamicAABBTree::Insert(const AABB& aabb, U32 data) {
+		const auto leaf = AllocateNode();
+		m_nodes[leaf].m_aabb = Fatten(aabb, m_margin);
+		m_nodes[leaf].m_data = data;
+
+		InsertLeaf(leaf);
+		++m_nb_proxies;
+
+		return leaf;
+	}
+
+	void DynamicAABBTree::Remove(U32 proxy) noexcept {
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+		--m_nb_proxies;
+	}
+
+	bool DynamicAABBTree::Move(U32 proxy, const AABB& aabb) noexcept {
+		if (m_nodes[proxy].m_aabb.Encloses(aabb)) {
+			return false;
+		}
+
+		// Removing and inserting a leaf node allocates no nodes.
+		RemoveLeaf(proxy);
+		m_nodes[proxy].m_aabb = Fatten(aabb, m_margin);
+		InsertLeaf(proxy);
+
+		return true;
+	}
+
+	bool DynamicAABBTree::Refit(U32 proxy, const AABB& aabb) noexcept {
+		if (m_nodes[proxy].m_aabb.Encloses(aabb)) {
+			return false;
+		}
+
+		m_nodes[proxy].m_aabb = Fatten(aabb, m_margin);
+		RefitAncestors(m_nodes[proxy].m_parent);
+
+		return true;
+	}
+
+	void DynamicAABBTree::Build() {
+		if (s_null_node == m_root) {
+			return;
+		}
+
+		// Collect the leaf nodes and free the internal nodes.
+		std::vector< U32 > leaves;
+		leaves.reserve(m_nb_proxies);
+		for (std::size_t i = 0u; i < m_nodes.size(); ++i) {
+			const auto index = static_cast< U32 >(i);
+			if (m_nodes[i].m_height < 0) {
+				continue;
+			}
+
+			if (m_nodes[i].IsLeaf()) {
+				leaves.push_back(index);
+			}
+			else {
+				FreeNode(index);
+			}
+		}
+
+		m_root = BuildSubtree(leaves.data(), leaves.size());
+		m_nodes[m_root].m_parent = s_null_node;
+	}
+
+	void DynamicAABBTree::Clear() noexcept {
+		m_nodes.clear();
+		m_root       = s_null_node;
+		m_free_list  = s_null_node;
+		m_nb_proxies = 0u;
+	}
+
+	[[nodiscard]]
+	F32 DynamicAABBTree::GetCost() const noexcept {
+		if (s_null_node == m_root) {
+			return 0.0f;
+		}
+
+		const auto root_area = SurfaceArea(m_nodes[m_root].m_aabb);
+		if (root_area <= 0.0f) {
+			return 0.0f;
+		}
+
+		F32 area = 0.0f;
+		for (const auto& node : m_nodes) {
+			if (0 < node.m_height) {
+				area += SurfaceArea(node.m_aabb);
+			}
+		}
+
+		return area / root_area;
+	}
+
+	U32 DynamicAABBTree::AllocateNode() {
+		U32 index;
+		if (s_null_node == m_free_list) {
+			index = static_cast< U32 >(m_nodes.size());
+			m_nodes.emplace_back();
+		}
+		else {
+			index = m_free_list;
+			m_free_list = m_nodes[index].m_parent;
+		}
+
+		auto& node = m_nodes[index];
+		node.m_aabb        = AABB();
+		node.m_parent      = s_null_node;
+		node.m_children[0] = s_null_node;
+		node.m_children[1] = s_null_node;
+		node.m_data        = 0u;
+		node.m_height      = 0;
+
+		return index;
+	}
+
+	void DynamicAABBTree::FreeNode(U32 node) noexcept {
+		m_nodes[node].m_parent = m_free_list;
+		m_nodes[node].m_height = -1;
+		m_free_list = node;
+	}
+
+	void DynamicAABBTree::InsertLeaf(U32 leaf) {
+		if (s_null_node == m_root) {
+			m_root = leaf;
+			m_nodes[leaf].m_parent = s_null_node;
+			return;
+		}
+
+		const auto leaf_aabb = m_nodes[leaf].m_aabb;
+
+		// Find the best sibling by descending the hierarchy based on the
+		// surface area heuristic.
+		auto sibling = m_root;
+		while (!m_nodes[sibling].IsLeaf()) {
+			const auto& node = m_nodes[sibling];
+
+			const auto area          = SurfaceArea(node.m_aabb);
+			const auto combined_area = SurfaceArea(AABB::Union(node.m_aabb,
+															   leaf_aabb));
+
+			// The cost of creating a new parent for this node and the leaf.
+			const auto cost = 2.0f * combined_area;
+			// The minimum cost of pushing the leaf further down.
+			const auto inheritance_cost = 2.0f * (combined_area - area);
+
+			F32 child_costs[2];
+			for (std::size_t i = 0u; i < 2u; ++i) {
+				const auto& child = m_nodes[node.m_children[i]];
+				const auto child_area = SurfaceArea(AABB::Union(child.m_aabb,
+																leaf_aabb));
+				child_costs[i] = child.IsLeaf()
+					? child_area + inheritance_cost
+					: child_area - SurfaceArea(child.m_aabb) + inheritance_cost;
+			}
+
+			if (cost < child_costs[0] && cost < child_costs[1]) {
+				break;
+			}
+
+			sibling = node.m_children[(child_costs[0] < child_costs[1]) ? 0u : 1u];
+		}
+
+		// Create a new parent for the sibling and the leaf.
+		const auto old_parent = m_nodes[sibling].m_parent;
+		const auto new_parent = AllocateNode();
+		{
+			auto& node = m_nodes[new_parent];
+			node.m_parent      = old_parent;
+			node.m_aabb        = AABB::Union(m_nodes[sibling].m_aabb, leaf_aabb);
+			node.m_children[0] = sibling;
+			node.m_children[1] = leaf;
+			node.m_height      = m_nodes[sibling].m_height + 1;
+		}
+
+		if (s_null_node == old_parent) {
+			m_root = new_parent;
+		}
+		else {
+			auto& children = m_nodes[old_parent].m_children;
+			children[(sibling == children[0]) ? 0u : 1u] = new_parent;
+		}
+
+		m_nodes[sibling].m_parent = new_parent;
+		m_nodes[leaf].m_parent    = new_parent;
+
+		RefitAncestors(old_parent);
+	}
+
+	void DynamicAABBTree::RemoveLeaf(U32 leaf) noexcept {
+		if (leaf == m_root) {
+			m_root = s_null_node;
+			return;
+		}
+
+		const auto  parent      = m_nodes[leaf].m_parent;
+		const auto  grandparent = m_nodes[parent].m_parent;
+		const auto& children    = m_nodes[parent].m_children;
+		const auto  sibling     = (leaf == children[0]) ? children[1] : children[0];
+
+		// Replace the parent with the sibling.
+		if (s_null_node == grandparent) {
+			m_root = sibling;
+		}
+		else {
+			auto& grandchildren = m_nodes[grandparent].m_children;
+			grandchildren[(parent == grandchildren[0]) ? 0u : 1u] = sibling;
+		}
+
+		m_nodes[sibling].m_parent = grandparent;
+		m_nodes[leaf].m_parent    = s_null_node;
+		FreeNode(parent);
+
+		RefitAncestors(grandparent);
+	}
+
+	void DynamicAABBTree::RefitAncestors(U32 node) noexcept {
+		while (s_null_node != node) {
+			auto& current = m_nodes[node];
+			const auto& child0 = m_nodes[current.m_children[0]];
+			const auto& child1 = m_nodes[current.m_children[1]];
+
+			current.m_aabb   = AABB::Union(child0.m_aabb, child1.m_aabb);
+			current.m_height = 1 + std::max(child0.m_height, child1.m_height);
+
+			node = current.m_parent;
+		}
+	}
+
+	U32 DynamicAABBTree::BuildSubtree(U32* leaves,
+									  std::size_t nb_leaves) {
+		if (1u == nb_leaves) {
+			return leaves[0];
+		}
+
+		// Compute the bounds of the centroids of the leaf nodes.
+		AABB centroid_bounds;
+		for (std::size_t i = 0u; i < nb_leaves; ++i) {
+			centroid_bounds = AABB::Union(centroid_bounds,
+										  m_nodes[leaves[i]].m_aabb.Centroid());
+		}
+
+		const auto bounds_min    = centroid_bounds.MinPoint();
+		const auto bounds_extent = centroid_bounds.Diagonal();
+
+		const auto GetBin = [&](U32 leaf, U32 axis) noexcept {
+			const auto c   = XMVectorGetByIndex(m_nodes[leaf].m_aabb.Centroid(), axis);
+			const auto min = XMVectorGetByIndex(bounds_min, axis);
+			const auto ext = XMVectorGetByIndex(bounds_extent, axis);
+			const auto bin = static_cast< std::size_t >(
+				g_nb_sah_bins * (c - min) / ext);
+			return std::min(bin, g_nb_sah_bins - 1u);
+		};
+
+		// Find the cheapest split according to the binned surface area
+		// heuristic.
+		auto best_cost = std::numeric_limits< F32 >::max();
+		U32 best_axis  = 0u;
+		std::size_t best_bin = g_nb_sah_bins;
+		for (U32 axis = 0u; axis < 3u; ++axis) {
+			if (XMVectorGetByIndex(bounds_extent, axis) <= 0.0f) {
+				continue;
+			}
+
+			AABB bin_aabbs[g_nb_sah_bins];
+			std::size_t bin_counts[g_nb_sah_bins] = {};
+			for (std::size_t i = 0u; i < nb_leaves; ++i) {
+				const auto bin = GetBin(leaves[i], axis);
+				bin_aabbs[bin] = AABB::Union(bin_aabbs[bin],
+											 m_nodes[leaves[i]].m_aabb);
+				++bin_counts[bin];
+			}
+
+			// Sweep from the right to accumulate the right costs.
+			F32 right_costs[g_nb_sah_bins];
+			{
+				AABB aabb;
+				std::size_t count = 0u;
+				for (auto bin = g_nb_sah_bins - 1u; 0u < bin; --bin) {
+					aabb   = AABB::Union(aabb, bin_aabbs[bin]);
+					count += bin_counts[bin];
+					right_costs[bin] = (0u == count)
+						? 0.0f : count * SurfaceArea(aabb);
+				}
+			}
+
+			// Sweep from the left and evaluate each split.
+			AABB aabb;
+			std::size_t count = 0u;
+			for (std::size_t bin = 0u; bin + 1u < g_nb_sah_bins; ++bin) {
+				aabb   = AABB::Union(aabb, bin_aabbs[bin]);
+				count += bin_counts[bin];
+				if (0u == count || nb_leaves == count) {
+					continue;
+				}
+
+				const auto cost = count * SurfaceArea(aabb)
+					            + right_costs[bin + 1u];
+				if (cost < best_cost) {
+					best_cost = cost;
+					best_axis = axis;
+					best_bin  = bin;
+				}
+			}
+		}
+
+		// Partition the leaf nodes (in halves if all centroids coincide).
+		auto nb_left_leaves = nb_leaves / 2u;
+		if (g_nb_sah_bins != best_bin) {
+			const auto middle = std::partition(leaves, leaves + nb_leaves,
+				[&](U32 leaf) noexcept {
+					return GetBin(leaf, best_axis) <= best_bin;
+				});
+			nb_left_leaves = static_cast< std::size_t >(middle - leaves);
+		}
+
+		const auto node  = AllocateNode();
+		const auto left  = BuildSubtree(leaves, nb_left_leaves);
+		const auto right = BuildSubtree(leaves + nb_left_leaves,
+										nb_leaves - nb_left_leaves);
+
+		m_nodes[left].m_parent  = node;
+		m_nodes[right].m_parent = node;
+
+		auto& current = m_nodes[node];
+		current.m_children[0] = left;
+		current.m_children[1] = right;
+		current.m_aabb        = AABB::Union(m_nodes[left].m_aabb,
+											m_nodes[right].m_aabb);
+		current.m_height      = 1 + std::max(m_nodes[left].m_height,
+											 m_nodes[right].m_height);
+
+		return node;
+	}
+}
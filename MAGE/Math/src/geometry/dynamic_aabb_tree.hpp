@@ -0,0 +1,444 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/ray.hpp"
+#include "collection/vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	#pragma warning( push )
+	#pragma warning( disable : 4324 ) // Added padding.
+
+	/**
+	 A class of dynamic AABB trees.
+
+	 A dynamic AABB tree is a bounding volume hierarchy whose leaves each
+	 contain one proxy: a (fattened) AABB and user data. Proxies can be
+	 inserted, removed and moved incrementally. Moving a proxy within its
+	 fattened AABB is free. Otherwise, the proxy is either reinserted
+	 (@c Move) or its ancestors are refitted without changing the topology
+	 (@c Refit). The complete tree can be rebuilt top-down with the
+	 surface area heuristic (SAH) at any time (@c Build).
+
+	 Queries descend the hierarchy, skip subtrees outside the query volume
+	 and report complete subtrees inside the query volume without testing
+	 their descendants.
+	 */
+	class DynamicAABBTree {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The index of the null node/proxy.
+		 */
+		static constexpr U32 s_null_node = std::numeric_limits< U32 >::max();
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a dynamic AABB tree.
+
+		 @param[in]		margin
+						The margin by which the AABBs of the proxies are
+						fattened in each direction.
+		 */
+		explicit DynamicAABBTree(F32 margin = 0.1f);
+
+		/**
+		 Constructs a dynamic AABB tree from the given dynamic AABB tree.
+
+		 @param[in]		tree
+						A reference to the dynamic AABB tree to copy.
+		 */
+		DynamicAABBTree(const DynamicAABBTree& tree);
+
+		/**
+		 Constructs a dynamic AABB tree by moving the given dynamic AABB tree.
+
+		 @param[in]		tree
+						A reference to the dynamic AABB tree to move.
+		 */
+		DynamicAABBTree(DynamicAABBTree&& tree) noexcept;
+
+		/**
+		 Destructs this dynamic AABB tree.
+		 */
+		~DynamicAABBTree();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given dynamic AABB tree to this dynamic AABB tree.
+
+		 @param[in]		tree
+						A reference to the dynamic AABB tree to copy.
+		 @return		A reference to the copy of the given dynamic AABB tree
+						(i.e. this dynamic AABB tree).
+		 */
+		DynamicAABBTree& operator=(const DynamicAABBTree& tree);
+
+		/**
+		 Moves the given dynamic AABB tree to this dynamic AABB tree.
+
+		 @param[in]		tree
+						A reference to the dynamic AABB tree to move.
+		 @return		A reference to the moved dynamic AABB tree (i.e. this
+						dynamic AABB tree).
+		 */
+		DynamicAABBTree& operator=(DynamicAABBTree&& tree) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Proxies
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this dynamic AABB tree is empty.
+
+		 @return		@c true if this dynamic AABB tree contains no proxies.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return 0u == m_nb_proxies;
+		}
+
+		/**
+		 Returns the number of proxies of this dynamic AABB tree.
+
+		 @return		The number of proxies of this dynamic AABB tree.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_nb_proxies;
+		}
+
+		/**
+		 Inserts a proxy with the given AABB and user data.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @param[in]		data
+						The user data.
+		 @return		The proxy.
+		 */
+		U32 Insert(const AABB& aabb, U32 data);
+
+		/**
+		 Removes the given proxy.
+
+		 @pre			@a proxy is a proxy of this dynamic AABB tree.
+		 @param[in]		proxy
+						The proxy.
+		 */
+		void Remove(U32 proxy) noexcept;
+
+		/**
+		 Moves the given proxy to the given AABB. The proxy is reinserted if
+		 its fattened AABB does not enclose the given AABB.
+
+		 @pre			@a proxy is a proxy of this dynamic AABB tree.
+		 @param[in]		proxy
+						The proxy.
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @return		@c true if the proxy is reinserted. @c false
+						otherwise.
+		 */
+		bool Move(U32 proxy, const AABB& aabb) noexcept;
+
+		/**
+		 Refits the given proxy to the given AABB. If the fattened AABB of the
+		 proxy does not enclose the given AABB, the proxy is fattened again
+		 and the AABBs of its ancestors are recomputed (the topology of this
+		 dynamic AABB tree is not changed).
+
+		 @pre			@a proxy is a proxy of this dynamic AABB tree.
+		 @param[in]		proxy
+						The proxy.
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @return		@c true if the proxy is refitted. @c false otherwise.
+		 */
+		bool Refit(U32 proxy, const AABB& aabb) noexcept;
+
+		/**
+		 Rebuilds this dynamic AABB tree top-down with the surface area
+		 heuristic. The proxies are preserved.
+		 */
+		void Build();
+
+		/**
+		 Removes all proxies of this dynamic AABB tree.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Returns the (fattened) AABB of the given proxy.
+
+		 @pre			@a proxy is a proxy of this dynamic AABB tree.
+		 @param[in]		proxy
+						The proxy.
+		 @return		A reference to the (fattened) AABB of the given proxy.
+		 */
+		[[nodiscard]]
+		const AABB& GetAABB(U32 proxy) const noexcept {
+			return m_nodes[proxy].m_aabb;
+		}
+
+		/**
+		 Returns the user data of the given proxy.
+
+		 @pre			@a proxy is a proxy of this dynamic AABB tree.
+		 @param[in]		proxy
+						The proxy.
+		 @return		The user data of the given proxy.
+		 */
+		[[nodiscard]]
+		U32 GetData(U32 proxy) const noexcept {
+			return m_nodes[proxy].m_data;
+		}
+
+		/**
+		 Returns the cost of this dynamic AABB tree according to the surface
+		 area heuristic (i.e. the summed surface area of all internal nodes
+		 relative to the surface area of the root node).
+
+		 @return		The cost of this dynamic AABB tree.
+		 */
+		[[nodiscard]]
+		F32 GetCost() const noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Queries
+		//---------------------------------------------------------------------
+
+		/**
+		 Calls the given action for the user data of each proxy whose AABB
+		 overlaps the given bounding volume.
+
+		 @tparam		BoundingVolumeT
+						The bounding volume type (@c AABB, @c BoundingSphere or
+						@c BoundingFrustum).
+		 @tparam		ActionT
+						An action to perform on the user data of each
+						overlapping proxy. This action must accept a @c U32
+						argument.
+		 @param[in]		volume
+						A reference to the bounding volume.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename BoundingVolumeT, typename ActionT >
+		void Query(const BoundingVolumeT& volume, ActionT&& action) const;
+
+		/**
+		 Calls the given action for the user data of each proxy whose AABB is
+		 intersected by the given ray, in approximate front-to-back order.
+
+		 @tparam		ActionT
+						An action to perform on the user data of each
+						intersected proxy. This action must accept a @c U32
+						argument and the current maximum distance as @c F32
+						argument, and must return the new maximum distance
+						(e.g., the distance to a found intersection). A
+						non-positive maximum distance terminates the query.
+		 @param[in]		origin
+						The origin of the ray.
+		 @param[in]		direction
+						The (normalized) direction of the ray.
+		 @param[in]		max_distance
+						The maximum distance along the ray.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename ActionT >
+		void XM_CALLCONV RayCast(FXMVECTOR origin,
+								 FXMVECTOR direction,
+								 F32 max_distance,
+								 ActionT&& action) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of nodes of dynamic AABB trees.
+		 */
+		struct alignas(16) Node {
+
+		public:
+
+			/**
+			 Checks whether this node is a leaf node.
+
+			 @return		@c true if this node is a leaf node. @c false
+							otherwise.
+			 */
+			[[nodiscard]]
+			bool IsLeaf() const noexcept {
+				return s_null_node == m_children[0];
+			}
+
+			/**
+			 The (fattened) AABB of this node.
+			 */
+			AABB m_aabb;
+
+			/**
+			 The index of the parent node of this node (or of the next free
+			 node if this node is free).
+			 */
+			U32 m_parent;
+
+			/**
+			 The indices of the child nodes of this node.
+			 */
+			U32 m_children[2];
+
+			/**
+			 The user data of this node (leaf nodes only).
+			 */
+			U32 m_data;
+
+			/**
+			 The height of this node (0 for leaf nodes, -1 for free nodes).
+			 */
+			S32 m_height;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Allocates a node.
+
+		 @return		The index of the allocated node.
+		 */
+		U32 AllocateNode();
+
+		/**
+		 Frees the given node.
+
+		 @param[in]		node
+						The index of the node.
+		 */
+		void FreeNode(U32 node) noexcept;
+
+		/**
+		 Inserts the given leaf node in the hierarchy.
+
+		 @param[in]		leaf
+						The index of the leaf node.
+		 */
+		void InsertLeaf(U32 leaf);
+
+		/**
+		 Removes the given leaf node from the hierarchy.
+
+		 @param[in]		leaf
+						The index of the leaf node.
+		 */
+		void RemoveLeaf(U32 leaf) noexcept;
+
+		/**
+		 Recomputes the AABBs and heights of the given node and its
+		 ancestors.
+
+		 @param[in]		node
+						The index of the node.
+		 */
+		void RefitAncestors(U32 node) noexcept;
+
+		/**
+		 Builds a subtree top-down with the surface area heuristic.
+
+		 @param[in]		leaves
+						A pointer to the indices of the leaf nodes of the
+						subtree.
+		 @param[in]		nb_leaves
+						The number of leaf nodes of the subtree.
+		 @return		The index of the root node of the subtree.
+		 */
+		U32 BuildSubtree(U32* leaves, std::size_t nb_leaves);
+
+		/**
+		 Calls the given action for the user data of each leaf node of the
+		 subtree of the given node.
+
+		 @tparam		ActionT
+						An action to perform on the user data of each leaf
+						node. This action must accept a @c U32 argument.
+		 @param[in]		node
+						The index of the node.
+		 @param[in]		stack
+						A reference to the traversal stack.
+		 @param[in]		action
+						A reference to the action.
+		 */
+		template< typename ActionT >
+		void ReportSubtree(U32 node,
+						   std::vector< U32 >& stack,
+						   ActionT& action) const;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The nodes of this dynamic AABB tree.
+		 */
+		AlignedVector< Node > m_nodes;
+
+		/**
+		 The index of the root node of this dynamic AABB tree.
+		 */
+		U32 m_root;
+
+		/**
+		 The index of the first free node of this dynamic AABB tree.
+		 */
+		U32 m_free_list;
+
+		/**
+		 The number of proxies of this dynamic AABB tree.
+		 */
+		std::size_t m_nb_proxies;
+
+		/**
+		 The margin by which the AABBs of the proxies of this dynamic AABB
+		 tree are fattened in each direction.
+		 */
+		F32 m_margin;
+	};
+
+	#pragma warning( pop )
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/dynamic_aabb_tree.tpp"
+
+#pragma endregion
@@ -0,0 +1,171 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace details {
+
+		[[nodiscard]]
+		inline bool Overlaps(const AABB& volume, const AABB& aabb) noexcept {
+			return volume.Overlaps(aabb);
+		}
+
+		[[nodiscard]]
+		inline bool Overlaps(const BoundingSphere& volume,
+							 const AABB& aabb) noexcept {
+			return aabb.Overlaps(volume);
+		}
+
+		[[nodiscard]]
+		inline bool Overlaps(const BoundingFrustum& volume,
+							 const AABB& aabb) noexcept {
+			return volume.Overlaps(aabb);
+		}
+
+		template< typename BoundingVolumeT >
+		[[nodiscard]]
+		inline bool Encloses(const BoundingVolumeT& volume,
+							 const AABB& aabb) noexcept {
+			return volume.Encloses(aabb);
+		}
+	}
+
+	template< typename BoundingVolumeT, typename ActionT >
+	void DynamicAABBTree::Query(const BoundingVolumeT& volume,
+								ActionT&& action) const {
+
+		if (s_null_node == m_root) {
+			return;
+		}
+
+		std::vector< U32 > stack;
+		stack.reserve(64u);
+		stack.push_back(m_root);
+
+		while (!stack.empty()) {
+			const auto index = stack.back();
+			stack.pop_back();
+
+			const auto& node = m_nodes[index];
+			if (!details::Overlaps(volume, node.m_aabb)) {
+				continue;
+			}
+
+			if (node.IsLeaf()) {
+				action(node.m_data);
+			}
+			else if (details::Encloses(volume, node.m_aabb)) {
+				// Report the complete subtree without further tests.
+				ReportSubtree(index, stack, action);
+			}
+			else {
+				stack.push_back(node.m_children[1]);
+				stack.push_back(node.m_children[0]);
+			}
+		}
+	}
+
+	template< typename ActionT >
+	void XM_CALLCONV DynamicAABBTree::RayCast(FXMVECTOR origin,
+											  FXMVECTOR direction,
+											  F32 max_distance,
+											  ActionT&& action) const {
+
+		if (s_null_node == m_root) {
+			return;
+		}
+
+		const auto inv_direction = XMVectorReciprocal(direction);
+
+		const auto [root_hit, root_distance]
+			= IntersectRay(m_nodes[m_root].m_aabb, origin,
+						   inv_direction, max_distance);
+		if (!root_hit) {
+			return;
+		}
+
+		std::vector< std::pair< U32, F32 > > stack;
+		stack.reserve(64u);
+		stack.emplace_back(m_root, root_distance);
+
+		while (!stack.empty()) {
+			const auto [index, distance] = stack.back();
+			stack.pop_back();
+
+			// The maximum distance may have decreased since the node was
+			// pushed.
+			if (max_distance < distance) {
+				continue;
+			}
+
+			const auto& node = m_nodes[index];
+			if (node.IsLeaf()) {
+				max_distance = action(node.m_data, max_distance);
+				if (max_distance <= 0.0f) {
+					return;
+				}
+				continue;
+			}
+
+			const auto [hit0, distance0]
+				= IntersectRay(m_nodes[node.m_children[0]].m_aabb,
+							   origin, inv_direction, max_distance);
+			const auto [hit1, distance1]
+				= IntersectRay(m_nodes[node.m_children[1]].m_aabb,
+							   origin, inv_direction, max_distance);
+
+			// Push the farthest child first to visit the nearest child first.
+			if (distance1 < distance0) {
+				if (hit0) {
+					stack.emplace_back(node.m_children[0], distance0);
+				}
+				if (hit1) {
+					stack.emplace_back(node.m_children[1], distance1);
+				}
+			}
+			else {
+				if (hit1) {
+					stack.emplace_back(node.m_children[1], distance1);
+				}
+				if (hit0) {
+					stack.emplace_back(node.m_children[0], distance0);
+				}
+			}
+		}
+	}
+
+	template< typename ActionT >
+	void DynamicAABBTree::ReportSubtree(U32 node,
+										std::vector< U32 >& stack,
+										ActionT& action) const {
+
+		const auto base = stack.size();
+		stack.push_back(node);
+
+		while (base != stack.size()) {
+			const auto index = stack.back();
+			stack.pop_back();
+
+			const auto& current = m_nodes[index];
+			if (current.IsLeaf()) {
+				action(current.m_data);
+			}
+			else {
+				stack.push_back(current.m_children[1]);
+				stack.push_back(current.m_children[0]);
+			}
+		}
+	}
+}
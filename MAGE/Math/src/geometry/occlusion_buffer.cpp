@@ -0,0 +1,612 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/occlusion_buffer.hpp"
+#include "logging/logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <immintrin.h>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The extent of the guard band (in normalized device coordinates)
+		 against which occluder triangles are clipped. The guard band bounds
+		 the pixel coordinates of the set up triangles, and thus the
+		 precision of their edge functions.
+		 */
+		constexpr F32 g_guard_band = 2.0f;
+
+		/**
+		 The relative depth bias of occludees. An occludee is only occluded
+		 by depths which are nearer than its (biased) nearest depth, which
+		 prevents surfaces coinciding with a face of their AABB from
+		 occluding themselves.
+		 */
+		constexpr F32 g_occludee_depth_bias = 1.0e-5f;
+
+		/**
+		 The minimum (absolute) doubled area (in pixels) of set up triangles.
+		 */
+		constexpr F32 g_min_triangle_area = 1.0e-6f;
+
+		/**
+		 The number of outcode bits of the view frustum planes (left, right,
+		 bottom, top, near, far). A triangle is rejected if all its vertices
+		 lie outside the same view frustum plane.
+		 */
+		constexpr U32 g_frustum_outcode_mask = 0x3Fu;
+
+		/**
+		 The number of clipping planes (near, guard band left, right,
+		 bottom, top).
+		 */
+		constexpr std::size_t g_nb_clipping_planes = 5u;
+
+		/**
+		 The maximum number of vertices of a triangle clipped against all
+		 clipping planes.
+		 */
+		constexpr std::size_t g_max_nb_clipped_vertices
+			= 3u + g_nb_clipping_planes;
+
+		/**
+		 Computes the outcode of the given vertex.
+
+		 The first six bits mark the view frustum planes (left, right,
+		 bottom, top, near, far) and the next five bits mark the clipping
+		 planes (near, guard band left, right, bottom, top) the vertex lies
+		 outside of.
+
+		 @param[in]		v
+						The vertex (x, y, z, w) in projection space (with an
+						inverted depth).
+		 @return		The outcode of the given vertex.
+		 */
+		[[nodiscard]]
+		inline U32 XM_CALLCONV ComputeOutcode(FXMVECTOR v) noexcept {
+			const auto p = XMStore< F32x4 >(v);
+
+			const auto w = p[3];
+			const auto g = g_guard_band * w;
+			return ((p[0] < -w)   ? 0x001u : 0u)
+				 | ((p[0] >  w)   ? 0x002u : 0u)
+				 | ((p[1] < -w)   ? 0x004u : 0u)
+				 | ((p[1] >  w)   ? 0x008u : 0u)
+				 | ((p[2] >  w)   ? 0x010u : 0u)
+				 | ((p[2] < 0.0f) ? 0x020u : 0u)
+				 | ((p[2] >  w)   ? 0x040u : 0u)
+				 | ((p[0] < -g)   ? 0x080u : 0u)
+				 | ((p[0] >  g)   ? 0x100u : 0u)
+				 | ((p[1] < -g)   ? 0x200u : 0u)
+				 | ((p[1] >  g)   ? 0x400u : 0u);
+		}
+
+		/**
+		 Returns the given clipping plane.
+
+		 @param[in]		index
+						The index of the clipping plane (near, guard band
+						left, right, bottom, top).
+		 @return		The clipping plane (which is non-negative inside).
+		 */
+		[[nodiscard]]
+		inline const XMVECTOR XM_CALLCONV
+			GetClippingPlane(std::size_t index) noexcept {
+
+			switch (index) {
+			case 0u:  return XMVectorSet( 0.0f,  0.0f, -1.0f, 1.0f);
+			case 1u:  return XMVectorSet( 1.0f,  0.0f,  0.0f, g_guard_band);
+			case 2u:  return XMVectorSet(-1.0f,  0.0f,  0.0f, g_guard_band);
+			case 3u:  return XMVectorSet( 0.0f,  1.0f,  0.0f, g_guard_band);
+			default:  return XMVectorSet( 0.0f, -1.0f,  0.0f, g_guard_band);
+			}
+		}
+
+		/**
+		 Clips the given convex polygon against the given plane.
+
+		 @param[in]		input
+						A pointer to the vertices of the polygon.
+		 @param[in]		nb_input
+						The number of vertices of the polygon.
+		 @param[out]	output
+						A pointer to the vertices of the clipped polygon
+						(which must have room for @a nb_input + 1 vertices).
+		 @param[in]		plane
+						The plane (which is non-negative inside).
+		 @return		The number of vertices of the clipped polygon.
+		 */
+		std::size_t XM_CALLCONV ClipPolygon(const XMVECTOR* input,
+											std::size_t nb_input,
+											XMVECTOR* output,
+											FXMVECTOR plane) noexcept {
+			std::size_t nb_output = 0u;
+			for (std::size_t i = 0u; i < nb_input; ++i) {
+				const auto current = input[i];
+				const auto next    = input[(i + 1u) % nb_input];
+				const auto d_current = XMVectorGetX(XMVector4Dot(current, plane));
+				const auto d_next    = XMVectorGetX(XMVector4Dot(next,    plane));
+
+				if (0.0f <= d_current) {
+					output[nb_output++] = current;
+				}
+				if ((0.0f <= d_current) != (0.0f <= d_next)) {
+					const auto t = d_current / (d_current - d_next);
+					output[nb_output++] = XMVectorLerp(current, next, t);
+				}
+			}
+
+			return nb_output;
+		}
+
+		/**
+		 Returns the minimum of the lanes of the given vector.
+
+		 @param[in]		v
+						The vector.
+		 @return		The minimum of the lanes of the given vector.
+		 */
+		[[nodiscard]]
+		inline F32 HorizontalMin(__m128 v) noexcept {
+			v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+			v = _mm_min_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+			return _mm_cvtss_f32(v);
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// OccluderMesh
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	OccluderMesh::OccluderMesh() noexcept
+		: m_positions(),
+		m_indices() {}
+
+	OccluderMesh::OccluderMesh(std::vector< F32x3 > positions,
+							   std::vector< U32 > indices) noexcept
+		: m_positions(std::move(positions)),
+		m_indices(std::move(indices)) {
+
+		Assert(0u == m_indices.size() % 3u);
+	}
+
+	OccluderMesh::OccluderMesh(const OccluderMesh& mesh) = default;
+
+	OccluderMesh::OccluderMesh(OccluderMesh&& mesh) noexcept = default;
+
+	OccluderMesh::~OccluderMesh() = default;
+
+	OccluderMesh& OccluderMesh::operator=(const OccluderMesh& mesh) = default;
+
+	OccluderMesh& OccluderMesh::operator=(OccluderMesh&& mesh) noexcept = default;
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// OcclusionBuffer
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	OcclusionBuffer::OcclusionBuffer() noexcept
+		: m_width(0u),
+		m_height(0u),
+		m_nb_tiles(0u, 0u),
+		m_depths(),
+		m_tile_depths(),
+		m_triangles(),
+		m_vertices(),
+		m_outcodes() {}
+
+	OcclusionBuffer::OcclusionBuffer(U32 width, U32 height)
+		: OcclusionBuffer() {
+
+		Resize(width, height);
+	}
+
+	OcclusionBuffer::OcclusionBuffer(const OcclusionBuffer& buffer) = default;
+
+	OcclusionBuffer::OcclusionBuffer(OcclusionBuffer&& buffer) noexcept = default;
+
+	OcclusionBuffer::~OcclusionBuffer() = default;
+
+	OcclusionBuffer& OcclusionBuffer
+		::operator=(const OcclusionBuffer& buffer) = default;
+
+	OcclusionBuffer& OcclusionBuffer
+		::operator=(OcclusionBuffer&& buffer) noexcept = default;
+
+	void OcclusionBuffer::Resize(U32 width, U32 height) {
+		m_nb_tiles = U32x2((width  + s_tile_width  - 1u) / s_tile_width,
+						   (height + s_tile_height - 1u) / s_tile_height);
+		m_width    = m_nb_tiles[0] * s_tile_width;
+		m_height   = m_nb_tiles[1] * s_tile_height;
+
+		const std::size_t nb_tiles = std::size_t(m_nb_tiles[0]) * m_nb_tiles[1];
+		m_depths.resize(nb_tiles * (s_tile_width / 4u) * s_tile_height);
+		m_tile_depths.resize(nb_tiles);
+
+		Clear();
+	}
+
+	void OcclusionBuffer::Clear() noexcept {
+		std::fill(m_depths.begin(), m_depths.end(), XMVectorZero());
+		std::fill(m_tile_depths.begin(), m_tile_depths.end(), 0.0f);
+		m_triangles.clear();
+	}
+
+	void XM_CALLCONV OcclusionBuffer::AddOccluder(FXMMATRIX object_to_projection,
+												  const OccluderMesh& mesh) {
+		if (0u == m_width || mesh.empty()) {
+			return;
+		}
+
+		// Transform the vertices and compute their outcodes.
+		const auto positions = mesh.GetPositions();
+		m_vertices.clear();
+		m_outcodes.clear();
+		for (const auto& position : positions) {
+			const auto v = XMVector3Transform(XMLoad(position),
+											  object_to_projection);
+			m_vertices.push_back(v);
+			m_outcodes.push_back(ComputeOutcode(v));
+		}
+
+		const auto indices = mesh.GetIndices();
+		const auto nb_indices = static_cast< std::size_t >(indices.size());
+		for (std::size_t i = 0u; i < nb_indices; i += 3u) {
+			const auto i0 = static_cast< std::size_t >(indices[i]);
+			const auto i1 = static_cast< std::size_t >(indices[i + 1u]);
+			const auto i2 = static_cast< std::size_t >(indices[i + 2u]);
+
+			const auto c0 = m_outcodes[i0];
+			const auto c1 = m_outcodes[i1];
+			const auto c2 = m_outcodes[i2];
+
+			// Reject triangles outside a view frustum plane.
+			if (c0 & c1 & c2 & g_frustum_outcode_mask) {
+				continue;
+			}
+
+			const auto clip = (c0 | c1 | c2) >> 6u;
+			if (0u == clip) {
+				AddTriangle(m_vertices[i0], m_vertices[i1], m_vertices[i2]);
+				continue;
+			}
+
+			// Clip the triangle against the near plane and the guard band.
+			XMVECTOR polygons[2][g_max_nb_clipped_vertices] = {
+				{ m_vertices[i0], m_vertices[i1], m_vertices[i2] }
+			};
+			std::size_t nb_vertices = 3u;
+			std::size_t current     = 0u;
+			for (std::size_t j = 0u; j < g_nb_clipping_planes && 3u <= nb_vertices; ++j) {
+				if (clip & (1u << j)) {
+					nb_vertices = ClipPolygon(polygons[current], nb_vertices,
+											  polygons[1u - current],
+											  GetClippingPlane(j));
+					current = 1u - current;
+				}
+			}
+
+			// Triangulate the clipped (convex) polygon.
+			const auto& polygon = polygons[current];
+			for (std::size_t j = 2u; j < nb_vertices; ++j) {
+				AddTriangle(polygon[0], polygon[j - 1u], polygon[j]);
+			}
+		}
+	}
+
+	void XM_CALLCONV OcclusionBuffer::AddTriangle(FXMVECTOR v0,
+												  FXMVECTOR v1,
+												  FXMVECTOR v2) {
+		const XMVECTOR vertices[] = { v0, v1, v2 };
+
+		F32 x[3];
+		F32 y[3];
+		F32 d[3];
+		const auto width  = static_cast< F32 >(m_width);
+		const auto height = static_cast< F32 >(m_height);
+		for (std::size_t i = 0u; i < 3u; ++i) {
+			const auto p = XMStore< F32x4 >(vertices[i]);
+			if (p[3] <= 0.0f) {
+				return;
+			}
+
+			const auto inv_w = 1.0f / p[3];
+			x[i] = ( p[0] * inv_w * 0.5f + 0.5f) * width;
+			y[i] = (-p[1] * inv_w * 0.5f + 0.5f) * height;
+			d[i] = p[2] * inv_w;
+		}
+
+		// Determine the covered pixel centers.
+		const auto min_x = std::max(std::min(x[0], std::min(x[1], x[2])), 0.0f);
+		const auto max_x = std::min(std::max(x[0], std::max(x[1], x[2])), width);
+		const auto min_y = std::max(std::min(y[0], std::min(y[1], y[2])), 0.0f);
+		const auto max_y = std::min(std::max(y[0], std::max(y[1], y[2])), height);
+		const auto first_column = std::ceil(min_x - 0.5f);
+		const auto last_column  = std::floor(max_x - 0.5f);
+		const auto first_row    = std::ceil(min_y - 0.5f);
+		const auto last_row     = std::floor(max_y - 0.5f);
+		if (last_column < first_column || last_row < first_row) {
+			return;
+		}
+
+		// The doubled signed area of the triangle.
+		const auto area = (x[1] - x[0]) * (y[2] - y[0])
+			            - (x[2] - x[0]) * (y[1] - y[0]);
+		if (std::abs(area) <= g_min_triangle_area) {
+			return;
+		}
+
+		Triangle triangle;
+
+		// Set up the edge functions (positive inside the triangle).
+		const auto sign = (0.0f < area) ? 1.0f : -1.0f;
+		for (std::size_t i = 0u; i < 3u; ++i) {
+			const auto j = (i + 1u) % 3u;
+			const auto k = (i + 2u) % 3u;
+			auto& edge = triangle.m_edges[i];
+			edge[0] = sign * (y[j] - y[k]);
+			edge[1] = sign * (x[k] - x[j]);
+			edge[2] = sign * (x[j] * y[k] - x[k] * y[j]);
+		}
+
+		// Set up the depth plane (barycentric interpolation).
+		const auto inv_area = 1.0f / std::abs(area);
+		for (std::size_t c = 0u; c < 3u; ++c) {
+			triangle.m_depth[c] = (triangle.m_edges[0][c] * d[0]
+				                 + triangle.m_edges[1][c] * d[1]
+				                 + triangle.m_edges[2][c] * d[2]) * inv_area;
+		}
+
+		triangle.m_min_depth  = std::min(d[0], std::min(d[1], d[2]));
+		triangle.m_max_depth  = std::max(d[0], std::max(d[1], d[2]));
+		triangle.m_columns[0] = static_cast< U32 >(first_column);
+		triangle.m_columns[1] = static_cast< U32 >(last_column);
+		triangle.m_rows[0]    = static_cast< U32 >(first_row);
+		triangle.m_rows[1]    = static_cast< U32 >(last_row);
+
+		m_triangles.push_back(triangle);
+	}
+
+	void OcclusionBuffer::Rasterize() noexcept {
+		Rasterize(0u, m_nb_tiles[1]);
+	}
+
+	void OcclusionBuffer::Rasterize(U32 first_tile_row,
+									U32 end_tile_row) noexcept {
+
+		end_tile_row = std::min(end_tile_row, m_nb_tiles[1]);
+
+		for (const auto& triangle : m_triangles) {
+			const auto first_y = std::max(triangle.m_rows[0] / s_tile_height,
+										  first_tile_row);
+			const auto end_y   = std::min(triangle.m_rows[1] / s_tile_height + 1u,
+										  end_tile_row);
+			const auto first_x = triangle.m_columns[0] / s_tile_width;
+			const auto end_x   = triangle.m_columns[1] / s_tile_width + 1u;
+
+			for (auto tile_y = first_y; tile_y < end_y; ++tile_y) {
+				for (auto tile_x = first_x; tile_x < end_x; ++tile_x) {
+					RasterizeTile(triangle, tile_x, tile_y);
+				}
+			}
+		}
+	}
+
+	void OcclusionBuffer::RasterizeTile(const Triangle& triangle,
+										U32 tile_x, U32 tile_y) noexcept {
+
+		const auto tile = std::size_t(tile_y) * m_nb_tiles[0] + tile_x;
+
+		// Reject the triangle if it is not nearer than the farthest pixel of
+		// the tile.
+		if (triangle.m_max_depth <= m_tile_depths[tile]) {
+			return;
+		}
+
+		const auto x = static_cast< F32 >(tile_x * s_tile_width);
+		const auto y = static_cast< F32 >(tile_y * s_tile_height);
+
+		// Reject the tile if it lies outside an edge of the triangle.
+		for (const auto& edge : triangle.m_edges) {
+			const auto corner_x = x + ((0.0f < edge[0]) ? s_tile_width  - 0.5f : 0.5f);
+			const auto corner_y = y + ((0.0f < edge[1]) ? s_tile_height - 0.5f : 0.5f);
+			if (edge[0] * corner_x + edge[1] * corner_y + edge[2] <= 0.0f) {
+				return;
+			}
+		}
+
+		// The pixel centers of the first row of the tile (two vectors).
+		const auto x0 = _mm_add_ps(_mm_set1_ps(x),
+								   _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f));
+		const auto x1 = _mm_add_ps(x0, _mm_set1_ps(4.0f));
+		const auto y0 = _mm_set1_ps(y + 0.5f);
+
+		const auto evaluate = [x0, x1, y0](const F32 (&plane)[3],
+										   __m128& v0, __m128& v1) noexcept {
+			const auto a = _mm_set1_ps(plane[0]);
+			const auto c = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane[1]), y0),
+									  _mm_set1_ps(plane[2]));
+			v0 = _mm_add_ps(_mm_mul_ps(a, x0), c);
+			v1 = _mm_add_ps(_mm_mul_ps(a, x1), c);
+		};
+
+		__m128 e[3][2];
+		__m128 step[3];
+		for (std::size_t i = 0u; i < 3u; ++i) {
+			evaluate(triangle.m_edges[i], e[i][0], e[i][1]);
+			step[i] = _mm_set1_ps(triangle.m_edges[i][1]);
+		}
+
+		__m128 depth[2];
+		evaluate(triangle.m_depth, depth[0], depth[1]);
+		const auto depth_step = _mm_set1_ps(triangle.m_depth[1]);
+		const auto min_depth  = _mm_set1_ps(triangle.m_min_depth);
+		const auto max_depth  = _mm_set1_ps(triangle.m_max_depth);
+		const auto zero       = _mm_setzero_ps();
+
+		auto* const depths = &m_depths[tile * (s_tile_width / 4u) * s_tile_height];
+		auto farthest = _mm_set1_ps(std::numeric_limits< F32 >::max());
+
+		for (U32 row = 0u; row < s_tile_height; ++row) {
+			for (std::size_t half = 0u; half < 2u; ++half) {
+				// The coverage mask of the 4 pixels.
+				const auto mask = _mm_and_ps(_mm_and_ps(
+					_mm_cmpgt_ps(e[0][half], zero),
+					_mm_cmpgt_ps(e[1][half], zero)),
+					_mm_cmpgt_ps(e[2][half], zero));
+
+				// The interpolated depths are clamped to the depths of the
+				// vertices of the triangle.
+				const auto d = _mm_min_ps(_mm_max_ps(depth[half], min_depth),
+										  max_depth);
+
+				auto& pixels = depths[2u * row + half];
+				pixels   = _mm_max_ps(pixels, _mm_and_ps(mask, d));
+				farthest = _mm_min_ps(farthest, pixels);
+
+				for (std::size_t i = 0u; i < 3u; ++i) {
+					e[i][half] = _mm_add_ps(e[i][half], step[i]);
+				}
+				depth[half] = _mm_add_ps(depth[half], depth_step);
+			}
+		}
+
+		m_tile_depths[tile] = HorizontalMin(farthest);
+	}
+
+	[[nodiscard]]
+	bool XM_CALLCONV OcclusionBuffer::IsVisible(FXMMATRIX object_to_projection,
+												const AABB& aabb) const noexcept {
+		if (0u == m_width) {
+			return true;
+		}
+
+		const auto p_min = aabb.MinPoint();
+		const auto p_max = aabb.MaxPoint();
+
+		auto min_x     = std::numeric_limits< F32 >::max();
+		auto max_x     = std::numeric_limits< F32 >::lowest();
+		auto min_y     = std::numeric_limits< F32 >::max();
+		auto max_y     = std::numeric_limits< F32 >::lowest();
+		auto max_depth = std::numeric_limits< F32 >::lowest();
+
+		const auto width  = static_cast< F32 >(m_width);
+		const auto height = static_cast< F32 >(m_height);
+		for (U32 i = 0u; i < 8u; ++i) {
+			const auto control = XMVectorSelectControl(i & 1u, (i >> 1u) & 1u,
+													   (i >> 2u) & 1u, 0u);
+			const auto corner  = XMVectorSelect(p_min, p_max, control);
+			const auto v = XMVector3Transform(corner, object_to_projection);
+
+			const auto p = XMStore< F32x4 >(v);
+
+			// AABBs crossing the near plane are always visible.
+			if (p[3] <= 0.0f || p[3] < p[2]) {
+				return true;
+			}
+
+			const auto inv_w = 1.0f / p[3];
+			const auto sx = ( p[0] * inv_w * 0.5f + 0.5f) * width;
+			const auto sy = (-p[1] * inv_w * 0.5f + 0.5f) * height;
+			min_x     = std::min(min_x, sx);
+			max_x     = std::max(max_x, sx);
+			min_y     = std::min(min_y, sy);
+			max_y     = std::max(max_y, sy);
+			max_depth = std::max(max_depth, p[2] * inv_w);
+		}
+
+		if (max_x < 0.0f || width < min_x || max_y < 0.0f || height < min_y) {
+			return false;
+		}
+
+		// Determine the (partially) covered pixels.
+		const auto first_column = static_cast< U32 >(std::clamp(std::floor(min_x),
+																0.0f, width  - 1.0f));
+		const auto first_row    = static_cast< U32 >(std::clamp(std::floor(min_y),
+																0.0f, height - 1.0f));
+		const auto last_column  = static_cast< U32 >(std::clamp(std::ceil(max_x) - 1.0f,
+																static_cast< F32 >(first_column),
+																width  - 1.0f));
+		const auto last_row     = static_cast< U32 >(std::clamp(std::ceil(max_y) - 1.0f,
+																static_cast< F32 >(first_row),
+																height - 1.0f));
+
+		const auto depth = max_depth * (1.0f + g_occludee_depth_bias);
+		const auto occludee_depth = _mm_set1_ps(depth);
+		const auto column_offsets = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+		const auto min_column     = _mm_set1_ps(static_cast< F32 >(first_column));
+		const auto max_column     = _mm_set1_ps(static_cast< F32 >(last_column));
+
+		for (auto tile_y = first_row / s_tile_height;
+			 tile_y <= last_row / s_tile_height; ++tile_y) {
+			for (auto tile_x = first_column / s_tile_width;
+				 tile_x <= last_column / s_tile_width; ++tile_x) {
+
+				const auto tile = std::size_t(tile_y) * m_nb_tiles[0] + tile_x;
+
+				// Accept tiles of which all pixels are nearer.
+				if (depth < m_tile_depths[tile]) {
+					continue;
+				}
+
+				const auto* const depths
+					= &m_depths[tile * (s_tile_width / 4u) * s_tile_height];
+
+				const auto y        = tile_y * s_tile_height;
+				const auto row_from = std::max(first_row, y) - y;
+				const auto row_to   = std::min(last_row, y + s_tile_height - 1u) - y;
+
+				for (std::size_t half = 0u; half < 2u; ++half) {
+					const auto columns = _mm_add_ps(column_offsets,
+						_mm_set1_ps(static_cast< F32 >(tile_x * s_tile_width + 4u * half)));
+					const auto column_mask = _mm_and_ps(_mm_cmpge_ps(columns, min_column),
+														_mm_cmple_ps(columns, max_column));
+
+					for (auto row = row_from; row <= row_to; ++row) {
+						const auto not_occluded = _mm_and_ps(column_mask,
+							_mm_cmpge_ps(occludee_depth, depths[2u * row + half]));
+						if (_mm_movemask_ps(not_occluded)) {
+							return true;
+						}
+					}
+				}
+			}
+		}
+
+		return false;
+	}
+
+	[[nodiscard]]
+	F32 OcclusionBuffer::GetDepth(U32 x, U32 y) const noexcept {
+		const auto tile  = std::size_t(y / s_tile_height) * m_nb_tiles[0]
+			             + x / s_tile_width;
+		const auto pixel = (y % s_tile_height) * s_tile_width + x % s_tile_width;
+
+		const auto* const depths = reinterpret_cast< const F32* >(m_depths.data());
+		return depths[tile * s_tile_width * s_tile_height + pixel];
+	}
+
+	#pragma endregion
+}
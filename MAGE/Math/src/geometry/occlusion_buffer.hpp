@@ -0,0 +1,585 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/bounding_volume.hpp"
+#include "collection/vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The maximum number of triangles of occluder meshes.
+	 */
+	constexpr std::size_t g_occluder_max_nb_triangles = 2048u;
+
+	/**
+	 The maximum (object space) error of the levels of detail of occluder
+	 meshes relative to the length of the diagonal of the AABB of their
+	 mesh.
+	 */
+	constexpr F32 g_occluder_max_relative_error = 0.01f;
+
+	//-------------------------------------------------------------------------
+	// OccluderMesh
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of occluder meshes.
+
+	 An occluder mesh is a compact (object space) triangle mesh which is
+	 rasterized into occlusion buffers. It only contains vertex positions and
+	 the vertices which are referenced by its triangles.
+	 */
+	class OccluderMesh {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an empty occluder mesh.
+		 */
+		OccluderMesh() noexcept;
+
+		/**
+		 Constructs an occluder mesh for the given triangles.
+
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
+		 @param[in]		vertices
+						A reference to the vertices.
+		 @param[in]		indices
+						A reference to the indices of the triangles.
+		 @param[in]		base_vertex
+						The base vertex which is added to each index before
+						reading a vertex.
+		 */
+		template< typename VertexT, typename IndexT >
+		explicit OccluderMesh(gsl::span< const VertexT > vertices,
+							  gsl::span< const IndexT > indices,
+							  std::size_t base_vertex = 0u);
+
+		/**
+		 Constructs an occluder mesh from the given vertex positions and
+		 indices (e.g., of a previously constructed occluder mesh).
+
+		 @pre			The number of indices is a multiple of three.
+		 @pre			All indices are smaller than the number of vertex
+						positions.
+		 @param[in]		positions
+						The vertex positions.
+		 @param[in]		indices
+						The indices of the triangles.
+		 */
+		explicit OccluderMesh(std::vector< F32x3 > positions,
+							  std::vector< U32 > indices) noexcept;
+
+		/**
+		 Constructs an occluder mesh from the given occluder mesh.
+
+		 @param[in]		mesh
+						A reference to the occluder mesh to copy.
+		 */
+		OccluderMesh(const OccluderMesh& mesh);
+
+		/**
+		 Constructs an occluder mesh by moving the given occluder mesh.
+
+		 @param[in]		mesh
+						A reference to the occluder mesh to move.
+		 */
+		OccluderMesh(OccluderMesh&& mesh) noexcept;
+
+		/**
+		 Destructs this occluder mesh.
+		 */
+		~OccluderMesh();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given occluder mesh to this occluder mesh.
+
+		 @param[in]		mesh
+						A reference to the occluder mesh to copy.
+		 @return		A reference to the copy of the given occluder mesh
+						(i.e. this occluder mesh).
+		 */
+		OccluderMesh& operator=(const OccluderMesh& mesh);
+
+		/**
+		 Moves the given occluder mesh to this occluder mesh.
+
+		 @param[in]		mesh
+						A reference to the occluder mesh to move.
+		 @return		A reference to the moved occluder mesh (i.e. this
+						occluder mesh).
+		 */
+		OccluderMesh& operator=(OccluderMesh&& mesh) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this occluder mesh is empty.
+
+		 @return		@c true if this occluder mesh contains no triangles.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_indices.empty();
+		}
+
+		/**
+		 Returns the number of triangles of this occluder mesh.
+
+		 @return		The number of triangles of this occluder mesh.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfTriangles() const noexcept {
+			return m_indices.size() / 3u;
+		}
+
+		/**
+		 Returns the vertex positions of this occluder mesh.
+
+		 @return		The vertex positions of this occluder mesh.
+		 */
+		[[nodiscard]]
+		gsl::span< const F32x3 > GetPositions() const noexcept {
+			return gsl::make_span(m_positions);
+		}
+
+		/**
+		 Returns the indices of the triangles of this occluder mesh.
+
+		 @return		The indices of the triangles of this occluder mesh.
+		 */
+		[[nodiscard]]
+		gsl::span< const U32 > GetIndices() const noexcept {
+			return gsl::make_span(m_indices);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The vertex positions of this occluder mesh.
+		 */
+		std::vector< F32x3 > m_positions;
+
+		/**
+		 The indices of the triangles of this occluder mesh.
+		 */
+		std::vector< U32 > m_indices;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// OcclusionBuffer
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of (software) occlusion buffers.
+
+	 An occlusion buffer is a low-resolution, hierarchical depth buffer on
+	 the CPU. Occluders are rasterized in two phases: their triangles are
+	 first transformed, clipped against the near plane (and a guard band)
+	 and set up (on a single thread), and are then rasterized per band of tile rows (on
+	 multiple threads). Tiles of 8x4 pixels are rasterized with SSE: the
+	 coverage mask of a triangle is evaluated for 4 pixels at once and only
+	 the covered pixels are updated. Each tile additionally stores the
+	 farthest depth of its pixels, which is used to reject triangles behind
+	 the tile before rasterization and to accept occluded tiles of
+	 occludees before testing their pixels.
+
+	 Depths are expressed as inverted normalized device depths (i.e. 1 at
+	 the near plane and 0 at the far plane) and the buffer is cleared to the
+	 far plane. Projections with a non-inverted depth need to be converted
+	 (i.e. z' = w - z) before use.
+	 */
+	class OcclusionBuffer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The width (in pixels) of the tiles of occlusion buffers.
+		 */
+		static constexpr U32 s_tile_width = 8u;
+
+		/**
+		 The height (in pixels) of the tiles of occlusion buffers.
+		 */
+		static constexpr U32 s_tile_height = 4u;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an empty occlusion buffer.
+		 */
+		OcclusionBuffer() noexcept;
+
+		/**
+		 Constructs an occlusion buffer.
+
+		 @param[in]		width
+						The width (in pixels).
+		 @param[in]		height
+						The height (in pixels).
+		 */
+		explicit OcclusionBuffer(U32 width, U32 height);
+
+		/**
+		 Constructs an occlusion buffer from the given occlusion buffer.
+
+		 @param[in]		buffer
+						A reference to the occlusion buffer to copy.
+		 */
+		OcclusionBuffer(const OcclusionBuffer& buffer);
+
+		/**
+		 Constructs an occlusion buffer by moving the given occlusion buffer.
+
+		 @param[in]		buffer
+						A reference to the occlusion buffer to move.
+		 */
+		OcclusionBuffer(OcclusionBuffer&& buffer) noexcept;
+
+		/**
+		 Destructs this occlusion buffer.
+		 */
+		~OcclusionBuffer();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given occlusion buffer to this occlusion buffer.
+
+		 @param[in]		buffer
+						A reference to the occlusion buffer to copy.
+		 @return		A reference to the copy of the given occlusion buffer
+						(i.e. this occlusion buffer).
+		 */
+		OcclusionBuffer& operator=(const OcclusionBuffer& buffer);
+
+		/**
+		 Moves the given occlusion buffer to this occlusion buffer.
+
+		 @param[in]		buffer
+						A reference to the occlusion buffer to move.
+		 @return		A reference to the moved occlusion buffer (i.e. this
+						occlusion buffer).
+		 */
+		OcclusionBuffer& operator=(OcclusionBuffer&& buffer) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the width (in pixels) of this occlusion buffer.
+
+		 @return		The width (in pixels) of this occlusion buffer.
+		 */
+		[[nodiscard]]
+		U32 GetWidth() const noexcept {
+			return m_width;
+		}
+
+		/**
+		 Returns the height (in pixels) of this occlusion buffer.
+
+		 @return		The height (in pixels) of this occlusion buffer.
+		 */
+		[[nodiscard]]
+		U32 GetHeight() const noexcept {
+			return m_height;
+		}
+
+		/**
+		 Returns the number of tile rows of this occlusion buffer.
+
+		 @return		The number of tile rows of this occlusion buffer.
+		 */
+		[[nodiscard]]
+		U32 GetNumberOfTileRows() const noexcept {
+			return m_nb_tiles[1];
+		}
+
+		/**
+		 Resizes this occlusion buffer.
+
+		 The width and height are rounded up to a multiple of the tile width
+		 and height. Resizing clears this occlusion buffer.
+
+		 @param[in]		width
+						The width (in pixels).
+		 @param[in]		height
+						The height (in pixels).
+		 */
+		void Resize(U32 width, U32 height);
+
+		/**
+		 Clears the depths and the occluder triangles of this occlusion
+		 buffer.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Returns the number of occluder triangles of this occlusion buffer
+		 (after clipping).
+
+		 @return		The number of occluder triangles of this occlusion
+						buffer.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfTriangles() const noexcept {
+			return m_triangles.size();
+		}
+
+		/**
+		 Adds the triangles of the given occluder mesh to this occlusion
+		 buffer.
+
+		 The triangles are transformed, clipped against the near plane (and a
+		 guard band around the view frustum) and set up for rasterization.
+		 Triangles outside the view frustum or without covered pixel centers
+		 are discarded. Back-facing triangles are rasterized as well.
+
+		 @param[in]		object_to_projection
+						The object-to-projection transformation matrix of the
+						occluder (with an inverted depth).
+		 @param[in]		mesh
+						A reference to the occluder mesh.
+		 */
+		void XM_CALLCONV AddOccluder(FXMMATRIX object_to_projection,
+									 const OccluderMesh& mesh);
+
+		/**
+		 Rasterizes the occluder triangles of this occlusion buffer.
+		 */
+		void Rasterize() noexcept;
+
+		/**
+		 Rasterizes the occluder triangles of this occlusion buffer into the
+		 given band of tile rows.
+
+		 Bands which do not overlap can be rasterized concurrently.
+
+		 @param[in]		first_tile_row
+						The first tile row of the band.
+		 @param[in]		end_tile_row
+						The end tile row (exclusive) of the band.
+		 */
+		void Rasterize(U32 first_tile_row, U32 end_tile_row) noexcept;
+
+		/**
+		 Checks whether the given AABB is (partially) visible.
+
+		 The AABB is tested by the screen-space rectangle and the nearest
+		 depth of its projected corners. An AABB crossing the near plane is
+		 always visible. This method can be called concurrently (after
+		 rasterization).
+
+		 @param[in]		object_to_projection
+						The object-to-projection transformation matrix of the
+						AABB (with an inverted depth).
+		 @param[in]		aabb
+						A reference to the (object space) AABB.
+		 @return		@c true if the given AABB is not completely occluded
+						and overlaps this occlusion buffer. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool XM_CALLCONV IsVisible(FXMMATRIX object_to_projection,
+								   const AABB& aabb) const noexcept;
+
+		/**
+		 Returns the depth of the given pixel of this occlusion buffer.
+
+		 @pre			@a x is smaller than the width of this occlusion
+						buffer.
+		 @pre			@a y is smaller than the height of this occlusion
+						buffer.
+		 @param[in]		x
+						The column of the pixel.
+		 @param[in]		y
+						The row of the pixel.
+		 @return		The (inverted normalized device) depth of the given
+						pixel of this occlusion buffer.
+		 */
+		[[nodiscard]]
+		F32 GetDepth(U32 x, U32 y) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of (set up) triangles of occlusion buffers.
+		 */
+		struct Triangle {
+
+		public:
+
+			/**
+			 The coefficients (a, b, c) of the edge functions
+			 (a x + b y + c) of this triangle in pixel space. The edge
+			 functions are positive inside this triangle.
+			 */
+			F32 m_edges[3][3];
+
+			/**
+			 The coefficients (a, b, c) of the depth plane
+			 (a x + b y + c) of this triangle in pixel space.
+			 */
+			F32 m_depth[3];
+
+			/**
+			 The minimum depth of the vertices of this triangle.
+			 */
+			F32 m_min_depth;
+
+			/**
+			 The maximum (i.e. nearest) depth of the vertices of this
+			 triangle.
+			 */
+			F32 m_max_depth;
+
+			/**
+			 The first and last covered pixel column of this triangle.
+			 */
+			U32 m_columns[2];
+
+			/**
+			 The first and last covered pixel row of this triangle.
+			 */
+			U32 m_rows[2];
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Sets up the given (clipped) triangle of this occlusion buffer.
+
+		 @param[in]		v0
+						The first vertex (x, y, z, w) in projection space.
+		 @param[in]		v1
+						The second vertex (x, y, z, w) in projection space.
+		 @param[in]		v2
+						The third vertex (x, y, z, w) in projection space.
+		 */
+		void XM_CALLCONV AddTriangle(FXMVECTOR v0,
+									 FXMVECTOR v1,
+									 FXMVECTOR v2);
+
+		/**
+		 Rasterizes the given triangle into the given tile of this occlusion
+		 buffer.
+
+		 @param[in]		triangle
+						A reference to the triangle.
+		 @param[in]		tile_x
+						The tile column.
+		 @param[in]		tile_y
+						The tile row.
+		 */
+		void RasterizeTile(const Triangle& triangle,
+						   U32 tile_x, U32 tile_y) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The width (in pixels) of this occlusion buffer.
+		 */
+		U32 m_width;
+
+		/**
+		 The height (in pixels) of this occlusion buffer.
+		 */
+		U32 m_height;
+
+		/**
+		 The number of tile columns and tile rows of this occlusion buffer.
+		 */
+		U32x2 m_nb_tiles;
+
+		/**
+		 The depths of the pixels of this occlusion buffer. The depths of
+		 each tile are stored contiguously (in row-major order) as two
+		 vectors per tile row.
+		 */
+		AlignedVector< XMVECTOR > m_depths;
+
+		/**
+		 The farthest depth of the pixels of each tile of this occlusion
+		 buffer.
+		 */
+		std::vector< F32 > m_tile_depths;
+
+		/**
+		 The (set up) occluder triangles of this occlusion buffer.
+		 */
+		std::vector< Triangle > m_triangles;
+
+		/**
+		 The transformed vertex positions of the occluder which is being
+		 added to this occlusion buffer.
+		 */
+		AlignedVector< XMVECTOR > m_vertices;
+
+		/**
+		 The outcodes (i.e. the planes the vertex lies outside of) of the
+		 transformed vertex positions of the occluder which is being added to
+		 this occlusion buffer.
+		 */
+		std::vector< U32 > m_outcodes;
+	};
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/occlusion_buffer.tpp"
+
+#pragma endregion
@@ -0,0 +1,52 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename VertexT, typename IndexT >
+	OccluderMesh::OccluderMesh(gsl::span< const VertexT > vertices,
+							   gsl::span< const IndexT > indices,
+							   std::size_t base_vertex)
+		: OccluderMesh() {
+
+		const auto nb_indices = 3u * (static_cast< std::size_t >(indices.size()) / 3u);
+		if (0u == nb_indices) {
+			return;
+		}
+
+		std::size_t min_index = std::numeric_limits< std::size_t >::max();
+		std::size_t max_index = 0u;
+		for (std::size_t i = 0u; i < nb_indices; ++i) {
+			const auto index = static_cast< std::size_t >(indices[i]);
+			min_index = std::min(min_index, index);
+			max_index = std::max(max_index, index);
+		}
+
+		// The new index (+1) of each referenced vertex.
+		std::vector< U32 > mapping(max_index - min_index + 1u, 0u);
+
+		m_indices.reserve(nb_indices);
+		for (std::size_t i = 0u; i < nb_indices; ++i) {
+			const auto index = static_cast< std::size_t >(indices[i]);
+			auto& slot = mapping[index - min_index];
+			if (0u == slot) {
+				m_positions.push_back(vertices[base_vertex + index].m_p);
+				slot = static_cast< U32 >(m_positions.size());
+			}
+
+			m_indices.push_back(slot - 1u);
+		}
+	}
+}
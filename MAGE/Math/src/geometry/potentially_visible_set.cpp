@@ -0,0 +1,186 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/potentially_visible_set.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	PotentiallyVisibleSet::PotentiallyVisibleSet() noexcept
+		: m_bounds(),
+		m_resolution(0u, 0u, 0u),
+		m_nb_objects(0u),
+		m_key(0u),
+		m_offsets(),
+		m_data() {}
+
+	PotentiallyVisibleSet::PotentiallyVisibleSet(const AABB& bounds,
+												 const U32x3& resolution,
+												 std::size_t nb_objects,
+												 gsl::span< const U8 > bitsets)
+		: m_bounds(bounds),
+		m_resolution(resolution),
+		m_nb_objects(nb_objects),
+		m_key(0u),
+		m_offsets(),
+		m_data() {
+
+		const std::size_t nb_cells = static_cast< std::size_t >(resolution[0])
+			                       * static_cast< std::size_t >(resolution[1])
+			                       * static_cast< std::size_t >(resolution[2]);
+		const auto bitset_size = GetBitsetSize(nb_objects);
+		Assert(static_cast< std::size_t >(bitsets.size()) == nb_cells * bitset_size);
+
+		m_offsets.reserve(nb_cells + 1u);
+		for (std::size_t cell = 0u; cell < nb_cells; ++cell) {
+			m_offsets.push_back(static_cast< U32 >(m_data.size()));
+			Compress(bitsets.subspan(static_cast< std::ptrdiff_t >(cell * bitset_size),
+									 static_cast< std::ptrdiff_t >(bitset_size)));
+		}
+		m_offsets.push_back(static_cast< U32 >(m_data.size()));
+
+		m_data.shrink_to_fit();
+	}
+
+	PotentiallyVisibleSet::PotentiallyVisibleSet(const AABB& bounds,
+												 const U32x3& resolution,
+												 std::size_t nb_objects,
+												 std::vector< U32 > offsets,
+												 std::vector< U8 > data)
+		: m_bounds(bounds),
+		m_resolution(resolution),
+		m_nb_objects(nb_objects),
+		m_key(0u),
+		m_offsets(std::move(offsets)),
+		m_data(std::move(data)) {
+
+		Assert(m_offsets.size() == static_cast< std::size_t >(resolution[0])
+			                     * static_cast< std::size_t >(resolution[1])
+			                     * static_cast< std::size_t >(resolution[2]) + 1u);
+		Assert(m_offsets.back() == m_data.size());
+	}
+
+	PotentiallyVisibleSet::PotentiallyVisibleSet(
+		const PotentiallyVisibleSet& pvs) = default;
+
+	PotentiallyVisibleSet::PotentiallyVisibleSet(
+		PotentiallyVisibleSet&& pvs) noexcept = default;
+
+	PotentiallyVisibleSet::~PotentiallyVisibleSet() = default;
+
+	PotentiallyVisibleSet& PotentiallyVisibleSet
+		::operator=(const PotentiallyVisibleSet& pvs) = default;
+
+	PotentiallyVisibleSet& PotentiallyVisibleSet
+		::operator=(PotentiallyVisibleSet&& pvs) noexcept = default;
+
+	[[nodiscard]]
+	std::size_t XM_CALLCONV PotentiallyVisibleSet::GetCell(FXMVECTOR p) const noexcept {
+		if (empty()) {
+			return s_null_cell;
+		}
+
+		const auto p_min = m_bounds.MinPoint();
+		const auto p_max = m_bounds.MaxPoint();
+		if (!XMVector3GreaterOrEqual(p, p_min) || !XMVector3Less(p, p_max)) {
+			return s_null_cell;
+		}
+
+		const auto resolution = XMVectorSet(static_cast< F32 >(m_resolution[0]),
+											static_cast< F32 >(m_resolution[1]),
+											static_cast< F32 >(m_resolution[2]),
+											1.0f);
+		const auto uvw   = (p - p_min) / (p_max - p_min) * resolution;
+		const auto coord = XMStore< F32x3 >(XMVectorFloor(uvw));
+
+		std::size_t index[3];
+		for (std::size_t i = 0u; i < 3u; ++i) {
+			index[i] = std::min(static_cast< std::size_t >(std::max(0.0f, coord[i])),
+								static_cast< std::size_t >(m_resolution[i]) - 1u);
+		}
+
+		return index[0] + m_resolution[0] * (index[1] + m_resolution[1] * index[2]);
+	}
+
+	[[nodiscard]]
+	const AABB PotentiallyVisibleSet::GetCellAABB(std::size_t cell) const noexcept {
+		Assert(cell < GetNumberOfCells());
+
+		const auto x = cell % m_resolution[0];
+		const auto y = (cell / m_resolution[0]) % m_resolution[1];
+		const auto z = cell / (static_cast< std::size_t >(m_resolution[0]) * m_resolution[1]);
+
+		const auto p_min      = m_bounds.MinPoint();
+		const auto p_max      = m_bounds.MaxPoint();
+		const auto resolution = XMVectorSet(static_cast< F32 >(m_resolution[0]),
+											static_cast< F32 >(m_resolution[1]),
+											static_cast< F32 >(m_resolution[2]),
+											1.0f);
+		const auto cell_size  = (p_max - p_min) / resolution;
+		const auto coord      = XMVectorSet(static_cast< F32 >(x),
+											static_cast< F32 >(y),
+											static_cast< F32 >(z),
+											0.0f);
+		const auto cell_min   = XMVectorMultiplyAdd(coord, cell_size, p_min);
+
+		return AABB(cell_min, cell_min + cell_size);
+	}
+
+	void PotentiallyVisibleSet::Decompress(std::size_t cell,
+										   gsl::span< U8 > bitset) const noexcept {
+		Assert(cell < GetNumberOfCells());
+		Assert(static_cast< std::size_t >(bitset.size()) == GetBitsetSize(m_nb_objects));
+
+		std::fill(bitset.begin(), bitset.end(), U8(0u));
+		ForEachVisible(cell, [bitset](U32 index) noexcept {
+			bitset[static_cast< std::ptrdiff_t >(index >> 3u)]
+				|= static_cast< U8 >(1u << (index & 7u));
+		});
+	}
+
+	void PotentiallyVisibleSet::Compress(gsl::span< const U8 > bitset) {
+		const auto size = static_cast< std::size_t >(bitset.size());
+
+		for (std::size_t i = 0u; i < size;) {
+			const auto byte = bitset[static_cast< std::ptrdiff_t >(i)];
+			if (0u != byte) {
+				m_data.push_back(byte);
+				++i;
+				continue;
+			}
+
+			// Encode a run of (at most 255) zero bytes.
+			std::size_t run = 1u;
+			while (i + run < size && run < 255u
+				   && 0u == bitset[static_cast< std::ptrdiff_t >(i + run)]) {
+				++run;
+			}
+
+			i += run;
+
+			// Trailing zero bytes are implicit.
+			if (size <= i) {
+				break;
+			}
+
+			m_data.push_back(0u);
+			m_data.push_back(static_cast< U8 >(run));
+		}
+	}
+}
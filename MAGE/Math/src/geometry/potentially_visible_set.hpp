@@ -0,0 +1,453 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/bounding_volume.hpp"
+#include "geometry/ray.hpp"
+#include "logging/logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <limits>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of potentially visible sets (PVSs).
+
+	 A potentially visible set partitions a region of space in a uniform
+	 grid of cells and stores for each cell the set of objects which are
+	 potentially visible from any point inside that cell, as a bitset
+	 indexed by object. Objects with an index beyond the number of objects
+	 of the potentially visible set are not covered and need to be treated
+	 as visible.
+
+	 The bitsets are compressed with a zero run-length encoding: each
+	 non-zero byte is stored as is, each run of (at most 255) zero bytes is
+	 stored as a zero byte followed by the length of the run, and trailing
+	 zero bytes are omitted. Bitsets of (static indoor) scenes are sparse,
+	 which makes them compact and cheap to iterate without decompression.
+	 */
+	class PotentiallyVisibleSet {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The index of the null cell (i.e. outside all cells).
+		 */
+		static constexpr std::size_t s_null_cell
+			= std::numeric_limits< std::size_t >::max();
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the size (in bytes) of the (uncompressed) bitset of a cell.
+
+		 @param[in]		nb_objects
+						The number of objects.
+		 @return		The size (in bytes) of the (uncompressed) bitset of a
+						cell.
+		 */
+		[[nodiscard]]
+		static constexpr std::size_t GetBitsetSize(std::size_t nb_objects) noexcept {
+			return (nb_objects + 7u) / 8u;
+		}
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an empty potentially visible set.
+		 */
+		PotentiallyVisibleSet() noexcept;
+
+		/**
+		 Constructs a potentially visible set from the given (uncompressed)
+		 bitsets.
+
+		 @pre			The size of @a bitsets is equal to the number of cells
+						times the bitset size of @a nb_objects.
+		 @param[in]		bounds
+						A reference to the AABB of the grid of cells.
+		 @param[in]		resolution
+						A reference to the number of cells in each dimension.
+		 @param[in]		nb_objects
+						The number of objects.
+		 @param[in]		bitsets
+						The (uncompressed) bitsets of the cells in x-major
+						order (i.e. x, then y, then z).
+		 */
+		explicit PotentiallyVisibleSet(const AABB& bounds,
+									   const U32x3& resolution,
+									   std::size_t nb_objects,
+									   gsl::span< const U8 > bitsets);
+
+		/**
+		 Constructs a potentially visible set from the given compressed
+		 bitsets.
+
+		 @pre			The size of @a offsets is equal to the number of cells
+						plus one.
+		 @param[in]		bounds
+						A reference to the AABB of the grid of cells.
+		 @param[in]		resolution
+						A reference to the number of cells in each dimension.
+		 @param[in]		nb_objects
+						The number of objects.
+		 @param[in]		offsets
+						The offsets of the compressed bitsets of the cells in
+						@a data (followed by the size of @a data).
+		 @param[in]		data
+						The compressed bitsets of the cells.
+		 */
+		explicit PotentiallyVisibleSet(const AABB& bounds,
+									   const U32x3& resolution,
+									   std::size_t nb_objects,
+									   std::vector< U32 > offsets,
+									   std::vector< U8 > data);
+
+		/**
+		 Constructs a potentially visible set from the given potentially
+		 visible set.
+
+		 @param[in]		pvs
+						A reference to the potentially visible set to copy.
+		 */
+		PotentiallyVisibleSet(const PotentiallyVisibleSet& pvs);
+
+		/**
+		 Constructs a potentially visible set by moving the given potentially
+		 visible set.
+
+		 @param[in]		pvs
+						A reference to the potentially visible set to move.
+		 */
+		PotentiallyVisibleSet(PotentiallyVisibleSet&& pvs) noexcept;
+
+		/**
+		 Destructs this potentially visible set.
+		 */
+		~PotentiallyVisibleSet();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given potentially visible set to this potentially visible
+		 set.
+
+		 @param[in]		pvs
+						A reference to the potentially visible set to copy.
+		 @return		A reference to the copy of the given potentially
+						visible set (i.e. this potentially visible set).
+		 */
+		PotentiallyVisibleSet& operator=(const PotentiallyVisibleSet& pvs);
+
+		/**
+		 Moves the given potentially visible set to this potentially visible
+		 set.
+
+		 @param[in]		pvs
+						A reference to the potentially visible set to move.
+		 @return		A reference to the moved potentially visible set (i.e.
+						this potentially visible set).
+		 */
+		PotentiallyVisibleSet& operator=(PotentiallyVisibleSet&& pvs) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this potentially visible set is empty.
+
+		 @return		@c true if this potentially visible set contains no
+						cells. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_offsets.size() < 2u;
+		}
+
+		/**
+		 Returns the AABB of the grid of cells of this potentially visible
+		 set.
+
+		 @return		A reference to the AABB of the grid of cells of this
+						potentially visible set.
+		 */
+		[[nodiscard]]
+		const AABB& GetBounds() const noexcept {
+			return m_bounds;
+		}
+
+		/**
+		 Returns the number of cells in each dimension of this potentially
+		 visible set.
+
+		 @return		A reference to the number of cells in each dimension
+						of this potentially visible set.
+		 */
+		[[nodiscard]]
+		const U32x3& GetResolution() const noexcept {
+			return m_resolution;
+		}
+
+		/**
+		 Returns the number of cells of this potentially visible set.
+
+		 @return		The number of cells of this potentially visible set.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfCells() const noexcept {
+			return empty() ? 0u : m_offsets.size() - 1u;
+		}
+
+		/**
+		 Returns the number of objects of this potentially visible set.
+
+		 @return		The number of objects of this potentially visible set.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfObjects() const noexcept {
+			return m_nb_objects;
+		}
+
+		/**
+		 Returns the key of the scene of this potentially visible set.
+
+		 @return		The key of the scene of this potentially visible set.
+		 */
+		[[nodiscard]]
+		U64 GetKey() const noexcept {
+			return m_key;
+		}
+
+		/**
+		 Sets the key of the scene of this potentially visible set.
+
+		 A potentially visible set is stale if its key differs from the key
+		 of the (current) scene.
+
+		 @param[in]		key
+						The key of the scene.
+		 */
+		void SetKey(U64 key) noexcept {
+			m_key = key;
+		}
+
+		/**
+		 Returns the offsets of the compressed bitsets of the cells of this
+		 potentially visible set.
+
+		 @return		The offsets of the compressed bitsets of the cells of
+						this potentially visible set (followed by the size of
+						the compressed bitsets).
+		 */
+		[[nodiscard]]
+		gsl::span< const U32 > GetOffsets() const noexcept {
+			return m_offsets;
+		}
+
+		/**
+		 Returns the compressed bitsets of the cells of this potentially
+		 visible set.
+
+		 @return		The compressed bitsets of the cells of this
+						potentially visible set.
+		 */
+		[[nodiscard]]
+		gsl::span< const U8 > GetData() const noexcept {
+			return m_data;
+		}
+
+		/**
+		 Returns the cell of this potentially visible set containing the
+		 given point.
+
+		 @param[in]		p
+						The point.
+		 @return		The index of the cell containing the given point.
+		 @return		@c s_null_cell if the given point lies outside the grid
+						of cells of this potentially visible set.
+		 */
+		[[nodiscard]]
+		std::size_t XM_CALLCONV GetCell(FXMVECTOR p) const noexcept;
+
+		/**
+		 Returns the AABB of the given cell of this potentially visible set.
+
+		 @pre			@a cell is smaller than the number of cells of this
+						potentially visible set.
+		 @param[in]		cell
+						The index of the cell.
+		 @return		The AABB of the given cell.
+		 */
+		[[nodiscard]]
+		const AABB GetCellAABB(std::size_t cell) const noexcept;
+
+		/**
+		 Calls the given action for each object which is potentially visible
+		 from the given cell of this potentially visible set, in increasing
+		 order of index.
+
+		 @pre			@a cell is smaller than the number of cells of this
+						potentially visible set.
+		 @tparam		ActionT
+						An action to perform on the index of each potentially
+						visible object. This action must accept a @c U32
+						argument.
+		 @param[in]		cell
+						The index of the cell.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename ActionT >
+		void ForEachVisible(std::size_t cell, ActionT&& action) const;
+
+		/**
+		 Decompresses the bitset of the given cell of this potentially visible
+		 set.
+
+		 @pre			@a cell is smaller than the number of cells of this
+						potentially visible set.
+		 @pre			The size of @a bitset is equal to the bitset size of
+						the number of objects of this potentially visible set.
+		 @param[in]		cell
+						The index of the cell.
+		 @param[out]	bitset
+						The bitset of the given cell.
+		 */
+		void Decompress(std::size_t cell, gsl::span< U8 > bitset) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Compresses the given bitset and appends it to the data of this
+		 potentially visible set.
+
+		 @param[in]		bitset
+						The bitset.
+		 */
+		void Compress(gsl::span< const U8 > bitset);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The AABB of the grid of cells of this potentially visible set.
+		 */
+		AABB m_bounds;
+
+		/**
+		 The number of cells in each dimension of this potentially visible
+		 set.
+		 */
+		U32x3 m_resolution;
+
+		/**
+		 The number of objects of this potentially visible set.
+		 */
+		std::size_t m_nb_objects;
+
+		/**
+		 The key of the scene of this potentially visible set.
+		 */
+		U64 m_key;
+
+		/**
+		 The offsets of the compressed bitsets of the cells of this
+		 potentially visible set (followed by the size of the compressed
+		 bitsets).
+		 */
+		std::vector< U32 > m_offsets;
+
+		/**
+		 The compressed bitsets of the cells of this potentially visible set.
+		 */
+		std::vector< U8 > m_data;
+	};
+
+	/**
+	 Computes the potentially visible set of the given number of objects.
+
+	 The given bounds are partitioned into a uniform grid of cells. For each
+	 cell, rays are cast from random points inside the cell in random
+	 directions, and each object hit first is potentially visible from that
+	 cell. Objects overlapping a cell are always potentially visible from
+	 that cell. The cells are distributed over the cores of the system.
+
+	 @pre			@a cell_size is positive.
+	 @tparam		QueryT
+					An action to perform on the AABB of each cell. This
+					action must accept a @c const @c AABB& argument and an
+					action marking the index (@c U32) of an object as
+					potentially visible, and must mark all objects
+					overlapping the given AABB.
+	 @tparam		IntersectT
+					An action to perform on each ray. This action must accept
+					the origin and (normalized) direction of the ray as
+					@c FXMVECTOR arguments and a @c RayHit& argument, and must
+					return whether the ray hits an object. The index of the
+					first object hit is stored in @c RayHit::m_data.
+	 @param[in]		bounds
+					A reference to the AABB of the grid of cells.
+	 @param[in]		cell_size
+					The (maximum) size of each cell.
+	 @param[in]		nb_objects
+					The number of objects.
+	 @param[in]		nb_rays_per_cell
+					The number of rays to cast from each cell.
+	 @param[in]		query
+					The query action.
+	 @param[in]		intersect
+					The intersect action.
+	 @return		The potentially visible set of the objects. The
+					potentially visible set is empty if the given bounds are
+					empty.
+	 */
+	template< typename QueryT, typename IntersectT >
+	[[nodiscard]]
+	PotentiallyVisibleSet ComputePotentiallyVisibleSet(const AABB& bounds,
+													   F32 cell_size,
+													   std::size_t nb_objects,
+													   std::size_t nb_rays_per_cell,
+													   QueryT&& query,
+													   IntersectT&& intersect);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/potentially_visible_set.tpp"
+
+#pragma endregion
@@ -0,0 +1,136 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel/parallel.hpp"
+#include "sampling/rng.hpp"
+#include "sampling/sampling.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename ActionT >
+	void PotentiallyVisibleSet::ForEachVisible(std::size_t cell,
+											   ActionT&& action) const {
+		Assert(cell < GetNumberOfCells());
+
+		const auto nb_objects = m_nb_objects;
+		const auto end        = m_data.data() + m_offsets[cell + 1u];
+
+		U32 first = 0u;
+		for (auto it = m_data.data() + m_offsets[cell]; it < end; ++it) {
+			const U32 byte = *it;
+
+			// Skip a run of zero bytes.
+			if (0u == byte) {
+				first += 8u * static_cast< U32 >(*++it);
+				continue;
+			}
+
+			for (auto bits = byte; 0u != bits; bits &= bits - 1u) {
+				U32 bit = 0u;
+				while (0u == (bits & (1u << bit))) {
+					++bit;
+				}
+
+				const auto index = first + bit;
+				if (index < nb_objects) {
+					action(index);
+				}
+			}
+
+			first += 8u;
+		}
+	}
+
+	template< typename QueryT, typename IntersectT >
+	[[nodiscard]]
+	PotentiallyVisibleSet ComputePotentiallyVisibleSet(const AABB& bounds,
+													   F32 cell_size,
+													   std::size_t nb_objects,
+													   std::size_t nb_rays_per_cell,
+													   QueryT&& query,
+													   IntersectT&& intersect) {
+		Assert(0.0f < cell_size);
+
+		if (!XMVector3Less(bounds.MinPoint(), bounds.MaxPoint())) {
+			return PotentiallyVisibleSet();
+		}
+
+		// Determine the grid of cells.
+		const auto extents = XMStore< F32x3 >(bounds.MaxPoint() - bounds.MinPoint());
+		const U32x3 resolution(
+			std::max(1u, static_cast< U32 >(std::ceil(extents[0] / cell_size))),
+			std::max(1u, static_cast< U32 >(std::ceil(extents[1] / cell_size))),
+			std::max(1u, static_cast< U32 >(std::ceil(extents[2] / cell_size))));
+		const auto nb_cells = static_cast< std::size_t >(resolution[0])
+			                * static_cast< std::size_t >(resolution[1])
+			                * static_cast< std::size_t >(resolution[2]);
+
+		const auto bitset_size = PotentiallyVisibleSet::GetBitsetSize(nb_objects);
+		std::vector< U8 > bitsets(nb_cells * bitset_size, 0u);
+
+		// The cells of an empty potentially visible set only provide the
+		// geometry of the grid.
+		const PotentiallyVisibleSet layout(bounds, resolution, 0u,
+										   gsl::span< const U8 >());
+
+		ForEachParallel(nb_cells, [&query, &intersect, &layout, &bitsets,
+								   nb_objects, bitset_size,
+								   nb_rays_per_cell](std::size_t cell) {
+
+			const auto bitset = bitsets.data() + cell * bitset_size;
+			const auto mark   = [bitset, nb_objects](U32 index) noexcept {
+				if (index < nb_objects) {
+					bitset[index >> 3u] |= static_cast< U8 >(1u << (index & 7u));
+				}
+			};
+
+			const auto cell_aabb = layout.GetCellAABB(cell);
+
+			// Objects overlapping the cell are potentially visible.
+			query(cell_aabb, mark);
+
+			// Objects hit by rays leaving the cell are potentially visible.
+			const auto p_min = cell_aabb.MinPoint();
+			const auto size  = cell_aabb.MaxPoint() - p_min;
+			// One independent stream per cell keeps the result independent of
+			// the scheduling of the cells.
+			RNG rng(1u, static_cast< U64 >(cell));
+			for (std::size_t i = 0u; i < nb_rays_per_cell; ++i) {
+				const auto u = XMVectorSet(rng.Uniform(), rng.Uniform(),
+										   rng.Uniform(), 0.0f);
+				const auto origin = XMVectorMultiplyAdd(u, size, p_min);
+				const auto d1 = rng.Uniform();
+				const auto d2 = rng.Uniform();
+				const auto direction
+					= XMLoad(UniformSampleOnUnitSphere(d1, d2));
+
+				RayHit hit;
+				if (intersect(origin, direction, hit)) {
+					mark(hit.m_data);
+				}
+			}
+		});
+
+		return PotentiallyVisibleSet(bounds, resolution, nb_objects,
+									 gsl::span< const U8 >(bitsets));
+	}
+}
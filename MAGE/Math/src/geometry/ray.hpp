@@ -0,0 +1,172 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/bounding_volume.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// Ray
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of rays.
+	 */
+	struct Ray {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The origin of this ray.
+		 */
+		Point3 m_origin;
+
+		/**
+		 The (normalized) direction of this ray.
+		 */
+		Direction3 m_direction;
+
+		/**
+		 The maximum distance along this ray.
+		 */
+		F32 m_max_distance = std::numeric_limits< F32 >::infinity();
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// RayHit
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of ray hits.
+	 */
+	struct RayHit {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The invalid index of ray hits.
+		 */
+		static constexpr U32 s_invalid_index = std::numeric_limits< U32 >::max();
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this ray hit is a hit.
+
+		 @return		@c true if this ray hit is a hit. @c false otherwise
+						(i.e. a miss).
+		 */
+		[[nodiscard]]
+		bool IsHit() const noexcept {
+			return m_distance < std::numeric_limits< F32 >::infinity();
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The distance along the ray to this ray hit (infinity for a miss).
+		 */
+		F32 m_distance = std::numeric_limits< F32 >::infinity();
+
+		/**
+		 The index of the hit triangle of this ray hit (invalid if only a
+		 bounding volume is hit).
+		 */
+		U32 m_triangle = s_invalid_index;
+
+		/**
+		 The barycentric coordinates of this ray hit with regard to the
+		 second and third vertex of the hit triangle.
+		 */
+		F32x2 m_barycentric = { 0.0f, 0.0f };
+
+		/**
+		 The user data (e.g., the index of the hit object) of this ray hit.
+		 */
+		U32 m_data = s_invalid_index;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Ray Intersection
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Intersects the given AABB with the given ray (slab test).
+
+	 @param[in]		aabb
+					A reference to the AABB.
+	 @param[in]		origin
+					The origin of the ray.
+	 @param[in]		inv_direction
+					The inverse direction of the ray.
+	 @param[in]		max_distance
+					The maximum distance along the ray.
+	 @return		A pair containing a flag indicating whether the AABB
+					is intersected, and the (non-negative) distance along
+					the ray to the AABB.
+	 */
+	[[nodiscard]]
+	inline const std::pair< bool, F32 > XM_CALLCONV
+		IntersectRay(const AABB& aabb,
+					 FXMVECTOR origin,
+					 FXMVECTOR inv_direction,
+					 F32 max_distance) noexcept {
+
+		const auto t1    = (aabb.MinPoint() - origin) * inv_direction;
+		const auto t2    = (aabb.MaxPoint() - origin) * inv_direction;
+		const auto t_min = XMVectorMin(t1, t2);
+		const auto t_max = XMVectorMax(t1, t2);
+
+		const auto t_near = std::max({ XMVectorGetX(t_min),
+									   XMVectorGetY(t_min),
+									   XMVectorGetZ(t_min),
+									   0.0f });
+		const auto t_far  = std::min({ XMVectorGetX(t_max),
+									   XMVectorGetY(t_max),
+									   XMVectorGetZ(t_max),
+									   max_distance });
+
+		return { t_near <= t_far, t_near };
+	}
+
+	#pragma endregion
+}
@@ -0,0 +1,639 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/triangle_bvh.hpp"
+#include "logging/logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <immintrin.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The number of bins per axis used by the surface area heuristic.
+		 */
+		constexpr std::size_t g_nb_sah_bins = 16u;
+
+		/**
+		 The maximum number of triangles per leaf.
+		 */
+		constexpr std::size_t g_max_leaf_size = 4u;
+
+		/**
+		 The maximum depth of binary nodes split with the surface area
+		 heuristic. Deeper nodes are split at the median, which bounds the
+		 depth of the hierarchy (and the size of the traversal stack).
+		 */
+		constexpr std::size_t g_max_sah_depth = 48u;
+
+		#pragma warning( push )
+		#pragma warning( disable : 4324 ) // Added padding.
+
+		/**
+		 A struct of primitives used while building.
+		 */
+		struct alignas(16) BuildPrimitive {
+
+		public:
+
+			AABB m_aabb;
+
+			XMVECTOR m_centroid;
+
+			U32 m_index;
+		};
+
+		/**
+		 A struct of binary nodes used while building.
+		 */
+		struct alignas(16) BuildNode {
+
+		public:
+
+			[[nodiscard]]
+			bool IsLeaf() const noexcept {
+				return 0u != m_count;
+			}
+
+			AABB m_aabb;
+
+			U32 m_children[2];
+
+			U32 m_start;
+
+			U32 m_count;
+		};
+
+		#pragma warning( pop )
+
+		[[nodiscard]]
+		F32 SurfaceArea(const AABB& aabb) noexcept {
+			const auto d = aabb.Diagonal();
+			const auto x = XMVectorGetX(d);
+			const auto y = XMVectorGetY(d);
+			const auto z = XMVectorGetZ(d);
+			return 2.0f * (x * y + y * z + z * x);
+		}
+
+		/**
+		 Builds a binary subtree top-down with the surface area heuristic.
+
+		 @return		The index of the root node of the subtree.
+		 */
+		U32 BuildBinarySubtree(AlignedVector< BuildPrimitive >& primitives,
+							   std::size_t start,
+							   std::size_t end,
+							   std::size_t depth,
+							   AlignedVector< BuildNode >& nodes) {
+
+			AABB aabb;
+			AABB centroids;
+			for (auto i = start; i < end; ++i) {
+				aabb      = AABB::Union(aabb, primitives[i].m_aabb);
+				centroids = AABB::Union(centroids, primitives[i].m_centroid);
+			}
+
+			const auto index = static_cast< U32 >(nodes.size());
+			nodes.emplace_back();
+			nodes[index].m_aabb  = aabb;
+			nodes[index].m_start = static_cast< U32 >(start);
+			nodes[index].m_count = 0u;
+
+			const auto nb_primitives = end - start;
+			if (nb_primitives <= g_max_leaf_size) {
+				nodes[index].m_count = static_cast< U32 >(nb_primitives);
+				return index;
+			}
+
+			const auto c_min    = centroids.MinPoint();
+			const auto c_extent = centroids.Diagonal();
+
+			auto best_cost  = std::numeric_limits< F32 >::infinity();
+			auto best_axis  = 3u;
+			auto best_split = 0.0f;
+
+			if (depth < g_max_sah_depth) {
+				for (auto axis = 0u; axis < 3u; ++axis) {
+					const auto extent = XMVectorGetByIndex(c_extent, axis);
+					if (extent <= 0.0f) {
+						continue;
+					}
+
+					const auto minimum = XMVectorGetByIndex(c_min, axis);
+					const auto scale   = g_nb_sah_bins / extent;
+					const auto bin_of  = [&](const BuildPrimitive& primitive) noexcept {
+						const auto c = XMVectorGetByIndex(primitive.m_centroid, axis);
+						const auto b = static_cast< std::size_t >((c - minimum) * scale);
+						return std::min(b, g_nb_sah_bins - 1u);
+					};
+
+					AABB bin_aabbs[g_nb_sah_bins];
+					std::size_t bin_counts[g_nb_sah_bins] = {};
+					for (auto i = start; i < end; ++i) {
+						const auto b = bin_of(primitives[i]);
+						bin_aabbs[b] = AABB::Union(bin_aabbs[b], primitives[i].m_aabb);
+						++bin_counts[b];
+					}
+
+					// Sweep from the right to accumulate the right costs.
+					F32 right_costs[g_nb_sah_bins];
+					AABB right_aabb;
+					std::size_t right_count = 0u;
+					for (auto b = g_nb_sah_bins - 1u; 0u < b; --b) {
+						right_aabb   = AABB::Union(right_aabb, bin_aabbs[b]);
+						right_count += bin_counts[b];
+						right_costs[b] = (0u == right_count)
+							? 0.0f : SurfaceArea(right_aabb) * right_count;
+					}
+
+					// Sweep from the left to evaluate each split.
+					AABB left_aabb;
+					std::size_t left_count = 0u;
+					for (auto b = 0u; b < g_nb_sah_bins - 1u; ++b) {
+						left_aabb   = AABB::Union(left_aabb, bin_aabbs[b]);
+						left_count += bin_counts[b];
+						if (0u == left_count || nb_primitives == left_count) {
+							continue;
+						}
+
+						const auto cost = SurfaceArea(left_aabb) * left_count
+							            + right_costs[b + 1u];
+						if (cost < best_cost) {
+							best_cost  = cost;
+							best_axis  = axis;
+							best_split = minimum + (b + 1u) / scale;
+						}
+					}
+				}
+			}
+
+			auto middle = start + nb_primitives / 2u;
+			if (3u != best_axis) {
+				const auto it = std::partition(
+					primitives.begin() + start, primitives.begin() + end,
+					[best_axis, best_split](const BuildPrimitive& primitive) noexcept {
+						return XMVectorGetByIndex(primitive.m_centroid, best_axis)
+							 < best_split;
+					});
+				middle = static_cast< std::size_t >(it - primitives.begin());
+			}
+
+			if (3u == best_axis || start == middle || end == middle) {
+				// Split at the median along the largest centroid extent.
+				const auto axis = (XMVectorGetX(c_extent) < XMVectorGetY(c_extent))
+					? ((XMVectorGetY(c_extent) < XMVectorGetZ(c_extent)) ? 2u : 1u)
+					: ((XMVectorGetX(c_extent) < XMVectorGetZ(c_extent)) ? 2u : 0u);
+				middle = start + nb_primitives / 2u;
+				std::nth_element(
+					primitives.begin() + start,
+					primitives.begin() + middle,
+					primitives.begin() + end,
+					[axis](const BuildPrimitive& lhs, const BuildPrimitive& rhs) noexcept {
+						return XMVectorGetByIndex(lhs.m_centroid, axis)
+							 < XMVectorGetByIndex(rhs.m_centroid, axis);
+					});
+			}
+
+			const auto child0 = BuildBinarySubtree(primitives, start, middle,
+												   depth + 1u, nodes);
+			const auto child1 = BuildBinarySubtree(primitives, middle, end,
+												   depth + 1u, nodes);
+			nodes[index].m_children[0] = child0;
+			nodes[index].m_children[1] = child1;
+			return index;
+		}
+	}
+
+	TriangleBVH::TriangleBVH() noexcept
+		: m_nodes(),
+		m_packets(),
+		m_aabb() {}
+
+	TriangleBVH::TriangleBVH(const TriangleBVH& bvh) = default;
+
+	TriangleBVH::TriangleBVH(const AABB& aabb,
+							 gsl::span< const Node > nodes,
+							 gsl::span< const TrianglePacket > packets)
+		: m_nodes(nodes.begin(), nodes.end()),
+		m_packets(packets.begin(), packets.end()),
+		m_aabb(aabb) {
+
+		Assert(IsValid(nodes, packets));
+	}
+
+	TriangleBVH::TriangleBVH(TriangleBVH&& bvh) noexcept = default;
+
+	TriangleBVH::~TriangleBVH() = default;
+
+	TriangleBVH& TriangleBVH::operator=(const TriangleBVH& bvh) = default;
+
+	TriangleBVH& TriangleBVH::operator=(TriangleBVH&& bvh) noexcept = default;
+
+	[[nodiscard]]
+	bool TriangleBVH::IsValid(gsl::span< const Node > nodes,
+							  gsl::span< const TrianglePacket > packets) noexcept {
+
+		const auto nb_nodes   = static_cast< std::size_t >(nodes.size());
+		const auto nb_packets = static_cast< std::size_t >(packets.size());
+
+		// Each traversal step pops one node and pushes (at most) four
+		// children, so the stack grows by (at most) three per level.
+		const auto max_depth = (s_max_stack_size - 1u) / 3u;
+
+		// The children of a node follow the node, so the depth of a node is
+		// known before its children are visited.
+		std::vector< std::size_t > depths(nb_nodes, 0u);
+		for (std::size_t i = 0u; i < nb_nodes; ++i) {
+			for (const auto child : nodes[static_cast< std::ptrdiff_t >(i)].m_children) {
+				if (s_null_child == child) {
+					continue;
+				}
+
+				if (child & s_leaf_flag) {
+					if (nb_packets <= (child & ~s_leaf_flag)) {
+						return false;
+					}
+					continue;
+				}
+
+				if (child <= i || nb_nodes <= child
+					|| max_depth <= depths[i] + 1u) {
+					return false;
+				}
+				depths[child] = std::max(depths[child], depths[i] + 1u);
+			}
+		}
+
+		return true;
+	}
+
+	void TriangleBVH::Build(gsl::span< const F32x3 > positions) {
+		m_nodes.clear();
+		m_packets.clear();
+		m_aabb = AABB();
+
+		const auto nb_triangles = static_cast< std::size_t >(positions.size()) / 3u;
+		if (0u == nb_triangles) {
+			return;
+		}
+
+		AlignedVector< BuildPrimitive > primitives(nb_triangles);
+		for (std::size_t i = 0u; i < nb_triangles; ++i) {
+			const auto p0 = XMLoad(positions[3u * i]);
+			const auto p1 = XMLoad(positions[3u * i + 1u]);
+			const auto p2 = XMLoad(positions[3u * i + 2u]);
+			const AABB aabb(XMVectorMin(p0, XMVectorMin(p1, p2)),
+							XMVectorMax(p0, XMVectorMax(p1, p2)));
+
+			primitives[i].m_aabb     = aabb;
+			primitives[i].m_centroid = aabb.Centroid();
+			primitives[i].m_index    = static_cast< U32 >(i);
+			m_aabb = AABB::Union(m_aabb, aabb);
+		}
+
+		AlignedVector< BuildNode > binary_nodes;
+		binary_nodes.reserve(2u * nb_triangles / g_max_leaf_size + 1u);
+		BuildBinarySubtree(primitives, 0u, nb_triangles, 0u, binary_nodes);
+
+		// Collapses the binary node with the given index into a 4-wide node
+		// (or into a triangle packet for binary leaf nodes).
+		const auto collapse = [&](const auto& self, U32 binary_index) -> U32 {
+			const auto& binary_node = binary_nodes[binary_index];
+
+			if (binary_node.IsLeaf()) {
+				const auto packet_index = static_cast< U32 >(m_packets.size());
+				m_packets.emplace_back();
+				auto& packet = m_packets.back();
+
+				alignas(16) F32 v0[3][4] = {};
+				alignas(16) F32 e1[3][4] = {};
+				alignas(16) F32 e2[3][4] = {};
+				for (U32 lane = 0u; lane < 4u; ++lane) {
+					packet.m_triangles[lane] = RayHit::s_invalid_index;
+					if (binary_node.m_count <= lane) {
+						continue;
+					}
+
+					const auto triangle
+						= primitives[binary_node.m_start + lane].m_index;
+					const auto& p0 = positions[3u * triangle];
+					const auto& p1 = positions[3u * triangle + 1u];
+					const auto& p2 = positions[3u * triangle + 2u];
+					for (std::size_t axis = 0u; axis < 3u; ++axis) {
+						v0[axis][lane] = p0[axis];
+						e1[axis][lane] = p1[axis] - p0[axis];
+						e2[axis][lane] = p2[axis] - p0[axis];
+					}
+					packet.m_triangles[lane] = triangle;
+				}
+
+				// Absent triangles are degenerate and are never hit.
+				for (std::size_t axis = 0u; axis < 3u; ++axis) {
+					packet.m_v0[axis] = _mm_load_ps(v0[axis]);
+					packet.m_e1[axis] = _mm_load_ps(e1[axis]);
+					packet.m_e2[axis] = _mm_load_ps(e2[axis]);
+				}
+
+				return s_leaf_flag | packet_index;
+			}
+
+			// Gather (at most) four children by repeatedly opening the
+			// internal child with the largest surface area.
+			U32 children[4] = { binary_node.m_children[0],
+								binary_node.m_children[1] };
+			std::size_t nb_children = 2u;
+			while (nb_children < 4u) {
+				auto best_area  = -1.0f;
+				auto best_child = nb_children;
+				for (std::size_t i = 0u; i < nb_children; ++i) {
+					const auto& child = binary_nodes[children[i]];
+					if (child.IsLeaf()) {
+						continue;
+					}
+					const auto area = SurfaceArea(child.m_aabb);
+					if (best_area < area) {
+						best_area  = area;
+						best_child = i;
+					}
+				}
+
+				if (nb_children == best_child) {
+					break;
+				}
+
+				const auto& opened = binary_nodes[children[best_child]];
+				children[nb_children++]  = opened.m_children[1];
+				children[best_child]     = opened.m_children[0];
+			}
+
+			const auto node_index = static_cast< U32 >(m_nodes.size());
+			m_nodes.emplace_back();
+
+			alignas(16) F32 mins[3][4];
+			alignas(16) F32 maxs[3][4];
+			U32 node_children[4];
+			for (std::size_t lane = 0u; lane < 4u; ++lane) {
+				if (nb_children <= lane) {
+					for (std::size_t axis = 0u; axis < 3u; ++axis) {
+						mins[axis][lane] =  std::numeric_limits< F32 >::infinity();
+						maxs[axis][lane] = -std::numeric_limits< F32 >::infinity();
+					}
+					node_children[lane] = s_null_child;
+					continue;
+				}
+
+				const auto& aabb = binary_nodes[children[lane]].m_aabb;
+				for (std::size_t axis = 0u; axis < 3u; ++axis) {
+					mins[axis][lane] = XMVectorGetByIndex(aabb.MinPoint(), axis);
+					maxs[axis][lane] = XMVectorGetByIndex(aabb.MaxPoint(), axis);
+				}
+				node_children[lane] = self(self, children[lane]);
+			}
+
+			// m_nodes may have been reallocated by the recursive calls.
+			auto& node = m_nodes[node_index];
+			for (std::size_t axis = 0u; axis < 3u; ++axis) {
+				node.m_min[axis] = _mm_load_ps(mins[axis]);
+				node.m_max[axis] = _mm_load_ps(maxs[axis]);
+			}
+			std::copy(std::begin(node_children), std::end(node_children),
+					  std::begin(node.m_children));
+
+			return node_index;
+		};
+
+		if (binary_nodes[0].IsLeaf()) {
+			// Wrap a single leaf in a root node.
+			m_nodes.emplace_back();
+			const auto leaf = collapse(collapse, 0u);
+
+			auto& root = m_nodes[0];
+			const auto& aabb = binary_nodes[0].m_aabb;
+			alignas(16) F32 mins[3][4];
+			alignas(16) F32 maxs[3][4];
+			for (std::size_t axis = 0u; axis < 3u; ++axis) {
+				std::fill_n(mins[axis], 4u,  std::numeric_limits< F32 >::infinity());
+				std::fill_n(maxs[axis], 4u, -std::numeric_limits< F32 >::infinity());
+				mins[axis][0] = XMVectorGetByIndex(aabb.MinPoint(), axis);
+				maxs[axis][0] = XMVectorGetByIndex(aabb.MaxPoint(), axis);
+				root.m_min[axis] = _mm_load_ps(mins[axis]);
+				root.m_max[axis] = _mm_load_ps(maxs[axis]);
+			}
+			root.m_children[0] = leaf;
+			root.m_children[1] = s_null_child;
+			root.m_children[2] = s_null_child;
+			root.m_children[3] = s_null_child;
+		}
+		else {
+			collapse(collapse, 0u);
+		}
+	}
+
+	template< bool AnyHit >
+	bool XM_CALLCONV TriangleBVH::Traverse(FXMVECTOR origin,
+										   FXMVECTOR direction,
+										   F32 max_distance,
+										   RayHit* hit) const noexcept {
+		if (m_nodes.empty()) {
+			return false;
+		}
+
+		const auto inv_direction = XMVectorReciprocal(direction);
+
+		const __m128 o[3] = { XMVectorSplatX(origin),
+							  XMVectorSplatY(origin),
+							  XMVectorSplatZ(origin) };
+		const __m128 d[3] = { XMVectorSplatX(direction),
+							  XMVectorSplatY(direction),
+							  XMVectorSplatZ(direction) };
+		const __m128 inv_d[3] = { XMVectorSplatX(inv_direction),
+								  XMVectorSplatY(inv_direction),
+								  XMVectorSplatZ(inv_direction) };
+		const auto zero = _mm_setzero_ps();
+		const auto one  = _mm_set1_ps(1.0f);
+
+		struct StackEntry {
+			U32 m_child;
+			F32 m_distance;
+		};
+
+		StackEntry stack[s_max_stack_size];
+		std::size_t stack_size = 0u;
+		stack[stack_size++] = { 0u, 0.0f };
+
+		bool found = false;
+
+		while (0u != stack_size) {
+			const auto entry = stack[--stack_size];
+			if (max_distance < entry.m_distance) {
+				continue;
+			}
+
+			if (s_leaf_flag & entry.m_child) {
+				// Intersect four triangles at once (Moller-Trumbore).
+				const auto& packet = m_packets[entry.m_child & ~s_leaf_flag];
+				const auto* e1 = packet.m_e1;
+				const auto* e2 = packet.m_e2;
+
+				const auto px = _mm_sub_ps(_mm_mul_ps(d[1], e2[2]), _mm_mul_ps(d[2], e2[1]));
+				const auto py = _mm_sub_ps(_mm_mul_ps(d[2], e2[0]), _mm_mul_ps(d[0], e2[2]));
+				const auto pz = _mm_sub_ps(_mm_mul_ps(d[0], e2[1]), _mm_mul_ps(d[1], e2[0]));
+				const auto det = _mm_add_ps(_mm_mul_ps(e1[0], px),
+								 _mm_add_ps(_mm_mul_ps(e1[1], py),
+											_mm_mul_ps(e1[2], pz)));
+				const auto inv_det = _mm_div_ps(one, det);
+
+				const auto tx = _mm_sub_ps(o[0], packet.m_v0[0]);
+				const auto ty = _mm_sub_ps(o[1], packet.m_v0[1]);
+				const auto tz = _mm_sub_ps(o[2], packet.m_v0[2]);
+				const auto u = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(tx, px),
+										  _mm_add_ps(_mm_mul_ps(ty, py),
+													 _mm_mul_ps(tz, pz))), inv_det);
+
+				const auto qx = _mm_sub_ps(_mm_mul_ps(ty, e1[2]), _mm_mul_ps(tz, e1[1]));
+				const auto qy = _mm_sub_ps(_mm_mul_ps(tz, e1[0]), _mm_mul_ps(tx, e1[2]));
+				const auto qz = _mm_sub_ps(_mm_mul_ps(tx, e1[1]), _mm_mul_ps(ty, e1[0]));
+				const auto v = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(d[0], qx),
+										  _mm_add_ps(_mm_mul_ps(d[1], qy),
+													 _mm_mul_ps(d[2], qz))), inv_det);
+				const auto t = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(e2[0], qx),
+										  _mm_add_ps(_mm_mul_ps(e2[1], qy),
+													 _mm_mul_ps(e2[2], qz))), inv_det);
+
+				// Comparisons with NaN (degenerate triangles) fail.
+				auto valid = _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmpge_ps(v, zero));
+				valid = _mm_and_ps(valid, _mm_cmple_ps(_mm_add_ps(u, v), one));
+				valid = _mm_and_ps(valid, _mm_cmpgt_ps(t, zero));
+				valid = _mm_and_ps(valid, _mm_cmple_ps(t, _mm_set1_ps(max_distance)));
+
+				auto mask = _mm_movemask_ps(valid);
+				if (0 == mask) {
+					continue;
+				}
+
+				if constexpr (AnyHit) {
+					return true;
+				}
+				else {
+					alignas(16) F32 ts[4];
+					alignas(16) F32 us[4];
+					alignas(16) F32 vs[4];
+					_mm_store_ps(ts, t);
+					_mm_store_ps(us, u);
+					_mm_store_ps(vs, v);
+
+					for (std::size_t lane = 0u; 0 != mask; ++lane, mask >>= 1) {
+						if (0 == (mask & 1) || max_distance < ts[lane]) {
+							continue;
+						}
+
+						max_distance         = ts[lane];
+						hit->m_distance      = ts[lane];
+						hit->m_triangle      = packet.m_triangles[lane];
+						hit->m_barycentric   = { us[lane], vs[lane] };
+						found = true;
+					}
+				}
+
+				continue;
+			}
+
+			// Intersect four AABBs at once (slab test).
+			const auto& node = m_nodes[entry.m_child];
+			const auto t1x = _mm_mul_ps(_mm_sub_ps(node.m_min[0], o[0]), inv_d[0]);
+			const auto t2x = _mm_mul_ps(_mm_sub_ps(node.m_max[0], o[0]), inv_d[0]);
+			const auto t1y = _mm_mul_ps(_mm_sub_ps(node.m_min[1], o[1]), inv_d[1]);
+			const auto t2y = _mm_mul_ps(_mm_sub_ps(node.m_max[1], o[1]), inv_d[1]);
+			const auto t1z = _mm_mul_ps(_mm_sub_ps(node.m_min[2], o[2]), inv_d[2]);
+			const auto t2z = _mm_mul_ps(_mm_sub_ps(node.m_max[2], o[2]), inv_d[2]);
+
+			auto t_near = _mm_max_ps(_mm_min_ps(t1x, t2x), _mm_min_ps(t1y, t2y));
+			t_near      = _mm_max_ps(t_near, _mm_max_ps(_mm_min_ps(t1z, t2z), zero));
+			auto t_far  = _mm_min_ps(_mm_max_ps(t1x, t2x), _mm_max_ps(t1y, t2y));
+			t_far       = _mm_min_ps(t_far, _mm_min_ps(_mm_max_ps(t1z, t2z),
+												   _mm_set1_ps(max_distance)));
+
+			auto mask = _mm_movemask_ps(_mm_cmple_ps(t_near, t_far));
+			if (0 == mask) {
+				continue;
+			}
+
+			alignas(16) F32 distances[4];
+			_mm_store_ps(distances, t_near);
+
+			// Push the hit children from far to near to visit the nearest
+			// child first.
+			StackEntry hits[4];
+			std::size_t nb_hits = 0u;
+			for (std::size_t lane = 0u; 0 != mask; ++lane, mask >>= 1) {
+				if (0 == (mask & 1) || s_null_child == node.m_children[lane]) {
+					continue;
+				}
+
+				StackEntry current = { node.m_children[lane], distances[lane] };
+				auto i = nb_hits++;
+				for (; 0u < i && hits[i - 1u].m_distance < current.m_distance; --i) {
+					hits[i] = hits[i - 1u];
+				}
+				hits[i] = current;
+			}
+
+			for (std::size_t i = 0u; i < nb_hits; ++i) {
+				stack[stack_size++] = hits[i];
+			}
+		}
+
+		return found;
+	}
+
+	bool XM_CALLCONV TriangleBVH::Intersect(FXMVECTOR origin,
+											FXMVECTOR direction,
+											F32 max_distance,
+											RayHit& hit) const noexcept {
+
+		return Traverse< false >(origin, direction, max_distance, &hit);
+	}
+
+	[[nodiscard]]
+	bool XM_CALLCONV TriangleBVH::Occluded(FXMVECTOR origin,
+										   FXMVECTOR direction,
+										   F32 max_distance) const noexcept {
+
+		return Traverse< true >(origin, direction, max_distance, nullptr);
+	}
+
+	std::size_t TriangleBVH::Intersect(gsl::span< const Ray > rays,
+									   gsl::span< RayHit > hits) const noexcept {
+		Assert(rays.size() == hits.size());
+
+		std::size_t nb_hits = 0u;
+		for (std::ptrdiff_t i = 0; i < rays.size(); ++i) {
+			const auto& ray = rays[i];
+			auto& hit = hits[i];
+
+			hit = RayHit();
+			if (Intersect(XMLoad(ray.m_origin), XMLoad(ray.m_direction),
+						  ray.m_max_distance, hit)) {
+				++nb_hits;
+			}
+		}
+
+		return nb_hits;
+	}
+}
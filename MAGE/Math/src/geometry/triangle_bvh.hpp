@@ -0,0 +1,419 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/bounding_volume.hpp"
+#include "geometry/ray.hpp"
+#include "collection/vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	#pragma warning( push )
+	#pragma warning( disable : 4324 ) // Added padding.
+
+	/**
+	 A class of triangle bounding volume hierarchies.
+
+	 A triangle bounding volume hierarchy is a static, 4-wide bounding volume
+	 hierarchy over the triangles of a mesh. It is built top-down with the
+	 surface area heuristic. Each node stores the AABBs of its (at most)
+	 four children as structure of arrays, and each leaf stores (at most)
+	 four triangles as structure of arrays, so that a ray is intersected
+	 with four AABBs or four triangles at once.
+
+	 Distances along rays are expressed in units of the length of the
+	 direction of the rays. This allows rays to be transformed to object
+	 space with non-rigid transformations without renormalizing their
+	 direction.
+	 */
+	class TriangleBVH {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of nodes of triangle bounding volume hierarchies.
+		 */
+		struct alignas(16) Node {
+
+		public:
+
+			/**
+			 The minimum x, y and z coordinates of the AABBs of the children
+			 of this node (one child per lane).
+			 */
+			XMVECTOR m_min[3];
+
+			/**
+			 The maximum x, y and z coordinates of the AABBs of the children
+			 of this node (one child per lane).
+			 */
+			XMVECTOR m_max[3];
+
+			/**
+			 The children of this node. An internal child is the index of a
+			 node, a leaf child is the index of a triangle packet tagged with
+			 @c s_leaf_flag, and an absent child is @c s_null_child.
+			 */
+			U32 m_children[4];
+		};
+
+		/**
+		 A struct of packets of (at most) four triangles.
+		 */
+		struct alignas(16) TrianglePacket {
+
+		public:
+
+			/**
+			 The x, y and z coordinates of the first vertices of the
+			 triangles of this triangle packet (one triangle per lane).
+			 */
+			XMVECTOR m_v0[3];
+
+			/**
+			 The x, y and z coordinates of the first edges (from the first
+			 to the second vertex) of the triangles of this triangle packet.
+			 */
+			XMVECTOR m_e1[3];
+
+			/**
+			 The x, y and z coordinates of the second edges (from the first
+			 to the third vertex) of the triangles of this triangle packet.
+			 */
+			XMVECTOR m_e2[3];
+
+			/**
+			 The indices of the triangles of this triangle packet (invalid
+			 for absent triangles).
+			 */
+			U32 m_triangles[4];
+		};
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an empty triangle bounding volume hierarchy.
+		 */
+		TriangleBVH() noexcept;
+
+		/**
+		 Constructs a triangle bounding volume hierarchy for the given
+		 triangles.
+
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
+		 @param[in]		vertices
+						A reference to the vertices.
+		 @param[in]		indices
+						A reference to the indices of the triangles.
+		 @param[in]		base_vertex
+						The base vertex which is added to each index before
+						reading a vertex.
+		 */
+		template< typename VertexT, typename IndexT >
+		explicit TriangleBVH(gsl::span< const VertexT > vertices,
+							 gsl::span< const IndexT > indices,
+							 std::size_t base_vertex = 0u);
+
+		/**
+		 Constructs a triangle bounding volume hierarchy from the given
+		 triangle bounding volume hierarchy.
+
+		 @param[in]		bvh
+						A reference to the triangle bounding volume hierarchy
+						to copy.
+		 */
+		TriangleBVH(const TriangleBVH& bvh);
+
+		/**
+		 Constructs a triangle bounding volume hierarchy from the given nodes
+		 and triangle packets (e.g., of a previously built triangle bounding
+		 volume hierarchy).
+
+		 @pre			@c IsValid(nodes, packets) is @c true.
+		 @param[in]		aabb
+						A reference to the AABB of the triangles.
+		 @param[in]		nodes
+						The nodes (the first node is the root node).
+		 @param[in]		packets
+						The triangle packets.
+		 */
+		explicit TriangleBVH(const AABB& aabb,
+							 gsl::span< const Node > nodes,
+							 gsl::span< const TrianglePacket > packets);
+
+		/**
+		 Constructs a triangle bounding volume hierarchy by moving the given
+		 triangle bounding volume hierarchy.
+
+		 @param[in]		bvh
+						A reference to the triangle bounding volume hierarchy
+						to move.
+		 */
+		TriangleBVH(TriangleBVH&& bvh) noexcept;
+
+		/**
+		 Destructs this triangle bounding volume hierarchy.
+		 */
+		~TriangleBVH();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given triangle bounding volume hierarchy to this triangle
+		 bounding volume hierarchy.
+
+		 @param[in]		bvh
+						A reference to the triangle bounding volume hierarchy
+						to copy.
+		 @return		A reference to the copy of the given triangle bounding
+						volume hierarchy (i.e. this triangle bounding volume
+						hierarchy).
+		 */
+		TriangleBVH& operator=(const TriangleBVH& bvh);
+
+		/**
+		 Moves the given triangle bounding volume hierarchy to this triangle
+		 bounding volume hierarchy.
+
+		 @param[in]		bvh
+						A reference to the triangle bounding volume hierarchy
+						to move.
+		 @return		A reference to the moved triangle bounding volume
+						hierarchy (i.e. this triangle bounding volume
+						hierarchy).
+		 */
+		TriangleBVH& operator=(TriangleBVH&& bvh) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this triangle bounding volume hierarchy is empty.
+
+		 @return		@c true if this triangle bounding volume hierarchy
+						contains no triangles. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_nodes.empty();
+		}
+
+		/**
+		 Checks whether the given nodes and triangle packets form a valid
+		 triangle bounding volume hierarchy.
+
+		 The children of each node must be absent, triangle packets or nodes
+		 following the node, and the hierarchy must not be deeper than the
+		 traversal stack allows.
+
+		 @param[in]		nodes
+						The nodes (the first node is the root node).
+		 @param[in]		packets
+						The triangle packets.
+		 @return		@c true if the given nodes and triangle packets form
+						a valid triangle bounding volume hierarchy. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		static bool IsValid(gsl::span< const Node > nodes,
+							gsl::span< const TrianglePacket > packets) noexcept;
+
+		/**
+		 Returns the nodes of this triangle bounding volume hierarchy.
+
+		 @return		The nodes of this triangle bounding volume hierarchy.
+						The first node is the root node.
+		 */
+		[[nodiscard]]
+		gsl::span< const Node > GetNodes() const noexcept {
+			return gsl::make_span(m_nodes);
+		}
+
+		/**
+		 Returns the triangle packets of this triangle bounding volume
+		 hierarchy.
+
+		 @return		The triangle packets of this triangle bounding volume
+						hierarchy.
+		 */
+		[[nodiscard]]
+		gsl::span< const TrianglePacket > GetPackets() const noexcept {
+			return gsl::make_span(m_packets);
+		}
+
+		/**
+		 Returns the AABB of this triangle bounding volume hierarchy.
+
+		 @return		A reference to the AABB of this triangle bounding
+						volume hierarchy.
+		 */
+		[[nodiscard]]
+		const AABB& GetAABB() const noexcept {
+			return m_aabb;
+		}
+
+		/**
+		 Intersects the given ray with the triangles of this triangle bounding
+		 volume hierarchy and returns the closest hit.
+
+		 @param[in]		origin
+						The origin of the ray.
+		 @param[in]		direction
+						The direction of the ray.
+		 @param[in]		max_distance
+						The maximum distance along the ray.
+		 @param[out]	hit
+						A reference to the closest ray hit. The distance,
+						triangle and barycentric coordinates are only
+						updated in case of a hit.
+		 @return		@c true if the ray hits a triangle closer than the
+						given maximum distance. @c false otherwise.
+		 */
+		bool XM_CALLCONV Intersect(FXMVECTOR origin,
+								   FXMVECTOR direction,
+								   F32 max_distance,
+								   RayHit& hit) const noexcept;
+
+		/**
+		 Checks whether the given ray hits any triangle of this triangle
+		 bounding volume hierarchy.
+
+		 @param[in]		origin
+						The origin of the ray.
+		 @param[in]		direction
+						The direction of the ray.
+		 @param[in]		max_distance
+						The maximum distance along the ray.
+		 @return		@c true if the ray hits a triangle closer than the
+						given maximum distance. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool XM_CALLCONV Occluded(FXMVECTOR origin,
+								  FXMVECTOR direction,
+								  F32 max_distance) const noexcept;
+
+		/**
+		 Intersects the given rays with the triangles of this triangle
+		 bounding volume hierarchy and returns the closest hits.
+
+		 @pre			The sizes of @a rays and @a hits are equal.
+		 @param[in]		rays
+						A reference to the rays.
+		 @param[out]	hits
+						A reference to the closest ray hits.
+		 @return		The number of rays which hit a triangle.
+		 */
+		std::size_t Intersect(gsl::span< const Ray > rays,
+							  gsl::span< RayHit > hits) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The flag tagging leaf children of nodes.
+		 */
+		static constexpr U32 s_leaf_flag = 0x80000000u;
+
+		/**
+		 The index of absent children of nodes.
+		 */
+		static constexpr U32 s_null_child = std::numeric_limits< U32 >::max();
+
+		/**
+		 The maximum depth of the traversal stack.
+		 */
+		static constexpr std::size_t s_max_stack_size = 256u;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Builds this triangle bounding volume hierarchy.
+
+		 @param[in]		positions
+						A reference to the vertex positions of the triangles
+						(three consecutive vertex positions per triangle).
+		 */
+		void Build(gsl::span< const F32x3 > positions);
+
+		/**
+		 Traverses this triangle bounding volume hierarchy with the given ray.
+
+		 @tparam		AnyHit
+						@c true if the traversal terminates at the first hit.
+						@c false if the traversal searches for the closest
+						hit.
+		 @param[in]		origin
+						The origin of the ray.
+		 @param[in]		direction
+						The direction of the ray.
+		 @param[in]		max_distance
+						The maximum distance along the ray.
+		 @param[out]	hit
+						A pointer to the closest ray hit (may be @c nullptr
+						for any-hit traversals).
+		 @return		@c true if the ray hits a triangle closer than the
+						given maximum distance. @c false otherwise.
+		 */
+		template< bool AnyHit >
+		bool XM_CALLCONV Traverse(FXMVECTOR origin,
+								  FXMVECTOR direction,
+								  F32 max_distance,
+								  RayHit* hit) const noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The nodes of this triangle bounding volume hierarchy. The first node
+		 is the root node.
+		 */
+		AlignedVector< Node > m_nodes;
+
+		/**
+		 The triangle packets of this triangle bounding volume hierarchy.
+		 */
+		AlignedVector< TrianglePacket > m_packets;
+
+		/**
+		 The AABB of this triangle bounding volume hierarchy.
+		 */
+		AABB m_aabb;
+	};
+
+	#pragma warning( pop )
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/triangle_bvh.tpp"
+
+#pragma endregion
@@ -0,0 +1,35 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <utility>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename VertexT, typename IndexT >
+	TriangleBVH::TriangleBVH(gsl::span< const VertexT > vertices,
+							 gsl::span< const IndexT > indices,
+							 std::size_t base_vertex)
+		: TriangleBVH() {
+
+		const auto nb_triangles = static_cast< std::size_t >(indices.size()) / 3u;
+
+		std::vector< F32x3 > positions;
+		positions.reserve(3u * nb_triangles);
+		for (std::size_t i = 0u; i < 3u * nb_triangles; ++i) {
+			const auto index = base_vertex + static_cast< std::size_t >(indices[i]);
+			positions.push_back(vertices[index].m_p);
+		}
+
+		Build(gsl::make_span(std::as_const(positions)));
+	}
+}
@@ -6,7 +6,7 @@
 #pragma region
 
 #include "math.hpp"
-#include "logging\logging.hpp"
+#include "logging/logging.hpp"
 
 #pragma endregion
 
@@ -206,6 +206,8 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	#pragma region
 
+	#ifdef _WIN32
+
 	/**
 	 Converts the given @c RECT (left, top, right, bottom) to a @c XMVECTOR
 	 (left, top, right, bottom).
@@ -240,6 +242,8 @@ namespace mage {
 
 	}
 
+	#endif // _WIN32
+
 	/**
 	 Returns the projection values from the given projection matrix to construct
 	 the NDC z-coordinate from the view z-coordinate.
@@ -266,7 +270,7 @@ namespace mage {
 		const auto x = XMVectorGetZ(projection_matrix.r[2]);
 		const auto y = XMVectorGetZ(projection_matrix.r[3]);
 
-		return { x, y, 0.0f, 0.0f };
+		return XMVectorSet(x, y, 0.0f, 0.0f);
 	}
 
 	#pragma endregion
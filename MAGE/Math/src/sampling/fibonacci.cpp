@@ -5,7 +5,16 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "sampling\fibonacci.hpp"
+#include "sampling/fibonacci.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
 
 #pragma endregion
 
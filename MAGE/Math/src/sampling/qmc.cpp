@@ -0,0 +1,50 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "sampling/qmc.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <numeric>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	RadicalInversePermutations::RadicalInversePermutations(RNG& rng)
+		: m_offsets(),
+		m_permutations() {
+
+		m_offsets.reserve(std::size(g_primes));
+		m_permutations.reserve(std::accumulate(std::cbegin(g_primes),
+											   std::cend(g_primes),
+											   std::size_t(0u)));
+
+		for (const auto base : g_primes) {
+			const auto offset = m_permutations.size();
+			m_offsets.push_back(offset);
+
+			for (U16 digit = 0u; digit < base; ++digit) {
+				m_permutations.push_back(digit);
+			}
+
+			// Fisher-Yates shuffle of the digits.
+			const auto permutation = m_permutations.data() + offset;
+			for (std::size_t i = base - 1u; 0u < i; --i) {
+				const auto j = std::min(
+					static_cast< std::size_t >(rng.Uniform() * (i + 1u)), i);
+				std::swap(permutation[i], permutation[j]);
+			}
+		}
+	}
+}
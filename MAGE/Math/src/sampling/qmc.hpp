@@ -5,8 +5,19 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "sampling\primes.hpp"
-#include "logging\logging.hpp"
+#include "sampling/primes.hpp"
+#include "sampling/rng.hpp"
+#include "logging/logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <vector>
 
 #pragma endregion
 
@@ -15,23 +26,198 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	/**
+	 The largest single precision floating point value smaller than one.
+	 */
+	constexpr F32 g_one_minus_epsilon = 0.99999994f;
+
 	[[nodiscard]]
-	inline F32 RadicalInverse(std::size_t index, F32 base) noexcept {
-		auto result = 0.0f;
-		auto denom  = 1.0f;
+	constexpr U32 ReverseBits(U32 x) noexcept {
+		x = (x << 16u) | (x >> 16u);
+		x = ((x & 0x00FF00FFu) << 8u) | ((x & 0xFF00FF00u) >> 8u);
+		x = ((x & 0x0F0F0F0Fu) << 4u) | ((x & 0xF0F0F0F0u) >> 4u);
+		x = ((x & 0x33333333u) << 2u) | ((x & 0xCCCCCCCCu) >> 2u);
+		x = ((x & 0x55555555u) << 1u) | ((x & 0xAAAAAAAAu) >> 1u);
+		return x;
+	}
+
+	[[nodiscard]]
+	constexpr U64 ReverseBits(U64 x) noexcept {
+		return (static_cast< U64 >(ReverseBits(static_cast< U32 >(x))) << 32u)
+			 | ReverseBits(static_cast< U32 >(x >> 32u));
+	}
+
+	[[nodiscard]]
+	inline F32 RadicalInverse(std::size_t index, U32 base) noexcept {
+		if (2u == base) {
+			// The bits of the index are the (reversed) digits.
+			return ToUniformF32(static_cast< U32 >(
+				ReverseBits(static_cast< U64 >(index)) >> 32u));
+		}
+
+		// Accumulate the reversed digits as an integer to avoid a floating
+		// point division per digit.
+		const auto inv_base   = 1.0 / base;
+		auto       inv_base_n = 1.0;
+		U64        reversed   = 0u;
 
 		while (index) {
-			denom  *= base;
-			result += fmod(index, base) / denom;
-			index  /= base;
+			const auto next  = index / base;
+			const auto digit = index - next * base;
+			reversed    = reversed * base + digit;
+			inv_base_n *= inv_base;
+			index       = next;
 		}
 
-		return result;
+		return std::min(static_cast< F32 >(reversed * inv_base_n),
+						g_one_minus_epsilon);
 	}
 
 	[[nodiscard]]
 	inline F32 VanderCorput(std::size_t index) noexcept {
-		return RadicalInverse(index, 2.0f);
+		return RadicalInverse(index, 2u);
+	}
+
+	/**
+	 A class of (random) digit permutations for scrambling the radical
+	 inverses of the first 168 prime bases.
+	 */
+	class RadicalInversePermutations {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs radical inverse permutations.
+
+		 @param[in,out]	rng
+						A reference to the RNG for generating the
+						permutations.
+		 */
+		explicit RadicalInversePermutations(RNG& rng);
+
+		/**
+		 Constructs radical inverse permutations from the given radical
+		 inverse permutations.
+
+		 @param[in]		permutations
+						A reference to the radical inverse permutations to
+						copy.
+		 */
+		RadicalInversePermutations(
+			const RadicalInversePermutations& permutations) = default;
+
+		/**
+		 Constructs radical inverse permutations by moving the given radical
+		 inverse permutations.
+
+		 @param[in]		permutations
+						A reference to the radical inverse permutations to
+						move.
+		 */
+		RadicalInversePermutations(
+			RadicalInversePermutations&& permutations) noexcept = default;
+
+		/**
+		 Destructs these radical inverse permutations.
+		 */
+		~RadicalInversePermutations() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given radical inverse permutations to these radical
+		 inverse permutations.
+
+		 @param[in]		permutations
+						A reference to the radical inverse permutations to
+						copy.
+		 @return		A reference to the copy of the given radical inverse
+						permutations (i.e. these radical inverse
+						permutations).
+		 */
+		RadicalInversePermutations& operator=(
+			const RadicalInversePermutations& permutations) = default;
+
+		/**
+		 Moves the given radical inverse permutations to these radical
+		 inverse permutations.
+
+		 @param[in]		permutations
+						A reference to the radical inverse permutations to
+						move.
+		 @return		A reference to the moved radical inverse permutations
+						(i.e. these radical inverse permutations).
+		 */
+		RadicalInversePermutations& operator=(
+			RadicalInversePermutations&& permutations) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the digit permutation of the given dimension.
+
+		 @pre			@a dimension is smaller than the number of primes.
+		 @param[in]		dimension
+						The dimension (i.e. the index of the prime base).
+		 @return		The permutation of the digits of the prime base of
+						the given dimension.
+		 */
+		[[nodiscard]]
+		gsl::span< const U16 > operator[](std::size_t dimension) const noexcept {
+			Assert(dimension < std::size(g_primes));
+
+			return gsl::make_span(m_permutations.data() + m_offsets[dimension],
+								  static_cast< std::ptrdiff_t >(g_primes[dimension]));
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The offsets of the digit permutations of these radical inverse
+		 permutations.
+		 */
+		std::vector< std::size_t > m_offsets;
+
+		/**
+		 The (concatenated) digit permutations of these radical inverse
+		 permutations.
+		 */
+		std::vector< U16 > m_permutations;
+	};
+
+	[[nodiscard]]
+	inline F32 ScrambledRadicalInverse(std::size_t index, U32 base,
+									   gsl::span< const U16 > permutation) noexcept {
+		Assert(base == static_cast< U32 >(permutation.size()));
+
+		const auto inv_base   = 1.0 / base;
+		auto       inv_base_n = 1.0;
+		U64        reversed   = 0u;
+
+		while (index) {
+			const auto next  = index / base;
+			const auto digit = index - next * base;
+			reversed    = reversed * base + permutation[static_cast< std::ptrdiff_t >(digit)];
+			inv_base_n *= inv_base;
+			index       = next;
+		}
+
+		// The (infinite number of) trailing zero digits are permuted as well.
+		const auto tail = inv_base * permutation[0] / (1.0 - inv_base);
+		return std::min(static_cast< F32 >(inv_base_n * (reversed + tail)),
+						g_one_minus_epsilon);
 	}
 
 	inline void Halton(std::size_t index, gsl::span< F32 > sample) noexcept {
@@ -41,33 +227,46 @@ namespace mage {
 
 		std::size_t i = 0u;
 		for (auto& dim : sample) {
-			dim = RadicalInverse(index, static_cast< F32 >(g_primes[i++]));
+			dim = RadicalInverse(index, g_primes[i++]);
+		}
+	}
+
+	inline void ScrambledHalton(std::size_t index, gsl::span< F32 > sample,
+								const RadicalInversePermutations& permutations) noexcept {
+		using std::size;
+		const auto nb_dims = static_cast< std::size_t >(size(sample));
+		Assert(nb_dims <= std::size(g_primes));
+
+		std::size_t i = 0u;
+		for (auto& dim : sample) {
+			dim = ScrambledRadicalInverse(index, g_primes[i], permutations[i]);
+			++i;
 		}
 	}
 
 	[[nodiscard]]
 	inline const F32x2 Halton2D(std::size_t index) noexcept {
-		const auto x = RadicalInverse(index, 2.0f);
-		const auto y = RadicalInverse(index, 3.0f);
+		const auto x = RadicalInverse(index, 2u);
+		const auto y = RadicalInverse(index, 3u);
 
 		return { x, y };
 	}
 
 	[[nodiscard]]
 	inline const F32x3 Halton3D(std::size_t index) noexcept {
-		const auto x = RadicalInverse(index, 2.0f);
-		const auto y = RadicalInverse(index, 3.0f);
-		const auto z = RadicalInverse(index, 5.0f);
+		const auto x = RadicalInverse(index, 2u);
+		const auto y = RadicalInverse(index, 3u);
+		const auto z = RadicalInverse(index, 5u);
 
 		return { x, y, z };
 	}
 
 	[[nodiscard]]
 	inline const F32x4 Halton4D(std::size_t index) noexcept {
-		const auto x = RadicalInverse(index, 2.0f);
-		const auto y = RadicalInverse(index, 3.0f);
-		const auto z = RadicalInverse(index, 5.0f);
-		const auto w = RadicalInverse(index, 7.0f);
+		const auto x = RadicalInverse(index, 2u);
+		const auto y = RadicalInverse(index, 3u);
+		const auto z = RadicalInverse(index, 5u);
+		const auto w = RadicalInverse(index, 7u);
 
 		return { x, y, z, w };
 	}
@@ -87,7 +286,7 @@ namespace mage {
 
 		std::size_t i = 0u;
 		for (auto it = begin(sample) + 1; it != end(sample); ++it) {
-			*it = RadicalInverse(index, static_cast< F32 >(g_primes[i++]));
+			*it = RadicalInverse(index, g_primes[i++]);
 		}
 	}
 
@@ -96,7 +295,7 @@ namespace mage {
 		Assert(index < nb_samples);
 
 		const auto x = index / static_cast< F32 >(nb_samples);
-		const auto y = RadicalInverse(index, 2.0f);
+		const auto y = RadicalInverse(index, 2u);
 
 		return { x, y };
 	}
@@ -106,8 +305,8 @@ namespace mage {
 		Assert(index < nb_samples);
 
 		const auto x = index / static_cast< F32 >(nb_samples);
-		const auto y = RadicalInverse(index, 2.0f);
-		const auto z = RadicalInverse(index, 3.0f);
+		const auto y = RadicalInverse(index, 2u);
+		const auto z = RadicalInverse(index, 3u);
 
 		return { x, y, z };
 	}
@@ -117,9 +316,9 @@ namespace mage {
 		Assert(index < nb_samples);
 
 		const auto x = index / static_cast< F32 >(nb_samples);
-		const auto y = RadicalInverse(index, 2.0f);
-		const auto z = RadicalInverse(index, 3.0f);
-		const auto w = RadicalInverse(index, 5.0f);
+		const auto y = RadicalInverse(index, 2u);
+		const auto z = RadicalInverse(index, 3u);
+		const auto w = RadicalInverse(index, 5u);
 
 		return { x, y, z, w };
 	}
@@ -128,4 +327,4 @@ namespace mage {
 	inline const F32x2 Roth(std::size_t index, size_t nb_samples) noexcept {
 		return Hammersley2D(index, nb_samples);
 	}
-}
\ No newline at end of file
+}
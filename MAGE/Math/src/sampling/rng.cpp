@@ -0,0 +1,256 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "sampling/rng.hpp"
+#include "parallel/parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <immintrin.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The number of xoshiro256** streams of a batch RNG.
+		 */
+		constexpr std::size_t g_nb_streams = 4u;
+
+		/**
+		 The number of uniform random numbers generated per step of a batch
+		 RNG (i.e. two per stream).
+		 */
+		constexpr std::size_t g_nb_values_per_step = 2u * g_nb_streams;
+
+		/**
+		 Rotates the given words to the left.
+		 */
+		template< int K >
+		[[nodiscard]]
+		inline __m128i RotateLeft(__m128i x) noexcept {
+			return _mm_or_si128(_mm_slli_epi64(x, K), _mm_srli_epi64(x, 64 - K));
+		}
+
+		/**
+		 Rotates the given words to the left.
+		 */
+		template< int K >
+		[[nodiscard]]
+		MAGE_TARGET_AVX2
+		inline __m256i RotateLeft(__m256i x) noexcept {
+			return _mm256_or_si256(_mm256_slli_epi64(x, K),
+								   _mm256_srli_epi64(x, 64 - K));
+		}
+
+		/**
+		 Generates uniform random numbers with two xoshiro256** streams at a
+		 time (SSE2).
+
+		 @return		The number of generated numbers.
+		 */
+		std::size_t GenerateSSE2(U64 (&state)[4][4],
+								 F32* values, std::size_t nb_values,
+								 F32 low, F32 high) noexcept {
+
+			const auto scale  = _mm_set1_ps((high - low) * (1.0f / 16777216.0f));
+			const auto offset = _mm_set1_ps(low);
+
+			std::size_t i = 0u;
+			for (std::size_t half = 0u; half < 2u; ++half) {
+				auto s0 = _mm_load_si128(reinterpret_cast< const __m128i* >(state[0] + 2u * half));
+				auto s1 = _mm_load_si128(reinterpret_cast< const __m128i* >(state[1] + 2u * half));
+				auto s2 = _mm_load_si128(reinterpret_cast< const __m128i* >(state[2] + 2u * half));
+				auto s3 = _mm_load_si128(reinterpret_cast< const __m128i* >(state[3] + 2u * half));
+
+				// The first half generates the first four numbers of each
+				// step and the second half the last four numbers.
+				for (i = 0u; i + g_nb_values_per_step <= nb_values;
+					 i += g_nb_values_per_step) {
+
+					// result = rotl(s1 * 5, 7) * 9
+					const auto s1x5   = _mm_add_epi64(_mm_slli_epi64(s1, 2), s1);
+					const auto r      = RotateLeft< 7 >(s1x5);
+					const auto result = _mm_add_epi64(_mm_slli_epi64(r, 3), r);
+
+					const auto t = _mm_slli_epi64(s1, 17);
+					s2 = _mm_xor_si128(s2, s0);
+					s3 = _mm_xor_si128(s3, s1);
+					s1 = _mm_xor_si128(s1, s2);
+					s0 = _mm_xor_si128(s0, s3);
+					s2 = _mm_xor_si128(s2, t);
+					s3 = RotateLeft< 45 >(s3);
+
+					// The 24 most significant bits of each 32 bit half.
+					const auto bits = _mm_cvtepi32_ps(_mm_srli_epi32(result, 8));
+					_mm_storeu_ps(values + i + 4u * half,
+								  _mm_add_ps(_mm_mul_ps(bits, scale), offset));
+				}
+
+				_mm_store_si128(reinterpret_cast< __m128i* >(state[0] + 2u * half), s0);
+				_mm_store_si128(reinterpret_cast< __m128i* >(state[1] + 2u * half), s1);
+				_mm_store_si128(reinterpret_cast< __m128i* >(state[2] + 2u * half), s2);
+				_mm_store_si128(reinterpret_cast< __m128i* >(state[3] + 2u * half), s3);
+			}
+
+			return i;
+		}
+
+		/**
+		 Generates uniform random numbers with four xoshiro256** streams at
+		 a time (AVX2).
+
+		 @pre			The processor supports AVX2 instructions.
+		 @return		The number of generated numbers.
+		 */
+		MAGE_TARGET_AVX2
+		std::size_t GenerateAVX2(U64 (&state)[4][4],
+								 F32* values, std::size_t nb_values,
+								 F32 low, F32 high) noexcept {
+
+			const auto scale  = _mm256_set1_ps((high - low) * (1.0f / 16777216.0f));
+			const auto offset = _mm256_set1_ps(low);
+
+			auto s0 = _mm256_load_si256(reinterpret_cast< const __m256i* >(state[0]));
+			auto s1 = _mm256_load_si256(reinterpret_cast< const __m256i* >(state[1]));
+			auto s2 = _mm256_load_si256(reinterpret_cast< const __m256i* >(state[2]));
+			auto s3 = _mm256_load_si256(reinterpret_cast< const __m256i* >(state[3]));
+
+			std::size_t i = 0u;
+			for (; i + g_nb_values_per_step <= nb_values; i += g_nb_values_per_step) {
+				// result = rotl(s1 * 5, 7) * 9
+				const auto s1x5   = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+				const auto r      = RotateLeft< 7 >(s1x5);
+				const auto result = _mm256_add_epi64(_mm256_slli_epi64(r, 3), r);
+
+				const auto t = _mm256_slli_epi64(s1, 17);
+				s2 = _mm256_xor_si256(s2, s0);
+				s3 = _mm256_xor_si256(s3, s1);
+				s1 = _mm256_xor_si256(s1, s2);
+				s0 = _mm256_xor_si256(s0, s3);
+				s2 = _mm256_xor_si256(s2, t);
+				s3 = RotateLeft< 45 >(s3);
+
+				// The 24 most significant bits of each 32 bit half.
+				const auto bits = _mm256_cvtepi32_ps(_mm256_srli_epi32(result, 8));
+				_mm256_storeu_ps(values + i,
+								 _mm256_add_ps(_mm256_mul_ps(bits, scale), offset));
+			}
+
+			_mm256_store_si256(reinterpret_cast< __m256i* >(state[0]), s0);
+			_mm256_store_si256(reinterpret_cast< __m256i* >(state[1]), s1);
+			_mm256_store_si256(reinterpret_cast< __m256i* >(state[2]), s2);
+			_mm256_store_si256(reinterpret_cast< __m256i* >(state[3]), s3);
+
+			return i;
+		}
+
+		/**
+		 Generates one step of uniform random numbers, one xoshiro256**
+		 stream at a time.
+		 */
+		void GenerateStep(U64 (&state)[4][4],
+						  F32 (&values)[g_nb_values_per_step],
+						  F32 low, F32 high) noexcept {
+
+			const auto scale = (high - low) * (1.0f / 16777216.0f);
+
+			for (std::size_t stream = 0u; stream < g_nb_streams; ++stream) {
+				const auto rotate_left = [](U64 x, unsigned int k) noexcept {
+					return (x << k) | (x >> (64u - k));
+				};
+
+				auto& s0 = state[0][stream];
+				auto& s1 = state[1][stream];
+				auto& s2 = state[2][stream];
+				auto& s3 = state[3][stream];
+
+				const auto result = rotate_left(s1 * 5u, 7u) * 9u;
+
+				const auto t = s1 << 17u;
+				s2 ^= s0;
+				s3 ^= s1;
+				s1 ^= s2;
+				s0 ^= s3;
+				s2 ^= t;
+				s3  = rotate_left(s3, 45u);
+
+				const auto lo = static_cast< U32 >(result);
+				const auto hi = static_cast< U32 >(result >> 32u);
+				values[2u * stream]      = static_cast< F32 >(lo >> 8u) * scale + low;
+				values[2u * stream + 1u] = static_cast< F32 >(hi >> 8u) * scale + low;
+			}
+		}
+	}
+
+	BatchRNG::BatchRNG(U64 seed) noexcept
+		: m_state{} {
+
+		Seed(seed);
+	}
+
+	void BatchRNG::Seed(U64 seed) noexcept {
+		Xoshiro256StarStar rng(seed);
+		for (std::size_t stream = 0u; stream < g_nb_streams; ++stream) {
+			const auto stream_rng = rng.Split();
+			for (std::size_t word = 0u; word < 4u; ++word) {
+				m_state[word][stream] = stream_rng.GetState(word);
+			}
+		}
+	}
+
+	[[nodiscard]]
+	BatchRNG BatchRNG::Split() noexcept {
+		const auto rng = *this;
+
+		for (std::size_t stream = 0u; stream < g_nb_streams; ++stream) {
+			Xoshiro256StarStar stream_rng;
+			for (std::size_t word = 0u; word < 4u; ++word) {
+				stream_rng.SetState(word, m_state[word][stream]);
+			}
+			stream_rng.LongJump();
+			for (std::size_t word = 0u; word < 4u; ++word) {
+				m_state[word][stream] = stream_rng.GetState(word);
+			}
+		}
+
+		return rng;
+	}
+
+	void BatchRNG::Uniform(gsl::span< F32 > values) noexcept {
+		Uniform(values, 0.0f, 1.0f);
+	}
+
+	void BatchRNG::Uniform(gsl::span< F32 > values, F32 low, F32 high) noexcept {
+		const auto nb_values = static_cast< std::size_t >(values.size());
+
+		#ifdef __AVX2__
+		const auto i = GenerateAVX2(m_state, values.data(), nb_values, low, high);
+		#else  // __AVX2__
+		const auto i = SupportsAVX2()
+			? GenerateAVX2(m_state, values.data(), nb_values, low, high)
+			: GenerateSSE2(m_state, values.data(), nb_values, low, high);
+		#endif // __AVX2__
+
+		if (i == nb_values) {
+			return;
+		}
+
+		F32 step[g_nb_values_per_step];
+		GenerateStep(m_state, step, low, high);
+		std::copy(step, step + (nb_values - i), values.data() + i);
+	}
+}
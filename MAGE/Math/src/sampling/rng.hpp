@@ -5,23 +5,571 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
 //-----------------------------------------------------------------------------
-// System Includes
+// Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
-#pragma region
+namespace mage {
 
-#include <random>
+	/**
+	 Converts the given random bits to a uniform random number in [0,1).
 
-#pragma endregion
+	 @param[in]		bits
+					The random bits.
+	 @return		A uniform random number in [0,1) based on the 24 most
+					significant bits of @a bits.
+	 */
+	[[nodiscard]]
+	constexpr F32 ToUniformF32(U32 bits) noexcept {
+		return static_cast< F32 >(bits >> 8u) * (1.0f / 16777216.0f);
+	}
 
-//-----------------------------------------------------------------------------
-// Engine Declarations and Definitions
-//-----------------------------------------------------------------------------
-namespace mage {
+	//-------------------------------------------------------------------------
+	// PCG32
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of PCG32 (i.e. PCG-XSH-RR with 64 bit state and 32 bit output)
+	 random number generators.
+
+	 Each generator selects one of 2^63 streams (i.e. LCG increments), which
+	 allows independent generators (e.g. one per thread) with the same seed.
+	 This class satisfies the UniformRandomBitGenerator requirements.
+	 */
+	class PCG32 {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The result type of PCG32 random number generators.
+		 */
+		using result_type = U32;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the smallest value generated by PCG32 random number
+		 generators.
+
+		 @return		The smallest value generated by PCG32 random number
+						generators.
+		 */
+		[[nodiscard]]
+		static constexpr result_type min() noexcept {
+			return 0u;
+		}
+
+		/**
+		 Returns the largest value generated by PCG32 random number
+		 generators.
+
+		 @return		The largest value generated by PCG32 random number
+						generators.
+		 */
+		[[nodiscard]]
+		static constexpr result_type max() noexcept {
+			return 0xFFFFFFFFu;
+		}
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a PCG32 random number generator with the given seed and
+		 stream.
+
+		 @param[in]		seed
+						The seed.
+		 @param[in]		stream
+						The stream.
+		 */
+		constexpr explicit PCG32(U64 seed   = 0x853C49E6748FEA9Bull,
+								 U64 stream = 0xDA3E39CB94B95BDBull) noexcept
+			: m_state(0u),
+			m_increment(0u) {
+
+			Seed(seed, stream);
+		}
+
+		/**
+		 Constructs a PCG32 random number generator from the given PCG32
+		 random number generator.
+
+		 @param[in]		rng
+						A reference to the PCG32 random number generator to
+						copy.
+		 */
+		constexpr PCG32(const PCG32& rng) noexcept = default;
+
+		/**
+		 Constructs a PCG32 random number generator by moving the given PCG32
+		 random number generator.
+
+		 @param[in]		rng
+						A reference to the PCG32 random number generator to
+						move.
+		 */
+		constexpr PCG32(PCG32&& rng) noexcept = default;
+
+		/**
+		 Destructs this PCG32 random number generator.
+		 */
+		~PCG32() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given PCG32 random number generator to this PCG32 random
+		 number generator.
+
+		 @param[in]		rng
+						A reference to the PCG32 random number generator to
+						copy.
+		 @return		A reference to the copy of the given PCG32 random
+						number generator (i.e. this PCG32 random number
+						generator).
+		 */
+		constexpr PCG32& operator=(const PCG32& rng) noexcept = default;
+
+		/**
+		 Moves the given PCG32 random number generator to this PCG32 random
+		 number generator.
+
+		 @param[in]		rng
+						A reference to the PCG32 random number generator to
+						move.
+		 @return		A reference to the moved PCG32 random number generator
+						(i.e. this PCG32 random number generator).
+		 */
+		constexpr PCG32& operator=(PCG32&& rng) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Seeds this PCG32 random number generator.
+
+		 @param[in]		seed
+						The seed.
+		 @param[in]		stream
+						The stream.
+		 */
+		constexpr void Seed(U64 seed, U64 stream) noexcept {
+			m_state     = 0u;
+			m_increment = (stream << 1u) | 1u;
+			(*this)();
+			m_state += seed;
+			(*this)();
+		}
+
+		/**
+		 Generates the next random number of this PCG32 random number
+		 generator.
+
+		 @return		The next random number.
+		 */
+		constexpr result_type operator()() noexcept {
+			const auto state = m_state;
+			m_state = state * s_multiplier + m_increment;
+
+			const auto xorshifted = static_cast< U32 >(((state >> 18u) ^ state) >> 27u);
+			const auto rotation   = static_cast< U32 >(state >> 59u);
+			return (xorshifted >> rotation) | (xorshifted << ((0u - rotation) & 31u));
+		}
+
+		/**
+		 Advances this PCG32 random number generator by the given number of
+		 steps in logarithmic time.
+
+		 @param[in]		delta
+						The number of steps (modulo 2^64, i.e. negative
+						steps move this PCG32 random number generator
+						backwards).
+		 */
+		constexpr void Advance(U64 delta) noexcept {
+			U64 multiplier     = s_multiplier;
+			U64 increment      = m_increment;
+			U64 acc_multiplier = 1u;
+			U64 acc_increment  = 0u;
+
+			for (; 0u != delta; delta >>= 1u) {
+				if (delta & 1u) {
+					acc_multiplier *= multiplier;
+					acc_increment   = acc_increment * multiplier + increment;
+				}
+
+				increment  *= multiplier + 1u;
+				multiplier *= multiplier;
+			}
+
+			m_state = acc_multiplier * m_state + acc_increment;
+		}
+
+		/**
+		 Generates a uniform random number in [0,1).
+
+		 @return		A uniform random number in [0,1).
+		 */
+		constexpr F32 Uniform() noexcept {
+			return ToUniformF32((*this)());
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The multiplier of the LCG of PCG32 random number generators.
+		 */
+		static constexpr U64 s_multiplier = 6364136223846793005ull;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The state of this PCG32 random number generator.
+		 */
+		U64 m_state;
+
+		/**
+		 The (odd) increment (i.e. the stream) of this PCG32 random number
+		 generator.
+		 */
+		U64 m_increment;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Xoshiro256StarStar
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of xoshiro256** random number generators.
+
+	 The period of 2^256 - 1 is partitioned by jumps of 2^128 and 2^192
+	 steps, which results in non-overlapping subsequences for independent
+	 generators (e.g. one per thread). This class satisfies the
+	 UniformRandomBitGenerator requirements.
+	 */
+	class Xoshiro256StarStar {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The result type of xoshiro256** random number generators.
+		 */
+		using result_type = U64;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the smallest value generated by xoshiro256** random number
+		 generators.
+
+		 @return		The smallest value generated by xoshiro256** random
+						number generators.
+		 */
+		[[nodiscard]]
+		static constexpr result_type min() noexcept {
+			return 0u;
+		}
+
+		/**
+		 Returns the largest value generated by xoshiro256** random number
+		 generators.
+
+		 @return		The largest value generated by xoshiro256** random
+						number generators.
+		 */
+		[[nodiscard]]
+		static constexpr result_type max() noexcept {
+			return 0xFFFFFFFFFFFFFFFFull;
+		}
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a xoshiro256** random number generator with the given
+		 seed.
+
+		 @param[in]		seed
+						The seed.
+		 */
+		constexpr explicit Xoshiro256StarStar(U64 seed = 606418532u) noexcept
+			: m_state{} {
+
+			Seed(seed);
+		}
+
+		/**
+		 Constructs a xoshiro256** random number generator from the given
+		 xoshiro256** random number generator.
+
+		 @param[in]		rng
+						A reference to the xoshiro256** random number
+						generator to copy.
+		 */
+		constexpr Xoshiro256StarStar(const Xoshiro256StarStar& rng) noexcept = default;
+
+		/**
+		 Constructs a xoshiro256** random number generator by moving the
+		 given xoshiro256** random number generator.
+
+		 @param[in]		rng
+						A reference to the xoshiro256** random number
+						generator to move.
+		 */
+		constexpr Xoshiro256StarStar(Xoshiro256StarStar&& rng) noexcept = default;
+
+		/**
+		 Destructs this xoshiro256** random number generator.
+		 */
+		~Xoshiro256StarStar() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given xoshiro256** random number generator to this
+		 xoshiro256** random number generator.
+
+		 @param[in]		rng
+						A reference to the xoshiro256** random number
+						generator to copy.
+		 @return		A reference to the copy of the given xoshiro256**
+						random number generator (i.e. this xoshiro256**
+						random number generator).
+		 */
+		constexpr Xoshiro256StarStar& operator=(
+			const Xoshiro256StarStar& rng) noexcept = default;
+
+		/**
+		 Moves the given xoshiro256** random number generator to this
+		 xoshiro256** random number generator.
+
+		 @param[in]		rng
+						A reference to the xoshiro256** random number
+						generator to move.
+		 @return		A reference to the moved xoshiro256** random number
+						generator (i.e. this xoshiro256** random number
+						generator).
+		 */
+		constexpr Xoshiro256StarStar& operator=(
+			Xoshiro256StarStar&& rng) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Seeds this xoshiro256** random number generator.
+
+		 The state is initialized with a splitmix64 generator seeded with the
+		 given seed.
+
+		 @param[in]		seed
+						The seed.
+		 */
+		constexpr void Seed(U64 seed) noexcept {
+			for (auto& state : m_state) {
+				seed += 0x9E3779B97F4A7C15ull;
+				auto z = seed;
+				z = (z ^ (z >> 30u)) * 0xBF58476D1CE4E5B9ull;
+				z = (z ^ (z >> 27u)) * 0x94D049BB133111EBull;
+				state = z ^ (z >> 31u);
+			}
+		}
+
+		/**
+		 Generates the next random number of this xoshiro256** random number
+		 generator.
+
+		 @return		The next random number.
+		 */
+		constexpr result_type operator()() noexcept {
+			const auto result = RotateLeft(m_state[1] * 5u, 7u) * 9u;
+			const auto t      = m_state[1] << 17u;
+
+			m_state[2] ^= m_state[0];
+			m_state[3] ^= m_state[1];
+			m_state[1] ^= m_state[2];
+			m_state[0] ^= m_state[3];
+			m_state[2] ^= t;
+			m_state[3]  = RotateLeft(m_state[3], 45u);
+
+			return result;
+		}
+
+		/**
+		 Advances this xoshiro256** random number generator by 2^128 steps.
+		 */
+		constexpr void Jump() noexcept {
+			constexpr U64 jump[] = {
+				0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull,
+				0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull
+			};
+
+			Jump(jump);
+		}
+
+		/**
+		 Advances this xoshiro256** random number generator by 2^192 steps.
+		 */
+		constexpr void LongJump() noexcept {
+			constexpr U64 jump[] = {
+				0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull,
+				0x77710069854EE241ull, 0x39109BB02ACBE635ull
+			};
+
+			Jump(jump);
+		}
+
+		/**
+		 Splits this xoshiro256** random number generator.
+
+		 @return		A copy of this xoshiro256** random number generator,
+						after which this xoshiro256** random number generator
+						is advanced by 2^128 steps (i.e. the returned
+						generator can generate 2^128 numbers before
+						overlapping with this generator).
+		 */
+		[[nodiscard]]
+		constexpr Xoshiro256StarStar Split() noexcept {
+			const auto rng = *this;
+			Jump();
+			return rng;
+		}
+
+		/**
+		 Generates a uniform random number in [0,1).
+
+		 @return		A uniform random number in [0,1).
+		 */
+		constexpr F32 Uniform() noexcept {
+			return ToUniformF32(static_cast< U32 >((*this)() >> 32u));
+		}
+
+		/**
+		 Returns the state of this xoshiro256** random number generator.
+
+		 @param[in]		index
+						The index of the word of the state.
+		 @return		The given word of the state of this xoshiro256**
+						random number generator.
+		 */
+		[[nodiscard]]
+		constexpr U64 GetState(std::size_t index) const noexcept {
+			return m_state[index];
+		}
+
+		/**
+		 Sets the state of this xoshiro256** random number generator.
+
+		 @pre			The words of the state are not all equal to zero.
+		 @param[in]		index
+						The index of the word of the state.
+		 @param[in]		state
+						The word of the state.
+		 */
+		constexpr void SetState(std::size_t index, U64 state) noexcept {
+			m_state[index] = state;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Rotates the given value to the left.
+
+		 @param[in]		x
+						The value.
+		 @param[in]		k
+						The number of bits (in (0, 64)).
+		 @return		The rotated value.
+		 */
+		[[nodiscard]]
+		static constexpr U64 RotateLeft(U64 x, unsigned int k) noexcept {
+			return (x << k) | (x >> (64u - k));
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Advances this xoshiro256** random number generator by the number of
+		 steps corresponding to the given jump polynomial.
+
+		 @param[in]		jump
+						A reference to the jump polynomial.
+		 */
+		constexpr void Jump(const U64 (&jump)[4]) noexcept {
+			U64 state[4] = {};
+			for (const auto word : jump) {
+				for (unsigned int bit = 0u; bit < 64u; ++bit) {
+					if (word & (1ull << bit)) {
+						state[0] ^= m_state[0];
+						state[1] ^= m_state[1];
+						state[2] ^= m_state[2];
+						state[3] ^= m_state[3];
+					}
+					(*this)();
+				}
+			}
+
+			m_state[0] = state[0];
+			m_state[1] = state[1];
+			m_state[2] = state[2];
+			m_state[3] = state[3];
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The state of this xoshiro256** random number generator.
+		 */
+		U64 m_state[4];
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// RNG
+	//-------------------------------------------------------------------------
+	#pragma region
 
 	#ifdef RNG
 		#error Illegal symbol definition.
@@ -39,16 +587,19 @@ namespace mage {
 		//-------------------------------------------------------------------------
 
 		/**
-		 Constructs a RNG with the given seed.
+		 Constructs a RNG with the given seed and stream.
 
 		 @param[in]		seed
 						The seed.
+		 @param[in]		stream
+						The stream. RNGs with the same seed and a different
+						stream generate independent sequences (e.g. one per
+						thread or task).
 		 */
-		explicit RNG(U32 seed = 606418532u) noexcept
-			: m_generator(),
-			m_distribution() {
+		explicit RNG(U32 seed = 606418532u, U64 stream = 0u) noexcept
+			: m_generator() {
 
-			Seed(seed);
+			Seed(seed, stream);
 		}
 
 		/**
@@ -103,9 +654,11 @@ namespace mage {
 
 		 @param[in]		seed
 						The seed.
+		 @param[in]		stream
+						The stream.
 		 */
-		void Seed(U32 seed) noexcept {
-			m_generator.seed(seed);
+		void Seed(U32 seed, U64 stream = 0u) noexcept {
+			m_generator.Seed(seed, stream);
 		}
 
 		/**
@@ -114,7 +667,7 @@ namespace mage {
 		 @return		A uniform random number in [0,1).
 		 */
 		F32 Uniform() noexcept {
-			return m_distribution(m_generator);
+			return m_generator.Uniform();
 		}
 
 		/**
@@ -137,15 +690,152 @@ namespace mage {
 		//-------------------------------------------------------------------------
 
 		/**
-		 The random number generator, Newer "Minimum standard", of this RNG. This
-		 LCG has a much smaller footprint compared to the default Mersenne Twister
-		 used in the std.
+		 The random number generator of this RNG. This PCG32 generator has
+		 a much smaller footprint compared to the default Mersenne Twister used
+		 in the std, and supports independent streams.
 		 */
-		std::minstd_rand m_generator;
+		PCG32 m_generator;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// BatchRNG
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of batch (uniform) random number generators.
+
+	 A batch RNG consists of four interleaved xoshiro256** streams
+	 (separated by jumps of 2^128 steps), which generate uniform random
+	 numbers with SIMD. The generated numbers do not depend on the
+	 instruction set.
+	 */
+	class alignas(32) BatchRNG {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
 
 		/**
-		 The uniform real number distribution of this RNG.
+		 Constructs a batch RNG with the given seed.
+
+		 @param[in]		seed
+						The seed.
 		 */
-		std::uniform_real_distribution< F32 > m_distribution;
+		explicit BatchRNG(U64 seed = 606418532u) noexcept;
+
+		/**
+		 Constructs a batch RNG from the given batch RNG.
+
+		 @param[in]		rng
+						A reference to the batch RNG to copy.
+		 */
+		BatchRNG(const BatchRNG& rng) noexcept = default;
+
+		/**
+		 Constructs a batch RNG by moving the given batch RNG.
+
+		 @param[in]		rng
+						A reference to the batch RNG to move.
+		 */
+		BatchRNG(BatchRNG&& rng) noexcept = default;
+
+		/**
+		 Destructs this batch RNG.
+		 */
+		~BatchRNG() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given batch RNG to this batch RNG.
+
+		 @param[in]		rng
+						A reference to the batch RNG to copy.
+		 @return		A reference to the copy of the given batch RNG (i.e.
+						this batch RNG).
+		 */
+		BatchRNG& operator=(const BatchRNG& rng) noexcept = default;
+
+		/**
+		 Moves the given batch RNG to this batch RNG.
+
+		 @param[in]		rng
+						A reference to the batch RNG to move.
+		 @return		A reference to the moved batch RNG (i.e. this batch
+						RNG).
+		 */
+		BatchRNG& operator=(BatchRNG&& rng) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Seeds this batch RNG.
+
+		 @param[in]		seed
+						The seed.
+		 */
+		void Seed(U64 seed) noexcept;
+
+		/**
+		 Splits this batch RNG.
+
+		 @return		A copy of this batch RNG, after which all streams of
+						this batch RNG are advanced by 2^192 steps (i.e. the
+						returned batch RNG does not overlap with this batch
+						RNG).
+		 */
+		[[nodiscard]]
+		BatchRNG Split() noexcept;
+
+		/**
+		 Generates uniform random numbers in [0,1).
+
+		 Eight numbers are generated at a time. If the number of given
+		 values is not a multiple of eight, the remaining generated numbers
+		 are discarded.
+
+		 @param[out]	values
+						The uniform random numbers in [0,1).
+		 */
+		void Uniform(gsl::span< F32 > values) noexcept;
+
+		/**
+		 Generates uniform random numbers in [@a start,@a end).
+
+		 Eight numbers are generated at a time. If the number of given
+		 values is not a multiple of eight, the remaining generated numbers
+		 are discarded.
+
+		 @param[out]	values
+						The uniform random numbers in [@a start,@a end).
+		 @param[in]		low
+						The lower (inclusive) bound of the interval.
+		 @param[in]		high
+						The upper (exclusive) bound of the interval.
+		 */
+		void Uniform(gsl::span< F32 > values, F32 low, F32 high) noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The states of the xoshiro256** streams of this batch RNG (i.e. one
+		 array of words per word of the state and one word per stream).
+		 */
+		U64 m_state[4][4];
 	};
+
+	#pragma endregion
 }
@@ -0,0 +1,259 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "sampling\rng.hpp"
+#include "logging\logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The number of dimensions of the Sobol sequence.
+	 */
+	constexpr std::size_t g_sobol_nb_dimensions = 21u;
+
+	namespace details {
+
+		/**
+		 The number of bits of each direction number of the Sobol sequence.
+		 */
+		constexpr std::size_t g_sobol_nb_bits = 32u;
+
+		/**
+		 A struct of initializers of the direction numbers of one dimension
+		 of the Sobol sequence.
+		 */
+		struct SobolInitializer {
+
+			/**
+			 The degree of the primitive polynomial.
+			 */
+			U32 m_degree;
+
+			/**
+			 The coefficients of the primitive polynomial (without the
+			 leading and trailing coefficients).
+			 */
+			U32 m_coefficients;
+
+			/**
+			 The initial direction numbers.
+			 */
+			U32 m_m[7];
+		};
+
+		/**
+		 The initializers of the direction numbers of the second up to and
+		 including the last dimension of the Sobol sequence (Joe and Kuo,
+		 new-joe-kuo-6.21201).
+		 */
+		constexpr SobolInitializer g_sobol_initializers[] = {
+			{ 1u,  0u, { 1u } },
+			{ 2u,  1u, { 1u, 3u } },
+			{ 3u,  1u, { 1u, 3u, 1u } },
+			{ 3u,  2u, { 1u, 1u, 1u } },
+			{ 4u,  1u, { 1u, 1u, 3u, 3u } },
+			{ 4u,  4u, { 1u, 3u, 5u, 13u } },
+			{ 5u,  2u, { 1u, 1u, 5u, 5u, 17u } },
+			{ 5u,  4u, { 1u, 1u, 5u, 5u, 5u } },
+			{ 5u,  7u, { 1u, 1u, 7u, 11u, 19u } },
+			{ 5u, 11u, { 1u, 1u, 5u, 1u, 1u } },
+			{ 5u, 13u, { 1u, 1u, 1u, 3u, 11u } },
+			{ 5u, 14u, { 1u, 3u, 5u, 5u, 31u } },
+			{ 6u,  1u, { 1u, 3u, 3u, 9u, 7u, 49u } },
+			{ 6u, 13u, { 1u, 1u, 1u, 15u, 21u, 21u } },
+			{ 6u, 16u, { 1u, 3u, 1u, 13u, 27u, 49u } },
+			{ 6u, 19u, { 1u, 1u, 1u, 15u, 7u, 5u } },
+			{ 6u, 22u, { 1u, 3u, 1u, 15u, 13u, 25u } },
+			{ 6u, 25u, { 1u, 1u, 5u, 5u, 19u, 61u } },
+			{ 7u,  1u, { 1u, 3u, 7u, 11u, 23u, 15u, 103u } },
+			{ 7u,  4u, { 1u, 3u, 7u, 13u, 13u, 15u, 69u } },
+		};
+
+		static_assert(std::size(g_sobol_initializers) + 1u
+					  == g_sobol_nb_dimensions);
+
+		/**
+		 Computes the generator matrices (i.e. the direction numbers) of the
+		 Sobol sequence.
+
+		 @return		The generator matrices of the Sobol sequence. The
+						32 columns of dimension @c d start at index
+						@c 32*d.
+		 */
+		[[nodiscard]]
+		constexpr const std::array< U32, g_sobol_nb_dimensions * g_sobol_nb_bits >
+			ComputeSobolMatrices() noexcept {
+
+			std::array< U32, g_sobol_nb_dimensions * g_sobol_nb_bits > matrices = {};
+
+			// The first dimension is the van der Corput sequence.
+			for (std::size_t i = 0u; i < g_sobol_nb_bits; ++i) {
+				matrices[i] = 1u << (g_sobol_nb_bits - 1u - i);
+			}
+
+			for (std::size_t d = 1u; d < g_sobol_nb_dimensions; ++d) {
+				const auto& init = g_sobol_initializers[d - 1u];
+				const auto  s    = static_cast< std::size_t >(init.m_degree);
+				const auto  v    = matrices.data() + d * g_sobol_nb_bits;
+
+				for (std::size_t i = 0u; i < s; ++i) {
+					v[i] = init.m_m[i] << (g_sobol_nb_bits - 1u - i);
+				}
+
+				for (std::size_t i = s; i < g_sobol_nb_bits; ++i) {
+					v[i] = v[i - s] ^ (v[i - s] >> s);
+					for (std::size_t k = 1u; k < s; ++k) {
+						v[i] ^= ((init.m_coefficients >> (s - 1u - k)) & 1u) * v[i - k];
+					}
+				}
+			}
+
+			return matrices;
+		}
+
+		/**
+		 The generator matrices of the Sobol sequence.
+		 */
+		constexpr std::array< U32, g_sobol_nb_dimensions * g_sobol_nb_bits >
+			g_sobol_matrices = ComputeSobolMatrices();
+	}
+
+	/**
+	 Computes the given dimension of the given sample of the Sobol sequence.
+
+	 @pre			@a dimension is smaller than @c g_sobol_nb_dimensions.
+	 @param[in]		index
+					The index of the sample.
+	 @param[in]		dimension
+					The dimension.
+	 @param[in]		scramble
+					The (random) scramble (i.e. digital shift) of the
+					dimension.
+	 @return		The given dimension of the given sample of the Sobol
+					sequence.
+	 */
+	[[nodiscard]]
+	constexpr F32 Sobol(U32 index, std::size_t dimension,
+						U32 scramble = 0u) noexcept {
+
+		auto v = details::g_sobol_matrices.data()
+			   + dimension * details::g_sobol_nb_bits;
+		auto bits = scramble;
+		for (; index; index >>= 1u, ++v) {
+			if (index & 1u) {
+				bits ^= *v;
+			}
+		}
+
+		return ToUniformF32(bits);
+	}
+
+	/**
+	 Computes the given sample of the Sobol sequence.
+
+	 @pre			The size of @a sample is not larger than
+					@c g_sobol_nb_dimensions.
+	 @param[in]		index
+					The index of the sample.
+	 @param[out]	sample
+					The sample.
+	 */
+	inline void Sobol(U32 index, gsl::span< F32 > sample) noexcept {
+		using std::size;
+		const auto nb_dims = static_cast< std::size_t >(size(sample));
+		Assert(nb_dims <= g_sobol_nb_dimensions);
+
+		std::size_t i = 0u;
+		for (auto& dim : sample) {
+			dim = Sobol(index, i++);
+		}
+	}
+
+	[[nodiscard]]
+	inline const F32x2 Sobol2D(U32 index) noexcept {
+		const auto x = Sobol(index, 0u);
+		const auto y = Sobol(index, 1u);
+
+		return { x, y };
+	}
+
+	[[nodiscard]]
+	inline const F32x3 Sobol3D(U32 index) noexcept {
+		const auto x = Sobol(index, 0u);
+		const auto y = Sobol(index, 1u);
+		const auto z = Sobol(index, 2u);
+
+		return { x, y, z };
+	}
+
+	[[nodiscard]]
+	inline const F32x4 Sobol4D(U32 index) noexcept {
+		const auto x = Sobol(index, 0u);
+		const auto y = Sobol(index, 1u);
+		const auto z = Sobol(index, 2u);
+		const auto w = Sobol(index, 3u);
+
+		return { x, y, z, w };
+	}
+
+	/**
+	 Computes the given dimension of the first samples of the Sobol
+	 sequence in Gray code order.
+
+	 Consecutive samples in Gray code order differ in one direction number,
+	 which reduces the cost per sample to a single XOR. The first 2^m
+	 samples in Gray code order are a permutation of the first 2^m samples
+	 in the natural order.
+
+	 @pre			@a dimension is smaller than @c g_sobol_nb_dimensions.
+	 @param[in]		dimension
+					The dimension.
+	 @param[out]	samples
+					The samples.
+	 @param[in]		scramble
+					The (random) scramble (i.e. digital shift) of the
+					dimension.
+	 */
+	inline void SobolSamples(std::size_t dimension, gsl::span< F32 > samples,
+							 U32 scramble = 0u) noexcept {
+
+		Assert(dimension < g_sobol_nb_dimensions);
+
+		const auto v = details::g_sobol_matrices.data()
+			         + dimension * details::g_sobol_nb_bits;
+
+		auto bits = scramble;
+		U32 index = 0u;
+		for (auto& sample : samples) {
+			sample = ToUniformF32(bits);
+
+			// The column of the rightmost zero bit of the current index
+			// (i.e. the rightmost one bit of the next index).
+			++index;
+			std::size_t column = 0u;
+			for (auto i = index;
+				 !(i & 1u) && column + 1u < details::g_sobol_nb_bits; i >>= 1u) {
+				++column;
+			}
+			bits ^= v[column];
+		}
+	}
+}
@@ -0,0 +1,1034 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "spectrum/spectrum_conversion.hpp"
+#include "logging/logging.hpp"
+#include "parallel/parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <immintrin.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		//---------------------------------------------------------------------
+		// Lanes
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of scalar lanes (i.e. one value at a time) for the remaining
+		 values of the batch kernels.
+		 */
+		struct ScalarLanes {
+
+		public:
+
+			using Vector  = F32;
+			using Integer = U32;
+
+			static constexpr std::size_t s_width = 1u;
+
+			[[nodiscard]]
+			static Vector Load(const F32* p) noexcept { return *p; }
+
+			[[nodiscard]]
+			static Vector LoadStrided(const F32* p, std::size_t) noexcept {
+				return *p;
+			}
+
+			static void Store(F32* p, Vector v) noexcept { *p = v; }
+
+			static void StoreStrided(F32* p, std::size_t, Vector v) noexcept {
+				*p = v;
+			}
+
+			static void Store(U32* p, Integer v) noexcept { *p = v; }
+
+			[[nodiscard]]
+			static Vector Set(F32 f) noexcept { return f; }
+
+			[[nodiscard]]
+			static Integer Set(U32 u) noexcept { return u; }
+
+			[[nodiscard]]
+			static Vector Add(Vector a, Vector b) noexcept { return a + b; }
+
+			[[nodiscard]]
+			static Vector Sub(Vector a, Vector b) noexcept { return a - b; }
+
+			[[nodiscard]]
+			static Vector Mul(Vector a, Vector b) noexcept { return a * b; }
+
+			[[nodiscard]]
+			static Vector MulAdd(Vector a, Vector b, Vector c) noexcept {
+				return a * b + c;
+			}
+
+			[[nodiscard]]
+			static Vector Div(Vector a, Vector b) noexcept { return a / b; }
+
+			[[nodiscard]]
+			static Vector Min(Vector a, Vector b) noexcept { return std::min(a, b); }
+
+			[[nodiscard]]
+			static Vector Max(Vector a, Vector b) noexcept { return std::max(a, b); }
+
+			[[nodiscard]]
+			static Vector SelectLessEqual(Vector a, Vector b,
+										  Vector t, Vector f) noexcept {
+				return (a <= b) ? t : f;
+			}
+
+			[[nodiscard]]
+			static Integer AsInteger(Vector v) noexcept {
+				Integer i;
+				std::memcpy(&i, &v, sizeof(i));
+				return i;
+			}
+
+			[[nodiscard]]
+			static Vector AsVector(Integer i) noexcept {
+				Vector v;
+				std::memcpy(&v, &i, sizeof(v));
+				return v;
+			}
+
+			[[nodiscard]]
+			static Integer Round(Vector v) noexcept {
+				return static_cast< Integer >(static_cast< S32 >(std::nearbyint(v)));
+			}
+
+			[[nodiscard]]
+			static Integer Truncate(Vector v) noexcept {
+				return static_cast< Integer >(static_cast< S32 >(v));
+			}
+
+			[[nodiscard]]
+			static Vector Convert(Integer i) noexcept {
+				return static_cast< Vector >(static_cast< S32 >(i));
+			}
+
+			[[nodiscard]]
+			static Integer Add(Integer a, Integer b) noexcept { return a + b; }
+
+			[[nodiscard]]
+			static Integer Sub(Integer a, Integer b) noexcept { return a - b; }
+
+			[[nodiscard]]
+			static Integer And(Integer a, Integer b) noexcept { return a & b; }
+
+			[[nodiscard]]
+			static Integer Or(Integer a, Integer b) noexcept { return a | b; }
+
+			[[nodiscard]]
+			static Integer ShiftLeft(Integer a, int n) noexcept { return a << n; }
+
+			[[nodiscard]]
+			static Integer ShiftRight(Integer a, int n) noexcept { return a >> n; }
+
+			[[nodiscard]]
+			static Integer SelectGreater(Integer a, Integer b,
+										 Integer t, Integer f) noexcept {
+				return (static_cast< S32 >(a) > static_cast< S32 >(b)) ? t : f;
+			}
+		};
+
+		/**
+		 A struct of SSE2 lanes (i.e. four values at a time).
+		 */
+		struct SSE2Lanes {
+
+		public:
+
+			using Vector  = __m128;
+			using Integer = __m128i;
+
+			static constexpr std::size_t s_width = 4u;
+
+			[[nodiscard]]
+			static Vector Load(const F32* p) noexcept { return _mm_loadu_ps(p); }
+
+			[[nodiscard]]
+			static Vector LoadStrided(const F32* p, std::size_t stride) noexcept {
+				return _mm_setr_ps(p[0u], p[stride], p[2u * stride], p[3u * stride]);
+			}
+
+			static void Store(F32* p, Vector v) noexcept { _mm_storeu_ps(p, v); }
+
+			static void StoreStrided(F32* p, std::size_t stride, Vector v) noexcept {
+				alignas(16) F32 values[s_width];
+				_mm_store_ps(values, v);
+				for (std::size_t i = 0u; i < s_width; ++i) {
+					p[i * stride] = values[i];
+				}
+			}
+
+			static void Store(U32* p, Integer v) noexcept {
+				_mm_storeu_si128(reinterpret_cast< __m128i* >(p), v);
+			}
+
+			[[nodiscard]]
+			static Vector Set(F32 f) noexcept { return _mm_set1_ps(f); }
+
+			[[nodiscard]]
+			static Integer Set(U32 u) noexcept {
+				return _mm_set1_epi32(static_cast< int >(u));
+			}
+
+			[[nodiscard]]
+			static Vector Add(Vector a, Vector b) noexcept { return _mm_add_ps(a, b); }
+
+			[[nodiscard]]
+			static Vector Sub(Vector a, Vector b) noexcept { return _mm_sub_ps(a, b); }
+
+			[[nodiscard]]
+			static Vector Mul(Vector a, Vector b) noexcept { return _mm_mul_ps(a, b); }
+
+			[[nodiscard]]
+			static Vector MulAdd(Vector a, Vector b, Vector c) noexcept {
+				return _mm_add_ps(_mm_mul_ps(a, b), c);
+			}
+
+			[[nodiscard]]
+			static Vector Div(Vector a, Vector b) noexcept { return _mm_div_ps(a, b); }
+
+			[[nodiscard]]
+			static Vector Min(Vector a, Vector b) noexcept { return _mm_min_ps(a, b); }
+
+			[[nodiscard]]
+			static Vector Max(Vector a, Vector b) noexcept { return _mm_max_ps(a, b); }
+
+			[[nodiscard]]
+			static Vector SelectLessEqual(Vector a, Vector b,
+										  Vector t, Vector f) noexcept {
+				const auto mask = _mm_cmple_ps(a, b);
+				return _mm_or_ps(_mm_and_ps(mask, t), _mm_andnot_ps(mask, f));
+			}
+
+			[[nodiscard]]
+			static Integer AsInteger(Vector v) noexcept { return _mm_castps_si128(v); }
+
+			[[nodiscard]]
+			static Vector AsVector(Integer i) noexcept { return _mm_castsi128_ps(i); }
+
+			[[nodiscard]]
+			static Integer Round(Vector v) noexcept { return _mm_cvtps_epi32(v); }
+
+			[[nodiscard]]
+			static Integer Truncate(Vector v) noexcept { return _mm_cvttps_epi32(v); }
+
+			[[nodiscard]]
+			static Vector Convert(Integer i) noexcept { return _mm_cvtepi32_ps(i); }
+
+			[[nodiscard]]
+			static Integer Add(Integer a, Integer b) noexcept { return _mm_add_epi32(a, b); }
+
+			[[nodiscard]]
+			static Integer Sub(Integer a, Integer b) noexcept { return _mm_sub_epi32(a, b); }
+
+			[[nodiscard]]
+			static Integer And(Integer a, Integer b) noexcept { return _mm_and_si128(a, b); }
+
+			[[nodiscard]]
+			static Integer Or(Integer a, Integer b) noexcept { return _mm_or_si128(a, b); }
+
+			[[nodiscard]]
+			static Integer ShiftLeft(Integer a, int n) noexcept {
+				return _mm_sll_epi32(a, _mm_cvtsi32_si128(n));
+			}
+
+			[[nodiscard]]
+			static Integer ShiftRight(Integer a, int n) noexcept {
+				return _mm_srl_epi32(a, _mm_cvtsi32_si128(n));
+			}
+
+			[[nodiscard]]
+			static Integer SelectGreater(Integer a, Integer b,
+										 Integer t, Integer f) noexcept {
+				const auto mask = _mm_cmpgt_epi32(a, b);
+				return _mm_or_si128(_mm_and_si128(mask, t), _mm_andnot_si128(mask, f));
+			}
+		};
+
+		/**
+		 A struct of AVX2 lanes (i.e. eight values at a time).
+
+		 @pre			The processor supports AVX2 and FMA3 instructions.
+		 */
+		struct AVX2Lanes {
+
+		public:
+
+			using Vector  = __m256;
+			using Integer = __m256i;
+
+			static constexpr std::size_t s_width = 8u;
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Load(const F32* p) noexcept { return _mm256_loadu_ps(p); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector LoadStrided(const F32* p, std::size_t stride) noexcept {
+				return _mm256_setr_ps(p[0u],          p[stride],
+									  p[2u * stride], p[3u * stride],
+									  p[4u * stride], p[5u * stride],
+									  p[6u * stride], p[7u * stride]);
+			}
+
+			MAGE_TARGET_AVX2
+			static void Store(F32* p, Vector v) noexcept { _mm256_storeu_ps(p, v); }
+
+			MAGE_TARGET_AVX2
+			static void StoreStrided(F32* p, std::size_t stride, Vector v) noexcept {
+				alignas(32) F32 values[s_width];
+				_mm256_store_ps(values, v);
+				for (std::size_t i = 0u; i < s_width; ++i) {
+					p[i * stride] = values[i];
+				}
+			}
+
+			MAGE_TARGET_AVX2
+			static void Store(U32* p, Integer v) noexcept {
+				_mm256_storeu_si256(reinterpret_cast< __m256i* >(p), v);
+			}
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Set(F32 f) noexcept { return _mm256_set1_ps(f); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Integer Set(U32 u) noexcept {
+				return _mm256_set1_epi32(static_cast< int >(u));
+			}
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Add(Vector a, Vector b) noexcept { return _mm256_add_ps(a, b); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Sub(Vector a, Vector b) noexcept { return _mm256_sub_ps(a, b); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Mul(Vector a, Vector b) noexcept { return _mm256_mul_ps(a, b); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector MulAdd(Vector a, Vector b, Vector c) noexcept {
+				return _mm256_fmadd_ps(a, b, c);
+			}
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Div(Vector a, Vector b) noexcept { return _mm256_div_ps(a, b); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Min(Vector a, Vector b) noexcept { return _mm256_min_ps(a, b); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Max(Vector a, Vector b) noexcept { return _mm256_max_ps(a, b); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector SelectLessEqual(Vector a, Vector b,
+										  Vector t, Vector f) noexcept {
+				return _mm256_blendv_ps(f, t, _mm256_cmp_ps(a, b, _CMP_LE_OQ));
+			}
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Integer AsInteger(Vector v) noexcept { return _mm256_castps_si256(v); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector AsVector(Integer i) noexcept { return _mm256_castsi256_ps(i); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Integer Round(Vector v) noexcept { return _mm256_cvtps_epi32(v); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Integer Truncate(Vector v) noexcept { return _mm256_cvttps_epi32(v); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Convert(Integer i) noexcept { return _mm256_cvtepi32_ps(i); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Integer Add(Integer a, Integer b) noexcept { return _mm256_add_epi32(a, b); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Integer Sub(Integer a, Integer b) noexcept { return _mm256_sub_epi32(a, b); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Integer And(Integer a, Integer b) noexcept { return _mm256_and_si256(a, b); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Integer Or(Integer a, Integer b) noexcept { return _mm256_or_si256(a, b); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Integer ShiftLeft(Integer a, int n) noexcept {
+				return _mm256_sll_epi32(a, _mm_cvtsi32_si128(n));
+			}
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Integer ShiftRight(Integer a, int n) noexcept {
+				return _mm256_srl_epi32(a, _mm_cvtsi32_si128(n));
+			}
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Integer SelectGreater(Integer a, Integer b,
+										 Integer t, Integer f) noexcept {
+				return _mm256_blendv_epi8(f, t, _mm256_cmpgt_epi32(a, b));
+			}
+		};
+
+		//---------------------------------------------------------------------
+		// Kernels
+		//---------------------------------------------------------------------
+
+		/**
+		 Calls the given kernel for each block of lanes in the given range.
+
+		 @return		The end of the processed range.
+		 */
+		template< typename LanesT, typename KernelT >
+		std::size_t ForEachBlock(std::size_t begin,
+								 std::size_t end,
+								 KernelT& kernel) noexcept {
+
+			constexpr auto width = LanesT::s_width;
+
+			auto i = begin;
+			for (; i + width <= end; i += width) {
+				kernel(LanesT(), i);
+			}
+
+			return i;
+		}
+
+		/**
+		 Calls the given kernel for each block of AVX2 lanes in the given
+		 range.
+
+		 @pre			The processor supports AVX2 and FMA3 instructions.
+		 @return		The end of the processed range.
+		 */
+		template< typename KernelT >
+		MAGE_TARGET_AVX2_FLATTEN
+		std::size_t ForEachBlockAVX2(std::size_t begin,
+									 std::size_t end,
+									 KernelT& kernel) noexcept {
+
+			return ForEachBlock< AVX2Lanes >(begin, end, kernel);
+		}
+
+		/**
+		 Calls the given kernel for all values: 8 (AVX2) or 4 (SSE2) at a
+		 time, followed by the remaining values one at a time.
+
+		 @tparam		KernelT
+						The kernel type. The kernel must accept the lanes
+						(@c ScalarLanes, @c SSE2Lanes or @c AVX2Lanes) and
+						the index of the first value of a block.
+		 */
+		template< typename KernelT >
+		void Dispatch(std::size_t size, KernelT&& kernel) noexcept {
+			#ifdef __AVX2__
+			const auto i = ForEachBlockAVX2(0u, size, kernel);
+			#else  // __AVX2__
+			const auto i = SupportsAVX2()
+				         ? ForEachBlockAVX2(0u, size, kernel)
+				         : ForEachBlock< SSE2Lanes >(0u, size, kernel);
+			#endif // __AVX2__
+
+			ForEachBlock< ScalarLanes >(i, size, kernel);
+		}
+
+		/**
+		 Computes the base-2 logarithm of the given positive values.
+
+		 The mantissa is reduced to [sqrt(2)/2, sqrt(2)], after which the
+		 series of 2 atanh((m-1)/(m+1)) is evaluated up to the ninth degree.
+		 */
+		template< typename LanesT >
+		[[nodiscard]]
+		typename LanesT::Vector Log2(typename LanesT::Vector x) noexcept {
+			using L = LanesT;
+
+			const auto bits = L::AsInteger(x);
+			auto e = L::Convert(L::Sub(L::ShiftRight(bits, 23), L::Set(127u)));
+			auto m = L::AsVector(L::Or(L::And(bits, L::Set(0x007FFFFFu)),
+									   L::Set(0x3F800000u)));
+
+			const auto sqrt2 = L::Set(1.41421356f);
+			e = L::SelectLessEqual(m, sqrt2, e, L::Add(e, L::Set(1.0f)));
+			m = L::SelectLessEqual(m, sqrt2, m, L::Mul(m, L::Set(0.5f)));
+
+			const auto t  = L::Div(L::Sub(m, L::Set(1.0f)), L::Add(m, L::Set(1.0f)));
+			const auto t2 = L::Mul(t, t);
+
+			auto p = L::MulAdd(L::Set(1.0f / 9.0f), t2, L::Set(1.0f / 7.0f));
+			p = L::MulAdd(p, t2, L::Set(1.0f / 5.0f));
+			p = L::MulAdd(p, t2, L::Set(1.0f / 3.0f));
+			p = L::MulAdd(p, t2, L::Set(1.0f));
+
+			// 2 / ln(2)
+			return L::MulAdd(L::Mul(t, p), L::Set(2.88539008f), e);
+		}
+
+		/**
+		 Computes two to the power of the given values (clamped to
+		 [-126, 126]).
+
+		 The integral part is stored in the exponent, after which the
+		 Taylor series of 2^f for the fractional part f in [-0.5, 0.5] is
+		 evaluated up to the seventh degree.
+		 */
+		template< typename LanesT >
+		[[nodiscard]]
+		typename LanesT::Vector Exp2(typename LanesT::Vector x) noexcept {
+			using L = LanesT;
+
+			x = L::Min(L::Max(x, L::Set(-126.0f)), L::Set(126.0f));
+
+			const auto n = L::Round(x);
+			// ln(2)
+			const auto z = L::Mul(L::Sub(x, L::Convert(n)), L::Set(0.693147181f));
+
+			auto p = L::MulAdd(L::Set(1.0f / 5040.0f), z, L::Set(1.0f / 720.0f));
+			p = L::MulAdd(p, z, L::Set(1.0f / 120.0f));
+			p = L::MulAdd(p, z, L::Set(1.0f / 24.0f));
+			p = L::MulAdd(p, z, L::Set(1.0f / 6.0f));
+			p = L::MulAdd(p, z, L::Set(0.5f));
+			p = L::MulAdd(p, z, L::Set(1.0f));
+			p = L::MulAdd(p, z, L::Set(1.0f));
+
+			const auto scale = L::AsVector(L::ShiftLeft(L::Add(n, L::Set(127u)), 23));
+			return L::Mul(p, scale);
+		}
+
+		/**
+		 Converts the given values from (linear) RGB to sRGB space.
+		 */
+		template< typename LanesT >
+		[[nodiscard]]
+		typename LanesT::Vector ToSRGB(typename LanesT::Vector x) noexcept {
+			using L = LanesT;
+
+			const auto low  = L::Mul(x, L::Set(12.92f));
+			const auto high = L::MulAdd(L::Set(1.055f),
+										Exp2< L >(L::Mul(Log2< L >(x),
+														 L::Set(1.0f / 2.4f))),
+										L::Set(-0.055f));
+
+			return L::SelectLessEqual(x, L::Set(0.0031308f), low, high);
+		}
+
+		/**
+		 Converts the given values from sRGB to (linear) RGB space.
+		 */
+		template< typename LanesT >
+		[[nodiscard]]
+		typename LanesT::Vector ToRGB(typename LanesT::Vector x) noexcept {
+			using L = LanesT;
+
+			const auto low  = L::Mul(x, L::Set(1.0f / 12.92f));
+			const auto base = L::Mul(L::Add(x, L::Set(0.055f)), L::Set(1.0f / 1.055f));
+			const auto high = Exp2< L >(L::Mul(Log2< L >(base), L::Set(2.4f)));
+
+			return L::SelectLessEqual(x, L::Set(0.04045f), low, high);
+		}
+
+		/**
+		 The channel index (modulo 4) of each value of a block of RGBA
+		 values starting at a multiple of four values.
+		 */
+		alignas(16) constexpr F32 g_channels[] = {
+			0.0f, 1.0f, 2.0f, 3.0f, 0.0f, 1.0f, 2.0f, 3.0f, 0.0f, 1.0f, 2.0f
+		};
+
+		/**
+		 Applies the given value transform to the color channels of the given
+		 spectra.
+
+		 @tparam		NbChannelsV
+						The number of channels of the spectra (3 or 4). The
+						fourth channel (i.e. alpha) is preserved.
+		 */
+		template< std::size_t NbChannelsV, typename InputT, typename OutputT,
+				  typename TransformT >
+		void TransformValues(gsl::span< const InputT > input,
+							 gsl::span< OutputT > output,
+							 TransformT&& transform) noexcept {
+
+			static_assert(sizeof(InputT)  == NbChannelsV * sizeof(F32));
+			static_assert(sizeof(OutputT) == NbChannelsV * sizeof(F32));
+			Assert(input.size() == output.size());
+
+			const auto in  = reinterpret_cast< const F32* >(input.data());
+			const auto out = reinterpret_cast< F32* >(output.data());
+			const auto nb_values = static_cast< std::size_t >(input.size())
+				                 * NbChannelsV;
+
+			Dispatch(nb_values, [in, out, &transform](auto lanes,
+													  std::size_t i) noexcept {
+				using L = decltype(lanes);
+
+				const auto x = L::Load(in + i);
+				auto y = transform(lanes, x);
+				if constexpr (4u == NbChannelsV) {
+					// Blocks of SIMD lanes start at a multiple of four values.
+					const auto channels = L::Load(g_channels + i % 4u);
+					y = L::SelectLessEqual(channels, L::Set(2.0f), y, x);
+				}
+
+				L::Store(out + i, y);
+			});
+		}
+
+		/**
+		 Applies the given 3x3 matrix to the color channels of the given
+		 spectra.
+
+		 @tparam		NbChannelsV
+						The number of channels of the spectra (3 or 4). The
+						fourth channel (i.e. alpha) is preserved.
+		 @param[in]		m
+						The matrix in row-major order (i.e. the first row
+						computes the first output channel).
+		 */
+		template< std::size_t NbChannelsV, typename InputT, typename OutputT >
+		void TransformColors(gsl::span< const InputT > input,
+							 gsl::span< OutputT > output,
+							 const F32 (&m)[9]) noexcept {
+
+			static_assert(sizeof(InputT)  == NbChannelsV * sizeof(F32));
+			static_assert(sizeof(OutputT) == NbChannelsV * sizeof(F32));
+			Assert(input.size() == output.size());
+
+			const auto in  = reinterpret_cast< const F32* >(input.data());
+			const auto out = reinterpret_cast< F32* >(output.data());
+
+			Dispatch(static_cast< std::size_t >(input.size()),
+					 [in, out, &m](auto lanes, std::size_t i) noexcept {
+
+				using L = decltype(lanes);
+
+				const auto p = in + i * NbChannelsV;
+				const auto r = L::LoadStrided(p,      NbChannelsV);
+				const auto g = L::LoadStrided(p + 1u, NbChannelsV);
+				const auto b = L::LoadStrided(p + 2u, NbChannelsV);
+
+				typename L::Vector a = {};
+				if constexpr (4u == NbChannelsV) {
+					a = L::LoadStrided(p + 3u, NbChannelsV);
+				}
+
+				const auto q = out + i * NbChannelsV;
+				for (std::size_t row = 0u; row < 3u; ++row) {
+					auto c = L::Mul(r, L::Set(m[3u * row]));
+					c = L::MulAdd(g, L::Set(m[3u * row + 1u]), c);
+					c = L::MulAdd(b, L::Set(m[3u * row + 2u]), c);
+					L::StoreStrided(q + row, NbChannelsV, c);
+				}
+
+				if constexpr (4u == NbChannelsV) {
+					L::StoreStrided(q + 3u, NbChannelsV, a);
+				}
+			});
+		}
+
+		/**
+		 Computes the luminance of the given spectra.
+
+		 @tparam		NbChannelsV
+						The number of channels of the spectra (3 or 4).
+		 */
+		template< std::size_t NbChannelsV, typename InputT >
+		void ComputeLuminance(gsl::span< const InputT > input,
+							  gsl::span< F32 > luminance) noexcept {
+
+			static_assert(sizeof(InputT) == NbChannelsV * sizeof(F32));
+			Assert(input.size() == luminance.size());
+
+			const auto in  = reinterpret_cast< const F32* >(input.data());
+			const auto out = luminance.data();
+
+			Dispatch(static_cast< std::size_t >(input.size()),
+					 [in, out](auto lanes, std::size_t i) noexcept {
+
+				using L = decltype(lanes);
+
+				const auto p = in + i * NbChannelsV;
+				auto y = L::Mul(L::LoadStrided(p, NbChannelsV), L::Set(0.212671f));
+				y = L::MulAdd(L::LoadStrided(p + 1u, NbChannelsV), L::Set(0.715160f), y);
+				y = L::MulAdd(L::LoadStrided(p + 2u, NbChannelsV), L::Set(0.072169f), y);
+				L::Store(out + i, y);
+			});
+		}
+
+		/**
+		 Converts the given values to 8 bit unsigned normalized integers.
+		 */
+		template< typename LanesT >
+		[[nodiscard]]
+		typename LanesT::Integer ToUNORM8(typename LanesT::Vector x) noexcept {
+			using L = LanesT;
+
+			const auto saturated = L::Min(L::Max(x, L::Set(0.0f)), L::Set(1.0f));
+			return L::Round(L::Mul(saturated, L::Set(255.0f)));
+		}
+
+		/**
+		 Packs the given spectra in 8 bit unsigned normalized integers.
+
+		 @tparam		SRGBV
+						@c true if the color channels need to be converted
+						from (linear) RGB to sRGB space. @c false otherwise.
+		 */
+		template< bool SRGBV >
+		void PackRGBA8(gsl::span< const RGBA > rgba,
+					   gsl::span< U32 > packed) noexcept {
+
+			Assert(rgba.size() == packed.size());
+
+			const auto in  = reinterpret_cast< const F32* >(rgba.data());
+			const auto out = packed.data();
+
+			Dispatch(static_cast< std::size_t >(rgba.size()),
+					 [in, out](auto lanes, std::size_t i) noexcept {
+
+				using L = decltype(lanes);
+
+				const auto p = in + 4u * i;
+				auto r = L::LoadStrided(p,      4u);
+				auto g = L::LoadStrided(p + 1u, 4u);
+				auto b = L::LoadStrided(p + 2u, 4u);
+				const auto a = L::LoadStrided(p + 3u, 4u);
+
+				if constexpr (SRGBV) {
+					r = ToSRGB< L >(r);
+					g = ToSRGB< L >(g);
+					b = ToSRGB< L >(b);
+				}
+
+				auto result = ToUNORM8< L >(r);
+				result = L::Or(result, L::ShiftLeft(ToUNORM8< L >(g),  8));
+				result = L::Or(result, L::ShiftLeft(ToUNORM8< L >(b), 16));
+				result = L::Or(result, L::ShiftLeft(ToUNORM8< L >(a), 24));
+				L::Store(out + i, result);
+			});
+		}
+
+		/**
+		 Converts the given values to unsigned floats with a 5 bit exponent
+		 and a mantissa of the given number of bits.
+		 */
+		template< typename LanesT >
+		[[nodiscard]]
+		typename LanesT::Integer ToUFloat(typename LanesT::Vector x,
+										  int nb_mantissa_bits) noexcept {
+			using L = LanesT;
+
+			const auto shift    = 23 - nb_mantissa_bits;
+			const auto exponent = static_cast< U32 >(nb_mantissa_bits);
+			const auto bits     = L::AsInteger(x);
+			const auto abs_bits = L::And(bits, L::Set(0x7FFFFFFFu));
+
+			// Normal values: rebias the exponent (from 127 to 15) and round
+			// the mantissa to nearest even.
+			const auto rebiased = L::Add(abs_bits, L::Set(0xC8000000u));
+			const auto odd      = L::And(L::ShiftRight(rebiased, shift), L::Set(1u));
+			const auto normal   = L::ShiftRight(
+				L::Add(L::Add(rebiased, L::Set((1u << shift) - 1u)), odd), shift);
+
+			// Denormal values (smaller than 2^-14): round x / 2^-14 times the
+			// number of mantissa steps to nearest even.
+			const auto scale    = L::AsVector(L::Set((127u + 14u + exponent) << 23u));
+			const auto denormal = L::Round(L::Mul(x, scale));
+
+			const auto max_finite = ((30u << nb_mantissa_bits)
+				                  | ((1u << nb_mantissa_bits) - 1u));
+			const auto infinity   = (31u << nb_mantissa_bits);
+			const auto nan        = infinity | ((1u << nb_mantissa_bits) - 1u);
+			// Finite values exceeding the largest unsigned float are clamped.
+			const auto max_bits   = (142u << 23u)
+				                  | (((1u << nb_mantissa_bits) - 1u) << shift);
+
+			auto result = L::SelectGreater(L::Set(0x38800000u), abs_bits,
+										   denormal, normal);
+			result = L::SelectGreater(abs_bits, L::Set(max_bits),
+									  L::Set(max_finite), result);
+			result = L::SelectGreater(abs_bits, L::Set(0x7F7FFFFFu),
+									  L::Set(infinity), result);
+			result = L::SelectGreater(L::Set(0u), bits,
+									  L::Set(0u), result);
+			result = L::SelectGreater(abs_bits, L::Set(0x7F800000u),
+									  L::Set(nan), result);
+			return result;
+		}
+
+		/**
+		 Returns the lookup table for converting 8 bit unsigned normalized
+		 integers from sRGB to (linear) RGB space.
+		 */
+		[[nodiscard]]
+		const std::array< F32, 256u >& GetSRGB8toRGBTable() noexcept {
+			static const auto s_table = []() noexcept {
+				std::array< F32, 256u > table = {};
+				for (std::size_t i = 0u; i < table.size(); ++i) {
+					const auto c = static_cast< F64 >(i) / 255.0;
+					table[i] = static_cast< F32 >((c <= 0.04045)
+						? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+				}
+				return table;
+			}();
+
+			return s_table;
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// Batch Conversions: (linear) RGB <-> sRGB
+	//-------------------------------------------------------------------------
+
+	void RGBtoSRGB(gsl::span< const RGB > rgb,
+				   gsl::span< SRGB > srgb) noexcept {
+
+		TransformValues< 3u >(rgb, srgb, [](auto lanes, auto x) noexcept {
+			return ToSRGB< decltype(lanes) >(x);
+		});
+	}
+
+	void RGBtoSRGB(gsl::span< const RGBA > rgba,
+				   gsl::span< SRGBA > srgba) noexcept {
+
+		TransformValues< 4u >(rgba, srgba, [](auto lanes, auto x) noexcept {
+			return ToSRGB< decltype(lanes) >(x);
+		});
+	}
+
+	void SRGBtoRGB(gsl::span< const SRGB > srgb,
+				   gsl::span< RGB > rgb) noexcept {
+
+		TransformValues< 3u >(srgb, rgb, [](auto lanes, auto x) noexcept {
+			return ToRGB< decltype(lanes) >(x);
+		});
+	}
+
+	void SRGBtoRGB(gsl::span< const SRGBA > srgba,
+				   gsl::span< RGBA > rgba) noexcept {
+
+		TransformValues< 4u >(srgba, rgba, [](auto lanes, auto x) noexcept {
+			return ToRGB< decltype(lanes) >(x);
+		});
+	}
+
+	//-------------------------------------------------------------------------
+	// Batch Conversions: (linear) RGB <-> XYZ
+	//-------------------------------------------------------------------------
+
+	namespace {
+
+		/**
+		 The matrix for converting ITU-R Recommendation BT.709 linear RGB to
+		 XYZ.
+		 */
+		constexpr F32 g_rgb_to_xyz[] = {
+			0.412453f, 0.357580f, 0.180423f,
+			0.212671f, 0.715160f, 0.072169f,
+			0.019334f, 0.119193f, 0.950227f
+		};
+
+		/**
+		 The matrix for converting XYZ to ITU-R Recommendation BT.709 linear
+		 RGB.
+		 */
+		constexpr F32 g_xyz_to_rgb[] = {
+			 3.240479f, -1.537150f, -0.498535f,
+			-0.969256f,  1.875992f,  0.041556f,
+			 0.055648f, -0.204043f,  1.057311f
+		};
+	}
+
+	void RGBtoXYZ(gsl::span< const RGB > rgb,
+				  gsl::span< XYZ > xyz) noexcept {
+
+		TransformColors< 3u >(rgb, xyz, g_rgb_to_xyz);
+	}
+
+	void RGBtoXYZ(gsl::span< const RGBA > rgba,
+				  gsl::span< XYZA > xyza) noexcept {
+
+		TransformColors< 4u >(rgba, xyza, g_rgb_to_xyz);
+	}
+
+	void XYZtoRGB(gsl::span< const XYZ > xyz,
+				  gsl::span< RGB > rgb) noexcept {
+
+		TransformColors< 3u >(xyz, rgb, g_xyz_to_rgb);
+	}
+
+	void XYZtoRGB(gsl::span< const XYZA > xyza,
+				  gsl::span< RGBA > rgba) noexcept {
+
+		TransformColors< 4u >(xyza, rgba, g_xyz_to_rgb);
+	}
+
+	void Luminance(gsl::span< const RGB > rgb,
+				   gsl::span< F32 > luminance) noexcept {
+
+		ComputeLuminance< 3u >(rgb, luminance);
+	}
+
+	void Luminance(gsl::span< const RGBA > rgba,
+				   gsl::span< F32 > luminance) noexcept {
+
+		ComputeLuminance< 4u >(rgba, luminance);
+	}
+
+	//-------------------------------------------------------------------------
+	// Batch Conversions: Packing
+	//-------------------------------------------------------------------------
+
+	void PackUNORM8(gsl::span< const RGBA > rgba,
+					gsl::span< U32 > packed) noexcept {
+
+		PackRGBA8< false >(rgba, packed);
+	}
+
+	void PackSRGB8(gsl::span< const RGBA > rgba,
+				   gsl::span< U32 > packed) noexcept {
+
+		PackRGBA8< true >(rgba, packed);
+	}
+
+	void UnpackSRGB8(gsl::span< const U32 > packed,
+					 gsl::span< RGBA > rgba) noexcept {
+
+		Assert(packed.size() == rgba.size());
+
+		const auto& table = GetSRGB8toRGBTable();
+		std::transform(packed.begin(), packed.end(), rgba.begin(),
+					   [&table](U32 p) noexcept {
+			return RGBA(table[ p         & 0xFFu],
+						table[(p >>  8u) & 0xFFu],
+						table[(p >> 16u) & 0xFFu],
+						static_cast< F32 >(p >> 24u) * (1.0f / 255.0f));
+		});
+	}
+
+	void PackR11G11B10(gsl::span< const RGB > rgb,
+					   gsl::span< U32 > packed) noexcept {
+
+		Assert(rgb.size() == packed.size());
+
+		const auto in  = reinterpret_cast< const F32* >(rgb.data());
+		const auto out = packed.data();
+
+		Dispatch(static_cast< std::size_t >(rgb.size()),
+				 [in, out](auto lanes, std::size_t i) noexcept {
+
+			using L = decltype(lanes);
+
+			const auto p = in + 3u * i;
+			auto result = ToUFloat< L >(L::LoadStrided(p, 3u), 6);
+			result = L::Or(result,
+						   L::ShiftLeft(ToUFloat< L >(L::LoadStrided(p + 1u, 3u), 6), 11));
+			result = L::Or(result,
+						   L::ShiftLeft(ToUFloat< L >(L::LoadStrided(p + 2u, 3u), 5), 22));
+			L::Store(out + i, result);
+		});
+	}
+
+	void PackRGBE(gsl::span< const RGB > rgb,
+				  gsl::span< U32 > packed) noexcept {
+
+		Assert(rgb.size() == packed.size());
+
+		const auto in  = reinterpret_cast< const F32* >(rgb.data());
+		const auto out = packed.data();
+
+		Dispatch(static_cast< std::size_t >(rgb.size()),
+				 [in, out](auto lanes, std::size_t i) noexcept {
+
+			using L = decltype(lanes);
+
+			const auto p    = in + 3u * i;
+			const auto zero = L::Set(0.0f);
+			const auto r    = L::Max(L::LoadStrided(p,      3u), zero);
+			const auto g    = L::Max(L::LoadStrided(p + 1u, 3u), zero);
+			const auto b    = L::Max(L::LoadStrided(p + 2u, 3u), zero);
+			const auto v    = L::Max(L::Max(r, g), b);
+
+			// v = m 2^e with m in [0.5, 1) and e = biased exponent - 126.
+			// The mantissas are scaled by 2^(8-e) = 256 m / v.
+			const auto biased_exponent = L::ShiftRight(L::AsInteger(v), 23);
+			const auto scale = L::AsVector(
+				L::ShiftLeft(L::Sub(L::Set(261u), biased_exponent), 23));
+
+			auto result = L::Truncate(L::Mul(r, scale));
+			result = L::Or(result, L::ShiftLeft(L::Truncate(L::Mul(g, scale)),  8));
+			result = L::Or(result, L::ShiftLeft(L::Truncate(L::Mul(b, scale)), 16));
+			result = L::Or(result, L::ShiftLeft(L::Add(biased_exponent,
+													   L::Set(2u)), 24));
+
+			// Values smaller than 1e-32 are stored as zero.
+			result = L::SelectGreater(L::AsInteger(L::Set(1e-32f)), L::AsInteger(v),
+									  L::Set(0u), result);
+			L::Store(out + i, result);
+		});
+	}
+
+	void UnpackRGBE(gsl::span< const U32 > packed,
+					gsl::span< RGB > rgb) noexcept {
+
+		Assert(packed.size() == rgb.size());
+
+		std::transform(packed.begin(), packed.end(), rgb.begin(),
+					   [](U32 p) noexcept {
+			const auto e = static_cast< int >(p >> 24u);
+			if (0 == e) {
+				return RGB(0.0f);
+			}
+
+			const auto f = std::ldexp(1.0f, e - (128 + 8));
+			return RGB((static_cast< F32 >( p         & 0xFFu) + 0.5f) * f,
+					   (static_cast< F32 >((p >>  8u) & 0xFFu) + 0.5f) * f,
+					   (static_cast< F32 >((p >> 16u) & 0xFFu) + 0.5f) * f);
+		});
+	}
+}
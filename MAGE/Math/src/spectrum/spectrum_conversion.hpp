@@ -0,0 +1,284 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "spectrum/spectrum.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// Batch Conversions: (linear) RGB <-> sRGB
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Converts the given spectra from (linear) RGB to sRGB space.
+
+	 The power function of the sRGB transfer function is evaluated with
+	 polynomial approximations of log2 and exp2. The absolute error with
+	 regard to the exact transfer function is smaller than 3e-7 for values
+	 in [0, 1].
+
+	 @pre			The size of @a rgb is equal to the size of @a srgb.
+	 @param[in]		rgb
+					The spectra in (linear) RGB space.
+	 @param[out]	srgb
+					The spectra in sRGB space.
+	 */
+	void RGBtoSRGB(gsl::span< const RGB > rgb,
+				   gsl::span< SRGB > srgb) noexcept;
+
+	/**
+	 Converts the given spectra from (linear) RGB to sRGB space.
+
+	 The power function of the sRGB transfer function is evaluated with
+	 polynomial approximations of log2 and exp2. The absolute error with
+	 regard to the exact transfer function is smaller than 3e-7 for values
+	 in [0, 1].
+
+	 @pre			The size of @a rgba is equal to the size of @a srgba.
+	 @param[in]		rgba
+					The spectra in (linear) RGB space.
+	 @param[out]	srgba
+					The spectra in sRGB space.
+	 @note			The alpha channel of the given spectra is preserved.
+	 */
+	void RGBtoSRGB(gsl::span< const RGBA > rgba,
+				   gsl::span< SRGBA > srgba) noexcept;
+
+	/**
+	 Converts the given spectra from sRGB to (linear) RGB space.
+
+	 The power function of the sRGB transfer function is evaluated with
+	 polynomial approximations of log2 and exp2. The absolute error with
+	 regard to the exact transfer function is smaller than 3e-7 for values
+	 in [0, 1].
+
+	 @pre			The size of @a srgb is equal to the size of @a rgb.
+	 @param[in]		srgb
+					The spectra in sRGB space.
+	 @param[out]	rgb
+					The spectra in (linear) RGB space.
+	 */
+	void SRGBtoRGB(gsl::span< const SRGB > srgb,
+				   gsl::span< RGB > rgb) noexcept;
+
+	/**
+	 Converts the given spectra from sRGB to (linear) RGB space.
+
+	 The power function of the sRGB transfer function is evaluated with
+	 polynomial approximations of log2 and exp2. The absolute error with
+	 regard to the exact transfer function is smaller than 3e-7 for values
+	 in [0, 1].
+
+	 @pre			The size of @a srgba is equal to the size of @a rgba.
+	 @param[in]		srgba
+					The spectra in sRGB space.
+	 @param[out]	rgba
+					The spectra in (linear) RGB space.
+	 @note			The alpha channel of the given spectra is preserved.
+	 */
+	void SRGBtoRGB(gsl::span< const SRGBA > srgba,
+				   gsl::span< RGBA > rgba) noexcept;
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Batch Conversions: (linear) RGB <-> XYZ
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Converts the given spectra from (linear) RGB to XYZ space.
+
+	 @pre			The size of @a rgb is equal to the size of @a xyz.
+	 @param[in]		rgb
+					The spectra in (linear) RGB space.
+	 @param[out]	xyz
+					The spectra in XYZ space.
+	 */
+	void RGBtoXYZ(gsl::span< const RGB > rgb,
+				  gsl::span< XYZ > xyz) noexcept;
+
+	/**
+	 Converts the given spectra from (linear) RGB to XYZ space.
+
+	 @pre			The size of @a rgba is equal to the size of @a xyza.
+	 @param[in]		rgba
+					The spectra in (linear) RGB space.
+	 @param[out]	xyza
+					The spectra in XYZ space.
+	 @note			The alpha channel of the given spectra is preserved.
+	 */
+	void RGBtoXYZ(gsl::span< const RGBA > rgba,
+				  gsl::span< XYZA > xyza) noexcept;
+
+	/**
+	 Converts the given spectra from XYZ to (linear) RGB space.
+
+	 @pre			The size of @a xyz is equal to the size of @a rgb.
+	 @param[in]		xyz
+					The spectra in XYZ space.
+	 @param[out]	rgb
+					The spectra in (linear) RGB space.
+	 */
+	void XYZtoRGB(gsl::span< const XYZ > xyz,
+				  gsl::span< RGB > rgb) noexcept;
+
+	/**
+	 Converts the given spectra from XYZ to (linear) RGB space.
+
+	 @pre			The size of @a xyza is equal to the size of @a rgba.
+	 @param[in]		xyza
+					The spectra in XYZ space.
+	 @param[out]	rgba
+					The spectra in (linear) RGB space.
+	 @note			The alpha channel of the given spectra is preserved.
+	 */
+	void XYZtoRGB(gsl::span< const XYZA > xyza,
+				  gsl::span< RGBA > rgba) noexcept;
+
+	/**
+	 Computes the luminance (i.e. the Y component in XYZ space) of the
+	 given spectra.
+
+	 @pre			The size of @a rgb is equal to the size of
+					@a luminance.
+	 @param[in]		rgb
+					The spectra in (linear) RGB space.
+	 @param[out]	luminance
+					The luminance of the spectra.
+	 */
+	void Luminance(gsl::span< const RGB > rgb,
+				   gsl::span< F32 > luminance) noexcept;
+
+	/**
+	 Computes the luminance (i.e. the Y component in XYZ space) of the
+	 given spectra.
+
+	 @pre			The size of @a rgba is equal to the size of
+					@a luminance.
+	 @param[in]		rgba
+					The spectra in (linear) RGB space.
+	 @param[out]	luminance
+					The luminance of the spectra.
+	 */
+	void Luminance(gsl::span< const RGBA > rgba,
+				   gsl::span< F32 > luminance) noexcept;
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Batch Conversions: Packing
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Packs the given spectra in the @c DXGI_FORMAT_R8G8B8A8_UNORM format.
+
+	 The components are saturated and rounded to the nearest 8 bit unsigned
+	 normalized integer.
+
+	 @pre			The size of @a rgba is equal to the size of @a packed.
+	 @param[in]		rgba
+					The spectra.
+	 @param[out]	packed
+					The packed spectra (red in the least significant byte).
+	 */
+	void PackUNORM8(gsl::span< const RGBA > rgba,
+					gsl::span< U32 > packed) noexcept;
+
+	/**
+	 Packs the given spectra in the @c DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+	 format.
+
+	 The spectra are converted from (linear) RGB to sRGB space, after which
+	 the components are saturated and rounded to the nearest 8 bit unsigned
+	 normalized integer. Due to the approximation of the transfer function,
+	 an integer can differ by one from the exactly converted integer if the
+	 exactly converted value lies within 1e-4 of a rounding boundary.
+
+	 @pre			The size of @a rgba is equal to the size of @a packed.
+	 @param[in]		rgba
+					The spectra in (linear) RGB space.
+	 @param[out]	packed
+					The packed spectra (red in the least significant byte).
+	 @note			The alpha channel of the given spectra is not converted.
+	 */
+	void PackSRGB8(gsl::span< const RGBA > rgba,
+				   gsl::span< U32 > packed) noexcept;
+
+	/**
+	 Unpacks the given spectra from the @c DXGI_FORMAT_R8G8B8A8_UNORM_SRGB
+	 format.
+
+	 The (exact) conversion from sRGB to (linear) RGB space uses a lookup
+	 table.
+
+	 @pre			The size of @a packed is equal to the size of @a rgba.
+	 @param[in]		packed
+					The packed spectra (red in the least significant byte).
+	 @param[out]	rgba
+					The spectra in (linear) RGB space.
+	 @note			The alpha channel of the given spectra is not converted.
+	 */
+	void UnpackSRGB8(gsl::span< const U32 > packed,
+					 gsl::span< RGBA > rgba) noexcept;
+
+	/**
+	 Packs the given spectra in the @c DXGI_FORMAT_R11G11B10_FLOAT format.
+
+	 The components are rounded to the nearest unsigned float (to nearest
+	 even on ties). Negative components are clamped to zero and components
+	 exceeding the largest finite unsigned float are clamped to the latter
+	 (i.e. the same conversion as @c XMStoreFloat3PK).
+
+	 @pre			The size of @a rgb is equal to the size of @a packed.
+	 @param[in]		rgb
+					The spectra.
+	 @param[out]	packed
+					The packed spectra (red in the least significant bits).
+	 */
+	void PackR11G11B10(gsl::span< const RGB > rgb,
+					   gsl::span< U32 > packed) noexcept;
+
+	/**
+	 Packs the given spectra in the RGBE (i.e. shared exponent) format of
+	 the Radiance HDR file format.
+
+	 @pre			The size of @a rgb is equal to the size of @a packed.
+	 @param[in]		rgb
+					The spectra.
+	 @param[out]	packed
+					The packed spectra (the red mantissa in the least
+					significant byte and the exponent in the most
+					significant byte).
+	 */
+	void PackRGBE(gsl::span< const RGB > rgb,
+				  gsl::span< U32 > packed) noexcept;
+
+	/**
+	 Unpacks the given spectra from the RGBE (i.e. shared exponent) format
+	 of the Radiance HDR file format.
+
+	 @pre			The size of @a packed is equal to the size of @a rgb.
+	 @param[in]		packed
+					The packed spectra (the red mantissa in the least
+					significant byte and the exponent in the most
+					significant byte).
+	 @param[out]	rgb
+					The spectra.
+	 */
+	void UnpackRGBE(gsl::span< const U32 > packed,
+					gsl::span< RGB > rgb) noexcept;
+
+	#pragma endregion
+}
@@ -53,7 +53,8 @@ namespace mage {
 		const auto [nx, ny, nz] = XMStore< F32x3 >(n);
 
 		if (nz < -0.9999999f) {
-			return { -g_XMIdentityR1, -g_XMIdentityR0, n, g_XMIdentityR3 };
+			return { XMVectorNegate(g_XMIdentityR1), XMVectorNegate(g_XMIdentityR0),
+					 n, g_XMIdentityR3 };
 		}
 
 		const auto a0 = 1.0f / (1.0f + nz);
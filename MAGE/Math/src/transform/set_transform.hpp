@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "transform\transform_utils.hpp"
+#include "transform/transform_utils.hpp"
 
 #pragma endregion
 
@@ -790,7 +790,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectOrigin() const noexcept {
-			return { 0.0f, 0.0f, 0.0f, 1.0f };
+			return XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f);
 		}
 
 		/**
@@ -802,7 +802,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectAxisX() const noexcept {
-			return { 1.0f, 0.0f, 0.0f, 0.0f };
+			return XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f);
 		}
 
 		/**
@@ -814,7 +814,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectAxisY() const noexcept {
-			return { 0.0f, 1.0f, 0.0f, 0.0f };
+			return XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
 		}
 
 		/**
@@ -826,7 +826,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectAxisZ() const noexcept {
-			return { 0.0f, 0.0f, 1.0f, 0.0f };
+			return XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f);
 		}
 
 		#pragma endregion
@@ -2015,7 +2015,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectOrigin() const noexcept {
-			return { 0.0f, 0.0f, 0.0f, 1.0f };
+			return XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f);
 		}
 
 		/**
@@ -2027,7 +2027,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectAxisX() const noexcept {
-			return { 1.0f, 0.0f, 0.0f, 0.0f };
+			return XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f);
 		}
 
 		/**
@@ -2039,7 +2039,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectAxisY() const noexcept {
-			return { 0.0f, 1.0f, 0.0f, 0.0f };
+			return XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
 		}
 
 		/**
@@ -2051,7 +2051,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectAxisZ() const noexcept {
-			return { 0.0f, 0.0f, 1.0f, 0.0f };
+			return XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f);
 		}
 
 		#pragma endregion
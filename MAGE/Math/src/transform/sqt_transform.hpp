@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "transform\transform_utils.hpp"
+#include "transform/transform_utils.hpp"
 
 #pragma endregion
 
@@ -491,7 +491,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectOrigin() const noexcept {
-			return { 0.0f, 0.0f, 0.0f, 1.0f };
+			return XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f);
 		}
 
 		/**
@@ -503,7 +503,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectAxisX() const noexcept {
-			return { 1.0f, 0.0f, 0.0f, 0.0f };
+			return XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f);
 		}
 
 		/**
@@ -515,7 +515,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectAxisY() const noexcept {
-			return { 0.0f, 1.0f, 0.0f, 0.0f };
+			return XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
 		}
 
 		/**
@@ -527,7 +527,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectAxisZ() const noexcept {
-			return { 0.0f, 0.0f, 1.0f, 0.0f };
+			return XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f);
 		}
 
 		#pragma endregion
@@ -1412,7 +1412,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectOrigin() const noexcept {
-			return { 0.0f, 0.0f, 0.0f, 1.0f };
+			return XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f);
 		}
 
 		/**
@@ -1424,7 +1424,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectAxisX() const noexcept {
-			return { 1.0f, 0.0f, 0.0f, 0.0f };
+			return XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f);
 		}
 
 		/**
@@ -1436,7 +1436,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectAxisY() const noexcept {
-			return { 0.0f, 1.0f, 0.0f, 0.0f };
+			return XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f);
 		}
 
 		/**
@@ -1448,7 +1448,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMVECTOR XM_CALLCONV GetObjectAxisZ() const noexcept {
-			return { 0.0f, 0.0f, 1.0f, 0.0f };
+			return XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f);
 		}
 
 		#pragma endregion
@@ -5,9 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "transform\set_transform.hpp"
-#include "transform\sqt_transform.hpp"
-#include "transform\sprite_transform.hpp"
-#include "transform\texture_transform.hpp"
+#include "transform/set_transform.hpp"
+#include "transform/sqt_transform.hpp"
+#include "transform/sprite_transform.hpp"
+#include "transform/texture_transform.hpp"
 
 #pragma endregion
\ No newline at end of file
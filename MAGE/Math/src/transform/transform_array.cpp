@@ -0,0 +1,730 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "transform/transform_array.hpp"
+#include "parallel/parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+#include <immintrin.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		//---------------------------------------------------------------------
+		// Lanes
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of scalar lanes (i.e. one transform at a time) for the
+		 remaining transforms of the batch kernels.
+		 */
+		struct ScalarLanes {
+
+		public:
+
+			using Vector = F32;
+
+			static constexpr std::size_t s_width = 1u;
+
+			[[nodiscard]]
+			static Vector Load(const F32* p) noexcept { return *p; }
+
+			static void Store(F32* p, Vector v) noexcept { *p = v; }
+
+			[[nodiscard]]
+			static Vector Set(F32 f) noexcept { return f; }
+
+			[[nodiscard]]
+			static Vector Add(Vector a, Vector b) noexcept { return a + b; }
+
+			[[nodiscard]]
+			static Vector Sub(Vector a, Vector b) noexcept { return a - b; }
+
+			[[nodiscard]]
+			static Vector Mul(Vector a, Vector b) noexcept { return a * b; }
+
+			[[nodiscard]]
+			static Vector MulAdd(Vector a, Vector b, Vector c) noexcept {
+				return a * b + c;
+			}
+
+			[[nodiscard]]
+			static Vector Div(Vector a, Vector b) noexcept { return a / b; }
+
+			[[nodiscard]]
+			static Vector Abs(Vector a) noexcept { return std::abs(a); }
+
+			[[nodiscard]]
+			static Vector Round(Vector a) noexcept { return std::nearbyint(a); }
+
+			[[nodiscard]]
+			static Vector CopySign(Vector a, Vector b) noexcept {
+				return std::copysign(a, b);
+			}
+
+			[[nodiscard]]
+			static Vector SelectLessEqual(Vector a, Vector b,
+										  Vector t, Vector f) noexcept {
+				return (a <= b) ? t : f;
+			}
+		};
+
+		/**
+		 A struct of SSE2 lanes (i.e. four transforms at a time).
+		 */
+		struct SSE2Lanes {
+
+		public:
+
+			using Vector = __m128;
+
+			static constexpr std::size_t s_width = 4u;
+
+			[[nodiscard]]
+			static Vector Load(const F32* p) noexcept { return _mm_loadu_ps(p); }
+
+			static void Store(F32* p, Vector v) noexcept { _mm_storeu_ps(p, v); }
+
+			[[nodiscard]]
+			static Vector Set(F32 f) noexcept { return _mm_set1_ps(f); }
+
+			[[nodiscard]]
+			static Vector Add(Vector a, Vector b) noexcept { return _mm_add_ps(a, b); }
+
+			[[nodiscard]]
+			static Vector Sub(Vector a, Vector b) noexcept { return _mm_sub_ps(a, b); }
+
+			[[nodiscard]]
+			static Vector Mul(Vector a, Vector b) noexcept { return _mm_mul_ps(a, b); }
+
+			[[nodiscard]]
+			static Vector MulAdd(Vector a, Vector b, Vector c) noexcept {
+				return _mm_add_ps(_mm_mul_ps(a, b), c);
+			}
+
+			[[nodiscard]]
+			static Vector Div(Vector a, Vector b) noexcept { return _mm_div_ps(a, b); }
+
+			[[nodiscard]]
+			static Vector Abs(Vector a) noexcept {
+				return _mm_andnot_ps(_mm_set1_ps(-0.0f), a);
+			}
+
+			[[nodiscard]]
+			static Vector Round(Vector a) noexcept {
+				// Rounds to the nearest integer (in the range of 32 bit
+				// signed integers).
+				return _mm_cvtepi32_ps(_mm_cvtps_epi32(a));
+			}
+
+			[[nodiscard]]
+			static Vector CopySign(Vector a, Vector b) noexcept {
+				const auto sign_mask = _mm_set1_ps(-0.0f);
+				return _mm_or_ps(_mm_andnot_ps(sign_mask, a),
+								 _mm_and_ps(sign_mask, b));
+			}
+
+			[[nodiscard]]
+			static Vector SelectLessEqual(Vector a, Vector b,
+										  Vector t, Vector f) noexcept {
+				const auto mask = _mm_cmple_ps(a, b);
+				return _mm_or_ps(_mm_and_ps(mask, t), _mm_andnot_ps(mask, f));
+			}
+		};
+
+		/**
+		 A struct of AVX2 lanes (i.e. eight transforms at a time).
+
+		 @pre			The processor supports AVX2 and FMA3 instructions.
+		 */
+		struct AVX2Lanes {
+
+		public:
+
+			using Vector = __m256;
+
+			static constexpr std::size_t s_width = 8u;
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Load(const F32* p) noexcept { return _mm256_loadu_ps(p); }
+
+			MAGE_TARGET_AVX2
+			static void Store(F32* p, Vector v) noexcept { _mm256_storeu_ps(p, v); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Set(F32 f) noexcept { return _mm256_set1_ps(f); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Add(Vector a, Vector b) noexcept { return _mm256_add_ps(a, b); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Sub(Vector a, Vector b) noexcept { return _mm256_sub_ps(a, b); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Mul(Vector a, Vector b) noexcept { return _mm256_mul_ps(a, b); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector MulAdd(Vector a, Vector b, Vector c) noexcept {
+				return _mm256_fmadd_ps(a, b, c);
+			}
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Div(Vector a, Vector b) noexcept { return _mm256_div_ps(a, b); }
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Abs(Vector a) noexcept {
+				return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+			}
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector Round(Vector a) noexcept {
+				return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+			}
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector CopySign(Vector a, Vector b) noexcept {
+				const auto sign_mask = _mm256_set1_ps(-0.0f);
+				return _mm256_or_ps(_mm256_andnot_ps(sign_mask, a),
+									_mm256_and_ps(sign_mask, b));
+			}
+
+			[[nodiscard]]
+			MAGE_TARGET_AVX2
+			static Vector SelectLessEqual(Vector a, Vector b,
+										  Vector t, Vector f) noexcept {
+				return _mm256_blendv_ps(f, t, _mm256_cmp_ps(a, b, _CMP_LE_OQ));
+			}
+		};
+
+		//---------------------------------------------------------------------
+		// Kernels
+		//---------------------------------------------------------------------
+
+		/**
+		 Calls the given kernel for each block of lanes in the given range.
+
+		 @return		The end of the processed range.
+		 */
+		template< typename LanesT, typename KernelT >
+		std::size_t ForEachBlock(std::size_t begin,
+								 std::size_t end,
+								 KernelT& kernel) noexcept {
+
+			constexpr auto width = LanesT::s_width;
+
+			auto i = begin;
+			for (; i + width <= end; i += width) {
+				kernel(LanesT(), i);
+			}
+
+			return i;
+		}
+
+		/**
+		 Calls the given kernel for each block of AVX2 lanes in the given
+		 range.
+
+		 @pre			The processor supports AVX2 and FMA3 instructions.
+		 @return		The end of the processed range.
+		 */
+		template< typename KernelT >
+		MAGE_TARGET_AVX2_FLATTEN
+		std::size_t ForEachBlockAVX2(std::size_t begin,
+									 std::size_t end,
+									 KernelT& kernel) noexcept {
+
+			return ForEachBlock< AVX2Lanes >(begin, end, kernel);
+		}
+
+		/**
+		 Calls the given kernel for all transforms: 8 (AVX2) or 4 (SSE2) at a
+		 time, followed by the remaining transforms one at a time.
+
+		 @tparam		KernelT
+						The kernel type. The kernel must accept the lanes
+						(@c ScalarLanes, @c SSE2Lanes or @c AVX2Lanes) and
+						the index of the first transform of a block.
+		 */
+		template< typename KernelT >
+		void Dispatch(std::size_t size, KernelT&& kernel) noexcept {
+			#ifdef __AVX2__
+			const auto i = ForEachBlockAVX2(0u, size, kernel);
+			#else  // __AVX2__
+			const auto i = SupportsAVX2()
+				         ? ForEachBlockAVX2(0u, size, kernel)
+				         : ForEachBlock< SSE2Lanes >(0u, size, kernel);
+			#endif // __AVX2__
+
+			ForEachBlock< ScalarLanes >(i, size, kernel);
+		}
+
+		/**
+		 Computes the sines and cosines of the given angles (in radians).
+
+		 The angles are reduced to [-pi, pi] and reflected into
+		 [-pi/2, pi/2], after which an 11-degree (sine) and a 10-degree
+		 (cosine) minimax polynomial are evaluated (i.e. the same
+		 approximation as XMVectorSinCos).
+		 */
+		template< typename LanesT >
+		void SinCos(typename LanesT::Vector angles,
+					typename LanesT::Vector& sin,
+					typename LanesT::Vector& cos) noexcept {
+
+			using L = LanesT;
+
+			// Reduce the angles to [-pi, pi].
+			auto x = L::Sub(angles,
+							L::Mul(L::Set(XM_2PI),
+								   L::Round(L::Mul(angles, L::Set(XM_1DIV2PI)))));
+
+			// Reflect the angles into [-pi/2, pi/2]: sin(y) = sin(x) and
+			// cos(y) = -cos(x) for y = sign(x) pi - x.
+			const auto reflected = L::Sub(L::CopySign(L::Set(XM_PI), x), x);
+			const auto abs_x     = L::Abs(x);
+			const auto sign      = L::SelectLessEqual(abs_x, L::Set(XM_PIDIV2),
+													  L::Set(1.0f), L::Set(-1.0f));
+			x = L::SelectLessEqual(abs_x, L::Set(XM_PIDIV2), x, reflected);
+
+			const auto x2 = L::Mul(x, x);
+
+			auto s = L::MulAdd(L::Set(-2.3889859e-08f), x2, L::Set( 2.7525562e-06f));
+			s = L::MulAdd(s, x2, L::Set(-0.00019840874f));
+			s = L::MulAdd(s, x2, L::Set( 0.0083333310f));
+			s = L::MulAdd(s, x2, L::Set(-0.16666667f));
+			s = L::MulAdd(s, x2, L::Set( 1.0f));
+			sin = L::Mul(s, x);
+
+			auto c = L::MulAdd(L::Set(-2.6051615e-07f), x2, L::Set( 2.4760495e-05f));
+			c = L::MulAdd(c, x2, L::Set(-0.0013888378f));
+			c = L::MulAdd(c, x2, L::Set( 0.041666638f));
+			c = L::MulAdd(c, x2, L::Set(-0.5f));
+			c = L::MulAdd(c, x2, L::Set( 1.0f));
+			cos = L::Mul(c, sign);
+		}
+
+		/**
+		 Stores the given rows of a block of affine transformation matrices.
+		 */
+		template< typename LanesT >
+		void StoreRows(AffineTransformArray& matrices, std::size_t i,
+					   const typename LanesT::Vector (&rows)[4][3]) noexcept {
+
+			for (std::size_t row = 0u; row < 4u; ++row) {
+				for (std::size_t column = 0u; column < 3u; ++column) {
+					LanesT::Store(matrices.GetElements(row, column) + i,
+								  rows[row][column]);
+				}
+			}
+		}
+
+		/**
+		 Loads the rows of a block of affine transformation matrices.
+		 */
+		template< typename LanesT >
+		void LoadRows(const AffineTransformArray& matrices, std::size_t i,
+					  typename LanesT::Vector (&rows)[4][3]) noexcept {
+
+			for (std::size_t row = 0u; row < 4u; ++row) {
+				for (std::size_t column = 0u; column < 3u; ++column) {
+					rows[row][column]
+						= LanesT::Load(matrices.GetElements(row, column) + i);
+				}
+			}
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// SETTransformArray
+	//-------------------------------------------------------------------------
+
+	void SETTransformArray::reserve(std::size_t size) {
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_translations[axis].reserve(size);
+			m_rotations[axis].reserve(size);
+			m_scales[axis].reserve(size);
+		}
+	}
+
+	void SETTransformArray::resize(std::size_t size) {
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_translations[axis].resize(size);
+			m_rotations[axis].resize(size);
+			m_scales[axis].resize(size);
+		}
+	}
+
+	void SETTransformArray::clear() noexcept {
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_translations[axis].clear();
+			m_rotations[axis].clear();
+			m_scales[axis].clear();
+		}
+	}
+
+	void SETTransformArray::push_back(const SETTransform3D& transform) {
+		resize(size() + 1u);
+		Set(size() - 1u, transform);
+	}
+
+	void SETTransformArray::Set(std::size_t index,
+								const SETTransform3D& transform) noexcept {
+
+		const auto translation = transform.GetTranslationView();
+		const auto rotation    = transform.GetRotationView();
+		const auto scale       = transform.GetScaleView();
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_translations[axis][index] = translation[axis];
+			m_rotations[axis][index]    = rotation[axis];
+			m_scales[axis][index]       = scale[axis];
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// SQTTransformArray
+	//-------------------------------------------------------------------------
+
+	void SQTTransformArray::reserve(std::size_t size) {
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_translations[axis].reserve(size);
+			m_scales[axis].reserve(size);
+		}
+		for (std::size_t axis = 0u; axis < 4u; ++axis) {
+			m_rotations[axis].reserve(size);
+		}
+	}
+
+	void SQTTransformArray::resize(std::size_t size) {
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_translations[axis].resize(size);
+			m_scales[axis].resize(size);
+		}
+		for (std::size_t axis = 0u; axis < 4u; ++axis) {
+			m_rotations[axis].resize(size);
+		}
+	}
+
+	void SQTTransformArray::clear() noexcept {
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_translations[axis].clear();
+			m_scales[axis].clear();
+		}
+		for (std::size_t axis = 0u; axis < 4u; ++axis) {
+			m_rotations[axis].clear();
+		}
+	}
+
+	void SQTTransformArray::push_back(const SQTTransform3D& transform) {
+		resize(size() + 1u);
+		Set(size() - 1u, transform);
+	}
+
+	void SQTTransformArray::Set(std::size_t index,
+								const SQTTransform3D& transform) noexcept {
+
+		const auto translation = transform.GetTranslationView();
+		const auto rotation    = transform.GetRotationView();
+		const auto scale       = transform.GetScaleView();
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			m_translations[axis][index] = translation[axis];
+			m_scales[axis][index]       = scale[axis];
+		}
+		for (std::size_t axis = 0u; axis < 4u; ++axis) {
+			m_rotations[axis][index] = rotation[axis];
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// AffineTransformArray
+	//-------------------------------------------------------------------------
+
+	void AffineTransformArray::reserve(std::size_t size) {
+		for (auto& elements : m_elements) {
+			elements.reserve(size);
+		}
+	}
+
+	void AffineTransformArray::resize(std::size_t size) {
+		for (auto& elements : m_elements) {
+			elements.resize(size);
+		}
+	}
+
+	void AffineTransformArray::clear() noexcept {
+		for (auto& elements : m_elements) {
+			elements.clear();
+		}
+	}
+
+	void XM_CALLCONV AffineTransformArray::push_back(FXMMATRIX transform) {
+		resize(size() + 1u);
+		Set(size() - 1u, transform);
+	}
+
+	void XM_CALLCONV AffineTransformArray::Set(std::size_t index,
+											   FXMMATRIX transform) noexcept {
+
+		for (std::size_t row = 0u; row < 4u; ++row) {
+			const auto r = XMStore< F32x3 >(transform.r[row]);
+			for (std::size_t column = 0u; column < 3u; ++column) {
+				m_elements[3u * row + column][index] = r[column];
+			}
+		}
+	}
+
+	[[nodiscard]]
+	const XMMATRIX XM_CALLCONV AffineTransformArray::Get(std::size_t index) const noexcept {
+		const auto element = [this, index](std::size_t row,
+										   std::size_t column) noexcept {
+			return m_elements[3u * row + column][index];
+		};
+
+		return XMMATRIX(element(0u, 0u), element(0u, 1u), element(0u, 2u), 0.0f,
+						element(1u, 0u), element(1u, 1u), element(1u, 2u), 0.0f,
+						element(2u, 0u), element(2u, 1u), element(2u, 2u), 0.0f,
+						element(3u, 0u), element(3u, 1u), element(3u, 2u), 1.0f);
+	}
+
+	//-------------------------------------------------------------------------
+	// Batch Transforms
+	//-------------------------------------------------------------------------
+
+	void ComputeObjectToParentMatrices(const SETTransformArray& transforms,
+									   AffineTransformArray& matrices) {
+
+		matrices.resize(transforms.size());
+
+		Dispatch(transforms.size(), [&transforms, &matrices](auto lanes,
+															 std::size_t i) noexcept {
+			using L = decltype(lanes);
+
+			typename L::Vector sp, cp, sy, cy, sr, cr;
+			SinCos< L >(L::Load(transforms.GetRotations(0u) + i), sp, cp);
+			SinCos< L >(L::Load(transforms.GetRotations(1u) + i), sy, cy);
+			SinCos< L >(L::Load(transforms.GetRotations(2u) + i), sr, cr);
+
+			const auto sx = L::Load(transforms.GetScales(0u) + i);
+			const auto sy_ = L::Load(transforms.GetScales(1u) + i);
+			const auto sz = L::Load(transforms.GetScales(2u) + i);
+
+			// Scale . Rz (Roll) . Rx (Pitch) . Ry (Yaw) . Translation
+			const auto sr_sp = L::Mul(sr, sp);
+			const auto cr_sp = L::Mul(cr, sp);
+
+			typename L::Vector rows[4][3];
+			rows[0][0] = L::Mul(sx, L::MulAdd(sr_sp, sy, L::Mul(cr, cy)));
+			rows[0][1] = L::Mul(sx, L::Mul(sr, cp));
+			rows[0][2] = L::Mul(sx, L::Sub(L::Mul(sr_sp, cy), L::Mul(cr, sy)));
+			rows[1][0] = L::Mul(sy_, L::Sub(L::Mul(cr_sp, sy), L::Mul(sr, cy)));
+			rows[1][1] = L::Mul(sy_, L::Mul(cr, cp));
+			rows[1][2] = L::Mul(sy_, L::MulAdd(cr_sp, cy, L::Mul(sr, sy)));
+			rows[2][0] = L::Mul(sz, L::Mul(cp, sy));
+			rows[2][1] = L::Mul(sz, L::Sub(L::Set(0.0f), sp));
+			rows[2][2] = L::Mul(sz, L::Mul(cp, cy));
+			rows[3][0] = L::Load(transforms.GetTranslations(0u) + i);
+			rows[3][1] = L::Load(transforms.GetTranslations(1u) + i);
+			rows[3][2] = L::Load(transforms.GetTranslations(2u) + i);
+
+			StoreRows< L >(matrices, i, rows);
+		});
+	}
+
+	void ComputeObjectToParentMatrices(const SQTTransformArray& transforms,
+									   AffineTransformArray& matrices) {
+
+		matrices.resize(transforms.size());
+
+		Dispatch(transforms.size(), [&transforms, &matrices](auto lanes,
+															 std::size_t i) noexcept {
+			using L = decltype(lanes);
+
+			const auto qx = L::Load(transforms.GetRotations(0u) + i);
+			const auto qy = L::Load(transforms.GetRotations(1u) + i);
+			const auto qz = L::Load(transforms.GetRotations(2u) + i);
+			const auto qw = L::Load(transforms.GetRotations(3u) + i);
+
+			const auto two = L::Set(2.0f);
+			const auto one = L::Set(1.0f);
+			const auto x2  = L::Mul(two, qx);
+			const auto y2  = L::Mul(two, qy);
+			const auto z2  = L::Mul(two, qz);
+			const auto xx  = L::Mul(qx, x2);
+			const auto yy  = L::Mul(qy, y2);
+			const auto zz  = L::Mul(qz, z2);
+			const auto xy  = L::Mul(qx, y2);
+			const auto xz  = L::Mul(qx, z2);
+			const auto yz  = L::Mul(qy, z2);
+			const auto wx  = L::Mul(qw, x2);
+			const auto wy  = L::Mul(qw, y2);
+			const auto wz  = L::Mul(qw, z2);
+
+			const auto sx = L::Load(transforms.GetScales(0u) + i);
+			const auto sy = L::Load(transforms.GetScales(1u) + i);
+			const auto sz = L::Load(transforms.GetScales(2u) + i);
+
+			// Scale . Rotation . Translation
+			typename L::Vector rows[4][3];
+			rows[0][0] = L::Mul(sx, L::Sub(one, L::Add(yy, zz)));
+			rows[0][1] = L::Mul(sx, L::Add(xy, wz));
+			rows[0][2] = L::Mul(sx, L::Sub(xz, wy));
+			rows[1][0] = L::Mul(sy, L::Sub(xy, wz));
+			rows[1][1] = L::Mul(sy, L::Sub(one, L::Add(xx, zz)));
+			rows[1][2] = L::Mul(sy, L::Add(yz, wx));
+			rows[2][0] = L::Mul(sz, L::Add(xz, wy));
+			rows[2][1] = L::Mul(sz, L::Sub(yz, wx));
+			rows[2][2] = L::Mul(sz, L::Sub(one, L::Add(xx, yy)));
+			rows[3][0] = L::Load(transforms.GetTranslations(0u) + i);
+			rows[3][1] = L::Load(transforms.GetTranslations(1u) + i);
+			rows[3][2] = L::Load(transforms.GetTranslations(2u) + i);
+
+			StoreRows< L >(matrices, i, rows);
+		});
+	}
+
+	void Multiply(const AffineTransformArray& lhs,
+				  const AffineTransformArray& rhs,
+				  AffineTransformArray& result) {
+
+		Assert(lhs.size() == rhs.size());
+		Assert(&lhs != &result && &rhs != &result);
+
+		result.resize(lhs.size());
+
+		Dispatch(lhs.size(), [&lhs, &rhs, &result](auto lanes,
+												   std::size_t i) noexcept {
+			using L = decltype(lanes);
+
+			typename L::Vector a[4][3], b[4][3], c[4][3];
+			LoadRows< L >(lhs, i, a);
+			LoadRows< L >(rhs, i, b);
+
+			// The last column of both matrices is [0 0 0 1].
+			for (std::size_t row = 0u; row < 4u; ++row) {
+				for (std::size_t column = 0u; column < 3u; ++column) {
+					auto sum = (3u == row) ? b[3][column] : L::Set(0.0f);
+					sum = L::MulAdd(a[row][0], b[0][column], sum);
+					sum = L::MulAdd(a[row][1], b[1][column], sum);
+					sum = L::MulAdd(a[row][2], b[2][column], sum);
+					c[row][column] = sum;
+				}
+			}
+
+			StoreRows< L >(result, i, c);
+		});
+	}
+
+	void Invert(const AffineTransformArray& transforms,
+				AffineTransformArray& result) {
+
+		Assert(&transforms != &result);
+
+		result.resize(transforms.size());
+
+		Dispatch(transforms.size(), [&transforms, &result](auto lanes,
+														   std::size_t i) noexcept {
+			using L = decltype(lanes);
+
+			typename L::Vector m[4][3], inv[4][3];
+			LoadRows< L >(transforms, i, m);
+
+			// The columns of the inverse of the linear part are the cross
+			// products of its rows divided by its determinant.
+			const auto cross = [&m](std::size_t r1, std::size_t r2,
+									std::size_t k) noexcept {
+				const auto k1 = (k + 1u) % 3u;
+				const auto k2 = (k + 2u) % 3u;
+				return L::Sub(L::Mul(m[r1][k1], m[r2][k2]),
+							  L::Mul(m[r1][k2], m[r2][k1]));
+			};
+
+			for (std::size_t row = 0u; row < 3u; ++row) {
+				inv[row][0] = cross(1u, 2u, row);
+				inv[row][1] = cross(2u, 0u, row);
+				inv[row][2] = cross(0u, 1u, row);
+			}
+
+			auto det = L::Mul(m[0][0], inv[0][0]);
+			det = L::MulAdd(m[0][1], inv[1][0], det);
+			det = L::MulAdd(m[0][2], inv[2][0], det);
+			const auto inv_det = L::Div(L::Set(1.0f), det);
+
+			for (std::size_t row = 0u; row < 3u; ++row) {
+				for (std::size_t column = 0u; column < 3u; ++column) {
+					inv[row][column] = L::Mul(inv[row][column], inv_det);
+				}
+			}
+
+			// The translation is the negated translation transformed by the
+			// inverse of the linear part.
+			for (std::size_t column = 0u; column < 3u; ++column) {
+				auto t = L::Mul(m[3][0], inv[0][column]);
+				t = L::MulAdd(m[3][1], inv[1][column], t);
+				t = L::MulAdd(m[3][2], inv[2][column], t);
+				inv[3][column] = L::Sub(L::Set(0.0f), t);
+			}
+
+			StoreRows< L >(result, i, inv);
+		});
+	}
+
+	void Transform(const AABBArray& aabbs,
+				   const AffineTransformArray& transforms,
+				   AABBArray& result) {
+
+		Assert(aabbs.size() == transforms.size());
+		Assert(&aabbs != &result);
+
+		result.resize(aabbs.size());
+
+		Dispatch(aabbs.size(), [&aabbs, &transforms, &result](auto lanes,
+															  std::size_t i) noexcept {
+			using L = decltype(lanes);
+
+			typename L::Vector m[4][3];
+			LoadRows< L >(transforms, i, m);
+
+			typename L::Vector c[3], r[3];
+			for (std::size_t axis = 0u; axis < 3u; ++axis) {
+				c[axis] = L::Load(aabbs.GetCentroids(axis) + i);
+				r[axis] = L::Load(aabbs.GetRadii(axis) + i);
+			}
+
+			for (std::size_t column = 0u; column < 3u; ++column) {
+				auto centroid = m[3][column];
+				auto radius   = L::Set(0.0f);
+				for (std::size_t row = 0u; row < 3u; ++row) {
+					centroid = L::MulAdd(c[row], m[row][column], centroid);
+					radius   = L::MulAdd(r[row], L::Abs(m[row][column]), radius);
+				}
+
+				L::Store(result.GetCentroids(column) + i, centroid);
+				L::Store(result.GetRadii(column) + i, radius);
+			}
+		});
+	}
+}
@@ -0,0 +1,760 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "transform/set_transform.hpp"
+#include "transform/sqt_transform.hpp"
+#include "geometry/culling.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A type definition for the (32 byte aligned) coordinate arrays of
+	 transform arrays.
+	 */
+	using TransformCoordinates
+		= std::vector< F32, AlignedAllocator< F32, 32u > >;
+
+	//-------------------------------------------------------------------------
+	// SETTransformArray
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of SET transform arrays.
+
+	 The transforms are stored as structure of arrays (i.e. one array per
+	 coordinate of the translations, rotations and scales) to convert
+	 multiple transforms at once.
+	 */
+	class SETTransformArray {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a SET transform array.
+		 */
+		SETTransformArray() = default;
+
+		/**
+		 Constructs a SET transform array from the given SET transform array.
+
+		 @param[in]		transforms
+						A reference to the SET transform array to copy.
+		 */
+		SETTransformArray(const SETTransformArray& transforms) = default;
+
+		/**
+		 Constructs a SET transform array by moving the given SET transform
+		 array.
+
+		 @param[in]		transforms
+						A reference to the SET transform array to move.
+		 */
+		SETTransformArray(SETTransformArray&& transforms) noexcept = default;
+
+		/**
+		 Destructs this SET transform array.
+		 */
+		~SETTransformArray() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given SET transform array to this SET transform array.
+
+		 @param[in]		transforms
+						A reference to the SET transform array to copy.
+		 @return		A reference to the copy of the given SET transform
+						array (i.e. this SET transform array).
+		 */
+		SETTransformArray& operator=(const SETTransformArray&
+									 transforms) = default;
+
+		/**
+		 Moves the given SET transform array to this SET transform array.
+
+		 @param[in]		transforms
+						A reference to the SET transform array to move.
+		 @return		A reference to the moved SET transform array (i.e.
+						this SET transform array).
+		 */
+		SETTransformArray& operator=(SETTransformArray&&
+									 transforms) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this SET transform array is empty.
+
+		 @return		@c true if this SET transform array is empty.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_translations[0].empty();
+		}
+
+		/**
+		 Returns the number of transforms of this SET transform array.
+
+		 @return		The number of transforms of this SET transform array.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_translations[0].size();
+		}
+
+		/**
+		 Reserves memory for the given number of transforms.
+
+		 @param[in]		size
+						The number of transforms.
+		 */
+		void reserve(std::size_t size);
+
+		/**
+		 Resizes this SET transform array to the given number of transforms.
+		 Added transforms are zero (i.e. degenerate) transforms.
+
+		 @param[in]		size
+						The number of transforms.
+		 */
+		void resize(std::size_t size);
+
+		/**
+		 Removes all transforms of this SET transform array. The capacity is
+		 retained.
+		 */
+		void clear() noexcept;
+
+		/**
+		 Appends the given transform to this SET transform array.
+
+		 @param[in]		transform
+						A reference to the transform.
+		 */
+		void push_back(const SETTransform3D& transform);
+
+		/**
+		 Sets the transform at the given index of this SET transform array
+		 to the given transform.
+
+		 @pre			@a index is smaller than the size of this SET
+						transform array.
+		 @param[in]		index
+						The index.
+		 @param[in]		transform
+						A reference to the transform.
+		 */
+		void Set(std::size_t index, const SETTransform3D& transform) noexcept;
+
+		/**
+		 Returns the given coordinate of the translations of this SET
+		 transform array.
+
+		 @pre			@a axis is smaller than 3.
+		 @param[in]		axis
+						The index of the coordinate.
+		 @return		A pointer to the given coordinate of the translations
+						of this SET transform array.
+		 */
+		[[nodiscard]]
+		const F32* GetTranslations(std::size_t axis) const noexcept {
+			return m_translations[axis].data();
+		}
+
+		/**
+		 Returns the given coordinate of the rotations (i.e. Euler angles)
+		 of this SET transform array.
+
+		 @pre			@a axis is smaller than 3.
+		 @param[in]		axis
+						The index of the coordinate.
+		 @return		A pointer to the given coordinate of the rotations of
+						this SET transform array.
+		 */
+		[[nodiscard]]
+		const F32* GetRotations(std::size_t axis) const noexcept {
+			return m_rotations[axis].data();
+		}
+
+		/**
+		 Returns the given coordinate of the scales of this SET transform
+		 array.
+
+		 @pre			@a axis is smaller than 3.
+		 @param[in]		axis
+						The index of the coordinate.
+		 @return		A pointer to the given coordinate of the scales of
+						this SET transform array.
+		 */
+		[[nodiscard]]
+		const F32* GetScales(std::size_t axis) const noexcept {
+			return m_scales[axis].data();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The x, y and z coordinates of the translations of this SET transform
+		 array.
+		 */
+		TransformCoordinates m_translations[3];
+
+		/**
+		 The x, y and z coordinates of the rotations (i.e. pitch, yaw and
+		 roll) of this SET transform array.
+		 */
+		TransformCoordinates m_rotations[3];
+
+		/**
+		 The x, y and z coordinates of the scales of this SET transform
+		 array.
+		 */
+		TransformCoordinates m_scales[3];
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// SQTTransformArray
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of SQT transform arrays.
+
+	 The transforms are stored as structure of arrays (i.e. one array per
+	 coordinate of the translations, rotations and scales) to convert
+	 multiple transforms at once.
+	 */
+	class SQTTransformArray {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a SQT transform array.
+		 */
+		SQTTransformArray() = default;
+
+		/**
+		 Constructs a SQT transform array from the given SQT transform array.
+
+		 @param[in]		transforms
+						A reference to the SQT transform array to copy.
+		 */
+		SQTTransformArray(const SQTTransformArray& transforms) = default;
+
+		/**
+		 Constructs a SQT transform array by moving the given SQT transform
+		 array.
+
+		 @param[in]		transforms
+						A reference to the SQT transform array to move.
+		 */
+		SQTTransformArray(SQTTransformArray&& transforms) noexcept = default;
+
+		/**
+		 Destructs this SQT transform array.
+		 */
+		~SQTTransformArray() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given SQT transform array to this SQT transform array.
+
+		 @param[in]		transforms
+						A reference to the SQT transform array to copy.
+		 @return		A reference to the copy of the given SQT transform
+						array (i.e. this SQT transform array).
+		 */
+		SQTTransformArray& operator=(const SQTTransformArray&
+									 transforms) = default;
+
+		/**
+		 Moves the given SQT transform array to this SQT transform array.
+
+		 @param[in]		transforms
+						A reference to the SQT transform array to move.
+		 @return		A reference to the moved SQT transform array (i.e.
+						this SQT transform array).
+		 */
+		SQTTransformArray& operator=(SQTTransformArray&&
+									 transforms) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this SQT transform array is empty.
+
+		 @return		@c true if this SQT transform array is empty.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_translations[0].empty();
+		}
+
+		/**
+		 Returns the number of transforms of this SQT transform array.
+
+		 @return		The number of transforms of this SQT transform array.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_translations[0].size();
+		}
+
+		/**
+		 Reserves memory for the given number of transforms.
+
+		 @param[in]		size
+						The number of transforms.
+		 */
+		void reserve(std::size_t size);
+
+		/**
+		 Resizes this SQT transform array to the given number of transforms.
+		 Added transforms are zero (i.e. degenerate) transforms.
+
+		 @param[in]		size
+						The number of transforms.
+		 */
+		void resize(std::size_t size);
+
+		/**
+		 Removes all transforms of this SQT transform array. The capacity is
+		 retained.
+		 */
+		void clear() noexcept;
+
+		/**
+		 Appends the given transform to this SQT transform array.
+
+		 @param[in]		transform
+						A reference to the transform.
+		 */
+		void push_back(const SQTTransform3D& transform);
+
+		/**
+		 Sets the transform at the given index of this SQT transform array
+		 to the given transform.
+
+		 @pre			@a index is smaller than the size of this SQT
+						transform array.
+		 @param[in]		index
+						The index.
+		 @param[in]		transform
+						A reference to the transform.
+		 */
+		void Set(std::size_t index, const SQTTransform3D& transform) noexcept;
+
+		/**
+		 Returns the given coordinate of the translations of this SQT
+		 transform array.
+
+		 @pre			@a axis is smaller than 3.
+		 @param[in]		axis
+						The index of the coordinate.
+		 @return		A pointer to the given coordinate of the translations
+						of this SQT transform array.
+		 */
+		[[nodiscard]]
+		const F32* GetTranslations(std::size_t axis) const noexcept {
+			return m_translations[axis].data();
+		}
+
+		/**
+		 Returns the given coordinate of the rotations (i.e. unit
+		 quaternions) of this SQT transform array.
+
+		 @pre			@a axis is smaller than 4.
+		 @param[in]		axis
+						The index of the coordinate.
+		 @return		A pointer to the given coordinate of the rotations of
+						this SQT transform array.
+		 */
+		[[nodiscard]]
+		const F32* GetRotations(std::size_t axis) const noexcept {
+			return m_rotations[axis].data();
+		}
+
+		/**
+		 Returns the given coordinate of the scales of this SQT transform
+		 array.
+
+		 @pre			@a axis is smaller than 3.
+		 @param[in]		axis
+						The index of the coordinate.
+		 @return		A pointer to the given coordinate of the scales of
+						this SQT transform array.
+		 */
+		[[nodiscard]]
+		const F32* GetScales(std::size_t axis) const noexcept {
+			return m_scales[axis].data();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The x, y and z coordinates of the translations of this SQT transform
+		 array.
+		 */
+		TransformCoordinates m_translations[3];
+
+		/**
+		 The x, y, z and w coordinates of the rotations (i.e. unit
+		 quaternions) of this SQT transform array.
+		 */
+		TransformCoordinates m_rotations[4];
+
+		/**
+		 The x, y and z coordinates of the scales of this SQT transform
+		 array.
+		 */
+		TransformCoordinates m_scales[3];
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// AffineTransformArray
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of affine transformation matrix arrays.
+
+	 The matrices are stored as structure of arrays (i.e. one array per
+	 element of the upper 4x3 part of the matrices; the last column is
+	 always [0 0 0 1]) to multiply, invert and apply multiple matrices at
+	 once.
+	 */
+	class AffineTransformArray {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an affine transform array.
+		 */
+		AffineTransformArray() = default;
+
+		/**
+		 Constructs an affine transform array from the given affine transform
+		 array.
+
+		 @param[in]		transforms
+						A reference to the affine transform array to copy.
+		 */
+		AffineTransformArray(const AffineTransformArray& transforms) = default;
+
+		/**
+		 Constructs an affine transform array by moving the given affine
+		 transform array.
+
+		 @param[in]		transforms
+						A reference to the affine transform array to move.
+		 */
+		AffineTransformArray(AffineTransformArray&& transforms) noexcept = default;
+
+		/**
+		 Destructs this affine transform array.
+		 */
+		~AffineTransformArray() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given affine transform array to this affine transform
+		 array.
+
+		 @param[in]		transforms
+						A reference to the affine transform array to copy.
+		 @return		A reference to the copy of the given affine transform
+						array (i.e. this affine transform array).
+		 */
+		AffineTransformArray& operator=(const AffineTransformArray&
+										transforms) = default;
+
+		/**
+		 Moves the given affine transform array to this affine transform
+		 array.
+
+		 @param[in]		transforms
+						A reference to the affine transform array to move.
+		 @return		A reference to the moved affine transform array (i.e.
+						this affine transform array).
+		 */
+		AffineTransformArray& operator=(AffineTransformArray&&
+										transforms) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this affine transform array is empty.
+
+		 @return		@c true if this affine transform array is empty.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_elements[0].empty();
+		}
+
+		/**
+		 Returns the number of matrices of this affine transform array.
+
+		 @return		The number of matrices of this affine transform
+						array.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_elements[0].size();
+		}
+
+		/**
+		 Reserves memory for the given number of matrices.
+
+		 @param[in]		size
+						The number of matrices.
+		 */
+		void reserve(std::size_t size);
+
+		/**
+		 Resizes this affine transform array to the given number of matrices.
+		 Added matrices are zero (i.e. degenerate) matrices.
+
+		 @param[in]		size
+						The number of matrices.
+		 */
+		void resize(std::size_t size);
+
+		/**
+		 Removes all matrices of this affine transform array. The capacity is
+		 retained.
+		 */
+		void clear() noexcept;
+
+		/**
+		 Appends the given affine transformation matrix to this affine
+		 transform array.
+
+		 @param[in]		transform
+						The affine transformation matrix.
+		 */
+		void XM_CALLCONV push_back(FXMMATRIX transform);
+
+		/**
+		 Sets the matrix at the given index of this affine transform array to
+		 the given affine transformation matrix.
+
+		 @pre			@a index is smaller than the size of this affine
+						transform array.
+		 @param[in]		index
+						The index.
+		 @param[in]		transform
+						The affine transformation matrix.
+		 */
+		void XM_CALLCONV Set(std::size_t index, FXMMATRIX transform) noexcept;
+
+		/**
+		 Returns the matrix at the given index of this affine transform
+		 array.
+
+		 @pre			@a index is smaller than the size of this affine
+						transform array.
+		 @param[in]		index
+						The index.
+		 @return		The affine transformation matrix at the given index
+						of this affine transform array.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV Get(std::size_t index) const noexcept;
+
+		/**
+		 Returns the given element of the matrices of this affine transform
+		 array.
+
+		 @pre			@a row is smaller than 4.
+		 @pre			@a column is smaller than 3.
+		 @param[in]		row
+						The row of the element.
+		 @param[in]		column
+						The column of the element.
+		 @return		A pointer to the given element of the matrices of
+						this affine transform array.
+		 */
+		[[nodiscard]]
+		F32* GetElements(std::size_t row, std::size_t column) noexcept {
+			return m_elements[3u * row + column].data();
+		}
+
+		/**
+		 Returns the given element of the matrices of this affine transform
+		 array.
+
+		 @pre			@a row is smaller than 4.
+		 @pre			@a column is smaller than 3.
+		 @param[in]		row
+						The row of the element.
+		 @param[in]		column
+						The column of the element.
+		 @return		A pointer to the given element of the matrices of
+						this affine transform array.
+		 */
+		[[nodiscard]]
+		const F32* GetElements(std::size_t row, std::size_t column) const noexcept {
+			return m_elements[3u * row + column].data();
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The elements of the upper 4x3 part of the matrices of this affine
+		 transform array (in row-major order).
+		 */
+		TransformCoordinates m_elements[12];
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Batch Transforms
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Computes the object-to-parent matrices of the given SET transforms.
+
+	 Like all batch transforms, 8 (AVX2) or 4 (SSE2) transforms are
+	 processed per iteration. The AVX2 kernel is used if supported by the
+	 processor.
+
+	 @param[in]		transforms
+					A reference to the SET transform array.
+	 @param[out]	matrices
+					A reference to the affine transform array to store the
+					object-to-parent matrices (resized to the size of
+					@a transforms).
+	 */
+	void ComputeObjectToParentMatrices(const SETTransformArray& transforms,
+									   AffineTransformArray& matrices);
+
+	/**
+	 Computes the object-to-parent matrices of the given SQT transforms.
+
+	 @param[in]		transforms
+					A reference to the SQT transform array.
+	 @param[out]	matrices
+					A reference to the affine transform array to store the
+					object-to-parent matrices (resized to the size of
+					@a transforms).
+	 */
+	void ComputeObjectToParentMatrices(const SQTTransformArray& transforms,
+									   AffineTransformArray& matrices);
+
+	/**
+	 Multiplies the given affine transformation matrices pairwise.
+
+	 @pre			The sizes of @a lhs and @a rhs are equal.
+	 @param[in]		lhs
+					A reference to the affine transform array of the left
+					hand side matrices (e.g., object-to-parent).
+	 @param[in]		rhs
+					A reference to the affine transform array of the right
+					hand side matrices (e.g., parent-to-world).
+	 @param[out]	result
+					A reference to the affine transform array to store the
+					products (resized to the size of @a lhs). May not be
+					the same as @a lhs or @a rhs.
+	 */
+	void Multiply(const AffineTransformArray& lhs,
+				  const AffineTransformArray& rhs,
+				  AffineTransformArray& result);
+
+	/**
+	 Inverts the given affine transformation matrices.
+
+	 @pre			The given affine transformation matrices are
+					invertible.
+	 @param[in]		transforms
+					A reference to the affine transform array.
+	 @param[out]	result
+					A reference to the affine transform array to store the
+					inverse matrices (resized to the size of
+					@a transforms). May not be the same as
+					@a transforms.
+	 */
+	void Invert(const AffineTransformArray& transforms,
+				AffineTransformArray& result);
+
+	/**
+	 Transforms the given AABBs by the given affine transformation
+	 matrices pairwise (Arvo).
+
+	 The centroid of each AABB is transformed as a point and the radius of
+	 each AABB is projected on the absolute rows of the matrix (i.e. the
+	 same transform as AABB::Transform).
+
+	 @pre			The sizes of @a aabbs and @a transforms are equal.
+	 @param[in]		aabbs
+					A reference to the AABB array.
+	 @param[in]		transforms
+					A reference to the affine transform array.
+	 @param[out]	result
+					A reference to the AABB array to store the transformed
+					AABBs (resized to the size of @a aabbs). May not be the
+					same as @a aabbs.
+	 */
+	void Transform(const AABBArray& aabbs,
+				   const AffineTransformArray& transforms,
+				   AABBArray& result);
+
+	#pragma endregion
+}
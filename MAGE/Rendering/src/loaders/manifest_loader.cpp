@@ -0,0 +1,44 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\manifest_loader.hpp"
+#include "loaders\rsm\rsm_loader.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	void ImportManifestFromFile(const std::filesystem::path& path,
+								ResourceManifest& manifest) {
+
+		std::wstring extension = path.extension().wstring();
+		TransformToLowerCase(extension);
+
+		if (L".rsm" == extension) {
+			ImportRSMManifestFromFile(path, manifest);
+		}
+		else {
+			throw Exception("Unknown manifest file extension: {}", path);
+		}
+	}
+
+	void ExportManifestToFile(const std::filesystem::path& path,
+							  const ResourceManifest& manifest) {
+
+		std::wstring extension = path.extension().wstring();
+		TransformToLowerCase(extension);
+
+		if (L".rsm" == extension) {
+			ExportRSMManifestToFile(path, manifest);
+		}
+		else {
+			throw Exception("Unknown manifest file extension: {}", path);
+		}
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\rendering_resource_manifest.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 Imports the resource manifest from the file associated with the given
+	 path.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[out]	manifest
+					A reference to the resource manifest.
+	 @throws		Exception
+					Failed to import the resource manifest from file.
+	 */
+	void ImportManifestFromFile(const std::filesystem::path& path,
+								ResourceManifest& manifest);
+
+	/**
+	 Exports the given resource manifest to the file associated with the given
+	 path.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[in]		manifest
+					A reference to the resource manifest.
+	 @throws		Exception
+					Failed to export the resource manifest to file.
+	 */
+	void ExportManifestToFile(const std::filesystem::path& path,
+							  const ResourceManifest& manifest);
+}
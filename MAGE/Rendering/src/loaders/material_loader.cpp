@@ -3,9 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\material_loader.hpp"
-#include "loaders\mtl\mtl_loader.hpp"
-#include "resource\rendering_resource_manager.hpp"
+#include "loaders/material_loader.hpp"
+#include "loaders/mtl/mtl_loader.hpp"
+#include "resource/rendering_resource_manager.hpp"
 
 #pragma endregion
 
@@ -18,7 +18,11 @@ namespace mage::rendering::loader {
 								ResourceManager& resource_manaer,
 								std::vector< Material >& materials) {
 
-		std::wstring extension(path.extension());
+		// Material libraries are recorded to detect stale resource manifests.
+		resource_manaer.Record(ResourceManifestEntry::Type::MaterialLibrary,
+							   path.wstring());
+
+		std::wstring extension = path.extension().wstring();
 		TransformToLowerCase(extension);
 
 		if (L".mtl" == extension) {
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\model\model_output.hpp"
+#include "resource/model/model_output.hpp"
 
 #pragma endregion
 
@@ -40,6 +40,25 @@ namespace mage::rendering::loader {
 								const ResourceManager& resource_manager,
 								ModelOutput< VertexT, IndexT >& model_output);
 
+	/**
+	 Imports the model (without its materials) from the MDL file associated
+	 with the given path.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		path
+					A reference to the path.
+	 @param[out]	model_output
+					A reference to the model output.
+	 @throws		Exception
+					Failed to import the model from file.
+	 */
+	template< typename VertexT, typename IndexT >
+	void ImportMDLModelFromFile(const std::filesystem::path& path,
+								ModelOutput< VertexT, IndexT >& model_output);
+
 	/**
 	 Exports the given model to the MDL file associated with the given path.
 
@@ -64,6 +83,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\mdl\mdl_loader.tpp"
+#include "loaders/mdl/mdl_loader.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\mdl\mdl_reader.hpp"
-#include "loaders\mdl\mdl_writer.hpp"
+#include "loaders/mdl/mdl_reader.hpp"
+#include "loaders/mdl/mdl_writer.hpp"
 
 #pragma endregion
 
@@ -24,6 +24,14 @@ namespace mage::rendering::loader {
 		reader.ReadFromFile(path);
 	}
 
+	template< typename VertexT, typename IndexT >
+	void ImportMDLModelFromFile(const std::filesystem::path& path,
+								ModelOutput< VertexT, IndexT >& model_output) {
+
+		MDLReader< VertexT, IndexT > reader(model_output);
+		reader.ReadFromFile(path);
+	}
+
 	template< typename VertexT, typename IndexT >
 	void ExportMDLModelToFile(const std::filesystem::path& path,
 							  const ModelOutput< VertexT, IndexT >& model_output) {
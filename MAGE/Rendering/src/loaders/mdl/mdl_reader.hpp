@@ -5,8 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\line_reader.hpp"
-#include "resource\model\model_output.hpp"
+#include "io/line_reader.hpp"
+#include "loaders/msh/msh_loader.hpp"
+#include "resource/model/model_output.hpp"
 
 #pragma endregion
 
@@ -49,6 +50,16 @@ namespace mage::rendering::loader {
 		explicit MDLReader(ResourceManager& resource_manager,
 						   ModelOutput< VertexT, IndexT >& model_output);
 
+		/**
+		 Constructs a MDL reader which does not import the materials of the
+		 model.
+
+		 @param[in]		model_output
+						A reference to the model output for storing the model
+						data from file.
+		 */
+		explicit MDLReader(ModelOutput< VertexT, IndexT >& model_output);
+
 		/**
 		 Constructs a MDL reader from the given MDL reader.
 
@@ -140,6 +151,14 @@ namespace mage::rendering::loader {
 		 */
 		void ReadMDLSubModel();
 
+		/**
+		 Reads a Level of Detail definition of the last Submodel.
+
+		 @throws		Exception
+						Failed to read a Level of Detail definition.
+		 */
+		void ReadMDLLOD();
+
 		/**
 		 Reads a Material Library definition and imports the materials
 		 corresponding to the model.
@@ -156,15 +175,21 @@ namespace mage::rendering::loader {
 		//---------------------------------------------------------------------
 
 		/**
-		 A reference to the resource manager of this MDL reader.
+		 A pointer to the resource manager of this MDL reader (or
+		 @c nullptr if the materials are not imported).
 		 */
-		ResourceManager& m_resource_manager;
+		ResourceManager* m_resource_manager;
 
 		/**
 		 A reference to the model output containing the model data of this MDL
 		 reader.
 		 */
 		ModelOutput< VertexT, IndexT >& m_model_output;
+
+		/**
+		 The (memory-mapped) MSH mesh of this MDL reader.
+		 */
+		MSHMesh< VertexT, IndexT > m_mesh;
 	};
 }
 
@@ -173,6 +198,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\mdl\mdl_reader.tpp"
+#include "loaders/mdl/mdl_reader.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,9 +5,17 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\material_loader.hpp"
-#include "loaders\mdl\mdl_tokens.hpp"
-#include "loaders\msh\msh_loader.hpp"
+#include "loaders/material_loader.hpp"
+#include "loaders/mdl/mdl_tokens.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
 
 #pragma endregion
 
@@ -21,8 +29,17 @@ namespace mage::rendering::loader {
 		::MDLReader(ResourceManager& resource_manager,
 					ModelOutput< VertexT, IndexT >& model_output)
 		: LineReader(),
-		m_resource_manager(resource_manager),
-		m_model_output(model_output) {}
+		m_resource_manager(&resource_manager),
+		m_model_output(model_output),
+		m_mesh() {}
+
+	template< typename VertexT, typename IndexT >
+	MDLReader< VertexT, IndexT >
+		::MDLReader(ModelOutput< VertexT, IndexT >& model_output)
+		: LineReader(),
+		m_resource_manager(nullptr),
+		m_model_output(model_output),
+		m_mesh() {}
 
 	template< typename VertexT, typename IndexT >
 	MDLReader< VertexT, IndexT >::MDLReader(MDLReader&& reader) noexcept = default;
@@ -36,12 +53,86 @@ namespace mage::rendering::loader {
 		msh_path.replace_extension(L".msh");
 
 		ImportMSHMeshFromFile(msh_path, m_model_output.m_vertex_buffer,
-							  m_model_output.m_index_buffer);
+							  m_model_output.m_index_buffer, m_mesh);
+
+		// The model output keeps the MSH file mapped until its mesh is
+		// uploaded.
+		m_model_output.m_mapped_mesh        = m_mesh.m_mesh;
+		m_model_output.m_mapped_packed_mesh = m_mesh.m_packed_mesh;
 	}
 
 	template< typename VertexT, typename IndexT >
 	void MDLReader< VertexT, IndexT >::Postprocess() {
-		m_model_output.ComputeBoundingVolumes();
+		auto& model_parts = m_model_output.m_model_parts;
+
+		// Use the base vertex and position quantization of the packed model
+		// part starting at the start index of each model part.
+		if (m_model_output.HasMappedPackedMesh()) {
+			for (auto& model_part : model_parts) {
+				const auto it = std::find_if(m_mesh.m_part_packing.begin(),
+											 m_mesh.m_part_packing.end(),
+					[&model_part](const PackedModelPart& packed_model_part) noexcept {
+						return packed_model_part.m_start_index == model_part.m_start_index
+							&& model_part.m_nb_indices <= packed_model_part.m_nb_indices;
+					});
+				ThrowIfFailed(m_mesh.m_part_packing.end() != it,
+							  "{}: no packed model part for submodel: {}.",
+							  GetPath(), model_part.m_child);
+
+				model_part.m_base_vertex  = it->m_base_vertex;
+				model_part.m_quantization = it->m_quantization;
+			}
+		}
+
+		// Assign the mesh clusters stored in the MSH file to the model parts
+		// containing their indices.
+		for (const auto& cluster : m_mesh.m_clusters) {
+			const auto it = std::find_if(model_parts.begin(), model_parts.end(),
+				[&cluster](const ModelPart& model_part) noexcept {
+					return model_part.m_start_index <= cluster.m_start_index
+						&& cluster.m_start_index + cluster.m_nb_indices
+						   <= model_part.m_start_index + model_part.m_nb_indices;
+				});
+			if (model_parts.end() != it) {
+				it->m_clusters.push_back(cluster);
+			}
+		}
+		
+		// Use the (cooked) triangle bounding volume hierarchies and occluder
+		// meshes stored in the MSH file.
+		if (model_parts.size() == m_mesh.m_part_bvhs.size()) {
+			for (std::size_t i = 0u; i < model_parts.size(); ++i) {
+				model_parts[i].m_bvh = std::move(m_mesh.m_part_bvhs[i]);
+			}
+		}
+		if (model_parts.size() == m_mesh.m_part_occluders.size()) {
+			for (std::size_t i = 0u; i < model_parts.size(); ++i) {
+				model_parts[i].m_occluder = std::move(m_mesh.m_part_occluders[i]);
+			}
+		}
+
+		const auto nb_part_bounds = static_cast< std::size_t >(m_mesh.m_part_bounds.size());
+		const auto nb_part_obbs   = static_cast< std::size_t >(m_mesh.m_part_obbs.size());
+
+		if (model_parts.empty() || model_parts.size() != nb_part_bounds) {
+			// The bounding volumes are computed from unpacked vertices.
+			if (m_model_output.HasMappedPackedMesh()) {
+				m_model_output.UnmapMesh();
+			}
+			m_model_output.ComputeBoundingVolumes();
+			return;
+		}
+
+		// Use the bounding volumes stored in the MSH file. MSH files without
+		// OBBs fall back to the OBBs of the AABBs.
+		const auto has_obbs = (model_parts.size() == nb_part_obbs);
+		for (std::size_t i = 0u; i < model_parts.size(); ++i) {
+			const auto index = static_cast< std::ptrdiff_t >(i);
+			model_parts[i].m_aabb   = GetAABB(m_mesh.m_part_bounds[index]);
+			model_parts[i].m_sphere = GetBoundingSphere(m_mesh.m_part_bounds[index]);
+			model_parts[i].m_obb    = has_obbs ? GetOBB(m_mesh.m_part_obbs[index])
+											   : OBB(model_parts[i].m_aabb);
+		}
 	}
 
 	template< typename VertexT, typename IndexT >
@@ -54,6 +145,9 @@ namespace mage::rendering::loader {
 		else if (g_mdl_token_submodel         == token) {
 			ReadMDLSubModel();
 		}
+		else if (g_mdl_token_lod              == token) {
+			ReadMDLLOD();
+		}
 		else if (g_mdl_token_material_library == token) {
 			ReadMDLMaterialLibrary();
 		}
@@ -81,14 +175,38 @@ namespace mage::rendering::loader {
 		m_model_output.AddModelPart(std::move(model_part));
 	}
 
+	template< typename VertexT, typename IndexT >
+	void MDLReader< VertexT, IndexT >::ReadMDLLOD() {
+		auto& model_parts = m_model_output.m_model_parts;
+		ThrowIfFailed(!model_parts.empty(),
+					  "{}: line {}: level of detail without submodel.",
+					  GetPath(), GetCurrentLineNumber());
+
+		ModelPartLOD lod;
+		lod.m_start_index = Read< U32 >();
+		lod.m_nb_indices  = Read< U32 >();
+		lod.m_error       = Read< F32 >();
+
+		model_parts.back().m_lods.push_back(std::move(lod));
+	}
+
 	template< typename VertexT, typename IndexT >
 	void MDLReader< VertexT, IndexT >::ReadMDLMaterialLibrary() {
-		const UTF8toUTF16 mtl_name(Read< std::string_view >());
+		[[maybe_unused]] const auto mtl_name = Read< std::string_view >();
+
+		// Materials are only imported with the (Direct3D 11) resource manager.
+		#ifdef _WIN32
+		if (nullptr == m_resource_manager) {
+			return;
+		}
+
+		const UTF8toUTF16 mtl_wname(mtl_name);
 		auto mtl_path = GetPath();
-		mtl_path.replace_filename(std::wstring_view(mtl_name));
+		mtl_path.replace_filename(std::wstring_view(mtl_wname));
 
 		ImportMaterialFromFile(mtl_path,
-							   m_resource_manager,
+							   *m_resource_manager,
 							   m_model_output.m_material_buffer);
+		#endif // _WIN32
 	}
 }
\ No newline at end of file
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\writer.hpp"
-#include "resource\model\model_output.hpp"
+#include "io/writer.hpp"
+#include "resource/model/model_output.hpp"
 
 #pragma endregion
 
@@ -155,6 +155,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\mdl\mdl_writer.tpp"
+#include "loaders/mdl/mdl_writer.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,8 +5,18 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\mdl\mdl_tokens.hpp"
-#include "loaders\msh\msh_loader.hpp"
+#include "loaders/mdl/mdl_tokens.hpp"
+#include "loaders/msh/msh_loader.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <utility>
 
 #pragma endregion
 
@@ -44,8 +54,72 @@ namespace mage::rendering::loader {
 		auto msh_path = GetPath();
 		msh_path.replace_extension(L".msh");
 
+		std::vector< MSH2PartBounds > part_bounds;
+		std::vector< MeshCluster > clusters;
+		std::vector< MSH2PartOBB > part_obbs;
+		std::vector< SharedPtr< const TriangleBVH > > part_bvhs;
+		std::vector< SharedPtr< const OccluderMesh > > part_occluders;
+		part_bounds.reserve(m_model_output.m_model_parts.size());
+		part_obbs.reserve(m_model_output.m_model_parts.size());
+		for (const auto& model_part : m_model_output.m_model_parts) {
+			part_bounds.push_back(MakeMSH2PartBounds(model_part.m_aabb,
+				                                     model_part.m_sphere));
+			part_obbs.push_back(MakeMSH2PartOBB(model_part.m_obb));
+			clusters.insert(clusters.end(), model_part.m_clusters.begin(),
+				                            model_part.m_clusters.end());
+			part_bvhs.push_back(model_part.m_bvh);
+			part_occluders.push_back(model_part.m_occluder);
+		}
+
+		// The triangle bounding volume hierarchies and occluder meshes are
+		// built together and are only exported if built for all model parts.
+		if (std::any_of(part_bvhs.cbegin(), part_bvhs.cend(),
+						[](const auto& bvh) noexcept { return nullptr == bvh; })) {
+			part_bvhs.clear();
+			part_occluders.clear();
+		}
+
+		// Models with separated parts are exported with packed vertices.
+		if constexpr (std::is_same_v< VertexPositionNormalTexture, VertexT >) {
+			std::vector< PackedModelPart > part_packing;
+			if (ComputePackedModelParts(m_model_output, part_packing)) {
+				const auto packed_parts = gsl::make_span(std::as_const(part_packing));
+				std::vector< PackedVertexPositionNormalTexture > vertices;
+				
+				if (HasShortIndices(packed_parts)) {
+					std::vector< U16 > indices;
+					PackModel(m_model_output, packed_parts, vertices, indices);
+					ExportMSHMeshToFile(msh_path, vertices, indices,
+										gsl::make_span(std::as_const(part_bounds)),
+										packed_parts,
+										gsl::make_span(std::as_const(clusters)),
+										gsl::make_span(std::as_const(part_obbs)),
+										gsl::make_span(std::as_const(part_bvhs)),
+										gsl::make_span(std::as_const(part_occluders)));
+				}
+				else {
+					std::vector< U32 > indices;
+					PackModel(m_model_output, packed_parts, vertices, indices);
+					ExportMSHMeshToFile(msh_path, vertices, indices,
+										gsl::make_span(std::as_const(part_bounds)),
+										packed_parts,
+										gsl::make_span(std::as_const(clusters)),
+										gsl::make_span(std::as_const(part_obbs)),
+										gsl::make_span(std::as_const(part_bvhs)),
+										gsl::make_span(std::as_const(part_occluders)));
+				}
+				return;
+			}
+		}
+
 		ExportMSHMeshToFile(msh_path, m_model_output.m_vertex_buffer,
-			                          m_model_output.m_index_buffer);
+			                          m_model_output.m_index_buffer,
+			                          gsl::make_span(std::as_const(part_bounds)),
+			                          {},
+			                          gsl::make_span(std::as_const(clusters)),
+			                          gsl::make_span(std::as_const(part_obbs)),
+			                          gsl::make_span(std::as_const(part_bvhs)),
+			                          gsl::make_span(std::as_const(part_occluders)));
 	}
 
 	template< typename VertexT, typename IndexT >
@@ -57,7 +131,7 @@ namespace mage::rendering::loader {
 			return;
 		}
 
-		const std::wstring mtl_fname(mtl_path.filename());
+		const std::wstring mtl_fname = mtl_path.filename().wstring();
 
 		char buffer[MAX_PATH];
 		WriteTo(buffer, "{} {}", g_mdl_token_material_library, mtl_fname);
@@ -85,6 +159,16 @@ namespace mage::rendering::loader {
 					model_part.m_nb_indices);
 
 			WriteStringLine(not_null_buffer);
+
+			for (const auto& lod : model_part.m_lods) {
+				WriteTo(buffer, "{} {} {} {}",
+						g_mdl_token_lod,
+						lod.m_start_index,
+						lod.m_nb_indices,
+						lod.m_error);
+
+				WriteStringLine(not_null_buffer);
+			}
 		}
 	}
 }
\ No newline at end of file
@@ -0,0 +1,41 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/model_loader.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cctype>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	[[nodiscard]]
+	std::string GetCookedModelName(const std::filesystem::path& path) {
+		auto name = path.stem().u8string();
+		std::replace_if(name.begin(), name.end(), [](char c) noexcept {
+			return 0 != std::isspace(static_cast< unsigned char >(c));
+		}, '_');
+		return name;
+	}
+
+	[[nodiscard]]
+	const std::filesystem::path GetCookedModelPath(
+		const std::filesystem::path& path) {
+
+		return std::filesystem::path(g_cooked_model_directory)
+			 / std::filesystem::u8path(GetCookedModelName(path) + ".mdl");
+	}
+}
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\model\model_output.hpp"
-#include "resource\mesh\mesh_descriptor.hpp"
+#include "resource/model/model_output.hpp"
+#include "resource/mesh/mesh_descriptor.hpp"
 
 #pragma endregion
 
@@ -20,9 +20,41 @@ namespace mage::rendering {
 
 namespace mage::rendering::loader {
 
+	/**
+	 The directory containing the cooked models (relative to the working
+	 directory).
+	 */
+	constexpr const_wzstring g_cooked_model_directory = L"assets/cooked";
+
+	/**
+	 Returns the name of the cooked model of the given model file.
+
+	 @param[in]		path
+					A reference to the path of the model file.
+	 @return		The name of the cooked model (i.e. the stem of the given
+					path with whitespace replaced by underscores).
+	 */
+	[[nodiscard]]
+	std::string GetCookedModelName(const std::filesystem::path& path);
+
+	/**
+	 Returns the path of the cooked model (MDL file) of the given model file.
+
+	 @param[in]		path
+					A reference to the path of the model file.
+	 @return		The path of the cooked model of the given model file in
+					@c g_cooked_model_directory.
+	 */
+	[[nodiscard]]
+	const std::filesystem::path GetCookedModelPath(
+		const std::filesystem::path& path);
+
 	/**
 	 Imports the model from the file associated with the given path.
 
+	 If the model is cooked (see @c GetCookedModelPath), the cooked model is
+	 imported instead.
+
 	 @tparam		VertexT
 					The vertex type.
 	 @tparam		IndexT
@@ -69,6 +101,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\model_loader.tpp"
+#include "loaders/model_loader.tpp"
 
 #pragma endregion
\ No newline at end of file
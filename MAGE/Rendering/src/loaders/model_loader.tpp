@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\mdl\mdl_loader.hpp"
-#include "loaders\obj\obj_loader.hpp"
+#include "loaders/mdl/mdl_loader.hpp"
+#include "loaders/obj/obj_loader.hpp"
 
 #pragma endregion
 
@@ -21,9 +21,22 @@ namespace mage::rendering::loader {
 							 ModelOutput< VertexT, IndexT >& model_output,
 							 const MeshDescriptor< VertexT, IndexT >& mesh_desc) {
 
-		std::wstring extension(path.extension());
+		std::wstring extension = path.extension().wstring();
 		TransformToLowerCase(extension);
 
+		// Cooked models contain packed meshes.
+		if constexpr (std::is_same_v< VertexPositionNormalTexture, VertexT >) {
+			const auto cooked_path = GetCookedModelPath(path);
+			if (std::filesystem::is_regular_file(cooked_path)) {
+				ImportMDLModelFromFile(cooked_path, resource_manager, model_output);
+				return;
+			}
+
+			if (L".mdl" != extension) {
+				Warning("{}: model is not cooked to {}.", path, cooked_path);
+			}
+		}
+
 		if (L".mdl" == extension) {
 			ImportMDLModelFromFile(path, resource_manager, model_output);
 		}
@@ -39,7 +52,7 @@ namespace mage::rendering::loader {
 	void ExportModelToFile(const std::filesystem::path& path,
 						   const ModelOutput< VertexT, IndexT >& model_output) {
 
-		std::wstring extension(path.extension());
+		std::wstring extension = path.extension().wstring();
 		TransformToLowerCase(extension);
 
 		if (L".mdl" == extension) {
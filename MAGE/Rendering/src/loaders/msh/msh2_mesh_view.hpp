@@ -0,0 +1,413 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/msh/msh_format.hpp"
+#include "io/mapped_file.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 Checks whether the given data starts with a MSH v2 magic.
+
+	 @param[in]		data
+					The data.
+	 @return		@c true if the given data starts with a MSH v2 magic.
+					@c false otherwise.
+	 */
+	[[nodiscard]]
+	inline bool IsMSH2(gsl::span< const U8 > data) noexcept;
+
+	/**
+	 Returns the vertex layout of the given MSH v2 data.
+
+	 @param[in]		data
+					The data.
+	 @return		The vertex layout of the given MSH v2 data. A zero
+					vertex layout if the given data has no valid vertex
+					layout.
+	 */
+	[[nodiscard]]
+	inline const MSH2VertexLayout GetMSH2VertexLayout(
+		gsl::span< const U8 > data) noexcept;
+
+	/**
+	 A class of MSH v2 mesh views for accessing the mesh of a memory-mapped
+	 MSH v2 file without copying or converting its data.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 */
+	template< typename VertexT, typename IndexT >
+	class MSH2MeshView {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a MSH v2 mesh view for the file associated with the given
+		 path.
+
+		 @param[in]		path
+						The path.
+		 @throws		Exception
+						Failed to map the file or the file is not a valid MSH
+						v2 file for the given vertex and index type.
+		 */
+		explicit MSH2MeshView(std::filesystem::path path);
+
+		/**
+		 Constructs a MSH v2 mesh view for the given mapped file.
+
+		 @param[in]		file
+						The mapped file.
+		 @param[in]		path
+						The path of the mapped file.
+		 @throws		Exception
+						The file is not a valid MSH v2 file for the given
+						vertex and index type.
+		 */
+		explicit MSH2MeshView(MappedFile file, std::filesystem::path path);
+
+		/**
+		 Constructs a MSH v2 mesh view from the given MSH v2 mesh view.
+
+		 @param[in]		view
+						A reference to the MSH v2 mesh view to copy.
+		 */
+		MSH2MeshView(const MSH2MeshView& view) = delete;
+
+		/**
+		 Constructs a MSH v2 mesh view by moving the given MSH v2 mesh view.
+
+		 @param[in]		view
+						A reference to the MSH v2 mesh view to move.
+		 */
+		MSH2MeshView(MSH2MeshView&& view) noexcept;
+
+		/**
+		 Destructs this MSH v2 mesh view.
+		 */
+		~MSH2MeshView();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given MSH v2 mesh view to this MSH v2 mesh view.
+
+		 @param[in]		view
+						A reference to the MSH v2 mesh view to copy.
+		 @return		A reference to the copy of the given MSH v2 mesh view
+						(i.e. this MSH v2 mesh view).
+		 */
+		MSH2MeshView& operator=(const MSH2MeshView& view) = delete;
+
+		/**
+		 Moves the given MSH v2 mesh view to this MSH v2 mesh view.
+
+		 @param[in]		view
+						A reference to the MSH v2 mesh view to move.
+		 @return		A reference to the moved MSH v2 mesh view (i.e. this
+						MSH v2 mesh view).
+		 */
+		MSH2MeshView& operator=(MSH2MeshView&& view) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the vertices of this MSH v2 mesh view.
+
+		 @return		The vertices of this MSH v2 mesh view.
+		 */
+		[[nodiscard]]
+		gsl::span< const VertexT > GetVertices() const noexcept {
+			return m_vertices;
+		}
+
+		/**
+		 Returns the indices of this MSH v2 mesh view.
+
+		 @return		The indices of this MSH v2 mesh view.
+		 */
+		[[nodiscard]]
+		gsl::span< const IndexT > GetIndices() const noexcept {
+			return m_indices;
+		}
+
+		/**
+		 Returns the model part bounds of this MSH v2 mesh view.
+
+		 @return		The model part bounds of this MSH v2 mesh view.
+		 */
+		[[nodiscard]]
+		gsl::span< const MSH2PartBounds > GetPartBounds() const noexcept {
+			return m_part_bounds;
+		}
+
+		/**
+		 Returns the packed model parts of this MSH v2 mesh view.
+
+		 @return		The packed model parts of this MSH v2 mesh view (empty
+						for unpacked vertex layouts).
+		 */
+		[[nodiscard]]
+		gsl::span< const PackedModelPart > GetPartPacking() const noexcept {
+			return m_part_packing;
+		}
+
+		/**
+		 Returns the mesh clusters of this MSH v2 mesh view.
+
+		 @return		The mesh clusters of this MSH v2 mesh view (empty if
+						not stored in the file).
+		 */
+		[[nodiscard]]
+		gsl::span< const MeshCluster > GetClusters() const noexcept {
+			return m_clusters;
+		}
+
+		/**
+		 Returns the model part OBBs of this MSH v2 mesh view.
+
+		 @return		The model part OBBs of this MSH v2 mesh view (empty if
+						not stored in the file).
+		 */
+		[[nodiscard]]
+		gsl::span< const MSH2PartOBB > GetPartOBBs() const noexcept {
+			return m_part_obbs;
+		}
+
+		/**
+		 Returns the model part triangle bounding volume hierarchies of this
+		 MSH v2 mesh view.
+
+		 @return		The model part triangle bounding volume hierarchies of
+						this MSH v2 mesh view (empty if not stored in the
+						file).
+		 */
+		[[nodiscard]]
+		gsl::span< const MSH2PartBVH > GetPartBVHs() const noexcept {
+			return m_part_bvhs;
+		}
+
+		/**
+		 Returns the triangle bounding volume hierarchy nodes of all model
+		 parts of this MSH v2 mesh view.
+
+		 @return		The triangle bounding volume hierarchy nodes of all
+						model parts of this MSH v2 mesh view.
+		 */
+		[[nodiscard]]
+		gsl::span< const TriangleBVH::Node > GetBVHNodes() const noexcept {
+			return m_bvh_nodes;
+		}
+
+		/**
+		 Returns the triangle bounding volume hierarchy triangle packets of
+		 all model parts of this MSH v2 mesh view.
+
+		 @return		The triangle bounding volume hierarchy triangle
+						packets of all model parts of this MSH v2 mesh view.
+		 */
+		[[nodiscard]]
+		gsl::span< const TriangleBVH::TrianglePacket > GetBVHPackets() const noexcept {
+			return m_bvh_packets;
+		}
+
+		/**
+		 Returns the model part occluder meshes of this MSH v2 mesh view.
+
+		 @return		The model part occluder meshes of this MSH v2 mesh
+						view (empty if not stored in the file).
+		 */
+		[[nodiscard]]
+		gsl::span< const MSH2PartOccluder > GetPartOccluders() const noexcept {
+			return m_part_occluders;
+		}
+
+		/**
+		 Returns the occluder mesh vertex positions of all model parts of
+		 this MSH v2 mesh view.
+
+		 @return		The occluder mesh vertex positions of all model parts
+						of this MSH v2 mesh view.
+		 */
+		[[nodiscard]]
+		gsl::span< const F32x3 > GetOccluderPositions() const noexcept {
+			return m_occluder_positions;
+		}
+
+		/**
+		 Returns the occluder mesh indices of all model parts of this MSH v2
+		 mesh view.
+
+		 @return		The occluder mesh indices of all model parts of this
+						MSH v2 mesh view.
+		 */
+		[[nodiscard]]
+		gsl::span< const U32 > GetOccluderIndices() const noexcept {
+			return m_occluder_indices;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Validates the mapped file of this MSH v2 mesh view and sets up the
+		 views of its sections.
+
+		 @throws		Exception
+						The file is not a valid MSH v2 file for the given
+						vertex and index type.
+		 */
+		void Validate();
+
+		/**
+		 Validates the model part triangle bounding volume hierarchies of the
+		 mapped file of this MSH v2 mesh view and sets up the views of their
+		 sections.
+
+		 @param[in]		header
+						A reference to the header of the mapped file.
+		 @throws		Exception
+						The triangle bounding volume hierarchies are invalid.
+		 */
+		void ValidateBVHs(const MSH2Header& header);
+
+		/**
+		 Validates the model part occluder meshes of the mapped file of this
+		 MSH v2 mesh view and sets up the views of their sections.
+
+		 @param[in]		header
+						A reference to the header of the mapped file.
+		 @throws		Exception
+						The occluder meshes are invalid.
+		 */
+		void ValidateOccluders(const MSH2Header& header);
+
+		/**
+		 Returns the data of the given section of the mapped file of this MSH
+		 v2 mesh view.
+
+		 @tparam		T
+						The element type.
+		 @param[in]		section
+						A reference to the section.
+		 @param[in]		count
+						The expected number of elements of the section.
+		 @return		The elements of the given section.
+		 @throws		Exception
+						The given section is invalid.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		gsl::span< const T > GetSection(const MSH2Section& section,
+										U64 count) const;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The mapped file of this MSH v2 mesh view.
+		 */
+		MappedFile m_file;
+
+		/**
+		 The path of this MSH v2 mesh view.
+		 */
+		std::filesystem::path m_path;
+
+		/**
+		 The vertices of this MSH v2 mesh view.
+		 */
+		gsl::span< const VertexT > m_vertices;
+
+		/**
+		 The indices of this MSH v2 mesh view.
+		 */
+		gsl::span< const IndexT > m_indices;
+
+		/**
+		 The model part bounds of this MSH v2 mesh view.
+		 */
+		gsl::span< const MSH2PartBounds > m_part_bounds;
+
+		/**
+		 The packed model parts of this MSH v2 mesh view.
+		 */
+		gsl::span< const PackedModelPart > m_part_packing;
+
+		/**
+		 The mesh clusters of this MSH v2 mesh view.
+		 */
+		gsl::span< const MeshCluster > m_clusters;
+
+		/**
+		 The model part OBBs of this MSH v2 mesh view.
+		 */
+		gsl::span< const MSH2PartOBB > m_part_obbs;
+
+		/**
+		 The model part triangle bounding volume hierarchies of this MSH v2
+		 mesh view.
+		 */
+		gsl::span< const MSH2PartBVH > m_part_bvhs;
+
+		/**
+		 The triangle bounding volume hierarchy nodes of this MSH v2 mesh
+		 view.
+		 */
+		gsl::span< const TriangleBVH::Node > m_bvh_nodes;
+
+		/**
+		 The triangle bounding volume hierarchy triangle packets of this MSH
+		 v2 mesh view.
+		 */
+		gsl::span< const TriangleBVH::TrianglePacket > m_bvh_packets;
+
+		/**
+		 The model part occluder meshes of this MSH v2 mesh view.
+		 */
+		gsl::span< const MSH2PartOccluder > m_part_occluders;
+
+		/**
+		 The occluder mesh vertex positions of this MSH v2 mesh view.
+		 */
+		gsl::span< const F32x3 > m_occluder_positions;
+
+		/**
+		 The occluder mesh indices of this MSH v2 mesh view.
+		 */
+		gsl::span< const U32 > m_occluder_indices;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/msh/msh2_mesh_view.tpp"
+
+#pragma endregion
@@ -0,0 +1,314 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/msh/msh_tokens.hpp"
+#include "exception/exception.hpp"
+#include "io/checksum.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	[[nodiscard]]
+	inline bool IsMSH2(gsl::span< const U8 > data) noexcept {
+		const auto size = sizeof(MSH2Header::m_magic);
+		return (size <= static_cast< std::size_t >(data.size()))
+			&& (0 == std::memcmp(data.data(), g_msh2_token_magic, size));
+	}
+
+	[[nodiscard]]
+	inline const MSH2VertexLayout GetMSH2VertexLayout(
+		gsl::span< const U8 > data) noexcept {
+
+		MSH2VertexLayout layout = {};
+
+		constexpr auto min_header_size
+			= GetMSH2HeaderSize(g_msh2_token_min_version);
+
+		const auto size = static_cast< U64 >(data.size());
+		if (!IsMSH2(data) || (size < min_header_size)) {
+			return layout;
+		}
+
+		MSH2Header header = {};
+		std::memcpy(&header, data.data(), min_header_size);
+
+		const auto& section = header.m_vertex_layout;
+		if ((sizeof(MSH2VertexLayout) != section.m_size)
+			|| (size < section.m_offset)
+			|| (size - section.m_offset < section.m_size)) {
+			return layout;
+		}
+
+		std::memcpy(&layout, data.data() + section.m_offset, sizeof(layout));
+		return layout;
+	}
+
+	template< typename VertexT, typename IndexT >
+	MSH2MeshView< VertexT, IndexT >::MSH2MeshView(std::filesystem::path path)
+		: MSH2MeshView(MappedFile(path), path) {}
+
+	template< typename VertexT, typename IndexT >
+	MSH2MeshView< VertexT, IndexT >::MSH2MeshView(MappedFile file,
+		                                          std::filesystem::path path)
+		: m_file(std::move(file)),
+		m_path(std::move(path)),
+		m_vertices(),
+		m_indices(),
+		m_part_bounds(),
+		m_part_packing(),
+		m_clusters(),
+		m_part_obbs(),
+		m_part_bvhs(),
+		m_bvh_nodes(),
+		m_bvh_packets(),
+		m_part_occluders(),
+		m_occluder_positions(),
+		m_occluder_indices() {
+
+		Validate();
+	}
+
+	template< typename VertexT, typename IndexT >
+	MSH2MeshView< VertexT, IndexT >
+		::MSH2MeshView(MSH2MeshView&& view) noexcept = default;
+
+	template< typename VertexT, typename IndexT >
+	MSH2MeshView< VertexT, IndexT >::~MSH2MeshView() = default;
+
+	template< typename VertexT, typename IndexT >
+	MSH2MeshView< VertexT, IndexT >& MSH2MeshView< VertexT, IndexT >
+		::operator=(MSH2MeshView&& view) noexcept = default;
+
+	template< typename VertexT, typename IndexT >
+	void MSH2MeshView< VertexT, IndexT >::Validate() {
+		const auto data = m_file.GetData();
+		const auto size = static_cast< std::size_t >(data.size());
+
+		// Read the header.
+		constexpr auto min_header_size
+			= GetMSH2HeaderSize(g_msh2_token_min_version);
+		ThrowIfFailed(IsMSH2(data) && (min_header_size <= size),
+					  "{}: invalid mesh header.", m_path);
+
+		MSH2Header header = {};
+		std::memcpy(&header, data.data(), min_header_size);
+
+		// Headers of older versions lack the sections appended by later
+		// versions (i.e. these sections remain empty).
+		const auto header_size = GetMSH2HeaderSize(header.m_version);
+		ThrowIfFailed((0u != header_size),
+					  "{}: unsupported mesh version: {}.",
+					  m_path, header.m_version);
+		ThrowIfFailed((header_size == header.m_header_size)
+					  && (header_size <= size),
+					  "{}: invalid mesh header size.", m_path);
+		std::memcpy(&header, data.data(), header_size);
+
+		// Verify the checksum.
+		{
+			const auto payload = data.subspan(header.m_header_size);
+			ThrowIfFailed((header.m_checksum == ComputeChecksum(payload)),
+						  "{}: mesh checksum mismatch.", m_path);
+		}
+
+		// Verify the vertex layout.
+		constexpr auto expected = MakeMSH2VertexLayout< VertexT, IndexT >();
+		{
+			const auto layout
+				= GetSection< MSH2VertexLayout >(header.m_vertex_layout, 1u);
+			ThrowIfFailed((expected.m_vertex_size == layout[0].m_vertex_size)
+						  && (expected.m_index_size == layout[0].m_index_size)
+						  && (expected.m_attributes == layout[0].m_attributes),
+						  "{}: mesh vertex layout mismatch.", m_path);
+		}
+
+		m_vertices    = GetSection< VertexT >(header.m_vertices,
+											  header.m_nb_vertices);
+		m_indices     = GetSection< IndexT >(header.m_indices,
+											 header.m_nb_indices);
+		m_part_bounds = GetSection< MSH2PartBounds >(header.m_part_bounds,
+													 header.m_nb_parts);
+		m_clusters    = GetSection< MeshCluster >(header.m_clusters,
+												  header.m_clusters.m_size
+												  / sizeof(MeshCluster));
+		m_part_obbs   = GetSection< MSH2PartOBB >(header.m_part_obbs,
+												  header.m_part_obbs.m_size
+												  / sizeof(MSH2PartOBB));
+
+		// Verify the number of model part OBBs.
+		ThrowIfFailed(m_part_obbs.empty()
+					  || (header.m_nb_parts == static_cast< U64 >(m_part_obbs.size())),
+					  "{}: invalid number of mesh part OBBs.", m_path);
+
+		// Verify the indices of unpacked meshes. The indices of packed meshes
+		// are relative to the base vertex of their packed model part.
+		if (!(expected.m_attributes & MSH2VertexLayout::Packed)) {
+			const auto nb_vertices = static_cast< U64 >(m_vertices.size());
+			for (const auto index : m_indices) {
+				ThrowIfFailed((static_cast< U64 >(index) < nb_vertices),
+							  "{}: mesh index out of bounds.", m_path);
+			}
+		}
+
+		// Verify the index ranges of the mesh clusters.
+		for (const auto& cluster : m_clusters) {
+			ThrowIfFailed((U64(cluster.m_start_index) + cluster.m_nb_indices
+						   <= header.m_nb_indices),
+						  "{}: mesh cluster out of bounds.", m_path);
+		}
+
+		ValidateBVHs(header);
+		ValidateOccluders(header);
+
+		if (expected.m_attributes & MSH2VertexLayout::Packed) {
+			m_part_packing = GetSection< PackedModelPart >(header.m_part_packing,
+														   header.m_nb_parts);
+			
+			// Verify the vertex and index ranges of the packed model parts.
+			const auto nb_vertices = static_cast< U64 >(m_vertices.size());
+			const auto nb_indices  = static_cast< U64 >(m_indices.size());
+			for (const auto& part : m_part_packing) {
+				ThrowIfFailed((U64(part.m_base_vertex) + part.m_nb_vertices <= nb_vertices)
+							  && (U64(part.m_start_index) + part.m_nb_indices <= nb_indices),
+							  "{}: packed mesh part out of bounds.", m_path);
+
+				const auto indices = m_indices.subspan(
+					static_cast< std::ptrdiff_t >(part.m_start_index),
+					static_cast< std::ptrdiff_t >(part.m_nb_indices));
+				for (const auto index : indices) {
+					ThrowIfFailed((static_cast< U64 >(index) < part.m_nb_vertices),
+								  "{}: packed mesh index out of bounds.", m_path);
+				}
+			}
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MSH2MeshView< VertexT, IndexT >::ValidateBVHs(const MSH2Header& header) {
+		m_part_bvhs   = GetSection< MSH2PartBVH >(header.m_part_bvhs,
+												  header.m_part_bvhs.m_size
+												  / sizeof(MSH2PartBVH));
+		m_bvh_nodes   = GetSection< TriangleBVH::Node >(
+							header.m_bvh_nodes,
+							header.m_bvh_nodes.m_size
+							/ sizeof(TriangleBVH::Node));
+		m_bvh_packets = GetSection< TriangleBVH::TrianglePacket >(
+							header.m_bvh_packets,
+							header.m_bvh_packets.m_size
+							/ sizeof(TriangleBVH::TrianglePacket));
+
+		// Verify the number of model part triangle bounding volume
+		// hierarchies.
+		ThrowIfFailed(m_part_bvhs.empty()
+					  || (header.m_nb_parts == static_cast< U64 >(m_part_bvhs.size())),
+					  "{}: invalid number of mesh part BVHs.", m_path);
+
+		// Verify the nodes and triangle packets of each model part.
+		U64 first_node   = 0u;
+		U64 first_packet = 0u;
+		for (const auto& part_bvh : m_part_bvhs) {
+			ThrowIfFailed((first_node + part_bvh.m_nb_nodes
+						   <= static_cast< U64 >(m_bvh_nodes.size()))
+						  && (first_packet + part_bvh.m_nb_packets
+						      <= static_cast< U64 >(m_bvh_packets.size())),
+						  "{}: mesh part BVH out of bounds.", m_path);
+
+			const auto nodes = m_bvh_nodes.subspan(
+				static_cast< std::ptrdiff_t >(first_node),
+				static_cast< std::ptrdiff_t >(part_bvh.m_nb_nodes));
+			const auto packets = m_bvh_packets.subspan(
+				static_cast< std::ptrdiff_t >(first_packet),
+				static_cast< std::ptrdiff_t >(part_bvh.m_nb_packets));
+			ThrowIfFailed(TriangleBVH::IsValid(nodes, packets),
+						  "{}: invalid mesh part BVH.", m_path);
+
+			first_node   += part_bvh.m_nb_nodes;
+			first_packet += part_bvh.m_nb_packets;
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MSH2MeshView< VertexT, IndexT >::ValidateOccluders(const MSH2Header& header) {
+		m_part_occluders     = GetSection< MSH2PartOccluder >(
+								   header.m_part_occluders,
+								   header.m_part_occluders.m_size
+								   / sizeof(MSH2PartOccluder));
+		m_occluder_positions = GetSection< F32x3 >(
+								   header.m_occluder_positions,
+								   header.m_occluder_positions.m_size
+								   / sizeof(F32x3));
+		m_occluder_indices   = GetSection< U32 >(
+								   header.m_occluder_indices,
+								   header.m_occluder_indices.m_size
+								   / sizeof(U32));
+
+		// Verify the number of model part occluder meshes.
+		ThrowIfFailed(m_part_occluders.empty()
+					  || (header.m_nb_parts == static_cast< U64 >(m_part_occluders.size())),
+					  "{}: invalid number of mesh part occluders.", m_path);
+
+		// Verify the vertex positions and indices of each model part.
+		U64 first_position = 0u;
+		U64 first_index    = 0u;
+		for (const auto& part_occluder : m_part_occluders) {
+			ThrowIfFailed((first_position + part_occluder.m_nb_positions
+						   <= static_cast< U64 >(m_occluder_positions.size()))
+						  && (first_index + part_occluder.m_nb_indices
+						      <= static_cast< U64 >(m_occluder_indices.size()))
+						  && (0u == part_occluder.m_nb_indices % 3u),
+						  "{}: mesh part occluder out of bounds.", m_path);
+
+			const auto indices = m_occluder_indices.subspan(
+				static_cast< std::ptrdiff_t >(first_index),
+				static_cast< std::ptrdiff_t >(part_occluder.m_nb_indices));
+			for (const auto index : indices) {
+				ThrowIfFailed((index < part_occluder.m_nb_positions),
+							  "{}: mesh part occluder index out of bounds.",
+							  m_path);
+			}
+
+			first_position += part_occluder.m_nb_positions;
+			first_index    += part_occluder.m_nb_indices;
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	template< typename T >
+	[[nodiscard]]
+	gsl::span< const T > MSH2MeshView< VertexT, IndexT >
+		::GetSection(const MSH2Section& section, U64 count) const {
+
+		const auto data = m_file.GetData();
+		const auto size = static_cast< U64 >(data.size());
+
+		ThrowIfFailed((0u == section.m_offset % g_msh2_section_alignment),
+					  "{}: misaligned mesh section.", m_path);
+		ThrowIfFailed((section.m_offset <= size)
+					  && (section.m_size <= size - section.m_offset),
+					  "{}: end of file: mesh section out of bounds.", m_path);
+		ThrowIfFailed((count <= section.m_size / sizeof(T))
+					  && (count * sizeof(T) == section.m_size),
+					  "{}: invalid mesh section size.", m_path);
+
+		const auto first = data.data() + section.m_offset;
+		return gsl::make_span(reinterpret_cast< const T* >(first),
+							  static_cast< std::ptrdiff_t >(count));
+	}
+}
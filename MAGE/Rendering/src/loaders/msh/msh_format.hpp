@@ -0,0 +1,482 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/model/model_packing.hpp"
+#include "loaders/msh/msh_tokens.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstddef>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	//-------------------------------------------------------------------------
+	// MSH v2 File Layout
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 The alignment (in bytes) of the sections of MSH v2 files.
+	 */
+	constexpr std::size_t g_msh2_section_alignment = 16u;
+
+	/**
+	 Aligns the given offset to the section alignment of MSH v2 files.
+
+	 @param[in]		offset
+					The offset.
+	 @return		The aligned offset.
+	 */
+	[[nodiscard]]
+	constexpr U64 AlignMSH2Offset(U64 offset) noexcept {
+		return (offset + g_msh2_section_alignment - 1u)
+			& ~static_cast< U64 >(g_msh2_section_alignment - 1u);
+	}
+
+	/**
+	 A struct of MSH v2 sections.
+	 */
+	struct MSH2Section {
+
+		/**
+		 The offset (in bytes) of this section relative to the beginning of
+		 the file.
+		 */
+		U64 m_offset;
+
+		/**
+		 The size (in bytes) of this section.
+		 */
+		U64 m_size;
+	};
+
+	static_assert(16u == sizeof(MSH2Section));
+
+	/**
+	 A struct of MSH v2 headers. All data of MSH v2 files is stored in native
+	 little-endian byte order.
+	 */
+	struct MSH2Header {
+
+		/**
+		 The magic of this header (@c g_msh2_token_magic without terminating
+		 null character).
+		 */
+		char m_magic[8];
+
+		/**
+		 The version of this header (at least @c g_msh2_token_min_version
+		 and at most @c g_msh2_token_version).
+		 */
+		U32 m_version;
+
+		/**
+		 The size (in bytes) of this header (@c GetMSH2HeaderSize of the
+		 version of this header).
+		 */
+		U32 m_header_size;
+
+		/**
+		 The number of vertices.
+		 */
+		U64 m_nb_vertices;
+
+		/**
+		 The number of indices.
+		 */
+		U64 m_nb_indices;
+
+		/**
+		 The number of model parts with bounds.
+		 */
+		U64 m_nb_parts;
+
+		/**
+		 The checksum of all bytes following this header
+		 (@c ComputeChecksum).
+		 */
+		U64 m_checksum;
+
+		/**
+		 The vertex layout section (@c MSH2VertexLayout).
+		 */
+		MSH2Section m_vertex_layout;
+
+		/**
+		 The vertex data section.
+		 */
+		MSH2Section m_vertices;
+
+		/**
+		 The index data section.
+		 */
+		MSH2Section m_indices;
+
+		/**
+		 The model part bounds section (@c MSH2PartBounds).
+		 */
+		MSH2Section m_part_bounds;
+
+		/**
+		 The packed model parts section (@c PackedModelPart). This section is
+		 only non-empty for packed vertex layouts and is absent from headers
+		 before version 3.
+		 */
+		MSH2Section m_part_packing;
+
+		/**
+		 The mesh clusters section (@c MeshCluster). This section is absent
+		 from headers before version 4.
+		 */
+		MSH2Section m_clusters;
+
+		/**
+		 The model part OBBs section (@c MSH2PartOBB). This section is absent
+		 from headers before version 5.
+		 */
+		MSH2Section m_part_obbs;
+
+		/**
+		 The model part triangle bounding volume hierarchies section
+		 (@c MSH2PartBVH). This and the following sections are absent from
+		 headers before version 6.
+		 */
+		MSH2Section m_part_bvhs;
+
+		/**
+		 The triangle bounding volume hierarchy nodes section
+		 (@c TriangleBVH::Node) of all model parts.
+		 */
+		MSH2Section m_bvh_nodes;
+
+		/**
+		 The triangle bounding volume hierarchy triangle packets section
+		 (@c TriangleBVH::TrianglePacket) of all model parts.
+		 */
+		MSH2Section m_bvh_packets;
+
+		/**
+		 The model part occluder meshes section (@c MSH2PartOccluder).
+		 */
+		MSH2Section m_part_occluders;
+
+		/**
+		 The occluder mesh vertex positions section (@c F32x3) of all model
+		 parts.
+		 */
+		MSH2Section m_occluder_positions;
+
+		/**
+		 The occluder mesh indices section (@c U32) of all model parts.
+		 */
+		MSH2Section m_occluder_indices;
+	};
+
+	static_assert(0u == sizeof(MSH2Header) % g_msh2_section_alignment);
+
+	/**
+	 Returns the size (in bytes) of MSH v2 headers of the given version.
+
+	 Each version appends sections to the header of the previous version:
+	 version 3 the packed model parts section, version 4 the mesh clusters
+	 section, version 5 the model part OBBs section and version 6 the
+	 triangle bounding volume hierarchy and occluder mesh sections.
+
+	 @param[in]		version
+					The version.
+	 @return		The size (in bytes) of MSH v2 headers of the given
+					version.
+	 @return		0 if the given version is not supported.
+	 */
+	[[nodiscard]]
+	constexpr std::size_t GetMSH2HeaderSize(U32 version) noexcept {
+		switch (version) {
+		case 2u:
+			return offsetof(MSH2Header, m_part_packing);
+		case 3u:
+			return offsetof(MSH2Header, m_clusters);
+		case 4u:
+			return offsetof(MSH2Header, m_part_obbs);
+		case 5u:
+			return offsetof(MSH2Header, m_part_bvhs);
+		case 6u:
+			return sizeof(MSH2Header);
+		default:
+			return 0u;
+		}
+	}
+
+	static_assert(112u == GetMSH2HeaderSize(g_msh2_token_min_version));
+	static_assert(sizeof(MSH2Header) == GetMSH2HeaderSize(g_msh2_token_version));
+
+	/**
+	 A struct of MSH v2 vertex layouts.
+	 */
+	struct MSH2VertexLayout {
+
+		/**
+		 An enumeration of the different vertex attributes.
+		 */
+		enum Attribute : U32 {
+			Position = 1u << 0u,
+			Normal   = 1u << 1u,
+			Texture  = 1u << 2u,
+			Color    = 1u << 3u,
+			Packed   = 1u << 4u
+		};
+
+		/**
+		 The size (in bytes) of a vertex.
+		 */
+		U32 m_vertex_size;
+
+		/**
+		 The size (in bytes) of an index.
+		 */
+		U32 m_index_size;
+
+		/**
+		 The vertex attributes (@c Attribute flags).
+		 */
+		U32 m_attributes;
+
+		/**
+		 Reserved (zero).
+		 */
+		U32 m_reserved;
+	};
+
+	static_assert(16u == sizeof(MSH2VertexLayout));
+
+	/**
+	 Returns the MSH v2 vertex layout of the given vertex and index type.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @return		The MSH v2 vertex layout.
+	 */
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	constexpr const MSH2VertexLayout MakeMSH2VertexLayout() noexcept {
+		U32 attributes = 0u;
+		if constexpr (VertexT::HasPosition()) {
+			attributes |= MSH2VertexLayout::Position;
+		}
+		if constexpr (VertexT::HasNormal()) {
+			attributes |= MSH2VertexLayout::Normal;
+		}
+		if constexpr (VertexT::HasTexture()) {
+			attributes |= MSH2VertexLayout::Texture;
+		}
+		if constexpr (VertexT::HasColor()) {
+			attributes |= MSH2VertexLayout::Color;
+		}
+		if constexpr (std::is_same_v< PackedVertexPositionNormalTexture, VertexT >) {
+			attributes |= MSH2VertexLayout::Packed;
+		}
+
+		return {
+			static_cast< U32 >(sizeof(VertexT)),
+			static_cast< U32 >(sizeof(IndexT)),
+			attributes,
+			0u
+		};
+	}
+
+	/**
+	 A struct of MSH v2 model part bounds.
+	 */
+	struct MSH2PartBounds {
+
+		/**
+		 The minimum point of the AABB.
+		 */
+		F32x3 m_aabb_min;
+
+		/**
+		 The maximum point of the AABB.
+		 */
+		F32x3 m_aabb_max;
+
+		/**
+		 The centroid of the bounding sphere.
+		 */
+		F32x3 m_sphere_centroid;
+
+		/**
+		 The radius of the bounding sphere.
+		 */
+		F32 m_sphere_radius;
+	};
+
+	static_assert(40u == sizeof(MSH2PartBounds));
+
+	/**
+	 Creates MSH v2 model part bounds from the given bounding volumes.
+
+	 @param[in]		aabb
+					A reference to the AABB.
+	 @param[in]		sphere
+					A reference to the bounding sphere.
+	 @return		The MSH v2 model part bounds.
+	 */
+	[[nodiscard]]
+	inline const MSH2PartBounds MakeMSH2PartBounds(const AABB& aabb,
+		                                           const BoundingSphere& sphere) noexcept {
+		return {
+			XMStore< F32x3 >(aabb.MinPoint()),
+			XMStore< F32x3 >(aabb.MaxPoint()),
+			XMStore< F32x3 >(sphere.Centroid()),
+			sphere.Radius()
+		};
+	}
+
+	/**
+	 Returns the AABB of the given MSH v2 model part bounds.
+
+	 @param[in]		bounds
+					A reference to the MSH v2 model part bounds.
+	 @return		The AABB of the given MSH v2 model part bounds.
+	 */
+	[[nodiscard]]
+	inline const AABB GetAABB(const MSH2PartBounds& bounds) noexcept {
+		return AABB(XMLoad(bounds.m_aabb_min), XMLoad(bounds.m_aabb_max));
+	}
+
+	/**
+	 Returns the bounding sphere of the given MSH v2 model part bounds.
+
+	 @param[in]		bounds
+					A reference to the MSH v2 model part bounds.
+	 @return		The bounding sphere of the given MSH v2 model part bounds.
+	 */
+	[[nodiscard]]
+	inline const BoundingSphere GetBoundingSphere(
+		const MSH2PartBounds& bounds) noexcept {
+
+		return BoundingSphere(XMLoad(bounds.m_sphere_centroid),
+							  bounds.m_sphere_radius);
+	}
+
+	/**
+	 A struct of MSH v2 model part OBBs.
+	 */
+	struct MSH2PartOBB {
+
+		/**
+		 The centroid of the OBB.
+		 */
+		F32x3 m_centroid;
+
+		/**
+		 The half axes of the OBB.
+		 */
+		F32x3 m_axes[3];
+	};
+
+	static_assert(48u == sizeof(MSH2PartOBB));
+
+	/**
+	 Creates a MSH v2 model part OBB from the given OBB.
+
+	 @param[in]		obb
+					A reference to the OBB.
+	 @return		The MSH v2 model part OBB.
+	 */
+	[[nodiscard]]
+	inline const MSH2PartOBB MakeMSH2PartOBB(const OBB& obb) noexcept {
+		return {
+			XMStore< F32x3 >(obb.Centroid()),
+			{
+				XMStore< F32x3 >(obb.Axis(0)),
+				XMStore< F32x3 >(obb.Axis(1)),
+				XMStore< F32x3 >(obb.Axis(2))
+			}
+		};
+	}
+
+	/**
+	 Returns the OBB of the given MSH v2 model part OBB.
+
+	 @param[in]		obb
+					A reference to the MSH v2 model part OBB.
+	 @return		The OBB of the given MSH v2 model part OBB.
+	 */
+	[[nodiscard]]
+	inline const OBB GetOBB(const MSH2PartOBB& obb) noexcept {
+		return OBB(XMLoad(obb.m_centroid),
+				   XMLoad(obb.m_axes[0]),
+				   XMLoad(obb.m_axes[1]),
+				   XMLoad(obb.m_axes[2]));
+	}
+
+	/**
+	 A struct of MSH v2 model part triangle bounding volume hierarchies. The
+	 nodes and triangle packets of the model parts are stored consecutively
+	 in model part order.
+	 */
+	struct MSH2PartBVH {
+
+		/**
+		 The minimum point of the AABB.
+		 */
+		F32x3 m_aabb_min;
+
+		/**
+		 The number of nodes.
+		 */
+		U32 m_nb_nodes;
+
+		/**
+		 The maximum point of the AABB.
+		 */
+		F32x3 m_aabb_max;
+
+		/**
+		 The number of triangle packets.
+		 */
+		U32 m_nb_packets;
+	};
+
+	static_assert(32u == sizeof(MSH2PartBVH));
+	static_assert(112u == sizeof(TriangleBVH::Node));
+	static_assert(160u == sizeof(TriangleBVH::TrianglePacket));
+
+	/**
+	 A struct of MSH v2 model part occluder meshes. The vertex positions and
+	 indices of the model parts are stored consecutively in model part order.
+	 Model parts without an occluder mesh have an empty occluder mesh.
+	 */
+	struct MSH2PartOccluder {
+
+		/**
+		 The number of vertex positions.
+		 */
+		U32 m_nb_positions;
+
+		/**
+		 The number of indices.
+		 */
+		U32 m_nb_indices;
+	};
+
+	static_assert(8u == sizeof(MSH2PartOccluder));
+
+	#pragma endregion
+}
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "loaders/msh/msh_format.hpp"
 
 #pragma endregion
 
@@ -24,9 +24,87 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering::loader {
 
+	/**
+	 A struct of MSH meshes referencing the sections of a memory-mapped MSH v2
+	 file.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 */
+	template< typename VertexT, typename IndexT >
+	struct MSHMesh {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the memory-mapped MSH v2 file of this MSH mesh. The
+		 sections of this MSH mesh remain valid as long as the file is
+		 alive.
+		 */
+		SharedPtr< const void > m_file;
+
+		/**
+		 The mapped mesh of this MSH mesh. The mapped mesh is not mapped if
+		 the mesh is packed or read into vertex and index buffers instead.
+		 */
+		MappedMesh< VertexT, IndexT > m_mesh;
+
+		/**
+		 The mapped packed mesh of this MSH mesh (if any). The indices are
+		 relative to the base vertex of their packed model part.
+		 */
+		MappedPackedMesh m_packed_mesh;
+
+		/**
+		 The packed model parts of this MSH mesh (empty if not packed).
+		 */
+		gsl::span< const PackedModelPart > m_part_packing;
+
+		/**
+		 The bounds of the model parts of this MSH mesh (empty if not stored
+		 in the file).
+		 */
+		gsl::span< const MSH2PartBounds > m_part_bounds;
+
+		/**
+		 The mesh clusters of this MSH mesh (empty if not stored in the
+		 file).
+		 */
+		gsl::span< const MeshCluster > m_clusters;
+
+		/**
+		 The OBBs of the model parts of this MSH mesh (empty if not stored in
+		 the file).
+		 */
+		gsl::span< const MSH2PartOBB > m_part_obbs;
+
+		/**
+		 The triangle bounding volume hierarchies of the model parts of this
+		 MSH mesh (empty if not stored in the file).
+		 */
+		std::vector< SharedPtr< const TriangleBVH > > m_part_bvhs;
+
+		/**
+		 The occluder meshes of the model parts of this MSH mesh (empty if not
+		 stored in the file). Model parts without an occluder mesh have an
+		 empty occluder mesh.
+		 */
+		std::vector< SharedPtr< const OccluderMesh > > m_part_occluders;
+	};
+
 	/**
 	 Imports the mesh from the MSH file associated with the given path.
 
+	 MSH v2 files are memory mapped and validated, MSH v1 files are read
+	 sequentially. Packed MSH v2 meshes are unpacked and their indices are
+	 rebased.
+
 	 @tparam		VertexT
 					The vertex type.
 	 @tparam		IndexT
@@ -46,6 +124,40 @@ namespace mage::rendering::loader {
 		                       std::vector< VertexT >& vertices,
 		                       std::vector< IndexT >& indices);
 
+	/**
+	 Imports the mesh, the bounds of its model parts, its mesh clusters, the
+	 OBBs of its model parts and the triangle bounding volume hierarchies and
+	 occluder meshes of its model parts from the MSH file associated with the
+	 given path.
+
+	 The vertices and indices of MSH v2 files are not copied, but referenced
+	 by the mapped (packed) mesh of the given MSH mesh. Packed meshes are
+	 neither unpacked nor requantized. MSH v1 files are read into the given
+	 vectors instead.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		path
+					A reference to the path.
+	 @param[out]	vertices
+					A reference to a vector containing the vertices of the
+					mesh (if not mapped).
+	 @param[out]	indices
+					A reference to a vector containing the indices of the mesh
+					(if not mapped).
+	 @param[out]	mesh
+					A reference to the MSH mesh.
+	 @throws		Exception
+					Failed to import the mesh from file.
+	 */
+	template< typename VertexT, typename IndexT >
+	void ImportMSHMeshFromFile(const std::filesystem::path& path,
+		                       std::vector< VertexT >& vertices,
+		                       std::vector< IndexT >& indices,
+		                       MSHMesh< VertexT, IndexT >& mesh);
+
 	/**
 	 Exports the given mesh to the MSH file associated with the given path.
 
@@ -60,13 +172,33 @@ namespace mage::rendering::loader {
 					mesh.
 	 @param[in]		indices
 					A reference to a vector containing the indices of the mesh.
+	 @param[in]		part_bounds
+					The bounds of the model parts.
+	 @param[in]		part_packing
+					The packed model parts (only for packed vertex types).
+	 @param[in]		clusters
+					The mesh clusters.
+	 @param[in]		part_obbs
+					The OBBs of the model parts.
+	 @param[in]		part_bvhs
+					The triangle bounding volume hierarchies of the model
+					parts (all non-null).
+	 @param[in]		part_occluders
+					The occluder meshes of the model parts (null for model
+					parts without an occluder mesh).
 	 @throws		Exception
 					Failed to export the mesh to file.
 	 */
 	template< typename VertexT, typename IndexT >
 	void ExportMSHMeshToFile(const std::filesystem::path& path,
 		                     const std::vector< VertexT >& vertices,
-		                     const std::vector< IndexT >& indices);
+		                     const std::vector< IndexT >& indices,
+		                     gsl::span< const MSH2PartBounds > part_bounds = {},
+		                     gsl::span< const PackedModelPart > part_packing = {},
+		                     gsl::span< const MeshCluster > clusters = {},
+		                     gsl::span< const MSH2PartOBB > part_obbs = {},
+		                     gsl::span< const SharedPtr< const TriangleBVH > > part_bvhs = {},
+		                     gsl::span< const SharedPtr< const OccluderMesh > > part_occluders = {});
 }
 
 //-----------------------------------------------------------------------------
@@ -74,6 +206,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\msh\msh_loader.tpp"
+#include "loaders/msh/msh_loader.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,8 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\msh\msh_reader.hpp"
-#include "loaders\msh\msh_writer.hpp"
+#include "loaders/msh/msh2_mesh_view.hpp"
+#include "loaders/msh/msh_reader.hpp"
+#include "loaders/msh/msh_writer.hpp"
 
 #pragma endregion
 
@@ -15,11 +16,188 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering::loader {
 
+	namespace details {
+
+		/**
+		 Sets the sections of the given MSH mesh to the sections of the given
+		 MSH v2 mesh view.
+
+		 @tparam		MeshVertexT
+						The vertex type of the MSH v2 mesh view.
+		 @tparam		MeshIndexT
+						The index type of the MSH v2 mesh view.
+		 @tparam		VertexT
+						The vertex type of the MSH mesh.
+		 @tparam		IndexT
+						The index type of the MSH mesh.
+		 @param[in]		view
+						A pointer to the MSH v2 mesh view.
+		 @param[out]	mesh
+						A reference to the MSH mesh.
+		 */
+		template< typename MeshVertexT, typename MeshIndexT,
+				  typename VertexT, typename IndexT >
+		void SetMSH2Sections(SharedPtr< const MSH2MeshView< MeshVertexT, MeshIndexT > > view,
+							 MSHMesh< VertexT, IndexT >& mesh) {
+
+			mesh.m_part_bounds = view->GetPartBounds();
+			mesh.m_clusters    = view->GetClusters();
+			mesh.m_part_obbs   = view->GetPartOBBs();
+
+			// Copy the triangle bounding volume hierarchies of the model
+			// parts (already validated).
+			{
+				const auto nodes   = view->GetBVHNodes();
+				const auto packets = view->GetBVHPackets();
+				std::ptrdiff_t first_node   = 0;
+				std::ptrdiff_t first_packet = 0;
+				for (const auto& part_bvh : view->GetPartBVHs()) {
+					const auto nb_nodes   = static_cast< std::ptrdiff_t >(part_bvh.m_nb_nodes);
+					const auto nb_packets = static_cast< std::ptrdiff_t >(part_bvh.m_nb_packets);
+					const AABB aabb(XMLoad(part_bvh.m_aabb_min),
+									XMLoad(part_bvh.m_aabb_max));
+
+					mesh.m_part_bvhs.push_back(MakeShared< TriangleBVH >(
+						aabb,
+						nodes.subspan(first_node, nb_nodes),
+						packets.subspan(first_packet, nb_packets)));
+
+					first_node   += nb_nodes;
+					first_packet += nb_packets;
+				}
+			}
+
+			// Copy the occluder meshes of the model parts (already
+			// validated).
+			{
+				const auto positions = view->GetOccluderPositions();
+				const auto indices   = view->GetOccluderIndices();
+				auto first_position  = positions.begin();
+				auto first_index     = indices.begin();
+				for (const auto& part_occluder : view->GetPartOccluders()) {
+					const auto last_position = first_position
+						+ static_cast< std::ptrdiff_t >(part_occluder.m_nb_positions);
+					const auto last_index    = first_index
+						+ static_cast< std::ptrdiff_t >(part_occluder.m_nb_indices);
+
+					mesh.m_part_occluders.push_back(MakeShared< OccluderMesh >(
+						std::vector< F32x3 >(first_position, last_position),
+						std::vector< U32 >(first_index, last_index)));
+
+					first_position = last_position;
+					first_index    = last_index;
+				}
+			}
+
+			mesh.m_file = std::move(view);
+		}
+
+		/**
+		 Imports the packed mesh of the given mapped MSH v2 file. The packed
+		 vertices and indices are referenced, not copied.
+
+		 @tparam		PackedIndexT
+						The packed index type.
+		 @tparam		IndexT
+						The index type.
+		 @param[in]		file
+						The mapped file.
+		 @param[in]		path
+						A reference to the path of the mapped file.
+		 @param[out]	mesh
+						A reference to the MSH mesh.
+		 @throws		Exception
+						Failed to import the mesh from file.
+		 */
+		template< typename PackedIndexT, typename IndexT >
+		void ImportPackedMSHMesh(MappedFile file,
+								 const std::filesystem::path& path,
+								 MSHMesh< VertexPositionNormalTexture, IndexT >& mesh) {
+
+			using PackedVertexT = PackedVertexPositionNormalTexture;
+			SharedPtr< const MSH2MeshView< PackedVertexT, PackedIndexT > > view
+				= MakeShared< MSH2MeshView< PackedVertexT, PackedIndexT > >(
+					std::move(file), path);
+
+			mesh.m_packed_mesh = MappedMesh< PackedVertexT, PackedIndexT >{
+				view, view->GetVertices(), view->GetIndices() };
+			mesh.m_part_packing = view->GetPartPacking();
+
+			SetMSH2Sections(std::move(view), mesh);
+		}
+	}
+
 	template< typename VertexT, typename IndexT >
 	void ImportMSHMeshFromFile(const std::filesystem::path& path,
 		                       std::vector< VertexT >& vertices,
 		                       std::vector< IndexT >& indices) {
 
+		MSHMesh< VertexT, IndexT > mesh;
+		ImportMSHMeshFromFile(path, vertices, indices, mesh);
+
+		if (mesh.m_mesh.IsMapped()) {
+			const auto v = mesh.m_mesh.m_vertices;
+			const auto i = mesh.m_mesh.m_indices;
+			vertices.assign(v.begin(), v.end());
+			indices.assign(i.begin(), i.end());
+		}
+
+		if constexpr (std::is_same_v< VertexPositionNormalTexture, VertexT >) {
+			std::visit([&vertices, &indices, &mesh](const auto& packed_mesh) {
+				using MeshT = std::decay_t< decltype(packed_mesh) >;
+				if constexpr (!std::is_same_v< std::monostate, MeshT >) {
+					UnpackModel(packed_mesh.m_vertices, packed_mesh.m_indices,
+								mesh.m_part_packing, vertices, indices);
+				}
+			}, mesh.m_packed_mesh);
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ImportMSHMeshFromFile(const std::filesystem::path& path,
+		                       std::vector< VertexT >& vertices,
+		                       std::vector< IndexT >& indices,
+		                       MSHMesh< VertexT, IndexT >& mesh) {
+
+		mesh = {};
+
+		{
+			MappedFile file(path);
+			
+			if constexpr (std::is_same_v< VertexPositionNormalTexture, VertexT >) {
+				const auto layout = GetMSH2VertexLayout(file.GetData());
+				if (layout.m_attributes & MSH2VertexLayout::Packed) {
+					// The packed vertices and indices are referenced, not
+					// copied.
+					vertices.clear();
+					indices.clear();
+					if (sizeof(U16) == layout.m_index_size) {
+						details::ImportPackedMSHMesh< U16 >(std::move(file), path,
+															mesh);
+					}
+					else {
+						details::ImportPackedMSHMesh< U32 >(std::move(file), path,
+															mesh);
+					}
+					return;
+				}
+			}
+
+			if (IsMSH2(file.GetData())) {
+				// The vertices and indices are referenced, not copied.
+				SharedPtr< const MSH2MeshView< VertexT, IndexT > > view
+					= MakeShared< MSH2MeshView< VertexT, IndexT > >(
+						std::move(file), path);
+
+				vertices.clear();
+				indices.clear();
+				mesh.m_mesh = { view, view->GetVertices(), view->GetIndices() };
+				details::SetMSH2Sections(std::move(view), mesh);
+				return;
+			}
+		}
+
+		// Fall back to the MSH v1 reader.
 		MSHReader< VertexT, IndexT > reader(vertices, indices);
 		reader.ReadFromFile(path);
 	}
@@ -27,9 +205,17 @@ namespace mage::rendering::loader {
 	template< typename VertexT, typename IndexT >
 	void ExportMSHMeshToFile(const std::filesystem::path& path,
 		                     const std::vector< VertexT >& vertices,
-		                     const std::vector< IndexT >& indices) {
+		                     const std::vector< IndexT >& indices,
+		                     gsl::span< const MSH2PartBounds > part_bounds,
+		                     gsl::span< const PackedModelPart > part_packing,
+		                     gsl::span< const MeshCluster > clusters,
+		                     gsl::span< const MSH2PartOBB > part_obbs,
+		                     gsl::span< const SharedPtr< const TriangleBVH > > part_bvhs,
+		                     gsl::span< const SharedPtr< const OccluderMesh > > part_occluders) {
 
-		MSHWriter< VertexT, IndexT > writer(vertices, indices);
+		MSHWriter< VertexT, IndexT > writer(vertices, indices, part_bounds,
+			                                part_packing, clusters, part_obbs,
+			                                part_bvhs, part_occluders);
 		writer.WriteToFile(path);
 	}
 }
\ No newline at end of file
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\binary_reader.hpp"
+#include "io/binary_reader.hpp"
 
 #pragma endregion
 
@@ -152,6 +152,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\msh\msh_reader.tpp"
+#include "loaders/msh/msh_reader.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\msh\msh_tokens.hpp"
-#include "exception\exception.hpp"
+#include "loaders/msh/msh_tokens.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -47,11 +47,11 @@ namespace mage::rendering::loader {
 		const auto nb_vertices = Read< U32 >();
 		const auto nb_indices  = Read< U32 >();
 
-		const auto vertices = ReadArray< VertexT >(nb_vertices);
-		m_vertices.assign(vertices, vertices + nb_vertices);
+		m_vertices.resize(nb_vertices);
+		ReadArray(gsl::make_span(m_vertices));
 
-		const auto indices   = ReadArray< IndexT >(nb_indices);
-		m_indices.assign(indices, indices + nb_indices);
+		m_indices.resize(nb_indices);
+		ReadArray(gsl::make_span(m_indices));
 	}
 
 	template< typename VertexT, typename IndexT >
@@ -5,5 +5,8 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering::loader {
 
-	constexpr const_zstring g_msh_token_magic = "MAGEmesh";
+	constexpr const_zstring g_msh_token_magic    = "MAGEmesh";
+	constexpr const_zstring g_msh2_token_magic   = "MAGEmsh2";
+	constexpr U32           g_msh2_token_version     = 6u;
+	constexpr U32           g_msh2_token_min_version = 2u;
 }
\ No newline at end of file
@@ -5,7 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\binary_writer.hpp"
+#include "loaders/msh/msh_format.hpp"
+#include "io/binary_writer.hpp"
 
 #pragma endregion
 
@@ -24,7 +25,7 @@
 namespace mage::rendering::loader {
 
 	/**
-	 A class of MSH file writers for writing meshes.
+	 A class of MSH file writers for writing meshes (MSH v2).
 
 	 @tparam		VertexT
 					The vertex type.
@@ -48,9 +49,30 @@ namespace mage::rendering::loader {
 						A reference to a vector containing the vertices.
 		 @param[in]		indices
 						A reference to a vector containing the indices.
+		 @param[in]		part_bounds
+						The bounds of the model parts.
+		 @param[in]		part_packing
+						The packed model parts (only for packed vertex
+						types).
+		 @param[in]		clusters
+						The mesh clusters.
+		 @param[in]		part_obbs
+						The OBBs of the model parts.
+		 @param[in]		part_bvhs
+						The triangle bounding volume hierarchies of the model
+						parts (all non-null).
+		 @param[in]		part_occluders
+						The occluder meshes of the model parts (null for model
+						parts without an occluder mesh).
 		 */
 		explicit MSHWriter(const std::vector< VertexT >& vertices,
-			               const std::vector< IndexT >& indices);
+			               const std::vector< IndexT >& indices,
+			               gsl::span< const MSH2PartBounds > part_bounds = {},
+			               gsl::span< const PackedModelPart > part_packing = {},
+			               gsl::span< const MeshCluster > clusters = {},
+			               gsl::span< const MSH2PartOBB > part_obbs = {},
+			               gsl::span< const SharedPtr< const TriangleBVH > > part_bvhs = {},
+			               gsl::span< const SharedPtr< const OccluderMesh > > part_occluders = {});
 
 		/**
 		 Constructs a MSH writer from the given MSH writer.
@@ -132,6 +154,37 @@ namespace mage::rendering::loader {
 		 writer.
 		 */
 		const std::vector< IndexT >& m_indices;
+
+		/**
+		 The bounds of the model parts to write by this MSH writer.
+		 */
+		gsl::span< const MSH2PartBounds > m_part_bounds;
+
+		/**
+		 The packed model parts to write by this MSH writer.
+		 */
+		gsl::span< const PackedModelPart > m_part_packing;
+
+		/**
+		 The mesh clusters to write by this MSH writer.
+		 */
+		gsl::span< const MeshCluster > m_clusters;
+
+		/**
+		 The OBBs of the model parts to write by this MSH writer.
+		 */
+		gsl::span< const MSH2PartOBB > m_part_obbs;
+
+		/**
+		 The triangle bounding volume hierarchies of the model parts to write
+		 by this MSH writer.
+		 */
+		gsl::span< const SharedPtr< const TriangleBVH > > m_part_bvhs;
+
+		/**
+		 The occluder meshes of the model parts to write by this MSH writer.
+		 */
+		gsl::span< const SharedPtr< const OccluderMesh > > m_part_occluders;
 	};
 }
 
@@ -140,6 +193,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\msh\msh_writer.tpp"
+#include "loaders/msh/msh_writer.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,7 +5,18 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\msh\msh_tokens.hpp"
+#include "loaders/msh/msh_tokens.hpp"
+#include "io/checksum.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+#include <utility>
 
 #pragma endregion
 
@@ -17,10 +28,22 @@ namespace mage::rendering::loader {
 	template< typename VertexT, typename IndexT >
 	MSHWriter< VertexT, IndexT >
 		::MSHWriter(const std::vector< VertexT >& vertices,
-		            const std::vector< IndexT >& indices)
+		            const std::vector< IndexT >& indices,
+		            gsl::span< const MSH2PartBounds > part_bounds,
+		            gsl::span< const PackedModelPart > part_packing,
+		            gsl::span< const MeshCluster > clusters,
+		            gsl::span< const MSH2PartOBB > part_obbs,
+		            gsl::span< const SharedPtr< const TriangleBVH > > part_bvhs,
+		            gsl::span< const SharedPtr< const OccluderMesh > > part_occluders)
 		: BigEndianBinaryWriter(),
 		m_vertices(vertices),
-		m_indices(indices) {}
+		m_indices(indices),
+		m_part_bounds(part_bounds),
+		m_part_packing(part_packing),
+		m_clusters(clusters),
+		m_part_obbs(part_obbs),
+		m_part_bvhs(part_bvhs),
+		m_part_occluders(part_occluders) {}
 
 	template< typename VertexT, typename IndexT >
 	MSHWriter< VertexT, IndexT >
@@ -31,15 +54,102 @@ namespace mage::rendering::loader {
 
 	template< typename VertexT, typename IndexT >
 	void MSHWriter< VertexT, IndexT >::WriteData() {
+		static constexpr auto s_layout = MakeMSH2VertexLayout< VertexT, IndexT >();
+
+		MSH2Header header = {};
+		std::memcpy(header.m_magic, g_msh2_token_magic, sizeof(header.m_magic));
+		header.m_version     = g_msh2_token_version;
+		header.m_header_size = static_cast< U32 >(sizeof(MSH2Header));
+		header.m_nb_vertices = static_cast< U64 >(m_vertices.size());
+		header.m_nb_indices  = static_cast< U64 >(m_indices.size());
+		header.m_nb_parts    = static_cast< U64 >(m_part_bounds.size());
+
+		// Flatten the triangle bounding volume hierarchies and occluder
+		// meshes of the model parts.
+		std::vector< MSH2PartBVH > part_bvhs;
+		AlignedVector< TriangleBVH::Node > bvh_nodes;
+		AlignedVector< TriangleBVH::TrianglePacket > bvh_packets;
+		for (const auto& bvh : m_part_bvhs) {
+			const auto nodes   = bvh->GetNodes();
+			const auto packets = bvh->GetPackets();
+			part_bvhs.push_back({
+				XMStore< F32x3 >(bvh->GetAABB().MinPoint()),
+				static_cast< U32 >(nodes.size()),
+				XMStore< F32x3 >(bvh->GetAABB().MaxPoint()),
+				static_cast< U32 >(packets.size())
+			});
+			bvh_nodes.insert(bvh_nodes.end(), nodes.begin(), nodes.end());
+			bvh_packets.insert(bvh_packets.end(), packets.begin(), packets.end());
+		}
+
+		std::vector< MSH2PartOccluder > part_occluders;
+		std::vector< F32x3 > occluder_positions;
+		std::vector< U32 > occluder_indices;
+		for (const auto& occluder : m_part_occluders) {
+			if (nullptr == occluder) {
+				part_occluders.push_back({ 0u, 0u });
+				continue;
+			}
+
+			const auto positions = occluder->GetPositions();
+			const auto indices   = occluder->GetIndices();
+			part_occluders.push_back({
+				static_cast< U32 >(positions.size()),
+				static_cast< U32 >(indices.size())
+			});
+			occluder_positions.insert(occluder_positions.end(),
+									  positions.begin(), positions.end());
+			occluder_indices.insert(occluder_indices.end(),
+									indices.begin(), indices.end());
+		}
+
+		// Lay out the sections.
+		U64 offset = sizeof(MSH2Header);
+		const auto add_section = [&offset](U64 size) noexcept {
+			const MSH2Section section = { AlignMSH2Offset(offset), size };
+			offset = section.m_offset + section.m_size;
+			return section;
+		};
+		header.m_vertex_layout = add_section(sizeof(MSH2VertexLayout));
+		header.m_vertices      = add_section(header.m_nb_vertices * sizeof(VertexT));
+		header.m_indices       = add_section(header.m_nb_indices  * sizeof(IndexT));
+		header.m_part_bounds   = add_section(header.m_nb_parts    * sizeof(MSH2PartBounds));
+		header.m_part_packing  = add_section(static_cast< U64 >(m_part_packing.size()) * sizeof(PackedModelPart));
+		header.m_clusters      = add_section(static_cast< U64 >(m_clusters.size()) * sizeof(MeshCluster));
+		header.m_part_obbs     = add_section(static_cast< U64 >(m_part_obbs.size()) * sizeof(MSH2PartOBB));
+		header.m_part_bvhs          = add_section(part_bvhs.size()          * sizeof(MSH2PartBVH));
+		header.m_bvh_nodes          = add_section(bvh_nodes.size()          * sizeof(TriangleBVH::Node));
+		header.m_bvh_packets        = add_section(bvh_packets.size()        * sizeof(TriangleBVH::TrianglePacket));
+		header.m_part_occluders     = add_section(part_occluders.size()     * sizeof(MSH2PartOccluder));
+		header.m_occluder_positions = add_section(occluder_positions.size() * sizeof(F32x3));
+		header.m_occluder_indices   = add_section(occluder_indices.size()   * sizeof(U32));
 
-		WriteString(NotNull< const_zstring >(g_msh_token_magic));
+		// Assemble the payload (zero padded).
+		std::vector< U8 > payload(static_cast< std::size_t >(offset - sizeof(MSH2Header)));
+		const auto copy_section = [&payload](const MSH2Section& section,
+											 const void* data) noexcept {
+			if (0u != section.m_size) {
+				std::memcpy(payload.data() + (section.m_offset - sizeof(MSH2Header)),
+							data, static_cast< std::size_t >(section.m_size));
+			}
+		};
+		copy_section(header.m_vertex_layout, &s_layout);
+		copy_section(header.m_vertices,      m_vertices.data());
+		copy_section(header.m_indices,       m_indices.data());
+		copy_section(header.m_part_bounds,   m_part_bounds.data());
+		copy_section(header.m_part_packing,  m_part_packing.data());
+		copy_section(header.m_clusters,      m_clusters.data());
+		copy_section(header.m_part_obbs,     m_part_obbs.data());
+		copy_section(header.m_part_bvhs,          part_bvhs.data());
+		copy_section(header.m_bvh_nodes,          bvh_nodes.data());
+		copy_section(header.m_bvh_packets,        bvh_packets.data());
+		copy_section(header.m_part_occluders,     part_occluders.data());
+		copy_section(header.m_occluder_positions, occluder_positions.data());
+		copy_section(header.m_occluder_indices,   occluder_indices.data());
 
-		const auto nb_vertices = static_cast< U32 >(m_vertices.size());
-		Write< U32 >(nb_vertices);
-		const auto nb_indices  = static_cast< U32 >(m_indices.size());
-		Write< U32 >(nb_indices);
+		header.m_checksum = ComputeChecksum(gsl::make_span(std::as_const(payload)));
 
-		WriteArray(gsl::make_span(m_vertices));
-		WriteArray(gsl::make_span(m_indices));
+		Write< MSH2Header >(header);
+		WriteArray(gsl::make_span(std::as_const(payload)));
 	}
 }
\ No newline at end of file
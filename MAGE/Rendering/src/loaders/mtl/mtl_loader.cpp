@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\mtl\mtl_loader.hpp"
-#include "loaders\mtl\mtl_reader.hpp"
+#include "loaders/mtl/mtl_loader.hpp"
+#include "loaders/mtl/mtl_reader.hpp"
 
 #pragma endregion
 
@@ -3,9 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\mtl\mtl_reader.hpp"
-#include "loaders\mtl\mtl_tokens.hpp"
-#include "resource\model\material_factory.hpp"
+#include "loaders/mtl/mtl_reader.hpp"
+#include "loaders/mtl/mtl_tokens.hpp"
+#include "resource/model/material_factory.hpp"
 
 #pragma endregion
 
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\line_reader.hpp"
-#include "resource\rendering_resource_manager.hpp"
+#include "io/line_reader.hpp"
+#include "resource/rendering_resource_manager.hpp"
 
 #pragma endregion
 
@@ -0,0 +1,194 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/obj/obj_chunk_reader.hpp"
+#include "loaders/obj/obj_tokens.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	OBJChunkReader::OBJChunkReader(OBJChunk& chunk, bool invert_handedness)
+		: LineReader(),
+		m_chunk(chunk),
+		m_invert_handedness(invert_handedness) {}
+
+	OBJChunkReader::OBJChunkReader(OBJChunkReader&& reader) noexcept = default;
+
+	OBJChunkReader::~OBJChunkReader() = default;
+
+	void OBJChunkReader::ReadLine() {
+		const auto token = Read< std::string_view >();
+
+		if (g_obj_token_comment == token[0]) {
+			return;
+		}
+		else if (g_obj_token_vertex           == token) {
+			ReadOBJVertex();
+		}
+		else if (g_obj_token_texture          == token) {
+			ReadOBJVertexTexture();
+		}
+		else if (g_obj_token_normal           == token) {
+			ReadOBJVertexNormal();
+		}
+		else if (g_obj_token_face             == token) {
+			ReadOBJFace();
+		}
+		else if (g_obj_token_material_library == token) {
+			ReadOBJNamedCommand(OBJCommand::Type::MaterialLibrary);
+		}
+		else if (g_obj_token_material_use     == token) {
+			ReadOBJNamedCommand(OBJCommand::Type::MaterialUse);
+		}
+		else if (g_obj_token_group            == token) {
+			ReadOBJNamedCommand(OBJCommand::Type::Group);
+		}
+		else if (g_obj_token_object           == token) {
+			ReadOBJNamedCommand(OBJCommand::Type::Group);
+		}
+		else if (g_obj_token_smoothing_group  == token) {
+			ReadOBJSmoothingGroup();
+		}
+		else {
+			Warning("{}: line {}: unsupported keyword token: {}.",
+					GetPath(), GetCurrentLineNumber(), token);
+			return;
+		}
+
+		ReadRemainingTokens();
+	}
+
+	void OBJChunkReader::ReadOBJNamedCommand(OBJCommand::Type type) {
+		OBJCommand command;
+		command.m_type     = type;
+		command.m_nb_faces = 0u;
+		command.m_name     = Read< std::string >();
+
+		m_chunk.m_commands.push_back(std::move(command));
+	}
+
+	void OBJChunkReader::ReadOBJSmoothingGroup() {
+		// Silently ignore smoothing group declarations.
+		Read< std::string_view >();
+	}
+
+	void OBJChunkReader::ReadOBJVertex() {
+		const Point3 read_vertex(Read< F32, 3u >());
+		auto vertex = m_invert_handedness ?
+			InvertHandness(read_vertex) : read_vertex;
+
+		m_chunk.m_vertex_coordinates.push_back(std::move(vertex));
+	}
+
+	void OBJChunkReader::ReadOBJVertexTexture() {
+		const UV read_texture(Read< F32, 2u >());
+
+		if (Contains< F32 >()) {
+			// Silently ignore 3D vertex texture coordinates.
+			Read< F32 >();
+		}
+
+		auto texture = m_invert_handedness ?
+			InvertHandness(read_texture) : read_texture;
+
+		m_chunk.m_vertex_texture_coordinates.push_back(std::move(texture));
+	}
+
+	void OBJChunkReader::ReadOBJVertexNormal() {
+		const Normal3 read_normal(Read< F32, 3u >());
+		auto normal = m_invert_handedness ?
+			InvertHandness(read_normal) : read_normal;
+
+		m_chunk.m_vertex_normal_coordinates.push_back(std::move(normal));
+	}
+
+	void OBJChunkReader::ReadOBJFace() {
+		U32 nb_vertices = 0u;
+		while (nb_vertices < 3u || ContainsTokens()) {
+			m_chunk.m_vertex_indices.push_back(ReadOBJVertexIndices());
+			++nb_vertices;
+		}
+
+		m_chunk.m_face_sizes.push_back(nb_vertices);
+
+		// Consecutive faces share a single command.
+		auto& commands = m_chunk.m_commands;
+		if (commands.empty()
+			|| OBJCommand::Type::Faces != commands.back().m_type) {
+
+			OBJCommand command;
+			command.m_type     = OBJCommand::Type::Faces;
+			command.m_nb_faces = 0u;
+			commands.push_back(std::move(command));
+		}
+
+		++commands.back().m_nb_faces;
+	}
+
+	[[nodiscard]]
+	const OBJVertexIndices OBJChunkReader::ReadOBJVertexIndices() {
+		const auto token  = Read< std::string_view >();
+
+		const auto slash1 = token.find_first_of('/');
+		const bool flag1  = (std::string::npos != slash1);
+		const auto slash2 = token.find_first_of('/', slash1 + 1u);
+		const bool flag2  = (std::string::npos != slash2);
+		const bool flagd  = (slash1 + 1u == slash2);
+
+		static constexpr const_zstring s_token_names[] = {
+			"v",
+			"vt",
+			"vn"
+		};
+		const bool contains_token[] = {
+			true,
+			flag1 && !flagd,
+			flag2
+		};
+		const std::string_view tokens[] = {
+			// If offset std::string::npos + 1u == 0u then count is don't-care;
+			// all unsigned values avoid exception.
+			token.substr(0u,          slash1),
+			token.substr(slash1 + 1u, slash2       - slash1 - 1u),
+			token.substr(slash2 + 1u, token.size() - slash2 - 1u)
+		};
+
+		OBJVertexIndices indices = {};
+		// Relative indices are resolved against the sizes of this chunk and
+		// offset by the sizes of the preceding chunks while merging.
+		const S32x3 sizes = {
+			static_cast< S32 >(m_chunk.m_vertex_coordinates.size()),
+			static_cast< S32 >(m_chunk.m_vertex_texture_coordinates.size()),
+			static_cast< S32 >(m_chunk.m_vertex_normal_coordinates.size())
+		};
+
+		for (std::size_t i = 0u; i < std::size(s_token_names); ++i) {
+			if (!contains_token[i]) {
+				continue;
+			}
+
+			if (const auto result = StringTo< S32 >(tokens[i]); bool(result)) {
+				const auto index = *result;
+				if (0 <= index) {
+					indices.m_indices[i] = static_cast< U32 >(index);
+				}
+				else {
+					indices.m_indices[i] = static_cast< U32 >(sizes[i] + index);
+					indices.m_relative_mask |= 1u << i;
+				}
+			}
+			else {
+				throw Exception("{}: line {}: invalid {} index value found in {}.",
+								GetPath(), GetCurrentLineNumber(), s_token_names[i], token);
+			}
+		}
+
+		return indices;
+	}
+}
@@ -0,0 +1,375 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io/line_reader.hpp"
+#include "geometry/geometry.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <string>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	//-------------------------------------------------------------------------
+	// OBJVertexIndices
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of OBJ vertex indices of a face vertex read from an OBJ chunk.
+	 */
+	struct OBJVertexIndices {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Resolves these OBJ vertex indices.
+
+		 @param[in]		offsets
+						A reference to the number of vertex position, texture
+						and normal coordinates read before the OBJ chunk
+						containing these OBJ vertex indices.
+		 @return		The resolved vertex indices. A zero indicates the
+						absence of a component.
+		 */
+		[[nodiscard]]
+		const U32x3 Resolve(const U32x3& offsets) const noexcept {
+			U32x3 indices;
+			for (std::size_t i = 0u; i < 3u; ++i) {
+				indices[i] = m_indices[i];
+				if (m_relative_mask & (1u << i)) {
+					indices[i] += offsets[i];
+				}
+			}
+			return indices;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The vertex indices of this OBJ vertex indices. Relative indices are
+		 stored relative to the beginning of their OBJ chunk.
+		 */
+		U32x3 m_indices;
+
+		/**
+		 A bit mask indicating which of the indices of this OBJ vertex
+		 indices are relative to the beginning of their OBJ chunk.
+		 */
+		U32 m_relative_mask;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// OBJCommand
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of OBJ commands read from an OBJ chunk which need to be
+	 processed in file order.
+	 */
+	struct OBJCommand {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 An enumeration of the different OBJ command types.
+
+		 This contains:
+		 @c Faces,
+		 @c MaterialLibrary,
+		 @c MaterialUse and
+		 @c Group.
+		 */
+		enum class Type : U8 {
+			Faces = 0,
+			MaterialLibrary,
+			MaterialUse,
+			Group
+		};
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The type of this OBJ command.
+		 */
+		Type m_type;
+
+		/**
+		 The number of consecutive faces of this OBJ command (faces only).
+		 */
+		std::size_t m_nb_faces;
+
+		/**
+		 The name of this OBJ command (material libraries, material usages and
+		 groups only).
+		 */
+		std::string m_name;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// OBJChunk
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of OBJ chunks containing the data read from a range of
+	 consecutive lines of an OBJ file.
+	 */
+	struct OBJChunk {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the read vertex position coordinates of this OBJ
+		 chunk.
+		 */
+		std::vector< Point3 > m_vertex_coordinates;
+
+		/**
+		 A vector containing the read vertex texture coordinates of this OBJ
+		 chunk.
+		 */
+		std::vector< UV > m_vertex_texture_coordinates;
+
+		/**
+		 A vector containing the read vertex normal coordinates of this OBJ
+		 chunk.
+		 */
+		std::vector< Normal3 > m_vertex_normal_coordinates;
+
+		/**
+		 A vector containing the vertex indices of all face vertices of this
+		 OBJ chunk.
+		 */
+		std::vector< OBJVertexIndices > m_vertex_indices;
+
+		/**
+		 A vector containing the number of vertices of all faces of this OBJ
+		 chunk.
+		 */
+		std::vector< U32 > m_face_sizes;
+
+		/**
+		 A vector containing the commands of this OBJ chunk (in file order).
+		 */
+		std::vector< OBJCommand > m_commands;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// OBJChunkReader
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of OBJ chunk readers for reading a range of consecutive lines of
+	 an OBJ file. OBJ chunk readers are independent of each other and can
+	 read the chunks of the same OBJ file concurrently.
+	 */
+	class OBJChunkReader : private LineReader {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an OBJ chunk reader.
+
+		 @param[in]		chunk
+						A reference to an OBJ chunk for storing the read data.
+		 @param[in]		invert_handedness
+						Flag indicating whether the mesh coordinate system
+						handness should be inverted.
+		 */
+		explicit OBJChunkReader(OBJChunk& chunk, bool invert_handedness);
+
+		/**
+		 Constructs an OBJ chunk reader from the given OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to the OBJ chunk reader to copy.
+		 */
+		OBJChunkReader(const OBJChunkReader& reader) = delete;
+
+		/**
+		 Constructs an OBJ chunk reader by moving the given OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to the OBJ chunk reader to move.
+		 */
+		OBJChunkReader(OBJChunkReader&& reader) noexcept;
+
+		/**
+		 Destructs this OBJ chunk reader.
+		 */
+		~OBJChunkReader();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given OBJ chunk reader to this OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to a OBJ chunk reader to copy.
+		 @return		A reference to the copy of the given OBJ chunk reader
+						(i.e. this OBJ chunk reader).
+		 */
+		OBJChunkReader& operator=(const OBJChunkReader& reader) = delete;
+
+		/**
+		 Moves the given OBJ chunk reader to this OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to a OBJ chunk reader to move.
+		 @return		A reference to the moved OBJ chunk reader (i.e. this
+						OBJ chunk reader).
+		 */
+		OBJChunkReader& operator=(OBJChunkReader&& reader) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using LineReader::ReadChunkFromMemory;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Reads the current line of this OBJ chunk reader.
+
+		 @throws		Exception
+						Failed to the current line of this OBJ chunk reader.
+		 */
+		virtual void ReadLine() override;
+
+		/**
+		 Reads a command with a name.
+
+		 @param[in]		type
+						The type of the command.
+		 @throws		Exception
+						Failed to read a command.
+		 */
+		void ReadOBJNamedCommand(OBJCommand::Type type);
+
+		/**
+		 Reads a Smoothing Group definition.
+
+		 @note			A smoothing group is, if present,
+						silently ignored.
+		 @throws		Exception
+						Failed to read a Smoothing Group definition.
+		 */
+		void ReadOBJSmoothingGroup();
+
+		/**
+		 Reads a Vertex Position Coordinates definition.
+
+		 @throws		Exception
+						Failed to read a Vertex Position Coordinates
+						definition.
+		 */
+		void ReadOBJVertex();
+
+		/**
+		 Reads a Vertex Texture Coordinates definition.
+
+		 @note			Only UV texture coordinates are supported,
+						The W component of UVW texture coordinates
+						is, if present, silently ignored.
+		 @throws		Exception
+						Failed to read a Vertex Texture Coordinates definition.
+		 */
+		void ReadOBJVertexTexture();
+
+		/**
+		 Reads a Vertex Normal Coordinates definition.
+
+		 @pre			All the vertex normals in the OBJ file are normalized.
+		 @throws		Exception
+						Failed to read a Vertex Normal Coordinates definition.
+		 */
+		void ReadOBJVertexNormal();
+
+		/**
+		 Reads a Face definition.
+
+		 @throws		Exception
+						Failed to read a Face definition.
+		 */
+		void ReadOBJFace();
+
+		/**
+		 Reads a set of vertex indices.
+
+		 @return		The vertex indices represented by the next token of
+						this OBJ chunk reader.
+		 @throws		Exception
+						Failed to read the vertex indices.
+		 */
+		[[nodiscard]]
+		const OBJVertexIndices ReadOBJVertexIndices();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the OBJ chunk of this OBJ chunk reader.
+		 */
+		OBJChunk& m_chunk;
+
+		/**
+		 A flag indicating whether the mesh coordinate system handness should
+		 be inverted.
+		 */
+		bool m_invert_handedness;
+	};
+
+	#pragma endregion
+}
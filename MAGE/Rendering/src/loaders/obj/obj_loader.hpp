@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\model\model_output.hpp"
-#include "resource\mesh\mesh_descriptor.hpp"
+#include "resource/model/model_output.hpp"
+#include "resource/mesh/mesh_descriptor.hpp"
 
 #pragma endregion
 
@@ -51,6 +51,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\obj\obj_loader.tpp"
+#include "loaders/obj/obj_loader.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,9 +5,10 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\line_reader.hpp"
-#include "resource\model\model_output.hpp"
-#include "resource\mesh\mesh_descriptor.hpp"
+#include "loaders/obj/obj_chunk_reader.hpp"
+#include "loaders/obj/obj_vertex_map.hpp"
+#include "resource/model/model_output.hpp"
+#include "resource/mesh/mesh_descriptor.hpp"
 
 #pragma endregion
 
@@ -16,7 +17,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include <map>
+#include <string_view>
 
 #pragma endregion
 
@@ -39,7 +40,7 @@ namespace mage::rendering::loader {
 					The index type.
 	 */
 	template< typename VertexT, typename IndexT >
-	class OBJReader : private LineReader {
+	class OBJReader {
 
 	public:
 
@@ -111,170 +112,138 @@ namespace mage::rendering::loader {
 		// Member Methods
 		//---------------------------------------------------------------------
 
-		using LineReader::ReadFromFile;
-
-		using LineReader::ReadFromMemory;
-
-	private:
-
-		//---------------------------------------------------------------------
-		// Member Methods
-		//---------------------------------------------------------------------
-
-		/**
-		 Pre-process before reading the current file of this OBJ reader.
-
-		 @throws		Exception
-						Failed to finish the pre-processing successfully.
-		 */
-		virtual void Preprocess() override;
-
 		/**
-		 Reads the current line of this OBJ reader.
+		 Reads from the file associated with the given path.
 
+		 @param[in]		path
+						The path.
 		 @throws		Exception
-						Failed to the current line of this OBJ reader.
+						Failed to read from the file.
 		 */
-		virtual void ReadLine() override;
+		void ReadFromFile(std::filesystem::path path);
 
 		/**
-		 Post-processes after reading the current file of this OBJ reader.
-
-		 @throws		Exception
-						Failed to finish post-processing successfully.
-		 */
-		virtual void Postprocess() override;
-
-		/**
-		 Reads a Material Library Include definition.
+		 Reads from the given input string.
 
+		 @param[in]		input
+						The input string.
 		 @throws		Exception
-						Failed to read a Material Library Include definition.
+						Failed to read from the given input string.
 		 */
-		void ReadOBJMaterialLibrary();
+		void ReadFromMemory(std::string_view input);
 
-		/**
-		 Reads a Material Usage definition and imports the materials
-		 corresponding to the mesh.
+	private:
 
-		 @throws		Exception
-						Failed to read a Material Usage definition.
-		 @throws		Exception
-						Failed to import the materials.
-		 */
-		void ReadOBJMaterialUse();
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
 
 		/**
-		 Reads a Group definition.
-
-		 @throws		Exception
-						Failed to read a Group definition.
+		 The minimum size (in bytes) of the chunks of OBJ readers.
 		 */
-		void ReadOBJGroup();
-
-		/**
-		 Reads an Object definition.
+		static constexpr std::size_t s_min_chunk_size = std::size_t(1u) << 20u;
 
-		 @throws		Exception
-						Failed to read a Object definition.
-		 */
-		void ReadOBJObject();
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
 
 		/**
-		 Reads a Smoothing Group definition.
+		 Pre-process before reading the current file of this OBJ reader.
 
-		 @note			A smoothing group is, if present,
-						silently ignored.
 		 @throws		Exception
-						Failed to read a Smoothing Group definition.
+						Failed to finish the pre-processing successfully.
 		 */
-		void ReadOBJSmoothingGroup();
+		void Preprocess();
 
 		/**
-		 Reads a Vertex Position Coordinates definition.
+		 Processes the given input buffer. The input buffer is split at line
+		 boundaries into chunks which are read concurrently and merged
+		 afterwards in file order.
 
+		 @param[in]		input
+						The input buffer.
 		 @throws		Exception
-						Failed to read a Vertex Position Coordinates
-						definition.
+						Failed to process the given input buffer.
 		 */
-		void ReadOBJVertex();
+		void Process(std::string_view input);
 
 		/**
-		 Reads a Vertex Texture Coordinates definition.
+		 Post-processes after reading the current file of this OBJ reader.
 
-		 @note			Only UV texture coordinates are supported,
-						The W component of UVW texture coordinates
-						is, if present, silently ignored.
 		 @throws		Exception
-						Failed to read a Vertex Texture Coordinates definition.
+						Failed to finish post-processing successfully.
 		 */
-		void ReadOBJVertexTexture();
+		void Postprocess();
 
 		/**
-		 Reads a Vertex Normal Coordinates definition.
+		 Splits the given input buffer at line boundaries into chunks.
 
-		 @pre			All the vertex normals in the OBJ file are normalized.
-		 @throws		Exception
-						Failed to read a Vertex Normal Coordinates definition.
+		 @param[in]		input
+						The input buffer.
+		 @return		A vector containing the chunks of the given input
+						buffer.
 		 */
-		void ReadOBJVertexNormal();
+		[[nodiscard]]
+		static std::vector< std::string_view >
+			SplitIntoChunks(std::string_view input);
 
 		/**
-		 Reads a Face definition.
+		 Merges the given OBJ chunk.
 
+		 @param[in]		chunk
+						A reference to the OBJ chunk.
+		 @param[in]		offsets
+						A reference to the number of vertex position, texture
+						and normal coordinates read before the given OBJ
+						chunk.
 		 @throws		Exception
-						Failed to read a Face definition.
+						Failed to merge the given OBJ chunk.
 		 */
-		void ReadOBJFace();
+		void MergeChunk(const OBJChunk& chunk, const U32x3& offsets);
 
 		/**
-		 Reads a set of vertex position coordinates.
+		 Imports the materials of the given Material Library Include
+		 definition.
 
-		 @return		The @c Point3 represented by the next token of this OBJ
-						reader (modified according to the mesh descriptor of
-						this OBj reader).
+		 @param[in]		mtl_name
+						The name of the material library.
 		 @throws		Exception
-						Failed to read a @c Point3.
+						Failed to import the materials.
 		 */
-		[[nodiscard]]
-		const Point3 ReadOBJVertexCoordinates();
+		void ReadOBJMaterialLibrary(std::string_view mtl_name);
 
 		/**
-		 Reads a set of vertex normal coordinates.
+		 Processes the given Material Usage definition.
 
-		 @pre			All the vertex normals in the OBJ file are normalized.
-		 @return		The @c Normal3 represented by the next token of this
-						OBJ reader (modified according to the mesh descriptor
-						of this OBj reader).
-		 @throws		Exception
-						Failed to read a @c Normal3.
+		 @param[in]		material
+						The name of the material.
 		 */
-		[[nodiscard]]
-		const Normal3 ReadOBJVertexNormalCoordinates();
+		void ReadOBJMaterialUse(std::string material);
 
 		/**
-		 Reads a set of vertex texture coordinates.
+		 Processes the given Group or Object definition.
 
-		 @return		The @c UV represented by the next token of this OBJ
-						reader (modified according to the mesh descriptor of
-						this OBj reader).
-		 @throws		Exception
-						Failed to read a @c UV.
+		 @param[in]		child
+						The name of the group or object.
 		 */
-		[[nodiscard]]
-		const UV ReadOBJVertexTextureCoordinates();
+		void ReadOBJGroup(std::string child);
 
 		/**
-		 Reads a set of vertex indices.
+		 Processes the given Face definition.
 
-		 @return		The vertex indices represented by the next token of
-						this OBJ reader. A zero indicates the absence of a
-						component.
-		 @throws		Exception
-						Failed to read the vertex indices.
+		 @param[in]		vertex_indices
+						A pointer to the vertex indices of the vertices of the
+						face.
+		 @param[in]		nb_vertices
+						The number of vertices of the face.
+		 @param[in]		offsets
+						A reference to the number of vertex position, texture
+						and normal coordinates read before the OBJ chunk
+						containing the face.
 		 */
-		[[nodiscard]]
-		const U32x3 ReadOBJVertexIndices();
+		void ReadOBJFace(const OBJVertexIndices* vertex_indices,
+						 std::size_t nb_vertices,
+						 const U32x3& offsets);
 
 		/**
 		 Constructs or retrieves (if already existing) the vertex matching the
@@ -288,30 +257,6 @@ namespace mage::rendering::loader {
 		[[nodiscard]]
 		const VertexT ConstructVertex(const U32x3& vertex_indices);
 
-		/**
-		 A struct of @c U32x3 comparators for OBJ vertex indices.
-		 */
-		struct OBJComparator {
-
-		public:
-
-			/**
-			 Compares the two given @c U32x3 vectors against each other.
-
-			 @param[in]		lhs
-							A reference to the first vector.
-			 @param[in]		rhs
-							A reference to the second vector.
-			 @return		@c true if the @a lhs is smaller than @a rhs.
-							@c false otherwise.
-			 */
-			[[nodiscard]]
-			bool operator()(const U32x3& lhs, const U32x3& rhs) const noexcept {
-				return std::tie(lhs[0], lhs[1], lhs[2])
-					 < std::tie(rhs[0], rhs[1], rhs[2]);
-			}
-		};
-
 		/**
 		 Finalizes the current model part of this OBJ reader and prepare a new
 		 current model part.
@@ -322,6 +267,11 @@ namespace mage::rendering::loader {
 		// Member Variables
 		//---------------------------------------------------------------------
 
+		/**
+		 The current path of this OBJ reader.
+		 */
+		std::filesystem::path m_path;
+
 		/**
 		 The current model part of this OBJ reader.
 		 */
@@ -350,7 +300,7 @@ namespace mage::rendering::loader {
 		 and the index of a vertex in the vertex buffer (@c m_model_output) of
 		 this OBJ reader.
 		 */
-		std::map< U32x3, IndexT, OBJComparator > m_mapping;
+		OBJVertexMap< IndexT > m_mapping;
 
 		/**
 		 A reference to the resource manager of this OBJ reader.
@@ -375,6 +325,6 @@ namespace mage::rendering::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\obj\obj_reader.tpp"
+#include "loaders/obj/obj_reader.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -5,9 +5,20 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\obj\obj_tokens.hpp"
-#include "loaders\material_loader.hpp"
-#include "resource\mesh\vertex.hpp"
+#include "loaders/material_loader.hpp"
+#include "io/mapped_file.hpp"
+#include "logging/logging.hpp"
+#include "parallel/parallel.hpp"
+#include "resource/mesh/vertex.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
 
 #pragma endregion
 
@@ -21,7 +32,7 @@ namespace mage::rendering::loader {
 		::OBJReader(ResourceManager& resource_manager,
 					ModelOutput< VertexT, IndexT >& model_output,
 			        const MeshDescriptor< VertexT, IndexT >& mesh_desc)
-		: LineReader(),
+		: m_path(),
 		m_model_part(),
 		m_vertex_coordinates(),
 		m_vertex_texture_coordinates(),
@@ -48,13 +59,117 @@ namespace mage::rendering::loader {
 		m_model_part.m_start_index = size;
 	}
 
+	template< typename VertexT, typename IndexT >
+	void OBJReader< VertexT, IndexT >::ReadFromFile(std::filesystem::path path) {
+		m_path = std::move(path);
+
+		// Preprocessing
+		Preprocess();
+
+		// Processing
+		{
+			// The file is mapped instead of copied.
+			const MappedFile file(m_path);
+			Process({ reinterpret_cast< const char* >(file.GetData().data()),
+					  file.size() });
+		}
+
+		// Postprocessing
+		Postprocess();
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJReader< VertexT, IndexT >::ReadFromMemory(std::string_view input) {
+		m_path = L"input string";
+
+		// Preprocessing
+		Preprocess();
+
+		// Processing
+		Process(input);
+
+		// Postprocessing
+		Postprocess();
+	}
+
 	template< typename VertexT, typename IndexT >
 	void OBJReader< VertexT, IndexT >::Preprocess() {
 		using std::empty;
 		ThrowIfFailed(empty(m_model_output.m_vertex_buffer),
-					  "{}: vertex buffer must be empty.", GetPath());
+					  "{}: vertex buffer must be empty.", m_path);
 		ThrowIfFailed(empty(m_model_output.m_index_buffer),
-					  "{}: index buffer must be empty.", GetPath());
+					  "{}: index buffer must be empty.", m_path);
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJReader< VertexT, IndexT >::Process(std::string_view input) {
+		const auto chunk_inputs = SplitIntoChunks(input);
+		const auto nb_chunks    = chunk_inputs.size();
+
+		// Read the chunks concurrently (sequentially if this reader already
+		// runs on a worker thread).
+		std::vector< OBJChunk > chunks(nb_chunks);
+		ForEachParallel(nb_chunks, [this, input, &chunk_inputs, &chunks](
+			std::size_t index) {
+
+			OBJChunkReader reader(chunks[index], m_mesh_desc.InvertHandness());
+			reader.ReadChunkFromMemory(input, chunk_inputs[index], m_path);
+		});
+
+		// Concatenate the vertex coordinates of all chunks.
+		std::size_t nb_vertex_coordinates         = 0u;
+		std::size_t nb_vertex_texture_coordinates = 0u;
+		std::size_t nb_vertex_normal_coordinates  = 0u;
+		for (const auto& chunk : chunks) {
+			nb_vertex_coordinates         += chunk.m_vertex_coordinates.size();
+			nb_vertex_texture_coordinates += chunk.m_vertex_texture_coordinates.size();
+			nb_vertex_normal_coordinates  += chunk.m_vertex_normal_coordinates.size();
+		}
+
+		m_vertex_coordinates.reserve(nb_vertex_coordinates);
+		m_vertex_texture_coordinates.reserve(nb_vertex_texture_coordinates);
+		m_vertex_normal_coordinates.reserve(nb_vertex_normal_coordinates);
+
+		std::vector< U32x3 > offsets(nb_chunks);
+		for (std::size_t i = 0u; i < nb_chunks; ++i) {
+			auto& chunk = chunks[i];
+			offsets[i] = {
+				static_cast< U32 >(m_vertex_coordinates.size()),
+				static_cast< U32 >(m_vertex_texture_coordinates.size()),
+				static_cast< U32 >(m_vertex_normal_coordinates.size())
+			};
+
+			m_vertex_coordinates.insert(m_vertex_coordinates.cend(),
+				chunk.m_vertex_coordinates.cbegin(),
+				chunk.m_vertex_coordinates.cend());
+			m_vertex_texture_coordinates.insert(m_vertex_texture_coordinates.cend(),
+				chunk.m_vertex_texture_coordinates.cbegin(),
+				chunk.m_vertex_texture_coordinates.cend());
+			m_vertex_normal_coordinates.insert(m_vertex_normal_coordinates.cend(),
+				chunk.m_vertex_normal_coordinates.cbegin(),
+				chunk.m_vertex_normal_coordinates.cend());
+		}
+
+		// Reserve the output buffers based on the number of face corners and
+		// the number of vertex coordinates.
+		std::size_t nb_indices = 0u;
+		for (const auto& chunk : chunks) {
+			for (const auto face_size : chunk.m_face_sizes) {
+				nb_indices += 3u * (face_size - 2u);
+			}
+		}
+
+		const auto nb_vertices = std::max({ nb_vertex_coordinates,
+											nb_vertex_texture_coordinates,
+											nb_vertex_normal_coordinates });
+		m_mapping.reserve(nb_vertices);
+		m_model_output.m_vertex_buffer.reserve(nb_vertices);
+		m_model_output.m_index_buffer.reserve(nb_indices);
+
+		// Merge the faces and model parts of all chunks in file order.
+		for (std::size_t i = 0u; i < nb_chunks; ++i) {
+			MergeChunk(chunks[i], offsets[i]);
+		}
 	}
 
 	template< typename VertexT, typename IndexT >
@@ -62,56 +177,96 @@ namespace mage::rendering::loader {
 		FinalizeModelPart();
 
 		m_model_output.NormalizeModelParts();
+
+		#ifdef _DEBUG
+		const auto indices = gsl::make_span(std::as_const(m_model_output.m_index_buffer));
+		const auto before  = AnalyzeVertexCache(indices);
+		#endif // _DEBUG
+
+		m_model_output.OptimizeModelParts();
+
+		#ifdef _DEBUG
+		const auto after = AnalyzeVertexCache(indices);
+		Debug("{}: ACMR: {:.3f} -> {:.3f}, ATVR: {:.3f} -> {:.3f}",
+			  m_path, before.GetACMR(), after.GetACMR(),
+			  before.GetATVR(), after.GetATVR());
+		#endif // _DEBUG
 	}
 
 	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadLine() {
-		const auto token = Read< std::string_view >();
+	[[nodiscard]]
+	std::vector< std::string_view > OBJReader< VertexT, IndexT >
+		::SplitIntoChunks(std::string_view input) {
 
-		if (g_obj_token_comment == token[0]) {
-			return;
-		}
-		else if (g_obj_token_vertex           == token) {
-			ReadOBJVertex();
-		}
-		else if (g_obj_token_texture          == token) {
-			ReadOBJVertexTexture();
-		}
-		else if (g_obj_token_normal           == token) {
-			ReadOBJVertexNormal();
-		}
-		else if (g_obj_token_face             == token) {
-			ReadOBJFace();
-		}
-		else if (g_obj_token_material_library == token) {
-			ReadOBJMaterialLibrary();
-		}
-		else if (g_obj_token_material_use     == token) {
-			ReadOBJMaterialUse();
-		}
-		else if (g_obj_token_group            == token) {
-			ReadOBJGroup();
-		}
-		else if (g_obj_token_object           == token) {
-			ReadOBJObject();
-		}
-		else if (g_obj_token_smoothing_group  == token) {
-			ReadOBJSmoothingGroup();
+		const auto nb_chunks = std::clamp< std::size_t >(
+			input.size() / s_min_chunk_size, 1u, NumberOfSystemCores());
+
+		std::vector< std::string_view > chunks;
+		chunks.reserve(nb_chunks);
+
+		std::size_t first = 0u;
+		for (std::size_t i = 1u; i < nb_chunks; ++i) {
+			const auto target = std::max(first, i * (input.size() / nb_chunks));
+			const auto eol    = input.find('\n', target);
+			if (std::string_view::npos == eol) {
+				break;
+			}
+
+			chunks.push_back(input.substr(first, eol + 1u - first));
+			first = eol + 1u;
 		}
-		else {
-			Warning("{}: line {}: unsupported keyword token: {}.",
-					GetPath(), GetCurrentLineNumber(), token);
-			return;
+
+		if (first < input.size()) {
+			chunks.push_back(input.substr(first));
 		}
 
-		ReadRemainingTokens();
+		return chunks;
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJReader< VertexT, IndexT >
+		::MergeChunk(const OBJChunk& chunk, const U32x3& offsets) {
+
+		auto vertex_indices = chunk.m_vertex_indices.data();
+		auto face_sizes     = chunk.m_face_sizes.data();
+
+		for (const auto& command : chunk.m_commands) {
+			switch (command.m_type) {
+
+			case OBJCommand::Type::Faces: {
+				for (std::size_t i = 0u; i < command.m_nb_faces; ++i) {
+					const auto nb_vertices = *face_sizes++;
+					ReadOBJFace(vertex_indices, nb_vertices, offsets);
+					vertex_indices += nb_vertices;
+				}
+				break;
+			}
+
+			case OBJCommand::Type::MaterialLibrary: {
+				ReadOBJMaterialLibrary(command.m_name);
+				break;
+			}
+
+			case OBJCommand::Type::MaterialUse: {
+				ReadOBJMaterialUse(command.m_name);
+				break;
+			}
+
+			case OBJCommand::Type::Group: {
+				ReadOBJGroup(command.m_name);
+				break;
+			}
+			}
+		}
 	}
 
 	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJMaterialLibrary() {
-		const UTF8toUTF16 mtl_name(Read< std::string_view >());
-		auto mtl_path = GetPath();
-		mtl_path.replace_filename(std::wstring_view(mtl_name));
+	void OBJReader< VertexT, IndexT >
+		::ReadOBJMaterialLibrary(std::string_view mtl_name) {
+
+		const UTF8toUTF16 mtl_wname(mtl_name);
+		auto mtl_path = m_path;
+		mtl_path.replace_filename(std::wstring_view(mtl_wname));
 
 		ImportMaterialFromFile(mtl_path,
 							   m_resource_manager,
@@ -119,87 +274,46 @@ namespace mage::rendering::loader {
 	}
 
 	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJMaterialUse() {
+	void OBJReader< VertexT, IndexT >::ReadOBJMaterialUse(std::string material) {
 		if (!m_model_part.HasDefaultMaterial()) {
 			FinalizeModelPart();
 		}
 
-		m_model_part.m_material = Read< std::string_view >();
+		m_model_part.m_material = std::move(material);
 	}
 
 	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJGroup() {
+	void OBJReader< VertexT, IndexT >::ReadOBJGroup(std::string child) {
 		if (!m_model_part.HasDefaultChild()) {
 			FinalizeModelPart();
 		}
 
-		m_model_part.m_child = Read< std::string_view >();
-	}
-
-	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJObject() {
-		ReadOBJGroup();
-	}
-
-	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJSmoothingGroup() {
-		// Silently ignore smoothing group declarations.
-		Read< std::string_view >();
-	}
-
-	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJVertex() {
-		const auto read_vertex = ReadOBJVertexCoordinates();
-		auto vertex = m_mesh_desc.InvertHandness() ?
-			InvertHandness(read_vertex) : read_vertex;
-
-		m_vertex_coordinates.push_back(std::move(vertex));
+		m_model_part.m_child = std::move(child);
 	}
 
 	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJVertexTexture() {
-		const auto read_texture = ReadOBJVertexTextureCoordinates();
-		auto texture = m_mesh_desc.InvertHandness() ?
-			InvertHandness(read_texture) : read_texture;
-
-		m_vertex_texture_coordinates.push_back(std::move(texture));
-	}
-
-	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJVertexNormal() {
-		const auto read_normal = ReadOBJVertexNormalCoordinates();
-		auto normal = m_mesh_desc.InvertHandness() ?
-			InvertHandness(read_normal) : read_normal;
-
-		m_vertex_normal_coordinates.push_back(std::move(normal));
-	}
+	void OBJReader< VertexT, IndexT >
+		::ReadOBJFace(const OBJVertexIndices* vertex_indices,
+					  std::size_t nb_vertices,
+					  const U32x3& offsets) {
 
-	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJFace() {
 		MemoryBuffer< IndexT, 6u > indices;
-		while (indices.size() < 3u || ContainsTokens()) {
-			const auto indices3 = ReadOBJVertexIndices();
-
-			if (const auto it = m_mapping.find(indices3);
-				it != m_mapping.cend()) {
-
-				// Add the index to the already existing vertex.
-				indices.push_back(it->second);
-			}
-			else {
-				// Create an index to a new vertex.
-				const auto index
-					= static_cast< IndexT >(m_model_output.m_vertex_buffer.size());
-				// Add the index to the new vertex.
-				indices.push_back(index);
-
+		for (std::size_t i = 0u; i < nb_vertices; ++i) {
+			const auto indices3 = vertex_indices[i].Resolve(offsets);
+
+			// Create an index to a new vertex (if not existing).
+			const auto new_index
+				= static_cast< IndexT >(m_model_output.m_vertex_buffer.size());
+			const auto [index, inserted]
+				= m_mapping.try_emplace(indices3, new_index);
+			// Add the index to the (new) vertex.
+			indices.push_back(index);
+
+			if (inserted) {
 				// Create a new vertex.
 				auto vertex = ConstructVertex(indices3);
 				// Add the new vertex.
 				m_model_output.m_vertex_buffer.push_back(std::move(vertex));
-
-				// Add the new mapping.
-				m_mapping[indices3] = index;
 			}
 		}
 
@@ -219,93 +333,6 @@ namespace mage::rendering::loader {
 		}
 	}
 
-	template< typename VertexT, typename IndexT >
-	[[nodiscard]]
-	inline const Point3 OBJReader< VertexT, IndexT >
-		::ReadOBJVertexCoordinates() {
-
-		return Point3(Read< F32, 3u >());
-	}
-
-	template< typename VertexT, typename IndexT >
-	[[nodiscard]]
-	inline const Normal3 OBJReader< VertexT, IndexT >
-		::ReadOBJVertexNormalCoordinates() {
-
-		return Normal3(Read< F32, 3u >());
-	}
-
-	template< typename VertexT, typename IndexT >
-	[[nodiscard]]
-	const UV OBJReader< VertexT, IndexT >
-		::ReadOBJVertexTextureCoordinates() {
-
-		const UV result(Read< F32, 2u >());
-
-		if (Contains< F32 >()) {
-			// Silently ignore 3D vertex texture coordinates.
-			Read< F32 >();
-		}
-
-		return result;
-	}
-
-	template< typename VertexT, typename IndexT >
-	[[nodiscard]]
-	const U32x3 OBJReader< VertexT, IndexT >
-		::ReadOBJVertexIndices() {
-
-		const auto token  = Read< std::string_view >();
-
-		const auto slash1 = token.find_first_of('/');
-		const bool flag1  = (std::string::npos != slash1);
-		const auto slash2 = token.find_first_of('/', slash1 + 1u);
-		const bool flag2  = (std::string::npos != slash2);
-		const bool flagd  = (slash1 + 1u == slash2);
-
-		static constexpr const_zstring s_token_names[] = {
-			"v",
-			"vt",
-			"vn"
-		};
-		const bool contains_token[] = {
-			true,
-			flag1 && !flagd,
-			flag2
-		};
-		const std::string_view tokens[] = {
-			// If offset std::string::npos + 1u == 0u then count is don't-care;
-			// all unsigned values avoid exception.
-			token.substr(0u,          slash1),
-			token.substr(slash1 + 1u, slash2       - slash1 - 1u),
-			token.substr(slash2 + 1u, token.size() - slash2 - 1u)
-		};
-
-		U32x3 indices;
-		const S32x3 sizes = {
-			static_cast< S32 >(m_vertex_coordinates.size()),
-			static_cast< S32 >(m_vertex_texture_coordinates.size()),
-			static_cast< S32 >(m_vertex_normal_coordinates.size())
-		};
-
-		for (std::size_t i = 0u; i < std::size(s_token_names); ++i) {
-			if (!contains_token[i]) {
-				continue;
-			}
-
-			if (const auto result = StringTo< S32 >(tokens[i]); bool(result)) {
-				const auto index = *result;
-				indices[i] = static_cast< U32 >((0 <= index) ? index : sizes[i] + index);
-			}
-			else {
-				throw Exception("{}: line {}: invalid {} index value found in {}.",
-								GetPath(), GetCurrentLineNumber(), s_token_names[i], token);
-			}
-		}
-
-		return indices;
-	}
-
 	template< typename VertexT, typename IndexT >
 	[[nodiscard]]
 	const VertexT OBJReader< VertexT, IndexT >
@@ -0,0 +1,188 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type/types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <utility>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 A class of OBJ vertex maps for mapping vertex position/texture/normal
+	 coordinates' indices to the index of a vertex in a vertex buffer.
+
+	 OBJ vertex maps are open addressing hash tables with linear probing. The
+	 slots only store a reference to a densely packed entry, which keeps the
+	 slots small and the number of allocations independent of the number of
+	 entries.
+
+	 @tparam		IndexT
+					The index type.
+	 */
+	template< typename IndexT >
+	class OBJVertexMap {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an OBJ vertex map.
+		 */
+		OBJVertexMap();
+
+		/**
+		 Constructs an OBJ vertex map from the given OBJ vertex map.
+
+		 @param[in]		map
+						A reference to the OBJ vertex map to copy.
+		 */
+		OBJVertexMap(const OBJVertexMap& map);
+
+		/**
+		 Constructs an OBJ vertex map by moving the given OBJ vertex map.
+
+		 @param[in]		map
+						A reference to the OBJ vertex map to move.
+		 */
+		OBJVertexMap(OBJVertexMap&& map) noexcept;
+
+		/**
+		 Destructs this OBJ vertex map.
+		 */
+		~OBJVertexMap();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given OBJ vertex map to this OBJ vertex map.
+
+		 @param[in]		map
+						A reference to the OBJ vertex map to copy.
+		 @return		A reference to the copy of the given OBJ vertex map
+						(i.e. this OBJ vertex map).
+		 */
+		OBJVertexMap& operator=(const OBJVertexMap& map);
+
+		/**
+		 Moves the given OBJ vertex map to this OBJ vertex map.
+
+		 @param[in]		map
+						A reference to the OBJ vertex map to move.
+		 @return		A reference to the moved OBJ vertex map (i.e. this OBJ
+						vertex map).
+		 */
+		OBJVertexMap& operator=(OBJVertexMap&& map) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of entries of this OBJ vertex map.
+
+		 @return		The number of entries of this OBJ vertex map.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_entries.size();
+		}
+
+		/**
+		 Reserves memory for the given number of entries.
+
+		 @param[in]		nb_entries
+						The number of entries.
+		 */
+		void reserve(std::size_t nb_entries);
+
+		/**
+		 Removes all entries from this OBJ vertex map.
+		 */
+		void clear() noexcept;
+
+		/**
+		 Inserts the given index for the given vertex indices if no entry for
+		 the given vertex indices exists.
+
+		 @param[in]		key
+						A reference to the vertex indices.
+		 @param[in]		index
+						The index of the vertex.
+		 @return		A pair containing the index mapped to the given vertex
+						indices and a flag indicating whether the given index
+						is inserted.
+		 */
+		std::pair< IndexT, bool > try_emplace(const U32x3& key, IndexT index);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Hashes the given vertex indices.
+
+		 @param[in]		key
+						A reference to the vertex indices.
+		 @return		The hash value of the given vertex indices.
+		 */
+		[[nodiscard]]
+		static U64 Hash(const U32x3& key) noexcept;
+
+		/**
+		 Rehashes this OBJ vertex map for the given number of slots.
+
+		 @param[in]		nb_slots
+						The number of slots (a power of two).
+		 */
+		void Rehash(std::size_t nb_slots);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the slots of this OBJ vertex map. A slot contains
+		 zero if empty or the index of its entry incremented by one otherwise.
+		 */
+		std::vector< U32 > m_slots;
+
+		/**
+		 A vector containing the entries of this OBJ vertex map (in insertion
+		 order).
+		 */
+		std::vector< std::pair< U32x3, IndexT > > m_entries;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/obj/obj_vertex_map.tpp"
+
+#pragma endregion
@@ -0,0 +1,110 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	template< typename IndexT >
+	OBJVertexMap< IndexT >::OBJVertexMap()
+		: m_slots(),
+		m_entries() {}
+
+	template< typename IndexT >
+	OBJVertexMap< IndexT >::OBJVertexMap(const OBJVertexMap& map) = default;
+
+	template< typename IndexT >
+	OBJVertexMap< IndexT >::OBJVertexMap(OBJVertexMap&& map) noexcept = default;
+
+	template< typename IndexT >
+	OBJVertexMap< IndexT >::~OBJVertexMap() = default;
+
+	template< typename IndexT >
+	OBJVertexMap< IndexT >& OBJVertexMap< IndexT >
+		::operator=(const OBJVertexMap& map) = default;
+
+	template< typename IndexT >
+	OBJVertexMap< IndexT >& OBJVertexMap< IndexT >
+		::operator=(OBJVertexMap&& map) noexcept = default;
+
+	template< typename IndexT >
+	void OBJVertexMap< IndexT >::reserve(std::size_t nb_entries) {
+		m_entries.reserve(nb_entries);
+
+		// Keep the load factor at most 1/2.
+		std::size_t nb_slots = 16u;
+		while (nb_slots < 2u * nb_entries) {
+			nb_slots <<= 1u;
+		}
+
+		if (m_slots.size() < nb_slots) {
+			Rehash(nb_slots);
+		}
+	}
+
+	template< typename IndexT >
+	void OBJVertexMap< IndexT >::clear() noexcept {
+		std::fill(m_slots.begin(), m_slots.end(), 0u);
+		m_entries.clear();
+	}
+
+	template< typename IndexT >
+	std::pair< IndexT, bool > OBJVertexMap< IndexT >
+		::try_emplace(const U32x3& key, IndexT index) {
+
+		if (m_slots.size() < 2u * (m_entries.size() + 1u)) {
+			Rehash(std::max(std::size_t(16u), 2u * m_slots.size()));
+		}
+
+		const auto mask = m_slots.size() - 1u;
+		for (auto i = static_cast< std::size_t >(Hash(key)) & mask; ;
+			 i = (i + 1u) & mask) {
+
+			const auto slot = m_slots[i];
+			if (0u == slot) {
+				m_entries.emplace_back(key, index);
+				m_slots[i] = static_cast< U32 >(m_entries.size());
+				return { index, true };
+			}
+
+			const auto& entry = m_entries[slot - 1u];
+			if (entry.first == key) {
+				return { entry.second, false };
+			}
+		}
+	}
+
+	template< typename IndexT >
+	[[nodiscard]]
+	inline U64 OBJVertexMap< IndexT >::Hash(const U32x3& key) noexcept {
+		// Multiplicative hashing of the packed indices.
+		auto hash = (static_cast< U64 >(key[0u]) << 32u) | key[1u];
+		hash ^= static_cast< U64 >(key[2u]) * 0xC2B2AE3D27D4EB4FULL;
+		hash *= 0x9E3779B97F4A7C15ULL;
+		return hash ^ (hash >> 29u);
+	}
+
+	template< typename IndexT >
+	void OBJVertexMap< IndexT >::Rehash(std::size_t nb_slots) {
+		m_slots.assign(nb_slots, 0u);
+
+		const auto mask = nb_slots - 1u;
+		for (std::size_t j = 0u; j < m_entries.size(); ++j) {
+			auto i = static_cast< std::size_t >(Hash(m_entries[j].first)) & mask;
+			while (0u != m_slots[i]) {
+				i = (i + 1u) & mask;
+			}
+
+			m_slots[i] = static_cast< U32 >(j + 1u);
+		}
+	}
+}
@@ -0,0 +1,57 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/pvs/pvs_loader.hpp"
+#include "loaders/pvs/pvs_reader.hpp"
+#include "loaders/pvs/pvs_writer.hpp"
+#include "io/checksum.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	[[nodiscard]]
+	U64 ComputePVSKey(gsl::span< const ModelPart > model_parts) {
+		std::vector< U8 > bytes;
+		const auto append = [&bytes](const void* data, std::size_t size) {
+			const auto first = static_cast< const U8* >(data);
+			bytes.insert(bytes.end(), first, first + size);
+		};
+
+		for (const auto& model_part : model_parts) {
+			// The names include their terminating null character.
+			append(model_part.m_child.c_str(),  model_part.m_child.size()  + 1u);
+			append(model_part.m_parent.c_str(), model_part.m_parent.size() + 1u);
+
+			const F32x3 values[] = {
+				model_part.m_transform.GetTranslationView(),
+				model_part.m_transform.GetRotationView(),
+				model_part.m_transform.GetScaleView(),
+				XMStore< F32x3 >(model_part.m_aabb.MinPoint()),
+				XMStore< F32x3 >(model_part.m_aabb.MaxPoint())
+			};
+			append(values, sizeof(values));
+		}
+
+		return ComputeChecksum(gsl::span< const U8 >(bytes));
+	}
+
+	void ImportPVSFromFile(const std::filesystem::path& path,
+						   PotentiallyVisibleSet& pvs) {
+
+		PVSReader reader(pvs);
+		reader.ReadFromFile(path);
+	}
+
+	void ExportPVSToFile(const std::filesystem::path& path,
+						 const PotentiallyVisibleSet& pvs) {
+
+		PVSWriter writer(pvs);
+		writer.WriteToFile(path);
+	}
+}
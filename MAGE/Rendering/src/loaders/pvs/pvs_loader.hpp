@@ -0,0 +1,69 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry/potentially_visible_set.hpp"
+#include "resource/model/model_output.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 Computes the key of the scene of the given model parts.
+
+	 The key covers the names, local transforms and bounding volumes of the
+	 model parts (in order), which determine the (root) object space of the
+	 models created for the model parts. A potentially visible set of these
+	 models is stale if its key differs.
+
+	 @param[in]		model_parts
+					The model parts.
+	 @return		The key of the scene of the given model parts.
+	 */
+	[[nodiscard]]
+	U64 ComputePVSKey(gsl::span< const ModelPart > model_parts);
+
+	/**
+	 Imports the potentially visible set from the PVS file associated with
+	 the given path.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[out]	pvs
+					A reference to the potentially visible set.
+	 @throws		Exception
+					Failed to import the potentially visible set from file.
+	 */
+	void ImportPVSFromFile(const std::filesystem::path& path,
+						   PotentiallyVisibleSet& pvs);
+
+	/**
+	 Exports the given potentially visible set to the PVS file associated
+	 with the given path.
+
+	 @param[in]		path
+					A reference to the path.
+	 @param[in]		pvs
+					A reference to the potentially visible set.
+	 @throws		Exception
+					Failed to export the potentially visible set to file.
+	 */
+	void ExportPVSToFile(const std::filesystem::path& path,
+						 const PotentiallyVisibleSet& pvs);
+}
@@ -0,0 +1,85 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/pvs/pvs_reader.hpp"
+#include "loaders/pvs/pvs_tokens.hpp"
+#include "io/checksum.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	PVSReader::PVSReader(PotentiallyVisibleSet& pvs)
+		: BigEndianBinaryReader(),
+		m_pvs(pvs) {}
+
+	PVSReader::PVSReader(PVSReader&& reader) noexcept = default;
+
+	PVSReader::~PVSReader() = default;
+
+	void PVSReader::ReadData() {
+
+		// Read the header.
+		{
+			const bool result = IsHeaderValid();
+			ThrowIfFailed(result, "{}: invalid PVS header.", GetPath());
+		}
+
+		// Read the key of the scene.
+		const auto key = Read< U64 >();
+
+		// Read the grid of cells.
+		const auto p_min      = Read< F32x3 >();
+		const auto p_max      = Read< F32x3 >();
+		const auto resolution = Read< U32x3 >();
+		const auto nb_objects = Read< U32 >();
+
+		const auto nb_cells = static_cast< std::size_t >(resolution[0])
+			                * static_cast< std::size_t >(resolution[1])
+			                * static_cast< std::size_t >(resolution[2]);
+
+		// Read the offsets of the compressed bitsets.
+		const auto nb_offsets = Read< U32 >();
+		ThrowIfFailed((nb_cells + 1u == nb_offsets),
+					  "{}: invalid number of PVS cells: {}.", GetPath(), nb_offsets);
+		std::vector< U32 > offsets(nb_offsets);
+		ReadArray(gsl::make_span(offsets));
+
+		// Read the compressed bitsets.
+		const auto nb_bytes = Read< U32 >();
+		ThrowIfFailed((offsets.back() == nb_bytes),
+					  "{}: invalid PVS data size: {}.", GetPath(), nb_bytes);
+		std::vector< U8 > data(nb_bytes);
+		ReadArray(gsl::make_span(data));
+
+		// Verify the compressed bitsets.
+		const auto checksum = Read< U64 >();
+		ThrowIfFailed((ComputeChecksum(gsl::span< const U8 >(data)) == checksum),
+					  "{}: invalid PVS checksum.", GetPath());
+		for (std::size_t i = 1u; i < offsets.size(); ++i) {
+			ThrowIfFailed((offsets[i - 1u] <= offsets[i]),
+						  "{}: invalid PVS offset: {}.", GetPath(), offsets[i]);
+		}
+
+		m_pvs = PotentiallyVisibleSet(AABB(XMLoad(p_min), XMLoad(p_max)),
+									  resolution, nb_objects,
+									  std::move(offsets), std::move(data));
+		m_pvs.SetKey(key);
+	}
+
+	[[nodiscard]]
+	bool PVSReader::IsHeaderValid() {
+		for (auto magic = g_pvs_token_magic; *magic != '\0'; ++magic) {
+			if (*magic != Read< U8 >()) {
+				return false;
+			}
+		}
+
+		return g_pvs_token_version == Read< U32 >();
+	}
+}
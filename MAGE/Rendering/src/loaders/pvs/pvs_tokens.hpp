@@ -0,0 +1,10 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	constexpr const_zstring g_pvs_token_magic   = "MAGEpvs1";
+	constexpr U32           g_pvs_token_version = 2u;
+}
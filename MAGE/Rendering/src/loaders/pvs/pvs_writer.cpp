@@ -0,0 +1,52 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/pvs/pvs_writer.hpp"
+#include "loaders/pvs/pvs_tokens.hpp"
+#include "io/checksum.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	PVSWriter::PVSWriter(const PotentiallyVisibleSet& pvs)
+		: BigEndianBinaryWriter(),
+		m_pvs(pvs) {}
+
+	PVSWriter::PVSWriter(PVSWriter&& writer) noexcept = default;
+
+	PVSWriter::~PVSWriter() = default;
+
+	void PVSWriter::WriteData() {
+		// Write the header.
+		WriteString(NotNull< const_zstring >(g_pvs_token_magic));
+		Write< U32 >(g_pvs_token_version);
+
+		// Write the key of the scene.
+		Write< U64 >(m_pvs.GetKey());
+
+		// Write the grid of cells.
+		const auto& bounds = m_pvs.GetBounds();
+		Write< F32x3 >(XMStore< F32x3 >(bounds.MinPoint()));
+		Write< F32x3 >(XMStore< F32x3 >(bounds.MaxPoint()));
+		Write< U32x3 >(m_pvs.GetResolution());
+		Write< U32 >(static_cast< U32 >(m_pvs.GetNumberOfObjects()));
+
+		// Write the offsets of the compressed bitsets.
+		const auto offsets = m_pvs.GetOffsets();
+		Write< U32 >(static_cast< U32 >(offsets.size()));
+		WriteArray(offsets);
+
+		// Write the compressed bitsets.
+		const auto data = m_pvs.GetData();
+		Write< U32 >(static_cast< U32 >(data.size()));
+		WriteArray(data);
+
+		Write< U64 >(ComputeChecksum(data));
+	}
+}
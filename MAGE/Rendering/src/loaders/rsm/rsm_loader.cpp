@@ -0,0 +1,30 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/rsm/rsm_loader.hpp"
+#include "loaders/rsm/rsm_reader.hpp"
+#include "loaders/rsm/rsm_writer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	void ImportRSMManifestFromFile(const std::filesystem::path& path,
+								   ResourceManifest& manifest) {
+
+		RSMReader reader(manifest);
+		reader.ReadFromFile(path);
+	}
+
+	void ExportRSMManifestToFile(const std::filesystem::path& path,
+								 const ResourceManifest& manifest) {
+
+		RSMWriter writer(manifest);
+		writer.WriteToFile(path);
+	}
+}
@@ -0,0 +1,102 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/rsm/rsm_reader.hpp"
+#include "loaders/rsm/rsm_tokens.hpp"
+#include "logging/logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	RSMReader::RSMReader(ResourceManifest& manifest)
+		: LineReader(),
+		m_manifest(manifest),
+		m_version(1u) {}
+
+	RSMReader::RSMReader(RSMReader&& reader) noexcept = default;
+
+	RSMReader::~RSMReader() = default;
+
+	void RSMReader::ReadLine() {
+		const auto token = Read< std::string_view >();
+
+		if (g_rsm_token_comment == token[0]) {
+			return;
+		}
+		else if (g_rsm_token_version          == token) {
+			ReadRSMVersion();
+		}
+		else if (g_rsm_token_model            == token) {
+			ReadRSMModel();
+		}
+		else if (g_rsm_token_material_library == token) {
+			ReadRSMMaterialLibrary();
+		}
+		else if (g_rsm_token_sprite_font      == token) {
+			ReadRSMSpriteFont();
+		}
+		else if (g_rsm_token_texture          == token) {
+			ReadRSMTexture();
+		}
+		else {
+			Warning("{}: line {}: unsupported keyword token: {}.",
+					GetPath(), GetCurrentLineNumber(), token);
+			return;
+		}
+
+		ReadRemainingTokens();
+	}
+
+	void RSMReader::Postprocess() {
+		if (g_rsm_version != m_version) {
+			Warning("{}: outdated version: {}.", GetPath(), m_version);
+			m_manifest.Clear();
+		}
+	}
+
+	void RSMReader::ReadRSMVersion() {
+		m_version = Read< U32 >();
+	}
+
+	void RSMReader::ReadRSMModel() {
+		auto entry = ReadRSMEntry(ResourceManifestEntry::Type::Model);
+		entry.m_invert_handedness = Read< bool >();
+		entry.m_clockwise_order   = Read< bool >();
+		entry.m_nb_lods           = static_cast< std::size_t >(Read< U32 >());
+
+		m_manifest.Add(std::move(entry));
+	}
+
+	void RSMReader::ReadRSMMaterialLibrary() {
+		m_manifest.Add(
+			ReadRSMEntry(ResourceManifestEntry::Type::MaterialLibrary));
+	}
+
+	void RSMReader::ReadRSMSpriteFont() {
+		auto entry = ReadRSMEntry(ResourceManifestEntry::Type::SpriteFont);
+		entry.m_force_srgb = Read< bool >();
+
+		m_manifest.Add(std::move(entry));
+	}
+
+	void RSMReader::ReadRSMTexture() {
+		m_manifest.Add(ReadRSMEntry(ResourceManifestEntry::Type::Texture));
+	}
+
+	[[nodiscard]]
+	ResourceManifestEntry RSMReader
+		::ReadRSMEntry(ResourceManifestEntry::Type type) {
+
+		ResourceManifestEntry entry;
+		entry.m_type = type;
+		entry.m_guid = UTF8toUTF16(Read< std::string_view >()).str();
+		entry.m_size = Read< U64 >();
+		return entry;
+	}
+}
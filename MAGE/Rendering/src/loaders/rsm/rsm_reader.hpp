@@ -0,0 +1,179 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io/line_reader.hpp"
+#include "resource/rendering_resource_manifest.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 A class of RSM file readers for reading resource manifests.
+	 */
+	class RSMReader : private LineReader {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a RSM reader.
+
+		 @param[in]		manifest
+						A reference to a resource manifest for storing the read
+						entries from file.
+		 */
+		explicit RSMReader(ResourceManifest& manifest);
+
+		/**
+		 Constructs a RSM reader from the given RSM reader.
+
+		 @param[in]		reader
+						A reference to the RSM reader to copy.
+		 */
+		RSMReader(const RSMReader& reader) = delete;
+
+		/**
+		 Constructs a RSM reader by moving the given RSM reader.
+
+		 @param[in]		reader
+						A reference to the RSM reader to move.
+		 */
+		RSMReader(RSMReader&& reader) noexcept;
+
+		/**
+		 Destructs this RSM reader.
+		 */
+		~RSMReader();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given RSM reader to this RSM reader.
+
+		 @param[in]		reader
+						A reference to a RSM reader to copy.
+		 @return		A reference to the copy of the given RSM reader (i.e.
+						this RSM reader).
+		 */
+		RSMReader& operator=(const RSMReader& reader) = delete;
+
+		/**
+		 Moves the given RSM reader to this RSM reader.
+
+		 @param[in]		reader
+						A reference to a RSM reader to move.
+		 @return		A reference to the moved RSM reader (i.e. this RSM
+						reader).
+		 */
+		RSMReader& operator=(RSMReader&& reader) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using LineReader::ReadFromFile;
+
+		using LineReader::ReadFromMemory;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Reads the current line of this RSM reader.
+
+		 @throws		Exception
+						Failed to the current line of this RSM reader.
+		 */
+		virtual void ReadLine() override;
+
+		/**
+		 Post-processes after reading the current file of this RSM reader.
+
+		 Discards all read entries if the file has an outdated version.
+		 */
+		virtual void Postprocess() override;
+
+		/**
+		 Reads a Version definition.
+
+		 @throws		Exception
+						Failed to read a Version definition.
+		 */
+		void ReadRSMVersion();
+
+		/**
+		 Reads a Model definition.
+
+		 @throws		Exception
+						Failed to read a Model definition.
+		 */
+		void ReadRSMModel();
+
+		/**
+		 Reads a Material Library definition.
+
+		 @throws		Exception
+						Failed to read a Material Library definition.
+		 */
+		void ReadRSMMaterialLibrary();
+
+		/**
+		 Reads a Sprite Font definition.
+
+		 @throws		Exception
+						Failed to read a Sprite Font definition.
+		 */
+		void ReadRSMSpriteFont();
+
+		/**
+		 Reads a Texture definition.
+
+		 @throws		Exception
+						Failed to read a Texture definition.
+		 */
+		void ReadRSMTexture();
+
+		/**
+		 Reads the filename and size of a resource manifest entry.
+
+		 @param[in]		type
+						The type of the file resource.
+		 @return		The resource manifest entry.
+		 @throws		Exception
+						Failed to read the filename and size.
+		 */
+		[[nodiscard]]
+		ResourceManifestEntry ReadRSMEntry(ResourceManifestEntry::Type type);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the resource manifest containing the read entries of
+		 this RSM reader.
+		 */
+		ResourceManifest& m_manifest;
+
+		/**
+		 The version of the file of this RSM reader.
+		 */
+		U32 m_version;
+	};
+}
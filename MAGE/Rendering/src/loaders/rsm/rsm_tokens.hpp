@@ -0,0 +1,20 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	constexpr const char    g_rsm_token_comment          = '#';
+	constexpr const_zstring g_rsm_token_version          = "version";
+	constexpr const_zstring g_rsm_token_model            = "model";
+	constexpr const_zstring g_rsm_token_material_library = "mtllib";
+	constexpr const_zstring g_rsm_token_sprite_font      = "font";
+	constexpr const_zstring g_rsm_token_texture          = "texture";
+
+	/**
+	 The current version of the RSM file format. Files without a version
+	 line are version 1.
+	 */
+	constexpr U32           g_rsm_version                = 2u;
+}
@@ -0,0 +1,79 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders/rsm/rsm_writer.hpp"
+#include "loaders/rsm/rsm_tokens.hpp"
+#include "logging/logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	namespace {
+
+		[[nodiscard]]
+		constexpr const_zstring ToString(bool value) noexcept {
+			return value ? "true" : "false";
+		}
+	}
+
+	RSMWriter::RSMWriter(const ResourceManifest& manifest)
+		: Writer(),
+		m_manifest(manifest) {}
+
+	RSMWriter::RSMWriter(RSMWriter&& writer) noexcept = default;
+
+	RSMWriter::~RSMWriter() = default;
+
+	void RSMWriter::Write() {
+		char buffer[2u * MAX_PATH];
+		const auto not_null_buffer = NotNull< const_zstring >(buffer);
+
+		WriteTo(buffer, "{} {}", g_rsm_token_version, g_rsm_version);
+		WriteStringLine(not_null_buffer);
+
+		m_manifest.ForEachEntry([&](const ResourceManifestEntry& entry) {
+			using Type = ResourceManifestEntry::Type;
+
+			switch (entry.m_type) {
+
+			case Type::Model: {
+				WriteTo(buffer, "{} \"{}\" {} {} {} {}",
+						g_rsm_token_model, entry.m_guid, entry.m_size,
+						ToString(entry.m_invert_handedness),
+						ToString(entry.m_clockwise_order),
+						entry.m_nb_lods);
+				break;
+			}
+
+			case Type::MaterialLibrary: {
+				WriteTo(buffer, "{} \"{}\" {}",
+						g_rsm_token_material_library, entry.m_guid,
+						entry.m_size);
+				break;
+			}
+
+			case Type::SpriteFont: {
+				WriteTo(buffer, "{} \"{}\" {} {}",
+						g_rsm_token_sprite_font, entry.m_guid, entry.m_size,
+						ToString(entry.m_force_srgb));
+				break;
+			}
+
+			case Type::Texture: {
+				WriteTo(buffer, "{} \"{}\" {}",
+						g_rsm_token_texture, entry.m_guid, entry.m_size);
+				break;
+			}
+
+			}
+
+			WriteStringLine(not_null_buffer);
+		});
+	}
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io/writer.hpp"
+#include "resource/rendering_resource_manifest.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 A class of RSM file writers for writing resource manifests.
+	 */
+	class RSMWriter : private Writer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a RSM writer.
+
+		 @param[in]		manifest
+						A reference to the resource manifest to write to file.
+		 */
+		explicit RSMWriter(const ResourceManifest& manifest);
+
+		/**
+		 Constructs a RSM writer from the given RSM writer.
+
+		 @param[in]		writer
+						A reference to the RSM writer to copy.
+		 */
+		RSMWriter(const RSMWriter& writer) = delete;
+
+		/**
+		 Constructs a RSM writer by moving the given RSM writer.
+
+		 @param[in]		writer
+						A reference to the RSM writer to move.
+		 */
+		RSMWriter(RSMWriter&& writer) noexcept;
+
+		/**
+		 Destructs this RSM writer.
+		 */
+		~RSMWriter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given RSM writer to this RSM writer.
+
+		 @param[in]		writer
+						A reference to a RSM writer to copy.
+		 @return		A reference to the copy of the given RSM writer (i.e.
+						this RSM writer).
+		 */
+		RSMWriter& operator=(const RSMWriter& writer) = delete;
+
+		/**
+		 Moves the given RSM writer to this RSM writer.
+
+		 @param[in]		writer
+						A reference to a RSM writer to move.
+		 @return		A reference to the moved RSM writer (i.e. this RSM
+						writer).
+		 */
+		RSMWriter& operator=(RSMWriter&& writer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		using Writer::WriteToFile;
+
+		using Writer::GetPath;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts writing.
+
+		 @throws		Exception
+						Failed to write.
+		 */
+		virtual void Write() override;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the resource manifest to write by this RSM writer.
+		 */
+		const ResourceManifest& m_manifest;
+	};
+}
@@ -19,7 +19,7 @@ namespace mage::rendering::loader {
 		                          SpriteFontOutput& output,
 		                          const SpriteFontDescriptor& desc) {
 
-		std::wstring extension(path.extension());
+		std::wstring extension = path.extension().wstring();
 		TransformToLowerCase(extension);
 
 		if (L".font" == extension) {
@@ -8,6 +8,7 @@
 #include "directxtex\ScreenGrab.h"
 #include "directxtex\WICTextureLoader.h"
 #include "exception\exception.hpp"
+#include "io\archive.hpp"
 
 #pragma endregion
 
@@ -29,9 +30,28 @@ namespace mage::rendering::loader {
 		                       ID3D11Device& device,
 		                       NotNull< ID3D11ShaderResourceView** > texture_srv) {
 
-		std::wstring extension(path.extension());
+		std::wstring extension = path.extension().wstring();
 		TransformToLowerCase(extension);
 
+		// Textures of the mounted archives are created from memory.
+		if (const auto file = OpenArchivedFile(path)) {
+			const auto data = file->GetData();
+			const auto size = static_cast< std::size_t >(data.size());
+
+			if (L".dds" == extension) {
+				const HRESULT result = DirectX::CreateDDSTextureFromMemory(
+					&device, data.data(), size, nullptr, texture_srv);
+				ThrowIfFailed(result, "Texture importing failed: {:08X}.", result);
+			}
+			else {
+				const HRESULT result = DirectX::CreateWICTextureFromMemory(
+					&device, data.data(), size, nullptr, texture_srv);
+				ThrowIfFailed(result, "Texture importing failed: {:08X}.", result);
+			}
+
+			return;
+		}
+
 		if (L".dds" == extension) {
 			const HRESULT result = DirectX::CreateDDSTextureFromFile(
 				&device, path.c_str(), nullptr, texture_srv);
@@ -96,7 +116,7 @@ namespace mage::rendering::loader {
 		                     ID3D11DeviceContext& device_context,
 		                     ID3D11Resource& texture) {
 
-		std::wstring extension(path.extension());
+		std::wstring extension = path.extension().wstring();
 		TransformToLowerCase(extension);
 
 		if (L".dds" == extension) {
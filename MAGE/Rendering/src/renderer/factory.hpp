@@ -6,7 +6,7 @@
 #pragma region
 
 #include "direct3d11.hpp"
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -672,6 +672,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\factory.tpp"
+#include "renderer/factory.tpp"
 
 #pragma endregion
\ No newline at end of file
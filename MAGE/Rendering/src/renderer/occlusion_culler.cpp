@@ -0,0 +1,318 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\occlusion_culler.hpp"
+#include "renderer\pipeline.hpp"
+#include "parallel\parallel.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 The width (in pixels) of occlusion buffers. The height follows from
+		 the aspect ratio of the viewport.
+		 */
+		constexpr U32 g_occlusion_buffer_width = 256u;
+
+		/**
+		 The minimum projected size (i.e. the projected radius of the
+		 bounding sphere relative to the viewport height) of models to be
+		 selected as occluders.
+		 */
+		constexpr F32 g_occluder_min_screen_size = 0.1f;
+
+		/**
+		 The maximum number of occluder triangles per frame.
+		 */
+		constexpr std::size_t g_occluder_max_total_nb_triangles = 32768u;
+
+		/**
+		 The number of tile rows of each band rasterized by a single thread.
+		 */
+		constexpr U32 g_nb_tile_rows_per_band = 2u;
+
+		/**
+		 The number of occludees tested by a single thread at once.
+		 */
+		constexpr std::size_t g_nb_occludees_per_chunk = 64u;
+
+		/**
+		 The minimum number of occluder triangles and occludees to distribute
+		 the work over multiple threads.
+		 */
+		constexpr std::size_t g_min_parallel_work = 2048u;
+
+		[[nodiscard]]
+		inline const XMMATRIX XM_CALLCONV
+			GetOcclusionProjectionMatrix(CXMMATRIX camera_to_projection) noexcept {
+
+			#ifdef DISABLE_INVERTED_Z_BUFFER
+			// Convert to an inverted depth: z' = w - z.
+			static const XMMATRIX invert_depth(1.0f, 0.0f,  0.0f, 0.0f,
+											   0.0f, 1.0f,  0.0f, 0.0f,
+											   0.0f, 0.0f, -1.0f, 0.0f,
+											   0.0f, 0.0f,  1.0f, 1.0f);
+			return camera_to_projection * invert_depth;
+			#else  // DISABLE_INVERTED_Z_BUFFER
+			return camera_to_projection;
+			#endif // DISABLE_INVERTED_Z_BUFFER
+		}
+	}
+
+	OcclusionCuller::OcclusionCuller(ID3D11Device& device)
+		: m_device(device),
+		m_buffer(),
+		m_workers(NumberOfSystemCores()),
+		m_occluders(),
+		m_debug_pixels(),
+		m_debug_texture(),
+		m_debug_srv() {}
+
+	OcclusionCuller::OcclusionCuller(OcclusionCuller&& culler) noexcept = default;
+
+	OcclusionCuller::~OcclusionCuller() = default;
+
+	OcclusionCuller& OcclusionCuller
+		::operator=(OcclusionCuller&& culler) noexcept = default;
+
+	void XM_CALLCONV OcclusionCuller::Cull(gsl::span< const Model* const > models,
+										   FXMMATRIX world_to_camera,
+										   CXMMATRIX camera_to_projection,
+										   const U32x2& viewport_size) {
+
+		const auto aspect_ratio = (0u == viewport_size[0]) ? 1.0f
+			: static_cast< F32 >(viewport_size[1])
+			/ static_cast< F32 >(viewport_size[0]);
+		const auto height = std::max(1u, static_cast< U32 >(
+			aspect_ratio * static_cast< F32 >(g_occlusion_buffer_width)));
+
+		// Resize (and clear) the occlusion buffer.
+		m_buffer.Resize(g_occlusion_buffer_width, height);
+
+		const auto world_to_projection = world_to_camera
+			* GetOcclusionProjectionMatrix(camera_to_projection);
+
+		// Setup the triangles of the occluders.
+		SelectOccluders(models, world_to_camera, camera_to_projection);
+		for (const auto& [size, model] : m_occluders) {
+			const auto& transform            = model->GetOwner()->GetTransform();
+			const auto  object_to_world      = transform.GetObjectToWorldMatrix();
+			const auto  object_to_projection = object_to_world * world_to_projection;
+
+			m_buffer.AddOccluder(object_to_projection, *model->GetOccluderMesh());
+		}
+
+		const auto nb_models    = static_cast< std::size_t >(models.size());
+		const auto nb_tile_rows = m_buffer.GetNumberOfTileRows();
+		const auto nb_bands     = (nb_tile_rows + g_nb_tile_rows_per_band - 1u)
+			                    / g_nb_tile_rows_per_band;
+
+		std::atomic< U32 >         next_band(0u);
+		std::atomic< U32 >         nb_rasterized_bands(0u);
+		std::atomic< std::size_t > next_chunk(0u);
+
+		const auto cull = [this, models, nb_models, nb_tile_rows, nb_bands,
+						   world_to_projection, &next_band, &nb_rasterized_bands,
+						   &next_chunk]() noexcept {
+
+			// Rasterize the occluder triangles band by band.
+			for (auto band = next_band++; band < nb_bands; band = next_band++) {
+				const auto first_tile_row = band * g_nb_tile_rows_per_band;
+				const auto end_tile_row   = std::min(nb_tile_rows,
+					first_tile_row + g_nb_tile_rows_per_band);
+				m_buffer.Rasterize(first_tile_row, end_tile_row);
+				++nb_rasterized_bands;
+			}
+
+			// Wait for the bands rasterized by the other threads.
+			while (nb_rasterized_bands < nb_bands) {
+				std::this_thread::yield();
+			}
+
+			// Test the occludees chunk by chunk.
+			for (auto chunk = next_chunk++; chunk * g_nb_occludees_per_chunk < nb_models;
+				 chunk = next_chunk++) {
+
+				const auto first = chunk * g_nb_occludees_per_chunk;
+				const auto end   = std::min(nb_models, first + g_nb_occludees_per_chunk);
+				for (auto i = first; i < end; ++i) {
+					const auto model = models[static_cast< std::ptrdiff_t >(i)];
+					model->CullOcclusion(&m_buffer, world_to_projection);
+				}
+			}
+		};
+
+		const auto work = m_buffer.GetNumberOfTriangles() + nb_models;
+		const auto nb_threads = (work < g_min_parallel_work) ? std::size_t(1u)
+			: std::min(m_workers.GetNumberOfThreads(),
+					   static_cast< std::size_t >(nb_bands));
+
+		// The calling thread participates as well.
+		m_workers.Run(nb_threads, cull);
+	}
+
+	void XM_CALLCONV OcclusionCuller
+		::SelectOccluders(gsl::span< const Model* const > models,
+						  FXMMATRIX world_to_camera,
+						  CXMMATRIX camera_to_projection) {
+
+		m_occluders.clear();
+
+		const auto y_scale = XMVectorGetY(camera_to_projection.r[1]);
+
+		for (const auto model : models) {
+			const auto mesh = model->GetOccluderMesh();
+			if (nullptr == mesh || mesh->empty()
+				|| model->GetMaterial().IsTransparant()) {
+				continue;
+			}
+
+			const auto& transform       = model->GetOwner()->GetTransform();
+			const auto  object_to_world = transform.GetObjectToWorldMatrix();
+			const auto& sphere          = model->GetBoundingSphere();
+
+			// The radius of the bounding sphere in world space.
+			const auto scale  = XMVectorMax(XMVector3LengthSq(object_to_world.r[0]),
+											XMVectorMax(XMVector3LengthSq(object_to_world.r[1]),
+														XMVector3LengthSq(object_to_world.r[2])));
+			const auto radius = sphere.Radius() * std::sqrt(XMVectorGetX(scale));
+
+			const auto p_camera = XMVector3TransformCoord(
+				sphere.Centroid(), object_to_world * world_to_camera);
+			const auto distance = XMVectorGetX(XMVector3Length(p_camera));
+
+			// Models containing the camera are always occluders.
+			const auto size = (distance <= radius) ? std::numeric_limits< F32 >::max()
+				                                   : radius * y_scale / distance;
+
+			if (model->IsOccluder() || g_occluder_min_screen_size <= size) {
+				m_occluders.emplace_back(size, model);
+			}
+		}
+
+		// Prefer the largest occluders, with the designated occluders first.
+		std::sort(m_occluders.begin(), m_occluders.end(),
+			[](const auto& lhs, const auto& rhs) noexcept {
+				const auto lhs_occluder = lhs.second->IsOccluder();
+				const auto rhs_occluder = rhs.second->IsOccluder();
+				return (lhs_occluder != rhs_occluder) ? lhs_occluder
+					                                  : lhs.first > rhs.first;
+			});
+
+		// Limit the total number of occluder triangles.
+		std::size_t nb_triangles = 0u;
+		std::size_t nb_occluders = 0u;
+		for (; nb_occluders < m_occluders.size(); ++nb_occluders) {
+			const auto occluder = m_occluders[nb_occluders].second;
+			nb_triangles += occluder->GetOccluderMesh()->GetNumberOfTriangles();
+			if (g_occluder_max_total_nb_triangles < nb_triangles) {
+				break;
+			}
+		}
+		m_occluders.resize(nb_occluders);
+	}
+
+	void OcclusionCuller::UpdateDebugTexture(ID3D11DeviceContext& device_context) {
+		const auto width  = m_buffer.GetWidth();
+		const auto height = m_buffer.GetHeight();
+		if (0u == width || 0u == height) {
+			return;
+		}
+
+		if (nullptr == m_debug_texture) {
+			SetupDebugTexture();
+		}
+		else {
+			D3D11_TEXTURE2D_DESC texture_desc;
+			m_debug_texture->GetDesc(&texture_desc);
+			if (texture_desc.Width != width || texture_desc.Height != height) {
+				SetupDebugTexture();
+			}
+		}
+
+		// Convert the depths to grey values (with more contrast near the far
+		// plane).
+		m_debug_pixels.resize(static_cast< std::size_t >(width) * height);
+		for (U32 y = 0u; y < height; ++y) {
+			for (U32 x = 0u; x < width; ++x) {
+				const auto depth = std::clamp(m_buffer.GetDepth(x, y), 0.0f, 1.0f);
+				const auto grey  = static_cast< U32 >(255.0f * std::sqrt(depth));
+				m_debug_pixels[y * width + x]
+					= 0xFF000000u | (grey << 16u) | (grey << 8u) | grey;
+			}
+		}
+
+		D3D11_MAPPED_SUBRESOURCE mapped_texture;
+		{
+			const HRESULT result = Pipeline::Map(device_context,
+												 *m_debug_texture.Get(),
+												 0u,
+												 D3D11_MAP_WRITE_DISCARD,
+												 0u,
+												 mapped_texture);
+			ThrowIfFailed(result, "Texture mapping failed: {:08X}.", result);
+		}
+
+		const auto src = reinterpret_cast< const U8* >(m_debug_pixels.data());
+		const auto dst = static_cast< U8* >(mapped_texture.pData);
+		for (U32 y = 0u; y < height; ++y) {
+			std::memcpy(dst + y * mapped_texture.RowPitch,
+						src + y * width * sizeof(U32),
+						width * sizeof(U32));
+		}
+
+		Pipeline::Unmap(device_context, *m_debug_texture.Get(), 0u);
+	}
+
+	void OcclusionCuller::SetupDebugTexture() {
+		// Create the texture descriptor.
+		D3D11_TEXTURE2D_DESC texture_desc = {};
+		texture_desc.Width            = m_buffer.GetWidth();
+		texture_desc.Height           = m_buffer.GetHeight();
+		texture_desc.MipLevels        = 1u;
+		texture_desc.ArraySize        = 1u;
+		texture_desc.Format           = DXGI_FORMAT_R8G8B8A8_UNORM;
+		texture_desc.SampleDesc.Count = 1u;
+		// GPU: read + no write
+		// CPU: no read + write
+		texture_desc.Usage            = D3D11_USAGE_DYNAMIC;
+		texture_desc.BindFlags        = D3D11_BIND_SHADER_RESOURCE;
+		texture_desc.CPUAccessFlags   = D3D11_CPU_ACCESS_WRITE;
+
+		// Create the texture.
+		{
+			const HRESULT result = m_device.get().CreateTexture2D(
+				&texture_desc, nullptr, m_debug_texture.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result, "Texture 2D creation failed: {:08X}.", result);
+		}
+
+		// Create the SRV.
+		{
+			const HRESULT result = m_device.get().CreateShaderResourceView(
+				m_debug_texture.Get(), nullptr, m_debug_srv.ReleaseAndGetAddressOf());
+			ThrowIfFailed(result, "SRV creation failed: {:08X}.", result);
+		}
+	}
+}
@@ -0,0 +1,219 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\model\model.hpp"
+#include "geometry\occlusion_buffer.hpp"
+#include "parallel\worker_pool.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of occlusion cullers for culling the models of a camera against
+	 a software-rasterized occlusion buffer.
+
+	 Each frame, the largest (projected) opaque models with an occluder mesh
+	 are rasterized into a low resolution occlusion buffer, after which the
+	 AABBs of all models inside the view frustum of the camera are tested
+	 against this occlusion buffer. Both steps are distributed over the
+	 cores of the system by the persistent threads of the occlusion culler.
+	 */
+	class OcclusionCuller {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an occlusion culler.
+
+		 @param[in]		device
+						A reference to the device.
+		 */
+		explicit OcclusionCuller(ID3D11Device& device);
+
+		/**
+		 Constructs an occlusion culler from the given occlusion culler.
+
+		 @param[in]		culler
+						A reference to the occlusion culler to copy.
+		 */
+		OcclusionCuller(const OcclusionCuller& culler) = delete;
+
+		/**
+		 Constructs an occlusion culler by moving the given occlusion culler.
+
+		 @param[in]		culler
+						A reference to the occlusion culler to move.
+		 */
+		OcclusionCuller(OcclusionCuller&& culler) noexcept;
+
+		/**
+		 Destructs this occlusion culler.
+		 */
+		~OcclusionCuller();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given occlusion culler to this occlusion culler.
+
+		 @param[in]		culler
+						A reference to the occlusion culler to copy.
+		 @return		A reference to the copy of the given occlusion culler
+						(i.e. this occlusion culler).
+		 */
+		OcclusionCuller& operator=(const OcclusionCuller& culler) = delete;
+
+		/**
+		 Moves the given occlusion culler to this occlusion culler.
+
+		 @param[in]		culler
+						A reference to the occlusion culler to move.
+		 @return		A reference to the moved occlusion culler (i.e. this
+						occlusion culler).
+		 */
+		OcclusionCuller& operator=(OcclusionCuller&& culler) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Culls the given models against the occluders among them.
+
+		 @pre			All models have an owner.
+		 @param[in]		models
+						The active models inside the view frustum of the
+						camera.
+		 @param[in]		world_to_camera
+						The world-to-camera transformation matrix.
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 @param[in]		viewport_size
+						The size of the viewport of the camera.
+		 */
+		void XM_CALLCONV Cull(gsl::span< const Model* const > models,
+							  FXMMATRIX world_to_camera,
+							  CXMMATRIX camera_to_projection,
+							  const U32x2& viewport_size);
+
+		/**
+		 Updates the debug texture of this occlusion culler with the depths of
+		 the occlusion buffer of the last call to
+		 {@link mage::rendering::OcclusionCuller::Cull(gsl::span<const Model* const>, FXMMATRIX, CXMMATRIX, const U32x2&)}.
+
+		 @param[in]		device_context
+						A reference to the device context.
+		 @throws		Exception
+						Failed to update the debug texture.
+		 */
+		void UpdateDebugTexture(ID3D11DeviceContext& device_context);
+
+		/**
+		 Returns the shader resource view of the debug texture of this
+		 occlusion culler.
+
+		 @return		A pointer to the shader resource view of the debug
+						texture of this occlusion culler (may be
+						@c nullptr).
+		 */
+		[[nodiscard]]
+		ID3D11ShaderResourceView* GetDebugSRV() const noexcept {
+			return m_debug_srv.Get();
+		}
+
+		/**
+		 Returns the occlusion buffer of this occlusion culler.
+
+		 @return		A reference to the occlusion buffer of this occlusion
+						culler.
+		 */
+		[[nodiscard]]
+		const OcclusionBuffer& GetBuffer() const noexcept {
+			return m_buffer;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Selects the occluders among the given models.
+
+		 @param[in]		models
+						The active models inside the view frustum of the
+						camera.
+		 @param[in]		world_to_camera
+						The world-to-camera transformation matrix.
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 */
+		void XM_CALLCONV SelectOccluders(gsl::span< const Model* const > models,
+										 FXMMATRIX world_to_camera,
+										 CXMMATRIX camera_to_projection);
+
+		/**
+		 Sets up the debug texture of this occlusion culler.
+
+		 @throws		Exception
+						Failed to setup the debug texture.
+		 */
+		void SetupDebugTexture();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A reference to the device of this occlusion culler.
+		 */
+		std::reference_wrapper< ID3D11Device > m_device;
+
+		/**
+		 The occlusion buffer of this occlusion culler.
+		 */
+		OcclusionBuffer m_buffer;
+
+		/**
+		 The worker pool of this occlusion culler.
+		 */
+		WorkerPool m_workers;
+
+		/**
+		 The selected occluders (and their projected sizes) of this occlusion
+		 culler.
+		 */
+		std::vector< std::pair< F32, const Model* > > m_occluders;
+
+		/**
+		 The (R8G8B8A8) pixels of the debug texture of this occlusion culler.
+		 */
+		std::vector< U32 > m_debug_pixels;
+
+		/**
+		 A pointer to the debug texture of this occlusion culler.
+		 */
+		ComPtr< ID3D11Texture2D > m_debug_texture;
+
+		/**
+		 A pointer to the shader resource view of the debug texture of this
+		 occlusion culler.
+		 */
+		ComPtr< ID3D11ShaderResourceView > m_debug_srv;
+	};
+}
@@ -80,14 +80,12 @@ namespace mage::rendering {
 											 SLOT_CBUFFER_SECONDARY_CAMERA);
 	}
 
-	void XM_CALLCONV DepthPass::Render(const World& world,
+	void XM_CALLCONV DepthPass::Render(const VisibleSet& visible_set,
 									   FXMMATRIX world_to_camera,
 									   CXMMATRIX camera_to_projection) {
 		// Bind the projection data.
 		BindCamera(world_to_camera, camera_to_projection);
 
-		const auto world_to_projection = world_to_camera * camera_to_projection;
-
 		//---------------------------------------------------------------------
 		// All opaque models.
 		//---------------------------------------------------------------------
@@ -96,14 +94,9 @@ namespace mage::rendering {
 		BindOpaqueShaders();
 
 		// Process the opaque models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()
-				|| model.GetMaterial().IsTransparant()) {
-				return;
-			}
-
-			RenderOpaque(model, world_to_projection);
-		});
+		for (const auto model : visible_set.GetModels(ModelBucket::DepthOpaque)) {
+			RenderOpaque(*model, true);
+		}
 
 		//---------------------------------------------------------------------
 		// All transparent models.
@@ -113,21 +106,12 @@ namespace mage::rendering {
 		BindTransparentShaders();
 
 		// Process the transparent models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			RenderTransparent(model, world_to_projection);
-		});
+		for (const auto model : visible_set.GetModels(ModelBucket::DepthTransparent)) {
+			RenderTransparent(*model, true);
+		}
 	}
 
-	void XM_CALLCONV DepthPass::RenderOccluders(const World& world,
+	void XM_CALLCONV DepthPass::RenderOccluders(const VisibleSet& visible_set,
 												FXMMATRIX world_to_camera,
 												CXMMATRIX camera_to_projection) {
 		// Bind the projection data.
@@ -143,15 +127,11 @@ namespace mage::rendering {
 		BindOpaqueShaders();
 
 		// Process the opaque models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()
-				|| !model.OccludesLight()
-				|| model.GetMaterial().IsTransparant()) {
-				return;
+		for (const auto model : visible_set.GetModels(ModelBucket::LightOccluderOpaque)) {
+			if (!Cull(*model, world_to_projection)) {
+				RenderOpaque(*model, false);
 			}
-
-			RenderOpaque(model, world_to_projection);
-		});
+		}
 
 		//---------------------------------------------------------------------
 		// All transparent models.
@@ -161,52 +141,38 @@ namespace mage::rendering {
 		BindTransparentShaders();
 
 		// Process the transparent models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !model.OccludesLight()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
+		for (const auto model : visible_set.GetModels(ModelBucket::LightOccluderTransparent)) {
+			if (!Cull(*model, world_to_projection)) {
+				RenderTransparent(*model, false);
 			}
-
-			RenderTransparent(model, world_to_projection);
-		});
+		}
 	}
 
-	void XM_CALLCONV DepthPass::RenderOpaque(const Model& model,
-											 FXMMATRIX world_to_projection) const noexcept {
+	[[nodiscard]]
+	bool XM_CALLCONV DepthPass::Cull(const Model& model,
+									 FXMMATRIX world_to_projection) noexcept {
 
 		const auto& transform            = model.GetOwner()->GetTransform();
 		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
 		const auto  object_to_projection = object_to_world * world_to_projection;
 
 		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
-			return;
-		}
+		return BoundingFrustum::Cull(object_to_projection, model.GetOBB());
+	}
+
+	void DepthPass::RenderOpaque(const Model& model,
+								 bool cull_clusters) const noexcept {
 
 		// Bind the constant buffer of the model.
 		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
 		// Bind the mesh of the model.
 		model.BindMesh(m_device_context);
 		// Draw the model.
-		model.Draw(m_device_context);
+		model.Draw(m_device_context, cull_clusters);
 	}
 
-	void XM_CALLCONV DepthPass::RenderTransparent(const Model& model,
-												  FXMMATRIX world_to_projection) const noexcept {
-
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
-
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
-			return;
-		}
+	void DepthPass::RenderTransparent(const Model& model,
+									  bool cull_clusters) const noexcept {
 
 		// Bind the constant buffer of the model.
 		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
@@ -217,6 +183,6 @@ namespace mage::rendering {
 		// Bind the mesh of the model.
 		model.BindMesh(m_device_context);
 		// Draw the model.
-		model.Draw(m_device_context);
+		model.Draw(m_device_context, cull_clusters);
 	}
-}
\ No newline at end of file
+}
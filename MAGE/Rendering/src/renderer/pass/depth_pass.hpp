@@ -7,7 +7,7 @@
 
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
-#include "scene\rendering_world.hpp"
+#include "renderer\visible_set.hpp"
 
 #pragma endregion
 
@@ -102,34 +102,36 @@ namespace mage::rendering {
 		void BindFixedState() const noexcept;
 
 		/**
-		 Renders the world.
+		 Renders the models of the given visible set.
 
-		 @param[in]		world
-						A reference to the world.
+		 @param[in]		visible_set
+						A reference to the visible set of the camera.
 		 @param[in]		world_to_camera
 						The world-to-camera transformation matrix.
 		 @param[in]		camera_to_projection
 						The camera-to-projection transformation matrix.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the visible set.
 		 */
-		void XM_CALLCONV Render(const World& world,
+		void XM_CALLCONV Render(const VisibleSet& visible_set,
 								FXMMATRIX world_to_camera,
 								CXMMATRIX camera_to_projection);
 
 		/**
-		 Renders the occluders of the world.
+		 Renders the light occluders of the given visible set.
 
-		 @param[in]		world
-						A reference to the world.
+		 @param[in]		visible_set
+						A reference to the visible set.
 		 @param[in]		world_to_camera
-						The world-to-camera transformation matrix.
+						The world-to-camera transformation matrix of the
+						light.
 		 @param[in]		camera_to_projection
-						The camera-to-projection transformation matrix.
+						The camera-to-projection transformation matrix of
+						the light.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the visible set.
 		 */
-		void XM_CALLCONV RenderOccluders(const World& world,
+		void XM_CALLCONV RenderOccluders(const VisibleSet& visible_set,
 										 FXMMATRIX world_to_camera,
 										 CXMMATRIX camera_to_projection);
 
@@ -163,26 +165,45 @@ namespace mage::rendering {
 									CXMMATRIX camera_to_projection);
 
 		/**
-		 Renders the given opaque model.
+		 Checks whether the given model is outside the view frustum of the
+		 given world-to-projection transformation matrix.
 
 		 @param[in]		model
-						A reference to the opaque model.
+						A reference to the model.
 		 @param[in]		world_to_projection
 						The world-to-projection transformation matrix.
+		 @return		@c true if the given model is outside the view
+						frustum. @c false otherwise.
 		 */
-		void XM_CALLCONV RenderOpaque(const Model& model,
-									  FXMMATRIX world_to_projection) const noexcept;
+		[[nodiscard]]
+		static bool XM_CALLCONV Cull(const Model& model,
+									 FXMMATRIX world_to_projection) noexcept;
+
+		/**
+		 Renders the given opaque model.
+
+		 @param[in]		model
+						A reference to the opaque model.
+		 @param[in]		cull_clusters
+						@c true if the mesh clusters culled for the camera need
+						to be skipped at the level of detail selected for the
+						camera. @c false if the full detail needs to be drawn.
+		 */
+		void RenderOpaque(const Model& model,
+						  bool cull_clusters) const noexcept;
 
 		/**
 		 Renders the given transparent model.
 
 		 @param[in]		model
 						A reference to the transparent model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		cull_clusters
+						@c true if the mesh clusters culled for the camera need
+						to be skipped at the level of detail selected for the
+						camera. @c false if the full detail needs to be drawn.
 		 */
-		void XM_CALLCONV RenderTransparent(const Model& model,
-										   FXMMATRIX world_to_projection) const noexcept;
+		void RenderTransparent(const Model& model,
+							   bool cull_clusters) const noexcept;
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -116,9 +116,8 @@ namespace mage::rendering {
 		m_color_buffer.Bind< Pipeline::PS >(m_device_context, SLOT_CBUFFER_COLOR);
 	}
 
-	void XM_CALLCONV ForwardPass::Render(const World& world,
-										 FXMMATRIX world_to_projection,
-										 BRDF brdf, bool vct) const {
+	void ForwardPass::Render(const VisibleSet& visible_set,
+							 BRDF brdf, bool vct) const {
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -135,18 +134,7 @@ namespace mage::rendering {
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(visible_set.GetModels(ModelBucket::OpaqueEmissive));
 
 		//---------------------------------------------------------------------
 		// All models with no TSNM.
@@ -160,19 +148,7 @@ namespace mage::rendering {
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(visible_set.GetModels(ModelBucket::Opaque));
 
 		//---------------------------------------------------------------------
 		// All models with TSNM.
@@ -186,23 +162,10 @@ namespace mage::rendering {
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(visible_set.GetModels(ModelBucket::OpaqueTSNM));
 	}
 
-	void XM_CALLCONV ForwardPass::RenderSolid(const World& world,
-											  FXMMATRIX world_to_projection) const {
+	void ForwardPass::RenderSolid(const VisibleSet& visible_set) const {
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -216,17 +179,10 @@ namespace mage::rendering {
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(visible_set.GetModels());
 	}
 
-	void XM_CALLCONV ForwardPass::RenderGBuffer(const World& world,
-												FXMMATRIX world_to_projection) const {
+	void ForwardPass::RenderGBuffer(const VisibleSet& visible_set) const {
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -241,19 +197,7 @@ namespace mage::rendering {
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(visible_set.GetModels(ModelBucket::Opaque));
 
 		//---------------------------------------------------------------------
 		// All models with TSNM.
@@ -266,23 +210,10 @@ namespace mage::rendering {
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(visible_set.GetModels(ModelBucket::OpaqueTSNM));
 	}
 
-	void XM_CALLCONV ForwardPass::RenderEmissive(const World& world,
-												 FXMMATRIX world_to_projection) const {
+	void ForwardPass::RenderEmissive(const VisibleSet& visible_set) const {
 		constexpr bool transparency = false;
 
 		// Bind the fixed opaque state.
@@ -299,24 +230,12 @@ namespace mage::rendering {
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(visible_set.GetModels(ModelBucket::OpaqueEmissive));
 	}
 
-	void XM_CALLCONV ForwardPass::RenderTransparent(const World& world,
-													FXMMATRIX world_to_projection,
-													BRDF brdf,
-													bool vct) const {
+	void ForwardPass::RenderTransparent(const VisibleSet& visible_set,
+										BRDF brdf,
+										bool vct) const {
 		// Bind the fixed transparent state.
 		BindFixedTransparentState();
 
@@ -333,19 +252,7 @@ namespace mage::rendering {
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(visible_set.GetModels(ModelBucket::TransparentEmissive));
 
 		//---------------------------------------------------------------------
 		// All transparent models with no TSNM.
@@ -359,20 +266,7 @@ namespace mage::rendering {
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(visible_set.GetModels(ModelBucket::Transparent));
 
 		//---------------------------------------------------------------------
 		// All transparent models with TSNM.
@@ -386,25 +280,11 @@ namespace mage::rendering {
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(visible_set.GetModels(ModelBucket::TransparentTSNM));
 	}
 
-	void XM_CALLCONV ForwardPass::RenderFalseColor(const World& world,
-												   FXMMATRIX world_to_projection,
-												   FalseColor false_color) const {
+	void ForwardPass::RenderFalseColor(const VisibleSet& visible_set,
+									   FalseColor false_color) const {
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -423,17 +303,10 @@ namespace mage::rendering {
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(visible_set.GetModels());
 	}
 
-	void XM_CALLCONV ForwardPass::RenderWireframe(const World& world,
-												  FXMMATRIX world_to_projection) {
+	void ForwardPass::RenderWireframe(const VisibleSet& visible_set) {
 		// Bind the fixed opaque state.
 		BindFixedWireframeState();
 
@@ -452,28 +325,17 @@ namespace mage::rendering {
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		Render(visible_set.GetModels());
 	}
 
-	void XM_CALLCONV ForwardPass::Render(const Model& model,
-										 FXMMATRIX world_to_projection) const noexcept {
-
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
-
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
-			return;
+	void ForwardPass::Render(gsl::span< const Model* const > models) const noexcept {
+		for (const auto model : models) {
+			Render(*model);
 		}
+	}
 
-		const auto& material             = model.GetMaterial();
+	void ForwardPass::Render(const Model& model) const noexcept {
+		const auto& material = model.GetMaterial();
 
 		// Bind the constant buffer of the model.
 		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
@@ -8,7 +8,7 @@
 #include "renderer\configuration.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
-#include "scene\rendering_world.hpp"
+#include "renderer\visible_set.hpp"
 
 #pragma endregion
 
@@ -97,110 +97,89 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Renders the given world.
+		 Renders the opaque models of the given visible set.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		visible_set
+						A reference to the visible set of the camera.
 		 @param[in]		brdf
 						The BRDF.
 		 @param[in]		vct
 						@c true if voxel cone tracing should be enabled. @c false
 						otherwise.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the visible set.
 		 */
-		void XM_CALLCONV Render(const World& world,
-								FXMMATRIX world_to_projection,
-								BRDF brdf, bool vct) const;
+		void Render(const VisibleSet& visible_set,
+					BRDF brdf, bool vct) const;
 
 		/**
-		 Renders the given world as solid.
+		 Renders the models of the given visible set as solid.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		visible_set
+						A reference to the visible set of the camera.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the visible set.
 		 */
-		void XM_CALLCONV RenderSolid(const World& world,
-									 FXMMATRIX world_to_projection) const;
+		void RenderSolid(const VisibleSet& visible_set) const;
 
 		/**
-		 Renders the given world to a GBuffer.
+		 Renders the opaque models of the given visible set to a GBuffer.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		visible_set
+						A reference to the visible set of the camera.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the visible set.
 		 */
-		void XM_CALLCONV RenderGBuffer(const World& world,
-									   FXMMATRIX world_to_projection) const;
+		void RenderGBuffer(const VisibleSet& visible_set) const;
 
 		/**
-		 Renders the emissive models of the given world.
+		 Renders the opaque emissive models of the given visible set.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		visible_set
+						A reference to the visible set of the camera.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the visible set.
 		 */
-		void XM_CALLCONV RenderEmissive(const World& world,
-										FXMMATRIX world_to_projection) const;
+		void RenderEmissive(const VisibleSet& visible_set) const;
 
 		/**
-		 Renders the transparent models of the given world.
+		 Renders the transparent models of the given visible set.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		visible_set
+						A reference to the visible set of the camera.
 		 @param[in]		brdf
 						The BRDF.
 		 @param[in]		vct
 						@c true if voxel cone tracing should be enabled. @c false
 						otherwise.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the visible set.
 		 */
-		void XM_CALLCONV RenderTransparent(const World& world,
-										   FXMMATRIX world_to_projection,
-										   BRDF brdf, bool vct) const;
+		void RenderTransparent(const VisibleSet& visible_set,
+							   BRDF brdf, bool vct) const;
 
 		/**
-		 Renders the given world as a false color.
+		 Renders the models of the given visible set as a false color.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		visible_set
+						A reference to the visible set of the camera.
 		 @param[in]		false_color
 						The false color.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the visible set.
 		 */
-		void XM_CALLCONV RenderFalseColor(const World& world,
-										  FXMMATRIX world_to_projection,
-										  FalseColor false_color) const;
+		void RenderFalseColor(const VisibleSet& visible_set,
+							  FalseColor false_color) const;
 
 		/**
-		 Renders the given world as a wireframe.
+		 Renders the models of the given visible set as a wireframe.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		visible_set
+						A reference to the visible set of the camera.
 		 @throws		Exception
-						Failed to render the world.
+						Failed to render the visible set.
 		 */
-		void XM_CALLCONV RenderWireframe(const World& world,
-										 FXMMATRIX world_to_projection);
+		void RenderWireframe(const VisibleSet& visible_set);
 
 	private:
 
@@ -233,16 +212,21 @@ namespace mage::rendering {
 		 */
 		void BindColor(const RGBA& color);
 
+		/**
+		 Renders the given models.
+
+		 @param[in]		models
+						The (visible) models.
+		 */
+		void Render(gsl::span< const Model* const > models) const noexcept;
+
 		/**
 		 Renders the given model.
 
 		 @param[in]		model
-						A reference to the model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+						A reference to the (visible) model.
 		 */
-		void XM_CALLCONV Render(const Model& model,
-								FXMMATRIX world_to_projection) const noexcept;
+		void Render(const Model& model) const noexcept;
 
 		//---------------------------------------------------------------------
 		// Member Variables
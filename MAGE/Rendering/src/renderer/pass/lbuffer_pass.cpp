@@ -46,6 +46,7 @@ namespace mage::rendering {
 
 	void XM_CALLCONV LBufferPass
 		::Render(const World& world,
+				 const VisibleSet& visible_set,
 				 FXMMATRIX world_to_projection) {
 
 		// Process the lights.
@@ -58,7 +59,7 @@ namespace mage::rendering {
 		// Setup the shadow maps.
 		SetupShadowMaps();
 		// Render the shadow maps.
-		RenderShadowMaps(world);
+		RenderShadowMaps(visible_set);
 
 		// Process the lights' data.
 		ProcessLightsData(world);
@@ -412,7 +413,7 @@ namespace mage::rendering {
 		}
 	}
 
-	void XM_CALLCONV LBufferPass::RenderShadowMaps(const World& world) {
+	void LBufferPass::RenderShadowMaps(const VisibleSet& visible_set) {
 		// Bind the fixed state.
 		m_depth_pass->BindFixedState();
 
@@ -429,7 +430,7 @@ namespace mage::rendering {
 				m_directional_sms->BindDSV(m_device_context, i++);
 
 				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world,
+				m_depth_pass->RenderOccluders(visible_set,
 											  camera.world_to_light,
 											  camera.light_to_projection);
 			}
@@ -448,7 +449,7 @@ namespace mage::rendering {
 				m_omni_sms->BindDSV(m_device_context, i++);
 
 				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world,
+				m_depth_pass->RenderOccluders(visible_set,
 											  camera.world_to_light,
 											  camera.light_to_projection);
 			}
@@ -467,7 +468,7 @@ namespace mage::rendering {
 				m_spot_sms->BindDSV(m_device_context, i++);
 
 				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world,
+				m_depth_pass->RenderOccluders(visible_set,
 											  camera.world_to_light,
 											  camera.light_to_projection);
 			}
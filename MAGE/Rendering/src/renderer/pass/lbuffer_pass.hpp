@@ -57,6 +57,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		void XM_CALLCONV Render(const World& world,
+			                    const VisibleSet& visible_set,
 			                    FXMMATRIX world_to_projection);
 
 	private:
@@ -79,7 +80,7 @@ namespace mage::rendering {
 
 		void SetupShadowMaps();
 
-		void XM_CALLCONV RenderShadowMaps(const World& world);
+		void RenderShadowMaps(const VisibleSet& visible_set);
 
 		//---------------------------------------------------------------------
 		// Member Variables
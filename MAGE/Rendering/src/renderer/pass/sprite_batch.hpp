@@ -6,7 +6,7 @@
 #pragma region
 
 #include "direct3d11.hpp"
-#include "transform\transform.hpp"
+#include "transform/transform.hpp"
 
 #pragma endregion
 
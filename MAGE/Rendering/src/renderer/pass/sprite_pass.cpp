@@ -84,4 +84,18 @@ namespace mage::rendering {
 
 		m_sprite_batch.End();
 	}
+
+	void SpritePass::Render(ID3D11ShaderResourceView* texture,
+							const SpriteTransform2D& transform) {
+		// Bind the fixed state.
+		BindFixedState();
+
+		m_sprite_batch.Begin();
+
+		// Draw the texture.
+		m_sprite_batch.Draw(texture, XMVectorSet(1.0f, 1.0f, 1.0f, 1.0f),
+							SpriteEffect::None, transform);
+
+		m_sprite_batch.End();
+	}
 }
\ No newline at end of file
@@ -103,6 +103,20 @@ namespace mage::rendering {
 		 */
 		void Render(const World& world);
 
+		/**
+		 Renders the given texture.
+
+		 @param[in]		texture
+						A pointer to the shader resource view of the texture to
+						render.
+		 @param[in]		transform
+						A reference to the sprite transform.
+		 @throws		Exception
+						Failed to render the texture.
+		 */
+		void Render(ID3D11ShaderResourceView* texture,
+					const SpriteTransform2D& transform);
+
 	private:
 
 		//---------------------------------------------------------------------
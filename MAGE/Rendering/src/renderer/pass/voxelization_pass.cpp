@@ -199,7 +199,7 @@ namespace mage::rendering {
 		const auto  object_to_projection = object_to_world * world_to_projection;
 
 		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
+		if (BoundingFrustum::Cull(object_to_projection, model.GetOBB())) {
 			return;
 		}
 
@@ -220,8 +220,9 @@ namespace mage::rendering {
 							   static_cast< U32 >(std::size(srvs)), srvs);
 		// Bind the mesh of the model.
 		model.BindMesh(m_device_context);
-		// Draw the model.
-		model.Draw(m_device_context);
+		// Draw the full detail of the model (including the mesh clusters culled
+		// for the camera).
+		model.Draw(m_device_context, false);
 	}
 
 	void VoxelizationPass::Dispatch() const noexcept {
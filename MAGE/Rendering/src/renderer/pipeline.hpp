@@ -6,7 +6,7 @@
 #pragma region
 
 #include "direct3d11.hpp"
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -4,7 +4,9 @@
 #pragma region
 
 #include "renderer\renderer.hpp"
+#include "renderer\occlusion_culler.hpp"
 #include "renderer\output_manager.hpp"
+#include "renderer\visible_set.hpp"
 #include "renderer\pass\aa_pass.hpp"
 #include "renderer\pass\back_buffer_pass.hpp"
 #include "renderer\pass\bounding_volume_pass.hpp"
@@ -25,6 +27,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <optional>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -160,10 +171,7 @@ namespace mage::rendering {
 									 const Camera& camera,
 									 FXMMATRIX world_to_projection);
 
-		void XM_CALLCONV RenderFalseColor(const World& world,
-										  const Camera& camera,
-										  FXMMATRIX world_to_projection,
-										  FalseColor false_color);
+		void RenderFalseColor(const Camera& camera, FalseColor false_color);
 
 		void XM_CALLCONV RenderVoxelGrid(const World& world,
 										 const Camera& camera,
@@ -173,6 +181,8 @@ namespace mage::rendering {
 
 		void RenderPostProcessing(const Camera& camera);
 
+		void RenderOcclusionBuffer();
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -207,6 +217,33 @@ namespace mage::rendering {
 		 */
 		UniquePtr< StateManager > m_state_manager;
 
+		//---------------------------------------------------------------------
+		// Member Variables: Occlusion Culling
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the occlusion culler of this renderer.
+		 */
+		UniquePtr< OcclusionCuller > m_occlusion_culler;
+
+		/**
+		 The active models inside the view frustum of the current camera of
+		 this renderer.
+		 */
+		std::vector< const Model* > m_models;
+
+		/**
+		 The visible set of the current camera of this renderer, shared by
+		 all passes rendering the models of this camera.
+		 */
+		VisibleSet m_visible_set;
+
+		/**
+		 The viewport of the camera whose occlusion buffer needs to be
+		 rendered by this renderer (if any).
+		 */
+		std::optional< Viewport > m_occlusion_buffer_viewport;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Buffers
 		//---------------------------------------------------------------------
@@ -294,6 +331,10 @@ namespace mage::rendering {
 													 display_configuration,
 													 swap_chain)),
 		m_state_manager(MakeUnique< StateManager >(device)),
+		m_occlusion_culler(MakeUnique< OcclusionCuller >(device)),
+		m_models(),
+		m_visible_set(),
+		m_occlusion_buffer_viewport(),
 		m_world_buffer(device),
 		m_aa_pass(),
 		m_back_buffer_pass(),
@@ -386,6 +427,8 @@ namespace mage::rendering {
 
 		m_output_manager->BindBegin(m_device_context);
 
+		m_occlusion_buffer_viewport.reset();
+
 		// Render the world for each camera.
 		world.ForEach< Camera >([this, &world](const Camera& camera) {
 			if (State::Active != camera.GetState()) {
@@ -408,6 +451,11 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		m_sprite_pass->Render(world);
 
+		//---------------------------------------------------------------------
+		// Occlusion Buffer
+		//---------------------------------------------------------------------
+		RenderOcclusionBuffer();
+
 		// GUI
 		ImGui::Render();
 		ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
@@ -504,6 +552,46 @@ namespace mage::rendering {
 
 		const auto  render_mode          = camera.GetSettings().GetRenderMode();
 
+		// Select the level of detail and cull the mesh clusters of each model
+		// inside the view frustum of the camera. The model tree of the world
+		// skips (complete subtrees of) models outside the view frustum, and
+		// the potentially visible set of the world skips models which are not
+		// visible from the cell containing the camera.
+		m_models.clear();
+		const BoundingFrustum frustum(world_to_projection);
+		world.ForEachPotentiallyVisible< Model >(transform.GetWorldOrigin(), frustum,
+			[this, world_to_camera, camera_to_projection](const Model& model) {
+				if (State::Active == model.GetState()) {
+					model.SelectLOD(world_to_camera, camera_to_projection);
+					model.CullClusters(world_to_camera, camera_to_projection);
+					m_models.push_back(&model);
+				}
+			}
+		);
+
+		// Cull the models inside the view frustum of the camera against the
+		// largest occluders among them.
+		if (camera.GetSettings().UsesOcclusionCulling()) {
+			const Viewport viewport(camera.GetViewport(),
+									m_display_configuration.get().GetAA());
+
+			m_occlusion_culler->Cull(m_models, world_to_camera,
+									 camera_to_projection, viewport.GetSize());
+
+			if (camera.GetSettings().ContainsRenderLayer(RenderLayer::OcclusionBuffer)) {
+				m_occlusion_culler->UpdateDebugTexture(m_device_context);
+				m_occlusion_buffer_viewport = camera.GetViewport();
+			}
+		}
+		else {
+			for (const auto model : m_models) {
+				model->CullOcclusion(nullptr, world_to_projection);
+			}
+		}
+
+		// Cull and classify the models once for all passes.
+		m_visible_set.Update(world, m_models, world_to_projection);
+
 		m_output_manager->BindBeginViewport(m_device_context);
 
 		//---------------------------------------------------------------------
@@ -532,88 +620,71 @@ namespace mage::rendering {
 		}
 
 		case RenderMode::FalseColor_BaseColor: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::BaseColor);
+			RenderFalseColor(camera, FalseColor::BaseColor);
 			break;
 		}
 		case RenderMode::FalseColor_BaseColorCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::BaseColorCoefficient);
+			RenderFalseColor(camera, FalseColor::BaseColorCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_BaseColorTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::BaseColorTexture);
+			RenderFalseColor(camera, FalseColor::BaseColorTexture);
 			break;
 		}
 		case RenderMode::FalseColor_Material: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Material);
+			RenderFalseColor(camera, FalseColor::Material);
 			break;
 		}
 		case RenderMode::FalseColor_MaterialCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MaterialCoefficient);
+			RenderFalseColor(camera, FalseColor::MaterialCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_MaterialTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MaterialTexture);
+			RenderFalseColor(camera, FalseColor::MaterialTexture);
 			break;
 		}
 		case RenderMode::FalseColor_Roughness: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Roughness);
+			RenderFalseColor(camera, FalseColor::Roughness);
 			break;
 		}
 		case RenderMode::FalseColor_RoughnessCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::RoughnessCoefficient);
+			RenderFalseColor(camera, FalseColor::RoughnessCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_RoughnessTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::RoughnessTexture);
+			RenderFalseColor(camera, FalseColor::RoughnessTexture);
 			break;
 		}
 		case RenderMode::FalseColor_Metalness: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Metalness);
+			RenderFalseColor(camera, FalseColor::Metalness);
 			break;
 		}
 		case RenderMode::FalseColor_MetalnessCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MetalnessCoefficient);
+			RenderFalseColor(camera, FalseColor::MetalnessCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_MetalnessTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MetalnessTexture);
+			RenderFalseColor(camera, FalseColor::MetalnessTexture);
 			break;
 		}
 		case RenderMode::FalseColor_ShadingNormal: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::ShadingNormal);
+			RenderFalseColor(camera, FalseColor::ShadingNormal);
 			break;
 		}
 		case RenderMode::FalseColor_TSNMShadingNormal: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::TSNMShadingNormal);
+			RenderFalseColor(camera, FalseColor::TSNMShadingNormal);
 			break;
 		}
 		case RenderMode::FalseColor_Depth: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Depth);
+			RenderFalseColor(camera, FalseColor::Depth);
 			break;
 		}
 		case RenderMode::FalseColor_Distance: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Distance);
+			RenderFalseColor(camera, FalseColor::Distance);
 			break;
 		}
 		case RenderMode::FalseColor_UV: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::UV);
+			RenderFalseColor(camera, FalseColor::UV);
 			break;
 		}
 
@@ -633,7 +704,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		const auto& settings = camera.GetSettings();
 		if (settings.ContainsRenderLayer(RenderLayer::Wireframe)) {
-			m_forward_pass->RenderWireframe(world, world_to_projection);
+			m_forward_pass->RenderWireframe(m_visible_set);
 		}
 		if (settings.ContainsRenderLayer(RenderLayer::AABB)) {
 			m_bounding_volume_pass->Render(world, world_to_projection);
@@ -666,7 +737,7 @@ namespace mage::rendering {
 				= VoxelizationSettings::GetWorldToVoxelMatrix();
 
 			// TODO: world_to_projection + world_to_voxel for culling
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(world, m_visible_set, world_to_projection);
 
 			const auto voxel_grid_resolution
 				= VoxelizationSettings::GetVoxelGridResolution();
@@ -675,7 +746,7 @@ namespace mage::rendering {
 										voxel_grid_resolution);
 		}
 		else {
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(world, m_visible_set, world_to_projection);
 		}
 
 		const Viewport viewport(camera.GetViewport(),
@@ -690,13 +761,13 @@ namespace mage::rendering {
 			const auto& transform            = camera.GetOwner()->GetTransform();
 			const auto  world_to_camera      = transform.GetWorldToObjectMatrix();
 			const auto  camera_to_projection = camera.GetCameraToProjectionMatrix();
-			m_depth_pass->Render(world, world_to_camera, camera_to_projection);
+			m_depth_pass->Render(m_visible_set, world_to_camera, camera_to_projection);
 		}
 
 		//---------------------------------------------------------------------
 		// Forward: opaque fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->Render(world, world_to_projection,
+		m_forward_pass->Render(m_visible_set,
 							   camera.GetSettings().GetBRDF(), vct);
 
 		//---------------------------------------------------------------------
@@ -707,7 +778,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward: transparent fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderTransparent(world, world_to_projection,
+		m_forward_pass->RenderTransparent(m_visible_set,
 										  camera.GetSettings().GetBRDF(), vct);
 	}
 
@@ -725,7 +796,7 @@ namespace mage::rendering {
 				= VoxelizationSettings::GetWorldToVoxelMatrix();
 
 			// TODO: world_to_projection + world_to_voxel for culling
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(world, m_visible_set, world_to_projection);
 
 			const auto voxel_grid_resolution
 				= VoxelizationSettings::GetVoxelGridResolution();
@@ -734,7 +805,7 @@ namespace mage::rendering {
 										voxel_grid_resolution);
 		}
 		else {
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(world, m_visible_set, world_to_projection);
 		}
 
 		const Viewport viewport(camera.GetViewport(),
@@ -745,7 +816,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// GBuffer: opaque fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderGBuffer(world, world_to_projection);
+		m_forward_pass->RenderGBuffer(m_visible_set);
 
 		m_output_manager->BindEndGBuffer(m_device_context);
 		m_output_manager->BindBeginDeferred(m_device_context);
@@ -767,7 +838,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward: emissive fragments.
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderEmissive(world, world_to_projection);
+		m_forward_pass->RenderEmissive(m_visible_set);
 
 		//---------------------------------------------------------------------
 		// Perform a sky pass.
@@ -777,7 +848,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward: transparent fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderTransparent(world, world_to_projection,
+		m_forward_pass->RenderTransparent(m_visible_set,
 										  camera.GetSettings().GetBRDF(), vct);
 	}
 
@@ -788,7 +859,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// LBuffer
 		//---------------------------------------------------------------------
-		m_lbuffer_pass->Render(world, world_to_projection);
+		m_lbuffer_pass->Render(world, m_visible_set, world_to_projection);
 
 		const Viewport viewport(camera.GetViewport(),
 								m_display_configuration.get().GetAA());
@@ -798,13 +869,11 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderSolid(world, world_to_projection);
+		m_forward_pass->RenderSolid(m_visible_set);
 	}
 
-	void XM_CALLCONV Renderer::Impl::RenderFalseColor(const World& world,
-													  const Camera& camera,
-													  FXMMATRIX world_to_projection,
-													  FalseColor false_color) {
+	void Renderer::Impl::RenderFalseColor(const Camera& camera,
+										  FalseColor false_color) {
 
 		const Viewport viewport(camera.GetViewport(),
 								m_display_configuration.get().GetAA());
@@ -814,7 +883,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderFalseColor(world, world_to_projection, false_color);
+		m_forward_pass->RenderFalseColor(m_visible_set, false_color);
 	}
 
 	void XM_CALLCONV Renderer::Impl::RenderVoxelGrid(const World& world,
@@ -824,7 +893,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// LBuffer
 		//---------------------------------------------------------------------
-		m_lbuffer_pass->Render(world, world_to_projection);
+		m_lbuffer_pass->Render(world, m_visible_set, world_to_projection);
 
 		//---------------------------------------------------------------------
 		// Voxelization
@@ -919,6 +988,24 @@ namespace mage::rendering {
 		}
 	}
 
+	void Renderer::Impl::RenderOcclusionBuffer() {
+		const auto srv = m_occlusion_culler->GetDebugSRV();
+		if (!m_occlusion_buffer_viewport || nullptr == srv) {
+			return;
+		}
+
+		// Draw the occlusion buffer in the top left corner of the viewport
+		// with a quarter of the viewport width.
+		const auto& viewport = *m_occlusion_buffer_viewport;
+		const auto  scale    = viewport.GetSize()[0]
+			                 / (4.0f * m_occlusion_culler->GetBuffer().GetWidth());
+		const SpriteTransform2D transform(F32x2(viewport.GetTopLeft()), 0.0f,
+										  0.0f, { 0.0f, 0.0f },
+										  { scale, scale });
+
+		m_sprite_pass->Render(srv, transform);
+	}
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -0,0 +1,99 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\visible_set.hpp"
+
+// Include HLSL bindings.
+#include "hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	VisibleSet::VisibleSet()
+		: m_models(),
+		m_buckets() {}
+
+	VisibleSet::VisibleSet(VisibleSet&& visible_set) noexcept = default;
+
+	VisibleSet::~VisibleSet() = default;
+
+	VisibleSet& VisibleSet::operator=(VisibleSet&& visible_set) noexcept = default;
+
+	void XM_CALLCONV VisibleSet::Update(const World& world,
+										gsl::span< const Model* const > models,
+										FXMMATRIX world_to_projection) {
+		// Clear the buckets (without releasing their memory).
+		m_models.clear();
+		for (auto& bucket : m_buckets) {
+			bucket.clear();
+		}
+
+		// Cull the models once for all passes.
+		for (const auto model : models) {
+			if (model->IsOcclusionCulled()) {
+				continue;
+			}
+
+			const auto& transform            = model->GetOwner()->GetTransform();
+			const auto  object_to_world      = transform.GetObjectToWorldMatrix();
+			const auto  object_to_projection = object_to_world * world_to_projection;
+
+			// Apply view frustum culling.
+			if (BoundingFrustum::Cull(object_to_projection, model->GetOBB())) {
+				continue;
+			}
+
+			AddVisible(*model);
+		}
+
+		// Collect the light occluders once for all shadow maps.
+		world.ForEach< Model >([this](const Model& model) {
+			if (State::Active == model.GetState() && model.OccludesLight()) {
+				AddLightOccluder(model);
+			}
+		});
+	}
+
+	void VisibleSet::AddVisible(const Model& model) {
+		m_models.push_back(&model);
+
+		const auto& material = model.GetMaterial();
+		const auto  alpha    = material.GetBaseColor()[3];
+		const auto  tsnm     = nullptr != material.GetNormalSRV();
+
+		if (TRANSPARENCY_THRESHOLD <= alpha) {
+			const auto bucket = material.IsEmissive() ? ModelBucket::OpaqueEmissive
+				              : tsnm                  ? ModelBucket::OpaqueTSNM
+				                                      : ModelBucket::Opaque;
+			GetBucket(bucket).push_back(&model);
+		}
+
+		if (!material.IsTransparant()) {
+			GetBucket(ModelBucket::DepthOpaque).push_back(&model);
+		}
+		else if (TRANSPARENCY_SHADOW_THRESHOLD <= alpha) {
+			const auto bucket = material.IsEmissive() ? ModelBucket::TransparentEmissive
+				              : tsnm                  ? ModelBucket::TransparentTSNM
+				                                      : ModelBucket::Transparent;
+			GetBucket(bucket).push_back(&model);
+			GetBucket(ModelBucket::DepthTransparent).push_back(&model);
+		}
+	}
+
+	void VisibleSet::AddLightOccluder(const Model& model) {
+		const auto& material = model.GetMaterial();
+
+		if (!material.IsTransparant()) {
+			GetBucket(ModelBucket::LightOccluderOpaque).push_back(&model);
+		}
+		else if (TRANSPARENCY_SHADOW_THRESHOLD <= material.GetBaseColor()[3]) {
+			GetBucket(ModelBucket::LightOccluderTransparent).push_back(&model);
+		}
+	}
+}
@@ -0,0 +1,217 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\rendering_world.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 An enumeration of the different model buckets of a visible set.
+
+	 This contains:
+	 @c Opaque,
+	 @c OpaqueTSNM,
+	 @c OpaqueEmissive,
+	 @c Transparent,
+	 @c TransparentTSNM,
+	 @c TransparentEmissive,
+	 @c DepthOpaque,
+	 @c DepthTransparent,
+	 @c LightOccluderOpaque and
+	 @c LightOccluderTransparent.
+	 */
+	enum class ModelBucket : U8 {
+		Opaque = 0,               // Non-emissive opaque models without TSNM.
+		OpaqueTSNM,               // Non-emissive opaque models with TSNM.
+		OpaqueEmissive,           // Emissive opaque models.
+		Transparent,              // Non-emissive transparent models without TSNM.
+		TransparentTSNM,          // Non-emissive transparent models with TSNM.
+		TransparentEmissive,      // Emissive transparent models.
+		DepthOpaque,              // Models with an opaque material.
+		DepthTransparent,         // Models with a transparent material.
+		LightOccluderOpaque,      // Light occluders with an opaque material.
+		LightOccluderTransparent, // Light occluders with a transparent material.
+		Count
+	};
+
+	/**
+	 A class of visible sets containing the models visible to a camera.
+
+	 A visible set is computed once per camera, after which all passes
+	 rendering the camera consume the same (view frustum and occlusion)
+	 culled models, classified into buckets by the shaders they need. A
+	 model can be contained in multiple buckets.
+
+	 The light occluder buckets contain all active models occluding light,
+	 independent of the camera, since these models can cast shadows into
+	 the view frustum of the camera from outside of it.
+	 */
+	class VisibleSet {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a visible set.
+		 */
+		VisibleSet();
+
+		/**
+		 Constructs a visible set from the given visible set.
+
+		 @param[in]		visible_set
+						A reference to the visible set to copy.
+		 */
+		VisibleSet(const VisibleSet& visible_set) = delete;
+
+		/**
+		 Constructs a visible set by moving the given visible set.
+
+		 @param[in]		visible_set
+						A reference to the visible set to move.
+		 */
+		VisibleSet(VisibleSet&& visible_set) noexcept;
+
+		/**
+		 Destructs this visible set.
+		 */
+		~VisibleSet();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given visible set to this visible set.
+
+		 @param[in]		visible_set
+						A reference to the visible set to copy.
+		 @return		A reference to the copy of the given visible set (i.e.
+						this visible set).
+		 */
+		VisibleSet& operator=(const VisibleSet& visible_set) = delete;
+
+		/**
+		 Moves the given visible set to this visible set.
+
+		 @param[in]		visible_set
+						A reference to the visible set to move.
+		 @return		A reference to the moved visible set (i.e. this
+						visible set).
+		 */
+		VisibleSet& operator=(VisibleSet&& visible_set) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Updates this visible set.
+
+		 @param[in]		world
+						A reference to the world.
+		 @param[in]		models
+						The active models inside the view frustum of the
+						camera, after their occlusion culling.
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix of the
+						camera.
+		 */
+		void XM_CALLCONV Update(const World& world,
+								gsl::span< const Model* const > models,
+								FXMMATRIX world_to_projection);
+
+		/**
+		 Returns the visible models of this visible set.
+
+		 @return		The visible models of this visible set.
+		 */
+		[[nodiscard]]
+		gsl::span< const Model* const > GetModels() const noexcept {
+			return gsl::make_span(m_models);
+		}
+
+		/**
+		 Returns the models of the given bucket of this visible set.
+
+		 @param[in]		bucket
+						The model bucket.
+		 @return		The models of the given bucket of this visible set.
+		 */
+		[[nodiscard]]
+		gsl::span< const Model* const > GetModels(ModelBucket bucket) const noexcept {
+			return gsl::make_span(m_buckets[static_cast< std::size_t >(bucket)]);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Adds the given visible model to the buckets of this visible set.
+
+		 @param[in]		model
+						A reference to the visible model.
+		 */
+		void AddVisible(const Model& model);
+
+		/**
+		 Adds the given light occluder to the buckets of this visible set.
+
+		 @param[in]		model
+						A reference to the light occluder.
+		 */
+		void AddLightOccluder(const Model& model);
+
+		/**
+		 Returns the models of the given bucket of this visible set.
+
+		 @param[in]		bucket
+						The model bucket.
+		 @return		A reference to the models of the given bucket of
+						this visible set.
+		 */
+		[[nodiscard]]
+		std::vector< const Model* >& GetBucket(ModelBucket bucket) noexcept {
+			return m_buckets[static_cast< std::size_t >(bucket)];
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The visible models of this visible set.
+		 */
+		std::vector< const Model* > m_models;
+
+		/**
+		 The model buckets of this visible set.
+		 */
+		std::vector< const Model* > m_buckets[
+			static_cast< std::size_t >(ModelBucket::Count)];
+	};
+}
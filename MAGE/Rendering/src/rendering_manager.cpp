@@ -379,7 +379,10 @@ namespace mage::rendering {
 	void Manager::Impl::Render(const GameTime& time) {
 		m_swap_chain->Clear();
 		Pipeline::s_nb_draws = 0u;
-		m_renderer->Render(GetWorld(), time);
+
+		auto& world = GetWorld();
+		world.UpdateModelTree();
+		m_renderer->Render(world, time);
 
 		m_swap_chain->Present();
 	}
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "spectrum\color.hpp"
+#include "spectrum/color.hpp"
 
 #pragma endregion
 
@@ -108,6 +108,16 @@ namespace mage::rendering {
 			return NotNull< const_wzstring >(m_str.c_str());
 		}
 
+		/**
+		 Returns the string of this color string.
+
+		 @return		A reference to the string of this color string.
+		 */
+		[[nodiscard]]
+		std::wstring& GetString() noexcept {
+			return m_str;
+		}
+
 		/**
 		 Returns the string of this color string.
 
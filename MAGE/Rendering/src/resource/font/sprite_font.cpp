@@ -14,6 +14,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include <algorithm>
 #include <limits>
 
 #pragma endregion
@@ -27,6 +28,17 @@ namespace mage::rendering {
 	// GlyphLessThan
 	//-------------------------------------------------------------------------
 	namespace {
+
+		/**
+		 The index of the glyph table entries of characters without a glyph.
+		 */
+		constexpr U32 g_no_glyph = std::numeric_limits< U32 >::max();
+
+		/**
+		 The number of characters of the Basic Multilingual Plane.
+		 */
+		constexpr std::size_t g_nb_bmp_characters = 0x10000u;
+
 		/**
 		 A struct of glyph "less than" comparators.
 		 */
@@ -100,6 +112,7 @@ namespace mage::rendering {
 		: Resource< SpriteFont >(std::move(fname)),
 		m_texture_srv(),
 		m_glyphs(),
+		m_glyph_table(),
 		m_default_glyph(nullptr),
 		m_line_spacing(0.0f) {
 
@@ -124,6 +137,22 @@ namespace mage::rendering {
 			                               GlyphLessThan());
 		ThrowIfFailed(sorted, "Sprite font glyphs are not sorted.");
 
+		// Build the glyph table for the Basic Multilingual Plane.
+		std::size_t table_size = 0u;
+		for (const auto& glyph : m_glyphs) {
+			if (glyph.m_character < g_nb_bmp_characters) {
+				table_size = glyph.m_character + 1u;
+			}
+		}
+
+		m_glyph_table.assign(table_size, g_no_glyph);
+		for (std::size_t i = 0u; i < m_glyphs.size(); ++i) {
+			const auto character = m_glyphs[i].m_character;
+			if (character < table_size) {
+				m_glyph_table[character] = static_cast< U32 >(i);
+			}
+		}
+
 		SetLineSpacing(output.m_line_spacing);
 		SetDefaultCharacter(output.m_default_character);
 
@@ -136,6 +165,18 @@ namespace mage::rendering {
 		                      SpriteEffect effects,
 		                      const RGBA* color) const {
 
+		TextLayout layout;
+		LayoutText(strings, layout);
+		DrawText(sprite_batch, layout, strings, transform, effects, color);
+	}
+
+	void SpriteFont::DrawText(SpriteBatch& sprite_batch,
+							  const TextLayout& layout,
+							  gsl::span< const ColorString > strings,
+		                      const SpriteTransform2D& transform,
+		                      SpriteEffect effects,
+		                      const RGBA* color) const {
+
 		static_assert(static_cast< U8 >(SpriteEffect::MirrorX) == 1u &&
 			          static_cast< U8 >(SpriteEffect::MirrorY) == 2u,
 			          "The following tables must be updated to match");
@@ -156,15 +197,51 @@ namespace mage::rendering {
 
 		const auto index = static_cast< std::size_t >(effects) & 3u;
 
+		// The size of the text is part of the layout (no re-measuring).
 		const auto base_offset = (SpriteEffect::None == effects)
 			                   ? transform.GetRotationOrigin()
 			                   : transform.GetRotationOrigin()
-			                     - MeasureText(strings)
+			                     - XMLoad(layout.m_size)
 			                     * axis_is_mirrored_table[index];
+		const auto& flip   = axis_direction_table[index];
+		const auto& mirror = axis_is_mirrored_table[index];
+		const auto  srgba  = (color) ? XMLoad(*color) : XMVectorZero();
+
+		SpriteTransform2D sprite_transform(transform);
+
+		for (const auto& text_glyph : layout.m_glyphs) {
+			const auto glyph = text_glyph.m_glyph;
+			auto offset = XMVectorMultiplyAdd(XMLoad(text_glyph.m_position),
+											  flip, base_offset);
+
+			if (SpriteEffect::None != effects) {
+				// Left Top Right Bottom
+				auto glyph_rect = XMVectorLeftTopRightBottom(glyph->m_sub_rectangle);
+				// Width Height -Width -Height
+				glyph_rect = XMVectorSwizzle< 2, 3, 0, 1 >(glyph_rect) - glyph_rect;
+				offset = XMVectorMultiplyAdd(glyph_rect, mirror, offset);
+			}
+
+			sprite_transform.SetRotationOrigin(offset);
+
+			const auto& str = strings[static_cast< std::ptrdiff_t >(
+				                  text_glyph.m_string_index)];
+
+			sprite_batch.Draw(m_texture_srv.Get(),
+				              (color) ? srgba : XMLoad(str.GetColor()),
+				              effects,
+				              sprite_transform,
+				              &glyph->m_sub_rectangle);
+		}
+	}
+
+	void SpriteFont::LayoutText(gsl::span< const ColorString > strings,
+								TextLayout& layout) const {
+		layout.clear();
 
 		auto x = 0.0f;
 		auto y = 0.0f;
-		SpriteTransform2D sprite_transform(transform);
+		U32 string_index = 0u;
 
 		for (const auto& str : strings) {
 			for (auto character : str.GetString()) {
@@ -187,29 +264,12 @@ namespace mage::rendering {
 					const auto width  = static_cast< F32 >(glyph->GetWidth());
 					const auto height = static_cast< F32 >(glyph->GetHeight());
 					if (!iswspace(character) || width > 1.0f || height > 1.0f) {
-						const XMVECTOR top_left = { x, y + glyph->m_offset[1], 0.0f, 0.0f };
-						const auto& flip        = axis_direction_table[index];
-						auto offset = XMVectorMultiplyAdd(top_left, flip, base_offset);
-
-						if (SpriteEffect::None != effects) {
-							// Left Top Right Bottom
-							auto glyph_rect = XMVectorLeftTopRightBottom(glyph->m_sub_rectangle);
-							// Width Height -Width -Height
-							glyph_rect = XMVectorSwizzle< 2, 3, 0, 1 >(glyph_rect) - glyph_rect;
-							const auto& mirror = axis_is_mirrored_table[index];
-							offset = XMVectorMultiplyAdd(glyph_rect, mirror, offset);
-						}
-
-						sprite_transform.SetRotationOrigin(offset);
-
-						const auto srgba = (color) ? XMLoad(*color)
-							                       : XMLoad(str.GetColor());
-
-						sprite_batch.Draw(m_texture_srv.Get(),
-							              srgba,
-							              effects,
-							              sprite_transform,
-							              &glyph->m_sub_rectangle);
+						layout.m_glyphs.push_back({
+							F32x2(x, y + glyph->m_offset[1]), glyph, string_index });
+
+						layout.m_size[0] = std::max(layout.m_size[0], x + width);
+						layout.m_size[1] = std::max(layout.m_size[1],
+							y + std::max(m_line_spacing, height + glyph->m_offset[1]));
 					}
 
 					x += width + glyph->m_advance_x;
@@ -218,6 +278,8 @@ namespace mage::rendering {
 
 				}
 			}
+
+			++string_index;
 		}
 	}
 
@@ -331,29 +393,45 @@ namespace mage::rendering {
 
 	[[nodiscard]]
 	bool SpriteFont::ContainsCharacter(wchar_t character) const {
-		using std::cbegin;
-		using std::cend;
-
-		return std::binary_search(cbegin(m_glyphs), cend(m_glyphs),
-			                      character, GlyphLessThan());
+		return nullptr != FindGlyph(character);
 	}
 
 	[[nodiscard]]
 	const Glyph* SpriteFont::GetGlyph(wchar_t character) const {
+		if (const auto glyph = FindGlyph(character); nullptr != glyph) {
+			return glyph;
+		}
+
+		ThrowIfFailed((nullptr != m_default_glyph),
+			          "Character not found in sprite font.");
+
+		return m_default_glyph;
+	}
+
+	[[nodiscard]]
+	const Glyph* SpriteFont::FindGlyph(wchar_t character) const noexcept {
 		using std::cbegin;
 		using std::cend;
 
+		const auto code = static_cast< std::size_t >(character);
+		if (code < m_glyph_table.size()) {
+			const auto index = m_glyph_table[code];
+			return (g_no_glyph != index) ? &m_glyphs[index] : nullptr;
+		}
+
+		if (code < g_nb_bmp_characters) {
+			// The glyph table covers all glyphs of the BMP.
+			return nullptr;
+		}
+
 		if (const auto it = std::lower_bound(cbegin(m_glyphs), cend(m_glyphs),
 			                                 character, GlyphLessThan());
-			it != cend(m_glyphs) && it->m_character == character) {
+			it != cend(m_glyphs) && it->m_character == static_cast< U32 >(character)) {
 
 			return &(*it);
 		}
 
-		ThrowIfFailed((nullptr != m_default_glyph),
-			          "Character not found in sprite font.");
-
-		return m_default_glyph;
+		return nullptr;
 	}
 
 	#pragma endregion
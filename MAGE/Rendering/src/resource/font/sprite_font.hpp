@@ -5,11 +5,11 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\resource.hpp"
-#include "resource\font\color_string.hpp"
-#include "resource\font\sprite_font_descriptor.hpp"
-#include "resource\font\sprite_font_output.hpp"
-#include "renderer\pass\sprite_batch.hpp"
+#include "resource/resource.hpp"
+#include "resource/font/color_string.hpp"
+#include "resource/font/sprite_font_descriptor.hpp"
+#include "resource/font/sprite_font_output.hpp"
+#include "renderer/pass/sprite_batch.hpp"
 
 #pragma endregion
 
@@ -18,6 +18,80 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	//-------------------------------------------------------------------------
+	// TextLayout
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of laid out glyphs.
+	 */
+	struct TextGlyph {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The top-left position of this text glyph relative to the origin of
+		 the text (in pixels).
+		 */
+		F32x2 m_position;
+
+		/**
+		 A pointer to the glyph of this text glyph.
+		 */
+		const Glyph* m_glyph;
+
+		/**
+		 The index of the color string of this text glyph.
+		 */
+		U32 m_string_index;
+	};
+
+	/**
+	 A struct of text layouts.
+
+	 A text layout contains the visible glyphs of a text positioned relative
+	 to the origin of the text. Text layouts only depend on the strings (not
+	 the colors) of the text and the sprite font, and can be drawn with any
+	 transform and color.
+	 */
+	struct TextLayout {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Clears this text layout. The capacity is retained.
+		 */
+		void clear() noexcept {
+			m_glyphs.clear();
+			m_size = F32x2(0.0f);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the visible glyphs of this text layout.
+		 */
+		std::vector< TextGlyph > m_glyphs;
+
+		/**
+		 The size of this text layout (in pixels).
+		 */
+		F32x2 m_size;
+	};
+
+	#pragma endregion
+
 	//-------------------------------------------------------------------------
 	// SpriteFont
 	//-------------------------------------------------------------------------
@@ -125,6 +199,48 @@ namespace mage::rendering {
 			          SpriteEffect effects = SpriteEffect::None,
 		              const RGBA* color = nullptr) const;
 
+		/**
+		 Draws the given laid out text with this sprite font using the given
+		 sprite batch.
+
+		 @pre			The given text layout is laid out by this sprite font
+						for the given strings.
+		 @param[in]		sprite_batch
+						A reference to the sprite batch used for rendering
+						the given text with this sprite font.
+		 @param[in]		layout
+						A reference to the text layout.
+		 @param[in]		strings
+						The strings of the text.
+		 @param[in]		transform
+						A reference to the sprite transform.
+		 @param[in]		effects
+						The sprite effects to apply.
+		 @param[in]		color
+						A pointer to the (linear) color. If this pointer is
+						equal to @c nullptr, each string will be drawn in its
+						own color. Otherwise, each string is drawn in this
+						color.
+		 */
+		void DrawText(SpriteBatch& sprite_batch,
+					  const TextLayout& layout,
+					  gsl::span< const ColorString > strings,
+					  const SpriteTransform2D& transform,
+					  SpriteEffect effects = SpriteEffect::None,
+					  const RGBA* color = nullptr) const;
+
+		/**
+		 Lays out the given text with this sprite font.
+
+		 @param[in]		strings
+						The strings of the text.
+		 @param[out]	layout
+						A reference to the text layout (the capacity of which
+						is reused).
+		 */
+		void LayoutText(gsl::span< const ColorString > strings,
+						TextLayout& layout) const;
+
 		/**
 		 Returns the size of the given text with this sprite font (in pixels).
 
@@ -289,6 +405,20 @@ namespace mage::rendering {
 		 */
 		void InitializeSpriteFont(const SpriteFontOutput& output);
 
+		/**
+		 Finds the glyph of this sprite font corresponding to the given
+		 character.
+
+		 @param[in]		character
+						The character.
+		 @return		A pointer to the glyph of this sprite font corresponding
+						to the given character.
+		 @return		@c nullptr if the given character does not match any
+						glyphs of this sprite font.
+		 */
+		[[nodiscard]]
+		const Glyph* FindGlyph(wchar_t character) const noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -303,6 +433,15 @@ namespace mage::rendering {
 		 */
 		std::vector< Glyph > m_glyphs;
 
+		/**
+		 A vector containing the indices of the glyphs of this sprite font
+		 indexed by character for the Basic Multilingual Plane (up to the
+		 largest character of this sprite font). Characters without a glyph
+		 map to @c std::numeric_limits< U32 >::max(). Other characters are
+		 looked up with a binary search.
+		 */
+		std::vector< U32 > m_glyph_table;
+
 		/**
 		 A pointer to the default glyph of this sprite font.
 		 */
@@ -6,7 +6,7 @@
 #pragma region
 
 #include "direct3d11.hpp"
-#include "resource\font\glyph.hpp"
+#include "resource/font/glyph.hpp"
 
 #pragma endregion
 
@@ -0,0 +1,86 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/mesh/vertex.hpp"
+#include "memory/memory.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <variant>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A struct of mapped meshes referencing vertices and indices which are
+	 owned by another object (e.g., a memory-mapped file).
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 */
+	template< typename VertexT, typename IndexT >
+	struct MappedMesh {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this mapped mesh references vertices and indices.
+
+		 @return		@c true if this mapped mesh references vertices and
+						indices. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsMapped() const noexcept {
+			return nullptr != m_owner;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the owner of the vertices and indices of this mapped
+		 mesh. The vertices and indices remain valid as long as their owner
+		 is alive.
+		 */
+		SharedPtr< const void > m_owner;
+
+		/**
+		 The vertices of this mapped mesh.
+		 */
+		gsl::span< const VertexT > m_vertices;
+
+		/**
+		 The indices of this mapped mesh.
+		 */
+		gsl::span< const IndexT > m_indices;
+	};
+
+	/**
+	 A mapped packed mesh with 16-bit or 32-bit indices (if any). The indices
+	 are relative to the base vertex of their model part.
+	 */
+	using MappedPackedMesh = std::variant<
+		std::monostate,
+		MappedMesh< PackedVertexPositionNormalTexture, U16 >,
+		MappedMesh< PackedVertexPositionNormalTexture, U32 > >;
+}
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pipeline.hpp"
+#include "renderer/pipeline.hpp"
 
 #pragma endregion
 
@@ -188,14 +188,19 @@ namespace mage::rendering {
 						The start index.
 		 @param[in]		nb_indices
 						The number of indices.
+		 @param[in]		base_vertex
+						The base vertex which is added to each index before
+						reading a vertex from the vertex buffer.
 		 */
 		void Draw(ID3D11DeviceContext& device_context,
 				  std::size_t start_index,
-				  std::size_t nb_indices) const noexcept {
+				  std::size_t nb_indices,
+				  std::size_t base_vertex = 0u) const noexcept {
 
 			Pipeline::DrawIndexed(device_context,
 				                  static_cast< U32 >(nb_indices),
-				                  static_cast< U32 >(start_index));
+				                  static_cast< U32 >(start_index),
+				                  static_cast< U32 >(base_vertex));
 		}
 
 	protected:
@@ -312,6 +317,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\mesh\mesh.tpp"
+#include "resource/mesh/mesh.tpp"
 
 #pragma endregion
\ No newline at end of file
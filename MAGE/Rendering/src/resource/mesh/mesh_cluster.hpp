@@ -0,0 +1,140 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/mesh/mesh_optimizer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 The default maximum number of triangles of a mesh cluster.
+	 */
+	constexpr std::size_t g_cluster_max_nb_triangles = 128u;
+
+	/**
+	 The default maximum number of distinct vertices of a mesh cluster.
+	 */
+	constexpr std::size_t g_cluster_max_nb_vertices = 96u;
+
+	/**
+	 A struct of mesh clusters (i.e. contiguous ranges of triangles with
+	 culling data). All culling data is expressed in object space.
+	 */
+	struct MeshCluster {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The start index of this mesh cluster in the mesh.
+		 */
+		U32 m_start_index = 0u;
+
+		/**
+		 The number of indices of this mesh cluster in the mesh.
+		 */
+		U32 m_nb_indices = 0u;
+
+		/**
+		 The centroid of the bounding sphere of this mesh cluster.
+		 */
+		F32x3 m_sphere_centroid = {};
+
+		/**
+		 The radius of the bounding sphere of this mesh cluster.
+		 */
+		F32 m_sphere_radius = 0.0f;
+
+		/**
+		 The minimum point of the AABB of this mesh cluster.
+		 */
+		F32x3 m_aabb_min = {};
+
+		/**
+		 The maximum point of the AABB of this mesh cluster.
+		 */
+		F32x3 m_aabb_max = {};
+
+		/**
+		 The (normalized) axis of the normal cone of this mesh cluster.
+		 */
+		F32x3 m_cone_axis = {};
+
+		/**
+		 The cutoff of the normal cone of this mesh cluster. This mesh cluster
+		 is back facing for a view direction @c d (from the viewer to the
+		 centroid of the bounding sphere of this mesh cluster) if
+		 dot(d, axis) >= cutoff * |d| + radius. A cutoff of 1 disables
+		 back-face culling for this mesh cluster.
+		 */
+		F32 m_cone_cutoff = 1.0f;
+	};
+
+	static_assert(64u == sizeof(MeshCluster));
+
+	/**
+	 Partitions the given (clockwise) triangle list into mesh clusters.
+
+	 Each mesh cluster is grown from the first unassigned triangle (in the
+	 given order) by repeatedly adding the adjacent triangle which adds the
+	 fewest vertices and deviates the least in position and orientation. The
+	 triangles are reordered so that each mesh cluster is a contiguous range
+	 of indices, after which the triangles of each mesh cluster are reordered
+	 for the post-transform vertex cache.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in,out]	indices
+					The indices of the triangle list.
+	 @param[in]		vertices
+					The vertices referenced by the given indices.
+	 @param[in]		start_index
+					The start index of the given indices in the mesh.
+	 @param[out]	clusters
+					A reference to a vector to which the mesh clusters are
+					appended.
+	 @param[in]		max_nb_triangles
+					The maximum number of triangles of a mesh cluster.
+	 @param[in]		max_nb_vertices
+					The maximum number of distinct vertices of a mesh cluster
+					(at least 3).
+	 */
+	template< typename VertexT, typename IndexT >
+	void BuildMeshClusters(gsl::span< IndexT > indices,
+						   gsl::span< const VertexT > vertices,
+						   std::size_t start_index,
+						   std::vector< MeshCluster >& clusters,
+						   std::size_t max_nb_triangles = g_cluster_max_nb_triangles,
+						   std::size_t max_nb_vertices = g_cluster_max_nb_vertices);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/mesh/mesh_cluster.tpp"
+
+#pragma endregion
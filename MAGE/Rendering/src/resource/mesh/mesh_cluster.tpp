@@ -0,0 +1,344 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace details {
+
+		/**
+		 Creates a mesh cluster for the given triangle list.
+
+		 @pre			@a indices is not empty.
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
+		 @param[in]		indices
+						The indices of the triangle list.
+		 @param[in]		vertices
+						The vertices referenced by the given indices.
+		 @param[in]		start_index
+						The start index of the given indices in the mesh.
+		 @return		The mesh cluster.
+		 */
+		template< typename VertexT, typename IndexT >
+		[[nodiscard]]
+		const MeshCluster MakeMeshCluster(gsl::span< const IndexT > indices,
+										  gsl::span< const VertexT > vertices,
+										  std::size_t start_index) {
+
+			const auto position = [&indices, vertices](std::ptrdiff_t i) noexcept {
+				const auto index = static_cast< std::ptrdiff_t >(indices[i]);
+				const auto& p    = vertices[index].m_p;
+				return F32x3{ p[0], p[1], p[2] };
+			};
+
+			MeshCluster cluster;
+			cluster.m_start_index = static_cast< U32 >(start_index);
+			cluster.m_nb_indices  = static_cast< U32 >(indices.size());
+
+			// Compute the AABB.
+			constexpr auto inf = std::numeric_limits< F32 >::infinity();
+			cluster.m_aabb_min = {  inf,  inf,  inf };
+			cluster.m_aabb_max = { -inf, -inf, -inf };
+			for (std::ptrdiff_t i = 0; i < indices.size(); ++i) {
+				const auto p = position(i);
+				for (std::size_t j = 0u; j < 3u; ++j) {
+					cluster.m_aabb_min[j] = std::min(cluster.m_aabb_min[j], p[j]);
+					cluster.m_aabb_max[j] = std::max(cluster.m_aabb_max[j], p[j]);
+				}
+			}
+
+			// Compute the bounding sphere around the centroid of the AABB.
+			F32 radius_sq = 0.0f;
+			for (std::size_t j = 0u; j < 3u; ++j) {
+				cluster.m_sphere_centroid[j]
+					= 0.5f * (cluster.m_aabb_min[j] + cluster.m_aabb_max[j]);
+			}
+			for (std::ptrdiff_t i = 0; i < indices.size(); ++i) {
+				const auto p = position(i);
+				F32 distance_sq = 0.0f;
+				for (std::size_t j = 0u; j < 3u; ++j) {
+					const auto d = p[j] - cluster.m_sphere_centroid[j];
+					distance_sq += d * d;
+				}
+				radius_sq = std::max(radius_sq, distance_sq);
+			}
+			cluster.m_sphere_radius = std::sqrt(radius_sq);
+
+			// Compute the normals of the non-degenerate triangles.
+			std::vector< F32x3 > normals;
+			normals.reserve(static_cast< std::size_t >(indices.size()) / 3u);
+			F32x3 axis = { 0.0f, 0.0f, 0.0f };
+			for (std::ptrdiff_t i = 0; i + 2 < indices.size(); i += 3) {
+				const auto p0 = position(i);
+				const auto p1 = position(i + 1);
+				const auto p2 = position(i + 2);
+
+				const F32x3 e1 = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+				const F32x3 e2 = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+				// Clockwise triangles face the direction of this cross product.
+				const F32x3 n  = { e1[1] * e2[2] - e1[2] * e2[1],
+								   e1[2] * e2[0] - e1[0] * e2[2],
+								   e1[0] * e2[1] - e1[1] * e2[0] };
+				const auto length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+				if (0.0f == length) {
+					continue;
+				}
+
+				const auto inv_length = 1.0f / length;
+				const F32x3 unit_n = { n[0] * inv_length,
+									   n[1] * inv_length,
+									   n[2] * inv_length };
+				for (std::size_t j = 0u; j < 3u; ++j) {
+					axis[j] += unit_n[j];
+				}
+				normals.push_back(unit_n);
+			}
+
+			// Compute the normal cone around the average normal.
+			const auto axis_length
+				= std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+			if (0.0f == axis_length) {
+				return cluster;
+			}
+
+			const auto inv_axis_length = 1.0f / axis_length;
+			for (std::size_t j = 0u; j < 3u; ++j) {
+				cluster.m_cone_axis[j] = axis[j] * inv_axis_length;
+			}
+
+			auto min_dp = 1.0f;
+			for (const auto& n : normals) {
+				min_dp = std::min(min_dp, n[0] * cluster.m_cone_axis[0]
+										+ n[1] * cluster.m_cone_axis[1]
+										+ n[2] * cluster.m_cone_axis[2]);
+			}
+
+			// Normal cones with a (half) angle close to or larger than 90
+			// degrees never result in back-face culling.
+			cluster.m_cone_cutoff = (min_dp <= 0.1f)
+				                  ? 1.0f : std::sqrt(1.0f - min_dp * min_dp);
+
+			return cluster;
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	void BuildMeshClusters(gsl::span< IndexT > indices,
+						   gsl::span< const VertexT > vertices,
+						   std::size_t start_index,
+						   std::vector< MeshCluster >& clusters,
+						   std::size_t max_nb_triangles,
+						   std::size_t max_nb_vertices) {
+
+		const auto nb_triangles = static_cast< std::size_t >(indices.size()) / 3u;
+		if (0u == nb_triangles) {
+			return;
+		}
+
+		const std::vector< IndexT > input(indices.begin(),
+										  indices.begin() + 3u * nb_triangles);
+		const auto [base, nb_vertices]
+			= details::GetIndexRange(gsl::make_span(input));
+		const auto vertex = [&input, base = base](std::size_t i) noexcept {
+			return static_cast< std::size_t >(input[i]) - base;
+		};
+
+		// Build the vertex-triangle adjacency.
+		std::vector< std::size_t > offsets(nb_vertices + 1u, 0u);
+		for (std::size_t i = 0u; i < input.size(); ++i) {
+			++offsets[vertex(i) + 1u];
+		}
+		std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+		std::vector< std::size_t > adjacency(input.size());
+		{
+			std::vector< std::size_t > next(offsets.begin(), offsets.end() - 1);
+			for (std::size_t i = 0u; i < input.size(); ++i) {
+				adjacency[next[vertex(i)]++] = i / 3u;
+			}
+		}
+
+		// Compute the centroids and (unnormalized) normals of the triangles.
+		std::vector< F32x3 > centroids(nb_triangles);
+		std::vector< F32x3 > normals(nb_triangles);
+		for (std::size_t triangle = 0u; triangle < nb_triangles; ++triangle) {
+			const auto position = [&input, vertices](std::size_t i) noexcept {
+				const auto index = static_cast< std::ptrdiff_t >(input[i]);
+				const auto& p    = vertices[index].m_p;
+				return F32x3{ p[0], p[1], p[2] };
+			};
+			const auto p0 = position(3u * triangle);
+			const auto p1 = position(3u * triangle + 1u);
+			const auto p2 = position(3u * triangle + 2u);
+
+			const F32x3 e1 = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+			const F32x3 e2 = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+			for (std::size_t j = 0u; j < 3u; ++j) {
+				centroids[triangle][j] = (p0[j] + p1[j] + p2[j]) / 3.0f;
+			}
+			normals[triangle] = { e1[1] * e2[2] - e1[2] * e2[1],
+								  e1[2] * e2[0] - e1[0] * e2[2],
+								  e1[0] * e2[1] - e1[1] * e2[0] };
+		}
+
+		constexpr auto no_triangle = std::numeric_limits< std::size_t >::max();
+		std::vector< bool > assigned(nb_triangles, false);
+		// The (one-based) mesh cluster which last referenced each vertex or
+		// triangle.
+		std::vector< std::size_t > vertex_stamps(nb_vertices, 0u);
+		std::vector< std::size_t > triangle_stamps(nb_triangles, 0u);
+		std::vector< std::size_t > cluster_triangles;
+		std::vector< std::size_t > candidates;
+		std::size_t stamp  = 0u;
+		std::size_t cursor = 0u;
+		auto output = indices.begin();
+
+		while (true) {
+			while (cursor < nb_triangles && assigned[cursor]) {
+				++cursor;
+			}
+			if (nb_triangles == cursor) {
+				break;
+			}
+
+			++stamp;
+			cluster_triangles.clear();
+			candidates.clear();
+			std::size_t cluster_nb_vertices = 0u;
+			F32x3 centroid_sum = { 0.0f, 0.0f, 0.0f };
+			F32x3 normal_sum   = { 0.0f, 0.0f, 0.0f };
+
+			const auto nb_new_vertices = [&](std::size_t triangle) noexcept {
+				const auto v0 = vertex(3u * triangle);
+				const auto v1 = vertex(3u * triangle + 1u);
+				const auto v2 = vertex(3u * triangle + 2u);
+
+				std::size_t count = 0u;
+				count += (stamp != vertex_stamps[v0]) ? 1u : 0u;
+				count += (stamp != vertex_stamps[v1] && v1 != v0) ? 1u : 0u;
+				count += (stamp != vertex_stamps[v2] && v2 != v0 && v2 != v1) ? 1u : 0u;
+				return count;
+			};
+
+			auto next = cursor;
+			while (no_triangle != next) {
+				// Add the next triangle to the mesh cluster.
+				cluster_nb_vertices += nb_new_vertices(next);
+				assigned[next] = true;
+				cluster_triangles.push_back(next);
+				for (std::size_t j = 0u; j < 3u; ++j) {
+					centroid_sum[j] += centroids[next][j];
+					normal_sum[j]   += normals[next][j];
+				}
+
+				for (auto i = 3u * next; i < 3u * next + 3u; ++i) {
+					const auto v = vertex(i);
+					vertex_stamps[v] = stamp;
+
+					for (auto k = offsets[v]; k < offsets[v + 1u]; ++k) {
+						const auto triangle = adjacency[k];
+						if (!assigned[triangle] && stamp != triangle_stamps[triangle]) {
+							triangle_stamps[triangle] = stamp;
+							candidates.push_back(triangle);
+						}
+					}
+				}
+
+				if (max_nb_triangles <= cluster_triangles.size()) {
+					break;
+				}
+
+				// Select the adjacent triangle which adds the fewest vertices
+				// and is the closest to (the centroid and normal of) the mesh
+				// cluster.
+				const auto inv_size = 1.0f / static_cast< F32 >(cluster_triangles.size());
+				const auto normal_length
+					= std::sqrt(normal_sum[0] * normal_sum[0]
+								+ normal_sum[1] * normal_sum[1]
+								+ normal_sum[2] * normal_sum[2]);
+
+				next = no_triangle;
+				auto best_nb_new = std::size_t(4u);
+				auto best_score  = std::numeric_limits< F32 >::max();
+				std::size_t nb_candidates = 0u;
+				for (const auto triangle : candidates) {
+					if (assigned[triangle]) {
+						continue;
+					}
+					candidates[nb_candidates++] = triangle;
+
+					const auto nb_new = nb_new_vertices(triangle);
+					if (max_nb_vertices < cluster_nb_vertices + nb_new
+						|| best_nb_new < nb_new) {
+						continue;
+					}
+
+					F32 distance_sq = 0.0f;
+					for (std::size_t j = 0u; j < 3u; ++j) {
+						const auto d = centroids[triangle][j] - centroid_sum[j] * inv_size;
+						distance_sq += d * d;
+					}
+
+					const auto& n = normals[triangle];
+					const auto n_length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+					const auto cos_theta = (0.0f == n_length || 0.0f == normal_length)
+						? 1.0f
+						: (n[0] * normal_sum[0] + n[1] * normal_sum[1] + n[2] * normal_sum[2])
+						  / (n_length * normal_length);
+					const auto score = distance_sq * (2.0f - cos_theta);
+
+					if (nb_new < best_nb_new || score < best_score) {
+						next        = triangle;
+						best_nb_new = nb_new;
+						best_score  = score;
+					}
+				}
+				candidates.resize(nb_candidates);
+
+				// Continue small mesh clusters of disconnected triangles with
+				// the next unassigned triangle.
+				if (no_triangle == next && 2u * cluster_triangles.size() < max_nb_triangles) {
+					while (cursor < nb_triangles && assigned[cursor]) {
+						++cursor;
+					}
+					if (cursor < nb_triangles
+						&& cluster_nb_vertices + nb_new_vertices(cursor) <= max_nb_vertices) {
+						next = cursor;
+					}
+				}
+			}
+
+			// Emit the mesh cluster.
+			const auto start = static_cast< std::ptrdiff_t >(output - indices.begin());
+			for (const auto triangle : cluster_triangles) {
+				output = std::copy(input.begin() + 3u * triangle,
+								   input.begin() + 3u * triangle + 3u,
+								   output);
+			}
+
+			const auto cluster_indices = indices.subspan(
+				start, static_cast< std::ptrdiff_t >(3u * cluster_triangles.size()));
+			OptimizeVertexCache(cluster_indices);
+
+			clusters.push_back(details::MakeMeshCluster< VertexT, IndexT >(
+				cluster_indices, vertices,
+				start_index + static_cast< std::size_t >(start)));
+		}
+	}
+}
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\scalar_types.hpp"
+#include "type/scalar_types.hpp"
 
 #pragma endregion
 
@@ -41,12 +41,17 @@ namespace mage::rendering {
 						A flag indicating whether the face vertices should be
 						defined in clockwise order or not (i.e.
 						counterclockwise order).
+		 @param[in]		nb_lods
+						The number of levels of detail (including the full
+						detail) to generate for each model part.
 		 */
 		constexpr explicit MeshDescriptor(
 			bool invert_handedness = false,
-			bool clockwise_order   = true) noexcept
+			bool clockwise_order   = true,
+			std::size_t nb_lods    = 1u) noexcept
 			: m_invert_handedness(invert_handedness),
-			m_clockwise_order(clockwise_order) {}
+			m_clockwise_order(clockwise_order),
+			m_nb_lods(nb_lods) {}
 
 		/**
 		 Constructs a mesh descriptor from the given mesh descriptor.
@@ -122,6 +127,18 @@ namespace mage::rendering {
 			return m_clockwise_order;
 		}
 
+		/**
+		 Returns the number of levels of detail (including the full detail)
+		 to generate for each model part according to this mesh descriptor.
+
+		 @return		The number of levels of detail to generate for each
+						model part.
+		 */
+		[[nodiscard]]
+		constexpr std::size_t GetNumberOfLODs() const noexcept {
+			return m_nb_lods;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -140,5 +157,11 @@ namespace mage::rendering {
 		 descriptor.
 		 */
 		bool m_clockwise_order;
+
+		/**
+		 The number of levels of detail (including the full detail) to
+		 generate for each model part for this mesh descriptor.
+		 */
+		std::size_t m_nb_lods;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,162 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type/types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <gsl/span>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 The default size of the simulated (FIFO) post-transform vertex cache.
+	 */
+	constexpr std::size_t g_vertex_cache_size = 16u;
+
+	/**
+	 A struct of post-transform vertex cache statistics.
+	 */
+	struct VertexCacheStatistics {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the average cache miss ratio (ACMR) of these vertex cache
+		 statistics.
+
+		 @return		The number of transformed vertices per triangle.
+		 */
+		[[nodiscard]]
+		F32 GetACMR() const noexcept {
+			return (0u == m_nb_triangles) ? 0.0f
+				: static_cast< F32 >(m_nb_transformed_vertices)
+				/ static_cast< F32 >(m_nb_triangles);
+		}
+
+		/**
+		 Returns the average transform to vertex ratio (ATVR) of these vertex
+		 cache statistics.
+
+		 @return		The number of transformed vertices per referenced
+						vertex (1 is optimal).
+		 */
+		[[nodiscard]]
+		F32 GetATVR() const noexcept {
+			return (0u == m_nb_vertices) ? 0.0f
+				: static_cast< F32 >(m_nb_transformed_vertices)
+				/ static_cast< F32 >(m_nb_vertices);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of triangles of these vertex cache statistics.
+		 */
+		std::size_t m_nb_triangles = 0u;
+
+		/**
+		 The number of distinct referenced vertices of these vertex cache
+		 statistics.
+		 */
+		std::size_t m_nb_vertices = 0u;
+
+		/**
+		 The number of transformed vertices (i.e. cache misses) of these
+		 vertex cache statistics.
+		 */
+		std::size_t m_nb_transformed_vertices = 0u;
+	};
+
+	/**
+	 Analyzes the post-transform vertex cache behavior of the given triangle
+	 list by simulating a FIFO cache.
+
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		indices
+					The indices of the triangle list.
+	 @param[in]		cache_size
+					The size of the simulated cache.
+	 @return		The vertex cache statistics of the given triangle list.
+	 */
+	template< typename IndexT >
+	[[nodiscard]]
+	const VertexCacheStatistics AnalyzeVertexCache(
+		gsl::span< const IndexT > indices,
+		std::size_t cache_size = g_vertex_cache_size);
+
+	/**
+	 Reorders the triangles of the given triangle list for the post-transform
+	 vertex cache (Tipsify [Sander et al. 2007]).
+
+	 @tparam		IndexT
+					The index type.
+	 @param[in,out]	indices
+					The indices of the triangle list.
+	 @param[in]		cache_size
+					The size of the targeted cache.
+	 */
+	template< typename IndexT >
+	void OptimizeVertexCache(gsl::span< IndexT > indices,
+							 std::size_t cache_size = g_vertex_cache_size);
+
+	/**
+	 Reorders clusters of the triangles of the given (vertex cache optimized)
+	 triangle list to reduce overdraw [Sander et al. 2007].
+
+	 The triangle list is split into clusters at vertex cache flushes and
+	 wherever the running ACMR of a cluster drops below the given threshold
+	 times the ACMR of its enclosing cluster. The clusters are sorted from the
+	 outside to the inside of the mesh so that occluders tend to be drawn
+	 first.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in,out]	indices
+					The indices of the triangle list.
+	 @param[in]		vertices
+					The vertices referenced by the given indices.
+	 @param[in]		threshold
+					The ACMR threshold (>= 1) to trade vertex cache
+					efficiency for overdraw.
+	 @param[in]		cache_size
+					The size of the targeted cache.
+	 */
+	template< typename VertexT, typename IndexT >
+	void OptimizeOverdraw(gsl::span< IndexT > indices,
+						  gsl::span< const VertexT > vertices,
+						  F32 threshold = 1.05f,
+						  std::size_t cache_size = g_vertex_cache_size);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/mesh/mesh_optimizer.tpp"
+
+#pragma endregion
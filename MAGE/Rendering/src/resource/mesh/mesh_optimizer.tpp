@@ -0,0 +1,352 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace details {
+
+		/**
+		 Returns the range of the given indices.
+
+		 @pre			@a indices is not empty.
+		 @tparam		IndexT
+						The index type.
+		 @param[in]		indices
+						The indices.
+		 @return		The minimum index and the number of indices in the
+						[minimum, maximum] range of the given indices.
+		 */
+		template< typename IndexT >
+		[[nodiscard]]
+		inline const std::pair< std::size_t, std::size_t >
+			GetIndexRange(gsl::span< const IndexT > indices) noexcept {
+
+			const auto [min_it, max_it] = std::minmax_element(indices.begin(),
+															  indices.end());
+			const auto min_index = static_cast< std::size_t >(*min_it);
+			const auto max_index = static_cast< std::size_t >(*max_it);
+
+			return { min_index, max_index - min_index + 1u };
+		}
+	}
+
+	template< typename IndexT >
+	[[nodiscard]]
+	const VertexCacheStatistics AnalyzeVertexCache(
+		gsl::span< const IndexT > indices, std::size_t cache_size) {
+
+		VertexCacheStatistics statistics;
+		statistics.m_nb_triangles = static_cast< std::size_t >(indices.size()) / 3u;
+		if (indices.empty()) {
+			return statistics;
+		}
+
+		const auto [base, nb_vertices] = details::GetIndexRange(indices);
+
+		// A vertex is cached if it is one of the last cache_size transformed
+		// vertices.
+		std::vector< std::size_t > cache_timestamps(nb_vertices, 0u);
+		auto timestamp = cache_size + 1u;
+
+		for (const auto index : indices) {
+			auto& cache_timestamp
+				= cache_timestamps[static_cast< std::size_t >(index) - base];
+
+			if (0u == cache_timestamp) {
+				++statistics.m_nb_vertices;
+			}
+			if (timestamp - cache_timestamp > cache_size) {
+				cache_timestamp = timestamp++;
+				++statistics.m_nb_transformed_vertices;
+			}
+		}
+
+		return statistics;
+	}
+
+	template< typename IndexT >
+	void OptimizeVertexCache(gsl::span< IndexT > indices,
+							 std::size_t cache_size) {
+
+		const auto nb_triangles = static_cast< std::size_t >(indices.size()) / 3u;
+		if (0u == nb_triangles) {
+			return;
+		}
+
+		const std::vector< IndexT > input(indices.begin(),
+										  indices.begin() + 3u * nb_triangles);
+		const auto [base, nb_vertices]
+			= details::GetIndexRange(gsl::make_span(input));
+		const auto vertex = [&input, base = base](std::size_t i) noexcept {
+			return static_cast< std::size_t >(input[i]) - base;
+		};
+
+		// Build the vertex-triangle adjacency.
+		std::vector< std::size_t > offsets(nb_vertices + 1u, 0u);
+		for (std::size_t i = 0u; i < input.size(); ++i) {
+			++offsets[vertex(i) + 1u];
+		}
+		std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+		std::vector< std::size_t > adjacency(input.size());
+		{
+			std::vector< std::size_t > next(offsets.begin(), offsets.end() - 1);
+			for (std::size_t i = 0u; i < input.size(); ++i) {
+				adjacency[next[vertex(i)]++] = i / 3u;
+			}
+		}
+
+		// The number of non-emitted adjacent triangles per vertex.
+		std::vector< std::size_t > live(nb_vertices);
+		for (std::size_t v = 0u; v < nb_vertices; ++v) {
+			live[v] = offsets[v + 1u] - offsets[v];
+		}
+
+		std::vector< std::size_t > cache_timestamps(nb_vertices, 0u);
+		std::vector< bool > emitted(nb_triangles, false);
+		std::vector< std::size_t > dead_ends;
+		std::vector< std::size_t > candidates;
+		dead_ends.reserve(input.size());
+
+		constexpr auto no_vertex = std::numeric_limits< std::size_t >::max();
+		auto timestamp = cache_size + 1u;
+		std::size_t cursor = 0u;
+		std::size_t fanning_vertex = 0u;
+		auto output = indices.begin();
+
+		while (no_vertex != fanning_vertex) {
+			candidates.clear();
+
+			// Emit the non-emitted adjacent triangles of the fanning vertex.
+			for (auto k = offsets[fanning_vertex];
+				 k < offsets[fanning_vertex + 1u]; ++k) {
+
+				const auto triangle = adjacency[k];
+				if (emitted[triangle]) {
+					continue;
+				}
+				emitted[triangle] = true;
+
+				for (auto i = 3u * triangle; i < 3u * triangle + 3u; ++i) {
+					const auto v = vertex(i);
+					*output++ = input[i];
+					dead_ends.push_back(v);
+					candidates.push_back(v);
+					--live[v];
+
+					if (timestamp - cache_timestamps[v] > cache_size) {
+						cache_timestamps[v] = timestamp++;
+					}
+				}
+			}
+
+			// Select the oldest candidate which remains cached after emitting
+			// all of its non-emitted adjacent triangles.
+			auto next_vertex   = no_vertex;
+			auto best_priority = std::numeric_limits< std::size_t >::max();
+			for (const auto v : candidates) {
+				if (0u == live[v]) {
+					continue;
+				}
+
+				const auto age = timestamp - cache_timestamps[v];
+				const auto priority = (age + 2u * live[v] <= cache_size) ? age : 0u;
+				if (no_vertex == next_vertex || priority > best_priority) {
+					next_vertex   = v;
+					best_priority = priority;
+				}
+			}
+
+			// Skip dead ends.
+			while (no_vertex == next_vertex && !dead_ends.empty()) {
+				const auto v = dead_ends.back();
+				dead_ends.pop_back();
+				if (0u != live[v]) {
+					next_vertex = v;
+				}
+			}
+
+			while (no_vertex == next_vertex && cursor < nb_vertices) {
+				if (0u != live[cursor]) {
+					next_vertex = cursor;
+				}
+				++cursor;
+			}
+
+			fanning_vertex = next_vertex;
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OptimizeOverdraw(gsl::span< IndexT > indices,
+						  gsl::span< const VertexT > vertices,
+						  F32 threshold,
+						  std::size_t cache_size) {
+
+		const auto nb_triangles = static_cast< std::size_t >(indices.size()) / 3u;
+		if (nb_triangles < 2u) {
+			return;
+		}
+
+		const std::vector< IndexT > input(indices.begin(),
+										  indices.begin() + 3u * nb_triangles);
+		const auto [base, nb_vertices]
+			= details::GetIndexRange(gsl::make_span(input));
+
+		std::vector< std::size_t > cache_timestamps(nb_vertices, 0u);
+		auto timestamp = cache_size + 1u;
+
+		const auto flush = [&timestamp, cache_size]() noexcept {
+			timestamp += cache_size + 1u;
+		};
+		const auto transform = [&, base = base](std::size_t triangle) noexcept {
+			std::size_t misses = 0u;
+			for (auto i = 3u * triangle; i < 3u * triangle + 3u; ++i) {
+				auto& cache_timestamp
+					= cache_timestamps[static_cast< std::size_t >(input[i]) - base];
+				if (timestamp - cache_timestamp > cache_size) {
+					cache_timestamp = timestamp++;
+					++misses;
+				}
+			}
+			return misses;
+		};
+
+		// Split the triangles into hard clusters at cache flushes.
+		std::vector< std::size_t > hard_clusters;
+		for (std::size_t triangle = 0u; triangle < nb_triangles; ++triangle) {
+			if (const auto misses = transform(triangle);
+				0u == triangle || 3u == misses) {
+				hard_clusters.push_back(triangle);
+			}
+		}
+		hard_clusters.push_back(nb_triangles);
+
+		// Split the hard clusters into soft clusters wherever the running ACMR
+		// reaches the ACMR of the hard cluster (times the threshold).
+		std::vector< std::size_t > clusters;
+		for (std::size_t c = 0u; c + 1u < hard_clusters.size(); ++c) {
+			const auto start = hard_clusters[c];
+			const auto end   = hard_clusters[c + 1u];
+
+			flush();
+			std::size_t misses = 0u;
+			for (auto triangle = start; triangle < end; ++triangle) {
+				misses += transform(triangle);
+			}
+			const auto acmr_threshold = threshold * static_cast< F32 >(misses)
+				                      / static_cast< F32 >(end - start);
+
+			clusters.push_back(start);
+			flush();
+			std::size_t running_misses    = 0u;
+			std::size_t running_triangles = 0u;
+			for (auto triangle = start; triangle + 1u < end; ++triangle) {
+				running_misses += transform(triangle);
+				++running_triangles;
+
+				if (static_cast< F32 >(running_misses)
+					<= acmr_threshold * static_cast< F32 >(running_triangles)) {
+					clusters.push_back(triangle + 1u);
+					flush();
+					running_misses    = 0u;
+					running_triangles = 0u;
+				}
+			}
+		}
+		clusters.push_back(nb_triangles);
+
+		const auto position = [&input, vertices](std::size_t i) noexcept {
+			const auto index = static_cast< std::ptrdiff_t >(input[i]);
+			const auto& p    = vertices[index].m_p;
+			return F32x3{ p[0], p[1], p[2] };
+		};
+
+		// Compute the centroid of the mesh.
+		F32x3 mesh_centroid = { 0.0f, 0.0f, 0.0f };
+		for (std::size_t i = 0u; i < input.size(); ++i) {
+			const auto p = position(i);
+			for (std::size_t j = 0u; j < 3u; ++j) {
+				mesh_centroid[j] += p[j];
+			}
+		}
+		for (auto& coordinate : mesh_centroid) {
+			coordinate /= static_cast< F32 >(input.size());
+		}
+
+		// Sort the clusters from the outside to the inside of the mesh based
+		// on the projection of their centroid offset on their average normal.
+		const auto nb_clusters = clusters.size() - 1u;
+		std::vector< F32 > keys(nb_clusters);
+		for (std::size_t c = 0u; c < nb_clusters; ++c) {
+			F32x3 centroid = { 0.0f, 0.0f, 0.0f };
+			F32x3 normal   = { 0.0f, 0.0f, 0.0f };
+			F32 area = 0.0f;
+
+			for (auto triangle = clusters[c]; triangle < clusters[c + 1u]; ++triangle) {
+				const auto p0 = position(3u * triangle);
+				const auto p1 = position(3u * triangle + 1u);
+				const auto p2 = position(3u * triangle + 2u);
+
+				const F32x3 e1 = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+				const F32x3 e2 = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+				// Clockwise triangles face the direction of this cross product.
+				const F32x3 n  = { e1[1] * e2[2] - e1[2] * e2[1],
+								   e1[2] * e2[0] - e1[0] * e2[2],
+								   e1[0] * e2[1] - e1[1] * e2[0] };
+				const auto triangle_area
+					= std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+				for (std::size_t j = 0u; j < 3u; ++j) {
+					centroid[j] += (p0[j] + p1[j] + p2[j]) * triangle_area;
+					normal[j]   += n[j];
+				}
+				area += triangle_area;
+			}
+
+			const auto normal_length = std::sqrt(normal[0] * normal[0]
+												 + normal[1] * normal[1]
+												 + normal[2] * normal[2]);
+			if (0.0f == area || 0.0f == normal_length) {
+				keys[c] = 0.0f;
+				continue;
+			}
+
+			F32 key = 0.0f;
+			for (std::size_t j = 0u; j < 3u; ++j) {
+				key += (centroid[j] / (3.0f * area) - mesh_centroid[j]) * normal[j];
+			}
+			keys[c] = key / normal_length;
+		}
+
+		std::vector< std::size_t > order(nb_clusters);
+		std::iota(order.begin(), order.end(), std::size_t(0u));
+		std::stable_sort(order.begin(), order.end(),
+						 [&keys](std::size_t lhs, std::size_t rhs) noexcept {
+							 return keys[lhs] > keys[rhs];
+						 });
+
+		auto output = indices.begin();
+		for (const auto c : order) {
+			output = std::copy(input.begin() + 3u * clusters[c],
+							   input.begin() + 3u * clusters[c + 1u],
+							   output);
+		}
+	}
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/mesh/mesh_optimizer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 Simplifies the given triangle list into a chain of levels of detail using
+	 quadric error metrics [Garland and Heckbert 1997].
+
+	 The triangle list is simplified with half-edge collapses. The levels of
+	 detail thus reference a subset of the given vertices. Vertices with equal
+	 positions (e.g., at attribute seams) are collapsed together and vertices
+	 on open borders are only collapsed along these borders.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @tparam		ActionT
+					An action to perform on each level of detail. This action
+					must accept a @c gsl::span< const IndexT > containing the
+					indices of a level of detail and a @c F32 containing the
+					(object space) error of that level of detail.
+	 @param[in]		indices
+					The indices of the triangle list.
+	 @param[in]		vertices
+					The vertices referenced by the given indices.
+	 @param[in]		target_nb_indices
+					The target number of indices of each level of detail (in
+					decreasing order).
+	 @param[in]		action
+					The action to perform on each level of detail (in order
+					of decreasing detail). Levels of detail which cannot be
+					reached are not reported.
+	 */
+	template< typename VertexT, typename IndexT, typename ActionT >
+	void SimplifyMesh(gsl::span< const IndexT > indices,
+					  gsl::span< const VertexT > vertices,
+					  gsl::span< const std::size_t > target_nb_indices,
+					  ActionT&& action);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/mesh/mesh_simplifier.tpp"
+
+#pragma endregion
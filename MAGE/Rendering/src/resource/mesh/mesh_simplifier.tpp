@@ -0,0 +1,494 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace details {
+
+		/**
+		 The weight of the planes through the open borders of a mesh relative
+		 to the squared length of the border edges.
+		 */
+		constexpr F32 g_border_weight = 10.0f;
+
+		[[nodiscard]]
+		inline const F32x3 Subtract(const F32x3& a, const F32x3& b) noexcept {
+			return { a[0] - b[0], a[1] - b[1], a[2] - b[2] };
+		}
+
+		[[nodiscard]]
+		inline const F32x3 Cross(const F32x3& a, const F32x3& b) noexcept {
+			return { a[1] * b[2] - a[2] * b[1],
+					 a[2] * b[0] - a[0] * b[2],
+					 a[0] * b[1] - a[1] * b[0] };
+		}
+
+		[[nodiscard]]
+		inline F32 Dot(const F32x3& a, const F32x3& b) noexcept {
+			return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+		}
+
+		/**
+		 A struct of quadrics measuring the weighted squared distance to a set
+		 of planes.
+		 */
+		struct Quadric {
+
+		public:
+
+			/**
+			 Adds the given plane to this quadric.
+
+			 @param[in]		n
+							A reference to the unit normal of the plane.
+			 @param[in]		p
+							A reference to a point on the plane.
+			 @param[in]		weight
+							The weight of the plane.
+			 */
+			void AddPlane(const F32x3& n, const F32x3& p, F32 weight) noexcept {
+				const F64 w  = weight;
+				const F64 nx = n[0];
+				const F64 ny = n[1];
+				const F64 nz = n[2];
+				const F64 d  = -Dot(n, p);
+
+				m_a00 += w * nx * nx;
+				m_a01 += w * nx * ny;
+				m_a02 += w * nx * nz;
+				m_a11 += w * ny * ny;
+				m_a12 += w * ny * nz;
+				m_a22 += w * nz * nz;
+				m_b0  += w * nx * d;
+				m_b1  += w * ny * d;
+				m_b2  += w * nz * d;
+				m_c   += w * d * d;
+				m_weight += w;
+			}
+
+			Quadric& operator+=(const Quadric& quadric) noexcept {
+				m_a00 += quadric.m_a00;
+				m_a01 += quadric.m_a01;
+				m_a02 += quadric.m_a02;
+				m_a11 += quadric.m_a11;
+				m_a12 += quadric.m_a12;
+				m_a22 += quadric.m_a22;
+				m_b0  += quadric.m_b0;
+				m_b1  += quadric.m_b1;
+				m_b2  += quadric.m_b2;
+				m_c   += quadric.m_c;
+				m_weight += quadric.m_weight;
+				return *this;
+			}
+
+			/**
+			 Returns the error of the given point with regard to this quadric.
+
+			 @param[in]		p
+							A reference to the point.
+			 @return		The weighted mean squared distance of the given
+							point to the planes of this quadric.
+			 */
+			[[nodiscard]]
+			F64 GetError(const F32x3& p) const noexcept {
+				if (m_weight <= 0.0) {
+					return 0.0;
+				}
+
+				const F64 x = p[0];
+				const F64 y = p[1];
+				const F64 z = p[2];
+				const auto error = x * (m_a00 * x + 2.0 * (m_a01 * y + m_a02 * z + m_b0))
+					             + y * (m_a11 * y + 2.0 * (m_a12 * z + m_b1))
+					             + z * (m_a22 * z + 2.0 * m_b2)
+					             + m_c;
+
+				return std::max(error, 0.0) / m_weight;
+			}
+
+			F64 m_a00 = 0.0;
+			F64 m_a01 = 0.0;
+			F64 m_a02 = 0.0;
+			F64 m_a11 = 0.0;
+			F64 m_a12 = 0.0;
+			F64 m_a22 = 0.0;
+			F64 m_b0  = 0.0;
+			F64 m_b1  = 0.0;
+			F64 m_b2  = 0.0;
+			F64 m_c   = 0.0;
+			F64 m_weight = 0.0;
+		};
+
+		/**
+		 A struct of half-edge collapses.
+		 */
+		struct EdgeCollapse {
+
+		public:
+
+			/**
+			 The (welded) vertex to remove.
+			 */
+			std::size_t m_from;
+
+			/**
+			 The (welded) vertex to collapse onto.
+			 */
+			std::size_t m_to;
+
+			/**
+			 The error of this collapse.
+			 */
+			F64 m_error;
+		};
+
+		/**
+		 Returns the key of the given directed edge.
+
+		 @param[in]		a
+						The start vertex.
+		 @param[in]		b
+						The end vertex.
+		 @return		The key of the given directed edge.
+		 */
+		[[nodiscard]]
+		inline U64 GetEdgeKey(std::size_t a, std::size_t b) noexcept {
+			return (static_cast< U64 >(a) << 32u) | static_cast< U64 >(b);
+		}
+	}
+
+	template< typename VertexT, typename IndexT, typename ActionT >
+	void SimplifyMesh(gsl::span< const IndexT > indices,
+					  gsl::span< const VertexT > vertices,
+					  gsl::span< const std::size_t > target_nb_indices,
+					  ActionT&& action) {
+
+		const auto nb_triangles = static_cast< std::size_t >(indices.size()) / 3u;
+		if (0u == nb_triangles || target_nb_indices.empty()) {
+			return;
+		}
+
+		const auto [base, nb_vertices] = details::GetIndexRange(indices);
+
+		// The triangles (vertices relative to the base index).
+		std::vector< std::size_t > triangles(3u * nb_triangles);
+		for (std::size_t i = 0u; i < triangles.size(); ++i) {
+			triangles[i] = static_cast< std::size_t >(
+				indices[static_cast< std::ptrdiff_t >(i)]) - base;
+		}
+
+		std::vector< F32x3 > positions(nb_vertices);
+		for (std::size_t v = 0u; v < nb_vertices; ++v) {
+			const auto& p = vertices[static_cast< std::ptrdiff_t >(base + v)].m_p;
+			positions[v] = { p[0], p[1], p[2] };
+		}
+
+		// Weld the vertices with equal positions.
+		std::vector< std::size_t > welded(nb_vertices);
+		{
+			std::vector< std::size_t > order(nb_vertices);
+			std::iota(order.begin(), order.end(), std::size_t(0u));
+			std::sort(order.begin(), order.end(),
+					  [&positions](std::size_t lhs, std::size_t rhs) noexcept {
+						  return std::tie(positions[lhs], lhs)
+							   < std::tie(positions[rhs], rhs);
+					  });
+
+			for (std::size_t i = 0u; i < nb_vertices; ++i) {
+				const auto v = order[i];
+				welded[v] = (0u != i && positions[order[i - 1u]] == positions[v])
+					      ? welded[order[i - 1u]] : v;
+			}
+		}
+
+		// The remapping of the removed vertices.
+		std::vector< std::size_t > remap(nb_vertices);
+		std::iota(remap.begin(), remap.end(), std::size_t(0u));
+		const auto resolve = [&remap](std::size_t v) noexcept {
+			while (remap[v] != v) {
+				v = remap[v];
+			}
+			return v;
+		};
+
+		std::unordered_set< U64 > edges;
+		const auto update_edges = [&edges, &triangles, &welded]() {
+			edges.clear();
+			for (std::size_t i = 0u; i < triangles.size(); i += 3u) {
+				for (std::size_t j = 0u; j < 3u; ++j) {
+					edges.insert(details::GetEdgeKey(welded[triangles[i + j]],
+													 welded[triangles[i + (j + 1u) % 3u]]));
+				}
+			}
+		};
+		const auto is_border_edge = [&edges](std::size_t a, std::size_t b) {
+			return 0u == edges.count(details::GetEdgeKey(b, a));
+		};
+
+		// Compute the quadrics of the (welded) vertices.
+		std::vector< details::Quadric > quadrics(nb_vertices);
+		update_edges();
+		for (std::size_t i = 0u; i < triangles.size(); i += 3u) {
+			const std::size_t c[] = { welded[triangles[i]],
+									  welded[triangles[i + 1u]],
+									  welded[triangles[i + 2u]] };
+			const auto& p0 = positions[c[0]];
+			const auto n   = details::Cross(details::Subtract(positions[c[1]], p0),
+											details::Subtract(positions[c[2]], p0));
+			const auto length = std::sqrt(details::Dot(n, n));
+			if (0.0f == length) {
+				continue;
+			}
+
+			const F32x3 unit_n = { n[0] / length, n[1] / length, n[2] / length };
+			details::Quadric quadric;
+			quadric.AddPlane(unit_n, p0, 0.5f * length);
+			for (const auto v : c) {
+				quadrics[v] += quadric;
+			}
+
+			// Add the planes perpendicular to the triangle through its border
+			// edges.
+			for (std::size_t j = 0u; j < 3u; ++j) {
+				const auto a = c[j];
+				const auto b = c[(j + 1u) % 3u];
+				if (!is_border_edge(a, b)) {
+					continue;
+				}
+
+				const auto edge = details::Subtract(positions[b], positions[a]);
+				const auto m    = details::Cross(edge, unit_n);
+				const auto m_length = std::sqrt(details::Dot(m, m));
+				if (0.0f == m_length) {
+					continue;
+				}
+
+				details::Quadric border_quadric;
+				border_quadric.AddPlane({ m[0] / m_length, m[1] / m_length, m[2] / m_length },
+										positions[a],
+										details::g_border_weight * details::Dot(edge, edge));
+				quadrics[a] += border_quadric;
+				quadrics[b] += border_quadric;
+			}
+		}
+
+		std::vector< std::size_t > offsets(nb_vertices + 1u);
+		std::vector< std::size_t > adjacency;
+		std::vector< bool > border(nb_vertices);
+		std::vector< bool > locked(nb_vertices);
+		std::vector< details::EdgeCollapse > collapses;
+		std::vector< std::pair< std::size_t, std::size_t > > wedges;
+		std::vector< std::size_t > unpaired_wedges;
+		std::vector< IndexT > lod;
+
+		F64 max_error = 0.0;
+		auto nb_reported_indices = triangles.size();
+		bool stuck = false;
+
+		for (const auto target : target_nb_indices) {
+			const auto target_nb_triangles = target / 3u;
+
+			while (!stuck && target_nb_triangles < triangles.size() / 3u) {
+				// Build the (welded) vertex-triangle adjacency.
+				std::fill(offsets.begin(), offsets.end(), std::size_t(0u));
+				for (const auto v : triangles) {
+					++offsets[welded[v] + 1u];
+				}
+				std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+				adjacency.resize(triangles.size());
+				{
+					std::vector< std::size_t > next(offsets.begin(), offsets.end() - 1);
+					for (std::size_t i = 0u; i < triangles.size(); ++i) {
+						adjacency[next[welded[triangles[i]]]++] = i / 3u;
+					}
+				}
+
+				// Classify the border vertices.
+				update_edges();
+				std::fill(border.begin(), border.end(), false);
+				for (std::size_t i = 0u; i < triangles.size(); i += 3u) {
+					for (std::size_t j = 0u; j < 3u; ++j) {
+						const auto a = welded[triangles[i + j]];
+						const auto b = welded[triangles[i + (j + 1u) % 3u]];
+						if (is_border_edge(a, b)) {
+							border[a] = true;
+							border[b] = true;
+						}
+					}
+				}
+
+				// Collect and sort the candidate collapses. Border vertices can
+				// only be collapsed along border edges.
+				collapses.clear();
+				for (std::size_t i = 0u; i < triangles.size(); i += 3u) {
+					for (std::size_t j = 0u; j < 3u; ++j) {
+						const auto a = welded[triangles[i + j]];
+						const auto b = welded[triangles[i + (j + 1u) % 3u]];
+						const auto border_edge = is_border_edge(a, b);
+
+						for (const auto& [from, to] : { std::make_pair(a, b),
+													   std::make_pair(b, a) }) {
+							if (border[from] && !border_edge) {
+								continue;
+							}
+
+							auto quadric = quadrics[from];
+							quadric += quadrics[to];
+							collapses.push_back({ from, to,
+												  quadric.GetError(positions[to]) });
+						}
+					}
+				}
+				std::sort(collapses.begin(), collapses.end(),
+						  [](const details::EdgeCollapse& lhs,
+							 const details::EdgeCollapse& rhs) noexcept {
+							  return lhs.m_error < rhs.m_error;
+						  });
+
+				// Perform the cheapest independent collapses.
+				const auto goal = triangles.size() / 3u - target_nb_triangles;
+				std::size_t nb_removed_triangles = 0u;
+				std::fill(locked.begin(), locked.end(), false);
+
+				for (const auto& collapse : collapses) {
+					if (goal <= nb_removed_triangles) {
+						break;
+					}
+
+					const auto from = collapse.m_from;
+					const auto to   = collapse.m_to;
+					if (locked[from] || locked[to]) {
+						continue;
+					}
+
+					wedges.clear();
+					unpaired_wedges.clear();
+					std::size_t nb_collapsed_triangles = 0u;
+					bool valid = true;
+
+					for (auto k = offsets[from]; k < offsets[from + 1u] && valid; ++k) {
+						const auto t = 3u * adjacency[k];
+						const std::size_t r[] = { resolve(triangles[t]),
+												  resolve(triangles[t + 1u]),
+												  resolve(triangles[t + 2u]) };
+						const std::size_t c[] = { welded[r[0]], welded[r[1]], welded[r[2]] };
+						if (c[0] == c[1] || c[1] == c[2] || c[2] == c[0]) {
+							continue;
+						}
+
+						const auto j_from = (from == c[0]) ? 0u : (from == c[1]) ? 1u : 2u;
+						const auto j_to   = (to   == c[0]) ? 0u : (to   == c[1]) ? 1u : (to == c[2]) ? 2u : 3u;
+
+						// Triangles containing the edge are removed.
+						if (3u != j_to) {
+							wedges.emplace_back(r[j_from], r[j_to]);
+							++nb_collapsed_triangles;
+							continue;
+						}
+
+						// The remaining triangles may not flip.
+						F32x3 p[] = { positions[c[0]], positions[c[1]], positions[c[2]] };
+						const auto n_before = details::Cross(details::Subtract(p[1], p[0]),
+															 details::Subtract(p[2], p[0]));
+						p[j_from] = positions[to];
+						const auto n_after  = details::Cross(details::Subtract(p[1], p[0]),
+															 details::Subtract(p[2], p[0]));
+						valid = (0.0f < details::Dot(n_before, n_after));
+
+						unpaired_wedges.push_back(r[j_from]);
+					}
+
+					if (!valid || wedges.empty()) {
+						continue;
+					}
+
+					// Each wedge (i.e. vertex with distinct attributes) of the
+					// removed vertex must map to a unique wedge of the kept
+					// vertex to preserve attribute seams.
+					std::sort(wedges.begin(), wedges.end());
+					wedges.erase(std::unique(wedges.begin(), wedges.end()), wedges.end());
+					for (std::size_t i = 1u; i < wedges.size() && valid; ++i) {
+						valid = (wedges[i - 1u].first != wedges[i].first);
+					}
+					for (const auto v : unpaired_wedges) {
+						valid = valid && std::any_of(wedges.begin(), wedges.end(),
+													 [v](const auto& wedge) noexcept {
+														 return v == wedge.first;
+													 });
+					}
+
+					if (!valid) {
+						continue;
+					}
+
+					for (const auto& [v_from, v_to] : wedges) {
+						remap[v_from] = v_to;
+					}
+					quadrics[to] += quadrics[from];
+					max_error = std::max(max_error, collapse.m_error);
+					locked[from] = true;
+					locked[to]   = true;
+					nb_removed_triangles += nb_collapsed_triangles;
+				}
+
+				if (0u == nb_removed_triangles) {
+					stuck = true;
+					break;
+				}
+
+				// Remap the triangles and remove the degenerate triangles.
+				std::size_t nb_indices = 0u;
+				for (std::size_t i = 0u; i < triangles.size(); i += 3u) {
+					const std::size_t r[] = { resolve(triangles[i]),
+											  resolve(triangles[i + 1u]),
+											  resolve(triangles[i + 2u]) };
+					if (welded[r[0]] == welded[r[1]]
+						|| welded[r[1]] == welded[r[2]]
+						|| welded[r[2]] == welded[r[0]]) {
+						continue;
+					}
+
+					triangles[nb_indices++] = r[0];
+					triangles[nb_indices++] = r[1];
+					triangles[nb_indices++] = r[2];
+				}
+				triangles.resize(nb_indices);
+
+				for (auto& v : remap) {
+					v = resolve(v);
+				}
+			}
+
+			if (nb_reported_indices <= triangles.size()) {
+				break;
+			}
+
+			lod.resize(triangles.size());
+			std::transform(triangles.begin(), triangles.end(), lod.begin(),
+						   [base = base](std::size_t v) noexcept {
+							   return static_cast< IndexT >(base + v);
+						   });
+			nb_reported_indices = triangles.size();
+
+			action(gsl::make_span(std::as_const(lod)),
+				   static_cast< F32 >(std::sqrt(max_error)));
+		}
+	}
+}
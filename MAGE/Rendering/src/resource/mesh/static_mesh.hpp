@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\mesh\mesh.hpp"
+#include "resource/mesh/mesh.hpp"
 
 #pragma endregion
 
@@ -62,6 +62,29 @@ namespace mage::rendering {
 			                D3D11_PRIMITIVE_TOPOLOGY primitive_topology
 			                = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
+		/**
+		 Constructs a static mesh without keeping a copy of the given vertices
+		 and indices (e.g., the sections of a memory-mapped file).
+
+		 @param[in]		device
+						A reference to the device.
+		 @param[in]		vertices
+						The vertices.
+		 @param[in]		indices
+						The indices.
+		 @param[in]		primitive_topology
+						The primitive topology.
+		 @throws		Exception
+						Failed to setup the vertex buffer of the static mesh.
+		 @throws		Exception
+						Failed to setup the index buffer of the static mesh.
+		 */
+		explicit StaticMesh(ID3D11Device& device,
+			                gsl::span< const VertexT > vertices,
+			                gsl::span< const IndexT >  indices,
+			                D3D11_PRIMITIVE_TOPOLOGY primitive_topology
+			                = D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
 		/**
 		 Constructs a static mesh from the given static mesh.
 
@@ -118,20 +141,26 @@ namespace mage::rendering {
 
 		 @param[in]		device
 						A reference to the device.
+		 @param[in]		vertices
+						The vertices.
 		 @throws		Exception
 						Failed to setup the vertex buffer of this static mesh.
 		 */
-		void SetupVertexBuffer(ID3D11Device& device);
+		void SetupVertexBuffer(ID3D11Device& device,
+							   gsl::span< const VertexT > vertices);
 
 		/**
 		 Sets up the index buffer of this static mesh.
 
 		 @param[in]		device
 						A reference to the device.
+		 @param[in]		indices
+						The indices.
 		 @throws		Exception
 						Failed to setup the index buffer of this static mesh.
 		 */
-		void SetupIndexBuffer(ID3D11Device& device);
+		void SetupIndexBuffer(ID3D11Device& device,
+							  gsl::span< const IndexT > indices);
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -154,6 +183,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\mesh\static_mesh.tpp"
+#include "resource/mesh/static_mesh.tpp"
 
 #pragma endregion
\ No newline at end of file
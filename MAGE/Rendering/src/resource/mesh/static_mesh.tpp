@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\factory.hpp"
-#include "exception\exception.hpp"
+#include "renderer/factory.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -27,8 +27,24 @@ namespace mage::rendering {
 	    m_vertices(std::move(vertices)),
 		m_indices(std::move(indices)) {
 
-		SetupVertexBuffer(device);
-		SetupIndexBuffer(device);
+		SetupVertexBuffer(device, gsl::make_span(std::as_const(m_vertices)));
+		SetupIndexBuffer(device, gsl::make_span(std::as_const(m_indices)));
+	}
+
+	template< typename VertexT, typename IndexT >
+	StaticMesh< VertexT, IndexT >
+		::StaticMesh(ID3D11Device& device,
+		             gsl::span< const VertexT > vertices,
+		             gsl::span< const IndexT >  indices,
+		             D3D11_PRIMITIVE_TOPOLOGY primitive_topology)
+		: Mesh(sizeof(VertexT),
+			   mage::rendering::GetIndexFormat< IndexT >(),
+			   primitive_topology),
+	    m_vertices(),
+		m_indices() {
+
+		SetupVertexBuffer(device, vertices);
+		SetupIndexBuffer(device, indices);
 	}
 
 	template< typename VertexT, typename IndexT >
@@ -45,25 +61,27 @@ namespace mage::rendering {
 
 	template< typename VertexT, typename IndexT >
 	void StaticMesh< VertexT, IndexT >
-		::SetupVertexBuffer(ID3D11Device& device) {
+		::SetupVertexBuffer(ID3D11Device& device,
+							gsl::span< const VertexT > vertices) {
 
 		const HRESULT result = CreateStaticVertexBuffer(
 			device, NotNull< ID3D11Buffer** >(m_vertex_buffer.ReleaseAndGetAddressOf()),
-			gsl::make_span(static_cast< const std::vector< VertexT >& >(m_vertices)));
+			vertices);
 		ThrowIfFailed(result, "Vertex buffer creation failed: {:08X}.", result);
 
-		SetNumberOfVertices(m_vertices.size());
+		SetNumberOfVertices(static_cast< std::size_t >(vertices.size()));
 	}
 
 	template< typename VertexT, typename IndexT >
 	void StaticMesh< VertexT, IndexT >
-		::SetupIndexBuffer(ID3D11Device& device) {
+		::SetupIndexBuffer(ID3D11Device& device,
+						   gsl::span< const IndexT > indices) {
 
 		const HRESULT result = CreateStaticIndexBuffer(
 			device, NotNull< ID3D11Buffer** >(m_index_buffer.ReleaseAndGetAddressOf()),
-			gsl::make_span(static_cast< const std::vector< IndexT >& >(m_indices)));
+			indices);
 		ThrowIfFailed(result, "Index buffer creation failed: {:08X}.", result);
 
-		SetNumberOfIndices(m_indices.size());
+		SetNumberOfIndices(static_cast< std::size_t >(indices.size()));
 	}
 }
\ No newline at end of file
@@ -5,9 +5,13 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "renderer\pipeline.hpp"
-#include "geometry\geometry.hpp"
-#include "spectrum\spectrum.hpp"
+#include "geometry/geometry.hpp"
+#include "spectrum/spectrum.hpp"
+
+// Direct3D 11 input layouts are only available on Windows.
+#ifdef _WIN32
+	#include "renderer/pipeline.hpp"
+#endif // _WIN32
 
 #pragma endregion
 
@@ -138,6 +142,8 @@ namespace mage::rendering {
 		 */
 		Point3 m_p;
 
+		#ifdef _WIN32
+
 		//---------------------------------------------------------------------
 		// Class Member Variables
 		//---------------------------------------------------------------------
@@ -146,6 +152,8 @@ namespace mage::rendering {
 		 The input element descriptors of a vertex.
 		 */
 		static const D3D11_INPUT_ELEMENT_DESC s_input_element_descs[1u];
+
+		#endif // _WIN32
 	};
 
 	static_assert(12u == sizeof(VertexPosition),
@@ -286,6 +294,8 @@ namespace mage::rendering {
 		 */
 		Normal3 m_n;
 
+		#ifdef _WIN32
+
 		//---------------------------------------------------------------------
 		// Class Member Variables
 		//---------------------------------------------------------------------
@@ -294,6 +304,8 @@ namespace mage::rendering {
 		 The input element descriptors of a vertex.
 		 */
 		static const D3D11_INPUT_ELEMENT_DESC s_input_element_descs[2u];
+
+		#endif // _WIN32
 	};
 
 	static_assert(24u == sizeof(VertexPositionNormal),
@@ -434,6 +446,8 @@ namespace mage::rendering {
 		 */
 		RGBA m_c;
 
+		#ifdef _WIN32
+
 		//---------------------------------------------------------------------
 		// Class Member Variables
 		//---------------------------------------------------------------------
@@ -442,6 +456,8 @@ namespace mage::rendering {
 		 The input element descriptors of a vertex.
 		 */
 		static const D3D11_INPUT_ELEMENT_DESC s_input_element_descs[2u];
+
+		#endif // _WIN32
 	};
 
 	static_assert(28u == sizeof(VertexPositionColor),
@@ -582,6 +598,8 @@ namespace mage::rendering {
 		 */
 		UV m_tex;
 
+		#ifdef _WIN32
+
 		//---------------------------------------------------------------------
 		// Class Member Variables
 		//---------------------------------------------------------------------
@@ -590,6 +608,8 @@ namespace mage::rendering {
 		 The input element descriptors of a vertex.
 		 */
 		static const D3D11_INPUT_ELEMENT_DESC s_input_element_descs[2u];
+
+		#endif // _WIN32
 	};
 
 	static_assert(20u == sizeof(VertexPositionTexture),
@@ -740,6 +760,8 @@ namespace mage::rendering {
 		 */
 		RGBA m_c;
 
+		#ifdef _WIN32
+
 		//---------------------------------------------------------------------
 		// Class Member Variables
 		//---------------------------------------------------------------------
@@ -748,6 +770,8 @@ namespace mage::rendering {
 		 The input element descriptors of a vertex.
 		 */
 		static const D3D11_INPUT_ELEMENT_DESC s_input_element_descs[3u];
+
+		#endif // _WIN32
 	};
 
 	static_assert(40u == sizeof(VertexPositionNormalColor),
@@ -897,6 +921,8 @@ namespace mage::rendering {
 		 */
 		UV m_tex;
 
+		#ifdef _WIN32
+
 		//---------------------------------------------------------------------
 		// Class Member Variables
 		//---------------------------------------------------------------------
@@ -905,6 +931,8 @@ namespace mage::rendering {
 		 The input element descriptors of a vertex.
 		 */
 		static const D3D11_INPUT_ELEMENT_DESC s_input_element_descs[3u];
+
+		#endif // _WIN32
 	};
 
 	static_assert(32u == sizeof(VertexPositionNormalTexture),
@@ -1055,6 +1083,8 @@ namespace mage::rendering {
 		 */
 		UV m_tex;
 
+		#ifdef _WIN32
+
 		//---------------------------------------------------------------------
 		// Class Member Variables
 		//---------------------------------------------------------------------
@@ -1063,6 +1093,8 @@ namespace mage::rendering {
 		 The input element descriptors of a vertex.
 		 */
 		static const D3D11_INPUT_ELEMENT_DESC s_input_element_descs[3u];
+
+		#endif // _WIN32
 	};
 
 	static_assert(36u == sizeof(VertexPositionColorTexture),
@@ -1222,6 +1254,8 @@ namespace mage::rendering {
 		 */
 		UV m_tex;
 
+		#ifdef _WIN32
+
 		//---------------------------------------------------------------------
 		// Class Member Variables
 		//---------------------------------------------------------------------
@@ -1230,8 +1264,161 @@ namespace mage::rendering {
 		 The input element descriptors of a vertex.
 		 */
 		static const D3D11_INPUT_ELEMENT_DESC s_input_element_descs[4u];
+
+		#endif // _WIN32
 	};
 
 	static_assert(48u == sizeof(VertexPositionNormalColorTexture),
 				  "Vertex struct/layout mismatch");
+
+	/**
+	 A struct of packed vertices containing position, normal and texture
+	 coordinates.
+
+	 The position is quantized to 16-bit normalized coordinates relative to
+	 the AABB of its model part, the normal is octahedron encoded in two
+	 16-bit normalized coordinates and the texture coordinates are stored as
+	 half-precision floating point values.
+	 */
+	struct PackedVertexPositionNormalTexture {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether vertices have a position.
+
+		 @return		@c true if vertices have a position. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static constexpr bool HasPosition() noexcept {
+			return true;
+		}
+
+		/**
+		 Checks whether vertices have a normal.
+
+		 @return		@c true if vertices have a normal. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static constexpr bool HasNormal() noexcept {
+			return true;
+		}
+
+		/**
+		 Checks whether vertices have a texture.
+
+		 @return		@c true if vertices have a texture. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static constexpr bool HasTexture() noexcept {
+			return true;
+		}
+
+		/**
+		 Checks whether vertices have a color.
+
+		 @return		@c true if vertices have a color. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static constexpr bool HasColor() noexcept {
+			return false;
+		}
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a vertex.
+		 */
+		constexpr PackedVertexPositionNormalTexture() noexcept = default;
+
+		/**
+		 Constructs a vertex from the given vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to copy.
+		 */
+		constexpr PackedVertexPositionNormalTexture(
+			const PackedVertexPositionNormalTexture& vertex) noexcept = default;
+
+		/**
+		 Constructs a vertex by moving the given vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to move.
+		 */
+		constexpr PackedVertexPositionNormalTexture(
+			PackedVertexPositionNormalTexture&& vertex) noexcept = default;
+
+		/**
+		 Destructs this vertex.
+		 */
+		~PackedVertexPositionNormalTexture() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given vertex to this vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to copy.
+		 @return		A reference to the copy of the given vertex (i.e. this
+						vertex).
+		 */
+		PackedVertexPositionNormalTexture& operator=(
+			const PackedVertexPositionNormalTexture& vertex) noexcept = default;
+
+		/**
+		 Moves the given vertex to this vertex.
+
+		 @param[in]		vertex
+						A reference to the vertex to move.
+		 @return		A reference to the moved vertex (i.e. this vertex).
+		 */
+		PackedVertexPositionNormalTexture& operator=(
+			PackedVertexPositionNormalTexture&& vertex) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The quantized position of this vertex (the fourth component is
+		 padding).
+		 */
+		S16x4 m_p = {};
+
+		/**
+		 The octahedron encoded normal of this vertex.
+		 */
+		S16x2 m_n = {};
+
+		/**
+		 The half-precision texture coordinates of this vertex.
+		 */
+		U16x2 m_tex = {};
+
+		#ifdef _WIN32
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The input element descriptors of a vertex.
+		 */
+		static const D3D11_INPUT_ELEMENT_DESC s_input_element_descs[3u];
+
+		#endif // _WIN32
+	};
+
+	static_assert(16u == sizeof(PackedVertexPositionNormalTexture),
+				  "Vertex struct/layout mismatch");
 }
\ No newline at end of file
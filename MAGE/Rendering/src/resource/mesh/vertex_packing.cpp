@@ -0,0 +1,149 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/mesh/vertex_packing.hpp"
+#include "logging/logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <DirectXPackedVector.h>
+#include <emmintrin.h>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 The scale of 16-bit normalized coordinates.
+		 */
+		constexpr F32 g_snorm16_scale = 32767.0f;
+	}
+
+	PositionQuantization::PositionQuantization(const AABB& aabb) noexcept {
+		const auto p_min = aabb.MinPoint();
+		const auto p_max = aabb.MaxPoint();
+
+		// Empty AABBs result in an identity quantization.
+		if (XMVector3Greater(p_min, p_max)) {
+			return;
+		}
+
+		// Avoid divisions by zero for flat AABBs.
+		const auto scale = XMVectorMax(aabb.Radius(),
+									   XMVectorReplicate(1e-6f));
+		m_offset = XMStore< F32x3 >(aabb.Centroid());
+		m_scale  = XMStore< F32x3 >(scale);
+	}
+
+	[[nodiscard]]
+	const XMVECTOR XM_CALLCONV EncodeOctahedron(FXMVECTOR n) noexcept {
+		const auto zero = XMVectorZero();
+		const auto one  = XMVectorSplatOne();
+
+		// Project on the octahedron.
+		const auto u = n / XMVector3Dot(XMVectorAbs(n), one);
+
+		// Fold the lower hemisphere over the diagonals.
+		const auto u_yx = XMVectorSwizzle< 1, 0, 2, 3 >(u);
+		const auto sign = XMVectorSelect(-one, one,
+										 XMVectorGreaterOrEqual(u, zero));
+		const auto wrap = (one - XMVectorAbs(u_yx)) * sign;
+
+		return XMVectorSelect(u, wrap, XMVectorLess(XMVectorSplatZ(u), zero));
+	}
+
+	[[nodiscard]]
+	const XMVECTOR XM_CALLCONV DecodeOctahedron(FXMVECTOR e) noexcept {
+		const auto zero  = XMVectorZero();
+		const auto abs_e = XMVectorAbs(e);
+
+		const auto z  = XMVectorSplatOne()
+			          - XMVectorSplatX(abs_e) - XMVectorSplatY(abs_e);
+		const auto s  = XMVectorSaturate(-z);
+		const auto xy = e + XMVectorSelect(s, -s,
+										   XMVectorGreaterOrEqual(e, zero));
+
+		return XMVector3Normalize(XMVectorSelect(xy, z,
+												 XMVectorSelectControl(0u, 0u, 1u, 1u)));
+	}
+
+	void PackVertices(
+		gsl::span< const VertexPositionNormalTexture > vertices,
+		const PositionQuantization& quantization,
+		gsl::span< PackedVertexPositionNormalTexture > packed_vertices) noexcept {
+
+		Assert(vertices.size() == packed_vertices.size());
+
+		const auto scale     = XMVectorReplicate(g_snorm16_scale);
+		const auto offset    = XMLoad(quantization.m_offset);
+		const auto inv_scale = XMVectorReciprocal(XMLoad(quantization.m_scale));
+		const auto mask      = XMVectorSelectControl(1u, 1u, 1u, 0u);
+
+		auto output = packed_vertices.begin();
+		for (const auto& vertex : vertices) {
+			const auto p = XMVectorAndInt(
+				(XMLoad(vertex.m_p) - offset) * inv_scale, mask);
+			const auto n = XMVectorAndInt(
+				EncodeOctahedron(XMLoad(vertex.m_n)),
+				XMVectorSelectControl(1u, 1u, 0u, 0u));
+
+			// Convert (with rounding) and pack (with saturation) the position
+			// and normal to 16-bit normalized coordinates.
+			auto packed = _mm_packs_epi32(_mm_cvtps_epi32(p * scale),
+										  _mm_cvtps_epi32(n * scale));
+
+			// Insert the half-precision texture coordinates.
+			const auto u = PackedVector::XMConvertFloatToHalf(vertex.m_tex[0]);
+			const auto v = PackedVector::XMConvertFloatToHalf(vertex.m_tex[1]);
+			packed = _mm_insert_epi16(packed, static_cast< int >(u), 6);
+			packed = _mm_insert_epi16(packed, static_cast< int >(v), 7);
+
+			_mm_storeu_si128(reinterpret_cast< __m128i* >(&*output), packed);
+			++output;
+		}
+	}
+
+	void UnpackVertices(
+		gsl::span< const PackedVertexPositionNormalTexture > packed_vertices,
+		const PositionQuantization& quantization,
+		gsl::span< VertexPositionNormalTexture > vertices) noexcept {
+
+		Assert(packed_vertices.size() == vertices.size());
+
+		const auto inv_scale = XMVectorReplicate(1.0f / g_snorm16_scale);
+		const auto offset    = XMLoad(quantization.m_offset);
+		const auto scale     = XMLoad(quantization.m_scale);
+		const auto minimum   = -XMVectorSplatOne();
+
+		auto output = vertices.begin();
+		for (const auto& packed_vertex : packed_vertices) {
+			const auto packed = _mm_loadu_si128(
+				reinterpret_cast< const __m128i* >(&packed_vertex));
+
+			// Sign extend the 16-bit normalized coordinates.
+			const auto p_snorm = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+			const auto n_snorm = _mm_srai_epi32(_mm_unpackhi_epi16(packed, packed), 16);
+
+			const auto p = XMVectorMax(_mm_cvtepi32_ps(p_snorm) * inv_scale, minimum);
+			const auto n = XMVectorMax(_mm_cvtepi32_ps(n_snorm) * inv_scale, minimum);
+
+			output->m_p   = Point3(XMStore< F32x3 >(p * scale + offset));
+			output->m_n   = Normal3(XMStore< F32x3 >(DecodeOctahedron(n)));
+			output->m_tex = UV(PackedVector::XMConvertHalfToFloat(packed_vertex.m_tex[0]),
+							   PackedVector::XMConvertHalfToFloat(packed_vertex.m_tex[1]));
+			++output;
+		}
+	}
+}
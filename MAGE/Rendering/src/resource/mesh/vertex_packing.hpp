@@ -0,0 +1,145 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/mesh/vertex.hpp"
+#include "geometry/bounding_volume.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <gsl/span>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A struct of position quantizations mapping the positions inside an AABB
+	 to the [-1,1] range of 16-bit normalized coordinates.
+	 */
+	struct PositionQuantization {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an identity position quantization.
+		 */
+		PositionQuantization() noexcept = default;
+
+		/**
+		 Constructs a position quantization for the given AABB.
+
+		 @param[in]		aabb
+						A reference to the AABB containing all positions to
+						quantize.
+		 */
+		explicit PositionQuantization(const AABB& aabb) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the dequantization matrix of this position quantization.
+
+		 The dequantization matrix transforms quantized positions to object
+		 space and can be concatenated with the object-to-world matrix.
+
+		 @return		The dequantization matrix of this position
+						quantization.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV GetDequantizationMatrix() const noexcept {
+			return XMMatrixScaling(m_scale[0], m_scale[1], m_scale[2])
+				 * XMMatrixTranslation(m_offset[0], m_offset[1], m_offset[2]);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The offset (i.e. the centroid of the quantization box) of this
+		 position quantization.
+		 */
+		F32x3 m_offset = { 0.0f, 0.0f, 0.0f };
+
+		/**
+		 The scale (i.e. the radius of the quantization box) of this position
+		 quantization.
+		 */
+		F32x3 m_scale = { 1.0f, 1.0f, 1.0f };
+	};
+
+	/**
+	 Encodes the given unit vector using an octahedron encoding.
+
+	 @pre			@a n is unit vectorized.
+	 @param[in]		n
+					The unit vector in the [-1,1] range to encode.
+	 @return		The encoded unit vector in the [-1,1] range (x and y
+					components).
+	 */
+	[[nodiscard]]
+	const XMVECTOR XM_CALLCONV EncodeOctahedron(FXMVECTOR n) noexcept;
+
+	/**
+	 Decodes the given octahedron encoded unit vector.
+
+	 @param[in]		e
+					The encoded unit vector in the [-1,1] range (x and y
+					components).
+	 @return		The decoded unit vector in the [-1,1] range.
+	 */
+	[[nodiscard]]
+	const XMVECTOR XM_CALLCONV DecodeOctahedron(FXMVECTOR e) noexcept;
+
+	/**
+	 Packs the given vertices.
+
+	 @pre			The sizes of @a vertices and @a packed_vertices are
+					equal.
+	 @param[in]		vertices
+					The vertices to pack.
+	 @param[in]		quantization
+					A reference to the position quantization.
+	 @param[out]	packed_vertices
+					The packed vertices.
+	 */
+	void PackVertices(
+		gsl::span< const VertexPositionNormalTexture > vertices,
+		const PositionQuantization& quantization,
+		gsl::span< PackedVertexPositionNormalTexture > packed_vertices) noexcept;
+
+	/**
+	 Unpacks the given packed vertices.
+
+	 @pre			The sizes of @a packed_vertices and @a vertices are
+					equal.
+	 @param[in]		packed_vertices
+					The packed vertices to unpack.
+	 @param[in]		quantization
+					A reference to the position quantization.
+	 @param[out]	vertices
+					The unpacked vertices.
+	 */
+	void UnpackVertices(
+		gsl::span< const PackedVertexPositionNormalTexture > packed_vertices,
+		const PositionQuantization& quantization,
+		gsl::span< VertexPositionNormalTexture > vertices) noexcept;
+}
@@ -6,8 +6,12 @@
 #pragma region
 
 #include "math_utils.hpp"
-#include "spectrum\spectrum.hpp"
-#include "resource\texture\texture.hpp"
+#include "spectrum/spectrum.hpp"
+
+// Direct3D 11 textures are only available on Windows.
+#ifdef _WIN32
+	#include "resource/texture/texture.hpp"
+#endif // _WIN32
 
 #pragma endregion
 
@@ -16,6 +20,13 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	class Texture;
+
+	/**
+	 A pointer to a texture resource.
+	 */
+	using TexturePtr = SharedPtr< const Texture >;
+
 	/**
 	 A class of materials.
 	 */
@@ -122,6 +133,8 @@ namespace mage::rendering {
 			return m_base_color_texture;
 		}
 
+		#ifdef _WIN32
+
 		/**
 		 Returns the shader resource view of the base color texture of this
 		 material.
@@ -135,6 +148,8 @@ namespace mage::rendering {
 			return m_base_color_texture ? m_base_color_texture->Get() : nullptr;
 		}
 
+		#endif // _WIN32
+
 		/**
 		 Sets the base color texture of this material to the given base color
 		 texture.
@@ -210,6 +225,8 @@ namespace mage::rendering {
 			return m_material_texture;
 		}
 
+		#ifdef _WIN32
+
 		/**
 		 Returns the shader resource view of the material texture of this
 		 material.
@@ -223,6 +240,8 @@ namespace mage::rendering {
 			return m_material_texture ? m_material_texture->Get() : nullptr;
 		}
 
+		#endif // _WIN32
+
 		/**
 		 Sets the material texture of this material to the given material
 		 texture.
@@ -248,6 +267,8 @@ namespace mage::rendering {
 			return m_normal_texture;
 		}
 
+		#ifdef _WIN32
+
 		/**
 		 Returns the shader resource view of the normal texture of this
 		 material.
@@ -261,6 +282,8 @@ namespace mage::rendering {
 			return m_normal_texture ? m_normal_texture->Get() : nullptr;
 		}
 
+		#endif // _WIN32
+
 		/**
 		 Sets the normal texture of this material to the given normal texture.
 
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\rendering_resource_manager.hpp"
+#include "resource/rendering_resource_manager.hpp"
 
 #pragma endregion
 
@@ -5,8 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\mesh\static_mesh.hpp"
-#include "loaders\model_loader.hpp"
+#include "resource/mesh/static_mesh.hpp"
+#include "resource/model/model_packing.hpp"
+#include "loaders/model_loader.hpp"
 
 #pragma endregion
 
@@ -38,7 +39,9 @@ namespace mage::rendering {
 		 Constructs a model descriptor.
 
 		 @tparam		VertexT
-						The vertex type.
+						The vertex type. The vertices are packed for the
+						vertex shaders of models, which only support
+						@c VertexPositionNormalTexture.
 		 @tparam		IndexT
 						The index type.
 		 @param[in]		device
@@ -166,8 +169,42 @@ namespace mage::rendering {
 		template< typename ActionT >
 		void ForEachModelPart(ActionT&& action) const;
 
+		/**
+		 Returns the model parts of this model descriptor.
+
+		 @return		The model parts of this model descriptor.
+		 */
+		[[nodiscard]]
+		gsl::span< const ModelPart > GetModelParts() const noexcept {
+			return m_model_parts;
+		}
+
 	private:
 
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Creates the packed mesh of the model of this model descriptor and
+		 sets the base vertex and position quantization of the model parts of
+		 the given model output.
+
+		 @pre			The model parts of the given model output are separated.
+		 @tparam		IndexT
+						The index type.
+		 @param[in]		device
+						A reference to the device.
+		 @param[in,out]	model_output
+						A reference to the model output.
+		 @throws		Exception
+						Failed to create the packed mesh.
+		 */
+		template< typename IndexT >
+		void CreatePackedMesh(
+			ID3D11Device& device,
+			ModelOutput< VertexPositionNormalTexture, IndexT >& model_output);
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -210,6 +247,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\model\model_descriptor.tpp"
+#include "resource/model/model_descriptor.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -16,9 +16,64 @@ namespace mage::rendering {
 		m_materials(),
 		m_model_parts() {
 
+		// The vertex shaders of models only support packed vertices.
+		static_assert(std::is_same_v< VertexPositionNormalTexture, VertexT >,
+					  "Models only support VertexPositionNormalTexture vertices.");
+
 		ModelOutput< VertexT, IndexT > buffer;
 		loader::ImportModelFromFile(GetPath(), resource_manager, buffer, desc);
 
+		// Generate the levels of detail unless the model already has them.
+		const auto has_lods = std::any_of(buffer.m_model_parts.begin(),
+										  buffer.m_model_parts.end(),
+										  [](const ModelPart& model_part) noexcept {
+											  return !model_part.m_lods.empty();
+										  });
+		const auto generate_lods = !has_lods && (1u < desc.GetNumberOfLODs());
+
+		// Partition the model parts into mesh clusters unless the model
+		// already has them.
+		const auto has_clusters = std::any_of(buffer.m_model_parts.begin(),
+											  buffer.m_model_parts.end(),
+											  [](const ModelPart& model_part) noexcept {
+												  return !model_part.m_clusters.empty();
+											  });
+		const auto generate_clusters = !has_clusters;
+
+		// A mapped (packed) mesh is uploaded as is, unless it needs to be
+		// modified or exported (the exported files may be the mapped files).
+		// Unpacked meshes are packed before their upload.
+		if (export_as_MDL || generate_lods || generate_clusters
+			|| !buffer.HasMappedPackedMesh()) {
+			buffer.UnmapMesh();
+		}
+
+		if (generate_lods) {
+			buffer.GenerateLODs(desc.GetNumberOfLODs());
+		}
+		if (generate_clusters) {
+			buffer.ClusterModelParts();
+		}
+
+		// Build the triangle bounding volume hierarchies for ray casting and
+		// the occluder meshes for occlusion culling before the vertex
+		// positions are quantized, unless the model is cooked with them and
+		// its levels of detail and mesh clusters are not regenerated.
+		const auto has_bvhs = std::all_of(buffer.m_model_parts.begin(),
+										  buffer.m_model_parts.end(),
+										  [](const ModelPart& model_part) noexcept {
+											  return nullptr != model_part.m_bvh
+												  && nullptr != model_part.m_occluder;
+										  });
+		if (!has_bvhs || generate_lods || generate_clusters) {
+			buffer.BuildModelPartBVHs();
+			buffer.BuildModelPartOccluders();
+		}
+
+		if (!buffer.HasMappedPackedMesh()) {
+			buffer.SeparateModelParts();
+		}
+
 		if (export_as_MDL) {
 			auto mdl_path = GetPath();
 			mdl_path.replace_extension(L".mdl");
@@ -26,14 +81,61 @@ namespace mage::rendering {
 			loader::ExportModelToFile(mdl_path, buffer);
 		}
 
-		m_mesh = MakeShared< StaticMesh< VertexT, IndexT > >(
-			               device,
-			               std::move(buffer.m_vertex_buffer),
-			               std::move(buffer.m_index_buffer));
+		if (buffer.HasMappedPackedMesh()) {
+			// Upload the stored packed vertices and indices without
+			// requantizing them.
+			std::visit([this, &device](const auto& mesh) {
+				using MeshT = std::decay_t< decltype(mesh) >;
+				if constexpr (!std::is_same_v< std::monostate, MeshT >) {
+					using MeshVertexT = typename decltype(mesh.m_vertices)::value_type;
+					using MeshIndexT  = typename decltype(mesh.m_indices)::value_type;
+					m_mesh = MakeShared< StaticMesh< MeshVertexT, MeshIndexT > >(
+						device, mesh.m_vertices, mesh.m_indices);
+				}
+			}, buffer.m_mapped_packed_mesh);
+		}
+		else {
+			CreatePackedMesh(device, buffer);
+		}
+
 		m_materials   = std::move(buffer.m_material_buffer);
 		m_model_parts = std::move(buffer.m_model_parts);
 	}
 
+	template< typename IndexT >
+	void ModelDescriptor::CreatePackedMesh(
+		ID3D11Device& device,
+		ModelOutput< VertexPositionNormalTexture, IndexT >& model_output) {
+
+		std::vector< PackedModelPart > packed_model_parts;
+		[[maybe_unused]] const auto separated
+			= ComputePackedModelParts(model_output, packed_model_parts);
+		Assert(separated);
+
+		const auto packed_parts = gsl::make_span(std::as_const(packed_model_parts));
+		std::vector< PackedVertexPositionNormalTexture > vertices;
+		
+		if (HasShortIndices(packed_parts)) {
+			std::vector< U16 > indices;
+			PackModel(model_output, packed_parts, vertices, indices);
+			m_mesh = MakeShared< StaticMesh< PackedVertexPositionNormalTexture, U16 > >(
+				device, std::move(vertices), std::move(indices));
+		}
+		else {
+			std::vector< U32 > indices;
+			PackModel(model_output, packed_parts, vertices, indices);
+			m_mesh = MakeShared< StaticMesh< PackedVertexPositionNormalTexture, U32 > >(
+				device, std::move(vertices), std::move(indices));
+		}
+
+		// Set the base vertex and position quantization of the model parts.
+		auto& model_parts = model_output.m_model_parts;
+		for (std::size_t i = 0u; i < model_parts.size(); ++i) {
+			model_parts[i].m_base_vertex  = packed_model_parts[i].m_base_vertex;
+			model_parts[i].m_quantization = packed_model_parts[i].m_quantization;
+		}
+	}
+
 	template< typename ActionT >
 	void ModelDescriptor::ForEachMaterial(ActionT&& action) const {
 		for (const auto& material : m_materials) {
@@ -5,10 +5,30 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "transform\transform.hpp"
-#include "geometry\bounding_volume.hpp"
-#include "resource\model\material.hpp"
-#include "collection\vector.hpp"
+#include "transform/transform.hpp"
+#include "geometry/bounding_volume.hpp"
+#include "geometry/triangle_bvh.hpp"
+#include "geometry/occlusion_buffer.hpp"
+#include "resource/model/material.hpp"
+#include "resource/mesh/vertex_packing.hpp"
+#include "resource/mesh/mapped_mesh.hpp"
+#include "resource/mesh/mesh_optimizer.hpp"
+#include "resource/mesh/mesh_simplifier.hpp"
+#include "resource/mesh/mesh_cluster.hpp"
+#include "memory/memory.hpp"
+#include "collection/vector.hpp"
+#include "parallel/parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
 
 #pragma endregion
 
@@ -17,6 +37,36 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	/**
+	 A struct of model part levels of detail.
+	 */
+	struct ModelPartLOD {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The start index of this model part level of detail in the mesh of
+		 the corresponding model.
+		 */
+		U32 m_start_index = 0u;
+
+		/**
+		 The number of indices of this model part level of detail in the mesh
+		 of the corresponding model.
+		 */
+		U32 m_nb_indices = 0u;
+
+		/**
+		 The (object space) error of this model part level of detail with
+		 regard to the full detail model part.
+		 */
+		F32 m_error = 0.0f;
+	};
+
 	/**
 	 A struct of model parts.
 	 */
@@ -95,6 +145,11 @@ namespace mage::rendering {
 		 */
 		BoundingSphere m_sphere;
 
+		/**
+		 The OBB of this model part.
+		 */
+		OBB m_obb;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Transform
 		//---------------------------------------------------------------------
@@ -120,6 +175,43 @@ namespace mage::rendering {
 		 */
 		U32 m_nb_indices = 0u;
 
+		/**
+		 The base vertex which is added to each index of this model part
+		 before reading a vertex from the vertex buffer of the mesh of the
+		 corresponding model.
+		 */
+		U32 m_base_vertex = 0u;
+
+		/**
+		 The quantization of the (packed) vertex positions of this model part.
+		 */
+		PositionQuantization m_quantization;
+
+		/**
+		 The coarser levels of detail of this model part (in order of
+		 decreasing detail). The levels of detail reference a subset of the
+		 vertices of this model part.
+		 */
+		std::vector< ModelPartLOD > m_lods;
+
+		/**
+		 The mesh clusters of (the full detail of) this model part. The mesh
+		 clusters partition the indices of this model part.
+		 */
+		std::vector< MeshCluster > m_clusters;
+
+		/**
+		 A pointer to the triangle bounding volume hierarchy of (the full
+		 detail of) this model part for ray casting.
+		 */
+		SharedPtr< const TriangleBVH > m_bvh;
+
+		/**
+		 A pointer to the occluder mesh of this model part for occlusion
+		 culling.
+		 */
+		SharedPtr< const OccluderMesh > m_occluder;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Scene Graph
 		//---------------------------------------------------------------------
@@ -171,13 +263,144 @@ namespace mage::rendering {
 
 		/**
 		 Computes the bounding volumes of the model parts of this model output.
+
+		 The model parts are distributed over the cores of the system.
 		 */
-		void ComputeBoundingVolumes() noexcept;
+		void ComputeBoundingVolumes();
 
 		/**
 		 Normalizes the model parts of this model output.
 		 */
-		void NormalizeModelParts() noexcept;
+		void NormalizeModelParts();
+
+		/**
+		 Separates the model parts of this model output.
+
+		 After separation, each model part (including its levels of detail)
+		 references its own contiguous range of vertices (in order of first
+		 use). Vertices shared by multiple model parts are duplicated and
+		 unreferenced vertices are removed.
+		 */
+		void SeparateModelParts();
+
+		/**
+		 Optimizes the model parts of this model output for rendering.
+
+		 The triangles of each model part are reordered for the post-transform
+		 vertex cache and (optionally) overdraw, after which the model parts
+		 are separated so that their vertices are fetched in order of first
+		 use.
+
+		 @param[in]		optimize_overdraw
+						@c true if the triangles of each model part need to be
+						reordered to reduce overdraw. @c false otherwise.
+		 */
+		void OptimizeModelParts(bool optimize_overdraw = true);
+
+		/**
+		 Generates the levels of detail of the model parts of this model
+		 output.
+
+		 The indices of each model part are followed by the indices of its
+		 levels of detail. Model parts which cannot be simplified any further
+		 have fewer levels of detail.
+
+		 @param[in]		nb_lods
+						The number of levels of detail (including the full
+						detail) per model part.
+		 @param[in]		reduction
+						The ratio of the number of triangles of consecutive
+						levels of detail.
+		 */
+		void GenerateLODs(std::size_t nb_lods, F32 reduction = 0.5f);
+
+		/**
+		 Partitions (the full detail of) the model parts of this model output
+		 into mesh clusters.
+
+		 The triangles of each model part are reordered so that each mesh
+		 cluster references a contiguous range of indices. The levels of
+		 detail are not affected.
+
+		 @param[in]		max_nb_triangles
+						The maximum number of triangles per mesh cluster.
+		 */
+		void ClusterModelParts(
+			std::size_t max_nb_triangles = g_cluster_max_nb_triangles);
+
+		/**
+		 Builds the triangle bounding volume hierarchies of (the full detail
+		 of) the model parts of this model output for ray casting.
+
+		 The triangle bounding volume hierarchies are built in object space
+		 (i.e. before the vertex positions are quantized).
+		 */
+		void BuildModelPartBVHs();
+
+		/**
+		 Builds the occluder meshes of the model parts of this model output
+		 for occlusion culling.
+
+		 The occluder mesh of each model part is the finest level of detail
+		 with at most the given number of triangles and with an error of at
+		 most @c g_occluder_max_relative_error (relative to the diagonal of
+		 the AABB of the model part). Model parts without such a level of
+		 detail have no occluder mesh. The occluder meshes are built in
+		 object space (i.e. before the vertex positions are quantized).
+
+		 @param[in]		max_nb_triangles
+						The maximum number of triangles per occluder mesh.
+		 */
+		void BuildModelPartOccluders(
+			std::size_t max_nb_triangles = g_occluder_max_nb_triangles);
+
+		/**
+		 Copies the vertices and indices of the mapped (packed) mesh of this
+		 model output (if any) to the vertex and index buffers of this model
+		 output and releases the mapped (packed) mesh.
+
+		 Packed vertices are unpacked and packed indices are rebased, after
+		 which the model parts of this model output have no base vertex and
+		 position quantization anymore.
+		 */
+		void UnmapMesh();
+
+		/**
+		 Checks whether this model output has a mapped packed mesh.
+
+		 @return		@c true if this model output has a mapped packed
+						mesh. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool HasMappedPackedMesh() const noexcept {
+			return !std::holds_alternative< std::monostate >(m_mapped_packed_mesh);
+		}
+
+		/**
+		 Returns the vertices of this model output.
+
+		 @return		The vertices of the mapped mesh of this model output
+						if this model output has a mapped mesh. The vertices
+						of the vertex buffer of this model output otherwise.
+		 */
+		[[nodiscard]]
+		gsl::span< const VertexT > GetVertices() const noexcept {
+			return m_mapped_mesh.IsMapped() ? m_mapped_mesh.m_vertices
+				                            : gsl::make_span(m_vertex_buffer);
+		}
+
+		/**
+		 Returns the indices of this model output.
+
+		 @return		The indices of the mapped mesh of this model output
+						if this model output has a mapped mesh. The indices
+						of the index buffer of this model output otherwise.
+		 */
+		[[nodiscard]]
+		gsl::span< const IndexT > GetIndices() const noexcept {
+			return m_mapped_mesh.IsMapped() ? m_mapped_mesh.m_indices
+				                            : gsl::make_span(m_index_buffer);
+		}
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -193,6 +416,21 @@ namespace mage::rendering {
 		 */
 		std::vector< IndexT > m_index_buffer;
 
+		/**
+		 The mapped mesh of this model output. If mapped, the vertex and index
+		 buffers of this model output are empty and the mesh is uploaded from
+		 the mapped mesh without copying it.
+		 */
+		MappedMesh< VertexT, IndexT > m_mapped_mesh;
+
+		/**
+		 The mapped packed mesh of this model output. If mapped, the vertex
+		 and index buffers of this model output are empty, the model parts of
+		 this model output contain their base vertex and position
+		 quantization, and the packed mesh is uploaded without repacking it.
+		 */
+		MappedPackedMesh m_mapped_packed_mesh;
+
 		/**
 		 A vector containing the materials of this model output.
 		 */
@@ -216,8 +454,79 @@ namespace mage::rendering {
 
 		/**
 		 Normalizes the vertices in object space of this model output.
+
+		 The model parts are distributed over the cores of the system.
+
+		 @pre			The model parts of this model output are separated
+						(see @c SeparateModelParts).
+		 */
+		void NormalizeInObjectSpace();
+
+		/**
+		 Calls the given action for each model part of this model output.
+		 The model parts are distributed over the cores of the system.
+
+		 @tparam		ActionT
+						An action to perform on each model part. This action
+						must accept a (non-const) model part and a
+						(thread-local) vector of points as scratch memory.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename ActionT >
+		void ForEachModelPartParallel(ActionT&& action);
+
+		/**
+		 Calls the given action for each model part of this model output
+		 with the (object-space) vertices and the indices of its mesh.
+
+		 The vertices of the model parts of a mapped packed mesh are unpacked
+		 one model part at a time into scratch memory. In that case, the
+		 indices are relative to the first of these vertices.
+
+		 @tparam		ActionT
+						An action to perform on each model part. This action
+						must accept a (non-const) model part, a span of
+						vertices, a span of indices (of any index type) and
+						the base vertex which is added to each index before
+						reading a vertex.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename ActionT >
+		void ForEachModelPartMesh(ActionT&& action);
+
+		/**
+		 Returns the number of vertices referenced by the given model part
+		 (including its levels of detail) relative to its base vertex.
+
+		 @tparam		MeshIndexT
+						The index type.
+		 @param[in]		model_part
+						A reference to the model part.
+		 @param[in]		indices
+						The indices (relative to the base vertex of the given
+						model part).
+		 @return		The number of vertices referenced by the given model
+						part.
+		 */
+		template< typename MeshIndexT >
+		[[nodiscard]]
+		static std::size_t GetNumberOfVertices(
+			const ModelPart& model_part,
+			gsl::span< const MeshIndexT > indices) noexcept;
+
+		/**
+		 Fits the bounding sphere and the OBB of the given model part of this
+		 model output to the given points.
+
+		 @param[in,out]	model_part
+						A reference to the model part.
+		 @param[in]		points
+						The (object-space) points of the model part.
 		 */
-		void NormalizeInObjectSpace() noexcept;
+		static void FitBoundingVolumes(ModelPart& model_part,
+									   gsl::span< const Point3 > points) noexcept;
 	};
 }
 
@@ -226,6 +535,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\model\model_output.tpp"
+#include "resource/model/model_output.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -20,35 +20,276 @@ namespace mage::rendering {
 	}
 
 	template< typename VertexT, typename IndexT >
-	void ModelOutput< VertexT, IndexT >::ComputeBoundingVolumes() noexcept {
-		for (auto& model_part : m_model_parts) {
+	void ModelOutput< VertexT, IndexT >::ComputeBoundingVolumes() {
+		const auto indices  = GetIndices();
+		const auto vertices = GetVertices();
+
+		ForEachModelPartParallel([indices, vertices](ModelPart& model_part,
+													 std::vector< Point3 >& points) {
 			const std::size_t start = model_part.m_start_index;
 			const std::size_t end   = start + model_part.m_nb_indices;
 
-			// Set AABB.
-			model_part.m_aabb = AABB();
+			points.clear();
 			for (auto i = start; i < end; ++i) {
-				const auto& vertex = m_vertex_buffer[m_index_buffer[i]];
-				model_part.m_aabb = AABB::Union(model_part.m_aabb, vertex);
+				const auto index = indices[static_cast< std::ptrdiff_t >(i)];
+				points.push_back(vertices[static_cast< std::ptrdiff_t >(index)].m_p);
 			}
 
-			const auto centroid = model_part.m_aabb.Centroid();
+			const auto model_part_points = gsl::make_span(std::as_const(points));
 
-			// Set bounding sphere.
-			model_part.m_sphere = BoundingSphere(centroid);
-			for (auto i = start; i < end; ++i) {
-				const auto& vertex = m_vertex_buffer[m_index_buffer[i]];
-				model_part.m_sphere = BoundingSphere::Union(model_part.m_sphere, vertex);
-			}
-		}
+			// Set AABB.
+			model_part.m_aabb = AABB::Fit(model_part_points);
+
+			// Set bounding sphere and OBB.
+			FitBoundingVolumes(model_part, model_part_points);
+		});
 	}
 
 	template< typename VertexT, typename IndexT >
-	void ModelOutput< VertexT, IndexT >::NormalizeModelParts() noexcept {
+	void ModelOutput< VertexT, IndexT >::NormalizeModelParts() {
 		NormalizeInWorldSpace();
+		// Each model part must own a contiguous range of vertices before its
+		// vertices can be normalized in its own object space.
+		SeparateModelParts();
 		NormalizeInObjectSpace();
 	}
 
+	template< typename VertexT, typename IndexT >
+	void ModelOutput< VertexT, IndexT >::SeparateModelParts() {
+		std::vector< VertexT > vertex_buffer;
+		vertex_buffer.reserve(m_vertex_buffer.size());
+
+		// The new index (+1) of each old vertex in the current model part.
+		std::vector< std::size_t > mapping(m_vertex_buffer.size(), 0u);
+
+		for (const auto& model_part : m_model_parts) {
+			const std::size_t base = vertex_buffer.size();
+
+			const auto separate = [&](std::size_t start, std::size_t end) {
+				for (auto i = start; i < end; ++i) {
+					auto& index = m_index_buffer[i];
+					auto& slot  = mapping[static_cast< std::size_t >(index)];
+
+					// Vertices mapped by preceding model parts are duplicated.
+					if (slot <= base) {
+						vertex_buffer.push_back(m_vertex_buffer[index]);
+						slot = vertex_buffer.size();
+					}
+
+					index = static_cast< IndexT >(slot - 1u);
+				}
+			};
+
+			separate(model_part.m_start_index,
+					 model_part.m_start_index + model_part.m_nb_indices);
+			for (const auto& lod : model_part.m_lods) {
+				separate(lod.m_start_index, lod.m_start_index + lod.m_nb_indices);
+			}
+		}
+
+		m_vertex_buffer = std::move(vertex_buffer);
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ModelOutput< VertexT, IndexT >::OptimizeModelParts(bool optimize_overdraw) {
+		const auto indices  = gsl::make_span(m_index_buffer);
+		const auto vertices = gsl::make_span(std::as_const(m_vertex_buffer));
+
+		for (const auto& model_part : m_model_parts) {
+			const auto start = static_cast< std::ptrdiff_t >(model_part.m_start_index);
+			const auto count = static_cast< std::ptrdiff_t >(model_part.m_nb_indices);
+			const auto model_part_indices = indices.subspan(start, count);
+
+			OptimizeVertexCache(model_part_indices);
+			if (optimize_overdraw) {
+				OptimizeOverdraw(model_part_indices, vertices);
+			}
+		}
+
+		// Reorder the vertices in order of first use.
+		SeparateModelParts();
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ModelOutput< VertexT, IndexT >::GenerateLODs(std::size_t nb_lods,
+		                                              F32 reduction) {
+		if (nb_lods <= 1u) {
+			return;
+		}
+
+		std::vector< IndexT > index_buffer;
+		index_buffer.reserve(2u * m_index_buffer.size());
+
+		const auto indices  = gsl::make_span(std::as_const(m_index_buffer));
+		const auto vertices = gsl::make_span(std::as_const(m_vertex_buffer));
+		std::vector< std::size_t > target_nb_indices(nb_lods - 1u);
+
+		for (auto& model_part : m_model_parts) {
+			const auto start = static_cast< std::ptrdiff_t >(model_part.m_start_index);
+			const auto count = static_cast< std::ptrdiff_t >(model_part.m_nb_indices);
+			const auto model_part_indices = indices.subspan(start, count);
+
+			model_part.m_start_index = static_cast< U32 >(index_buffer.size());
+			model_part.m_lods.clear();
+			for (auto& cluster : model_part.m_clusters) {
+				cluster.m_start_index += model_part.m_start_index
+					                   - static_cast< U32 >(start);
+			}
+			index_buffer.insert(index_buffer.end(), model_part_indices.begin(),
+				                                    model_part_indices.end());
+
+			auto nb_triangles = static_cast< F32 >(count / 3);
+			for (auto& target : target_nb_indices) {
+				nb_triangles *= reduction;
+				target = 3u * static_cast< std::size_t >(nb_triangles);
+			}
+
+			SimplifyMesh(model_part_indices, vertices,
+						 gsl::make_span(std::as_const(target_nb_indices)),
+						 [&index_buffer, &model_part](gsl::span< const IndexT > lod_indices,
+													  F32 error) {
+				ModelPartLOD lod;
+				lod.m_start_index = static_cast< U32 >(index_buffer.size());
+				lod.m_nb_indices  = static_cast< U32 >(lod_indices.size());
+				lod.m_error       = error;
+
+				index_buffer.insert(index_buffer.end(), lod_indices.begin(),
+					                                    lod_indices.end());
+				OptimizeVertexCache(gsl::make_span(index_buffer).subspan(
+					static_cast< std::ptrdiff_t >(lod.m_start_index),
+					static_cast< std::ptrdiff_t >(lod.m_nb_indices)));
+
+				model_part.m_lods.push_back(std::move(lod));
+			});
+		}
+
+		m_index_buffer = std::move(index_buffer);
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ModelOutput< VertexT, IndexT >
+		::ClusterModelParts(std::size_t max_nb_triangles) {
+
+		const auto indices  = gsl::make_span(m_index_buffer);
+		const auto vertices = gsl::make_span(std::as_const(m_vertex_buffer));
+
+		for (auto& model_part : m_model_parts) {
+			const auto start = static_cast< std::ptrdiff_t >(model_part.m_start_index);
+			const auto count = static_cast< std::ptrdiff_t >(model_part.m_nb_indices);
+
+			model_part.m_clusters.clear();
+			BuildMeshClusters(indices.subspan(start, count), vertices,
+							  model_part.m_start_index, model_part.m_clusters,
+							  max_nb_triangles);
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ModelOutput< VertexT, IndexT >::BuildModelPartBVHs() {
+		ForEachModelPartMesh([](ModelPart& model_part,
+								auto vertices, auto indices,
+								std::size_t base_vertex) {
+			const auto start = static_cast< std::ptrdiff_t >(model_part.m_start_index);
+			const auto count = static_cast< std::ptrdiff_t >(model_part.m_nb_indices);
+
+			model_part.m_bvh = MakeShared< TriangleBVH >(
+				vertices, indices.subspan(start, count), base_vertex);
+		});
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ModelOutput< VertexT, IndexT >
+		::BuildModelPartOccluders(std::size_t max_nb_triangles) {
+
+		ForEachModelPartMesh([max_nb_triangles](ModelPart& model_part,
+												auto vertices, auto indices,
+												std::size_t base_vertex) {
+			model_part.m_occluder = nullptr;
+
+			const auto diagonal  = XMVector3Length(model_part.m_aabb.Diagonal());
+			const auto max_error = g_occluder_max_relative_error
+				                 * XMVectorGetX(diagonal);
+
+			// Select the finest level of detail within the triangle budget.
+			auto start = model_part.m_start_index;
+			auto count = model_part.m_nb_indices;
+			auto found = (count / 3u <= max_nb_triangles);
+			for (auto it = model_part.m_lods.cbegin();
+				 !found && it != model_part.m_lods.cend()
+				 && it->m_error <= max_error; ++it) {
+
+				start = it->m_start_index;
+				count = it->m_nb_indices;
+				found = (count / 3u <= max_nb_triangles);
+			}
+
+			if (!found || 0u == count) {
+				return;
+			}
+
+			model_part.m_occluder = MakeShared< OccluderMesh >(
+				vertices,
+				indices.subspan(static_cast< std::ptrdiff_t >(start),
+								static_cast< std::ptrdiff_t >(count)),
+				base_vertex);
+		});
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ModelOutput< VertexT, IndexT >::UnmapMesh() {
+		if (m_mapped_mesh.IsMapped()) {
+			const auto vertices = m_mapped_mesh.m_vertices;
+			const auto indices  = m_mapped_mesh.m_indices;
+			m_vertex_buffer.assign(vertices.begin(), vertices.end());
+			m_index_buffer.assign(indices.begin(), indices.end());
+
+			m_mapped_mesh = {};
+		}
+
+		if constexpr (std::is_same_v< VertexPositionNormalTexture, VertexT >) {
+			std::visit([this](const auto& mesh) {
+				using MeshT = std::decay_t< decltype(mesh) >;
+				if constexpr (!std::is_same_v< std::monostate, MeshT >) {
+					m_vertex_buffer.resize(static_cast< std::size_t >(mesh.m_vertices.size()));
+					m_index_buffer.resize(static_cast< std::size_t >(mesh.m_indices.size()));
+					const auto vertices = gsl::make_span(m_vertex_buffer);
+
+					for (auto& model_part : m_model_parts) {
+						const auto base  = static_cast< std::ptrdiff_t >(model_part.m_base_vertex);
+						const auto count = static_cast< std::ptrdiff_t >(
+							GetNumberOfVertices(model_part, mesh.m_indices));
+
+						UnpackVertices(mesh.m_vertices.subspan(base, count),
+									   model_part.m_quantization,
+									   vertices.subspan(base, count));
+
+						// Rebase the indices of the model part and its levels
+						// of detail.
+						const auto rebase = [this, &mesh, &model_part](
+							std::size_t start, std::size_t nb_indices) {
+
+							for (auto i = start; i < start + nb_indices; ++i) {
+								const auto index = mesh.m_indices[static_cast< std::ptrdiff_t >(i)];
+								m_index_buffer[i] = static_cast< IndexT >(
+									index + model_part.m_base_vertex);
+							}
+						};
+
+						rebase(model_part.m_start_index, model_part.m_nb_indices);
+						for (const auto& lod : model_part.m_lods) {
+							rebase(lod.m_start_index, lod.m_nb_indices);
+						}
+
+						model_part.m_base_vertex  = 0u;
+						model_part.m_quantization = PositionQuantization();
+					}
+				}
+			}, m_mapped_packed_mesh);
+		}
+
+		m_mapped_packed_mesh = std::monostate();
+	}
+
 	template< typename VertexT, typename IndexT >
 	void ModelOutput< VertexT, IndexT >::NormalizeInWorldSpace() noexcept {
 		AABB aabb;
@@ -71,26 +312,27 @@ namespace mage::rendering {
 	}
 
 	template< typename VertexT, typename IndexT >
-	void ModelOutput< VertexT, IndexT >::NormalizeInObjectSpace() noexcept {
-		for (auto& model_part : m_model_parts) {
+	void ModelOutput< VertexT, IndexT >::NormalizeInObjectSpace() {
+		ForEachModelPartParallel([this](ModelPart& model_part,
+										std::vector< Point3 >& points) {
 			const std::size_t start = model_part.m_start_index;
 			const std::size_t end   = start + model_part.m_nb_indices;
 			std::size_t min_index   = m_vertex_buffer.size();
 			std::size_t max_index   = 0u;
 
-			// Model parts are not allowed to share vertices.
 			for (auto i = start; i < end; ++i) {
 				const auto index = static_cast< std::size_t >(m_index_buffer[i]);
 				min_index = std::min(min_index, index);
 				max_index = std::max(max_index, index);
 			}
 
-			AABB aabb;
+			points.clear();
 			for (auto index = min_index; index <= max_index; ++index) {
-				const auto& vertex = m_vertex_buffer[index];
-				aabb = AABB::Union(aabb, vertex);
+				points.push_back(m_vertex_buffer[index].m_p);
 			}
 
+			const auto aabb = AABB::Fit(gsl::make_span(std::as_const(points)));
+
 			const auto c = aabb.Centroid();
 			const auto d = aabb.Diagonal();
 			const auto s = std::max(XMVectorGetX(d),
@@ -107,15 +349,109 @@ namespace mage::rendering {
 			const auto pmax = (aabb.MaxPoint() - c) * inv_s;
 			model_part.m_aabb = AABB(pmin, pmax);
 
-			// Normalize vertices and set bounding sphere.
-			model_part.m_sphere = BoundingSphere();
+			// Normalize vertices.
 			for (auto index = min_index; index <= max_index; ++index) {
-				auto& vertex = m_vertex_buffer[index];
-				const auto p  = XMLoad(vertex.m_p);
+				auto& point  = points[index - min_index];
+				const auto p  = XMLoad(point);
 				const auto np = (p - c) * inv_s;
-				vertex.m_p = Point3(XMStore< F32x3 >(np));
-				model_part.m_sphere = BoundingSphere::Union(model_part.m_sphere, vertex);
+				point = Point3(XMStore< F32x3 >(np));
+				m_vertex_buffer[index].m_p = point;
 			}
+
+			// Set bounding sphere and OBB.
+			FitBoundingVolumes(model_part, gsl::make_span(std::as_const(points)));
+		});
+	}
+
+	template< typename VertexT, typename IndexT >
+	template< typename ActionT >
+	void ModelOutput< VertexT, IndexT >::ForEachModelPartParallel(ActionT&& action) {
+		std::atomic< std::size_t > next_index(0u);
+		const auto process = [this, &action, &next_index]() {
+			std::vector< Point3 > points;
+
+			for (auto index = next_index++; index < m_model_parts.size();
+				 index = next_index++) {
+
+				action(m_model_parts[index], points);
+			}
+		};
+
+		const std::size_t nb_threads = std::min(
+			static_cast< std::size_t >(NumberOfSystemCores()), m_model_parts.size());
+		RunParallel(nb_threads, process);
+	}
+
+	template< typename VertexT, typename IndexT >
+	template< typename ActionT >
+	void ModelOutput< VertexT, IndexT >::ForEachModelPartMesh(ActionT&& action) {
+		if constexpr (std::is_same_v< VertexPositionNormalTexture, VertexT >) {
+			if (HasMappedPackedMesh()) {
+				std::visit([this, &action](const auto& mesh) {
+					using MeshT = std::decay_t< decltype(mesh) >;
+					if constexpr (!std::is_same_v< std::monostate, MeshT >) {
+						std::vector< VertexT > vertices;
+
+						for (auto& model_part : m_model_parts) {
+							const auto base  = static_cast< std::ptrdiff_t >(model_part.m_base_vertex);
+							const auto count = GetNumberOfVertices(model_part, mesh.m_indices);
+
+							vertices.resize(count);
+							UnpackVertices(mesh.m_vertices.subspan(
+								               base, static_cast< std::ptrdiff_t >(count)),
+										   model_part.m_quantization,
+										   gsl::make_span(vertices));
+
+							action(model_part,
+								   gsl::make_span(std::as_const(vertices)),
+								   mesh.m_indices,
+								   std::size_t(0u));
+						}
+					}
+				}, m_mapped_packed_mesh);
+				return;
+			}
+		}
+
+		const auto indices  = GetIndices();
+		const auto vertices = GetVertices();
+		for (auto& model_part : m_model_parts) {
+			action(model_part, vertices, indices,
+				   static_cast< std::size_t >(model_part.m_base_vertex));
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	template< typename MeshIndexT >
+	[[nodiscard]]
+	std::size_t ModelOutput< VertexT, IndexT >
+		::GetNumberOfVertices(const ModelPart& model_part,
+							  gsl::span< const MeshIndexT > indices) noexcept {
+
+		std::size_t nb_vertices = 0u;
+		const auto update = [indices, &nb_vertices](std::size_t start,
+													std::size_t nb_indices) noexcept {
+			for (auto i = start; i < start + nb_indices; ++i) {
+				const auto index = indices[static_cast< std::ptrdiff_t >(i)];
+				nb_vertices = std::max(nb_vertices,
+									   static_cast< std::size_t >(index) + 1u);
+			}
+		};
+
+		update(model_part.m_start_index, model_part.m_nb_indices);
+		for (const auto& lod : model_part.m_lods) {
+			update(lod.m_start_index, lod.m_nb_indices);
 		}
+
+		return nb_vertices;
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ModelOutput< VertexT, IndexT >
+		::FitBoundingVolumes(ModelPart& model_part,
+							 gsl::span< const Point3 > points) noexcept {
+
+		model_part.m_sphere = BoundingSphere::Fit(points);
+		model_part.m_obb    = OBB::Fit(points);
 	}
 }
\ No newline at end of file
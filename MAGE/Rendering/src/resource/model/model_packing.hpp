@@ -0,0 +1,155 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/model/model_output.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A struct of packed model parts describing the vertex range and position
+	 quantization of a model part with packed vertices.
+	 */
+	struct PackedModelPart {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The start index of this packed model part. The index range of this
+		 packed model part covers the levels of detail of its model part.
+		 */
+		U32 m_start_index = 0u;
+
+		/**
+		 The number of indices of this packed model part.
+		 */
+		U32 m_nb_indices = 0u;
+
+		/**
+		 The base vertex of this packed model part. The indices of this packed
+		 model part are relative to this base vertex.
+		 */
+		U32 m_base_vertex = 0u;
+
+		/**
+		 The number of vertices of this packed model part.
+		 */
+		U32 m_nb_vertices = 0u;
+
+		/**
+		 The position quantization of this packed model part.
+		 */
+		PositionQuantization m_quantization;
+	};
+
+	static_assert(40u == sizeof(PackedModelPart));
+
+	/**
+	 Computes the packed model parts of the given model output.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		model_output
+					A reference to the model output.
+	 @param[out]	packed_model_parts
+					A reference to a vector containing the packed model parts.
+	 @return		@c true if the vertex ranges of the model parts do not
+					overlap (e.g., after @c ModelOutput::SeparateModelParts).
+					@c false otherwise.
+	 */
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	bool ComputePackedModelParts(
+		const ModelOutput< VertexT, IndexT >& model_output,
+		std::vector< PackedModelPart >& packed_model_parts);
+
+	/**
+	 Checks whether the given packed model parts can be indexed with 16-bit
+	 indices.
+
+	 @param[in]		packed_model_parts
+					The packed model parts.
+	 @return		@c true if each of the given packed model parts has at
+					most 65536 vertices. @c false otherwise.
+	 */
+	[[nodiscard]]
+	bool HasShortIndices(
+		gsl::span< const PackedModelPart > packed_model_parts) noexcept;
+
+	/**
+	 Packs the vertices and indices of the given model output.
+
+	 @pre			The vertex ranges of the given packed model parts do not
+					overlap.
+	 @tparam		IndexT
+					The index type.
+	 @tparam		PackedIndexT
+					The packed index type.
+	 @param[in]		model_output
+					A reference to the model output.
+	 @param[in]		packed_model_parts
+					The packed model parts of the given model output.
+	 @param[out]	vertices
+					A reference to a vector containing the packed vertices.
+	 @param[out]	indices
+					A reference to a vector containing the packed indices
+					(relative to the base vertex of their model part).
+	 */
+	template< typename IndexT, typename PackedIndexT >
+	void PackModel(
+		const ModelOutput< VertexPositionNormalTexture, IndexT >& model_output,
+		gsl::span< const PackedModelPart > packed_model_parts,
+		std::vector< PackedVertexPositionNormalTexture >& vertices,
+		std::vector< PackedIndexT >& indices);
+
+	/**
+	 Unpacks the given packed vertices and indices.
+
+	 @pre			The vertex and index ranges of the given packed model parts
+					are contained in the given packed vertices and indices.
+	 @tparam		PackedIndexT
+					The packed index type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		packed_vertices
+					The packed vertices.
+	 @param[in]		packed_indices
+					The packed indices.
+	 @param[in]		packed_model_parts
+					The packed model parts.
+	 @param[out]	vertices
+					A reference to a vector containing the unpacked vertices.
+	 @param[out]	indices
+					A reference to a vector containing the unpacked indices.
+	 */
+	template< typename PackedIndexT, typename IndexT >
+	void UnpackModel(
+		gsl::span< const PackedVertexPositionNormalTexture > packed_vertices,
+		gsl::span< const PackedIndexT > packed_indices,
+		gsl::span< const PackedModelPart > packed_model_parts,
+		std::vector< VertexPositionNormalTexture >& vertices,
+		std::vector< IndexT >& indices);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource/model/model_packing.tpp"
+
+#pragma endregion
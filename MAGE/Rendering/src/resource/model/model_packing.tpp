@@ -0,0 +1,169 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	bool ComputePackedModelParts(
+		const ModelOutput< VertexT, IndexT >& model_output,
+		std::vector< PackedModelPart >& packed_model_parts) {
+
+		const auto& vertices = model_output.m_vertex_buffer;
+		const auto& indices  = model_output.m_index_buffer;
+
+		packed_model_parts.clear();
+		packed_model_parts.reserve(model_output.m_model_parts.size());
+
+		for (const auto& model_part : model_output.m_model_parts) {
+			// The index range covers the levels of detail of the model part.
+			std::size_t start = model_part.m_start_index;
+			std::size_t end   = start + model_part.m_nb_indices;
+			for (const auto& lod : model_part.m_lods) {
+				start = std::min< std::size_t >(start, lod.m_start_index);
+				end   = std::max< std::size_t >(end, lod.m_start_index + lod.m_nb_indices);
+			}
+
+			std::size_t min_index = vertices.size();
+			std::size_t max_index = 0u;
+
+			for (auto i = start; i < end; ++i) {
+				const auto index = static_cast< std::size_t >(indices[i]);
+				min_index = std::min(min_index, index);
+				max_index = std::max(max_index, index);
+			}
+
+			PackedModelPart packed_model_part;
+			packed_model_part.m_start_index = static_cast< U32 >(start);
+			packed_model_part.m_nb_indices  = static_cast< U32 >(end - start);
+
+			if (min_index <= max_index) {
+				AABB aabb;
+				for (auto index = min_index; index <= max_index; ++index) {
+					aabb = AABB::Union(aabb, vertices[index]);
+				}
+
+				packed_model_part.m_base_vertex  = static_cast< U32 >(min_index);
+				packed_model_part.m_nb_vertices  = static_cast< U32 >(max_index - min_index + 1u);
+				packed_model_part.m_quantization = PositionQuantization(aabb);
+			}
+
+			packed_model_parts.push_back(std::move(packed_model_part));
+		}
+
+		// Check whether the vertex ranges overlap.
+		std::vector< const PackedModelPart* > sorted;
+		sorted.reserve(packed_model_parts.size());
+		for (const auto& packed_model_part : packed_model_parts) {
+			if (0u != packed_model_part.m_nb_vertices) {
+				sorted.push_back(&packed_model_part);
+			}
+		}
+
+		std::sort(sorted.begin(), sorted.end(),
+				  [](const PackedModelPart* lhs, const PackedModelPart* rhs) noexcept {
+					  return lhs->m_base_vertex < rhs->m_base_vertex;
+				  });
+
+		for (std::size_t i = 1u; i < sorted.size(); ++i) {
+			const auto& previous = *sorted[i - 1u];
+			if (sorted[i]->m_base_vertex
+				< previous.m_base_vertex + previous.m_nb_vertices) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	[[nodiscard]]
+	inline bool HasShortIndices(
+		gsl::span< const PackedModelPart > packed_model_parts) noexcept {
+
+		constexpr std::size_t max_nb_vertices
+			= std::numeric_limits< U16 >::max() + std::size_t(1u);
+
+		return std::all_of(packed_model_parts.begin(), packed_model_parts.end(),
+						   [](const PackedModelPart& packed_model_part) noexcept {
+							   return packed_model_part.m_nb_vertices <= max_nb_vertices;
+						   });
+	}
+
+	template< typename IndexT, typename PackedIndexT >
+	void PackModel(
+		const ModelOutput< VertexPositionNormalTexture, IndexT >& model_output,
+		gsl::span< const PackedModelPart > packed_model_parts,
+		std::vector< PackedVertexPositionNormalTexture >& vertices,
+		std::vector< PackedIndexT >& indices) {
+
+		const auto input_vertices = gsl::make_span(model_output.m_vertex_buffer);
+		const auto& input_indices = model_output.m_index_buffer;
+
+		vertices.assign(model_output.m_vertex_buffer.size(),
+						PackedVertexPositionNormalTexture());
+		indices.resize(input_indices.size());
+		std::transform(input_indices.begin(), input_indices.end(),
+					   indices.begin(), [](IndexT index) noexcept {
+						   return static_cast< PackedIndexT >(index);
+					   });
+
+		const auto output_vertices = gsl::make_span(vertices);
+		for (const auto& packed_model_part : packed_model_parts) {
+			const auto base  = static_cast< std::ptrdiff_t >(packed_model_part.m_base_vertex);
+			const auto count = static_cast< std::ptrdiff_t >(packed_model_part.m_nb_vertices);
+
+			PackVertices(input_vertices.subspan(base, count),
+						 packed_model_part.m_quantization,
+						 output_vertices.subspan(base, count));
+
+			const std::size_t start = packed_model_part.m_start_index;
+			const std::size_t end   = start + packed_model_part.m_nb_indices;
+			for (auto i = start; i < end; ++i) {
+				indices[i] = static_cast< PackedIndexT >(
+					input_indices[i] - packed_model_part.m_base_vertex);
+			}
+		}
+	}
+
+	template< typename PackedIndexT, typename IndexT >
+	void UnpackModel(
+		gsl::span< const PackedVertexPositionNormalTexture > packed_vertices,
+		gsl::span< const PackedIndexT > packed_indices,
+		gsl::span< const PackedModelPart > packed_model_parts,
+		std::vector< VertexPositionNormalTexture >& vertices,
+		std::vector< IndexT >& indices) {
+
+		vertices.resize(static_cast< std::size_t >(packed_vertices.size()));
+		indices.assign(packed_indices.begin(), packed_indices.end());
+
+		const auto output_vertices = gsl::make_span(vertices);
+		for (const auto& packed_model_part : packed_model_parts) {
+			const auto base  = static_cast< std::ptrdiff_t >(packed_model_part.m_base_vertex);
+			const auto count = static_cast< std::ptrdiff_t >(packed_model_part.m_nb_vertices);
+
+			UnpackVertices(packed_vertices.subspan(base, count),
+						   packed_model_part.m_quantization,
+						   output_vertices.subspan(base, count));
+
+			const std::size_t start = packed_model_part.m_start_index;
+			const std::size_t end   = start + packed_model_part.m_nb_indices;
+			for (auto i = start; i < end; ++i) {
+				indices[i] = static_cast< IndexT >(
+					packed_indices[static_cast< std::ptrdiff_t >(i)]
+					+ packed_model_part.m_base_vertex);
+			}
+		}
+	}
+}
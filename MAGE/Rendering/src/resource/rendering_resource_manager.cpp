@@ -4,6 +4,19 @@
 #pragma region
 
 #include "resource\rendering_resource_manager.hpp"
+#include "io\archive.hpp"
+#include "logging\logging.hpp"
+#include "parallel\parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <atomic>
 
 #pragma endregion
 
@@ -22,9 +35,131 @@ namespace mage::rendering {
 		m_ps_pool(),
 		m_cs_pool(),
 		m_sprite_font_pool(),
-		m_texture_pool() {}
+		m_texture_pool(),
+		m_manifest(),
+		m_recording(false),
+		m_manifest_mutex() {}
 
-	ResourceManager::ResourceManager(ResourceManager&& manager) noexcept = default;
+	ResourceManager::ResourceManager(ResourceManager&& manager) noexcept
+		: m_device(manager.m_device),
+		m_model_descriptor_pool(std::move(manager.m_model_descriptor_pool)),
+		m_vs_pool(std::move(manager.m_vs_pool)),
+		m_hs_pool(std::move(manager.m_hs_pool)),
+		m_ds_pool(std::move(manager.m_ds_pool)),
+		m_gs_pool(std::move(manager.m_gs_pool)),
+		m_ps_pool(std::move(manager.m_ps_pool)),
+		m_cs_pool(std::move(manager.m_cs_pool)),
+		m_sprite_font_pool(std::move(manager.m_sprite_font_pool)),
+		m_texture_pool(std::move(manager.m_texture_pool)),
+		m_manifest(std::move(manager.m_manifest)),
+		m_recording(manager.m_recording),
+		m_manifest_mutex() {}
 
 	ResourceManager::~ResourceManager() = default;
+
+	void ResourceManager::StartRecording() {
+		const std::scoped_lock< std::mutex > lock(m_manifest_mutex);
+
+		m_manifest.Clear();
+		m_recording = true;
+	}
+
+	[[nodiscard]]
+	ResourceManifest ResourceManager::StopRecording() {
+		const std::scoped_lock< std::mutex > lock(m_manifest_mutex);
+
+		m_recording = false;
+		return std::move(m_manifest);
+	}
+
+	ResourceManifestEntry* ResourceManager
+		::Record(ResourceManifestEntry::Type type, const std::wstring& fname) {
+
+		const std::scoped_lock< std::mutex > lock(m_manifest_mutex);
+
+		return m_recording ? m_manifest.Add(type, fname) : nullptr;
+	}
+
+	[[nodiscard]]
+	std::vector< SharedPtr< const void > >
+		ResourceManager::Prefetch(const ResourceManifest& manifest) {
+
+		// Prefetch the largest files first to balance the work over the
+		// worker threads.
+		std::vector< const ResourceManifestEntry* > entries;
+		entries.reserve(manifest.size());
+		manifest.ForEachEntry([&entries](const ResourceManifestEntry& entry) {
+			if (ResourceManifestEntry::Type::MaterialLibrary != entry.m_type) {
+				entries.push_back(&entry);
+			}
+		});
+		std::stable_sort(entries.begin(), entries.end(),
+			[](const ResourceManifestEntry* lhs,
+			   const ResourceManifestEntry* rhs) noexcept {
+				return lhs->m_size > rhs->m_size;
+			});
+
+		std::vector< SharedPtr< const void > > resources(entries.size());
+		std::atomic< std::size_t > next_index(0u);
+
+		const auto prefetch = [this, &entries, &resources, &next_index]() {
+			// Initializes the COM library for use by the calling thread (WIC).
+			const auto result = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+			for (auto index = next_index++; index < entries.size();
+				 index = next_index++) {
+
+				const auto& entry = *entries[index];
+				try {
+					resources[index] = Prefetch(entry);
+				}
+				catch (const std::exception& e) {
+					Warning("Failed to prefetch {}: {}", entry.m_guid, e.what());
+				}
+			}
+
+			if (SUCCEEDED(result)) {
+				CoUninitialize();
+			}
+		};
+
+		// The calling thread participates as well. Loaders running on these
+		// workers do not spawn nested worker threads of their own.
+		const std::size_t nb_threads = std::min(
+			static_cast< std::size_t >(NumberOfSystemCores()), entries.size());
+		RunParallel(nb_threads, prefetch);
+
+		return resources;
+	}
+
+	[[nodiscard]]
+	SharedPtr< const void > ResourceManager
+		::Prefetch(const ResourceManifestEntry& entry) {
+
+		if (!FileExists(entry.m_guid)) {
+			return nullptr;
+		}
+
+		switch (entry.m_type) {
+
+		case ResourceManifestEntry::Type::Model: {
+			const MeshDescriptor< VertexPositionNormalTexture, U32 >
+				desc(entry.m_invert_handedness, entry.m_clockwise_order,
+					 entry.m_nb_lods);
+			return GetOrCreate< ModelDescriptor >(entry.m_guid, desc);
+		}
+
+		case ResourceManifestEntry::Type::SpriteFont: {
+			const SpriteFontDescriptor desc(entry.m_force_srgb);
+			return GetOrCreate< SpriteFont >(entry.m_guid, desc);
+		}
+
+		case ResourceManifestEntry::Type::Texture:
+			return GetOrCreate< Texture >(entry.m_guid);
+
+		default:
+			// Material libraries are prefetched as part of their model.
+			return nullptr;
+		}
+	}
 }
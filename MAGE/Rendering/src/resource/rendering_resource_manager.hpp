@@ -5,10 +5,21 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\resource_pool.hpp"
-#include "resource\model\model_descriptor.hpp"
-#include "resource\shader\shader.hpp"
-#include "resource\font\sprite_font.hpp"
+#include "resource/resource_pool.hpp"
+#include "resource/rendering_resource_manifest.hpp"
+#include "resource/mesh/vertex.hpp"
+#include "resource/model/model_descriptor.hpp"
+#include "resource/shader/shader.hpp"
+#include "resource/font/sprite_font.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <mutex>
 
 #pragma endregion
 
@@ -406,6 +417,63 @@ namespace mage::rendering {
 									 const D3D11_TEXTURE2D_DESC& desc,
 									 const D3D11_SUBRESOURCE_DATA& initial_data);
 
+		//---------------------------------------------------------------------
+		// Member Methods: Manifests
+		//---------------------------------------------------------------------
+
+		/**
+		 Starts recording the file resources requested from this resource
+		 manager.
+		 */
+		void StartRecording();
+
+		/**
+		 Stops recording the file resources requested from this resource
+		 manager.
+
+		 @return		The resource manifest containing the file resources
+						requested from this resource manager since the last
+						call to @c StartRecording.
+		 */
+		[[nodiscard]]
+		ResourceManifest StopRecording();
+
+		/**
+		 Records the file resource of the given type associated with the given
+		 filename, if this resource manager is recording.
+
+		 @param[in]		type
+						The type of the file resource.
+		 @param[in]		fname
+						A reference to the filename (the globally unique
+						identifier).
+		 @return		A pointer to the recorded entry.
+		 @return		@c nullptr if this resource manager is not recording
+						or if the given filename does not refer to an
+						existing file.
+		 */
+		ResourceManifestEntry* Record(ResourceManifestEntry::Type type,
+									  const std::wstring& fname);
+
+		/**
+		 Prefetches the file resources of the given resource manifest in
+		 parallel. The file reads, parsing and decoding of the resources are
+		 distributed over worker threads.
+
+		 Entries whose file does not exist (anymore) are skipped. Material
+		 libraries are not prefetched on their own, but as part of the models
+		 using them.
+
+		 @param[in]		manifest
+						A reference to the resource manifest.
+		 @return		A vector containing the prefetched resources. The
+						resources stay in the resource pools of this resource
+						manager as long as they are referenced.
+		 */
+		[[nodiscard]]
+		std::vector< SharedPtr< const void > >
+			Prefetch(const ResourceManifest& manifest);
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -438,6 +506,19 @@ namespace mage::rendering {
 		[[nodiscard]]
 		const typename pool_type< ResourceT >& GetPool() const noexcept;
 
+		/**
+		 Prefetches the file resource of the given resource manifest entry.
+
+		 @param[in]		entry
+						A reference to the resource manifest entry.
+		 @return		A pointer to the prefetched resource.
+		 @return		@c nullptr if the resource is not prefetched.
+		 @throws		Exception
+						Failed to create the resource.
+		 */
+		[[nodiscard]]
+		SharedPtr< const void > Prefetch(const ResourceManifestEntry& entry);
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -491,6 +572,24 @@ namespace mage::rendering {
 		 The texture resource pool of this resource manager.
 		 */
 		typename pool_type< Texture > m_texture_pool;
+
+		/**
+		 The resource manifest containing the recorded file resources of this
+		 resource manager.
+		 */
+		ResourceManifest m_manifest;
+
+		/**
+		 A flag indicating whether this resource manager is recording the
+		 requested file resources.
+		 */
+		bool m_recording;
+
+		/**
+		 The mutex for accessing the resource manifest of this resource
+		 manager.
+		 */
+		mutable std::mutex m_manifest_mutex;
 	};
 }
 
@@ -499,6 +598,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\rendering_resource_manager.tpp"
+#include "resource/rendering_resource_manager.tpp"
 
 #pragma endregion
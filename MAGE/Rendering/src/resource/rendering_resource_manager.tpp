@@ -126,6 +126,21 @@ namespace mage::rendering {
 									 const MeshDescriptor< VertexT, IndexT >& desc,
 									 bool export_as_MDL) {
 
+		// Only model descriptors with the vertex and index type used by the
+		// models of the scenes are recorded for prefetching.
+		if constexpr (std::is_same_v< VertexPositionNormalTexture, VertexT >
+					  && std::is_same_v< U32, IndexT >) {
+
+			if (const auto entry = Record(ResourceManifestEntry::Type::Model,
+										  fname);
+				nullptr != entry) {
+
+				entry->m_invert_handedness = desc.InvertHandness();
+				entry->m_clockwise_order   = desc.ClockwiseOrder();
+				entry->m_nb_lods           = desc.GetNumberOfLODs();
+			}
+		}
+
 		return GetPool< ResourceT >().GetOrCreate(fname, m_device, *this,
 												  key_type< ResourceT >(fname),
 												  desc, export_as_MDL);
@@ -206,6 +221,13 @@ namespace mage::rendering {
 		ResourceManager::GetOrCreate(const std::wstring& fname,
 									 const SpriteFontDescriptor& desc) {
 
+		if (const auto entry = Record(ResourceManifestEntry::Type::SpriteFont,
+									  fname);
+			nullptr != entry) {
+
+			entry->m_force_srgb = desc.ForceSRGB();
+		}
+
 		return GetPool< ResourceT >().GetOrCreate(fname, m_device,
 												  key_type< ResourceT >(fname),
 												  desc);
@@ -216,6 +238,8 @@ namespace mage::rendering {
 		TexturePtr >
 		ResourceManager::GetOrCreate(const std::wstring& fname) {
 
+		Record(ResourceManifestEntry::Type::Texture, fname);
+
 		return GetPool< ResourceT >().GetOrCreate(fname, m_device,
 												  key_type< ResourceT >(fname));
 	}
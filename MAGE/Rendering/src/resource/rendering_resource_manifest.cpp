@@ -0,0 +1,107 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\rendering_resource_manifest.hpp"
+#include "io\archive.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// ResourceManifestEntry
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	[[nodiscard]]
+	bool ResourceManifestEntry::IsUpToDate() const noexcept {
+		const auto size = GetFileSize(m_guid);
+		return size && (m_size == *size);
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ResourceManifest
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	ResourceManifest::ResourceManifest()
+		: m_entries() {}
+
+	ResourceManifest::ResourceManifest(
+		const ResourceManifest& manifest) = default;
+
+	ResourceManifest::ResourceManifest(
+		ResourceManifest&& manifest) noexcept = default;
+
+	ResourceManifest::~ResourceManifest() = default;
+
+	ResourceManifest& ResourceManifest
+		::operator=(const ResourceManifest& manifest) = default;
+
+	ResourceManifest& ResourceManifest
+		::operator=(ResourceManifest&& manifest) noexcept = default;
+
+	[[nodiscard]]
+	bool ResourceManifest::IsUpToDate() const noexcept {
+		return std::all_of(m_entries.cbegin(), m_entries.cend(),
+						   [](const ResourceManifestEntry& entry) noexcept {
+							   return entry.IsUpToDate();
+						   });
+	}
+
+	void ResourceManifest::Add(ResourceManifestEntry entry) {
+		const auto it = std::find_if(m_entries.cbegin(), m_entries.cend(),
+			[&entry](const ResourceManifestEntry& e) noexcept {
+				return (e.m_type == entry.m_type) && (e.m_guid == entry.m_guid);
+			});
+
+		if (it == m_entries.cend()) {
+			m_entries.push_back(std::move(entry));
+		}
+	}
+
+	ResourceManifestEntry* ResourceManifest
+		::Add(ResourceManifestEntry::Type type, std::wstring fname) {
+
+		const auto size = GetFileSize(fname);
+		if (!size) {
+			// Only file resources are recorded.
+			return nullptr;
+		}
+
+		const auto it = std::find_if(m_entries.begin(), m_entries.end(),
+			[type, &fname](const ResourceManifestEntry& e) noexcept {
+				return (e.m_type == type) && (e.m_guid == fname);
+			});
+
+		if (it != m_entries.end()) {
+			return &*it;
+		}
+
+		ResourceManifestEntry entry;
+		entry.m_type = type;
+		entry.m_guid = std::move(fname);
+		entry.m_size = *size;
+
+		m_entries.push_back(std::move(entry));
+		return &m_entries.back();
+	}
+
+	#pragma endregion
+}
@@ -0,0 +1,294 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type/types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// ResourceManifestEntry
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of resource manifest entries describing one file resource.
+	 */
+	struct ResourceManifestEntry {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 An enumeration of the different types of file resources.
+
+		 This contains:
+		 @c Model,
+		 @c MaterialLibrary,
+		 @c SpriteFont and
+		 @c Texture.
+		 */
+		enum class Type : U8 {
+			Model = 0,
+			MaterialLibrary,
+			SpriteFont,
+			Texture
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether the file of this resource manifest entry still has the
+		 recorded size.
+
+		 @return		@c true if the file of this resource manifest entry
+						exists and still has the recorded size. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool IsUpToDate() const noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The type of the file resource of this resource manifest entry.
+		 */
+		Type m_type = Type::Model;
+
+		/**
+		 The filename (the globally unique identifier) of the file resource of
+		 this resource manifest entry.
+		 */
+		std::wstring m_guid;
+
+		/**
+		 The size (in bytes) of the file of this resource manifest entry.
+		 */
+		U64 m_size = 0u;
+
+		/**
+		 A flag indicating whether the mesh coordinate system handness should
+		 be inverted (models only).
+		 */
+		bool m_invert_handedness = false;
+
+		/**
+		 A flag indicating whether the face vertices should be defined in
+		 clockwise order (models only).
+		 */
+		bool m_clockwise_order = true;
+
+		/**
+		 The number of levels of detail of each model part (models only).
+		 */
+		std::size_t m_nb_lods = 1u;
+
+		/**
+		 A flag indicating whether working around gamma issues is needed
+		 (sprite fonts only).
+		 */
+		bool m_force_srgb = false;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ResourceManifest
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of resource manifests containing the file resources touched while
+	 loading a scene.
+	 */
+	class ResourceManifest {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a resource manifest.
+		 */
+		ResourceManifest();
+
+		/**
+		 Constructs a resource manifest from the given resource manifest.
+
+		 @param[in]		manifest
+						A reference to the resource manifest to copy.
+		 */
+		ResourceManifest(const ResourceManifest& manifest);
+
+		/**
+		 Constructs a resource manifest by moving the given resource manifest.
+
+		 @param[in]		manifest
+						A reference to the resource manifest to move.
+		 */
+		ResourceManifest(ResourceManifest&& manifest) noexcept;
+
+		/**
+		 Destructs this resource manifest.
+		 */
+		~ResourceManifest();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given resource manifest to this resource manifest.
+
+		 @param[in]		manifest
+						A reference to the resource manifest to copy.
+		 @return		A reference to the copy of the given resource manifest
+						(i.e. this resource manifest).
+		 */
+		ResourceManifest& operator=(const ResourceManifest& manifest);
+
+		/**
+		 Moves the given resource manifest to this resource manifest.
+
+		 @param[in]		manifest
+						A reference to the resource manifest to move.
+		 @return		A reference to the moved resource manifest (i.e. this
+						resource manifest).
+		 */
+		ResourceManifest& operator=(ResourceManifest&& manifest) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this resource manifest is empty.
+
+		 @return		@c true if this resource manifest is empty. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_entries.empty();
+		}
+
+		/**
+		 Returns the number of entries of this resource manifest.
+
+		 @return		The number of entries of this resource manifest.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_entries.size();
+		}
+
+		/**
+		 Checks whether all the files of this resource manifest still exist and
+		 still have their recorded size.
+
+		 @return		@c true if all the files of this resource manifest
+						are up to date. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsUpToDate() const noexcept;
+
+		/**
+		 Adds the given entry to this resource manifest (if not already
+		 present).
+
+		 @param[in]		entry
+						The resource manifest entry.
+		 */
+		void Add(ResourceManifestEntry entry);
+
+		/**
+		 Adds an entry for the file resource of the given type associated with
+		 the given filename to this resource manifest (if not already present).
+		 The size of the entry is obtained from the file system.
+
+		 @param[in]		type
+						The type of the file resource.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @return		A pointer to the added (or already present) entry.
+		 @return		@c nullptr if the given filename does not refer to an
+						existing file.
+		 */
+		ResourceManifestEntry* Add(ResourceManifestEntry::Type type,
+								   std::wstring fname);
+
+		/**
+		 Removes all entries from this resource manifest.
+		 */
+		void Clear() noexcept {
+			m_entries.clear();
+		}
+
+		/**
+		 Traverses all entries of this resource manifest.
+
+		 @tparam		ActionT
+						An action to perform on all entries of this resource
+						manifest. The action must accept @c const
+						@c ResourceManifestEntry& values.
+		 */
+		template< typename ActionT >
+		void ForEachEntry(ActionT&& action) const {
+			for (const auto& entry : m_entries) {
+				action(entry);
+			}
+		}
+
+		/**
+		 Returns the entries of this resource manifest.
+
+		 @return		A reference to the vector containing the entries of
+						this resource manifest.
+		 */
+		[[nodiscard]]
+		const std::vector< ResourceManifestEntry >& GetEntries() const noexcept {
+			return m_entries;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the entries of this resource manifest (in
+		 recording order).
+		 */
+		std::vector< ResourceManifestEntry > m_entries;
+	};
+
+	#pragma endregion
+}
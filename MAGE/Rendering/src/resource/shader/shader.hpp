@@ -5,9 +5,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\resource.hpp"
-#include "resource\shader\compiled_shader.hpp"
-#include "renderer\pipeline.hpp"
+#include "resource/resource.hpp"
+#include "resource/shader/compiled_shader.hpp"
+#include "renderer/pipeline.hpp"
 
 #pragma endregion
 
@@ -377,6 +377,6 @@ namespace mage::rendering {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\shader\shader.tpp"
+#include "resource/shader/shader.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -113,7 +113,7 @@ namespace mage::rendering {
 	#pragma region
 
 	VertexShaderPtr CreateTransformVS(ResourceManager& resource_manager) {
-		using vertex_t = VertexPositionNormalTexture;
+		using vertex_t = PackedVertexPositionNormalTexture;
 		return CreateVS(resource_manager,
 						MAGE_SHADER_ARGS(g_transform_VS),
 						gsl::make_span(vertex_t::s_input_element_descs));
@@ -44,7 +44,7 @@ namespace mage::rendering {
 	#pragma region
 
 	VertexShaderPtr CreateVoxelizationVS(ResourceManager& resource_manager) {
-		using vertex_t = VertexPositionNormalTexture;
+		using vertex_t = PackedVertexPositionNormalTexture;
 		return CreateVS(resource_manager,
 						MAGE_SHADER_ARGS(g_voxelization_VS),
 						gsl::make_span(vertex_t::s_input_element_descs));
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\resource.hpp"
-#include "renderer\pipeline.hpp"
+#include "resource/resource.hpp"
+#include "renderer/pipeline.hpp"
 
 #pragma endregion
 
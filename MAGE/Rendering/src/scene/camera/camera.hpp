@@ -738,6 +738,7 @@ namespace mage::rendering {
 			m_brdf(BRDF::Frostbite),
 			m_tone_mapping(ToneMapping::ACESFilmic),
 			m_render_layer_mask(static_cast< U32 >(RenderLayer::None)),
+			m_occlusion_culling(true),
 			m_fog(),
 			m_sky() {}
 
@@ -870,6 +871,31 @@ namespace mage::rendering {
 			m_render_layer_mask = static_cast< U32 >(RenderLayer::None);
 		}
 
+		//---------------------------------------------------------------------
+		// Member Methods: Occlusion Culling
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		bool UsesOcclusionCulling() const noexcept {
+			return m_occlusion_culling;
+		}
+
+		void EnableOcclusionCulling() noexcept {
+			SetOcclusionCulling(true);
+		}
+
+		void DisableOcclusionCulling() noexcept {
+			SetOcclusionCulling(false);
+		}
+
+		void ToggleOcclusionCulling() noexcept {
+			SetOcclusionCulling(!UsesOcclusionCulling());
+		}
+
+		void SetOcclusionCulling(bool occlusion_culling = true) noexcept {
+			m_occlusion_culling = occlusion_culling;
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Fog
 		//---------------------------------------------------------------------
@@ -954,6 +980,16 @@ namespace mage::rendering {
 		 */
 		U32 m_render_layer_mask;
 
+		//---------------------------------------------------------------------
+		// Member Variables: Occlusion Culling
+		//---------------------------------------------------------------------
+
+		/**
+		 A flag indicating whether software occlusion culling should be used
+		 for this camera settings.
+		 */
+		bool m_occlusion_culling;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Fog
 		//---------------------------------------------------------------------
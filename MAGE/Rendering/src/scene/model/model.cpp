@@ -5,6 +5,16 @@
 
 #include "scene\node.hpp"
 #include "scene\model\model.hpp"
+#include "parallel\id_generator.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <limits>
 
 #pragma endregion
 
@@ -13,17 +23,44 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	namespace {
+
+		/**
+		 The tolerated projected error (relative to the viewport height) of
+		 the levels of detail of models for a unit level of detail bias.
+		 */
+		constexpr F32 g_lod_screen_error = 0.001f;
+	}
+
+	F32 Model::s_lod_bias = 1.0f;
+
+	F32 Model::s_cluster_cull_distance = std::numeric_limits< F32 >::infinity();
+
 	Model::Model(ID3D11Device& device)
 		: Component(),
 		m_buffer(device),
 		m_aabb(),
 		m_sphere(),
+		m_obb(),
+		m_bounds_version(GetNextGuid()),
 		m_mesh(),
 		m_start_index(0u),
 		m_nb_indices(0u),
+		m_base_vertex(0u),
+		m_quantization(),
+		m_lods(),
+		m_lod(0u),
+		m_clusters(),
+		m_cluster_ranges(),
+		m_clusters_culled(false),
+		m_bvh(),
+		m_occluder_mesh(),
 		m_texture_transform(),
 		m_material(),
-		m_light_occlusion(true) {}
+		m_light_occlusion(true),
+		m_occluder(false),
+		m_occlusion_culled(false),
+		m_potentially_visible(true) {}
 
 	Model::Model(Model&& model) noexcept = default;
 
@@ -35,13 +72,231 @@ namespace mage::rendering {
 						std::size_t start_index,
 						std::size_t nb_indices,
 						AABB aabb,
-						BoundingSphere bs) {
+						BoundingSphere bs,
+						OBB obb,
+						std::size_t base_vertex,
+						PositionQuantization quantization,
+						std::vector< ModelPartLOD > lods,
+						std::vector< MeshCluster > clusters,
+						SharedPtr< const TriangleBVH > bvh,
+						SharedPtr< const OccluderMesh > occluder_mesh) {
+
+		m_aabb         = std::move(aabb);
+		m_sphere       = std::move(bs);
+		m_obb          = std::move(obb);
+		m_mesh         = std::move(mesh);
+		m_start_index  = start_index;
+		m_nb_indices   = nb_indices;
+		m_base_vertex  = base_vertex;
+		m_quantization = std::move(quantization);
+		m_lods         = std::move(lods);
+		m_lod          = 0u;
+		m_clusters     = std::move(clusters);
+
+		// Culling the mesh clusters never allocates.
+		m_cluster_ranges.clear();
+		m_cluster_ranges.reserve(m_clusters.size());
+		m_clusters_culled = false;
+
+		m_bvh = std::move(bvh);
+
+		// The model tree refits the world-space AABB of this model.
+		m_bounds_version = GetNextGuid();
+
+		m_occluder_mesh    = std::move(occluder_mesh);
+		m_occlusion_culled = false;
+	}
+
+	void XM_CALLCONV Model::SelectLOD(FXMMATRIX world_to_camera,
+									  CXMMATRIX camera_to_projection) const noexcept {
+		m_lod = 0u;
+		if (m_lods.empty()) {
+			return;
+		}
+
+		Assert(HasOwner());
+
+		const auto& transform       = GetOwner()->GetTransform();
+		const auto object_to_world  = transform.GetObjectToWorldMatrix();
+		const auto object_to_camera = object_to_world * world_to_camera;
+
+		// The radius of the bounding sphere in world space.
+		const auto scale  = XMVectorMax(XMVector3LengthSq(object_to_world.r[0]),
+										XMVectorMax(XMVector3LengthSq(object_to_world.r[1]),
+													XMVector3LengthSq(object_to_world.r[2])));
+		const auto radius = m_sphere.Radius() * std::sqrt(XMVectorGetX(scale));
+
+		// Use the full detail if the camera is inside the bounding sphere.
+		const auto p_camera = XMVector3TransformCoord(m_sphere.Centroid(),
+													  object_to_camera);
+		if (XMVectorGetX(XMVector3LengthSq(p_camera)) <= radius * radius) {
+			return;
+		}
+
+		const auto w = XMVectorGetW(XMVector3Transform(p_camera,
+													   camera_to_projection));
+		if (w <= 0.0f) {
+			return;
+		}
+
+		// The projected diameter of the bounding sphere relative to the
+		// viewport height.
+		const auto screen_size = radius
+			                   * XMVectorGetY(camera_to_projection.r[1]) / w;
+
+		// Select the coarsest level of detail whose error (relative to the
+		// bounding sphere) projects to a tolerated screen error.
+		const auto max_error = g_lod_screen_error * s_lod_bias
+			                 * m_sphere.Radius() / screen_size;
+		for (auto lod = m_lods.size(); 0u < lod; --lod) {
+			if (m_lods[lod - 1u].m_error <= max_error) {
+				m_lod = lod;
+				return;
+			}
+		}
+	}
+
+	void XM_CALLCONV Model::CullClusters(FXMMATRIX world_to_camera,
+										 CXMMATRIX camera_to_projection) const noexcept {
+		m_cluster_ranges.clear();
+		m_clusters_culled = false;
+		if (m_clusters.empty() || 0u != m_lod) {
+			return;
+		}
+
+		Assert(HasOwner());
+
+		const auto& transform           = GetOwner()->GetTransform();
+		const auto object_to_world      = transform.GetObjectToWorldMatrix();
+		const auto object_to_camera     = object_to_world * world_to_camera;
+		const auto object_to_projection = object_to_camera * camera_to_projection;
+		const BoundingFrustum frustum(object_to_projection);
+
+		// The position and viewing direction of the camera in object space.
+		const auto camera_to_object = XMMatrixInverse(nullptr, object_to_camera);
+		const auto p_camera = XMVector3TransformCoord(XMVectorZero(), camera_to_object);
+		const auto d_camera = XMVector3Normalize(
+			XMVector3TransformNormal(g_XMIdentityR2, camera_to_object));
+		const auto perspective = (0.0f != XMVectorGetW(camera_to_projection.r[2]));
+
+		// The normal cones are only preserved by uniform scaling.
+		const auto scale_x = XMVectorGetX(XMVector3LengthSq(object_to_world.r[0]));
+		const auto scale_y = XMVectorGetX(XMVector3LengthSq(object_to_world.r[1]));
+		const auto scale_z = XMVectorGetX(XMVector3LengthSq(object_to_world.r[2]));
+		const auto max_scale = std::max(scale_x, std::max(scale_y, scale_z));
+		const auto min_scale = std::min(scale_x, std::min(scale_y, scale_z));
+		const auto cull_back_faces = (max_scale <= 1.01f * min_scale);
+		const auto max_distance = s_cluster_cull_distance / std::sqrt(max_scale);
+
+		for (const auto& cluster : m_clusters) {
+			const auto centroid = XMLoad(cluster.m_sphere_centroid);
+			const auto radius   = cluster.m_sphere_radius;
+			const auto d        = centroid - p_camera;
+			const auto distance = XMVectorGetX(XMVector3Length(d));
+
+			// Apply distance culling.
+			if (max_distance < distance - radius) {
+				continue;
+			}
+
+			// Apply back-face culling.
+			if (cull_back_faces && cluster.m_cone_cutoff < 1.0f) {
+				const auto axis = XMLoad(cluster.m_cone_axis);
+				const auto back_facing = perspective
+					? (XMVectorGetX(XMVector3Dot(d, axis))
+					   >= cluster.m_cone_cutoff * distance + radius)
+					: (XMVectorGetX(XMVector3Dot(d_camera, axis))
+					   >= cluster.m_cone_cutoff);
+				if (back_facing) {
+					continue;
+				}
+			}
+
+			// Apply view frustum culling.
+			if (!frustum.Overlaps(BoundingSphere(centroid, radius))
+				|| !frustum.Overlaps(AABB(XMLoad(cluster.m_aabb_min),
+										  XMLoad(cluster.m_aabb_max)))) {
+				continue;
+			}
+
+			// Merge the index ranges of consecutive mesh clusters.
+			if (!m_cluster_ranges.empty()) {
+				auto& range = m_cluster_ranges.back();
+				if (range[0] + range[1] == cluster.m_start_index) {
+					range[1] += cluster.m_nb_indices;
+					continue;
+				}
+			}
+			m_cluster_ranges.push_back({ cluster.m_start_index,
+										 cluster.m_nb_indices });
+		}
+
+		m_clusters_culled = true;
+	}
+
+	bool XM_CALLCONV Model::Intersect(FXMVECTOR origin,
+									  FXMVECTOR direction,
+									  F32 max_distance,
+									  RayHit& hit,
+									  bool exact) const noexcept {
+		Assert(HasOwner());
+
+		// Distances along the object-space ray (with an unnormalized
+		// direction) are equal to distances along the world-space ray.
+		const auto& transform      = GetOwner()->GetTransform();
+		const auto world_to_object = transform.GetWorldToObjectMatrix();
+		const auto o = XMVector3TransformCoord(origin, world_to_object);
+		const auto d = XMVector3TransformNormal(direction, world_to_object);
+
+		if (exact && m_bvh && !m_bvh->empty()) {
+			return m_bvh->Intersect(o, d, max_distance, hit);
+		}
+
+		const auto [is_hit, distance]
+			= IntersectRay(m_aabb, o, XMVectorReciprocal(d), max_distance);
+		if (!is_hit) {
+			return false;
+		}
+
+		hit.m_distance    = distance;
+		hit.m_triangle    = RayHit::s_invalid_index;
+		hit.m_barycentric = { 0.0f, 0.0f };
+		return true;
+	}
+
+	[[nodiscard]]
+	bool XM_CALLCONV Model::Occluded(FXMVECTOR origin,
+									 FXMVECTOR direction,
+									 F32 max_distance,
+									 bool exact) const noexcept {
+		Assert(HasOwner());
+
+		const auto& transform      = GetOwner()->GetTransform();
+		const auto world_to_object = transform.GetWorldToObjectMatrix();
+		const auto o = XMVector3TransformCoord(origin, world_to_object);
+		const auto d = XMVector3TransformNormal(direction, world_to_object);
+
+		if (exact && m_bvh && !m_bvh->empty()) {
+			return m_bvh->Occluded(o, d, max_distance);
+		}
+
+		return IntersectRay(m_aabb, o, XMVectorReciprocal(d), max_distance).first;
+	}
+
+	void XM_CALLCONV Model::CullOcclusion(const OcclusionBuffer* buffer,
+										  FXMMATRIX world_to_projection) const noexcept {
+		m_occlusion_culled = false;
+		if (nullptr == buffer) {
+			return;
+		}
+
+		Assert(HasOwner());
+
+		const auto& transform            = GetOwner()->GetTransform();
+		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
+		const auto  object_to_projection = object_to_world * world_to_projection;
 
-		m_aabb        = std::move(aabb);
-		m_sphere      = std::move(bs);
-		m_mesh        = std::move(mesh);
-		m_start_index = start_index;
-		m_nb_indices  = nb_indices;
+		m_occlusion_culled = !buffer->IsVisible(object_to_projection, m_aabb);
 	}
 
 	void Model::UpdateBuffer(ID3D11DeviceContext& device_context) const {
@@ -51,10 +306,14 @@ namespace mage::rendering {
 		const auto  object_to_world   = transform.GetObjectToWorldMatrix();
 		const auto  world_to_object   = transform.GetWorldToObjectMatrix();
 		const auto  texture_transform = m_texture_transform.GetTransformMatrix();
+		// Packed vertex positions are dequantized as part of the
+		// object-to-world transform (normals are not affected).
+		const auto  dequantization    = m_quantization.GetDequantizationMatrix();
 
 		ModelBuffer buffer;
 		// Transforms
-		buffer.m_object_to_world      = XMMatrixTranspose(object_to_world);
+		buffer.m_object_to_world      = XMMatrixTranspose(dequantization
+			                                            * object_to_world);
 		buffer.m_normal_to_world      = world_to_object;
 		buffer.m_texture_transform    = XMMatrixTranspose(texture_transform);
 		// Material
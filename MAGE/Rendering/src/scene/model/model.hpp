@@ -7,6 +7,8 @@
 
 #include "scene\component.hpp"
 #include "resource\mesh\mesh.hpp"
+#include "resource\mesh\vertex_packing.hpp"
+#include "resource\model\model_output.hpp"
 #include "resource\model\material.hpp"
 #include "geometry\bounding_volume.hpp"
 #include "transform\transform.hpp"
@@ -30,6 +32,57 @@ namespace mage::rendering {
 
 	public:
 
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the level of detail bias of models.
+
+		 @return		The level of detail bias of models.
+		 */
+		[[nodiscard]]
+		static F32 GetLODBias() noexcept {
+			return s_lod_bias;
+		}
+
+		/**
+		 Sets the level of detail bias of models to the given value.
+
+		 The level of detail bias scales the tolerated projected error of the
+		 levels of detail of models. Larger values select coarser levels of
+		 detail.
+
+		 @param[in]		lod_bias
+						The level of detail bias.
+		 */
+		static void SetLODBias(F32 lod_bias) noexcept {
+			s_lod_bias = std::max(lod_bias, 0.0f);
+		}
+
+		/**
+		 Returns the cluster cull distance of models.
+
+		 @return		The cluster cull distance of models.
+		 */
+		[[nodiscard]]
+		static F32 GetClusterCullDistance() noexcept {
+			return s_cluster_cull_distance;
+		}
+
+		/**
+		 Sets the cluster cull distance of models to the given value.
+
+		 Mesh clusters of models which are (completely) farther away from the
+		 camera than the cluster cull distance (in world space) are culled.
+
+		 @param[in]		cluster_cull_distance
+						The cluster cull distance.
+		 */
+		static void SetClusterCullDistance(F32 cluster_cull_distance) noexcept {
+			s_cluster_cull_distance = std::max(cluster_cull_distance, 0.0f);
+		}
+
 		//---------------------------------------------------------------------
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
@@ -103,12 +156,36 @@ namespace mage::rendering {
 						The AABB.
 		 @param[in]		bs
 						The bounding sphere.
+		 @param[in]		obb
+						The OBB.
+		 @param[in]		base_vertex
+						The base vertex in the mesh.
+		 @param[in]		quantization
+						The position quantization of the (packed) vertices.
+		 @param[in]		lods
+						The coarser levels of detail in the mesh (in order of
+						decreasing detail).
+		 @param[in]		clusters
+						The mesh clusters partitioning the indices in the mesh.
+		 @param[in]		bvh
+						A pointer to the triangle bounding volume hierarchy
+						for ray casting (may be @c nullptr).
+		 @param[in]		occluder_mesh
+						A pointer to the occluder mesh for occlusion culling
+						(may be @c nullptr).
 		 */
 		void SetMesh(SharedPtr< const Mesh > mesh,
 					 std::size_t start_index,
 					 std::size_t nb_indices,
 					 AABB aabb,
-					 BoundingSphere bs);
+					 BoundingSphere bs,
+					 OBB obb,
+					 std::size_t base_vertex = 0u,
+					 PositionQuantization quantization = {},
+					 std::vector< ModelPartLOD > lods = {},
+					 std::vector< MeshCluster > clusters = {},
+					 SharedPtr< const TriangleBVH > bvh = nullptr,
+					 SharedPtr< const OccluderMesh > occluder_mesh = nullptr);
 
 		/**
 		 Returns the AABB of this model.
@@ -130,6 +207,29 @@ namespace mage::rendering {
 			return m_sphere;
 		}
 
+		/**
+		 Returns the OBB of this model.
+
+		 @return		A reference to the OBB of this model.
+		 */
+		[[nodiscard]]
+		const OBB& GetOBB() const noexcept {
+			return m_obb;
+		}
+
+		/**
+		 Returns the version of the bounding volumes of this model.
+
+		 The version changes whenever the mesh of this model is set. Two
+		 models never have the same version.
+
+		 @return		The version of the bounding volumes of this model.
+		 */
+		[[nodiscard]]
+		U64 GetBoundsVersion() const noexcept {
+			return m_bounds_version;
+		}
+
 		/**
 		 Returns the start index of this model in the mesh of this model.
 
@@ -151,6 +251,73 @@ namespace mage::rendering {
 			return m_nb_indices;
 		}
 
+		/**
+		 Returns the number of levels of detail (including the full detail)
+		 of this model.
+
+		 @return		The number of levels of detail of this model.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfLODs() const noexcept {
+			return m_lods.size() + 1u;
+		}
+
+		/**
+		 Returns the selected level of detail of this model.
+
+		 @return		The selected level of detail of this model (0 for the
+						full detail).
+		 */
+		[[nodiscard]]
+		std::size_t GetLOD() const noexcept {
+			return m_lod;
+		}
+
+		/**
+		 Selects the level of detail of this model for the given camera.
+
+		 The coarsest level of detail is selected whose error, projected
+		 based on the projected size of the bounding sphere of this model,
+		 is tolerated for the level of detail bias of models.
+
+		 @pre			This model has an owner.
+		 @param[in]		world_to_camera
+						The world-to-camera transformation matrix.
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 */
+		void XM_CALLCONV SelectLOD(FXMMATRIX world_to_camera,
+								   CXMMATRIX camera_to_projection) const noexcept;
+
+		/**
+		 Returns the number of mesh clusters of this model.
+
+		 @return		The number of mesh clusters of this model.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfClusters() const noexcept {
+			return m_clusters.size();
+		}
+
+		/**
+		 Culls the mesh clusters of this model for the given camera.
+
+		 Mesh clusters are culled against the view frustum, their normal cone
+		 (back-face culling) and the cluster cull distance of models. The
+		 remaining mesh clusters are merged into contiguous index ranges. Mesh
+		 clusters are only culled for the full detail.
+
+		 @pre			This model has an owner.
+		 @pre			The level of detail of this model is selected for the
+						given camera.
+		 @param[in]		world_to_camera
+						The world-to-camera transformation matrix.
+		 @param[in]		camera_to_projection
+						The camera-to-projection transformation matrix.
+		 */
+		void XM_CALLCONV CullClusters(FXMMATRIX world_to_camera,
+									  CXMMATRIX camera_to_projection) const noexcept;
+
 		/**
 		 Binds the mesh of this model.
 
@@ -180,11 +347,94 @@ namespace mage::rendering {
 
 		 @param[in]		device_context
 						A reference to the device context.
-		 */
-		void Draw(ID3D11DeviceContext& device_context) const noexcept {
-			m_mesh->Draw(device_context, m_start_index, m_nb_indices);
+		 @param[in]		cull_clusters
+						@c true if only the mesh clusters which are not culled
+						for the camera need to be drawn at the level of detail
+						selected for the camera. @c false otherwise (e.g., for
+						light occlusion and voxelization), in which case the
+						full detail is drawn since models outside the view
+						frustum of the camera keep a stale level of detail.
+		 */
+		void Draw(ID3D11DeviceContext& device_context,
+				  bool cull_clusters = true) const noexcept {
+
+			if (cull_clusters && m_clusters_culled) {
+				for (const auto& range : m_cluster_ranges) {
+					m_mesh->Draw(device_context, range[0], range[1],
+								 m_base_vertex);
+				}
+				return;
+			}
+
+			const auto lod_index = cull_clusters ? m_lod : 0u;
+			if (0u == lod_index) {
+				m_mesh->Draw(device_context, m_start_index, m_nb_indices,
+							 m_base_vertex);
+				return;
+			}
+
+			const auto& lod = m_lods[lod_index - 1u];
+			m_mesh->Draw(device_context, lod.m_start_index, lod.m_nb_indices,
+						 m_base_vertex);
 		}
 
+		//---------------------------------------------------------------------
+		// Member Methods: Ray Casting
+		//---------------------------------------------------------------------
+
+		/**
+		 Intersects the given (world-space) ray with this model.
+
+		 The ray is intersected with the triangles of this model if an exact
+		 test is requested and this model has a triangle bounding volume
+		 hierarchy. Otherwise, the ray is intersected with the AABB of this
+		 model.
+
+		 @pre			This model has an owner.
+		 @param[in]		origin
+						The (world-space) origin of the ray.
+		 @param[in]		direction
+						The (world-space) direction of the ray.
+		 @param[in]		max_distance
+						The maximum distance along the ray.
+		 @param[out]	hit
+						A reference to the ray hit. The distance, triangle and
+						barycentric coordinates are only updated in case of a
+						hit.
+		 @param[in]		exact
+						@c true if the triangles of this model need to be
+						intersected. @c false otherwise.
+		 @return		@c true if the ray hits this model closer than the
+						given maximum distance. @c false otherwise.
+		 */
+		bool XM_CALLCONV Intersect(FXMVECTOR origin,
+								   FXMVECTOR direction,
+								   F32 max_distance,
+								   RayHit& hit,
+								   bool exact = true) const noexcept;
+
+		/**
+		 Checks whether the given (world-space) ray hits this model.
+
+		 @pre			This model has an owner.
+		 @param[in]		origin
+						The (world-space) origin of the ray.
+		 @param[in]		direction
+						The (world-space) direction of the ray.
+		 @param[in]		max_distance
+						The maximum distance along the ray.
+		 @param[in]		exact
+						@c true if the triangles of this model need to be
+						intersected. @c false otherwise.
+		 @return		@c true if the ray hits this model closer than the
+						given maximum distance. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool XM_CALLCONV Occluded(FXMVECTOR origin,
+								  FXMVECTOR direction,
+								  F32 max_distance,
+								  bool exact = true) const noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Methods: Appearance
 		//---------------------------------------------------------------------
@@ -276,6 +526,93 @@ namespace mage::rendering {
 			m_light_occlusion = light_occlusion;
 		}
 
+		/**
+		 Returns the occluder mesh of this model.
+
+		 @return		A pointer to the occluder mesh of this model (may be
+						@c nullptr).
+		 */
+		[[nodiscard]]
+		const OccluderMesh* GetOccluderMesh() const noexcept {
+			return m_occluder_mesh.get();
+		}
+
+		/**
+		 Checks whether this model is a designated occluder.
+
+		 Designated occluders (with an occluder mesh) are always rasterized
+		 into the occlusion buffer of a camera. Other models are only picked
+		 as occluders based on their projected size.
+
+		 @return		@c true if this model is a designated occluder.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsOccluder() const noexcept {
+			return m_occluder;
+		}
+
+		/**
+		 Sets whether this model is a designated occluder.
+
+		 @param[in]		occluder
+						@c true if this model needs to be a designated
+						occluder. @c false otherwise.
+		 */
+		void SetOccluder(bool occluder) noexcept {
+			m_occluder = occluder;
+		}
+
+		/**
+		 Checks whether this model is culled by occlusion culling for the
+		 camera.
+
+		 @return		@c true if this model is culled by occlusion culling
+						or by the potentially visible set of the world for the
+						camera. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsOcclusionCulled() const noexcept {
+			return m_occlusion_culled || !m_potentially_visible;
+		}
+
+		/**
+		 Checks whether this model is potentially visible from the cell of
+		 the potentially visible set of the world containing the camera.
+
+		 @return		@c true if this model is potentially visible for the
+						camera. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsPotentiallyVisible() const noexcept {
+			return m_potentially_visible;
+		}
+
+		/**
+		 Sets the potential visibility of this model for the camera.
+
+		 @param[in]		potentially_visible
+						@c true if this model is potentially visible for the
+						camera. @c false otherwise.
+		 */
+		void SetPotentiallyVisible(bool potentially_visible) const noexcept {
+			m_potentially_visible = potentially_visible;
+		}
+
+		/**
+		 Culls this model against the given occlusion buffer of the camera.
+
+		 @pre			This model has an owner.
+		 @param[in]		buffer
+						A pointer to the occlusion buffer of the camera (may be
+						@c nullptr if the camera uses no occlusion culling).
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix of the
+						occlusion buffer (with an inverted depth).
+		 */
+		void XM_CALLCONV CullOcclusion(const OcclusionBuffer* buffer,
+									   FXMMATRIX world_to_projection) const noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Methods: Buffer
 		//---------------------------------------------------------------------
@@ -309,6 +646,20 @@ namespace mage::rendering {
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The level of detail bias of models.
+		 */
+		static F32 s_lod_bias;
+
+		/**
+		 The cluster cull distance of models.
+		 */
+		static F32 s_cluster_cull_distance;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Buffer
 		//---------------------------------------------------------------------
@@ -332,6 +683,16 @@ namespace mage::rendering {
 		 */
 		BoundingSphere m_sphere;
 
+		/**
+		 The OBB of this model.
+		 */
+		OBB m_obb;
+
+		/**
+		 The version of the bounding volumes of this model.
+		 */
+		U64 m_bounds_version;
+
 		/**
 		 A pointer to the mesh of this model.
 		 */
@@ -347,6 +708,55 @@ namespace mage::rendering {
 		 */
 		std::size_t m_nb_indices;
 
+		/**
+		 The base vertex of this model in the mesh of this model.
+		 */
+		std::size_t m_base_vertex;
+
+		/**
+		 The position quantization of the vertices of this model.
+		 */
+		PositionQuantization m_quantization;
+
+		/**
+		 The coarser levels of detail of this model in the mesh of this model.
+		 */
+		std::vector< ModelPartLOD > m_lods;
+
+		/**
+		 The selected level of detail of this model (0 for the full detail).
+		 */
+		mutable std::size_t m_lod;
+
+		/**
+		 The mesh clusters of this model in the mesh of this model.
+		 */
+		std::vector< MeshCluster > m_clusters;
+
+		/**
+		 The index ranges (start index, number of indices) of the mesh
+		 clusters of this model which are not culled for the camera.
+		 */
+		mutable std::vector< U32x2 > m_cluster_ranges;
+
+		/**
+		 A flag indicating whether the mesh clusters of this model are culled
+		 for the camera.
+		 */
+		mutable bool m_clusters_culled;
+
+		/**
+		 A pointer to the triangle bounding volume hierarchy of this model
+		 (in object space) for ray casting.
+		 */
+		SharedPtr< const TriangleBVH > m_bvh;
+
+		/**
+		 A pointer to the occluder mesh of this model (in object space) for
+		 occlusion culling.
+		 */
+		SharedPtr< const OccluderMesh > m_occluder_mesh;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Appearance
 		//---------------------------------------------------------------------
@@ -369,6 +779,24 @@ namespace mage::rendering {
 		 A flag indicating whether this model occludes light.
 		 */
 		bool m_light_occlusion;
+
+		/**
+		 A flag indicating whether this model is a designated occluder.
+		 */
+		bool m_occluder;
+
+		/**
+		 A flag indicating whether this model is culled by occlusion culling
+		 for the camera.
+		 */
+		mutable bool m_occlusion_culled;
+
+		/**
+		 A flag indicating whether this model is potentially visible from
+		 the cell of the potentially visible set of the world containing the
+		 camera.
+		 */
+		mutable bool m_potentially_visible;
 	};
 
 	#pragma warning( pop )
@@ -7,6 +7,16 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -26,7 +36,15 @@ namespace mage::rendering {
 		m_spot_lights(),
 		m_models(),
 		m_sprite_images(),
-		m_sprite_texts() {}
+		m_sprite_texts(),
+		m_model_tree(),
+		m_model_proxies(),
+		m_model_versions(),
+		m_model_bounds_versions(),
+		m_model_tree_cost(0.0f),
+		m_pvs(),
+		m_world_to_pvs(XMMatrixIdentity()),
+		m_pvs_cell(PotentiallyVisibleSet::s_null_cell) {}
 
 	World::World(World&& world) noexcept = default;
 
@@ -44,5 +62,232 @@ namespace mage::rendering {
 		m_models.clear();
 		m_sprite_images.clear();
 		m_sprite_texts.clear();
+
+		m_model_tree.Clear();
+		m_model_proxies.clear();
+		m_model_versions.clear();
+		m_model_bounds_versions.clear();
+		m_model_tree_cost = 0.0f;
+
+		m_pvs.reset();
+		m_world_to_pvs = XMMatrixIdentity();
+		m_pvs_cell     = PotentiallyVisibleSet::s_null_cell;
+	}
+
+	bool XM_CALLCONV World::Intersect(FXMVECTOR origin,
+									  FXMVECTOR direction,
+									  F32 max_distance,
+									  RayHit& hit,
+									  bool exact) const {
+		bool found = false;
+		m_model_tree.RayCast(origin, direction, max_distance,
+			[this, origin, direction, exact, &hit, &found](U32 index,
+														   F32 distance) {
+				const auto& model = m_models[index];
+				if (State::Terminated == model.GetState()
+					|| !model.Intersect(origin, direction, distance, hit, exact)) {
+					return distance;
+				}
+
+				hit.m_data = index;
+				found = true;
+				return hit.m_distance;
+			}
+		);
+
+		return found;
+	}
+
+	[[nodiscard]]
+	bool XM_CALLCONV World::Occluded(FXMVECTOR origin,
+									 FXMVECTOR direction,
+									 F32 max_distance,
+									 bool exact) const {
+		bool found = false;
+		m_model_tree.RayCast(origin, direction, max_distance,
+			[this, origin, direction, exact, &found](U32 index,
+													 F32 distance) {
+				const auto& model = m_models[index];
+				if (State::Terminated == model.GetState()
+					|| !model.Occluded(origin, direction, distance, exact)) {
+					return distance;
+				}
+
+				// Terminate the query at the first hit.
+				found = true;
+				return 0.0f;
+			}
+		);
+
+		return found;
+	}
+
+	std::size_t World::Intersect(gsl::span< const Ray > rays,
+								 gsl::span< RayHit > hits,
+								 bool exact) const {
+		Assert(rays.size() == hits.size());
+
+		std::size_t nb_hits = 0u;
+		for (std::ptrdiff_t i = 0; i < rays.size(); ++i) {
+			const auto& ray = rays[i];
+			auto& hit = hits[i];
+
+			hit = RayHit();
+			if (Intersect(XMLoad(ray.m_origin), XMLoad(ray.m_direction),
+						  ray.m_max_distance, hit, exact)) {
+				++nb_hits;
+			}
+		}
+
+		return nb_hits;
+	}
+
+	void World::UpdateModelTree() {
+		m_model_proxies.resize(m_models.size(), DynamicAABBTree::s_null_node);
+		m_model_versions.resize(m_models.size(), s_unknown_version);
+		m_model_bounds_versions.resize(m_models.size(), s_unknown_version);
+
+		std::size_t nb_reinserted = 0u;
+		for (std::size_t i = 0u; i < m_models.size(); ++i) {
+			const auto& model    = m_models[i];
+			auto& proxy          = m_model_proxies[i];
+			auto& version        = m_model_versions[i];
+			auto& bounds_version = m_model_bounds_versions[i];
+
+			// The world-space AABB is the overlap of the world-space AABBs of
+			// the AABB and the OBB of the model.
+			auto aabb = AABB();
+			if (State::Terminated != model.GetState() && model.HasOwner()) {
+				const auto& transform = model.GetOwner()->GetTransform();
+
+				// Models whose transform and bounds did not change since the
+				// last update are not refitted.
+				if (transform.GetVersion() == version
+					&& model.GetBoundsVersion() == bounds_version) {
+					continue;
+				}
+				version        = transform.GetVersion();
+				bounds_version = model.GetBoundsVersion();
+
+				const auto object_to_world = transform.GetObjectToWorldMatrix();
+				aabb = AABB::Overlap(
+					AABB::Transform(model.GetAABB(), object_to_world),
+					AABB(OBB::Transform(model.GetOBB(), object_to_world)));
+			}
+			else {
+				version        = s_unknown_version;
+				bounds_version = s_unknown_version;
+			}
+
+			// Terminated, detached and unbounded models are not contained.
+			if (!XMVector3LessOrEqual(aabb.MinPoint(), aabb.MaxPoint())) {
+				if (DynamicAABBTree::s_null_node != proxy) {
+					m_model_tree.Remove(proxy);
+					proxy = DynamicAABBTree::s_null_node;
+				}
+				continue;
+			}
+
+			if (DynamicAABBTree::s_null_node == proxy) {
+				proxy = m_model_tree.Insert(aabb, static_cast< U32 >(i));
+				++nb_reinserted;
+			}
+			else if (m_model_tree.Move(proxy, aabb)) {
+				++nb_reinserted;
+			}
+		}
+
+		if (0u == nb_reinserted) {
+			return;
+		}
+
+		// Rebuild the model tree if more than half of the models were
+		// (re)inserted incrementally or if its cost doubled since the last
+		// (re)build.
+		if (m_model_tree.size() < 2u * nb_reinserted
+			|| 2.0f * m_model_tree_cost < m_model_tree.GetCost()) {
+
+			m_model_tree.Build();
+			m_model_tree_cost = m_model_tree.GetCost();
+		}
+	}
+
+	[[nodiscard]]
+	SharedPtr< PotentiallyVisibleSet > World
+		::ComputePotentiallyVisibleSet(const AABB& bounds,
+									   F32 cell_size,
+									   std::size_t nb_rays_per_cell) const {
+		Assert(0.0f < cell_size);
+
+		// Determine the grid of cells.
+		auto grid = bounds;
+		if (!XMVector3Less(grid.MinPoint(), grid.MaxPoint())) {
+			grid = AABB();
+			for (const auto proxy : m_model_proxies) {
+				if (DynamicAABBTree::s_null_node != proxy) {
+					grid = AABB::Union(grid, m_model_tree.GetAABB(proxy));
+				}
+			}
+		}
+
+		// The member method hides the free function.
+		return MakeShared< PotentiallyVisibleSet >(
+			mage::ComputePotentiallyVisibleSet(grid, cell_size, m_models.size(),
+											   nb_rays_per_cell,
+				[this](const AABB& cell, const auto& mark) {
+					m_model_tree.Query(cell, [this, &mark](U32 index) {
+						if (State::Terminated != m_models[index].GetState()) {
+							mark(index);
+						}
+					});
+				},
+				[this](FXMVECTOR origin, FXMVECTOR direction, RayHit& hit) {
+					return Intersect(origin, direction,
+									 std::numeric_limits< F32 >::infinity(), hit);
+				}));
+	}
+
+	void XM_CALLCONV World
+		::SetPotentiallyVisibleSet(SharedPtr< const PotentiallyVisibleSet > pvs,
+								   FXMMATRIX world_to_pvs) {
+
+		m_pvs          = std::move(pvs);
+		m_world_to_pvs = world_to_pvs;
+		m_pvs_cell     = PotentiallyVisibleSet::s_null_cell;
+
+		for (const auto& model : m_models) {
+			model.SetPotentiallyVisible(true);
+		}
+	}
+
+	void World::UpdatePotentialVisibility(std::size_t cell) const noexcept {
+		if (cell == m_pvs_cell) {
+			return;
+		}
+
+		m_pvs_cell = cell;
+
+		if (PotentiallyVisibleSet::s_null_cell == cell
+			|| !m_pvs || m_pvs->GetNumberOfCells() <= cell) {
+
+			for (const auto& model : m_models) {
+				model.SetPotentiallyVisible(true);
+			}
+			return;
+		}
+
+		// Models which are not covered by the potentially visible set are
+		// always potentially visible.
+		const auto nb_objects = std::min(m_pvs->GetNumberOfObjects(),
+										 m_models.size());
+		for (std::size_t i = 0u; i < m_models.size(); ++i) {
+			m_models[i].SetPotentiallyVisible(nb_objects <= i);
+		}
+
+		m_pvs->ForEachVisible(cell, [this, nb_objects](U32 index) noexcept {
+			if (index < nb_objects) {
+				m_models[index].SetPotentiallyVisible(true);
+			}
+		});
 	}
 }
\ No newline at end of file
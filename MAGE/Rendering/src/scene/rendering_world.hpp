@@ -17,6 +17,8 @@
 #include "scene\model\model.hpp"
 #include "scene\sprite\sprite_image.hpp"
 #include "scene\sprite\sprite_text.hpp"
+#include "geometry\dynamic_aabb_tree.hpp"
+#include "geometry\potentially_visible_set.hpp"
 
 #pragma endregion
 
@@ -111,6 +113,266 @@ namespace mage::rendering {
 		template< typename ComponentT, typename ActionT >
 		void ForEach(ActionT&& action) const;
 
+		/**
+		 Calls the given action for each component of the given type whose
+		 (world-space) bounding volume overlaps the given bounding volume.
+
+		 @pre			The model tree of this world is up to date.
+		 @tparam		ComponentT
+						The component type (@c Model).
+		 @tparam		BoundingVolumeT
+						The bounding volume type (@c AABB,
+						@c BoundingSphere or @c BoundingFrustum).
+		 @tparam		ActionT
+						An action to perform on each overlapping component.
+		 @param[in]		volume
+						A reference to the (world-space) bounding volume.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename ComponentT, typename BoundingVolumeT,
+			      typename ActionT >
+		void ForEach(const BoundingVolumeT& volume, ActionT&& action) const;
+
+		/**
+		 Calls the given action for each component of the given type whose
+		 (world-space) bounding volume overlaps the given bounding volume and
+		 which is potentially visible from the given position.
+
+		 The given position is transformed to the space of the potentially
+		 visible set of this world. If the given position lies outside the
+		 cells of the potentially visible set of this world (or if this world
+		 has no potentially visible set), all overlapping components are
+		 potentially visible. The potential visibility of all models is
+		 updated for the cell containing the given position.
+
+		 @pre			The model tree of this world is up to date.
+		 @tparam		ComponentT
+						The component type (@c Model).
+		 @tparam		BoundingVolumeT
+						The bounding volume type (@c AABB,
+						@c BoundingSphere or @c BoundingFrustum).
+		 @tparam		ActionT
+						An action to perform on each overlapping, potentially
+						visible component.
+		 @param[in]		position
+						The (world-space) position (e.g., of the camera).
+		 @param[in]		volume
+						A reference to the (world-space) bounding volume.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename ComponentT, typename BoundingVolumeT,
+			      typename ActionT >
+		void XM_CALLCONV ForEachPotentiallyVisible(FXMVECTOR position,
+												   const BoundingVolumeT& volume,
+												   ActionT&& action) const;
+
+		/**
+		 Calls the given action for each model whose (world-space) AABB is
+		 intersected by the given ray, in approximate front-to-back order.
+
+		 @pre			The model tree of this world is up to date.
+		 @tparam		ActionT
+						An action to perform on each intersected model. This
+						action must accept a model and the current maximum
+						distance as @c F32 argument, and must return the new
+						maximum distance. A non-positive maximum distance
+						terminates the query.
+		 @param[in]		origin
+						The (world-space) origin of the ray.
+		 @param[in]		direction
+						The (world-space, normalized) direction of the ray.
+		 @param[in]		max_distance
+						The maximum distance along the ray.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename ActionT >
+		void XM_CALLCONV RayCast(FXMVECTOR origin,
+								 FXMVECTOR direction,
+								 F32 max_distance,
+								 ActionT&& action) const;
+
+		/**
+		 Intersects the given (world-space) ray with the models of this world
+		 and returns the closest hit.
+
+		 The models are first culled with the model tree of this world
+		 (top level) and then intersected with the triangle bounding volume
+		 hierarchy of each model (bottom level).
+
+		 @pre			The model tree of this world is up to date.
+		 @param[in]		origin
+						The (world-space) origin of the ray.
+		 @param[in]		direction
+						The (world-space, normalized) direction of the ray.
+		 @param[in]		max_distance
+						The maximum distance along the ray.
+		 @param[out]	hit
+						A reference to the closest ray hit. The user data of
+						the ray hit is the index of the hit model.
+		 @param[in]		exact
+						@c true if the triangles of the models need to be
+						intersected. @c false if only the AABBs of the models
+						need to be intersected.
+		 @return		@c true if the ray hits a model closer than the given
+						maximum distance. @c false otherwise.
+		 */
+		bool XM_CALLCONV Intersect(FXMVECTOR origin,
+								   FXMVECTOR direction,
+								   F32 max_distance,
+								   RayHit& hit,
+								   bool exact = true) const;
+
+		/**
+		 Checks whether the given (world-space) ray hits any model of this
+		 world.
+
+		 @pre			The model tree of this world is up to date.
+		 @param[in]		origin
+						The (world-space) origin of the ray.
+		 @param[in]		direction
+						The (world-space, normalized) direction of the ray.
+		 @param[in]		max_distance
+						The maximum distance along the ray.
+		 @param[in]		exact
+						@c true if the triangles of the models need to be
+						intersected. @c false if only the AABBs of the models
+						need to be intersected.
+		 @return		@c true if the ray hits a model closer than the given
+						maximum distance. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool XM_CALLCONV Occluded(FXMVECTOR origin,
+								  FXMVECTOR direction,
+								  F32 max_distance,
+								  bool exact = true) const;
+
+		/**
+		 Intersects the given (world-space) rays with the models of this
+		 world and returns the closest hits.
+
+		 @pre			The model tree of this world is up to date.
+		 @pre			The sizes of @a rays and @a hits are equal.
+		 @param[in]		rays
+						A reference to the rays.
+		 @param[out]	hits
+						A reference to the closest ray hits. The user data of
+						each ray hit is the index of the hit model.
+		 @param[in]		exact
+						@c true if the triangles of the models need to be
+						intersected. @c false if only the AABBs of the models
+						need to be intersected.
+		 @return		The number of rays which hit a model.
+		 */
+		std::size_t Intersect(gsl::span< const Ray > rays,
+							  gsl::span< RayHit > hits,
+							  bool exact = true) const;
+
+		/**
+		 Returns the model of this world with the given index.
+
+		 @param[in]		index
+						The index of the model (e.g., the user data of a ray
+						hit).
+		 @return		A pointer to the model of this world with the given
+						index.
+		 */
+		[[nodiscard]]
+		ProxyPtr< Model > GetModel(std::size_t index) noexcept {
+			return ProxyPtr< Model >(m_models, index);
+		}
+
+		/**
+		 Updates the model tree of this world.
+
+		 The world-space AABBs of the models are synchronized with the
+		 bounds and owner transforms of the models. Only models whose bounds
+		 or owner transform changed since the last update are refitted.
+		 Models which moved outside their fattened AABB are reinserted. The model tree is
+		 rebuilt with the surface area heuristic if many models were
+		 reinserted or if its quality degraded too much.
+		 */
+		void UpdateModelTree();
+
+		/**
+		 Returns the model tree of this world.
+
+		 @return		A reference to the model tree of this world. The user
+						data of each proxy is the index of the model.
+		 */
+		[[nodiscard]]
+		const DynamicAABBTree& GetModelTree() const noexcept {
+			return m_model_tree;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Potentially Visible Sets
+		//---------------------------------------------------------------------
+
+		/**
+		 Computes the potentially visible set of the (current) models of this
+		 world.
+
+		 The given bounds are partitioned into a uniform grid of cells. For
+		 each cell, rays are cast from random points inside the cell in
+		 random directions, and each model hit first is potentially visible
+		 from that cell. Models overlapping a cell are always potentially
+		 visible from that cell. The cells are distributed over the cores of
+		 the system.
+
+		 @pre			The model tree of this world is up to date.
+		 @pre			@a cell_size is positive.
+		 @param[in]		bounds
+						A reference to the (world-space) AABB of the navigable
+						space. If empty, the AABB of all models is used.
+		 @param[in]		cell_size
+						The (maximum) size of each cell.
+		 @param[in]		nb_rays_per_cell
+						The number of rays to cast from each cell.
+		 @return		A pointer to the potentially visible set of the models
+						of this world.
+		 */
+		[[nodiscard]]
+		SharedPtr< PotentiallyVisibleSet > ComputePotentiallyVisibleSet(
+			const AABB& bounds, F32 cell_size,
+			std::size_t nb_rays_per_cell) const;
+
+		/**
+		 Returns the potentially visible set of this world.
+
+		 @return		A pointer to the potentially visible set of this world
+						(may be @c nullptr).
+		 */
+		[[nodiscard]]
+		const SharedPtr< const PotentiallyVisibleSet >&
+			GetPotentiallyVisibleSet() const noexcept {
+
+			return m_pvs;
+		}
+
+		/**
+		 Sets the potentially visible set of this world.
+
+		 The objects of the potentially visible set correspond to the
+		 models of this world with the same index. Models with an index
+		 beyond the number of objects of the potentially visible set are
+		 always potentially visible.
+
+		 @param[in]		pvs
+						A pointer to the potentially visible set (may be
+						@c nullptr).
+		 @param[in]		world_to_pvs
+						The transformation matrix from world space to the
+						space of the potentially visible set (e.g., the
+						object space of the root node of the model it was
+						computed for).
+		 */
+		void XM_CALLCONV SetPotentiallyVisibleSet(
+			SharedPtr< const PotentiallyVisibleSet > pvs,
+			FXMMATRIX world_to_pvs = XMMatrixIdentity());
+
 		/**
 		 Clears this world.
 		 */
@@ -118,6 +380,29 @@ namespace mage::rendering {
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The version of models whose transform is unknown to the model tree.
+		 */
+		static constexpr U64 s_unknown_version = std::numeric_limits< U64 >::max();
+
+		//---------------------------------------------------------------------
+		// Member Methods: Potentially Visible Sets
+		//---------------------------------------------------------------------
+
+		/**
+		 Updates the potential visibility of the models of this world for
+		 the given cell of the potentially visible set of this world.
+
+		 @param[in]		cell
+						The index of the cell (may be
+						@c PotentiallyVisibleSet::s_null_cell).
+		 */
+		void UpdatePotentialVisibility(std::size_t cell) const noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -185,6 +470,59 @@ namespace mage::rendering {
 		 A vector containing the sprite texts of this world.
 		 */
 		AlignedVector< SpriteText > m_sprite_texts;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Spatial Queries
+		//---------------------------------------------------------------------
+
+		/**
+		 The dynamic AABB tree containing the world-space AABBs of the
+		 models of this world.
+		 */
+		DynamicAABBTree m_model_tree;
+
+		/**
+		 A vector containing the proxy in the model tree of each model of
+		 this world (indexed by model).
+		 */
+		std::vector< U32 > m_model_proxies;
+
+		/**
+		 A vector containing the version of the owner transform of each model
+		 of this world (indexed by model) at the last update of the model
+		 tree.
+		 */
+		std::vector< U64 > m_model_versions;
+
+		/**
+		 A vector containing the version of the bounding volumes of each
+		 model of this world (indexed by model) at the last update of the
+		 model tree.
+		 */
+		std::vector< U64 > m_model_bounds_versions;
+
+		/**
+		 The cost of the model tree of this world right after its last
+		 (re)build.
+		 */
+		F32 m_model_tree_cost;
+
+		/**
+		 A pointer to the potentially visible set of this world.
+		 */
+		SharedPtr< const PotentiallyVisibleSet > m_pvs;
+
+		/**
+		 The transformation matrix from world space to the space of the
+		 potentially visible set of this world.
+		 */
+		XMMATRIX m_world_to_pvs;
+
+		/**
+		 The cell of the potentially visible set of this world for which the
+		 potential visibility of the models is up to date.
+		 */
+		mutable std::size_t m_pvs_cell;
 	};
 }
 
@@ -301,4 +301,85 @@ namespace mage::rendering {
 	}
 
 	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Scene: Spatial Queries
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	template< typename ComponentT, typename BoundingVolumeT, typename ActionT >
+	void World::ForEach(const BoundingVolumeT& volume, ActionT&& action) const {
+		static_assert(std::is_same_v< Model, ComponentT >,
+					  "Only models are contained in the model tree.");
+
+		m_model_tree.Query(volume, [this, &action](U32 index) {
+			const auto& component = m_models[index];
+			if (State::Terminated != component.GetState()) {
+				action(component);
+			}
+		});
+	}
+
+	template< typename ComponentT, typename BoundingVolumeT,
+		      typename ActionT >
+	void XM_CALLCONV World::ForEachPotentiallyVisible(FXMVECTOR position,
+													  const BoundingVolumeT& volume,
+													  ActionT&& action) const {
+		static_assert(std::is_same_v< Model, ComponentT >,
+					  "Only models are contained in the model tree.");
+
+		const auto cell = m_pvs
+			? m_pvs->GetCell(XMVector3TransformCoord(position, m_world_to_pvs))
+			: PotentiallyVisibleSet::s_null_cell;
+		UpdatePotentialVisibility(cell);
+
+		if (PotentiallyVisibleSet::s_null_cell == cell) {
+			ForEach< ComponentT >(volume, std::forward< ActionT >(action));
+			return;
+		}
+
+		const auto visit = [this, &volume, &action](std::size_t index) {
+			if (m_model_proxies.size() <= index) {
+				return;
+			}
+
+			const auto proxy = m_model_proxies[index];
+			if (DynamicAABBTree::s_null_node == proxy
+				|| !details::Overlaps(volume, m_model_tree.GetAABB(proxy))) {
+				return;
+			}
+
+			const auto& component = m_models[index];
+			if (State::Terminated != component.GetState()) {
+				action(component);
+			}
+		};
+
+		// Visit the potentially visible models of the cell, followed by the
+		// models which are not covered by the potentially visible set.
+		m_pvs->ForEachVisible(cell, visit);
+		for (auto index = m_pvs->GetNumberOfObjects();
+			 index < m_models.size(); ++index) {
+
+			visit(index);
+		}
+	}
+
+	template< typename ActionT >
+	void XM_CALLCONV World::RayCast(FXMVECTOR origin,
+									FXMVECTOR direction,
+									F32 max_distance,
+									ActionT&& action) const {
+
+		m_model_tree.RayCast(origin, direction, max_distance,
+			[this, &action](U32 index, F32 distance) {
+				const auto& component = m_models[index];
+				return (State::Terminated != component.GetState())
+					   ? static_cast< F32 >(action(component, distance))
+					   : distance;
+			}
+		);
+	}
+
+	#pragma endregion
 }
\ No newline at end of file
@@ -19,7 +19,10 @@ namespace mage::rendering {
 		m_strings(),
 		m_text_effect_color(RGBA(1.0f)),
 		m_text_effect(TextEffect::None),
-		m_font() {}
+		m_font(),
+		m_layout(),
+		m_layout_font(nullptr),
+		m_format_buffer() {}
 
 	SpriteText::SpriteText(const SpriteText& sprite) = default;
 
@@ -36,6 +39,9 @@ namespace mage::rendering {
 			return;
 		}
 
+		UpdateLayout();
+		const auto strings = gsl::make_span(m_strings);
+
 		SpriteTransform2D effect_transform(m_sprite_transform);
 
 		switch (m_text_effect) {
@@ -44,14 +50,16 @@ namespace mage::rendering {
 			// -1, -1
 			effect_transform.AddTranslation(-1.0f, -1.0f);
 			m_font->DrawText(sprite_batch,
-							 gsl::make_span(m_strings),
+							 m_layout,
+							 strings,
 				             effect_transform,
 							 m_sprite_effects,
 							 &m_text_effect_color);
 			// +1, -1
 			effect_transform.AddTranslationX(2.0f);
 			m_font->DrawText(sprite_batch,
-							 gsl::make_span(m_strings),
+							 m_layout,
+							 strings,
 				             effect_transform,
 							 m_sprite_effects,
 							 &m_text_effect_color);
@@ -63,14 +71,16 @@ namespace mage::rendering {
 			// +1, +1
 			effect_transform.AddTranslationY(2.0f);
 			m_font->DrawText(sprite_batch,
-							 gsl::make_span(m_strings),
+							 m_layout,
+							 strings,
 				             effect_transform,
 							 m_sprite_effects,
 							 &m_text_effect_color);
 			// -1, +1
 			effect_transform.AddTranslationX(-2.0f);
 			m_font->DrawText(sprite_batch,
-							 gsl::make_span(m_strings),
+							 m_layout,
+							 strings,
 				             effect_transform,
 							 m_sprite_effects,
 							 &m_text_effect_color);
@@ -80,11 +90,36 @@ namespace mage::rendering {
 
 		default: {
 			m_font->DrawText(sprite_batch,
-							 gsl::make_span(m_strings),
+							 m_layout,
+							 strings,
 				             m_sprite_transform,
 							 m_sprite_effects);
 		}
 
 		}
 	}
+
+	void SpriteText::SetString(std::size_t index, std::wstring_view str) {
+		if (m_strings.size() <= index) {
+			m_strings.resize(index + 1u, ColorString(L""));
+			InvalidateLayout();
+		}
+
+		auto& dst = m_strings[index].GetString();
+		if (dst == str) {
+			return;
+		}
+
+		dst.assign(str.data(), str.size());
+		InvalidateLayout();
+	}
+
+	void SpriteText::UpdateLayout() const {
+		if (m_font.get() == m_layout_font) {
+			return;
+		}
+
+		m_font->LayoutText(gsl::make_span(m_strings), m_layout);
+		m_layout_font = m_font.get();
+	}
 }
\ No newline at end of file
@@ -10,6 +10,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <string_view>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -170,6 +179,7 @@ namespace mage::rendering {
 		 */
 		void ClearText() noexcept {
 			m_strings.clear();
+			InvalidateLayout();
 		}
 
 		/**
@@ -194,6 +204,55 @@ namespace mage::rendering {
 			m_strings.push_back(std::move(text));
 		}
 
+		/**
+		 Sets the string of the color string at the given index of the text
+		 of this sprite text to the given string. The text is extended with
+		 (white) empty color strings if needed.
+
+		 The layout of this sprite text is only invalidated if the string
+		 changes, and no memory is allocated if the capacity of the color
+		 string suffices.
+
+		 @param[in]		index
+						The index of the color string.
+		 @param[in]		str
+						The string.
+		 */
+		void SetString(std::size_t index, std::wstring_view str);
+
+		/**
+		 Formats the string of the color string at the given index of the
+		 text of this sprite text (see @c SetString).
+
+		 @tparam		ArgsT
+						The format argument types.
+		 @param[in]		index
+						The index of the color string.
+		 @param[in]		format_str
+						The format string.
+		 @param[in]		args
+						A reference to the format arguments.
+		 */
+		template< typename... ArgsT >
+		void FormatString(std::size_t index,
+						  std::wstring_view format_str,
+						  const ArgsT&... args);
+
+		/**
+		 Sets the (linear) color of the color string at the given index of
+		 the text of this sprite text to the given color.
+
+		 @pre			@a index is smaller than the number of color strings
+						of this sprite text.
+		 @param[in]		index
+						The index of the color string.
+		 @param[in]		color
+						A reference to the (linear) color.
+		 */
+		void SetColor(std::size_t index, const RGBA& color) noexcept {
+			m_strings[index].GetColor() = color;
+		}
+
 		/**
 		 Appends the given text to the end of the text of this sprite text.
 
@@ -202,6 +261,7 @@ namespace mage::rendering {
 		 */
 		void AppendText(ColorString text) {
 			m_strings.push_back(std::move(text));
+			InvalidateLayout();
 		}
 
 		/**
@@ -309,10 +369,28 @@ namespace mage::rendering {
 		 */
 		void SetFont(SpriteFontPtr font) noexcept {
 			m_font = std::move(font);
+			InvalidateLayout();
 		}
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Invalidates the (cached) layout of the text of this sprite text.
+		 */
+		void InvalidateLayout() noexcept {
+			m_layout_font = nullptr;
+		}
+
+		/**
+		 Lays out the text of this sprite text (if the cached layout is
+		 invalid).
+		 */
+		void UpdateLayout() const;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Transform
 		//---------------------------------------------------------------------
@@ -362,6 +440,27 @@ namespace mage::rendering {
 		 A pointer to the sprite font of this sprite text.
 		 */
 		SpriteFontPtr m_font;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Text Layout
+		//---------------------------------------------------------------------
+
+		/**
+		 The (cached) layout of the text of this sprite text.
+		 */
+		mutable TextLayout m_layout;
+
+		/**
+		 A pointer to the sprite font of the layout of the text of this
+		 sprite text. The layout is invalid if this pointer is not equal to
+		 the sprite font of this sprite text.
+		 */
+		mutable const SpriteFont* m_layout_font;
+
+		/**
+		 The buffer of this sprite text for formatting strings.
+		 */
+		std::wstring m_format_buffer;
 	};
 
 	#pragma warning( pop )
@@ -1,5 +1,23 @@
 #pragma once
 
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "string\format.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <iterator>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -7,6 +25,9 @@ namespace mage::rendering {
 
 	template< typename ActionT >
 	void SpriteText::ForEachColorString(ActionT&& action) {
+		// The strings may be modified.
+		InvalidateLayout();
+
 		for (auto& str : m_strings) {
 			action(str);
 		}
@@ -18,4 +39,14 @@ namespace mage::rendering {
 			action(str);
 		}
 	}
+
+	template< typename... ArgsT >
+	void SpriteText::FormatString(std::size_t index,
+								  std::wstring_view format_str,
+								  const ArgsT&... args) {
+
+		m_format_buffer.clear();
+		AppendWrite(std::back_inserter(m_format_buffer), format_str, args...);
+		SetString(index, m_format_buffer);
+	}
 }
\ No newline at end of file
@@ -260,6 +260,13 @@ namespace mage::script {
 			ImGui::DragFloat("Gamma", &gamma, 0.01f, 0.01f, 10.0f, "%.2f");
 			settings.SetGamma(gamma);
 
+			//-----------------------------------------------------------------
+			// Occlusion Culling
+			//-----------------------------------------------------------------
+			auto occlusion_culling = settings.UsesOcclusionCulling();
+			ImGui::Checkbox("Occlusion Culling", &occlusion_culling);
+			settings.SetOcclusionCulling(occlusion_culling);
+
 			//-----------------------------------------------------------------
 			// Render Layers
 			//-----------------------------------------------------------------
@@ -280,6 +287,12 @@ namespace mage::script {
 					settings.ToggleRenderLayer(RenderLayer::AABB);
 				}
 
+				if (auto occlusion_buffer = settings.ContainsRenderLayer(RenderLayer::OcclusionBuffer);
+					ImGui::Checkbox("Occlusion Buffer", &occlusion_buffer)) {
+
+					settings.ToggleRenderLayer(RenderLayer::OcclusionBuffer);
+				}
+
 				ImGui::EndPopup();
 			}
 		}
@@ -723,6 +736,10 @@ namespace mage::script {
 			auto light_occlusion = model.OccludesLight();
 			ImGui::Checkbox("Occludes Light", &light_occlusion);
 			model.SetLightOcclusion(light_occlusion);
+
+			auto occluder = model.IsOccluder();
+			ImGui::Checkbox("Occluder", &occluder);
+			model.SetOccluder(occluder);
 		}
 
 		void DrawWidget(SpriteTransform2D& transform,
@@ -1253,6 +1270,60 @@ namespace mage::script {
 
 			ImGui::End();
 		}
+
+		void Pick(rendering::World& world, ProxyPtr< Node >& selected) {
+			const auto& io = ImGui::GetIO();
+			if (io.WantCaptureMouse || !ImGui::IsMouseClicked(0)) {
+				return;
+			}
+
+			const auto mouse = XMVectorSet(io.MousePos.x, io.MousePos.y,
+										   0.0f, 0.0f);
+
+			bool picked = false;
+			world.ForEach< rendering::Camera >([&world, &selected, &picked, mouse](
+				const rendering::Camera& camera) {
+
+				if (picked || State::Active != camera.GetState()) {
+					return;
+				}
+
+				// The mouse position in NDC space of the camera.
+				const auto& viewport = camera.GetViewport();
+				const auto top_left  = XMLoad(viewport.GetTopLeft());
+				const auto size      = XMLoad(viewport.GetSize());
+				const auto uv        = (mouse - top_left) / size;
+				if (XMVector2Less(uv, XMVectorZero())
+					|| XMVector2Greater(uv, XMVectorSplatOne())) {
+					return;
+				}
+				const auto x = 2.0f * XMVectorGetX(uv) - 1.0f;
+				const auto y = 1.0f - 2.0f * XMVectorGetY(uv);
+
+				// The ray through the mouse position in world space.
+				const auto& transform       = camera.GetOwner()->GetTransform();
+				const auto object_to_world  = transform.GetObjectToWorldMatrix();
+				const auto projection_to_world
+					= camera.GetProjectionToCameraMatrix() * object_to_world;
+				#ifdef DISABLE_INVERTED_Z_BUFFER
+				const auto [near_z, far_z] = F32x2(0.0f, 1.0f);
+				#else  // DISABLE_INVERTED_Z_BUFFER
+				const auto [near_z, far_z] = F32x2(1.0f, 0.0f);
+				#endif // DISABLE_INVERTED_Z_BUFFER
+				const auto p_near = XMVector3TransformCoord(
+					XMVectorSet(x, y, near_z, 1.0f), projection_to_world);
+				const auto p_far  = XMVector3TransformCoord(
+					XMVectorSet(x, y, far_z,  1.0f), projection_to_world);
+				const auto direction = XMVector3Normalize(p_far - p_near);
+
+				RayHit hit;
+				if (world.Intersect(p_near, direction,
+									std::numeric_limits< F32 >::infinity(), hit)) {
+					selected = world.GetModel(hit.m_data)->GetOwner();
+				}
+				picked = true;
+			});
+		}
 	}
 
 	//-------------------------------------------------------------------------
@@ -1280,6 +1351,7 @@ namespace mage::script {
 
 	void EditorScript::Update([[maybe_unused]] Engine& engine) {
 		const auto scene = engine.GetScene();
+		Pick(engine.GetRenderingManager().GetWorld(), m_selected);
 		DrawGraph(*scene, m_selected);
 
 		const auto config = engine.GetRenderingManager().GetDisplayConfiguration();
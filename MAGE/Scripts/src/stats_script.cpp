@@ -67,11 +67,14 @@ namespace mage::script {
 			m_prev_core_clock_time  = core_clock_time;
 		}
 
-		RGBA color = (120u <= m_fps) ? color::Green : color::Red;
-
-		m_text->SetText(L"FPS: ");
-		m_text->AppendText({ std::to_wstring(m_fps), std::move(color) });
-		m_text->AppendText(Format(L"\nSPF: {:.2f}ms\nCPU: {:.1f}%\nRAM: {}MB\nDCs: {}",
-								  m_spf, m_cpu, m_ram, rendering::Pipeline::s_nb_draws));
+		const RGBA color = (120u <= m_fps) ? color::Green : color::Red;
+
+		// The strings are updated in place: the text is only laid out again
+		// if a string changes.
+		m_text->SetString(0u, L"FPS: ");
+		m_text->FormatString(1u, L"{}", m_fps);
+		m_text->SetColor(1u, color);
+		m_text->FormatString(2u, L"\nSPF: {:.2f}ms\nCPU: {:.1f}%\nRAM: {}MB\nDCs: {}",
+							 m_spf, m_cpu, m_ram, rendering::Pipeline::s_nb_draws);
 	}
 }
\ No newline at end of file
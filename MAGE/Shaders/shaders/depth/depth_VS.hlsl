@@ -6,8 +6,8 @@
 //-----------------------------------------------------------------------------
 // Vertex Shader
 //-----------------------------------------------------------------------------
-float4 VS(VSInputPositionNormalTexture input) : SV_Position {
-    return Transform(input.p,
+float4 VS(VSInputPackedPositionNormalTexture input) : SV_Position {
+    return Transform(input.p.xyz,
 	                 g_object_to_world,
 					 g_world_to_camera2,
 					 g_camera2_to_projection2);
@@ -6,9 +6,9 @@
 //-----------------------------------------------------------------------------
 // Vertex Shader
 //-----------------------------------------------------------------------------
-PSInputTexture VS(VSInputPositionNormalTexture input) {
+PSInputTexture VS(VSInputPackedPositionNormalTexture input) {
 	PSInputTexture output;
-	output.p   = Transform(input.p,
+	output.p   = Transform(input.p.xyz,
 						   g_object_to_world,
 						   g_world_to_camera2,
 						   g_camera2_to_projection2);
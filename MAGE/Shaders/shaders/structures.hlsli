@@ -78,6 +78,17 @@ struct VSInputPositionNormalColorTexture {
 	float2 tex   : TEXCOORD0;
 };
 
+/**
+ A vertex shader input struct of packed vertices having a quantized position,
+ an octahedron encoded normal and a pair of half-precision texture
+ coordinates.
+ */
+struct VSInputPackedPositionNormalTexture {
+	float4 p     : POSITION0;
+	float2 n     : NORMAL0;
+	float2 tex   : TEXCOORD0;
+};
+
 //-----------------------------------------------------------------------------
 // GS Input Structures
 //-----------------------------------------------------------------------------
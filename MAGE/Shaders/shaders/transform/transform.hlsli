@@ -5,11 +5,30 @@
 // Engine Includes
 //-----------------------------------------------------------------------------
 #include "structures.hlsli"
+#include "unit_vector.hlsli"
 
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
 
+/**
+ Unpacks the given packed vertex input structure.
+
+ The position remains quantized, since the dequantization is part of the
+ object-to-world transformation matrix.
+
+ @param[in]		input
+				The packed vertex input structure.
+ @return		The unpacked vertex input structure.
+ */
+VSInputPositionNormalTexture Unpack(VSInputPackedPositionNormalTexture input) {
+	VSInputPositionNormalTexture output;
+	output.p   = input.p.xyz;
+	output.n   = DecodeUnitVector_Octahedron(SNormToUNorm(input.n));
+	output.tex = input.tex;
+	return output;
+}
+
 /**
  Transforms the given position from object to projection space.
 
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "memory\allocation.hpp"
+#include "memory/allocation.hpp"
 
 #pragma endregion
 
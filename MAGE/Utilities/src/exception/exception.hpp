@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "logging\logging.hpp"
+#include "logging/logging.hpp"
 
 #pragma endregion
 
@@ -144,11 +144,15 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	#pragma region
 
+	#ifdef _WIN32
+
 	static_assert(!std::is_same< bool, BOOL >::value,
 				  "MAGE/Windows primitive type mismatch");
 	static_assert(!std::is_same< BOOL, HRESULT >::value,
 				  "MAGE/Windows primitive type mismatch");
 
+	#endif // _WIN32
+
 	/**
 	 Throws if the given result correspond to a failure.
 
@@ -177,6 +181,8 @@ namespace mage {
 	void ThrowIfFailed(bool result,
 					   std::string_view format_str, const ArgsT&... args);
 
+	#ifdef _WIN32
+
 	/**
 	 Throws if the given result correspond to a failure.
 
@@ -233,6 +239,8 @@ namespace mage {
 	void ThrowIfFailed(HRESULT result,
 					   std::string_view format_str, const ArgsT&... args);
 
+	#endif // _WIN32
+
 	#pragma endregion
 }
 
@@ -241,6 +249,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "exception\exception.tpp"
+#include "exception/exception.tpp"
 
 #pragma endregion
\ No newline at end of file
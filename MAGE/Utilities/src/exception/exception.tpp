@@ -44,6 +44,8 @@ namespace mage {
 		}
 	}
 
+	#ifdef _WIN32
+
 	inline void ThrowIfFailed(BOOL result) {
 		if (FALSE == result) {
 			const Exception exception;
@@ -84,5 +86,7 @@ namespace mage {
 		}
 	}
 
+	#endif // _WIN32
+
 	#pragma endregion
 }
\ No newline at end of file
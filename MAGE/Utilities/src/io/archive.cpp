@@ -0,0 +1,649 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io/archive.hpp"
+#include "io/checksum.hpp"
+#include "io/file_writer.hpp"
+#include "exception/exception.hpp"
+#include "logging/logging.hpp"
+#include "parallel/parallel.hpp"
+#include "string/string_utils.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "zlib/zlib.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 Aligns the given offset to the alignment of the data of archive
+		 entries.
+
+		 @param[in]		offset
+						The offset (in bytes).
+		 @return		The aligned offset (in bytes).
+		 */
+		[[nodiscard]]
+		constexpr U64 AlignArchiveOffset(U64 offset) noexcept {
+			return (offset + g_archive_alignment - 1u)
+				& ~(g_archive_alignment - 1u);
+		}
+
+		/**
+		 Returns the (absolute, normalized) path of the given directory.
+
+		 @param[in]		directory
+						A reference to the path of the directory.
+		 @return		The (absolute, normalized) path of the given
+						directory.
+		 */
+		[[nodiscard]]
+		std::filesystem::path GetRootPath(const std::filesystem::path& directory) {
+			return (directory.empty() ? std::filesystem::current_path()
+				                      : std::filesystem::absolute(directory))
+				.lexically_normal();
+		}
+
+		/**
+		 Returns the path relative to the given root of the given path.
+
+		 @param[in]		path
+						A reference to the path.
+		 @param[in]		root
+						A reference to the (absolute, normalized) path of the
+						root directory.
+		 @return		The path relative to the given root of the given
+						path.
+		 @return		An empty path if the given path is not inside the
+						given root directory.
+		 */
+		[[nodiscard]]
+		std::filesystem::path GetRelativePath(const std::filesystem::path& path,
+											  const std::filesystem::path& root) {
+			std::error_code error_code;
+			const auto absolute = std::filesystem::absolute(path, error_code);
+			if (error_code) {
+				return {};
+			}
+
+			auto relative = absolute.lexically_normal().lexically_relative(root);
+			if (relative.empty() || L".." == *relative.begin()) {
+				return {};
+			}
+
+			return relative;
+		}
+
+		/**
+		 A struct of files to write to an archive.
+		 */
+		struct ArchiveInput {
+
+		public:
+
+			/**
+			 The name of this archive input.
+			 */
+			std::string m_name;
+
+			/**
+			 The (stored) data of this archive input.
+			 */
+			std::vector< U8 > m_data;
+
+			/**
+			 The size (in bytes) of the uncompressed data of this archive
+			 input.
+			 */
+			U64 m_uncompressed_size = 0u;
+
+			/**
+			 The compression method of this archive input.
+			 */
+			ArchiveCompression m_compression = ArchiveCompression::None;
+		};
+
+		/**
+		 Loads (and compresses) the given file.
+
+		 @param[in]		path
+						A reference to the path of the file.
+		 @param[in]		compress
+						A flag indicating whether the file may be
+						compressed.
+		 @param[out]	input
+						A reference to the archive input.
+		 @throws		Exception
+						Failed to load or compress the given file.
+		 */
+		void LoadArchiveInput(const std::filesystem::path& path,
+							  bool compress,
+							  ArchiveInput& input) {
+
+			// Archives are never packed from the mounted archives.
+			const MappedFile file(path, false);
+			const auto data = file.GetData();
+
+			input.m_uncompressed_size = file.size();
+
+			// zlib sizes are 32-bit on Windows.
+			if (compress && !data.empty()
+				&& file.size() <= std::numeric_limits< uLong >::max()) {
+
+				const auto size = static_cast< uLong >(file.size());
+				auto compressed_size = compressBound(size);
+				input.m_data.resize(compressed_size);
+
+				const int result = compress2(input.m_data.data(),
+											 &compressed_size,
+											 data.data(), size,
+											 Z_BEST_COMPRESSION);
+				ThrowIfFailed((Z_OK == result),
+							  "{}: could not compress file.", path);
+
+				// Keep the compressed data only if it pays off: stored data
+				// is served without copying.
+				if (compressed_size <= size - size / 8u) {
+					input.m_data.resize(compressed_size);
+					input.m_data.shrink_to_fit();
+					input.m_compression = ArchiveCompression::Zlib;
+					return;
+				}
+			}
+
+			input.m_data.assign(data.begin(), data.end());
+			input.m_compression = ArchiveCompression::None;
+		}
+
+		/**
+		 Writes zero padding with the given file writer up to the given
+		 offset.
+
+		 @param[in]		writer
+						A reference to the file writer.
+		 @param[in]		offset
+						The current offset (in bytes).
+		 @param[in]		aligned_offset
+						The aligned offset (in bytes).
+		 @throws		Exception
+						Failed to write the padding.
+		 */
+		void WriteArchivePadding(FileWriter& writer,
+								 U64 offset,
+								 U64 aligned_offset) {
+
+			static constexpr U8 s_zeros[g_archive_alignment] = {};
+			writer.Write(s_zeros, static_cast< std::size_t >(aligned_offset - offset));
+		}
+
+		/**
+		 The mutex guarding the mounted archives.
+		 */
+		std::shared_mutex g_archives_mutex;
+
+		/**
+		 The mounted archives (in mount order).
+		 */
+		std::vector< SharedPtr< const Archive > > g_archives;
+	}
+
+	[[nodiscard]]
+	std::string GetArchiveName(const std::filesystem::path& path) {
+		auto name = path.lexically_normal().generic_u8string();
+		// Names are case insensitive (like the Windows file system). Only
+		// ASCII characters are converted (UTF-8 bytes are kept as is).
+		std::transform(name.begin(), name.end(), name.begin(),
+			[](char c) noexcept {
+				return static_cast< char >(
+					std::tolower(static_cast< unsigned char >(c)));
+			});
+		return name;
+	}
+
+	[[nodiscard]]
+	U64 GetArchiveHash(std::string_view name) noexcept {
+		U64 hash = 0xCBF29CE484222325ull;
+		for (const auto c : name) {
+			hash ^= static_cast< U8 >(c);
+			hash *= 0x100000001B3ull;
+		}
+		return hash;
+	}
+
+	//-------------------------------------------------------------------------
+	// Archive
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	Archive::Archive(std::filesystem::path path,
+					 const std::filesystem::path& root)
+		: m_path(std::move(path)),
+		m_root(GetRootPath(root)),
+		m_file(m_path, false),
+		m_entries(),
+		m_names() {
+
+		const auto data = m_file.GetData();
+		const auto size = static_cast< U64 >(data.size());
+
+		ThrowIfFailed((sizeof(ArchiveHeader) <= size),
+					  "{}: invalid archive header.", m_path);
+		const auto& header
+			= *reinterpret_cast< const ArchiveHeader* >(data.data());
+		ThrowIfFailed((g_archive_magic == header.m_magic),
+					  "{}: invalid archive header.", m_path);
+		ThrowIfFailed((g_archive_version == header.m_version),
+					  "{}: unsupported archive version: {}.",
+					  m_path, header.m_version);
+		ThrowIfFailed((size == header.m_archive_size),
+					  "{}: truncated archive.", m_path);
+
+		const auto toc_size = sizeof(ArchiveEntry)
+			                * static_cast< U64 >(header.m_nb_entries)
+			                + header.m_names_size;
+		ThrowIfFailed((toc_size <= size - sizeof(ArchiveHeader)),
+					  "{}: truncated table of contents.", m_path);
+
+		const auto toc = data.subspan(sizeof(ArchiveHeader),
+									  static_cast< std::ptrdiff_t >(toc_size));
+		ThrowIfFailed((header.m_toc_checksum == ComputeChecksum(toc)),
+					  "{}: corrupted table of contents.", m_path);
+
+		m_entries = gsl::make_span(
+			reinterpret_cast< const ArchiveEntry* >(toc.data()),
+			static_cast< std::ptrdiff_t >(header.m_nb_entries));
+		m_names = std::string_view(
+			reinterpret_cast< const char* >(toc.data())
+				+ sizeof(ArchiveEntry) * header.m_nb_entries,
+			header.m_names_size);
+
+		for (const auto& entry : m_entries) {
+			ThrowIfFailed((entry.m_offset <= size)
+						  && (entry.m_size <= size - entry.m_offset)
+						  && (static_cast< U64 >(entry.m_name_offset)
+							  + entry.m_name_size <= m_names.size()),
+						  "{}: corrupted table of contents.", m_path);
+		}
+	}
+
+	Archive::Archive(Archive&& archive) noexcept = default;
+
+	Archive::~Archive() = default;
+
+	Archive& Archive::operator=(Archive&& archive) noexcept = default;
+
+	[[nodiscard]]
+	const ArchiveEntry* Archive::Find(const std::filesystem::path& path) const {
+		const auto relative = GetRelativePath(path, m_root);
+		return relative.empty() ? nullptr : FindByName(GetArchiveName(relative));
+	}
+
+	[[nodiscard]]
+	const ArchiveEntry* Archive::FindByName(std::string_view name) const noexcept {
+		const auto hash = GetArchiveHash(name);
+
+		auto it = std::lower_bound(m_entries.begin(), m_entries.end(), hash,
+			[](const ArchiveEntry& entry, U64 value) noexcept {
+				return entry.m_hash < value;
+			});
+
+		// Resolve hash collisions by comparing the names.
+		for (; it != m_entries.end() && hash == it->m_hash; ++it) {
+			if (GetName(*it) == name) {
+				return &*it;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void Archive::Extract(const ArchiveEntry& entry,
+						  gsl::span< U8 > output) const {
+
+		ThrowIfFailed((entry.m_uncompressed_size
+					   == static_cast< U64 >(output.size())),
+					  "{}: {}: invalid output size.", m_path, GetName(entry));
+
+		const auto input = GetData(entry);
+
+		switch (entry.m_compression) {
+
+		case ArchiveCompression::None: {
+			ThrowIfFailed((input.size() == output.size()),
+						  "{}: {}: corrupted entry.", m_path, GetName(entry));
+			if (!input.empty()) {
+				std::memcpy(output.data(), input.data(), input.size());
+			}
+			break;
+		}
+
+		case ArchiveCompression::Zlib: {
+			ThrowIfFailed((entry.m_size <= std::numeric_limits< uLong >::max())
+						  && (entry.m_uncompressed_size
+							  <= std::numeric_limits< uLong >::max()),
+						  "{}: {}: entry too big.", m_path, GetName(entry));
+
+			auto size = static_cast< uLongf >(output.size());
+			const int result = uncompress(output.data(), &size,
+										  input.data(),
+										  static_cast< uLong >(input.size()));
+			ThrowIfFailed((Z_OK == result)
+						  && (static_cast< std::size_t >(size)
+							  == static_cast< std::size_t >(output.size())),
+						  "{}: {}: could not decompress entry.",
+						  m_path, GetName(entry));
+			break;
+		}
+
+		default: {
+			throw Exception("{}: {}: unsupported compression method: {}.",
+							m_path, GetName(entry),
+							static_cast< U32 >(entry.m_compression));
+		}
+
+		}
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Archive Writing
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	void WriteArchive(const std::filesystem::path& path,
+					  const std::filesystem::path& root,
+					  gsl::span< const std::filesystem::path > files,
+					  bool compress) {
+
+		const auto root_path = GetRootPath(root);
+		const auto nb_files  = static_cast< std::size_t >(files.size());
+
+		std::vector< ArchiveInput > inputs(nb_files);
+		for (std::size_t i = 0u; i < nb_files; ++i) {
+			const auto& file     = files[static_cast< std::ptrdiff_t >(i)];
+			const auto relative  = GetRelativePath(file, root_path);
+			ThrowIfFailed(!relative.empty(),
+						  "{}: file outside the archive root: {}.", file, root);
+			inputs[i].m_name = GetArchiveName(relative);
+		}
+
+		// Load and compress the files on all cores.
+		{
+			std::atomic< std::size_t > next_index(0u);
+			std::exception_ptr exception;
+			std::mutex exception_mutex;
+
+			const auto load = [&]() {
+				for (auto index = next_index++; index < nb_files;
+					 index = next_index++) {
+					try {
+						LoadArchiveInput(files[static_cast< std::ptrdiff_t >(index)],
+										 compress, inputs[index]);
+					}
+					catch (...) {
+						const std::lock_guard< std::mutex > lock(exception_mutex);
+						if (!exception) {
+							exception = std::current_exception();
+						}
+					}
+				}
+			};
+
+			const auto nb_threads
+				= std::min(static_cast< std::size_t >(NumberOfSystemCores()),
+						   nb_files);
+
+			std::vector< std::thread > workers;
+			workers.reserve(nb_threads);
+			for (std::size_t i = 1u; i < nb_threads; ++i) {
+				workers.emplace_back(load);
+			}
+			// The calling thread participates as well.
+			load();
+
+			for (auto& worker : workers) {
+				worker.join();
+			}
+
+			if (exception) {
+				std::rethrow_exception(exception);
+			}
+		}
+
+		// Sort the table of contents by hash (and name).
+		std::vector< U64 > hashes(nb_files);
+		std::vector< std::size_t > order(nb_files);
+		for (std::size_t i = 0u; i < nb_files; ++i) {
+			hashes[i] = GetArchiveHash(inputs[i].m_name);
+			order[i]  = i;
+		}
+		std::sort(order.begin(), order.end(),
+			[&](std::size_t lhs, std::size_t rhs) {
+				return (hashes[lhs] != hashes[rhs])
+					? (hashes[lhs] < hashes[rhs])
+					: (inputs[lhs].m_name < inputs[rhs].m_name);
+			});
+
+		for (std::size_t i = 1u; i < nb_files; ++i) {
+			ThrowIfFailed((inputs[order[i - 1u]].m_name != inputs[order[i]].m_name),
+						  "{}: duplicate file: {}.", path, inputs[order[i]].m_name);
+		}
+
+		// Build the table of contents.
+		std::vector< ArchiveEntry > entries(nb_files);
+		std::string names;
+		for (std::size_t i = 0u; i < nb_files; ++i) {
+			const auto& input = inputs[order[i]];
+			auto& entry       = entries[i];
+
+			entry.m_hash              = hashes[order[i]];
+			entry.m_size              = input.m_data.size();
+			entry.m_uncompressed_size = input.m_uncompressed_size;
+			entry.m_name_offset       = static_cast< U32 >(names.size());
+			entry.m_name_size         = static_cast< U32 >(input.m_name.size());
+			entry.m_compression       = input.m_compression;
+			entry.m_padding           = 0u;
+
+			names += input.m_name;
+		}
+		ThrowIfFailed((names.size() <= std::numeric_limits< U32 >::max()),
+					  "{}: too many files.", path);
+
+		const U64 toc_size = sizeof(ArchiveEntry) * entries.size() + names.size();
+		U64 offset = AlignArchiveOffset(sizeof(ArchiveHeader) + toc_size);
+		for (auto& entry : entries) {
+			entry.m_offset = offset;
+			offset = AlignArchiveOffset(offset + entry.m_size);
+		}
+
+		ArchiveHeader header = {};
+		header.m_magic        = g_archive_magic;
+		header.m_version      = g_archive_version;
+		header.m_nb_entries   = static_cast< U32 >(entries.size());
+		header.m_names_size   = static_cast< U32 >(names.size());
+		header.m_archive_size = entries.empty()
+			                  ? sizeof(ArchiveHeader) + toc_size
+			                  : entries.back().m_offset + entries.back().m_size;
+
+		// The checksum covers the table of contents and names as stored.
+		{
+			std::vector< U8 > toc(static_cast< std::size_t >(toc_size));
+			const auto entries_size = sizeof(ArchiveEntry) * entries.size();
+			if (!entries.empty()) {
+				std::memcpy(toc.data(), entries.data(), entries_size);
+			}
+			if (!names.empty()) {
+				std::memcpy(toc.data() + entries_size, names.data(), names.size());
+			}
+			header.m_toc_checksum = ComputeChecksum(gsl::make_span(toc));
+		}
+
+		// Write the archive.
+		FileWriter writer(path);
+
+		writer.Write(&header, sizeof(header));
+		writer.Write(entries.data(), sizeof(ArchiveEntry) * entries.size());
+		writer.Write(names.data(), names.size());
+
+		offset = sizeof(ArchiveHeader) + toc_size;
+		for (std::size_t i = 0u; i < nb_files; ++i) {
+			const auto& entry = entries[i];
+			const auto& data  = inputs[order[i]].m_data;
+
+			WriteArchivePadding(writer, offset, entry.m_offset);
+			writer.Write(data.data(), data.size());
+			offset = entry.m_offset + entry.m_size;
+		}
+
+		writer.Close();
+	}
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Archive Mounting
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	void MountArchive(std::filesystem::path path,
+					  const std::filesystem::path& root) {
+
+		auto archive = MakeShared< const Archive >(std::move(path), root);
+
+		Info("{}: mounted {} files.",
+			 archive->GetPath(), archive->GetEntries().size());
+
+		const std::lock_guard< std::shared_mutex > lock(g_archives_mutex);
+		g_archives.push_back(std::move(archive));
+	}
+
+	void MountArchives(const std::filesystem::path& directory) {
+		std::vector< std::filesystem::path > paths;
+
+		std::error_code error_code;
+		for (const auto& entry
+			 : std::filesystem::directory_iterator(directory, error_code)) {
+
+			std::wstring extension = entry.path().extension().wstring();
+			TransformToLowerCase(extension);
+			if (L".pak" == extension) {
+				paths.push_back(entry.path());
+			}
+		}
+
+		std::sort(paths.begin(), paths.end());
+
+		for (auto& path : paths) {
+			try {
+				MountArchive(std::move(path), directory);
+			}
+			catch (const std::exception& e) {
+				Error("Failed to mount archive: {}", e.what());
+			}
+		}
+	}
+
+	void UnmountArchives() noexcept {
+		const std::lock_guard< std::shared_mutex > lock(g_archives_mutex);
+		g_archives.clear();
+	}
+
+	[[nodiscard]]
+	std::pair< SharedPtr< const Archive >, const ArchiveEntry* >
+		FindArchivedFile(const std::filesystem::path& path) {
+
+		const std::shared_lock< std::shared_mutex > lock(g_archives_mutex);
+
+		for (auto it = g_archives.crbegin(); it != g_archives.crend(); ++it) {
+			if (const auto entry = (*it)->Find(path)) {
+				return { *it, entry };
+			}
+		}
+
+		return {};
+	}
+
+	[[nodiscard]]
+	std::optional< MappedFile > OpenArchivedFile(const std::filesystem::path& path) {
+		auto [archive, entry] = FindArchivedFile(path);
+		if (nullptr == entry) {
+			return {};
+		}
+
+		// Stored entries are served directly from the mapped archive.
+		if (ArchiveCompression::None == entry->m_compression) {
+			const auto data = archive->GetData(*entry);
+			return MappedFile(data, std::move(archive));
+		}
+
+		ThrowIfFailed((entry->m_uncompressed_size
+					   <= std::numeric_limits< std::size_t >::max()),
+					  "{}: file too big for address space.", path);
+
+		auto buffer = MakeShared< std::vector< U8 > >(
+			static_cast< std::size_t >(entry->m_uncompressed_size));
+		archive->Extract(*entry, gsl::make_span(*buffer));
+
+		const gsl::span< const U8 > data = gsl::make_span(*buffer);
+		return MappedFile(data, std::move(buffer));
+	}
+
+	[[nodiscard]]
+	bool FileExists(const std::filesystem::path& path) noexcept {
+		try {
+			if (nullptr != FindArchivedFile(path).second) {
+				return true;
+			}
+		}
+		catch (...) {}
+
+		std::error_code error_code;
+		return std::filesystem::is_regular_file(path, error_code);
+	}
+
+	[[nodiscard]]
+	std::optional< U64 > GetFileSize(const std::filesystem::path& path) noexcept {
+		try {
+			if (const auto entry = FindArchivedFile(path).second) {
+				return entry->m_uncompressed_size;
+			}
+		}
+		catch (...) {}
+
+		std::error_code error_code;
+		const auto size = std::filesystem::file_size(path, error_code);
+		if (error_code) {
+			return {};
+		}
+
+		return static_cast< U64 >(size);
+	}
+
+	#pragma endregion
+}
@@ -0,0 +1,484 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io/mapped_file.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The magic number of archives ("MPAK").
+	 */
+	constexpr U32 g_archive_magic = 0x4B41504Du;
+
+	/**
+	 The version of the archive format.
+	 */
+	constexpr U32 g_archive_version = 1u;
+
+	/**
+	 The alignment (in bytes) of the data of the archive entries.
+	 */
+	constexpr U64 g_archive_alignment = 4096u;
+
+	/**
+	 An enumeration of compression methods of archive entries.
+
+	 This contains:
+	 @c None and
+	 @c Zlib.
+	 */
+	enum class ArchiveCompression : U32 {
+		None = 0u,
+		Zlib = 1u
+	};
+
+	/**
+	 A struct of archive headers.
+
+	 The header is followed by the table of contents (i.e. the entries sorted
+	 by hash), the names of the entries and the (aligned) data of the
+	 entries. All values are stored in little endian.
+	 */
+	struct ArchiveHeader {
+
+	public:
+
+		/**
+		 The magic number of this archive header.
+		 */
+		U32 m_magic;
+
+		/**
+		 The version of this archive header.
+		 */
+		U32 m_version;
+
+		/**
+		 The number of entries of this archive header.
+		 */
+		U32 m_nb_entries;
+
+		/**
+		 The size (in bytes) of the names of the entries of this archive
+		 header.
+		 */
+		U32 m_names_size;
+
+		/**
+		 The checksum of the table of contents and names of the entries of
+		 this archive header.
+		 */
+		U64 m_toc_checksum;
+
+		/**
+		 The size (in bytes) of this archive.
+		 */
+		U64 m_archive_size;
+	};
+
+	static_assert(32u == sizeof(ArchiveHeader));
+
+	/**
+	 A struct of archive entries.
+	 */
+	struct ArchiveEntry {
+
+	public:
+
+		/**
+		 The hash of the name of this archive entry.
+		 */
+		U64 m_hash;
+
+		/**
+		 The offset (in bytes) of the data of this archive entry relative to
+		 the start of the archive.
+		 */
+		U64 m_offset;
+
+		/**
+		 The size (in bytes) of the (stored) data of this archive entry.
+		 */
+		U64 m_size;
+
+		/**
+		 The size (in bytes) of the uncompressed data of this archive entry.
+		 */
+		U64 m_uncompressed_size;
+
+		/**
+		 The offset (in bytes) of the name of this archive entry relative to
+		 the start of the names.
+		 */
+		U32 m_name_offset;
+
+		/**
+		 The size (in bytes) of the name of this archive entry.
+		 */
+		U32 m_name_size;
+
+		/**
+		 The compression method of this archive entry.
+		 */
+		ArchiveCompression m_compression;
+
+		/**
+		 The padding of this archive entry.
+		 */
+		U32 m_padding;
+	};
+
+	static_assert(48u == sizeof(ArchiveEntry));
+
+	/**
+	 Returns the name of the given path inside an archive.
+
+	 @param[in]		path
+					A reference to the path relative to the root of the
+					archive.
+	 @return		The name of the given path inside an archive (i.e. the
+					normalized, lower case, generic form of the given path).
+	 */
+	[[nodiscard]]
+	std::string GetArchiveName(const std::filesystem::path& path);
+
+	/**
+	 Returns the hash of the given name of an archive entry.
+
+	 @param[in]		name
+					The name.
+	 @return		The (64-bit FNV-1a) hash of the given name.
+	 */
+	[[nodiscard]]
+	U64 GetArchiveHash(std::string_view name) noexcept;
+
+	/**
+	 A class of (read-only, memory-mapped) archives.
+	 */
+	class Archive {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an archive for the archive file associated with the given
+		 path.
+
+		 @param[in]		path
+						The path of the archive file.
+		 @param[in]		root
+						The path of the directory corresponding to the root
+						of the archive.
+		 @throws		Exception
+						Failed to map the archive file or the archive file is
+						not a valid archive.
+		 */
+		explicit Archive(std::filesystem::path path,
+						 const std::filesystem::path& root = {});
+
+		/**
+		 Constructs an archive from the given archive.
+
+		 @param[in]		archive
+						A reference to the archive to copy.
+		 */
+		Archive(const Archive& archive) = delete;
+
+		/**
+		 Constructs an archive by moving the given archive.
+
+		 @param[in]		archive
+						A reference to the archive to move.
+		 */
+		Archive(Archive&& archive) noexcept;
+
+		/**
+		 Destructs this archive.
+		 */
+		~Archive();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given archive to this archive.
+
+		 @param[in]		archive
+						A reference to the archive to copy.
+		 @return		A reference to the copy of the given archive (i.e.
+						this archive).
+		 */
+		Archive& operator=(const Archive& archive) = delete;
+
+		/**
+		 Moves the given archive to this archive.
+
+		 @param[in]		archive
+						A reference to the archive to move.
+		 @return		A reference to the moved archive (i.e. this archive).
+		 */
+		Archive& operator=(Archive&& archive) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the path of the archive file of this archive.
+
+		 @return		A reference to the path of the archive file of this
+						archive.
+		 */
+		[[nodiscard]]
+		const std::filesystem::path& GetPath() const noexcept {
+			return m_path;
+		}
+
+		/**
+		 Returns the entries of this archive.
+
+		 @return		The entries of this archive (sorted by hash).
+		 */
+		[[nodiscard]]
+		gsl::span< const ArchiveEntry > GetEntries() const noexcept {
+			return m_entries;
+		}
+
+		/**
+		 Finds the entry of this archive for the file associated with the
+		 given path.
+
+		 @param[in]		path
+						A reference to the path.
+		 @return		A pointer to the entry of this archive for the file
+						associated with the given path.
+		 @return		@c nullptr if this archive does not contain the file
+						associated with the given path.
+		 */
+		[[nodiscard]]
+		const ArchiveEntry* Find(const std::filesystem::path& path) const;
+
+		/**
+		 Finds the entry of this archive with the given name.
+
+		 @param[in]		name
+						The name (see @c GetArchiveName).
+		 @return		A pointer to the entry of this archive with the given
+						name.
+		 @return		@c nullptr if this archive does not contain an entry
+						with the given name.
+		 */
+		[[nodiscard]]
+		const ArchiveEntry* FindByName(std::string_view name) const noexcept;
+
+		/**
+		 Returns the name of the given entry of this archive.
+
+		 @param[in]		entry
+						A reference to the entry.
+		 @return		The name of the given entry of this archive.
+		 */
+		[[nodiscard]]
+		std::string_view GetName(const ArchiveEntry& entry) const noexcept {
+			return m_names.substr(entry.m_name_offset, entry.m_name_size);
+		}
+
+		/**
+		 Returns the (stored) data of the given entry of this archive.
+
+		 @param[in]		entry
+						A reference to the entry.
+		 @return		The (possibly compressed) data of the given entry of
+						this archive.
+		 */
+		[[nodiscard]]
+		gsl::span< const U8 > GetData(const ArchiveEntry& entry) const noexcept {
+			return m_file.GetData().subspan(
+				static_cast< std::ptrdiff_t >(entry.m_offset),
+				static_cast< std::ptrdiff_t >(entry.m_size));
+		}
+
+		/**
+		 Extracts the (uncompressed) data of the given entry of this
+		 archive.
+
+		 @param[in]		entry
+						A reference to the entry.
+		 @param[out]	output
+						The output buffer (of the uncompressed size of the
+						given entry).
+		 @throws		Exception
+						Failed to extract the data of the given entry.
+		 */
+		void Extract(const ArchiveEntry& entry, gsl::span< U8 > output) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The path of the archive file of this archive.
+		 */
+		std::filesystem::path m_path;
+
+		/**
+		 The (absolute, normalized) path of the directory corresponding to
+		 the root of this archive.
+		 */
+		std::filesystem::path m_root;
+
+		/**
+		 The mapped archive file of this archive.
+		 */
+		MappedFile m_file;
+
+		/**
+		 The entries of this archive.
+		 */
+		gsl::span< const ArchiveEntry > m_entries;
+
+		/**
+		 The names of the entries of this archive.
+		 */
+		std::string_view m_names;
+	};
+
+	/**
+	 Writes an archive containing the given files.
+
+	 Each file is compressed with zlib unless compression does not reduce its
+	 size by at least one eighth, in which case the file is stored (and
+	 served without copying from the mapped archive).
+
+	 @param[in]		path
+					A reference to the path of the archive file.
+	 @param[in]		root
+					A reference to the path of the directory corresponding
+					to the root of the archive.
+	 @param[in]		files
+					The paths of the files (inside the root directory).
+	 @param[in]		compress
+					A flag indicating whether the files may be compressed.
+	 @throws		Exception
+					Failed to write the archive.
+	 */
+	void WriteArchive(const std::filesystem::path& path,
+					  const std::filesystem::path& root,
+					  gsl::span< const std::filesystem::path > files,
+					  bool compress = true);
+
+	/**
+	 Mounts the archive associated with the given path.
+
+	 Files of archives mounted later take precedence over files of archives
+	 mounted earlier, and files of mounted archives take precedence over
+	 loose files.
+
+	 @param[in]		path
+					The path of the archive file.
+	 @param[in]		root
+					A reference to the path of the directory corresponding
+					to the root of the archive.
+	 @throws		Exception
+					Failed to mount the archive.
+	 */
+	void MountArchive(std::filesystem::path path,
+					  const std::filesystem::path& root = {});
+
+	/**
+	 Mounts all archives (i.e. @c .pak files) of the given directory in
+	 lexicographical order. The given directory corresponds to the root of
+	 the archives.
+
+	 @param[in]		directory
+					A reference to the path of the directory.
+	 */
+	void MountArchives(const std::filesystem::path& directory);
+
+	/**
+	 Unmounts all archives. Files opened from these archives remain valid.
+	 */
+	void UnmountArchives() noexcept;
+
+	/**
+	 Finds the file associated with the given path in the mounted archives.
+
+	 @param[in]		path
+					A reference to the path.
+	 @return		A pair containing a pointer to the archive and a pointer
+					to the entry of the file associated with the given path.
+	 @return		A pair of @c nullptr if no mounted archive contains the
+					file associated with the given path.
+	 */
+	[[nodiscard]]
+	std::pair< SharedPtr< const Archive >, const ArchiveEntry* >
+		FindArchivedFile(const std::filesystem::path& path);
+
+	/**
+	 Opens the file associated with the given path from the mounted
+	 archives.
+
+	 @param[in]		path
+					A reference to the path.
+	 @return		The mapped file viewing the (uncompressed) data of the
+					file associated with the given path.
+	 @return		@c std::nullopt if no mounted archive contains the file
+					associated with the given path.
+	 @throws		Exception
+					Failed to extract the file.
+	 */
+	[[nodiscard]]
+	std::optional< MappedFile > OpenArchivedFile(const std::filesystem::path& path);
+
+	/**
+	 Checks whether the file associated with the given path exists in a
+	 mounted archive or on disk.
+
+	 @param[in]		path
+					A reference to the path.
+	 @return		@c true if the file associated with the given path
+					exists. @c false otherwise.
+	 */
+	[[nodiscard]]
+	bool FileExists(const std::filesystem::path& path) noexcept;
+
+	/**
+	 Returns the size of the file associated with the given path in a
+	 mounted archive or on disk.
+
+	 @param[in]		path
+					A reference to the path.
+	 @return		The (uncompressed) size (in bytes) of the file associated
+					with the given path.
+	 @return		@c std::nullopt if the file associated with the given
+					path does not exist.
+	 */
+	[[nodiscard]]
+	std::optional< U64 > GetFileSize(const std::filesystem::path& path) noexcept;
+}
@@ -3,7 +3,25 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\binary_reader.hpp"
+#include "io/binary_reader.hpp"
+#include "io/archive.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+
+#ifndef _WIN32
+	#include <cerrno>
+	#include <fcntl.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif // _WIN32
 
 #pragma endregion
 
@@ -12,16 +30,82 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	namespace {
+
+		/**
+		 The maximum number of bytes read by a single read operation.
+		 */
+		constexpr std::size_t g_max_read_size = 1u << 30u;
+
+		/**
+		 The maximum size (in bytes) of loose files which are mapped by
+		 default. Larger files are streamed to preserve the address space.
+		 */
+		constexpr U64 g_max_mapped_file_size
+			= (8u == sizeof(void*)) ? std::numeric_limits< U64 >::max()
+			                        : (U64(256u) << 20u);
+
+		/**
+		 Checks whether the file associated with the given path should be
+		 streamed.
+
+		 @param[in]		path
+						A reference to the path.
+		 @param[in]		source
+						The requested source of the file.
+		 @return		@c true if the file associated with the given path
+						should be streamed. @c false if it should be mapped.
+		 */
+		[[nodiscard]]
+		bool IsStreamed(const std::filesystem::path& path,
+						BinaryFileSource source) {
+
+			// Files of the mounted archives are always mapped.
+			if (BinaryFileSource::Mapped == source
+				|| nullptr != FindArchivedFile(path).second) {
+				return false;
+			}
+
+			if (BinaryFileSource::Streamed == source) {
+				return true;
+			}
+
+			std::error_code error;
+			const auto size = std::filesystem::file_size(path, error);
+			return !error && g_max_mapped_file_size < size;
+		}
+	}
+
 	void ReadBinaryFile(const std::filesystem::path& path,
 						UniquePtr< U8[] >& data,
 						std::size_t& size) {
 
+		// Files of the mounted archives are extracted without opening the
+		// file itself.
+		if (const auto [archive, entry] = FindArchivedFile(path);
+			nullptr != entry) {
+
+			ThrowIfFailed((entry->m_uncompressed_size
+						   <= std::numeric_limits< std::size_t >::max()),
+						  "{}: file too big for allocation.", path);
+
+			size = static_cast< std::size_t >(entry->m_uncompressed_size);
+			data = MakeUnique< U8[] >(size);
+			archive->Extract(*entry, gsl::make_span(data.get(),
+											   static_cast< std::ptrdiff_t >(size)));
+			return;
+		}
+
+		#ifdef _WIN32
+
 		const auto file_handle
 			= CreateUniqueHandle(CreateFile2(path.c_str(),
 											 GENERIC_READ,
 											 FILE_SHARE_READ,
 											 OPEN_EXISTING,
 											 nullptr));
+		ThrowIfFailed((nullptr != file_handle),
+					  "{}: could not open file.", path);
 
 		FILE_STANDARD_INFO file_info;
 		{
@@ -31,25 +115,66 @@ namespace mage {
 															 sizeof(file_info));
 			ThrowIfFailed(result,
 						  "{}: could not retrieve file information.", path);
-			ThrowIfFailed((0 == file_info.EndOfFile.HighPart),
-						  "{}: file too big for 32-bit allocation.", path);
 		}
 
+		const auto file_size = static_cast< U64 >(file_info.EndOfFile.QuadPart);
+
+		#else  // _WIN32
+
+		const int file_descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		ThrowIfFailed((-1 != file_descriptor),
+					  "{}: could not open file.", path);
+		const auto file_closer = gsl::finally([file_descriptor]() noexcept {
+			close(file_descriptor);
+		});
+
+		struct stat file_status;
+		ThrowIfFailed((0 == fstat(file_descriptor, &file_status)),
+					  "{}: could not retrieve file information.", path);
+
+		const auto file_size = static_cast< U64 >(file_status.st_size);
+
+		#endif // _WIN32
+		ThrowIfFailed((file_size <= std::numeric_limits< std::size_t >::max()),
+					  "{}: file too big for address space.", path);
+
 		// Allocate buffer.
-		const auto nb_bytes = file_info.EndOfFile.LowPart;
-		size = static_cast< std::size_t >(nb_bytes);
-		data = MakeUnique< U8[] >(nb_bytes);
+		size = static_cast< std::size_t >(file_size);
+		data = MakeUnique< U8[] >(size);
 		ThrowIfFailed((nullptr != data),
 					  "{}: file too big for allocation.", path);
 
-		// Populate buffer.
-		{
+		// Populate buffer (in chunks of at most g_max_read_size bytes).
+		for (std::size_t offset = 0u; offset < size;) {
+			#ifdef _WIN32
+
+			const auto nb_bytes = static_cast< DWORD >(
+				std::min(size - offset, g_max_read_size));
+
 			DWORD nb_bytes_read = 0u;
-			const BOOL result = ReadFile(file_handle.get(), data.get(),
+			const BOOL result = ReadFile(file_handle.get(), data.get() + offset,
 										 nb_bytes, &nb_bytes_read, nullptr);
 			ThrowIfFailed(result, "{}: could not load file data.", path);
-			ThrowIfFailed((nb_bytes <= nb_bytes_read),
+			ThrowIfFailed((0u != nb_bytes_read),
+						  "{}: could not load all file data.", path);
+
+			#else  // _WIN32
+
+			const auto nb_bytes = std::min(size - offset, g_max_read_size);
+
+			const auto result = read(file_descriptor, data.get() + offset,
+									 nb_bytes);
+			if (-1 == result && EINTR == errno) {
+				continue;
+			}
+			ThrowIfFailed((-1 != result), "{}: could not load file data.", path);
+			ThrowIfFailed((0 != result),
 						  "{}: could not load all file data.", path);
+			const auto nb_bytes_read = static_cast< std::size_t >(result);
+
+			#endif // _WIN32
+
+			offset += nb_bytes_read;
 		}
 	}
 
@@ -63,7 +188,8 @@ namespace mage {
 		m_big_endian(true),
 		m_pos(nullptr),
 		m_end(nullptr),
-		m_data() {}
+		m_file(),
+		m_stream() {}
 
 	BinaryReader::BinaryReader(BinaryReader&& reader) noexcept = default;
 
@@ -73,18 +199,30 @@ namespace mage {
 		::operator=(BinaryReader&& reader) noexcept = default;
 
 	void BinaryReader::ReadFromFile(std::filesystem::path path,
-									bool big_endian) {
+									bool big_endian,
+									BinaryFileSource source) {
 
 		m_path       = std::move(path);
 		m_big_endian = big_endian;
 
-		std::size_t nb_bytes = 0u;
-		ReadBinaryFile(m_path, m_data, nb_bytes);
+		m_file.reset();
+		m_stream.reset();
+		m_pos = nullptr;
+		m_end = nullptr;
 
-		m_pos = m_data.get();
-		m_end = m_data.get() + nb_bytes;
+		if (IsStreamed(m_path, source)) {
+			m_stream = MakeUnique< FileStream >(m_path);
+		}
+		else {
+			m_file.emplace(m_path);
+			m_pos = m_file->GetData().data();
+			m_end = m_pos + m_file->size();
+		}
 
 		ReadData();
+
+		m_file.reset();
+		m_stream.reset();
 	}
 
 	void BinaryReader::ReadFromMemory(gsl::span< const U8 > input,
@@ -93,6 +231,8 @@ namespace mage {
 		m_path       = L"input string";
 		m_big_endian = big_endian;
 
+		m_file.reset();
+		m_stream.reset();
 		m_pos = input.data();
 		m_end = input.data() + input.size();
 
@@ -102,15 +242,11 @@ namespace mage {
 	}
 
 	NotNull< const_zstring > BinaryReader::ReadChars(std::size_t size) {
-		const auto old_pos = m_pos;
-		const auto new_pos = m_pos + size;
-		ThrowIfFailed((m_pos <= new_pos),
-					  "{}: overflow: no chars value found.", GetPath());
-		ThrowIfFailed((new_pos <= m_end),
+		const auto pos = Acquire(size);
+		ThrowIfFailed((nullptr != pos),
 					  "{}: end of file: no chars value found.", GetPath());
 
-		m_pos = new_pos;
-		return NotNull< const_zstring >(reinterpret_cast< const char* >(old_pos));
+		return NotNull< const_zstring >(reinterpret_cast< const char* >(pos));
 	}
 
 	#pragma endregion
@@ -124,7 +260,8 @@ namespace mage {
 		: m_path(),
 		m_pos(nullptr),
 		m_end(nullptr),
-		m_data() {}
+		m_file(),
+		m_stream() {}
 
 	BigEndianBinaryReader::BigEndianBinaryReader(
 		BigEndianBinaryReader&& reader) noexcept = default;
@@ -134,21 +271,35 @@ namespace mage {
 	BigEndianBinaryReader& BigEndianBinaryReader
 		::operator=(BigEndianBinaryReader&& reader) noexcept = default;
 
-	void BigEndianBinaryReader::ReadFromFile(std::filesystem::path path) {
+	void BigEndianBinaryReader::ReadFromFile(std::filesystem::path path,
+											 BinaryFileSource source) {
 		m_path = std::move(path);
 
-		std::size_t nb_bytes = 0u;
-		ReadBinaryFile(m_path, m_data, nb_bytes);
+		m_file.reset();
+		m_stream.reset();
+		m_pos  = nullptr;
+		m_end  = nullptr;
 
-		m_pos  = m_data.get();
-		m_end  = m_data.get() + nb_bytes;
+		if (IsStreamed(m_path, source)) {
+			m_stream = MakeUnique< FileStream >(m_path);
+		}
+		else {
+			m_file.emplace(m_path);
+			m_pos  = m_file->GetData().data();
+			m_end  = m_pos + m_file->size();
+		}
 
 		ReadData();
+
+		m_file.reset();
+		m_stream.reset();
 	}
 
 	void BigEndianBinaryReader::ReadFromMemory(gsl::span< const U8 > input) {
 		m_path = L"input string";
 
+		m_file.reset();
+		m_stream.reset();
 		m_pos  = input.data();
 		m_end  = input.data() + input.size();
 
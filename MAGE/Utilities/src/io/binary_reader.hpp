@@ -5,8 +5,19 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "exception\exception.hpp"
-#include "io\binary_utils.hpp"
+#include "exception/exception.hpp"
+#include "io/binary_utils.hpp"
+#include "io/file_stream.hpp"
+#include "io/mapped_file.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <optional>
 
 #pragma endregion
 
@@ -15,6 +26,20 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	/**
+	 An enumeration of sources of binary files.
+
+	 This contains:
+	 @c Automatic,
+	 @c Mapped and
+	 @c Streamed.
+	 */
+	enum class BinaryFileSource : U8 {
+		Automatic = 0, // Mapped unless the file is too big for the address space
+		Mapped,        // Memory-mapped file (or archive entry)
+		Streamed       // Windowed file stream with read-ahead
+	};
+
 	/**
 	 Reads the bytes of the binary file associated with the given path.
 
@@ -79,10 +104,14 @@ namespace mage {
 		 @param[in]		big_endian
 						Flag indicating whether the given byte array should be
 						interpreted as big endian or not (i.e. little endian).
+		 @param[in]		source
+						The source of the file. Files of the mounted archives
+						are always mapped.
 		 @throws		Exception
 						Failed to read from the file.
 		 */
-		void ReadFromFile(std::filesystem::path path, bool big_endian);
+		void ReadFromFile(std::filesystem::path path, bool big_endian,
+						  BinaryFileSource source = BinaryFileSource::Automatic);
 
 		/**
 		 Reads the input string.
@@ -152,7 +181,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		bool ContainsChars() const noexcept {
-			return m_pos < m_end;
+			return m_stream ? m_stream->ContainsData() : (m_pos < m_end);
 		}
 
 		/**
@@ -160,7 +189,9 @@ namespace mage {
 
 		 @param			size
 						The number of bytes to read.
-		 @return		A pointer to the array of characters read.
+		 @return		A pointer to the array of characters read. When
+						streaming, the array remains valid until the next
+						read only.
 		 @throws		Exception
 						Failed to read @c size bytes.
 		 */
@@ -184,6 +215,31 @@ namespace mage {
 		// Member Methods
 		//---------------------------------------------------------------------
 
+		/**
+		 Acquires the given number of (contiguous) bytes.
+
+		 @param[in]		size
+						The number of bytes.
+		 @return		A pointer to the acquired bytes.
+		 @return		@c nullptr if there are less than @c size bytes left.
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		[[nodiscard]]
+		const U8* Acquire(std::size_t size) {
+			if (m_stream) {
+				return m_stream->Acquire(size);
+			}
+
+			if (static_cast< std::size_t >(m_end - m_pos) < size) {
+				return nullptr;
+			}
+
+			const auto pos = m_pos;
+			m_pos += size;
+			return pos;
+		}
+
 		/**
 		 Starts reading.
 
@@ -218,9 +274,14 @@ namespace mage {
 		const U8* m_end;
 
 		/**
-		 A pointer to the data to read of this binary reader.
+		 The mapped file of this binary reader.
 		 */
-		UniquePtr< U8[] > m_data;
+		std::optional< MappedFile > m_file;
+
+		/**
+		 A pointer to the file stream of this binary reader.
+		 */
+		UniquePtr< FileStream > m_stream;
 	};
 
 	#pragma endregion
@@ -274,10 +335,14 @@ namespace mage {
 
 		 @param[in]		path
 						The path.
+		 @param[in]		source
+						The source of the file. Files of the mounted archives
+						are always mapped.
 		 @throws		Exception
 						Failed to read from the file.
 		 */
-		void ReadFromFile(std::filesystem::path path);
+		void ReadFromFile(std::filesystem::path path,
+						  BinaryFileSource source = BinaryFileSource::Automatic);
 
 		/**
 		 Reads the input string.
@@ -347,7 +412,7 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		bool ContainsChars() const noexcept {
-			return m_pos < m_end;
+			return m_stream ? m_stream->ContainsData() : (m_pos < m_end);
 		}
 
 		/**
@@ -369,19 +434,61 @@ namespace mage {
 						The data type.
 		 @param			count
 						The number of @c T values to read.
-		 @return		A pointer to the array of @c T value read.
+		 @return		A pointer to the array of @c T value read. When
+						streaming, the array remains valid until the next
+						read only.
 		 @throws		Exception
 						Failed to read @c count @c T values.
 		 */
 		template< typename T >
 		const T* ReadArray(std::size_t count);
 
+		/**
+		 Reads an array of @c T values into the given buffer.
+
+		 When streaming, the values are read without intermediate copies.
+
+		 @tparam		T
+						The data type.
+		 @param[out]	output
+						The output buffer of the @c T values to read.
+		 @throws		Exception
+						Failed to read @c output.size() @c T values.
+		 */
+		template< typename T >
+		void ReadArray(gsl::span< T > output);
+
 	private:
 
 		//---------------------------------------------------------------------
 		// Member Methods
 		//---------------------------------------------------------------------
 
+		/**
+		 Acquires the given number of (contiguous) bytes.
+
+		 @param[in]		size
+						The number of bytes.
+		 @return		A pointer to the acquired bytes.
+		 @return		@c nullptr if there are less than @c size bytes left.
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		[[nodiscard]]
+		const U8* Acquire(std::size_t size) {
+			if (m_stream) {
+				return m_stream->Acquire(size);
+			}
+
+			if (static_cast< std::size_t >(m_end - m_pos) < size) {
+				return nullptr;
+			}
+
+			const auto pos = m_pos;
+			m_pos += size;
+			return pos;
+		}
+
 		/**
 		 Starts reading.
 
@@ -410,9 +517,14 @@ namespace mage {
 		const U8* m_end;
 
 		/**
-		 A pointer to the data to read of this big endian binary reader.
+		 The mapped file of this big endian binary reader.
+		 */
+		std::optional< MappedFile > m_file;
+
+		/**
+		 A pointer to the file stream of this big endian binary reader.
 		 */
-		UniquePtr< U8[] > m_data;
+		UniquePtr< FileStream > m_stream;
 	};
 
 	#pragma endregion
@@ -423,6 +535,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\binary_reader.tpp"
+#include "io/binary_reader.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -1,5 +1,15 @@
 #pragma once
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -7,16 +17,11 @@ namespace mage {
 
 	template< typename T >
 	const T BinaryReader::Read() {
-		const auto old_pos = m_pos;
-		const auto new_pos = m_pos + sizeof(T);
-
-		ThrowIfFailed((m_pos <= new_pos),
-					  "{}: overflow: no value found.", GetPath());
-		ThrowIfFailed((new_pos <= m_end),
+		const auto pos = Acquire(sizeof(T));
+		ThrowIfFailed((nullptr != pos),
 					  "{}: end of file: no value found.", GetPath());
 
-		m_pos = new_pos;
-		return BytesTo< T >(old_pos, m_big_endian);
+		return BytesTo< T >(NotNull< const U8* >(pos), m_big_endian);
 	}
 
 	template< typename T >
@@ -26,15 +31,29 @@ namespace mage {
 
 	template< typename T >
 	const T* BigEndianBinaryReader::ReadArray(std::size_t count) {
-		const auto old_pos = m_pos;
-		const auto new_pos = m_pos + sizeof(T) * count;
-
-		ThrowIfFailed((m_pos <= new_pos),
+		ThrowIfFailed((count <= std::numeric_limits< std::size_t >::max() / sizeof(T)),
 					  "{}: overflow: no {} values found.", GetPath(), count);
-		ThrowIfFailed((new_pos <= m_end),
+
+		const auto pos = Acquire(sizeof(T) * count);
+		ThrowIfFailed((nullptr != pos),
 					  "{}: end of file: no {} values found.", GetPath(), count);
 
-		m_pos = new_pos;
-		return reinterpret_cast< const T* >(old_pos);
+		return reinterpret_cast< const T* >(pos);
+	}
+
+	template< typename T >
+	void BigEndianBinaryReader::ReadArray(gsl::span< T > output) {
+		const auto count = static_cast< std::size_t >(output.size());
+
+		if (m_stream) {
+			const auto result = m_stream->Read(
+				reinterpret_cast< U8* >(output.data()), sizeof(T) * count);
+			ThrowIfFailed(result,
+						  "{}: end of file: no {} values found.", GetPath(), count);
+			return;
+		}
+
+		const auto values = ReadArray< T >(count);
+		std::copy(values, values + count, output.begin());
 	}
-}
\ No newline at end of file
+}
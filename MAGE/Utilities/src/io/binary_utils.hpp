@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -75,6 +75,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\binary_utils.tpp"
+#include "io/binary_utils.tpp"
 
 #pragma endregion
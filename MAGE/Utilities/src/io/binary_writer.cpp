@@ -3,7 +3,16 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\binary_writer.hpp"
+#include "io/binary_writer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
 
 #pragma endregion
 
@@ -13,7 +22,7 @@
 namespace mage {
 
 	BigEndianBinaryWriter::BigEndianBinaryWriter()
-		: m_file_stream(nullptr),
+		: m_file_writer(),
 		m_path() {}
 
 	BigEndianBinaryWriter::BigEndianBinaryWriter(
@@ -27,26 +36,27 @@ namespace mage {
 	void BigEndianBinaryWriter::WriteToFile(std::filesystem::path path) {
 		m_path = std::move(path);
 
-		std::FILE* file;
-		{
-			const errno_t result = _wfopen_s(&file, m_path.c_str(), L"wb");
-			ThrowIfFailed((0 == result), "{}: could not open file.", m_path);
-		}
-
-		m_file_stream.reset(file);
+		m_file_writer.emplace(m_path);
 
 		WriteData();
+
+		m_file_writer->Close();
+		m_file_writer.reset();
+	}
+
+	void BigEndianBinaryWriter::Flush() {
+		m_file_writer->Flush();
+	}
+
+	void BigEndianBinaryWriter::Sync() {
+		m_file_writer->Sync();
 	}
 
 	void BigEndianBinaryWriter::WriteCharacter(char c) {
-		const int result = std::fputc(c, m_file_stream.get());
-		ThrowIfFailed((EOF != result),
-					  "{}: could not write to file.", GetPath());
+		m_file_writer->Write(&c, 1u);
 	}
 
 	void BigEndianBinaryWriter::WriteString(NotNull< const_zstring > str) {
-		const int result = std::fputs(str, m_file_stream.get());
-		ThrowIfFailed((EOF != result),
-					  "{}: could not write to file.", GetPath());
+		m_file_writer->Write(str.get(), std::strlen(str));
 	}
 }
\ No newline at end of file
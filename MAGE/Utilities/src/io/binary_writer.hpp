@@ -5,7 +5,17 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "exception\exception.hpp"
+#include "exception/exception.hpp"
+#include "io/file_writer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <optional>
 
 #pragma endregion
 
@@ -111,6 +121,24 @@ namespace mage {
 			return m_path;
 		}
 
+		/**
+		 Writes the buffered data of this big endian binary writer to the
+		 file and waits until it is written.
+
+		 @throws		Exception
+						Failed to write to the file.
+		 */
+		void Flush();
+
+		/**
+		 Flushes this big endian binary writer and the file buffers of the
+		 operating system (i.e. all data is written to the disk).
+
+		 @throws		Exception
+						Failed to write to the file.
+		 */
+		void Sync();
+
 		/**
 		 Writes the given data.
 
@@ -177,9 +205,9 @@ namespace mage {
 		//---------------------------------------------------------------------
 
 		/**
-		 A pointer to the file stream of this big endian binary writer.
+		 The (buffered) file writer of this big endian binary writer.
 		 */
-		UniqueFileStream m_file_stream;
+		std::optional< FileWriter > m_file_writer;
 
 		/**
 		 The current path of this big endian binary writer.
@@ -193,6 +221,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\binary_writer.tpp"
+#include "io/binary_writer.tpp"
 
 #pragma endregion
\ No newline at end of file
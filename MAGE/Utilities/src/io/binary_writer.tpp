@@ -12,10 +12,6 @@ namespace mage {
 
 	template< typename T >
 	void BigEndianBinaryWriter::WriteArray(gsl::span< const T > data) {
-		const std::size_t count         = data.size();
-		const std::size_t count_written = std::fwrite(data.data(), sizeof(T),
-													  count, m_file_stream.get());
-		ThrowIfFailed((count_written == count),
-					  "{}: could not write all data to file.", GetPath());
+		m_file_writer->Write(data.data(), sizeof(T) * data.size());
 	}
 }
\ No newline at end of file
@@ -0,0 +1,110 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io/checksum.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		constexpr U64 g_prime1 = 0x9E3779B185EBCA87ULL;
+		constexpr U64 g_prime2 = 0xC2B2AE3D27D4EB4FULL;
+		constexpr U64 g_prime3 = 0x165667B19E3779F9ULL;
+		constexpr U64 g_prime4 = 0x85EBCA77C2B2AE63ULL;
+		constexpr U64 g_prime5 = 0x27D4EB2F165667C5ULL;
+
+		[[nodiscard]]
+		inline U64 RotateLeft(U64 x, int n) noexcept {
+			return (x << n) | (x >> (64 - n));
+		}
+
+		[[nodiscard]]
+		inline U64 Load64(const U8* data) noexcept {
+			U64 value;
+			std::memcpy(&value, data, sizeof(value));
+			return value;
+		}
+
+		[[nodiscard]]
+		inline U64 Round(U64 acc, U64 input) noexcept {
+			acc += input * g_prime2;
+			acc  = RotateLeft(acc, 31);
+			return acc * g_prime1;
+		}
+
+		[[nodiscard]]
+		inline U64 MergeRound(U64 acc, U64 value) noexcept {
+			acc ^= Round(0u, value);
+			return acc * g_prime1 + g_prime4;
+		}
+	}
+
+	[[nodiscard]]
+	U64 ComputeChecksum(gsl::span< const U8 > data, U64 seed) noexcept {
+		auto       pos  = data.data();
+		const auto size = static_cast< std::size_t >(data.size());
+		const auto end  = pos + size;
+
+		U64 hash;
+		if (32u <= size) {
+			U64 lanes[] = {
+				seed + g_prime1 + g_prime2,
+				seed + g_prime2,
+				seed,
+				seed - g_prime1
+			};
+
+			for (const auto last = end - 32; pos <= last; pos += 32) {
+				lanes[0] = Round(lanes[0], Load64(pos));
+				lanes[1] = Round(lanes[1], Load64(pos +  8));
+				lanes[2] = Round(lanes[2], Load64(pos + 16));
+				lanes[3] = Round(lanes[3], Load64(pos + 24));
+			}
+
+			hash = RotateLeft(lanes[0],  1) + RotateLeft(lanes[1],  7)
+				 + RotateLeft(lanes[2], 12) + RotateLeft(lanes[3], 18);
+			for (const auto lane : lanes) {
+				hash = MergeRound(hash, lane);
+			}
+		}
+		else {
+			hash = seed + g_prime5;
+		}
+
+		hash += static_cast< U64 >(size);
+
+		for (; pos + 8 <= end; pos += 8) {
+			hash ^= Round(0u, Load64(pos));
+			hash  = RotateLeft(hash, 27) * g_prime1 + g_prime4;
+		}
+
+		for (; pos < end; ++pos) {
+			hash ^= static_cast< U64 >(*pos) * g_prime5;
+			hash  = RotateLeft(hash, 11) * g_prime1;
+		}
+
+		// Avalanche
+		hash ^= hash >> 33;
+		hash *= g_prime2;
+		hash ^= hash >> 29;
+		hash *= g_prime3;
+		hash ^= hash >> 32;
+		return hash;
+	}
+}
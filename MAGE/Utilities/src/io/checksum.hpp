@@ -0,0 +1,33 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory/memory.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 Computes the 64-bit checksum of the given data.
+
+	 The checksum processes four independent 64-bit lanes per 32-byte block
+	 (multiply-rotate rounds), which keeps it well above disk bandwidth. The
+	 checksum is meant to detect corrupted or truncated files, not to resist
+	 tampering.
+
+	 @param[in]		data
+					The data.
+	 @param[in]		seed
+					The seed.
+	 @return		The 64-bit checksum of the given data.
+	 */
+	[[nodiscard]]
+	U64 ComputeChecksum(gsl::span< const U8 > data, U64 seed = 0u) noexcept;
+}
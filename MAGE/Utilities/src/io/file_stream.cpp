@@ -0,0 +1,328 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io/file_stream.hpp"
+#include "exception/exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#ifndef _WIN32
+	#include <cerrno>
+	#include <fcntl.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif // _WIN32
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The maximum number of bytes read by a single read operation.
+		 */
+		constexpr std::size_t g_max_read_size = 1u << 30u;
+	}
+
+	FileStream::FileStream(std::filesystem::path path, std::size_t window_size)
+		: m_path(std::move(path)),
+		#ifdef _WIN32
+		m_file(),
+		m_event(),
+		m_overlapped{},
+		#else  // _WIN32
+		m_file(-1),
+		#endif // _WIN32
+		m_size(0u),
+		m_offset(0u),
+		m_window_size(std::clamp(window_size, std::size_t(4096u), g_max_read_size)),
+		m_pending_size(0u),
+		m_buffers{},
+		m_front(0u),
+		m_large_buffer(),
+		m_pos(nullptr),
+		m_end(nullptr) {
+
+		#ifdef _WIN32
+
+		CREATEFILE2_EXTENDED_PARAMETERS parameters = {};
+		parameters.dwSize           = sizeof(parameters);
+		parameters.dwFileAttributes = FILE_ATTRIBUTE_NORMAL;
+		parameters.dwFileFlags      = FILE_FLAG_OVERLAPPED
+			                        | FILE_FLAG_SEQUENTIAL_SCAN;
+
+		m_file = CreateUniqueHandle(CreateFile2(m_path.c_str(),
+												GENERIC_READ,
+												FILE_SHARE_READ,
+												OPEN_EXISTING,
+												&parameters));
+		ThrowIfFailed((nullptr != m_file),
+					  "{}: could not open file.", m_path);
+
+		LARGE_INTEGER file_size;
+		{
+			const BOOL result = GetFileSizeEx(m_file.get(), &file_size);
+			ThrowIfFailed(result, "{}: could not retrieve file size.", m_path);
+		}
+		m_size = static_cast< U64 >(file_size.QuadPart);
+
+		m_event = CreateUniqueHandle(CreateEvent(nullptr, TRUE, FALSE, nullptr));
+		ThrowIfFailed((nullptr != m_event),
+					  "{}: could not create event.", m_path);
+		m_overlapped.hEvent = m_event.get();
+
+		#else  // _WIN32
+
+		m_file = open(m_path.c_str(), O_RDONLY | O_CLOEXEC);
+		ThrowIfFailed((-1 != m_file),
+					  "{}: could not open file.", m_path);
+
+		struct stat file_status;
+		if (0 != fstat(m_file, &file_status)) {
+			close(m_file);
+			ThrowIfFailed(false, "{}: could not retrieve file size.", m_path);
+		}
+		m_size = static_cast< U64 >(file_status.st_size);
+
+		#ifdef POSIX_FADV_SEQUENTIAL
+		posix_fadvise(m_file, 0, 0, POSIX_FADV_SEQUENTIAL);
+		#endif // POSIX_FADV_SEQUENTIAL
+
+		#endif // _WIN32
+
+		try {
+			// Each buffer reserves room for the unread bytes of the previous
+			// window in front of its window.
+			for (auto& buffer : m_buffers) {
+				buffer.resize(2u * m_window_size);
+			}
+
+			ReadAhead();
+		}
+		catch (...) {
+			#ifndef _WIN32
+			// The destructor is not invoked if the construction fails.
+			close(m_file);
+			#endif // _WIN32
+			throw;
+		}
+	}
+
+	FileStream::~FileStream() {
+		#ifdef _WIN32
+		if (0u != m_pending_size) {
+			// The buffer must outlive the pending read.
+			CancelIoEx(m_file.get(), &m_overlapped);
+			DWORD nb_bytes_read = 0u;
+			GetOverlappedResult(m_file.get(), &m_overlapped, &nb_bytes_read, TRUE);
+		}
+		#else  // _WIN32
+		close(m_file);
+		#endif // _WIN32
+	}
+
+	[[nodiscard]]
+	const U8* FileStream::Refill(std::size_t size) {
+		const auto nb_remaining = static_cast< std::size_t >(m_end - m_pos);
+		if (nb_remaining + m_pending_size + (m_size - m_offset) < size) {
+			return nullptr;
+		}
+
+		auto& back = m_buffers[1u - m_front];
+		const auto window = back.data() + m_window_size;
+
+		if (size <= m_window_size) {
+			// Prepend the unread bytes of the current window to the
+			// read-ahead window.
+			const auto nb_bytes_read = WaitForReadAhead();
+			const auto begin = window - nb_remaining;
+			if (0u != nb_remaining) {
+				std::memcpy(begin, m_pos, nb_remaining);
+			}
+
+			m_front = 1u - m_front;
+			m_pos   = begin;
+			m_end   = window + nb_bytes_read;
+
+			// The previous window is no longer referenced.
+			ReadAhead();
+
+			if (static_cast< std::size_t >(m_end - m_pos) < size) {
+				return nullptr;
+			}
+
+			const auto pos = m_pos;
+			m_pos += size;
+			return pos;
+		}
+
+		// Acquisitions exceeding the window size are assembled in a dedicated
+		// buffer.
+		m_large_buffer.resize(size);
+		return Read(m_large_buffer.data(), size) ? m_large_buffer.data() : nullptr;
+	}
+
+	bool FileStream::Read(U8* data, std::size_t size) {
+		const auto nb_remaining = static_cast< std::size_t >(m_end - m_pos);
+		if (size <= nb_remaining) {
+			std::memcpy(data, m_pos, size);
+			m_pos += size;
+			return true;
+		}
+
+		if (nb_remaining + m_pending_size + (m_size - m_offset) < size) {
+			return false;
+		}
+
+		// Copy the unread bytes of the current window.
+		if (0u != nb_remaining) {
+			std::memcpy(data, m_pos, nb_remaining);
+		}
+		auto nb_filled = nb_remaining;
+
+		// Copy the read-ahead window.
+		auto& back = m_buffers[1u - m_front];
+		const auto window = back.data() + m_window_size;
+		const auto nb_bytes_read = WaitForReadAhead();
+		const auto nb_copied = std::min(nb_bytes_read, size - nb_filled);
+		if (0u != nb_copied) {
+			std::memcpy(data + nb_filled, window, nb_copied);
+		}
+		nb_filled += nb_copied;
+
+		m_front = 1u - m_front;
+		m_pos   = window + nb_copied;
+		m_end   = window + nb_bytes_read;
+
+		// Read the remaining bytes without an intermediate copy.
+		if (nb_filled < size) {
+			ReadAt(data + nb_filled, size - nb_filled, m_offset);
+			m_offset += size - nb_filled;
+		}
+
+		ReadAhead();
+
+		return true;
+	}
+
+	void FileStream::ReadAhead() {
+		if (m_size <= m_offset) {
+			return;
+		}
+
+		const auto size = static_cast< std::size_t >(
+			std::min(static_cast< U64 >(m_window_size), m_size - m_offset));
+		auto& back = m_buffers[1u - m_front];
+
+		#ifdef _WIN32
+
+		m_overlapped.Offset     = static_cast< DWORD >(m_offset);
+		m_overlapped.OffsetHigh = static_cast< DWORD >(m_offset >> 32u);
+
+		const BOOL result = ReadFile(m_file.get(),
+									 back.data() + m_window_size,
+									 static_cast< DWORD >(size),
+									 nullptr,
+									 &m_overlapped);
+		ThrowIfFailed((result || ERROR_IO_PENDING == GetLastError()),
+					  "{}: could not read file.", m_path);
+
+		#else  // _WIN32
+
+		ReadAt(back.data() + m_window_size, size, m_offset);
+
+		#endif // _WIN32
+
+		m_pending_size = size;
+		m_offset      += size;
+	}
+
+	[[nodiscard]]
+	std::size_t FileStream::WaitForReadAhead() {
+		if (0u == m_pending_size) {
+			return 0u;
+		}
+
+		#ifdef _WIN32
+
+		DWORD nb_bytes_read = 0u;
+		const BOOL result = GetOverlappedResult(m_file.get(), &m_overlapped,
+												&nb_bytes_read, TRUE);
+		const auto expected_size = m_pending_size;
+		m_pending_size = 0u;
+
+		ThrowIfFailed(result, "{}: could not read file.", m_path);
+		ThrowIfFailed((expected_size == nb_bytes_read),
+					  "{}: could not read all file data.", m_path);
+
+		return static_cast< std::size_t >(nb_bytes_read);
+
+		#else  // _WIN32
+
+		// The read-ahead completed synchronously.
+		return std::exchange(m_pending_size, 0u);
+
+		#endif // _WIN32
+	}
+
+	void FileStream::ReadAt(U8* data, std::size_t size, U64 offset) {
+		while (0u != size) {
+			const auto chunk_size = std::min(size, g_max_read_size);
+
+			#ifdef _WIN32
+
+			m_overlapped.Offset     = static_cast< DWORD >(offset);
+			m_overlapped.OffsetHigh = static_cast< DWORD >(offset >> 32u);
+
+			const BOOL result = ReadFile(m_file.get(), data,
+										 static_cast< DWORD >(chunk_size),
+										 nullptr, &m_overlapped);
+			ThrowIfFailed((result || ERROR_IO_PENDING == GetLastError()),
+						  "{}: could not read file.", m_path);
+
+			DWORD nb_bytes_read = 0u;
+			{
+				const BOOL wait_result = GetOverlappedResult(m_file.get(),
+															 &m_overlapped,
+															 &nb_bytes_read,
+															 TRUE);
+				ThrowIfFailed(wait_result, "{}: could not read file.", m_path);
+				ThrowIfFailed((0u != nb_bytes_read),
+							  "{}: could not read all file data.", m_path);
+			}
+
+			#else  // _WIN32
+
+			const auto result = pread(m_file, data, chunk_size,
+									  static_cast< off_t >(offset));
+			if (-1 == result && EINTR == errno) {
+				continue;
+			}
+			ThrowIfFailed((-1 != result), "{}: could not read file.", m_path);
+			ThrowIfFailed((0 != result),
+						  "{}: could not read all file data.", m_path);
+			const auto nb_bytes_read = static_cast< std::size_t >(result);
+
+			#endif // _WIN32
+
+			data   += nb_bytes_read;
+			size   -= nb_bytes_read;
+			offset += nb_bytes_read;
+		}
+	}
+}
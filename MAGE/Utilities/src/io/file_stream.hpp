@@ -0,0 +1,322 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory/memory.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The default size (in bytes) of the window of file streams.
+	 */
+	constexpr std::size_t g_file_stream_window_size = 2u << 20u;
+
+	/**
+	 A class of read-only file streams.
+
+	 A file stream reads a file sequentially through a window of a fixed size
+	 while the next window is read ahead asynchronously. The memory use is
+	 independent of the size of the file.
+	 */
+	class FileStream {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a file stream for the file associated with the given
+		 path.
+
+		 @param[in]		path
+						The path.
+		 @param[in]		window_size
+						The size (in bytes) of the window.
+		 @throws		Exception
+						Failed to open the file.
+		 */
+		explicit FileStream(std::filesystem::path path,
+							std::size_t window_size = g_file_stream_window_size);
+
+		/**
+		 Constructs a file stream from the given file stream.
+
+		 @param[in]		stream
+						A reference to the file stream to copy.
+		 */
+		FileStream(const FileStream& stream) = delete;
+
+		/**
+		 Constructs a file stream by moving the given file stream.
+
+		 @param[in]		stream
+						A reference to the file stream to move.
+		 */
+		FileStream(FileStream&& stream) = delete;
+
+		/**
+		 Destructs this file stream.
+		 */
+		~FileStream();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given file stream to this file stream.
+
+		 @param[in]		stream
+						A reference to the file stream to copy.
+		 @return		A reference to the copy of the given file stream (i.e.
+						this file stream).
+		 */
+		FileStream& operator=(const FileStream& stream) = delete;
+
+		/**
+		 Moves the given file stream to this file stream.
+
+		 @param[in]		stream
+						A reference to the file stream to move.
+		 @return		A reference to the moved file stream (i.e. this file
+						stream).
+		 */
+		FileStream& operator=(FileStream&& stream) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the path of this file stream.
+
+		 @return		A reference to the path of this file stream.
+		 */
+		[[nodiscard]]
+		const std::filesystem::path& GetPath() const noexcept {
+			return m_path;
+		}
+
+		/**
+		 Returns the size (in bytes) of the file of this file stream.
+
+		 @return		The size (in bytes) of the file of this file stream.
+		 */
+		[[nodiscard]]
+		U64 size() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Checks if there are bytes left to read by this file stream.
+
+		 @return		@c true if there are bytes left to read by this file
+						stream. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool ContainsData() const noexcept {
+			return (m_pos < m_end) || (0u != m_pending_size)
+				|| (m_offset < m_size);
+		}
+
+		/**
+		 Acquires the given number of (contiguous) bytes.
+
+		 @param[in]		size
+						The number of bytes.
+		 @return		A pointer to the acquired bytes which remains valid
+						until the next acquisition.
+		 @return		@c nullptr if there are less than @c size bytes left.
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		[[nodiscard]]
+		const U8* Acquire(std::size_t size) {
+			if (static_cast< std::size_t >(m_end - m_pos) < size) {
+				return Refill(size);
+			}
+
+			const auto pos = m_pos;
+			m_pos += size;
+			return pos;
+		}
+
+		/**
+		 Reads the given number of bytes into the given buffer.
+
+		 Bytes beyond the read-ahead window are read directly into the given
+		 buffer.
+
+		 @param[out]	data
+						A pointer to the output buffer.
+		 @param[in]		size
+						The number of bytes.
+		 @return		@c true if @c size bytes are read. @c false if there
+						are less than @c size bytes left (nothing is read).
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		bool Read(U8* data, std::size_t size);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Refills the window of this file stream and acquires the given number
+		 of (contiguous) bytes.
+
+		 @param[in]		size
+						The number of bytes.
+		 @return		A pointer to the acquired bytes.
+		 @return		@c nullptr if there are less than @c size bytes left.
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		[[nodiscard]]
+		const U8* Refill(std::size_t size);
+
+		/**
+		 Issues the (asynchronous) read of the next window of this file
+		 stream.
+
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		void ReadAhead();
+
+		/**
+		 Waits for the pending read of this file stream.
+
+		 @return		The number of bytes read.
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		[[nodiscard]]
+		std::size_t WaitForReadAhead();
+
+		/**
+		 Reads the given number of bytes at the given offset of the file of
+		 this file stream.
+
+		 @param[out]	data
+						A pointer to the output buffer.
+		 @param[in]		size
+						The number of bytes.
+		 @param[in]		offset
+						The offset (in bytes) in the file.
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		void ReadAt(U8* data, std::size_t size, U64 offset);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The path of this file stream.
+		 */
+		std::filesystem::path m_path;
+
+		#ifdef _WIN32
+
+		/**
+		 A handle to the file of this file stream.
+		 */
+		UniqueHandle m_file;
+
+		/**
+		 A handle to the event signaling the completion of reads of this file
+		 stream.
+		 */
+		UniqueHandle m_event;
+
+		/**
+		 The overlapped structure of the pending read of this file stream.
+		 */
+		OVERLAPPED m_overlapped;
+
+		#else  // _WIN32
+
+		/**
+		 The descriptor of the file of this file stream. Reads are
+		 synchronous; the read-ahead relies on the sequential access hint.
+		 */
+		int m_file;
+
+		#endif // _WIN32
+
+		/**
+		 The size (in bytes) of the file of this file stream.
+		 */
+		U64 m_size;
+
+		/**
+		 The offset (in bytes) in the file of the next read of this file
+		 stream.
+		 */
+		U64 m_offset;
+
+		/**
+		 The size (in bytes) of the window of this file stream.
+		 */
+		std::size_t m_window_size;
+
+		/**
+		 The size (in bytes) of the pending read of this file stream.
+		 */
+		std::size_t m_pending_size;
+
+		/**
+		 The buffers of this file stream. Each buffer stores the unread
+		 bytes of the previous window followed by a window.
+		 */
+		std::vector< U8 > m_buffers[2];
+
+		/**
+		 The index of the buffer containing the current window of this file
+		 stream. The other buffer receives the read-ahead window.
+		 */
+		std::size_t m_front;
+
+		/**
+		 The buffer of this file stream for acquisitions exceeding the
+		 window size.
+		 */
+		std::vector< U8 > m_large_buffer;
+
+		/**
+		 A pointer to the current position of this file stream.
+		 */
+		const U8* m_pos;
+
+		/**
+		 A pointer to the end position of the current window of this file
+		 stream.
+		 */
+		const U8* m_end;
+	};
+}
@@ -0,0 +1,491 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io/file_writer.hpp"
+#include "exception/exception.hpp"
+#include "logging/logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+	#include <cerrno>
+	#include <fcntl.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif // _WIN32
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace details {
+
+		struct FileWriterState {
+
+		public:
+
+			/**
+			 Destructs this file writer state.
+			 */
+			~FileWriterState() {
+				CloseFile();
+			}
+
+			/**
+			 Closes the file.
+			 */
+			void CloseFile() noexcept {
+				#ifdef _WIN32
+				m_file.reset();
+				#else  // _WIN32
+				if (-1 != m_file) {
+					close(m_file);
+					m_file = -1;
+				}
+				#endif // _WIN32
+			}
+
+			#ifdef _WIN32
+
+			/**
+			 A handle to the file.
+			 */
+			UniqueHandle m_file;
+
+			#else  // _WIN32
+
+			/**
+			 The descriptor of the file.
+			 */
+			int m_file = -1;
+
+			#endif // _WIN32
+
+			/**
+			 The mutex guarding the remaining members.
+			 */
+			std::mutex m_mutex;
+
+			/**
+			 The condition variable signaling completed writes.
+			 */
+			std::condition_variable m_condition;
+
+			/**
+			 The staging buffers available for reuse.
+			 */
+			std::vector< FileWriterBuffer > m_free_buffers;
+
+			/**
+			 The number of staging buffers submitted but not yet written.
+			 */
+			std::size_t m_nb_pending = 0u;
+
+			/**
+			 The message of the first failed write (if any).
+			 */
+			std::string m_error;
+		};
+	}
+
+	namespace {
+
+		/**
+		 The maximum number of bytes written by a single write operation.
+		 */
+		constexpr std::size_t g_max_write_size = 1u << 30u;
+
+		/**
+		 The maximum number of staging buffers of a file writer which are
+		 submitted but not yet written.
+		 */
+		constexpr std::size_t g_max_pending_buffers = 2u;
+
+		/**
+		 A class of write queues writing the submitted staging buffers of all
+		 file writers on a single background thread (in submission order).
+		 */
+		class WriteQueue {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Class Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Returns the write queue.
+
+			 @return		A reference to the write queue.
+			 */
+			[[nodiscard]]
+			static WriteQueue& Get() {
+				static WriteQueue s_queue;
+				return s_queue;
+			}
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			WriteQueue()
+				: m_jobs(),
+				m_mutex(),
+				m_condition(),
+				m_stop(false),
+				m_thread(&WriteQueue::Run, this) {}
+
+			WriteQueue(const WriteQueue& queue) = delete;
+
+			WriteQueue(WriteQueue&& queue) = delete;
+
+			~WriteQueue() {
+				{
+					const std::lock_guard< std::mutex > lock(m_mutex);
+					m_stop = true;
+				}
+				m_condition.notify_one();
+				m_thread.join();
+			}
+
+			//-----------------------------------------------------------------
+			// Assignment Operators
+			//-----------------------------------------------------------------
+
+			WriteQueue& operator=(const WriteQueue& queue) = delete;
+
+			WriteQueue& operator=(WriteQueue&& queue) = delete;
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Submits the given staging buffer for writing.
+
+			 @param[in]		state
+							A pointer to the state of the file writer.
+			 @param[in]		buffer
+							The staging buffer.
+			 @param[in]		size
+							The number of staged bytes.
+			 */
+			void Submit(SharedPtr< details::FileWriterState > state,
+						FileWriterBuffer buffer,
+						std::size_t size) {
+				{
+					const std::lock_guard< std::mutex > lock(m_mutex);
+					m_jobs.push_back({ std::move(state), std::move(buffer), size });
+				}
+				m_condition.notify_one();
+			}
+
+		private:
+
+			//-----------------------------------------------------------------
+			// Class Member Types
+			//-----------------------------------------------------------------
+
+			/**
+			 A struct of write jobs.
+			 */
+			struct Job {
+
+			public:
+
+				SharedPtr< details::FileWriterState > m_state;
+
+				FileWriterBuffer m_buffer;
+
+				std::size_t m_size;
+			};
+
+			//-----------------------------------------------------------------
+			// Member Methods
+			//-----------------------------------------------------------------
+
+			/**
+			 Writes the submitted staging buffers until this write queue is
+			 destructed.
+			 */
+			void Run() {
+				while (true) {
+					Job job;
+					{
+						std::unique_lock< std::mutex > lock(m_mutex);
+						m_condition.wait(lock, [this]() noexcept {
+							return m_stop || !m_jobs.empty();
+						});
+
+						if (m_jobs.empty()) {
+							return;
+						}
+
+						job = std::move(m_jobs.front());
+						m_jobs.pop_front();
+					}
+
+					Write(job);
+				}
+			}
+
+			/**
+			 Writes the staging buffer of the given job.
+
+			 @param[in]		job
+							A reference to the job.
+			 */
+			static void Write(Job& job) {
+				auto& state = *job.m_state;
+
+				bool failed = false;
+				for (std::size_t offset = 0u; offset < job.m_size && !failed;) {
+					#ifdef _WIN32
+
+					const auto nb_bytes = static_cast< DWORD >(
+						std::min(job.m_size - offset, g_max_write_size));
+
+					DWORD nb_bytes_written = 0u;
+					const BOOL result = WriteFile(state.m_file.get(),
+												  job.m_buffer.data() + offset,
+												  nb_bytes,
+												  &nb_bytes_written,
+												  nullptr);
+					failed  = !result || (0u == nb_bytes_written);
+					offset += nb_bytes_written;
+
+					#else  // _WIN32
+
+					const auto nb_bytes = std::min(job.m_size - offset,
+												   g_max_write_size);
+
+					const auto result = write(state.m_file,
+											  job.m_buffer.data() + offset,
+											  nb_bytes);
+					if (-1 == result && EINTR == errno) {
+						continue;
+					}
+					failed  = (result <= 0);
+					offset += failed ? 0u : static_cast< std::size_t >(result);
+
+					#endif // _WIN32
+				}
+
+				{
+					const std::lock_guard< std::mutex > lock(state.m_mutex);
+					if (failed && state.m_error.empty()) {
+						state.m_error = "could not write all data to file";
+					}
+					state.m_free_buffers.push_back(std::move(job.m_buffer));
+					--state.m_nb_pending;
+				}
+				state.m_condition.notify_all();
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 The submitted jobs of this write queue.
+			 */
+			std::deque< Job > m_jobs;
+
+			/**
+			 The mutex guarding the jobs of this write queue.
+			 */
+			std::mutex m_mutex;
+
+			/**
+			 The condition variable signaling submitted jobs.
+			 */
+			std::condition_variable m_condition;
+
+			/**
+			 A flag indicating whether the thread of this write queue needs
+			 to stop.
+			 */
+			bool m_stop;
+
+			/**
+			 The thread of this write queue.
+			 */
+			std::thread m_thread;
+		};
+	}
+
+	FileWriter::FileWriter(std::filesystem::path path, std::size_t buffer_size)
+		: m_path(std::move(path)),
+		m_state(MakeShared< details::FileWriterState >()),
+		m_buffer(std::max(buffer_size, g_file_writer_buffer_alignment)),
+		m_size(0u) {
+
+		#ifdef _WIN32
+		m_state->m_file = CreateUniqueHandle(CreateFile2(m_path.c_str(),
+														 GENERIC_WRITE,
+														 0u,
+														 CREATE_ALWAYS,
+														 nullptr));
+		ThrowIfFailed((nullptr != m_state->m_file),
+					  "{}: could not open file.", m_path);
+		#else  // _WIN32
+		m_state->m_file = open(m_path.c_str(),
+							   O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+		ThrowIfFailed((-1 != m_state->m_file),
+					  "{}: could not open file.", m_path);
+		#endif // _WIN32
+	}
+
+	FileWriter::FileWriter(FileWriter&& writer) noexcept = default;
+
+	FileWriter::~FileWriter() {
+		if (!m_state) {
+			return;
+		}
+
+		try {
+			Close();
+		}
+		catch (const std::exception& e) {
+			Error("Failed to close file: {}", e.what());
+		}
+	}
+
+	FileWriter& FileWriter::operator=(FileWriter&& writer) noexcept = default;
+
+	void FileWriter::Flush() {
+		ThrowIfFailed((nullptr != m_state),
+					  "{}: could not write to closed file.", m_path);
+
+		if (0u != m_size) {
+			Submit();
+		}
+
+		std::unique_lock< std::mutex > lock(m_state->m_mutex);
+		m_state->m_condition.wait(lock, [this]() noexcept {
+			return 0u == m_state->m_nb_pending;
+		});
+
+		ThrowIfFailed(m_state->m_error.empty(),
+					  "{}: {}.", m_path, m_state->m_error);
+	}
+
+	void FileWriter::Sync() {
+		Flush();
+
+		#ifdef _WIN32
+		const BOOL result = FlushFileBuffers(m_state->m_file.get());
+		ThrowIfFailed(result, "{}: could not flush file buffers.", m_path);
+		#else  // _WIN32
+		ThrowIfFailed((0 == fsync(m_state->m_file)),
+					  "{}: could not flush file buffers.", m_path);
+		#endif // _WIN32
+	}
+
+	void FileWriter::Close() {
+		if (!m_state) {
+			return;
+		}
+
+		// The file is closed even if flushing fails.
+		const auto release = gsl::finally([this]() noexcept {
+			{
+				std::unique_lock< std::mutex > lock(m_state->m_mutex);
+				m_state->m_condition.wait(lock, [this]() noexcept {
+					return 0u == m_state->m_nb_pending;
+				});
+				m_state->CloseFile();
+			}
+
+			m_state.reset();
+			m_buffer = FileWriterBuffer();
+			m_size   = 0u;
+		});
+
+		Flush();
+	}
+
+	void FileWriter::WriteStaged(const U8* data, std::size_t size) {
+		ThrowIfFailed((nullptr != m_state),
+					  "{}: could not write to closed file.", m_path);
+
+		while (0u != size) {
+			const auto nb_bytes = std::min(size, m_buffer.size() - m_size);
+			std::memcpy(m_buffer.data() + m_size, data, nb_bytes);
+			m_size += nb_bytes;
+			data   += nb_bytes;
+			size   -= nb_bytes;
+
+			if (m_buffer.size() == m_size) {
+				Submit();
+			}
+		}
+	}
+
+	void FileWriter::Submit() {
+		const auto buffer_size = m_buffer.size();
+
+		FileWriterBuffer buffer;
+		{
+			std::unique_lock< std::mutex > lock(m_state->m_mutex);
+			m_state->m_condition.wait(lock, [this]() noexcept {
+				return m_state->m_nb_pending < g_max_pending_buffers;
+			});
+
+			ThrowIfFailed(m_state->m_error.empty(),
+						  "{}: {}.", m_path, m_state->m_error);
+
+			if (!m_state->m_free_buffers.empty()) {
+				buffer = std::move(m_state->m_free_buffers.back());
+				m_state->m_free_buffers.pop_back();
+			}
+
+			++m_state->m_nb_pending;
+		}
+
+		try {
+			if (buffer.size() != buffer_size) {
+				buffer.resize(buffer_size);
+			}
+
+			WriteQueue::Get().Submit(m_state, std::move(m_buffer), m_size);
+		}
+		catch (...) {
+			// The staging buffer is not pending, but its data is lost.
+			{
+				const std::lock_guard< std::mutex > lock(m_state->m_mutex);
+				--m_state->m_nb_pending;
+				if (m_state->m_error.empty()) {
+					m_state->m_error = "could not submit data";
+				}
+			}
+			m_state->m_condition.notify_all();
+
+			if (m_buffer.size() != buffer_size) {
+				m_buffer = std::move(buffer);
+			}
+			m_size = 0u;
+			throw;
+		}
+
+		m_buffer = std::move(buffer);
+		m_size   = 0u;
+	}
+}
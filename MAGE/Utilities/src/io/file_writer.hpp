@@ -0,0 +1,242 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory/allocation.hpp"
+#include "memory/memory.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 The default size (in bytes) of the staging buffers of file writers.
+	 */
+	constexpr std::size_t g_file_writer_buffer_size = 1u << 20u;
+
+	/**
+	 The alignment (in bytes) of the staging buffers of file writers.
+	 */
+	constexpr std::size_t g_file_writer_buffer_alignment = 4096u;
+
+	/**
+	 A type definition for staging buffers of file writers.
+	 */
+	using FileWriterBuffer
+		= std::vector< U8, AlignedAllocator< U8, g_file_writer_buffer_alignment > >;
+
+	namespace details {
+
+		/**
+		 A struct of file writer states shared between a file writer and the
+		 background thread writing its staging buffers.
+		 */
+		struct FileWriterState;
+	}
+
+	/**
+	 A class of buffered file writers.
+
+	 A file writer gathers the written bytes in large (aligned) staging
+	 buffers. Full staging buffers are written to the file on a background
+	 thread, so the producing thread does not wait for the disk unless all
+	 staging buffers are in flight or a flush is requested explicitly.
+	 */
+	class FileWriter {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a file writer for the file associated with the given
+		 path. The file is created or truncated.
+
+		 @param[in]		path
+						The path.
+		 @param[in]		buffer_size
+						The size (in bytes) of the staging buffers.
+		 @throws		Exception
+						Failed to open the file.
+		 */
+		explicit FileWriter(std::filesystem::path path,
+							std::size_t buffer_size = g_file_writer_buffer_size);
+
+		/**
+		 Constructs a file writer from the given file writer.
+
+		 @param[in]		writer
+						A reference to the file writer to copy.
+		 */
+		FileWriter(const FileWriter& writer) = delete;
+
+		/**
+		 Constructs a file writer by moving the given file writer.
+
+		 @param[in]		writer
+						A reference to the file writer to move.
+		 */
+		FileWriter(FileWriter&& writer) noexcept;
+
+		/**
+		 Destructs this file writer. Pending bytes are written and the file
+		 is closed; failures are logged.
+		 */
+		~FileWriter();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given file writer to this file writer.
+
+		 @param[in]		writer
+						A reference to the file writer to copy.
+		 @return		A reference to the copy of the given file writer (i.e.
+						this file writer).
+		 */
+		FileWriter& operator=(const FileWriter& writer) = delete;
+
+		/**
+		 Moves the given file writer to this file writer.
+
+		 @param[in]		writer
+						A reference to the file writer to move.
+		 @return		A reference to the moved file writer (i.e. this file
+						writer).
+		 */
+		FileWriter& operator=(FileWriter&& writer) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the path of this file writer.
+
+		 @return		A reference to the path of this file writer.
+		 */
+		[[nodiscard]]
+		const std::filesystem::path& GetPath() const noexcept {
+			return m_path;
+		}
+
+		/**
+		 Writes the given bytes.
+
+		 @param[in]		data
+						A pointer to the bytes.
+		 @param[in]		size
+						The number of bytes.
+		 @throws		Exception
+						Failed to write to the file.
+		 */
+		void Write(const void* data, std::size_t size) {
+			if (size <= m_buffer.size() - m_size) {
+				std::memcpy(m_buffer.data() + m_size, data, size);
+				m_size += size;
+				return;
+			}
+
+			WriteStaged(static_cast< const U8* >(data), size);
+		}
+
+		/**
+		 Writes the staged bytes of this file writer and waits until all
+		 bytes are written to the file.
+
+		 @throws		Exception
+						Failed to write to the file.
+		 */
+		void Flush();
+
+		/**
+		 Flushes this file writer and the file buffers of the operating
+		 system (i.e. all bytes are written to the disk).
+
+		 @throws		Exception
+						Failed to write to the file.
+		 */
+		void Sync();
+
+		/**
+		 Flushes and closes this file writer.
+
+		 @throws		Exception
+						Failed to write to the file.
+		 */
+		void Close();
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Writes the given bytes not fitting in the staging buffer of this
+		 file writer.
+
+		 @param[in]		data
+						A pointer to the bytes.
+		 @param[in]		size
+						The number of bytes.
+		 @throws		Exception
+						Failed to write to the file.
+		 */
+		void WriteStaged(const U8* data, std::size_t size);
+
+		/**
+		 Submits the staging buffer of this file writer to the background
+		 thread and acquires a new staging buffer.
+
+		 @throws		Exception
+						Failed to write to the file.
+		 */
+		void Submit();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The path of this file writer.
+		 */
+		std::filesystem::path m_path;
+
+		/**
+		 A pointer to the state of this file writer.
+		 */
+		SharedPtr< details::FileWriterState > m_state;
+
+		/**
+		 The staging buffer of this file writer.
+		 */
+		FileWriterBuffer m_buffer;
+
+		/**
+		 The number of staged bytes of this file writer.
+		 */
+		std::size_t m_size;
+	};
+}
@@ -3,8 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\line_reader.hpp"
-#include "logging\logging.hpp"
+#include "io/line_reader.hpp"
+#include "io/mapped_file.hpp"
+#include "logging/logging.hpp"
 
 #pragma endregion
 
@@ -13,8 +14,13 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include <fstream>
-#include <sstream>
+#include <bitset>
+#include <cstring>
+#include <emmintrin.h>
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif // _MSC_VER
 
 #pragma endregion
 
@@ -23,73 +29,227 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
-	const std::regex LineReader::s_default_regex
-		= std::regex(R"((\"([^\"]*)\")|(\S+))");
+	namespace {
+
+		/**
+		 Checks whether the given character is a whitespace character
+		 (@c ' ', @c '\\t', @c '\\n', @c '\\v', @c '\\f' or @c '\\r').
+
+		 @param[in]		c
+						The character.
+		 @return		@c true if the given character is a whitespace
+						character. @c false otherwise.
+		 */
+		[[nodiscard]]
+		inline bool IsWhitespace(char c) noexcept {
+			return (' ' == c) || (static_cast< U8 >(c - '\t') <= 4u);
+		}
+
+		/**
+		 Returns a bit mask of the newline characters of the given 16
+		 characters.
+
+		 @param[in]		chars
+						The 16 characters.
+		 @return		A bit mask of the newline characters.
+		 */
+		[[nodiscard]]
+		inline int NewlineMask(__m128i chars) noexcept {
+			return _mm_movemask_epi8(_mm_cmpeq_epi8(chars, _mm_set1_epi8('\n')));
+		}
+
+		/**
+		 Returns a bit mask of the whitespace characters of the given 16
+		 characters.
+
+		 @param[in]		chars
+						The 16 characters.
+		 @return		A bit mask of the whitespace characters.
+		 */
+		[[nodiscard]]
+		inline int WhitespaceMask(__m128i chars) noexcept {
+			// '\t', '\n', '\v', '\f' and '\r' are contiguous: c - '\t' <= 4
+			// (unsigned).
+			const auto offset = _mm_sub_epi8(chars, _mm_set1_epi8('\t'));
+			const auto control
+				= _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(4)), offset);
+			const auto space = _mm_cmpeq_epi8(chars, _mm_set1_epi8(' '));
+			return _mm_movemask_epi8(_mm_or_si128(control, space));
+		}
+
+		/**
+		 Returns the index of the least significant set bit of the given
+		 (non-zero) mask.
+
+		 @param[in]		mask
+						The mask.
+		 @return		The index of the least significant set bit of the
+						given mask.
+		 */
+		[[nodiscard]]
+		inline std::size_t FirstBit(int mask) noexcept {
+			#ifdef _MSC_VER
+			unsigned long index;
+			_BitScanForward(&index, static_cast< unsigned long >(mask));
+			return static_cast< std::size_t >(index);
+			#else  // _MSC_VER
+			return static_cast< std::size_t >(__builtin_ctz(
+				static_cast< unsigned int >(mask)));
+			#endif // _MSC_VER
+		}
+
+		/**
+		 Finds the first newline character in the given range.
 
-	const LineReader::SelectionFunction LineReader::s_default_selection_function
-		= [](const std::smatch& match) {
-		return match[2].length() ? match[2] : match[3];
-	};
+		 @param[in]		first
+						A pointer to the first character.
+		 @param[in]		last
+						A pointer past the last character.
+		 @return		A pointer to the first newline character in the given
+						range. @a last if not found.
+		 */
+		[[nodiscard]]
+		const char* FindNewline(const char* first, const char* last) noexcept {
+			for (; 16 <= last - first; first += 16) {
+				const auto chars = _mm_loadu_si128(
+					reinterpret_cast< const __m128i* >(first));
+				if (const auto mask = NewlineMask(chars); 0 != mask) {
+					return first + FirstBit(mask);
+				}
+			}
+
+			for (; first != last && '\n' != *first; ++first) {}
+			return first;
+		}
+
+		/**
+		 Counts the newline characters in the given range.
+
+		 @param[in]		first
+						A pointer to the first character.
+		 @param[in]		last
+						A pointer past the last character.
+		 @return		The number of newline characters in the given range.
+		 */
+		[[nodiscard]]
+		std::size_t CountNewlines(const char* first, const char* last) noexcept {
+			std::size_t count = 0u;
+
+			for (; 16 <= last - first; first += 16) {
+				const auto chars = _mm_loadu_si128(
+					reinterpret_cast< const __m128i* >(first));
+				const auto mask = static_cast< unsigned long >(NewlineMask(chars));
+				count += std::bitset< 16 >(mask).count();
+			}
+
+			for (; first != last; ++first) {
+				count += ('\n' == *first) ? 1u : 0u;
+			}
+			return count;
+		}
+
+		/**
+		 Finds the first whitespace character in the given range.
+
+		 @param[in]		first
+						A pointer to the first character.
+		 @param[in]		last
+						A pointer past the last character.
+		 @return		A pointer to the first whitespace character in the
+						given range. @a last if not found.
+		 */
+		[[nodiscard]]
+		const char* FindWhitespace(const char* first, const char* last) noexcept {
+			for (; 16 <= last - first; first += 16) {
+				const auto chars = _mm_loadu_si128(
+					reinterpret_cast< const __m128i* >(first));
+				if (const auto mask = WhitespaceMask(chars); 0 != mask) {
+					return first + FirstBit(mask);
+				}
+			}
+
+			for (; first != last && !IsWhitespace(*first); ++first) {}
+			return first;
+		}
+
+		/**
+		 Finds the first non-whitespace character in the given range.
+
+		 @param[in]		first
+						A pointer to the first character.
+		 @param[in]		last
+						A pointer past the last character.
+		 @return		A pointer to the first non-whitespace character in the
+						given range. @a last if not found.
+		 */
+		[[nodiscard]]
+		const char* SkipWhitespace(const char* first, const char* last) noexcept {
+			// Tokens are mostly separated by a single delimiter.
+			for (; first != last && IsWhitespace(*first); ++first) {}
+			return first;
+		}
+	}
 
 	LineReader::LineReader()
-		: m_regex(),
-		m_selection_function(),
-		m_path(),
-		m_iterator(),
-		m_line_number(0) {}
-
-	LineReader::LineReader(LineReader&& reader) noexcept
-		: m_regex(std::move(reader.m_regex)),
-		m_selection_function(std::move(reader.m_selection_function)),
-		m_path(std::move(reader.m_path)),
-		m_iterator(reader.m_iterator),
-		m_line_number(reader.m_line_number) {}
+		: m_path(),
+		m_input(),
+		m_line_begin(nullptr),
+		m_line_end(nullptr),
+		m_pos(nullptr),
+		m_token(),
+		m_line_number_pos(nullptr),
+		m_line_number(0u) {}
+
+	LineReader::LineReader(LineReader&& reader) noexcept = default;
 
 	LineReader::~LineReader() = default;
 
-	LineReader& LineReader::operator=(LineReader&& reader) noexcept {
-		m_regex              = std::move(reader.m_regex);
-		m_selection_function = std::move(reader.m_selection_function);
-		m_path               = std::move(reader.m_path);
-		m_iterator           = reader.m_iterator;
-		m_line_number        = reader.m_line_number;
-		return *this;
-	}
+	LineReader& LineReader::operator=(LineReader&& reader) noexcept = default;
 
-	void LineReader::ReadFromFile(std::filesystem::path path,
-								  std::regex regex,
-								  SelectionFunction selection_function) {
+	void LineReader::ReadFromFile(std::filesystem::path path) {
+		m_path = std::move(path);
 
-		m_path               = std::move(path);
-		m_regex              = std::move(regex);
-		m_selection_function = std::move(selection_function);
+		// Preprocessing
+		Preprocess();
+
+		// Processing
+		{
+			// The file is mapped instead of copied.
+			const MappedFile file(m_path);
+			const std::string_view input(
+				reinterpret_cast< const char* >(file.GetData().data()),
+				file.size());
+			Process(input, input.data());
+		}
+
+		// Postprocessing
+		Postprocess();
+	}
+
+	void LineReader::ReadFromMemory(std::string_view input) {
+		m_path = L"input string";
 
 		// Preprocessing
 		Preprocess();
 
 		// Processing
-		std::ifstream stream(m_path.c_str());
-		ThrowIfFailed(stream.is_open(), "{}: could not open file.", m_path);
-		Process(stream);
+		Process(input, input.data());
 
 		// Postprocessing
 		Postprocess();
 	}
 
-	void LineReader::ReadFromMemory(const std::string &input,
-									std::regex regex,
-									SelectionFunction selection_function) {
+	void LineReader::ReadChunkFromMemory(std::string_view input,
+										 std::string_view chunk,
+										 std::filesystem::path path) {
 
-		m_path               = L"input string";
-		m_regex              = std::move(regex);
-		m_selection_function = std::move(selection_function);
+		m_path = std::move(path);
 
 		// Preprocessing
 		Preprocess();
 
 		// Processing
-		std::istringstream stream(input);
-		Process(stream);
+		Process(chunk, input.data());
 
 		// Postprocessing
 		Postprocess();
@@ -97,24 +257,48 @@ namespace mage {
 
 	void LineReader::Preprocess() {}
 
-	void LineReader::Process(std::istream& stream) {
-		m_line_number = 0u;
+	void LineReader::Process(std::string_view input, const char* origin) {
+		m_input           = input;
+		m_line_number_pos = origin;
+		m_line_number     = 0u;
+
+		const auto end = input.data() + input.size();
+		for (auto line_begin = input.data(); line_begin != end;) {
+			m_line_begin = line_begin;
+			m_line_end   = FindNewline(line_begin, end);
+			m_pos        = line_begin;
 
-		std::string line;
-		while (std::getline(stream, line)) {
-			m_iterator = std::sregex_iterator(line.cbegin(), line.cend(), m_regex);
+			NextToken();
 			if (ContainsTokens()) {
 				ReadLine();
 			}
 
-			++m_line_number;
+			line_begin = (m_line_end == end) ? end : m_line_end + 1;
 		}
 
-		m_iterator = {};
+		m_input           = {};
+		m_line_begin      = nullptr;
+		m_line_end        = nullptr;
+		m_pos             = nullptr;
+		m_token           = {};
+		m_line_number_pos = nullptr;
 	}
 
 	void LineReader::Postprocess() {}
 
+	[[nodiscard]]
+	U32 LineReader::GetCurrentLineNumber() const noexcept {
+		// Lines are processed in order: only count the newline characters
+		// since the last query.
+		if (m_line_number_pos < m_line_begin) {
+			m_line_number += static_cast< U32 >(
+				CountNewlines(m_line_number_pos, m_line_begin));
+			m_line_number_pos = m_line_begin;
+		}
+
+		return m_line_number;
+	}
+
 	void LineReader::ReadRemainingTokens() {
 		while (ContainsTokens()) {
 			const auto token = Read< std::string_view >();
@@ -125,19 +309,34 @@ namespace mage {
 
 	[[nodiscard]]
 	bool LineReader::ContainsTokens() const noexcept {
-		static const std::sregex_iterator end_iterator;
-		return end_iterator != m_iterator;
+		return nullptr != m_token.data();
 	}
 
-	[[nodiscard]]
-	const std::string_view LineReader::GetCurrentToken() const noexcept {
-		const auto token = m_selection_function(*m_iterator);
-		if (token.matched) {
-			return { &*token.first,
-				     static_cast< std::size_t >(token.second - token.first) };
+	void LineReader::NextToken() noexcept {
+		const auto first = SkipWhitespace(m_pos, m_line_end);
+		if (first == m_line_end) {
+			m_pos   = m_line_end;
+			m_token = {};
+			return;
 		}
-		else {
-			return {};
+
+		// Quoted strings: "([^"]*)"
+		if ('"' == *first) {
+			const auto str_first = first + 1;
+			const auto str_last  = static_cast< const char* >(
+				std::memchr(str_first, '"',
+							static_cast< std::size_t >(m_line_end - str_first)));
+			if (nullptr != str_last) {
+				m_pos   = str_last + 1;
+				m_token = { str_first,
+					        static_cast< std::size_t >(str_last - str_first) };
+				return;
+			}
 		}
+
+		// Non-whitespace strings: \S+
+		const auto last = FindWhitespace(first, m_line_end);
+		m_pos   = last;
+		m_token = { first, static_cast< std::size_t >(last - first) };
 	}
 }
@@ -5,7 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "exception\exception.hpp"
+#include "exception/exception.hpp"
+#include "memory/memory.hpp"
 
 #pragma endregion
 
@@ -14,8 +15,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include <istream>
-#include <regex>
+#include <string_view>
 
 #pragma endregion
 
@@ -31,31 +31,6 @@ namespace mage {
 
 	public:
 
-		//---------------------------------------------------------------------
-		// Class Member Types
-		//---------------------------------------------------------------------
-
-		/**
-		 The selection function type for extracting one @a std::ssub_match from
-		 a given @a std::smatch.
-		 */
-		using SelectionFunction
-			= std::function< const std::ssub_match(const std::smatch&) >;
-
-		//---------------------------------------------------------------------
-		// Class Member Variables
-		//---------------------------------------------------------------------
-
-		/**
-		 The default (line) regex for line readers.
-		 */
-		static const std::regex s_default_regex;
-
-		/**
-		 The default selection function for line readers.
-		 */
-		static const SelectionFunction s_default_selection_function;
-
 		//---------------------------------------------------------------------
 		// Assignment Operators
 		//---------------------------------------------------------------------
@@ -89,34 +64,20 @@ namespace mage {
 
 		 @param[in]		path
 						The path.
-		 @param[in]		regex
-						The (line) regex.
-		 @param[in]		selection_function
-						The selection function.
 		 @throws		Exception
 						Failed to read from the file.
 		 */
-		void ReadFromFile(std::filesystem::path path,
-						  std::regex regex = s_default_regex,
-						  SelectionFunction selection_function
-						  = s_default_selection_function);
+		void ReadFromFile(std::filesystem::path path);
 
 		/**
 		 Reads from the given input string.
 
 		 @param[in]		input
-						A reference to the input string.
-		 @param[in]		regex
-						The (line) regex.
-		 @param[in]		selection_function
-						The selection function.
+						The input string.
 		 @throws		Exception
 						Failed to read from the given input string.
 		 */
-		void ReadFromMemory(const std::string &input,
-							std::regex regex = s_default_regex,
-							SelectionFunction selection_function
-							= s_default_selection_function);
+		void ReadFromMemory(std::string_view input);
 
 	protected:
 
@@ -154,6 +115,27 @@ namespace mage {
 		// Member Methods
 		//---------------------------------------------------------------------
 
+		/**
+		 Reads the given chunk of the given input buffer. Line numbers are
+		 reported relative to the beginning of the input buffer, which allows
+		 chunks of the same input buffer to be read concurrently by different
+		 line readers.
+
+		 @pre			@a chunk is a subrange of @a input.
+		 @param[in]		input
+						The input buffer.
+		 @param[in]		chunk
+						The chunk of the input buffer to read. The chunk must
+						begin at the beginning of a line.
+		 @param[in]		path
+						The path of the input buffer.
+		 @throws		Exception
+						Failed to read from the given chunk.
+		 */
+		void ReadChunkFromMemory(std::string_view input,
+								 std::string_view chunk,
+								 std::filesystem::path path);
+
 		/**
 		 Returns the current path of this line reader.
 
@@ -170,9 +152,7 @@ namespace mage {
 		 @return		The current line number of this line reader.
 		 */
 		[[nodiscard]]
-		U32 GetCurrentLineNumber() const noexcept {
-			return m_line_number;
-		}
+		U32 GetCurrentLineNumber() const noexcept;
 
 		/**
 		 Reads and converts the current token of this line reader to
@@ -249,14 +229,17 @@ namespace mage {
 		virtual void Preprocess();
 
 		/**
-		 Processes the given input stream (line by line).
+		 Processes the given input buffer (line by line).
 
-		 @param[in]		stream
-						A reference to the input stream.
+		 @param[in]		input
+						The input buffer.
+		 @param[in]		origin
+						A pointer to the first character of the first line
+						(i.e. line number zero).
 		 @throws		Exception
-						Failed to process the given input stream.
+						Failed to process the given input buffer.
 		 */
-		void Process(std::istream& stream);
+		void Process(std::string_view input, const char* origin);
 
 		/**
 		 Reads the current line of this line reader.
@@ -280,38 +263,62 @@ namespace mage {
 		 @return		The current token of this line reader.
 		 */
 		[[nodiscard]]
-		const std::string_view GetCurrentToken() const noexcept;
+		const std::string_view GetCurrentToken() const noexcept {
+			return m_token;
+		}
+
+		/**
+		 Advances to the next token of the current line of this line reader.
+		 */
+		void NextToken() noexcept;
 
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
 
 		/**
-		 The current (line) regex of this line reader.
+		 The current path of this line reader.
 		 */
-		std::regex m_regex;
+		std::filesystem::path m_path;
 
 		/**
-		 The function for selecting the target submatch from the match of the
-		 regular expression represented by the regex of this strategy.
+		 The input buffer of this line reader.
 		 */
-		SelectionFunction m_selection_function;
+		std::string_view m_input;
 
 		/**
-		 The current path of this line reader.
+		 A pointer to the beginning of the current line of this line reader.
 		 */
-		std::filesystem::path m_path;
+		const char* m_line_begin;
+
+		/**
+		 A pointer to the end of the current line of this line reader.
+		 */
+		const char* m_line_end;
+
+		/**
+		 A pointer to the first unprocessed character of the current line of
+		 this line reader.
+		 */
+		const char* m_pos;
+
+		/**
+		 The current token of this line reader. The current token does not
+		 exist if its data is @c nullptr (an empty quoted string is a valid
+		 token).
+		 */
+		std::string_view m_token;
 
 		/**
-		 An iterator to the current token of the current line of this line
-		 reader.
+		 A pointer to the beginning of the line whose line number is cached
+		 by this line reader. Line numbers are only computed on demand.
 		 */
-		std::sregex_iterator m_iterator;
+		mutable const char* m_line_number_pos;
 
 		/**
-		 The current line number of this line reader.
+		 The cached line number of this line reader.
 		 */
-		U32 m_line_number;
+		mutable U32 m_line_number;
 	};
 }
 
@@ -320,6 +327,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\line_reader.tpp"
+#include "io/line_reader.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -17,7 +17,7 @@ namespace mage {
 		if (const auto result = StringTo< T >(token);
 		    bool(result)) {
 
-			++m_iterator;
+			NextToken();
 			return *result;
 		}
 		else {
@@ -35,7 +35,7 @@ namespace mage {
 
 		const auto result = GetCurrentToken();
 
-		++m_iterator;
+		NextToken();
 		return result;
 	}
 
@@ -0,0 +1,143 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io/mapped_file.hpp"
+#include "io/archive.hpp"
+#include "exception/exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#ifndef _WIN32
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif // _WIN32
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	MappedFile::MappedFile(const std::filesystem::path& path, bool archived)
+		: m_view(),
+		m_owner(),
+		m_data(nullptr),
+		m_size(0u) {
+
+		if (archived) {
+			if (auto file = OpenArchivedFile(path)) {
+				*this = std::move(*file);
+				return;
+			}
+		}
+
+		#ifdef _WIN32
+
+		const auto file_handle
+			= CreateUniqueHandle(CreateFile2(path.c_str(),
+											 GENERIC_READ,
+											 FILE_SHARE_READ,
+											 OPEN_EXISTING,
+											 nullptr));
+		ThrowIfFailed((nullptr != file_handle),
+					  "{}: could not open file.", path);
+
+		LARGE_INTEGER file_size;
+		{
+			const BOOL result = GetFileSizeEx(file_handle.get(), &file_size);
+			ThrowIfFailed(result, "{}: could not retrieve file size.", path);
+		}
+
+		m_size = static_cast< std::size_t >(file_size.QuadPart);
+		ThrowIfFailed((static_cast< U64 >(m_size)
+					   == static_cast< U64 >(file_size.QuadPart)),
+					  "{}: file too big for address space.", path);
+
+		if (0u == m_size) {
+			// Empty files cannot be mapped.
+			return;
+		}
+
+		m_mapping = CreateUniqueHandle(CreateFileMapping(file_handle.get(),
+														 nullptr,
+														 PAGE_READONLY,
+														 0u, 0u,
+														 nullptr));
+		ThrowIfFailed((nullptr != m_mapping),
+					  "{}: could not create file mapping.", path);
+
+		m_view.reset(static_cast< const U8* >(
+			MapViewOfFile(m_mapping.get(), FILE_MAP_READ, 0u, 0u, 0u)));
+		ThrowIfFailed((nullptr != m_view),
+					  "{}: could not map view of file.", path);
+
+		m_data = m_view.get();
+
+		#else  // _WIN32
+
+		const int file_descriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+		ThrowIfFailed((-1 != file_descriptor),
+					  "{}: could not open file.", path);
+		const auto file_closer = gsl::finally([file_descriptor]() noexcept {
+			close(file_descriptor);
+		});
+
+		struct stat file_status;
+		ThrowIfFailed((0 == fstat(file_descriptor, &file_status)),
+					  "{}: could not retrieve file size.", path);
+
+		m_size = static_cast< std::size_t >(file_status.st_size);
+		ThrowIfFailed((static_cast< U64 >(m_size)
+					   == static_cast< U64 >(file_status.st_size)),
+					  "{}: file too big for address space.", path);
+
+		if (0u == m_size) {
+			// Empty files cannot be mapped.
+			return;
+		}
+
+		// The view keeps the file mapped after its descriptor is closed.
+		void* const view = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE,
+								file_descriptor, 0);
+		ThrowIfFailed((MAP_FAILED != view),
+					  "{}: could not map view of file.", path);
+
+		m_view = UniquePtr< const U8, ViewUnmapper >(
+			static_cast< const U8* >(view), ViewUnmapper{ m_size });
+
+		m_data = m_view.get();
+
+		#endif // _WIN32
+	}
+
+	MappedFile::MappedFile(gsl::span< const U8 > data,
+						   SharedPtr< const void > owner) noexcept
+		: m_view(),
+		m_owner(std::move(owner)),
+		m_data(data.data()),
+		m_size(static_cast< std::size_t >(data.size())) {}
+
+	MappedFile::MappedFile(MappedFile&& file) noexcept = default;
+
+	MappedFile::~MappedFile() = default;
+
+	MappedFile& MappedFile::operator=(MappedFile&& file) noexcept = default;
+
+	void MappedFile::ViewUnmapper::operator()(const U8* view) const noexcept {
+		#ifdef _WIN32
+		UnmapViewOfFile(view);
+		#else  // _WIN32
+		munmap(const_cast< U8* >(view), m_size);
+		#endif // _WIN32
+	}
+}
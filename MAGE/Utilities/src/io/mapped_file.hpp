@@ -0,0 +1,197 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory/memory.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of read-only memory-mapped files.
+	 */
+	class MappedFile {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a mapped file for the file associated with the given path.
+
+		 @param[in]		path
+						A reference to the path.
+		 @param[in]		archived
+						A flag indicating whether the mounted archives need
+						to be searched before the file system.
+		 @throws		Exception
+						Failed to map the file.
+		 */
+		explicit MappedFile(const std::filesystem::path& path,
+							bool archived = true);
+
+		/**
+		 Constructs a mapped file for the given data.
+
+		 @param[in]		data
+						The data.
+		 @param[in]		owner
+						A pointer to the owner of the given data which is
+						kept alive as long as this mapped file.
+		 */
+		explicit MappedFile(gsl::span< const U8 > data,
+							SharedPtr< const void > owner) noexcept;
+
+		/**
+		 Constructs a mapped file from the given mapped file.
+
+		 @param[in]		file
+						A reference to the mapped file to copy.
+		 */
+		MappedFile(const MappedFile& file) = delete;
+
+		/**
+		 Constructs a mapped file by moving the given mapped file.
+
+		 @param[in]		file
+						A reference to the mapped file to move.
+		 */
+		MappedFile(MappedFile&& file) noexcept;
+
+		/**
+		 Destructs this mapped file.
+		 */
+		~MappedFile();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given mapped file to this mapped file.
+
+		 @param[in]		file
+						A reference to the mapped file to copy.
+		 @return		A reference to the copy of the given mapped file (i.e.
+						this mapped file).
+		 */
+		MappedFile& operator=(const MappedFile& file) = delete;
+
+		/**
+		 Moves the given mapped file to this mapped file.
+
+		 @param[in]		file
+						A reference to the mapped file to move.
+		 @return		A reference to the moved mapped file (i.e. this mapped
+						file).
+		 */
+		MappedFile& operator=(MappedFile&& file) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the data of this mapped file.
+
+		 @return		The data of this mapped file.
+		 */
+		[[nodiscard]]
+		gsl::span< const U8 > GetData() const noexcept {
+			return gsl::make_span(m_data,
+								  static_cast< std::ptrdiff_t >(m_size));
+		}
+
+		/**
+		 Returns the size (in bytes) of this mapped file.
+
+		 @return		The size (in bytes) of this mapped file.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_size;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of view destructors (i.e. for unmapping views).
+		 */
+		struct ViewUnmapper {
+
+			/**
+			 Unmaps the given view.
+
+			 @param[in]		view
+							A pointer to the view to unmap.
+			 */
+			void operator()(const U8* view) const noexcept;
+
+			#ifndef _WIN32
+
+			/**
+			 The size (in bytes) of the view to unmap.
+			 */
+			std::size_t m_size;
+
+			#endif // _WIN32
+		};
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		#ifdef _WIN32
+
+		/**
+		 A handle to the file mapping of this mapped file.
+		 */
+		UniqueHandle m_mapping;
+
+		#endif // _WIN32
+
+		/**
+		 A pointer to the view of this mapped file.
+		 */
+		UniquePtr< const U8, ViewUnmapper > m_view;
+
+		/**
+		 A pointer to the owner of the data of this mapped file (i.e. an
+		 archive or a decompression buffer) if this mapped file does not own
+		 a view.
+		 */
+		SharedPtr< const void > m_owner;
+
+		/**
+		 A pointer to the data of this mapped file.
+		 */
+		const U8* m_data;
+
+		/**
+		 The size (in bytes) of this mapped file.
+		 */
+		std::size_t m_size;
+	};
+}
@@ -3,8 +3,17 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\writer.hpp"
-#include "exception\exception.hpp"
+#include "io/writer.hpp"
+#include "exception/exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
 
 #pragma endregion
 
@@ -14,7 +23,7 @@
 namespace mage {
 
 	Writer::Writer()
-		: m_file_stream(nullptr),
+		: m_file_writer(),
 		m_path() {}
 
 	Writer::Writer(Writer&& writer) noexcept = default;
@@ -26,27 +35,44 @@ namespace mage {
 	void Writer::WriteToFile(std::filesystem::path path) {
 		m_path = std::move(path);
 
-		std::FILE* file;
-		{
-			const errno_t result = _wfopen_s(&file, m_path.c_str(), L"w");
-			ThrowIfFailed((0 == result), "{}: could not open file.", m_path);
-		}
-
-		m_file_stream.reset(file);
+		m_file_writer.emplace(m_path);
 
 		Write();
+
+		m_file_writer->Close();
+		m_file_writer.reset();
+	}
+
+	void Writer::Flush() {
+		m_file_writer->Flush();
+	}
+
+	void Writer::Sync() {
+		m_file_writer->Sync();
 	}
 
 	void Writer::WriteCharacter(char c) {
-		const int result = std::fputc(c, m_file_stream.get());
-		ThrowIfFailed((EOF != result),
-					  "{}: could not write to file.", GetPath());
+		// Line endings are translated as by text mode streams.
+		if ('\n' == c) {
+			m_file_writer->Write("\r\n", 2u);
+		}
+		else {
+			m_file_writer->Write(&c, 1u);
+		}
 	}
 
 	void Writer::WriteString(NotNull< const_zstring > str) {
-		const int result = std::fputs(str, m_file_stream.get());
-		ThrowIfFailed((EOF != result),
-					  "{}: could not write to file.", GetPath());
+		// Line endings are translated as by text mode streams.
+		for (const_zstring first = str; '\0' != *first;) {
+			const auto last = first + std::strcspn(first, "\n");
+			m_file_writer->Write(first, static_cast< std::size_t >(last - first));
+			if ('\0' == *last) {
+				break;
+			}
+
+			m_file_writer->Write("\r\n", 2u);
+			first = last + 1;
+		}
 	}
 
 	void Writer::WriteStringLine(NotNull< const_zstring > str) {
@@ -5,7 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "io/file_writer.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -15,6 +16,7 @@
 #pragma region
 
 #include <filesystem>
+#include <optional>
 
 #pragma endregion
 
@@ -113,6 +115,24 @@ namespace mage {
 			return m_path;
 		}
 
+		/**
+		 Writes the buffered data of this writer to the file and waits
+		 until it is written.
+
+		 @throws		Exception
+						Failed to write to the file.
+		 */
+		void Flush();
+
+		/**
+		 Flushes this writer and the file buffers of the operating system
+		 (i.e. all data is written to the disk).
+
+		 @throws		Exception
+						Failed to write to the file.
+		 */
+		void Sync();
+
 		/**
 		 Writes the given character.
 
@@ -162,9 +182,9 @@ namespace mage {
 		//---------------------------------------------------------------------
 
 		/**
-		 A pointer to the file stream of this writer.
+		 The (buffered) file writer of this writer.
 		 */
-		UniqueFileStream m_file_stream;
+		std::optional< FileWriter > m_file_writer;
 
 		/**
 		 The current path of this writer.
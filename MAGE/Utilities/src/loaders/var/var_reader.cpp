@@ -3,9 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\var\var_reader.hpp"
-#include "loaders\var\var_tokens.hpp"
-#include "logging\logging.hpp"
+#include "loaders/var/var_reader.hpp"
+#include "loaders/var/var_tokens.hpp"
+#include "logging/logging.hpp"
 
 #pragma endregion
 
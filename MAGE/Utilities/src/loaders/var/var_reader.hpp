@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\line_reader.hpp"
-#include "resource\script\variable_value.hpp"
+#include "io/line_reader.hpp"
+#include "resource/script/variable_value.hpp"
 
 #pragma endregion
 
@@ -144,6 +144,6 @@ namespace mage::loader {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\var\var_reader.tpp"
+#include "loaders/var/var_reader.tpp"
 
 #pragma endregion
\ No newline at end of file
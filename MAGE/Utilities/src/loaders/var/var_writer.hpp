@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "io\writer.hpp"
-#include "resource\script\variable_value.hpp"
+#include "io/writer.hpp"
+#include "resource/script/variable_value.hpp"
 
 #pragma endregion
 
@@ -3,9 +3,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "loaders\variable_script_loader.hpp"
-#include "loaders\var\var_loader.hpp"
-#include "exception\exception.hpp"
+#include "loaders/variable_script_loader.hpp"
+#include "loaders/var/var_loader.hpp"
+#include "exception/exception.hpp"
 
 #pragma endregion
 
@@ -17,7 +17,7 @@ namespace mage::loader {
 	void ImportVariableScriptFromFile(const std::filesystem::path& path,
 									  ValueMap& variable_buffer) {
 
-		std::wstring extension(path.extension());
+		std::wstring extension = path.extension().wstring();
 		TransformToLowerCase(extension);
 
 		if (L".var" == extension) {
@@ -31,7 +31,7 @@ namespace mage::loader {
 	void ExportVariableScriptToFile(const std::filesystem::path& path,
 									const ValueMap& variable_buffer) {
 
-		std::wstring extension(path.extension());
+		std::wstring extension = path.extension().wstring();
 		TransformToLowerCase(extension);
 
 		if (L".var" == extension) {
@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "logging\dump.hpp"
-#include "logging\logging.hpp"
+#include "logging/dump.hpp"
+#include "logging/logging.hpp"
 
 #pragma endregion
 
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "platform\windows.hpp"
+#include "platform/windows.hpp"
 
 #pragma endregion
 
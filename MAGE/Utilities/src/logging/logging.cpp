@@ -3,8 +3,20 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "logging\logging.hpp"
-#include "exception\exception.hpp"
+#include "logging/logging.hpp"
+#include "exception/exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#ifndef _WIN32
+	#include <sys/ioctl.h>
+	#include <unistd.h>
+#endif // _WIN32
 
 #pragma endregion
 
@@ -27,6 +39,8 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	#pragma region
 
+	#ifdef _WIN32
+
 	namespace {
 
 		/**
@@ -113,5 +127,27 @@ namespace mage {
 		}
 	}
 
+	#else  // _WIN32
+
+	[[nodiscard]]
+	FU16 ConsoleWidth() {
+		// Retrieve the window size of the terminal of the standard output.
+		winsize window_size = {};
+		{
+			const int result = ioctl(STDOUT_FILENO, TIOCGWINSZ, &window_size);
+			ThrowIfFailed((0 == result),
+						  "Retrieving terminal window size failed.");
+		}
+
+		return static_cast< FU16 >(window_size.ws_col);
+	}
+
+	void InitializeConsole() {
+		// The standard streams of a process are already attached to its
+		// terminal (if any).
+	}
+
+	#endif // _WIN32
+
 	#pragma endregion
 }
\ No newline at end of file
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "string\format.hpp"
+#include "string/format.hpp"
 
 #pragma endregion
 
@@ -26,13 +26,20 @@
 // Assert definition
 // The macro NDEBUG controls whether assert statements are active or not.
 #ifdef NDEBUG
-	#define Assert(expr) (__noop)
+	#define Assert(expr) ((void)0)
 #else
 	#define Assert(expr) ((expr) ? (void)0 \
                                  : mage::Fatal("Assertion \"{}\" failed in {}, line {}", \
 									           #expr, __FILE__, __LINE__))
 #endif
 
+// Debug break definition
+#ifdef _MSC_VER
+	#define MAGE_DEBUG_BREAK() __debugbreak()
+#else
+	#define MAGE_DEBUG_BREAK() __builtin_trap()
+#endif
+
 #pragma endregion
 
 //-----------------------------------------------------------------------------
@@ -435,6 +442,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "logging\logging.tpp"
+#include "logging/logging.tpp"
 
 #pragma endregion
\ No newline at end of file
@@ -17,7 +17,7 @@ namespace mage {
 		Print("\n");
 
 		if (MessageDisposition::Abort == disposition) {
-			__debugbreak();
+			MAGE_DEBUG_BREAK();
 		}
 	}
 
@@ -33,7 +33,7 @@ namespace mage {
 		Print("\n");
 
 		if (MessageDisposition::Abort == disposition) {
-			__debugbreak();
+			MAGE_DEBUG_BREAK();
 		}
 	}
 
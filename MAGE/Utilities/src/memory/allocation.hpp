@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -14,6 +14,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include <cstdlib>
 #include <malloc.h>
 #include <new>
 
@@ -38,7 +39,13 @@ namespace mage {
 	 */
 	[[nodiscard]]
 	inline void* AllocAligned(std::size_t size, std::size_t alignment) noexcept {
+		#ifdef _MSC_VER
 		return _aligned_malloc(size, alignment);
+		#else  // _MSC_VER
+		// The size must be a multiple of the alignment.
+		return std::aligned_alloc(alignment,
+								  (size + alignment - 1u) & ~(alignment - 1u));
+		#endif // _MSC_VER
 	}
 
 	/**
@@ -73,7 +80,11 @@ namespace mage {
 			return;
 		}
 
+		#ifdef _MSC_VER
 		_aligned_free(ptr);
+		#else  // _MSC_VER
+		std::free(ptr);
+		#endif // _MSC_VER
 	}
 
 	/**
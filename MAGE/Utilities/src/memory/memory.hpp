@@ -5,7 +5,24 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "platform\windows.hpp"
+#include "type/scalar_types.hpp"
+
+#ifdef _WIN32
+	#include "platform/windows.hpp"
+#endif // _WIN32
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+#ifndef _WIN32
+	// The maximum length of a path (including the null-terminating
+	// character) of the Windows API, used for fixed-size text buffers.
+	#define MAX_PATH 260
+#endif // _WIN32
 
 #pragma endregion
 
@@ -15,9 +32,12 @@
 #pragma region
 
 #include <functional>
-#include <gsl\gsl>
+#include <gsl/gsl>
 #include <memory>
-#include <wrl.h>
+
+#ifdef _WIN32
+	#include <wrl.h>
+#endif // _WIN32
 
 #pragma endregion
 
@@ -56,6 +76,8 @@ namespace mage {
 
 	#pragma endregion
 
+	#ifdef _WIN32
+
 	//-------------------------------------------------------------------------
 	// ComPtr
 	//-------------------------------------------------------------------------
@@ -72,6 +94,8 @@ namespace mage {
 
 	#pragma endregion
 
+	#endif // _WIN32
+
 	//-------------------------------------------------------------------------
 	// SharedPtr
 	//-------------------------------------------------------------------------
@@ -230,6 +254,8 @@ namespace mage {
 
 	#pragma endregion
 
+	#ifdef _WIN32
+
 	//-------------------------------------------------------------------------
 	// UniqueHandle and SharedHandle
 	//-------------------------------------------------------------------------
@@ -316,6 +342,8 @@ namespace mage {
 
 	#pragma endregion
 
+	#endif // _WIN32
+
 	//-------------------------------------------------------------------------
 	// UniqueFileStream
 	//-------------------------------------------------------------------------
@@ -766,6 +794,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "memory\memory.tpp"
+#include "memory/memory.tpp"
 
 #pragma endregion
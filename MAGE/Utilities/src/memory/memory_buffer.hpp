@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "collection\dynamic_array.hpp"
+#include "collection/dynamic_array.hpp"
 
 #pragma endregion
 
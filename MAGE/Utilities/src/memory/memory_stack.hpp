@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -1283,6 +1283,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "memory\memory_stack.tpp"
+#include "memory/memory_stack.tpp"
 
 #pragma endregion
\ No newline at end of file
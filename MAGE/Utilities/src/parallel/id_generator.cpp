@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "parallel\id_generator.hpp"
+#include "parallel/id_generator.hpp"
 
 #pragma endregion
 
@@ -3,8 +3,25 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "exception\exception.hpp"
-#include "parallel\parallel.hpp"
+#include "exception/exception.hpp"
+#include "parallel/parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif // _MSC_VER
+
+#ifndef _WIN32
+	#include <algorithm>
+	#include <thread>
+	#include <unistd.h>
+#endif // _WIN32
 
 #pragma endregion
 
@@ -13,6 +30,8 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	#ifdef _WIN32
+
 	[[nodiscard]]
 	FU16 NumberOfPhysicalCores() {
 		DWORD length = 0u;
@@ -60,4 +79,59 @@ namespace mage {
 		// Return the number of logical processors in the current group.
 		return static_cast< FU16 >(system_info.dwNumberOfProcessors);
 	}
+
+	#else  // _WIN32
+
+	[[nodiscard]]
+	FU16 NumberOfPhysicalCores() {
+		// There is no portable query for the number of physical cores.
+		const auto nb_cores = std::thread::hardware_concurrency();
+		ThrowIfFailed((0u != nb_cores),
+					  "Retrieving processor information failed.");
+		return static_cast< FU16 >(nb_cores);
+	}
+
+	[[nodiscard]]
+	FU16 NumberOfSystemCores() noexcept {
+		const auto nb_cores = sysconf(_SC_NPROCESSORS_ONLN);
+		return static_cast< FU16 >(std::max(nb_cores, 1l));
+	}
+
+	#endif // _WIN32
+
+	[[nodiscard]]
+	bool SupportsAVX2() noexcept {
+		#ifdef _MSC_VER
+		static const bool s_supports_avx2 = []() noexcept {
+			int info[4] = {};
+
+			__cpuid(info, 0);
+			if (info[0] < 7) {
+				return false;
+			}
+
+			// FMA3 (bit 12), OSXSAVE (bit 27) and AVX (bit 28).
+			__cpuid(info, 1);
+			constexpr int avx_mask = (1 << 12) | (1 << 27) | (1 << 28);
+			if (avx_mask != (info[2] & avx_mask)) {
+				return false;
+			}
+
+			// The operating system must save the XMM and YMM registers.
+			if (0x6u != (_xgetbv(0) & 0x6u)) {
+				return false;
+			}
+
+			// AVX2 (bit 5).
+			__cpuidex(info, 7, 0);
+			return 0 != (info[1] & (1 << 5));
+		}();
+		#else  // _MSC_VER
+		// Checks the support of the operating system as well.
+		static const bool s_supports_avx2
+			= __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+		#endif // _MSC_VER
+
+		return s_supports_avx2;
+	}
 }
@@ -5,7 +5,41 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "type/types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+// AVX2 (and FMA3) target definition
+// MSVC accepts AVX2 intrinsics in any function. GCC and Clang only accept
+// them in functions compiled for these instruction sets. The flatten
+// attribute inlines the (target-agnostic) kernels and lanes called by such a
+// function into it, so they are compiled for these instruction sets as well.
+#if defined(__GNUC__) && !defined(_MSC_VER)
+	#define MAGE_TARGET_AVX2 __attribute__((target("avx2,fma")))
+	#define MAGE_TARGET_AVX2_FLATTEN __attribute__((target("avx2,fma"), flatten))
+#else
+	#define MAGE_TARGET_AVX2
+	#define MAGE_TARGET_AVX2_FLATTEN
+#endif
 
 #pragma endregion
 
@@ -29,4 +63,60 @@ namespace mage {
 	 */
 	[[nodiscard]]
 	FU16 NumberOfSystemCores() noexcept;
-}
\ No newline at end of file
+
+	/**
+	 Checks whether the processor and the operating system support AVX2
+	 instructions (including FMA3).
+
+	 @return		@c true if the processor and the operating system
+					support AVX2 instructions. @c false otherwise.
+	 */
+	[[nodiscard]]
+	bool SupportsAVX2() noexcept;
+
+	/**
+	 Runs the given worker on the given number of threads (including the
+	 calling thread) and waits for all of them to finish.
+
+	 If the calling thread is itself a worker of an enclosing call, the
+	 worker only runs on the calling thread to avoid oversubscribing the
+	 system cores with nested thread pools.
+
+	 The first exception thrown by a worker is rethrown on the calling
+	 thread after all threads finished.
+
+	 @tparam		WorkerT
+					The worker type.
+	 @param[in]		nb_threads
+					The number of threads.
+	 @param[in]		worker
+					A reference to the worker. The worker is invoked once
+					per thread.
+	 */
+	template< typename WorkerT >
+	void RunParallel(std::size_t nb_threads, WorkerT&& worker);
+
+	/**
+	 Applies the given action to each index in [0, @a count) using the
+	 system cores.
+
+	 @tparam		ActionT
+					The action type.
+	 @param[in]		count
+					The number of indices.
+	 @param[in]		action
+					A reference to the action. The action is invoked with
+					each index exactly once, in no particular order.
+	 */
+	template< typename ActionT >
+	void ForEachParallel(std::size_t count, ActionT&& action);
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel/parallel.tpp"
+
+#pragma endregion
@@ -0,0 +1,82 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace details {
+
+		/**
+		 Flag indicating whether the current thread is a worker of
+		 @c RunParallel.
+		 */
+		inline thread_local bool g_parallel_worker = false;
+	}
+
+	template< typename WorkerT >
+	void RunParallel(std::size_t nb_threads, WorkerT&& worker) {
+		// Nested calls run on the calling thread only.
+		if (details::g_parallel_worker || nb_threads <= 1u) {
+			worker();
+			return;
+		}
+
+		std::exception_ptr exception;
+		std::mutex exception_mutex;
+
+		const auto run = [&worker, &exception, &exception_mutex]() {
+			details::g_parallel_worker = true;
+			try {
+				worker();
+			}
+			catch (...) {
+				const std::lock_guard< std::mutex > lock(exception_mutex);
+				if (!exception) {
+					exception = std::current_exception();
+				}
+			}
+			details::g_parallel_worker = false;
+		};
+
+		std::vector< std::thread > threads;
+		const auto join = [&threads]() {
+			for (auto& thread : threads) {
+				thread.join();
+			}
+		};
+
+		try {
+			threads.reserve(nb_threads - 1u);
+			for (std::size_t i = 1u; i < nb_threads; ++i) {
+				threads.emplace_back(run);
+			}
+		}
+		catch (...) {
+			// Joinable threads must not be destructed.
+			join();
+			throw;
+		}
+		run();
+
+		join();
+
+		if (exception) {
+			std::rethrow_exception(exception);
+		}
+	}
+
+	template< typename ActionT >
+	void ForEachParallel(std::size_t count, ActionT&& action) {
+		std::atomic< std::size_t > next_index = 0u;
+
+		const auto nb_threads = std::min(
+			static_cast< std::size_t >(NumberOfSystemCores()), count);
+
+		RunParallel(nb_threads, [&action, &next_index, count]() {
+			for (auto index = next_index++; index < count; index = next_index++) {
+				action(index);
+			}
+		});
+	}
+}
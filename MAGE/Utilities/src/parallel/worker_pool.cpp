@@ -0,0 +1,233 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel/worker_pool.hpp"
+#include "parallel/parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <condition_variable>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace details {
+
+		struct WorkerPoolState {
+
+		public:
+
+			/**
+			 Runs the current worker on the calling thread and stores the
+			 first exception thrown by a worker.
+			 */
+			void RunCurrentWorker() noexcept {
+				const auto enclosing = g_parallel_worker;
+				g_parallel_worker = true;
+				try {
+					(*m_worker)();
+				}
+				catch (...) {
+					const std::lock_guard< std::mutex > lock(m_mutex);
+					if (!m_exception) {
+						m_exception = std::current_exception();
+					}
+				}
+				g_parallel_worker = enclosing;
+			}
+
+			/**
+			 Stops and joins the threads.
+			 */
+			void Stop() {
+				{
+					const std::lock_guard< std::mutex > lock(m_mutex);
+					m_stop = true;
+				}
+				m_start_condition.notify_all();
+
+				for (auto& thread : m_threads) {
+					thread.join();
+				}
+			}
+
+			/**
+			 Runs the workers of all runs until this worker pool is
+			 destructed.
+			 */
+			void RunThread() noexcept {
+				U64 generation = 0u;
+
+				std::unique_lock< std::mutex > lock(m_mutex);
+				while (true) {
+					m_start_condition.wait(lock, [this, generation]() noexcept {
+						return m_stop || generation != m_generation;
+					});
+					if (m_stop) {
+						return;
+					}
+
+					generation = m_generation;
+					if (m_nb_claimed == m_nb_requested) {
+						// All requested threads of this run already started.
+						continue;
+					}
+					++m_nb_claimed;
+
+					lock.unlock();
+					RunCurrentWorker();
+					lock.lock();
+
+					if (0u == --m_nb_pending) {
+						m_done_condition.notify_one();
+					}
+				}
+			}
+
+			/**
+			 The threads.
+			 */
+			std::vector< std::thread > m_threads;
+
+			/**
+			 The mutex guarding the remaining members.
+			 */
+			std::mutex m_mutex;
+
+			/**
+			 The condition variable signaling a new run or destruction.
+			 */
+			std::condition_variable m_start_condition;
+
+			/**
+			 The condition variable signaling the completion of all threads
+			 of the current run.
+			 */
+			std::condition_variable m_done_condition;
+
+			/**
+			 A pointer to the worker of the current run.
+			 */
+			const std::function< void() >* m_worker = nullptr;
+
+			/**
+			 The generation (i.e. the number of started runs).
+			 */
+			U64 m_generation = 0u;
+
+			/**
+			 The number of threads requested for the current run (excluding
+			 the calling thread).
+			 */
+			std::size_t m_nb_requested = 0u;
+
+			/**
+			 The number of threads which started the current run.
+			 */
+			std::size_t m_nb_claimed = 0u;
+
+			/**
+			 The number of requested threads which did not finish the current
+			 run.
+			 */
+			std::size_t m_nb_pending = 0u;
+
+			/**
+			 The first exception thrown by a worker of the current run.
+			 */
+			std::exception_ptr m_exception;
+
+			/**
+			 Flag indicating whether the threads need to stop.
+			 */
+			bool m_stop = false;
+		};
+	}
+
+	WorkerPool::WorkerPool(std::size_t nb_threads)
+		: m_state(MakeUnique< details::WorkerPoolState >()) {
+
+		// The calling thread of each run participates as well.
+		const auto nb_pooled_threads = std::max(nb_threads, std::size_t(1u)) - 1u;
+
+		try {
+			m_state->m_threads.reserve(nb_pooled_threads);
+			for (std::size_t i = 0u; i < nb_pooled_threads; ++i) {
+				m_state->m_threads.emplace_back(
+					&details::WorkerPoolState::RunThread, m_state.get());
+			}
+		}
+		catch (...) {
+			// The destructor is not called for a partially constructed
+			// worker pool.
+			m_state->Stop();
+			throw;
+		}
+	}
+
+	WorkerPool::WorkerPool(WorkerPool&& pool) noexcept = default;
+
+	WorkerPool::~WorkerPool() {
+		if (nullptr == m_state) {
+			return;
+		}
+
+		m_state->Stop();
+	}
+
+	WorkerPool& WorkerPool::operator=(WorkerPool&& pool) noexcept = default;
+
+	std::size_t WorkerPool::GetNumberOfThreads() const noexcept {
+		return (nullptr == m_state) ? 1u : m_state->m_threads.size() + 1u;
+	}
+
+	void WorkerPool::RunWorker(std::size_t nb_threads,
+							   const std::function< void() >& worker) {
+
+		// Nested runs run on the calling thread only.
+		if (nullptr == m_state || details::g_parallel_worker || nb_threads <= 1u) {
+			worker();
+			return;
+		}
+
+		auto& state = *m_state;
+		{
+			const std::lock_guard< std::mutex > lock(state.m_mutex);
+			state.m_worker       = &worker;
+			state.m_nb_requested = std::min(nb_threads - 1u, state.m_threads.size());
+			state.m_nb_claimed   = 0u;
+			state.m_nb_pending   = state.m_nb_requested;
+			state.m_exception    = nullptr;
+			++state.m_generation;
+		}
+		state.m_start_condition.notify_all();
+
+		state.RunCurrentWorker();
+
+		std::exception_ptr exception;
+		{
+			std::unique_lock< std::mutex > lock(state.m_mutex);
+			state.m_done_condition.wait(lock, [&state]() noexcept {
+				return 0u == state.m_nb_pending;
+			});
+			state.m_worker = nullptr;
+			exception = std::exchange(state.m_exception, nullptr);
+		}
+
+		if (exception) {
+			std::rethrow_exception(exception);
+		}
+	}
+}
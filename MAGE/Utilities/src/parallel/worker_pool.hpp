@@ -0,0 +1,170 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory/memory.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace details {
+
+		/**
+		 A struct of worker pool states shared between a worker pool and its
+		 threads.
+		 */
+		struct WorkerPoolState;
+	}
+
+	/**
+	 A class of worker pools.
+
+	 A worker pool owns a fixed number of persistent threads which sleep
+	 between runs, so work which is distributed over the system cores each
+	 frame does not create and join threads each frame.
+	 */
+	class WorkerPool {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a worker pool.
+
+		 @param[in]		nb_threads
+						The number of threads (including the calling thread
+						of each run).
+		 */
+		explicit WorkerPool(std::size_t nb_threads);
+
+		/**
+		 Constructs a worker pool from the given worker pool.
+
+		 @param[in]		pool
+						A reference to the worker pool to copy.
+		 */
+		WorkerPool(const WorkerPool& pool) = delete;
+
+		/**
+		 Constructs a worker pool by moving the given worker pool.
+
+		 @param[in]		pool
+						A reference to the worker pool to move.
+		 */
+		WorkerPool(WorkerPool&& pool) noexcept;
+
+		/**
+		 Destructs this worker pool. The threads are joined.
+		 */
+		~WorkerPool();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given worker pool to this worker pool.
+
+		 @param[in]		pool
+						A reference to the worker pool to copy.
+		 @return		A reference to the copy of the given worker pool (i.e.
+						this worker pool).
+		 */
+		WorkerPool& operator=(const WorkerPool& pool) = delete;
+
+		/**
+		 Moves the given worker pool to this worker pool.
+
+		 @param[in]		pool
+						A reference to the worker pool to move.
+		 @return		A reference to the moved worker pool (i.e. this
+						worker pool).
+		 */
+		WorkerPool& operator=(WorkerPool&& pool) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of threads of this worker pool (including the
+		 calling thread of each run).
+
+		 @return		The number of threads of this worker pool.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfThreads() const noexcept;
+
+		/**
+		 Runs the given worker on the given number of threads (including the
+		 calling thread) of this worker pool and waits for all of them to
+		 finish.
+
+		 Like @c RunParallel, nested runs only run on the calling thread and
+		 the first exception thrown by a worker is rethrown on the calling
+		 thread after all threads finished.
+
+		 @pre			This method is not called concurrently.
+		 @tparam		WorkerT
+						The worker type.
+		 @param[in]		nb_threads
+						The number of threads. At most the number of threads
+						of this worker pool are used.
+		 @param[in]		worker
+						A reference to the worker. The worker is invoked once
+						per thread.
+		 */
+		template< typename WorkerT >
+		void Run(std::size_t nb_threads, WorkerT& worker) {
+			// The reference wrapper does not allocate.
+			RunWorker(nb_threads, std::function< void() >(std::ref(worker)));
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Runs the given worker on the given number of threads (including the
+		 calling thread) of this worker pool and waits for all of them to
+		 finish.
+
+		 @param[in]		nb_threads
+						The number of threads.
+		 @param[in]		worker
+						A reference to the worker.
+		 */
+		void RunWorker(std::size_t nb_threads,
+					   const std::function< void() >& worker);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the state of this worker pool.
+		 */
+		UniquePtr< details::WorkerPoolState > m_state;
+	};
+}
@@ -6,7 +6,7 @@
 #pragma region
 
 // Scalar types.
-#include "type\scalar_types.hpp"
+#include "type/scalar_types.hpp"
 
 #pragma endregion
 
@@ -5,7 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "exception\exception.hpp"
+#include "exception/exception.hpp"
+#include "io/archive.hpp"
 
 #pragma endregion
 
@@ -130,6 +131,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\resource.tpp"
+#include "resource/resource.tpp"
 
 #pragma endregion
\ No newline at end of file
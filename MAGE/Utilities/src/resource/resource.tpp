@@ -24,7 +24,7 @@ namespace mage {
 	template< typename ResourceT >
 	[[nodiscard]]
 	bool Resource< ResourceT >::IsFileResource() const {
-		return std::filesystem::is_regular_file(m_guid);
+		return FileExists(m_guid);
 	}
 
 	template< typename ResourceT >
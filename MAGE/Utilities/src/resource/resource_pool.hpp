@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "type/types.hpp"
 
 #pragma endregion
 
@@ -14,6 +14,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include <future>
 #include <map>
 #include <mutex>
 
@@ -232,6 +233,12 @@ namespace mage {
 		 */
 		using ResourceMap = std::map< KeyT, WeakPtr< ResourceT > >;
 
+		/**
+		 A map of resources under construction used by a resource pool.
+		 */
+		using PendingResourceMap
+			= std::map< KeyT, std::shared_future< SharedPtr< ResourceT > > >;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -241,6 +248,17 @@ namespace mage {
 		 */
 		ResourceMap m_resource_map;
 
+		/**
+		 The map containing the resources under construction of this resource
+		 pool.
+
+		 Resources are constructed without holding the mutex of this resource
+		 pool, which allows resources to be constructed in parallel. Concurrent
+		 requests for a resource under construction wait for its construction
+		 instead of constructing the same resource twice.
+		 */
+		PendingResourceMap m_pending_resource_map;
+
 		/**
 		 The mutex for accessing the resource map of this resource pool.
 		 */
@@ -590,6 +608,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\resource_pool.tpp"
+#include "resource/resource_pool.tpp"
 
 #pragma endregion
\ No newline at end of file
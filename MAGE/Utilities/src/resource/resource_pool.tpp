@@ -16,7 +16,8 @@ namespace mage {
 
 		const std::scoped_lock lock(pool.m_mutex);
 
-		m_resource_map = std::move(pool.m_resource_map);
+		m_resource_map         = std::move(pool.m_resource_map);
+		m_pending_resource_map = std::move(pool.m_pending_resource_map);
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -93,24 +94,57 @@ namespace mage {
 	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
 		::GetOrCreateDerived(const KeyT& key, ConstructorArgsT&&... args) {
 
-		const std::scoped_lock lock(m_mutex);
+		std::promise< SharedPtr< ResourceT > > promise;
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+		{
+			std::unique_lock lock(m_mutex);
 
-			const auto resource = it->second.lock();
-			if (resource) {
-				return resource;
+			if (const auto it = m_resource_map.find(key);
+				it != m_resource_map.end()) {
+
+				const auto resource = it->second.lock();
+				if (resource) {
+					return resource;
+				}
+
+				m_resource_map.erase(it);
 			}
 
-			m_resource_map.erase(it);
+			if (const auto it = m_pending_resource_map.find(key);
+				it != m_pending_resource_map.end()) {
+
+				const auto pending_resource = it->second;
+				lock.unlock();
+
+				// Wait for the resource under construction.
+				return pending_resource.get();
+			}
+
+			m_pending_resource_map.emplace(key, promise.get_future().share());
+		}
+
+		SharedPtr< ResourceT > new_resource;
+		try {
+			new_resource = MakeAllocatedShared< Resource< DerivedResourceT > >
+				           (*this, key, std::forward< ConstructorArgsT >(args)...);
 		}
+		catch (...) {
+			{
+				const std::scoped_lock lock(m_mutex);
+				m_pending_resource_map.erase(key);
+			}
 
-		const auto new_resource
-			= MakeAllocatedShared< Resource< DerivedResourceT > >
-			  (*this, key, std::forward< ConstructorArgsT >(args)...);
+			promise.set_exception(std::current_exception());
+			throw;
+		}
 
-		m_resource_map.emplace(key, new_resource);
+		{
+			const std::scoped_lock lock(m_mutex);
+			m_resource_map.emplace(key, new_resource);
+			m_pending_resource_map.erase(key);
+		}
+
+		promise.set_value(new_resource);
 
 		return new_resource;
 	}
@@ -3,8 +3,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\script\variable_script.hpp"
-#include "loaders\variable_script_loader.hpp"
+#include "resource/script/variable_script.hpp"
+#include "loaders/variable_script_loader.hpp"
 
 #pragma endregion
 
@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\resource.hpp"
-#include "resource\script\variable_value.hpp"
+#include "resource/resource.hpp"
+#include "resource/script/variable_value.hpp"
 
 #pragma endregion
 
@@ -248,6 +248,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "resource\script\variable_script.tpp"
+#include "resource/script/variable_script.tpp"
 
 #pragma endregion
\ No newline at end of file
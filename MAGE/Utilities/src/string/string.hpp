@@ -5,8 +5,8 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include <gsl\pointers>
-#include <gsl\string_span>
+#include <gsl/pointers>
+#include <gsl/string_span>
 #include <string>
 #include <string_view>
 
@@ -3,7 +3,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "string\string_utils.hpp"
+#include "string/string_utils.hpp"
 
 #pragma endregion
 
@@ -14,6 +14,10 @@
 
 #include <limits>
 
+#ifndef _WIN32
+	#include <cerrno>
+#endif // _WIN32
+
 #pragma endregion
 
 //-----------------------------------------------------------------------------
@@ -21,7 +25,9 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
-	DWORD UTF8toUTF16::Convert(std::string_view s) {
+	#ifdef _WIN32
+
+	U32 UTF8toUTF16::Convert(std::string_view s) {
 		if (std::numeric_limits< int >::max() < s.size()) {
 			return ERROR_INVALID_PARAMETER;
 		}
@@ -49,7 +55,7 @@ namespace mage {
 		return 0u;
 	}
 
-	DWORD UTF16toUTF8::Convert(std::wstring_view s) {
+	U32 UTF16toUTF8::Convert(std::wstring_view s) {
 		if (std::numeric_limits< int >::max() < s.size()) {
 			return ERROR_INVALID_PARAMETER;
 		}
@@ -76,4 +82,154 @@ namespace mage {
 
 		return 0u;
 	}
+
+	#else  // _WIN32
+
+	namespace {
+
+		/**
+		 Decodes the first code point of the given UTF-8 string.
+
+		 @param[in,out]	s
+						A reference to the UTF-8 string. The decoded code
+						units are removed from the front of the string.
+		 @return		The decoded code point, if the first code units of
+						the given string are valid UTF-8.
+		 */
+		[[nodiscard]]
+		const std::optional< char32_t > DecodeUTF8(std::string_view& s) noexcept {
+			const auto lead = static_cast< unsigned char >(s.front());
+			const std::size_t nb_units = (lead < 0x80u) ? 1u
+				                       : (lead < 0xC2u) ? 0u
+				                       : (lead < 0xE0u) ? 2u
+				                       : (lead < 0xF0u) ? 3u
+				                       : (lead < 0xF5u) ? 4u : 0u;
+			if (0u == nb_units || s.size() < nb_units) {
+				return {};
+			}
+
+			static constexpr unsigned char s_lead_masks[] = { 0x7Fu, 0x1Fu, 0x0Fu, 0x07u };
+			auto code_point = static_cast< char32_t >(lead & s_lead_masks[nb_units - 1u]);
+			for (std::size_t i = 1u; i < nb_units; ++i) {
+				const auto unit = static_cast< unsigned char >(s[i]);
+				if (0x80u != (unit & 0xC0u)) {
+					return {};
+				}
+				code_point = (code_point << 6u) | (unit & 0x3Fu);
+			}
+
+			// Reject overlong encodings, surrogates and out-of-range values.
+			static constexpr char32_t s_min_code_points[] = { 0x0u, 0x80u, 0x800u, 0x10000u };
+			if (code_point < s_min_code_points[nb_units - 1u]
+				|| (0xD800u <= code_point && code_point <= 0xDFFFu)
+				|| 0x10FFFFu < code_point) {
+				return {};
+			}
+
+			s.remove_prefix(nb_units);
+			return code_point;
+		}
+
+		/**
+		 Decodes the first code point of the given wide string.
+
+		 @param[in,out]	s
+						A reference to the wide string. The decoded code
+						units are removed from the front of the string.
+		 @return		The decoded code point, if the first code units of
+						the given string are valid UTF-16 or UTF-32
+						(depending on the size of @c wchar_t).
+		 */
+		[[nodiscard]]
+		const std::optional< char32_t > DecodeWide(std::wstring_view& s) noexcept {
+			auto code_point = static_cast< char32_t >(s.front());
+			s.remove_prefix(1u);
+
+			if constexpr (2u == sizeof(wchar_t)) {
+				if (0xD800u <= code_point && code_point <= 0xDBFFu) {
+					if (s.empty()) {
+						return {};
+					}
+					const auto low = static_cast< char32_t >(s.front());
+					if (low < 0xDC00u || 0xDFFFu < low) {
+						return {};
+					}
+					s.remove_prefix(1u);
+					return 0x10000u + ((code_point - 0xD800u) << 10u) + (low - 0xDC00u);
+				}
+			}
+
+			if ((0xD800u <= code_point && code_point <= 0xDFFFu)
+				|| 0x10FFFFu < code_point) {
+				return {};
+			}
+
+			return code_point;
+		}
+	}
+
+	U32 UTF8toUTF16::Convert(std::string_view s) {
+		m_buffer.resize(0u);
+		m_buffer.reserve(s.size() + 1u);
+
+		while (!s.empty()) {
+			const auto code_point = DecodeUTF8(s);
+			if (!code_point) {
+				m_buffer.resize(1u);
+				m_buffer[0] = L'\0';
+				return EILSEQ;
+			}
+
+			if (2u == sizeof(wchar_t) && 0xFFFFu < *code_point) {
+				const auto offset = *code_point - 0x10000u;
+				m_buffer.push_back(static_cast< wchar_t >(0xD800u + (offset >> 10u)));
+				m_buffer.push_back(static_cast< wchar_t >(0xDC00u + (offset & 0x3FFu)));
+			}
+			else {
+				m_buffer.push_back(static_cast< wchar_t >(*code_point));
+			}
+		}
+
+		m_buffer.push_back(L'\0');
+		return 0u;
+	}
+
+	U32 UTF16toUTF8::Convert(std::wstring_view s) {
+		m_buffer.resize(0u);
+		m_buffer.reserve(s.size() + 1u);
+
+		while (!s.empty()) {
+			const auto code_point = DecodeWide(s);
+			if (!code_point) {
+				m_buffer.resize(1u);
+				m_buffer[0] = '\0';
+				return EILSEQ;
+			}
+
+			const auto c = *code_point;
+			if (c < 0x80u) {
+				m_buffer.push_back(static_cast< char >(c));
+			}
+			else if (c < 0x800u) {
+				m_buffer.push_back(static_cast< char >(0xC0u | (c >> 6u)));
+				m_buffer.push_back(static_cast< char >(0x80u | (c & 0x3Fu)));
+			}
+			else if (c < 0x10000u) {
+				m_buffer.push_back(static_cast< char >(0xE0u | (c >> 12u)));
+				m_buffer.push_back(static_cast< char >(0x80u | ((c >> 6u) & 0x3Fu)));
+				m_buffer.push_back(static_cast< char >(0x80u | (c & 0x3Fu)));
+			}
+			else {
+				m_buffer.push_back(static_cast< char >(0xF0u | (c >> 18u)));
+				m_buffer.push_back(static_cast< char >(0x80u | ((c >> 12u) & 0x3Fu)));
+				m_buffer.push_back(static_cast< char >(0x80u | ((c >> 6u) & 0x3Fu)));
+				m_buffer.push_back(static_cast< char >(0x80u | (c & 0x3Fu)));
+			}
+		}
+
+		m_buffer.push_back('\0');
+		return 0u;
+	}
+
+	#endif // _WIN32
 }
\ No newline at end of file
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "system\system_time.hpp"
+#include "system/system_time.hpp"
 
 #pragma endregion
 
@@ -239,6 +239,6 @@ namespace mage {
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "system\timer.tpp"
+#include "system/timer.tpp"
 
 #pragma endregion
\ No newline at end of file
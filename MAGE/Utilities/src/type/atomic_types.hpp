@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\scalar_types.hpp"
+#include "type/scalar_types.hpp"
 
 #pragma endregion
 